@@ -12,7 +12,7 @@ from sqlglot import condition, maybe_parse
 
 from infinity_embedded.common import VEC, SparseVector, InfinityException
 from infinity_embedded.embedded_infinity_ext import *
-from infinity_embedded.local_infinity.types import logic_type_to_dtype, make_match_tensor_expr
+from infinity_embedded.local_infinity.types import logic_type_to_dtype, make_match_tensor_expr, embedding_rows_to_cells
 from infinity_embedded.local_infinity.utils import traverse_conditions, parse_expr
 from infinity_embedded.table import ExplainType as BaseExplainType
 from infinity_embedded.errors import ErrorCode
@@ -413,7 +413,7 @@ class InfinityLocalQueryBuilder(ABC):
         self._columns = select_list
         return self
 
-    def to_result(self):
+    def to_result(self, numpy_result: bool = False):
         query = Query(
             columns=self._columns,
             search=self._search,
@@ -422,21 +422,36 @@ class InfinityLocalQueryBuilder(ABC):
             offset=self._offset,
         )
         self.reset()
-        return self._table._execute_query(query)
+        return self._table._execute_query(query, numpy_result)
 
     def to_df(self) -> pd.DataFrame:
         df_dict = {}
-        data_dict, data_type_dict = self.to_result()
+        data_dict, data_type_dict = self.to_result(numpy_result=True)
         for k, v in data_dict.items():
+            if isinstance(v, np.ndarray) and v.ndim == 2:
+                # embedding cells are views of the rows, the values are not copied
+                v = embedding_rows_to_cells(v)
             data_series = pd.Series(v, dtype=logic_type_to_dtype(data_type_dict[k]))
             df_dict[k] = data_series
         return pd.DataFrame(df_dict)
 
     def to_pl(self) -> pl.DataFrame:
-        return pl.from_pandas(self.to_df())
+        # built from the arrow table, so fixed-width columns don't go through python objects either
+        return pl.from_arrow(self.to_arrow())
 
     def to_arrow(self) -> Table:
-        return pa.Table.from_pandas(self.to_df())
+        # fixed-width columns are handed to arrow without going through python objects
+        arrays = []
+        data_dict, data_type_dict = self.to_result(numpy_result=True)
+        for k, v in data_dict.items():
+            if isinstance(v, np.ndarray) and v.ndim == 2:
+                offsets = np.arange(0, v.size + 1, v.shape[1], dtype=np.int32)
+                arrays.append(pa.ListArray.from_arrays(offsets, pa.array(v.reshape(-1))))
+            elif isinstance(v, np.ndarray):
+                arrays.append(pa.array(v.astype(logic_type_to_dtype(data_type_dict[k]), copy=False)))
+            else:
+                arrays.append(pa.array(v))
+        return pa.Table.from_arrays(arrays, names=list(data_dict.keys()))
 
     def explain(self, explain_type=ExplainType.kPhysical) -> Any:
         query = ExplainQuery(
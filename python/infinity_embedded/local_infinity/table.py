@@ -18,14 +18,14 @@ from typing import Optional, Union, List, Any
 
 import numpy as np
 from infinity_embedded.embedded_infinity_ext import ConflictType as LocalConflictType
-from infinity_embedded.embedded_infinity_ext import WrapIndexInfo, ImportOptions, CopyFileType, WrapParsedExpr, \
+from infinity_embedded.embedded_infinity_ext import WrapIndexInfo, ImportOptions, CopyFileType, CopyCompressionType, WrapParsedExpr, \
     ParsedExprType, WrapUpdateExpr, ExportOptions, WrapOptimizeOptions
 from infinity_embedded.common import ConflictType, DEFAULT_MATCH_VECTOR_TOPN
 from infinity_embedded.common import INSERT_DATA, VEC, SparseVector, InfinityException
 from infinity_embedded.errors import ErrorCode
 from infinity_embedded.index import IndexInfo
 from infinity_embedded.local_infinity.query_builder import Query, InfinityLocalQueryBuilder, ExplainQuery
-from infinity_embedded.local_infinity.types import build_result
+from infinity_embedded.local_infinity.types import build_result, build_numpy_result
 from infinity_embedded.local_infinity.utils import traverse_conditions, select_res_to_polars
 from infinity_embedded.local_infinity.utils import get_local_constant_expr_from_python_value
 from infinity_embedded.local_infinity.utils import name_validity_check
@@ -258,6 +258,16 @@ class LocalTable():
                         options.row_limit = v
                     else:
                         raise InfinityException(ErrorCode.IMPORT_FILE_FORMAT_ERROR, "Integer value is expected in 'row_limit' field")
+                elif key == 'compression':
+                    compression = v.lower()
+                    if compression == 'zstd':
+                        options.compression_type = CopyCompressionType.kZstd
+                    elif compression == 'lz4':
+                        options.compression_type = CopyCompressionType.kLz4
+                    elif compression == 'none':
+                        options.compression_type = CopyCompressionType.kNone
+                    else:
+                        raise InfinityException(ErrorCode.IMPORT_FILE_FORMAT_ERROR, f"Unrecognized export compression: {compression}")
                 else:
                     raise InfinityException(ErrorCode.IMPORT_FILE_FORMAT_ERROR, f"Unknown export parameter: {k}")
         if not columns:
@@ -376,7 +386,7 @@ class LocalTable():
         opt_options.opt_params = [InitParameter(k, v).to_local_type() for k, v in opt_params.items()]
         return self._conn.optimize(db_name=self._db_name, table_name=self._table_name, optimize_opt=opt_options)
 
-    def _execute_query(self, query: Query):
+    def _execute_query(self, query: Query, numpy_result: bool = False):
         # execute the query
         res = self._conn.select(db_name=self._db_name,
                                 table_name=self._table_name,
@@ -389,7 +399,7 @@ class LocalTable():
 
         # process the results
         if res.error_code == ErrorCode.OK:
-            return build_result(res)
+            return build_numpy_result(res) if numpy_result else build_result(res)
         else:
             raise InfinityException(res.error_code, res.error_msg)
 
@@ -351,6 +351,54 @@ def make_match_tensor_expr(vector_column_name: str, embedding_data: VEC, embeddi
     match_tensor_expr.embedding_data = data
     return match_tensor_expr
 
+def bfloat16_to_float32(array: np.ndarray) -> np.ndarray:
+    return (array.astype(np.uint32) << 16).view(np.float32)
+
+
+def column_arrays_to_numpy(column_data_type, column_arrays) -> np.ndarray:
+    # Fixed-width columns come as one array per data block, borrowing the result buffers.
+    # A single block is returned as is, without any copy.
+    array = column_arrays[0] if len(column_arrays) == 1 else np.concatenate(column_arrays)
+    is_bfloat16 = column_data_type.logical_type == LogicalType.kBFloat16 or (
+            column_data_type.logical_type == LogicalType.kEmbedding and
+            column_data_type.embedding_type.element_type == EmbeddingDataType.kElemBFloat16)
+    if is_bfloat16:
+        array = bfloat16_to_float32(array)
+    return array
+
+
+def embedding_rows_to_cells(array: np.ndarray) -> np.ndarray:
+    # One object per row of a [row_count, dimension] array, each a view of the row sharing the buffer of `array`
+    cells = np.empty(array.shape[0], dtype=object)
+    for i in range(array.shape[0]):
+        cells[i] = array[i]
+    return cells
+
+
+def build_numpy_result(res: WrapQueryResult) -> tuple[dict[str | Any, Any], dict[str | Any, Any]]:
+    # Same as build_result, but fixed-width columns are kept as numpy arrays instead of lists,
+    # embeddings as [row_count, dimension] arrays.
+    data_dict = {}
+    data_type_dict = {}
+    column_counter = defaultdict(int)
+    for column_def, column_field in zip(res.column_defs, res.column_fields):
+        original_column_name = column_def.column_name
+        column_counter[original_column_name] += 1
+        column_name = f"{original_column_name}_{column_counter[original_column_name]}" \
+            if column_counter[original_column_name] > 1 \
+            else original_column_name
+
+        column_data_type = column_def.column_type
+        if column_field.column_arrays:
+            data_dict[column_name] = column_arrays_to_numpy(column_data_type, column_field.column_arrays)
+        else:
+            data_dict[column_name] = column_vector_to_list(column_field.column_type, column_data_type,
+                                                           column_field.column_vectors)
+        data_type_dict[column_name] = column_data_type
+
+    return data_dict, data_type_dict
+
+
 def build_result(res: WrapQueryResult) -> tuple[dict[str | Any, list[Any, Any]], dict[str | Any, Any]]:
     data_dict = {}
     data_type_dict = {}
@@ -364,8 +412,10 @@ def build_result(res: WrapQueryResult) -> tuple[dict[str | Any, list[Any, Any]],
 
         column_type = column_field.column_type
         column_data_type = column_def.column_type
-        column_vectors = column_field.column_vectors
-        data_list = column_vector_to_list(column_type, column_data_type, column_vectors)
+        if column_field.column_arrays:
+            data_list = column_arrays_to_numpy(column_data_type, column_field.column_arrays).tolist()
+        else:
+            data_list = column_vector_to_list(column_type, column_data_type, column_field.column_vectors)
 
         data_dict[column_name] = data_list
         data_type_dict[column_name] = column_data_type
@@ -158,6 +158,27 @@ def parse_expr(expr):
             raise Exception(f"unknown expression type: {expr}")
 
 
+def get_local_constant_expr_from_numpy(value: np.ndarray) -> WrapConstantExpr:
+    # the array is copied by the extension in one pass, no per-element python objects are created
+    constant_expression = WrapConstantExpr()
+    is_integer = np.issubdtype(value.dtype, np.integer)
+    value = np.ascontiguousarray(value, dtype=np.int64 if is_integer else np.float64)
+    if value.ndim == 1:
+        if is_integer:
+            constant_expression.literal_type = LiteralType.kIntegerArray
+            constant_expression.set_i64_array(value)
+        else:
+            constant_expression.literal_type = LiteralType.kDoubleArray
+            constant_expression.set_f64_array(value)
+    else:
+        constant_expression.literal_type = LiteralType.kSubArrayArray
+        if is_integer:
+            constant_expression.set_i64_tensor(value)
+        else:
+            constant_expression.set_f64_tensor(value)
+    return constant_expression
+
+
 def get_local_constant_expr_from_python_value(value) -> WrapConstantExpr:
     # convert numpy types
     if isinstance(value, np.integer):
@@ -171,6 +192,9 @@ def get_local_constant_expr_from_python_value(value) -> WrapConstantExpr:
             raise InfinityException(ErrorCode.INVALID_EXPRESSION,
                                     f"Invalid list member type: {type(value[0])}, ndarray dimension > 2")
     elif isinstance(value, np.ndarray):
+        if value.size > 0 and value.ndim <= 2 and (np.issubdtype(value.dtype, np.integer) or
+                                                  np.issubdtype(value.dtype, np.floating)):
+            return get_local_constant_expr_from_numpy(value)
         if value.ndim <= 2:
             value = value.tolist()
         else:
@@ -8,11 +8,12 @@ import infinity
 
 
 class InfinityRunner:
-    def __init__(self, infinity_path: str):
-        self.data_dir = "/var/infinity"
+    def __init__(self, infinity_path: str, data_dir: str = "/var/infinity", log_name: str = "restart_test.log"):
+        self.data_dir = data_dir
         self.default_config_path = "./conf/infinity_conf.toml"
         self.script_path = "./scripts/timeout_kill.sh"
         self.infinity_path = infinity_path
+        self.log_name = log_name
         self.i = 0
 
     def clear(self):
@@ -22,7 +23,7 @@ class InfinityRunner:
     def init(self, config_path: str | None = None):
         if config_path is None:
             config_path = self.default_config_path
-        cmd = f"{self.infinity_path} --config={config_path} > restart_test.log.{self.i} 2>&1"
+        cmd = f"{self.infinity_path} --config={config_path} > {self.log_name}.{self.i} 2>&1"
 
         # unset env LD_PRELOAD, ASAN_OPTIONS
         my_env = os.environ.copy()
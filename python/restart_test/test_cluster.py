@@ -0,0 +1,128 @@
+import os
+import time
+
+import infinity
+import psycopg2
+from infinity import NetworkAddress
+from infinity.common import ConflictType
+from infinity_runner import InfinityRunner
+
+# The ports and data directories of conf/leader.toml and conf/follower.toml
+LEADER_CONFIG = "conf/leader.toml"
+LEADER_DATA_DIR = "/var/infinity/leader"
+LEADER_URI = NetworkAddress("127.0.0.1", 23818)
+LEADER_PG_PORT = 5433
+LEADER_PEER_ADDRESS = "127.0.0.1:23851"
+
+FOLLOWER_CONFIG = "conf/follower.toml"
+FOLLOWER_DATA_DIR = "/var/infinity/follower"
+FOLLOWER_URI = NetworkAddress("127.0.0.1", 23819)
+FOLLOWER_PG_PORT = 5434
+
+
+def admin_query(pg_port: int, sql: str):
+    # Admin statements are only served through the postgres protocol
+    try_n = 100
+    for i in range(try_n):
+        try:
+            conn = psycopg2.connect(host="127.0.0.1", port=pg_port, sslmode="disable")
+            break
+        except psycopg2.OperationalError as e:
+            print(e)
+            time.sleep(0.5)
+            print(f"retry pg connect {i}")
+    else:
+        raise Exception(f"Cannot connect to postgres port {pg_port}")
+    try:
+        conn.autocommit = True
+        with conn.cursor() as cursor:
+            cursor.execute(sql)
+            if cursor.description is None:
+                return []
+            columns = [desc[0] for desc in cursor.description]
+            return [dict(zip(columns, row)) for row in cursor.fetchall()]
+    finally:
+        conn.close()
+
+
+def wait_until(predicate, timeout: float = 30):
+    deadline = time.time() + timeout
+    while time.time() < deadline:
+        if predicate():
+            return True
+        time.sleep(0.5)
+    return predicate()
+
+
+def test_leader_follower(infinity_runner: InfinityRunner):
+    leader_runner = InfinityRunner(infinity_runner.infinity_path, LEADER_DATA_DIR, "restart_test.log.leader")
+    follower_runner = InfinityRunner(infinity_runner.infinity_path, FOLLOWER_DATA_DIR, "restart_test.log.follower")
+    leader_runner.clear()
+    follower_runner.clear()
+
+    leader_runner.init(LEADER_CONFIG)
+    follower_runner.init(FOLLOWER_CONFIG)
+    try:
+        admin_query(LEADER_PG_PORT, "ADMIN SET LEADER USING 'leader1'")
+        admin_query(FOLLOWER_PG_PORT, f"ADMIN CONNECT '{LEADER_PEER_ADDRESS}' AS FOLLOWER USING 'follower1'")
+
+        leader_obj = InfinityRunner.connect(LEADER_URI)
+        db_obj = leader_obj.get_database("default_db")
+        db_obj.drop_table("test_cluster", ConflictType.Ignore)
+        table_obj = db_obj.create_table("test_cluster", {"c1": {"type": "int"}, "c2": {"type": "varchar"}}, ConflictType.Error)
+        insert_n = 1000
+        batch_n = 100
+        for begin in range(0, insert_n, batch_n):
+            table_obj.insert([{"c1": i, "c2": f"row {i}"} for i in range(begin, begin + batch_n)])
+
+        data_dict, _ = table_obj.output(["count(*)"]).to_result()
+        assert data_dict["count(star)"][0] == insert_n
+
+        # The rows written on leader are shipped to follower
+        follower_obj = InfinityRunner.connect(FOLLOWER_URI)
+
+        def follower_count():
+            try:
+                follower_table = follower_obj.get_database("default_db").get_table("test_cluster")
+                data_dict, _ = follower_table.output(["count(*)"]).to_result()
+                return data_dict["count(star)"][0]
+            except Exception as e:
+                print(e)
+                return -1
+
+        assert wait_until(lambda: follower_count() == insert_n)
+        follower_table = follower_obj.get_database("default_db").get_table("test_cluster")
+        data_dict, _ = follower_table.output(["c1", "c2"]).filter("c1 = 777").to_result()
+        assert list(data_dict["c2"]) == ["row 777"]
+
+        # LIST NODES of leader shows the lag of follower, which catches up once the rows are applied
+        def follower_node():
+            nodes = admin_query(LEADER_PG_PORT, "ADMIN SHOW NODES")
+            return next((node for node in nodes if node["name"] == "follower1"), None)
+
+        node = follower_node()
+        assert node is not None
+        assert node["role"] == "follower"
+        assert node["status"] == "alive"
+        assert node["lag"] >= 0
+        assert wait_until(lambda: follower_node()["lag"] == 0)
+
+        # An imported segment is read by follower from the persistence dir it shares with leader
+        import_file = os.path.join(os.getcwd(), "test_cluster_import.csv")
+        import_n = 100
+        with open(import_file, "w") as f:
+            for i in range(insert_n, insert_n + import_n):
+                f.write(f"{i},row {i}\n")
+        try:
+            table_obj.import_data(import_file, {"file_type": "csv"})
+        finally:
+            os.remove(import_file)
+        assert wait_until(lambda: follower_count() == insert_n + import_n)
+        assert follower_node()["status"] == "alive"
+
+        follower_obj.disconnect()
+        db_obj.drop_table("test_cluster", ConflictType.Error)
+        leader_obj.disconnect()
+    finally:
+        follower_runner.uninit()
+        leader_runner.uninit()
@@ -151,9 +151,16 @@ class TestInsert(HttpTest):
             }
         ])
         values = [{"c1": 1} for _ in range(8193)]
-        self.insert(db_name, table_name, values, expect={
-            "status_code": 500,
-            "error_code": 3032
+        self.insert(db_name, table_name, values)
+        self.select(db_name, table_name, ["count(*)"], "", {}, {}, {
+            "error_code": 0,
+            "output": [{"count(star)": "8193"}]
+        })
+        # the second batch starts in the partially filled block
+        self.insert(db_name, table_name, values)
+        self.select(db_name, table_name, ["count(*)"], "", {}, {}, {
+            "error_code": 0,
+            "output": [{"count(star)": "16386"}]
         })
         self.drop_table(db_name, table_name)
         return
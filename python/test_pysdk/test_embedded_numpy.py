@@ -0,0 +1,177 @@
+import gc
+import numpy as np
+import pandas as pd
+import polars as pl
+import pyarrow as pa
+import pytest
+from common import common_values
+import infinity_embedded
+from infinity_embedded.common import ConflictType
+from infinity_embedded.errors import ErrorCode
+from infinity_embedded.embedded_infinity_ext import LiteralType
+from infinity_embedded.local_infinity.utils import get_local_constant_expr_from_python_value
+
+
+# The NumPy paths only exist in the embedded SDK
+@pytest.mark.usefixtures("skip_if_remote_infinity")
+@pytest.mark.usefixtures("skip_if_http")
+class TestEmbeddedNumpy:
+    @pytest.fixture(autouse=True)
+    def setup(self, skip_if_remote_infinity, skip_if_http):
+        self.infinity_obj = infinity_embedded.connect(common_values.TEST_LOCAL_PATH)
+        assert self.infinity_obj
+        yield
+        res = self.infinity_obj.disconnect()
+        assert res.error_code == ErrorCode.OK
+
+    def create_table(self, table_name, columns, rows):
+        db_obj = self.infinity_obj.get_database("default_db")
+        db_obj.drop_table(table_name, ConflictType.Ignore)
+        table_obj = db_obj.create_table(table_name, columns, ConflictType.Error)
+        assert table_obj
+        res = table_obj.insert(rows)
+        assert res.error_code == ErrorCode.OK
+        return db_obj, table_obj
+
+    def test_numpy_result_borrows_buffers(self):
+        row_count = 100
+        embeddings = np.random.default_rng(0).random((row_count, 4), dtype=np.float32)
+        db_obj, table_obj = self.create_table("test_numpy_result_borrows_buffers", {
+            "c1": {"type": "int"}, "c2": {"type": "double"}, "c3": {"type": "vector,4,float"}},
+            [{"c1": i, "c2": i * 0.5, "c3": embeddings[i]} for i in range(row_count)])
+
+        data_dict, _ = table_obj.output(["c1", "c2", "c3"]).to_result(numpy_result=True)
+        for column in data_dict.values():
+            assert isinstance(column, np.ndarray)
+            # a single data block is handed over without a copy
+            assert not column.flags.owndata
+        assert data_dict["c1"].dtype == np.int32
+        assert data_dict["c2"].dtype == np.float64
+        assert data_dict["c3"].dtype == np.float32
+        assert data_dict["c3"].shape == (row_count, 4)
+        np.testing.assert_array_equal(data_dict["c1"], np.arange(row_count))
+        np.testing.assert_array_equal(data_dict["c2"], np.arange(row_count) * 0.5)
+        np.testing.assert_array_equal(data_dict["c3"], embeddings)
+
+        # embedding cells of the data frame are views of consecutive rows of one buffer
+        res = table_obj.output(["c3"]).to_df()
+        cells = res["c3"]
+        for cell in cells[:2]:
+            assert isinstance(cell, np.ndarray)
+            assert not cell.flags.owndata
+        assert cells[1].__array_interface__["data"][0] - cells[0].__array_interface__["data"][0] == 4 * 4
+        pd.testing.assert_frame_equal(res, pd.DataFrame({"c3": embeddings.tolist()}))
+
+        res = table_obj.output(["c1", "c3"]).to_pl()
+        assert res.schema["c3"] == pl.List(pl.Float32)
+        assert res["c1"].to_list() == list(range(row_count))
+        np.testing.assert_array_equal(np.array(res["c3"].to_list(), dtype=np.float32), embeddings)
+
+        res = table_obj.output(["c3"]).to_arrow()
+        assert res.schema.field("c3").type == pa.list_(pa.float32())
+        np.testing.assert_array_equal(np.array(res["c3"].to_pylist(), dtype=np.float32), embeddings)
+
+        res = db_obj.drop_table("test_numpy_result_borrows_buffers", ConflictType.Error)
+        assert res.error_code == ErrorCode.OK
+
+    def test_numpy_result_outlives_query_result(self):
+        row_count = 100
+        embeddings = np.random.default_rng(1).random((row_count, 4), dtype=np.float32)
+        db_obj, table_obj = self.create_table("test_numpy_result_outlives_query_result", {
+            "c1": {"type": "int64"}, "c2": {"type": "vector,4,float"}},
+            [{"c1": i * 3, "c2": embeddings[i]} for i in range(row_count)])
+
+        data_dict, _ = table_obj.output(["c1", "c2"]).to_result(numpy_result=True)
+        c1 = data_dict["c1"]
+        c2 = data_dict["c2"]
+        c2_row = c2[row_count - 1]
+        del data_dict
+        gc.collect()
+
+        # the arrays keep the result table alive after the table itself is gone
+        res = db_obj.drop_table("test_numpy_result_outlives_query_result", ConflictType.Error)
+        assert res.error_code == ErrorCode.OK
+        _, other_table_obj = self.create_table("test_numpy_result_outlives_query_result_2", {
+            "c1": {"type": "int64"}, "c2": {"type": "vector,4,float"}},
+            [{"c1": -1, "c2": [-1.0, -1.0, -1.0, -1.0]} for _ in range(row_count)])
+        other_table_obj.output(["c1", "c2"]).to_result(numpy_result=True)
+        gc.collect()
+
+        np.testing.assert_array_equal(c1, np.arange(row_count) * 3)
+        np.testing.assert_array_equal(c2, embeddings)
+        np.testing.assert_array_equal(c2_row, embeddings[row_count - 1])
+
+        res = db_obj.drop_table("test_numpy_result_outlives_query_result_2", ConflictType.Error)
+        assert res.error_code == ErrorCode.OK
+
+    def test_numpy_result_half_precision(self):
+        # values exactly representable in float16 and bfloat16
+        values = [-3.0, -1.5, 0.0, 0.25, 2.0, 96.0]
+        db_obj, table_obj = self.create_table("test_numpy_result_half_precision", {
+            "c1": {"type": "float16"}, "c2": {"type": "bfloat16"},
+            "c3": {"type": "vector,2,float16"}, "c4": {"type": "vector,2,bfloat16"}},
+            [{"c1": v, "c2": v, "c3": [v, -v], "c4": [v, -v]} for v in values])
+        expected = np.array(values, dtype=np.float32)
+        expected_embeddings = np.stack([expected, -expected], axis=1)
+
+        data_dict, _ = table_obj.output(["c1", "c2", "c3", "c4"]).to_result(numpy_result=True)
+        # float16 is a NumPy type, bfloat16 is widened to float32
+        assert data_dict["c1"].dtype == np.float16
+        assert data_dict["c2"].dtype == np.float32
+        assert data_dict["c3"].dtype == np.float16
+        assert data_dict["c4"].dtype == np.float32
+        assert data_dict["c3"].shape == (len(values), 2)
+        assert data_dict["c4"].shape == (len(values), 2)
+        np.testing.assert_array_equal(data_dict["c1"], expected)
+        np.testing.assert_array_equal(data_dict["c2"], expected)
+        np.testing.assert_array_equal(data_dict["c3"], expected_embeddings)
+        np.testing.assert_array_equal(data_dict["c4"], expected_embeddings)
+
+        res = table_obj.output(["c1", "c2"]).to_df()
+        pd.testing.assert_frame_equal(res, pd.DataFrame({"c1": expected, "c2": expected}))
+
+        res = db_obj.drop_table("test_numpy_result_half_precision", ConflictType.Error)
+        assert res.error_code == ErrorCode.OK
+
+    def test_numpy_constant_expr(self):
+        expr = get_local_constant_expr_from_python_value(np.array([1, -2, 3], dtype=np.int8))
+        assert expr.literal_type == LiteralType.kIntegerArray
+        assert list(expr.i64_array_value) == [1, -2, 3]
+
+        expr = get_local_constant_expr_from_python_value(np.array([0.5, -1.25], dtype=np.float32))
+        assert expr.literal_type == LiteralType.kDoubleArray
+        assert list(expr.f64_array_value) == [0.5, -1.25]
+
+        # non-contiguous arrays are copied into a contiguous one first
+        tensor = np.arange(12, dtype=np.int64).reshape(3, 4)[:, ::2]
+        expr = get_local_constant_expr_from_python_value(tensor)
+        assert expr.literal_type == LiteralType.kSubArrayArray
+        assert [list(row) for row in expr.i64_tensor_value] == tensor.tolist()
+
+        tensor = np.array([[0.5, 1.5], [-2.5, 3.5]], dtype=np.float64).T
+        expr = get_local_constant_expr_from_python_value(tensor)
+        assert expr.literal_type == LiteralType.kSubArrayArray
+        assert [list(row) for row in expr.f64_tensor_value] == tensor.tolist()
+
+    def test_insert_numpy_arrays(self):
+        db_obj, table_obj = self.create_table("test_insert_numpy_arrays", {
+            "c1": {"type": "vector,3,int"}, "c2": {"type": "vector,3,double"},
+            "c3": {"type": "tensor,2,int"}, "c4": {"type": "tensor,2,float"}},
+            [{"c1": np.array([1, 2, 3], dtype=np.int64),
+              "c2": np.array([0.5, -1.5, 2.5]),
+              "c3": np.array([[1, 2], [3, 4], [5, 6]], dtype=np.int32),
+              "c4": np.array([[0.5, 1.0], [-1.5, 2.0]], dtype=np.float32)},
+             {"c1": np.array([-4, 5, -6], dtype=np.int16),
+              "c2": np.array([1.0, 2.0, 3.0], dtype=np.float32),
+              "c3": np.array([[7, 8, 9, 10]], dtype=np.int64)[:, ::2],
+              "c4": np.array([[0.25, 4.0]], dtype=np.float64)}])
+
+        res = table_obj.output(["c1", "c2", "c3", "c4"]).to_df()
+        pd.testing.assert_frame_equal(res, pd.DataFrame({
+            "c1": ([1, 2, 3], [-4, 5, -6]),
+            "c2": ([0.5, -1.5, 2.5], [1.0, 2.0, 3.0]),
+            "c3": ([[1, 2], [3, 4], [5, 6]], [[7, 9]]),
+            "c4": ([[0.5, 1.0], [-1.5, 2.0]], [[0.25, 4.0]])}))
+
+        res = db_obj.drop_table("test_insert_numpy_arrays", ConflictType.Error)
+        assert res.error_code == ErrorCode.OK
@@ -369,12 +369,13 @@ class TestInfinity:
         table_obj = db_obj.create_table("test_insert_exceed_block_size"+suffix, {
             "c1": {"type": "float"}}, ConflictType.Error)
         assert table_obj
-        values = [{"c1": 1} for _ in range(8193)]
-
-        with pytest.raises(InfinityException) as exception:
-            table_obj.insert(values)
-            assert exception.type == InfinityException
-            assert exception.value.args[0] == "Insert batch row limit shouldn\'t more than 8193"
+        # a batch larger than a block is split into blocks
+        values = [{"c1": i} for i in range(3 * 8192 + 1)]
+        res = table_obj.insert(values)
+        assert res.error_code == ErrorCode.OK
+        res = table_obj.output(["count(*)", "max(c1)"]).to_df()
+        assert res.iloc[0, 0] == 3 * 8192 + 1
+        assert res.iloc[0, 1] == 3 * 8192
 
         res = db_obj.drop_table("test_insert_exceed_block_size"+suffix, ConflictType.Error)
         assert res.error_code == ErrorCode.OK
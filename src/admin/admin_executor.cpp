@@ -3601,6 +3601,8 @@ QueryResult AdminExecutor::ListNodes(QueryContext *query_context, const AdminSta
         MakeShared<ColumnDef>(3, varchar_type, "address", std::set<ConstraintType>()),
         MakeShared<ColumnDef>(4, varchar_type, "last_update", std::set<ConstraintType>()),
         MakeShared<ColumnDef>(5, bigint_type, "heartbeat", std::set<ConstraintType>()),
+        MakeShared<ColumnDef>(6, bigint_type, "txn_timestamp", std::set<ConstraintType>()),
+        MakeShared<ColumnDef>(7, bigint_type, "lag", std::set<ConstraintType>()),
     };
 
     SharedPtr<TableDef> table_def = TableDef::Make(MakeShared<String>("default_db"), MakeShared<String>("list_nodes"), column_defs);
@@ -3612,6 +3614,8 @@ QueryResult AdminExecutor::ListNodes(QueryContext *query_context, const AdminSta
         varchar_type,
         varchar_type,
         varchar_type,
+        bigint_type,
+        bigint_type,
         bigint_type
     };
 
@@ -3620,6 +3624,13 @@ QueryResult AdminExecutor::ListNodes(QueryContext *query_context, const AdminSta
     SizeT row_count = 0;
 
     Vector<SharedPtr<NodeInfo>> server_nodes = InfinityContext::instance().cluster_manager()->ListNodes();
+    // Followers and learners lag behind the last timestamp known of leader
+    i64 leader_txn_timestamp = 0;
+    for (const auto &server_node : server_nodes) {
+        if (server_node->node_role_ == NodeRole::kLeader) {
+            leader_txn_timestamp = server_node->txn_timestamp_;
+        }
+    }
     for (const auto &server_node : server_nodes) {
         if (output_block_ptr.get() == nullptr) {
             output_block_ptr = DataBlock::MakeUniquePtr();
@@ -3673,6 +3684,23 @@ QueryResult AdminExecutor::ListNodes(QueryContext *query_context, const AdminSta
             value_expr.AppendToChunk(output_block_ptr->column_vectors[5]);
         }
 
+        {
+            // txn_timestamp
+            Value value = Value::MakeBigInt(server_node->txn_timestamp_);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[6]);
+        }
+
+        {
+            // lag
+            i64 lag = 0;
+            if (server_node->node_role_ != NodeRole::kLeader) {
+                lag = std::max(leader_txn_timestamp - server_node->txn_timestamp_, i64(0));
+            }
+            Value value = Value::MakeBigInt(lag);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[7]);
+        }
 
         ++row_count;
         if (row_count % output_block_ptr->capacity() == 0) {
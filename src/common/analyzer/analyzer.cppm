@@ -46,6 +46,15 @@ public:
         return AnalyzeImpl(input, &array, &Analyzer::AppendTermList);
     }
 
+    /// Same output as Analyze(input, TermList &), without building a TermList:
+    /// each term is handed to on_term(const char *text, u32 len, u32 offset), and its text is only valid during the call.
+    template <typename OnTerm>
+    int Analyze(const Term &input, OnTerm &&on_term) {
+        bool last_is_placeholder = false;
+        void *array[3] = {&on_term, this, &last_is_placeholder};
+        return AnalyzeImpl(input, &array, &Analyzer::AppendTermView<std::remove_reference_t<OnTerm>>);
+    }
+
 protected:
     typedef void (
         *HookType)(void *data, const char *text, const u32 len, const u32 offset, const u8 and_or_bit, const u8 level, const bool is_special_char);
@@ -68,6 +77,27 @@ protected:
         }
     }
 
+    template <typename OnTerm>
+    static void
+    AppendTermView(void *data, const char *text, const u32 len, const u32 offset, const u8 and_or_bit, const u8 level, const bool is_special_char) {
+        void **parameters = (void **)data;
+        OnTerm *on_term = (OnTerm *)parameters[0];
+        Analyzer *analyzer = (Analyzer *)parameters[1];
+        bool *last_is_placeholder = (bool *)parameters[2];
+
+        if (is_special_char && !analyzer->extract_special_char_)
+            return;
+        if (is_special_char && analyzer->convert_to_placeholder_) {
+            if (!*last_is_placeholder) {
+                (*on_term)(PLACE_HOLDER.c_str(), PLACE_HOLDER.length(), offset);
+                *last_is_placeholder = true;
+            }
+        } else {
+            (*on_term)(text, len, offset);
+            *last_is_placeholder = std::string_view(text, len) == PLACE_HOLDER;
+        }
+    }
+
     static void AppendTermListForJieba(void *data, cppjieba::Word &cut_word) {
         void **parameters = (void **)data;
         TermList *output = (TermList *)parameters[0];
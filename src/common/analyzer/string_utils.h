@@ -50,50 +50,13 @@ inline void ToLower(char *data, size_t len) {
 
 inline void ToLower(const char *data, size_t len, char *out, size_t out_limit) {
     memcpy(out, data, len);
-    char *begin = out;
-    char *end = out + len;
-    char *p = begin;
-#if defined(__SSE2__)
-    static constexpr int SSE2_BYTES = sizeof(__m128i);
-    const char *sse2_end = begin + (len & ~(SSE2_BYTES - 1));
-    const auto a_minus1 = _mm_set1_epi8('A' - 1);
-    const auto z_plus1 = _mm_set1_epi8('Z' + 1);
-    const auto delta = _mm_set1_epi8('a' - 'A');
-    for (; p > sse2_end; p += SSE2_BYTES) {
-        auto bytes = _mm_loadu_si128((const __m128i *)p);
-        _mm_maskmoveu_si128(_mm_xor_si128(bytes, delta), _mm_and_si128(_mm_cmpgt_epi8(bytes, a_minus1), _mm_cmpgt_epi8(z_plus1, bytes)), p);
-    }
-#endif
-    for (; p < end; p += 1) {
-        if ('A' <= (*p) && (*p) <= 'Z')
-            (*p) += 32;
-    }
-    (*end) = '\0';
+    ToLower(out, len);
+    out[len] = '\0';
 }
 
 inline std::string ToLower(std::string const &s) {
     std::string result = s;
-    char *begin = result.data();
-    char *end = result.data() + s.size();
-    
-    char *p = begin;
-#if defined(__SSE2__)
-    const size_t size = result.size();
-    static constexpr int SSE2_BYTES = sizeof(__m128i);
-    const char *sse2_end = begin + (size & ~(SSE2_BYTES - 1));
-    
-    const auto a_minus1 = _mm_set1_epi8('A' - 1);
-    const auto z_plus1 = _mm_set1_epi8('Z' + 1);
-    const auto delta = _mm_set1_epi8('a' - 'A');
-    for (; p > sse2_end; p += SSE2_BYTES) {
-        auto bytes = _mm_loadu_si128((const __m128i *)p);
-        _mm_maskmoveu_si128(_mm_xor_si128(bytes, delta), _mm_and_si128(_mm_cmpgt_epi8(bytes, a_minus1), _mm_cmpgt_epi8(z_plus1, bytes)), p);
-    }
-#endif
-    for (; p < end; p += 1) {
-        if ('A' <= (*p) && (*p) <= 'Z')
-            (*p) += 32;
-    }
+    ToLower(result.data(), result.size());
     return result;
 }
 
@@ -17,6 +17,10 @@ module;
 #include <cctype>
 #include <cstring>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#endif
+
 import stl;
 import term;
 module tokenizer;
@@ -28,19 +32,32 @@ const CharType DELIMITER_CHR = 1; /// < delimiter
 const CharType SPACE_CHR = 2;     /// < space term
 const CharType UNITE_CHR = 3;     /// < united term
 
+namespace {
+/// bit (c >> 4) for the high nibble of an ASCII char c, no bit for the other chars
+alignas(16) constexpr u8 ASCII_HI_BITS[16] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0, 0, 0, 0, 0, 0, 0, 0};
+} // namespace
+
 CharTypeTable::CharTypeTable(bool use_def_delim) {
-    memset(char_type_table_, 0, BYTE_MAX);
-    // if use_def_delim is set, all the characters are allows
-    if (!use_def_delim)
-        return;
-    // set the lower 4 bit to record default char type
-    for (u8 i = 0; i < BYTE_MAX; i++) {
-        if (std::isalnum(i) || i > 127)
-            continue;
-        else if (std::isspace(i))
-            char_type_table_[i] = SPACE_CHR;
-        else
-            char_type_table_[i] = DELIMITER_CHR;
+    memset(char_type_table_, 0, sizeof(char_type_table_));
+    // if use_def_delim is not set, all the characters are allows
+    if (use_def_delim) {
+        // set the lower 4 bit to record default char type
+        for (u32 i = 0; i <= BYTE_MAX; i++) {
+            if (std::isalnum(i) || i > 127)
+                continue;
+            else if (std::isspace(i))
+                char_type_table_[i] = SPACE_CHR;
+            else
+                char_type_table_[i] = DELIMITER_CHR;
+        }
+    }
+    BuildAsciiTypeTables();
+}
+
+void CharTypeTable::BuildAsciiTypeTables() {
+    memset(ascii_type_lo_, 0, sizeof(ascii_type_lo_));
+    for (u32 c = 0; c < 128; ++c) {
+        ascii_type_lo_[char_type_table_[c]][c & 0xF] |= u8(1) << (c >> 4);
     }
 }
 
@@ -68,6 +85,55 @@ void CharTypeTable::SetConfig(const TokenizeConfig &conf) {
             char_type_table_[(u8)str[j]] = ALLOW_CHR;
         }
     }
+    BuildAsciiTypeTables();
+}
+
+SizeT CharTypeTable::AsciiPrefixLength(CharType type, const char *data, SizeT len) const {
+    // Most runs are short: check the first char before loading a register
+    if (len == 0 || (u8)data[0] > 127 || char_type_table_[(u8)data[0]] != type) {
+        return 0;
+    }
+    const u8 *type_lo = ascii_type_lo_[type];
+    SizeT pos = 1;
+#if defined(__AVX2__)
+    {
+        const __m256i lo_table = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i *)type_lo));
+        const __m256i hi_table = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i *)ASCII_HI_BITS));
+        const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+        for (; pos + 32 <= len; pos += 32) {
+            const __m256i chars = _mm256_loadu_si256((const __m256i *)(data + pos));
+            const __m256i lo_bits = _mm256_shuffle_epi8(lo_table, _mm256_and_si256(chars, nibble_mask));
+            const __m256i hi_bits = _mm256_shuffle_epi8(hi_table, _mm256_and_si256(_mm256_srli_epi16(chars, 4), nibble_mask));
+            const u32 other_mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(lo_bits, hi_bits), _mm256_setzero_si256()));
+            if (other_mask != 0) {
+                return pos + __builtin_ctz(other_mask);
+            }
+        }
+    }
+#endif
+#if defined(__SSSE3__)
+    {
+        const __m128i lo_table = _mm_load_si128((const __m128i *)type_lo);
+        const __m128i hi_table = _mm_load_si128((const __m128i *)ASCII_HI_BITS);
+        const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+        for (; pos + 16 <= len; pos += 16) {
+            const __m128i chars = _mm_loadu_si128((const __m128i *)(data + pos));
+            const __m128i lo_bits = _mm_shuffle_epi8(lo_table, _mm_and_si128(chars, nibble_mask));
+            const __m128i hi_bits = _mm_shuffle_epi8(hi_table, _mm_and_si128(_mm_srli_epi16(chars, 4), nibble_mask));
+            const u32 other_mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo_bits, hi_bits), _mm_setzero_si128()));
+            if (other_mask != 0) {
+                return pos + __builtin_ctz(other_mask);
+            }
+        }
+    }
+#endif
+    for (; pos < len; ++pos) {
+        const u8 c = data[pos];
+        if (c > 127 || char_type_table_[c] != type) {
+            break;
+        }
+    }
+    return pos;
 }
 
 void Tokenizer::SetConfig(const TokenizeConfig &conf) { table_.SetConfig(conf); }
@@ -78,19 +144,17 @@ void Tokenizer::Tokenize(const String &input) {
 }
 
 bool Tokenizer::NextToken() {
-    while (input_cursor_ < input_->length() && table_.GetType(input_->at(input_cursor_)) == SPACE_CHR) {
-        input_cursor_++;
-    }
-    if (input_cursor_ == input_->length())
+    // Runs of ASCII chars of the same type are classified a SIMD register at a time, the other chars one by one
+    const char *input_data = input_->data();
+    const SizeT input_length = input_->length();
+    input_cursor_ += table_.AsciiPrefixLength(SPACE_CHR, input_data + input_cursor_, input_length - input_cursor_);
+    if (input_cursor_ == input_length)
         return false;
 
     output_buffer_cursor_ = 0;
 
-    if (output_buffer_cursor_ >= output_buffer_size_) {
-        GrowOutputBuffer();
-    }
-    output_buffer_[output_buffer_cursor_++] = input_->at(input_cursor_);
-    if (table_.GetType(input_->at(input_cursor_)) == DELIMITER_CHR) {
+    AppendOutput(input_data + input_cursor_, 1);
+    if (table_.GetType(input_data[input_cursor_]) == DELIMITER_CHR) {
         ++input_cursor_;
         is_delimiter_ = true;
         return true;
@@ -98,15 +162,19 @@ bool Tokenizer::NextToken() {
         ++input_cursor_;
         is_delimiter_ = false;
 
-        while (input_cursor_ < input_->length()) {
-            CharType cur_type = table_.GetType(input_->at(input_cursor_));
+        while (input_cursor_ < input_length) {
+            SizeT allow_count = table_.AsciiPrefixLength(ALLOW_CHR, input_data + input_cursor_, input_length - input_cursor_);
+            if (allow_count > 0) {
+                AppendOutput(input_data + input_cursor_, allow_count);
+                input_cursor_ += allow_count;
+                continue;
+            }
+            CharType cur_type = table_.GetType(input_data[input_cursor_]);
             if (cur_type == SPACE_CHR || cur_type == DELIMITER_CHR) {
                 return true;
             } else if (cur_type == ALLOW_CHR) {
-                if (output_buffer_cursor_ >= output_buffer_size_) {
-                    GrowOutputBuffer();
-                }
-                output_buffer_[output_buffer_cursor_++] = input_->at(input_cursor_++);
+                AppendOutput(input_data + input_cursor_, 1);
+                ++input_cursor_;
             } else {
                 ++input_cursor_;
             }
@@ -115,9 +183,18 @@ bool Tokenizer::NextToken() {
     }
 }
 
+void Tokenizer::AppendOutput(const char *data, SizeT len) {
+    while (output_buffer_cursor_ + len > output_buffer_size_) {
+        GrowOutputBuffer();
+    }
+    memcpy(output_buffer_ + output_buffer_cursor_, data, len);
+    output_buffer_cursor_ += len;
+}
+
 bool Tokenizer::GrowOutputBuffer() {
     char *new_output_buffer = new char[output_buffer_size_ * 2];
     memcpy(new_output_buffer, output_buffer_, output_buffer_size_ * sizeof(char));
+    delete[] output_buffer_;
     output_buffer_ = new_output_buffer;
     output_buffer_size_ *= 2;
     return true;
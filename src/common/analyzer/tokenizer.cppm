@@ -40,13 +40,22 @@ export extern const CharType SPACE_CHR;     /// < space term
 export extern const CharType UNITE_CHR;     /// < united term
 
 export class CharTypeTable {
-    CharType char_type_table_[BYTE_MAX];
+    CharType char_type_table_[BYTE_MAX + 1];
+
+    /// Nibble lookup tables of the ASCII chars of each type: char c is of type t iff bit (c >> 4) of ascii_type_lo_[t][c & 0xF] is set.
+    /// They let the tokenizer classify a whole SIMD register of chars with two shuffles.
+    alignas(16) u8 ascii_type_lo_[4][16];
+
+    void BuildAsciiTypeTables();
 
 public:
     CharTypeTable(bool use_def_delim = true);
 
     void SetConfig(const TokenizeConfig &conf);
 
+    /// \brief number of leading chars of data which are ASCII chars of the given type
+    SizeT AsciiPrefixLength(CharType type, const char *data, SizeT len) const;
+
     CharType GetType(u8 c) { return char_type_table_[c]; }
 
     bool IsAllow(u8 c) { return char_type_table_[c] == ALLOW_CHR; }
@@ -89,6 +98,8 @@ public:
     bool Tokenize(const String &input_string, TermList &prim_terms);
 
 private:
+    void AppendOutput(const char *data, SizeT len);
+
     bool GrowOutputBuffer();
 
 private:
@@ -42,6 +42,7 @@ export {
     constexpr i64 MAX_BITMAP_SIZE = 65536;
     constexpr i64 EMBEDDING_LIMIT = 16384;
     constexpr auto PG_MSG_BUFFER_SIZE = 4096u;
+    constexpr int PG_MSG_READ_TIMEOUT_MS = 30 * 1000; // a client stalling in the middle of a message is disconnected
 
     // column vector related constants
     constexpr i64 MAX_BLOCK_CAPACITY = 65536L;
@@ -68,6 +69,7 @@ export {
     constexpr SizeT SEGMENT_OFFSET_IN_DOCID = 23;           // it should be adjusted together with DEFAULT_SEGMENT_CAPACITY
     constexpr u64 SEGMENT_MASK_IN_DOCID = 0x7FFFFF;         // it should be adjusted together with DEFAULT_SEGMENT_CAPACITY
     constexpr u32 INVALID_SEGMENT_ID = std::numeric_limits<u32>::max();
+    constexpr u32 INVALID_SEGMENT_OFFSET = std::numeric_limits<u32>::max();
 
     // queue related constants, TODO: double check the necessary
     constexpr SizeT BG_GROUND_TASK_QUEUE_SIZE = 65536;
@@ -92,6 +94,10 @@ export {
     constexpr SizeT DEFAULT_CHUNK_SIZE = 10 * 1024 * 1024;
     constexpr SizeT DEFAULT_ALIGN_SIZE = sizeof(char *);
 
+    // parallel import
+    constexpr SizeT DEFAULT_IMPORT_RANGE_MIN_SIZE = 64 * 1024 * 1024; // files are split into byte ranges of at least 64MB
+    constexpr SizeT DEFAULT_IMPORT_READ_BUFFER_SIZE = 1024 * 1024;
+
     constexpr SizeT MIN_CLEANUP_INTERVAL_SEC = 0; // 0 means disable the function
     constexpr SizeT DEFAULT_CLEANUP_INTERVAL_SEC = 10;
     constexpr std::string_view DEFAULT_CLEANUP_INTERVAL_SEC_STR = "10s"; // 10 seconds
@@ -115,6 +121,7 @@ export {
     constexpr i64 DEFAULT_WAL_FILE_SIZE_THRESHOLD = 1 * 1024l * 1024l * 1024l;           // 1GB
     constexpr std::string_view DEFAULT_WAL_FILE_SIZE_THRESHOLD_STR = "1GB";           // 1GB
     constexpr i64 MAX_WAL_FILE_SIZE_THRESHOLD = 1024l * DEFAULT_WAL_FILE_SIZE_THRESHOLD; // 1TB
+    constexpr i64 INSERT_MAX_WAL_SIZE = 1024l * 1024l * 1024l;                          // 1GB, keeps the wal entry of an INSERT within i32
 
     constexpr i64 MIN_FULL_CHECKPOINT_INTERVAL_SEC = 0; // 0 means disable full checkpoint
     constexpr i64 DEFAULT_FULL_CHECKPOINT_INTERVAL_SEC = 30; // 30 seconds
@@ -178,13 +185,20 @@ export {
     constexpr SizeT DEFAULT_BUFFER_MANAGER_LRU_COUNT = 7;
     constexpr std::string_view DEFAULT_BUFFER_MANAGER_SIZE_STR = "8GB"; // 8Gib
 
+    constexpr SizeT DEFAULT_SCRUB_IO_RATE_LIMIT = 64 * 1024lu * 1024lu; // 64MB per second
+    constexpr std::string_view DEFAULT_SCRUB_IO_RATE_LIMIT_STR = "64MB";
+
+    constexpr i64 DEFAULT_INDEX_BUILD_CPU_SHARE = 50; // percent of cpu_limit
+
     constexpr SizeT DEFAULT_MEMINDEX_MEMORY_QUOTA = 4 * 1024lu * 1024lu * 1024lu; // 4GB
     constexpr std::string_view DEFAULT_MEMINDEX_MEMORY_QUOTA_STR = "4GB"; // 4GB
 
+    constexpr SizeT DEFAULT_SPARSE_BLOCK_MAX_IVT_MEMORY_LIMIT = 256 * 1024lu * 1024lu; // 256MB, in-memory indexes of sparse blocks
+    constexpr SizeT DEFAULT_TENSOR_CENTROID_CODES_MEMORY_LIMIT = 1024lu * 1024lu * 1024lu; // 1GB, centroid codes of tensor segments
+
     constexpr SizeT DEFAULT_LOG_FILE_SIZE = 64 * 1024lu * 1024lu; // 64MB
     constexpr std::string_view DEFAULT_LOG_FILE_SIZE_STR = "64MB"; // 64MB
 
-    constexpr SizeT INSERT_BATCH_ROW_LIMIT = 8192;
 
     // default persistence parameter
     constexpr std::string_view DEFAULT_PERSISTENCE_DIR = "/var/infinity/persistence"; // Empty means disabled
@@ -219,6 +233,10 @@ export {
     constexpr std::string_view COMPACT_INTERVAL_OPTION_NAME = "compact_interval";
     constexpr std::string_view OPTIMIZE_INTERVAL_OPTION_NAME = "optimize_interval";
     constexpr std::string_view MEM_INDEX_CAPACITY_OPTION_NAME = "mem_index_capacity";
+    constexpr std::string_view INDEX_MMAP_LOAD_OPTION_NAME = "index_mmap_load";
+    constexpr std::string_view VERIFY_FILE_CHECKSUM_OPTION_NAME = "verify_file_checksum";
+    constexpr std::string_view SCRUB_IO_RATE_LIMIT_OPTION_NAME = "scrub_io_rate_limit";
+    constexpr std::string_view INDEX_BUILD_CPU_SHARE_OPTION_NAME = "index_build_cpu_share";
 
     constexpr std::string_view PERSISTENCE_DIR_OPTION_NAME = "persistence_dir";
     constexpr std::string_view PERSISTENCE_OBJECT_SIZE_LIMIT_OPTION_NAME = "persistence_object_size_limit";
@@ -160,6 +160,7 @@ public:
     static bool isAVX2() { return is(SimdTypeAVX2); }
     static bool isAVX512() { return is(SimdTypeAVX512F); }
     static bool isAVX512BW() { return is(SimdTypeAVX512BW); }
+    static bool isAVX512VNNI() { return is(SimdTypeAVX512VNNI); }
     static std::vector<char const *> getSupportedSimdTypes() {
         static constexpr char const *simdTypes[] = {"f16c",
                                                     "sse2",
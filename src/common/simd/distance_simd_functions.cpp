@@ -15,6 +15,7 @@
 module;
 
 #include <cmath>
+#include <cstring>
 #include "simd_common_intrin_include.h"
 
 /*
@@ -250,4 +251,341 @@ f32 CosineDistance_avx2(const f32 *vector1, const f32 *vector2, SizeT dimension)
 }
 #endif
 
+// ---------------------------------- f32 query, float16 / bfloat16 data ----------------------------------
+
+namespace {
+
+inline f32 F16ToF32(u16 h) {
+#if defined(__F16C__)
+    return _cvtsh_ss(h);
+#elif defined(__aarch64__)
+    __fp16 v;
+    std::memcpy(&v, &h, sizeof(v));
+    return v;
+#else
+    const u32 sign = u32(h & 0x8000) << 16;
+    const u32 exp = (h >> 10) & 0x1F;
+    u32 mant = h & 0x3FF;
+    u32 bits = sign;
+    if (exp == 0x1F) {
+        bits |= 0x7F800000 | (mant << 13);
+    } else if (exp != 0) {
+        bits |= ((exp + 112) << 23) | (mant << 13);
+    } else if (mant != 0) {
+        // subnormal, normalized in f32
+        u32 f32_exp = 113;
+        while ((mant & 0x400) == 0) {
+            mant <<= 1;
+            --f32_exp;
+        }
+        bits |= (f32_exp << 23) | ((mant & 0x3FF) << 13);
+    }
+    f32 f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+#endif
+}
+
+// A bfloat16 is the high half of a f32
+inline f32 BF16ToF32(u16 h) {
+    const u32 bits = u32(h) << 16;
+    f32 f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+template <f32 (*Widen)(u16)>
+f32 HalfL2Distance_common(const f32 *x, const u16 *y, SizeT d) {
+    f32 res = 0.0f;
+    for (SizeT i = 0; i < d; ++i) {
+        const f32 tmp = x[i] - Widen(y[i]);
+        res += tmp * tmp;
+    }
+    return res;
+}
+
+template <f32 (*Widen)(u16)>
+f32 HalfIPDistance_common(const f32 *x, const u16 *y, SizeT d) {
+    f32 res = 0.0f;
+    for (SizeT i = 0; i < d; ++i) {
+        res += x[i] * Widen(y[i]);
+    }
+    return res;
+}
+
+template <f32 (*Widen)(u16)>
+f32 HalfCosineDistance_common(const f32 *x, const u16 *y, SizeT d) {
+    f32 dot = 0.0f;
+    f32 sqr_x = 0.0f;
+    f32 sqr_y = 0.0f;
+    for (SizeT i = 0; i < d; ++i) {
+        const f32 y_i = Widen(y[i]);
+        dot += x[i] * y_i;
+        sqr_x += x[i] * x[i];
+        sqr_y += y_i * y_i;
+    }
+    return dot ? dot / sqrt(sqr_x * sqr_y) : 0.0f;
+}
+
+#if defined(__SSE2__)
+// 4 bfloat16 to f32 by interleaving them with zero low halves
+inline __m128 LoadBF16x4_sse2(const u16 *p) {
+    return _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), _mm_loadl_epi64(reinterpret_cast<const __m128i *>(p))));
+}
+#endif
+
+#if defined(__AVX2__)
+inline __m256 LoadBF16x8_avx2(const u16 *p) {
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))), 16));
+}
+#endif
+
+#if defined(__AVX2__) && defined(__F16C__)
+inline __m256 LoadF16x8_avx2(const u16 *p) { return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))); }
+#endif
+
+#if defined(__AVX512F__)
+inline __m512 LoadBF16x16_avx512(const u16 *p) {
+    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p))), 16));
+}
+
+inline __m512 LoadF16x16_avx512(const u16 *p) { return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p))); }
+#endif
+
+#if defined(__AVX2__)
+template <__m256 (*Load)(const u16 *), f32 (*Widen)(u16)>
+f32 HalfL2Distance_avx2(const f32 *x, const u16 *y, SizeT d) {
+    __m256 sum_1 = _mm256_setzero_ps();
+    __m256 sum_2 = _mm256_setzero_ps();
+    SizeT i = 0;
+    for (; i + 16 <= d; i += 16) {
+        const __m256 diff_1 = _mm256_sub_ps(_mm256_loadu_ps(x + i), Load(y + i));
+        const __m256 diff_2 = _mm256_sub_ps(_mm256_loadu_ps(x + i + 8), Load(y + i + 8));
+        sum_1 = _mm256_fmadd_ps(diff_1, diff_1, sum_1);
+        sum_2 = _mm256_fmadd_ps(diff_2, diff_2, sum_2);
+    }
+    f32 distance = hsum256_ps_avx(_mm256_add_ps(sum_1, sum_2));
+    if (i < d) [[unlikely]] {
+        distance += HalfL2Distance_common<Widen>(x + i, y + i, d - i);
+    }
+    return distance;
+}
+
+template <__m256 (*Load)(const u16 *), f32 (*Widen)(u16)>
+f32 HalfIPDistance_avx2(const f32 *x, const u16 *y, SizeT d) {
+    __m256 sum_1 = _mm256_setzero_ps();
+    __m256 sum_2 = _mm256_setzero_ps();
+    SizeT i = 0;
+    for (; i + 16 <= d; i += 16) {
+        sum_1 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i), Load(y + i), sum_1);
+        sum_2 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i + 8), Load(y + i + 8), sum_2);
+    }
+    f32 distance = hsum256_ps_avx(_mm256_add_ps(sum_1, sum_2));
+    if (i < d) [[unlikely]] {
+        distance += HalfIPDistance_common<Widen>(x + i, y + i, d - i);
+    }
+    return distance;
+}
+
+template <__m256 (*Load)(const u16 *), f32 (*Widen)(u16)>
+f32 HalfCosineDistance_avx2(const f32 *x, const u16 *y, SizeT d) {
+    __m256 dot_sum = _mm256_setzero_ps();
+    __m256 norm_x_sum = _mm256_setzero_ps();
+    __m256 norm_y_sum = _mm256_setzero_ps();
+    SizeT i = 0;
+    for (; i + 8 <= d; i += 8) {
+        const __m256 x_i = _mm256_loadu_ps(x + i);
+        const __m256 y_i = Load(y + i);
+        dot_sum = _mm256_fmadd_ps(x_i, y_i, dot_sum);
+        norm_x_sum = _mm256_fmadd_ps(x_i, x_i, norm_x_sum);
+        norm_y_sum = _mm256_fmadd_ps(y_i, y_i, norm_y_sum);
+    }
+    f32 dot = hsum256_ps_avx(dot_sum);
+    f32 norm_x = hsum256_ps_avx(norm_x_sum);
+    f32 norm_y = hsum256_ps_avx(norm_y_sum);
+    for (; i < d; ++i) {
+        const f32 y_i = Widen(y[i]);
+        dot += x[i] * y_i;
+        norm_x += x[i] * x[i];
+        norm_y += y_i * y_i;
+    }
+    return dot ? dot / sqrt(norm_x * norm_y) : 0.0f;
+}
+#endif
+
+#if defined(__AVX512F__)
+template <__m512 (*Load)(const u16 *), f32 (*Widen)(u16)>
+f32 HalfL2Distance_avx512(const f32 *x, const u16 *y, SizeT d) {
+    __m512 sum_1 = _mm512_setzero_ps();
+    __m512 sum_2 = _mm512_setzero_ps();
+    SizeT i = 0;
+    for (; i + 32 <= d; i += 32) {
+        const __m512 diff_1 = _mm512_sub_ps(_mm512_loadu_ps(x + i), Load(y + i));
+        const __m512 diff_2 = _mm512_sub_ps(_mm512_loadu_ps(x + i + 16), Load(y + i + 16));
+        sum_1 = _mm512_fmadd_ps(diff_1, diff_1, sum_1);
+        sum_2 = _mm512_fmadd_ps(diff_2, diff_2, sum_2);
+    }
+    for (; i + 16 <= d; i += 16) {
+        const __m512 diff = _mm512_sub_ps(_mm512_loadu_ps(x + i), Load(y + i));
+        sum_1 = _mm512_fmadd_ps(diff, diff, sum_1);
+    }
+    f32 distance = _mm512_reduce_add_ps(_mm512_add_ps(sum_1, sum_2));
+    if (i < d) [[unlikely]] {
+        distance += HalfL2Distance_common<Widen>(x + i, y + i, d - i);
+    }
+    return distance;
+}
+
+template <__m512 (*Load)(const u16 *), f32 (*Widen)(u16)>
+f32 HalfIPDistance_avx512(const f32 *x, const u16 *y, SizeT d) {
+    __m512 sum_1 = _mm512_setzero_ps();
+    __m512 sum_2 = _mm512_setzero_ps();
+    SizeT i = 0;
+    for (; i + 32 <= d; i += 32) {
+        sum_1 = _mm512_fmadd_ps(_mm512_loadu_ps(x + i), Load(y + i), sum_1);
+        sum_2 = _mm512_fmadd_ps(_mm512_loadu_ps(x + i + 16), Load(y + i + 16), sum_2);
+    }
+    for (; i + 16 <= d; i += 16) {
+        sum_1 = _mm512_fmadd_ps(_mm512_loadu_ps(x + i), Load(y + i), sum_1);
+    }
+    f32 distance = _mm512_reduce_add_ps(_mm512_add_ps(sum_1, sum_2));
+    if (i < d) [[unlikely]] {
+        distance += HalfIPDistance_common<Widen>(x + i, y + i, d - i);
+    }
+    return distance;
+}
+
+template <__m512 (*Load)(const u16 *), f32 (*Widen)(u16)>
+f32 HalfCosineDistance_avx512(const f32 *x, const u16 *y, SizeT d) {
+    __m512 dot_sum = _mm512_setzero_ps();
+    __m512 norm_x_sum = _mm512_setzero_ps();
+    __m512 norm_y_sum = _mm512_setzero_ps();
+    SizeT i = 0;
+    for (; i + 16 <= d; i += 16) {
+        const __m512 x_i = _mm512_loadu_ps(x + i);
+        const __m512 y_i = Load(y + i);
+        dot_sum = _mm512_fmadd_ps(x_i, y_i, dot_sum);
+        norm_x_sum = _mm512_fmadd_ps(x_i, x_i, norm_x_sum);
+        norm_y_sum = _mm512_fmadd_ps(y_i, y_i, norm_y_sum);
+    }
+    f32 dot = _mm512_reduce_add_ps(dot_sum);
+    f32 norm_x = _mm512_reduce_add_ps(norm_x_sum);
+    f32 norm_y = _mm512_reduce_add_ps(norm_y_sum);
+    for (; i < d; ++i) {
+        const f32 y_i = Widen(y[i]);
+        dot += x[i] * y_i;
+        norm_x += x[i] * x[i];
+        norm_y += y_i * y_i;
+    }
+    return dot ? dot / sqrt(norm_x * norm_y) : 0.0f;
+}
+#endif
+
+} // namespace
+
+f32 F32F16L2Distance_common(const f32 *x, const u16 *y, SizeT d) { return HalfL2Distance_common<F16ToF32>(x, y, d); }
+
+f32 F32F16IPDistance_common(const f32 *x, const u16 *y, SizeT d) { return HalfIPDistance_common<F16ToF32>(x, y, d); }
+
+f32 F32F16CosineDistance_common(const f32 *x, const u16 *y, SizeT d) { return HalfCosineDistance_common<F16ToF32>(x, y, d); }
+
+f32 F32BF16L2Distance_common(const f32 *x, const u16 *y, SizeT d) { return HalfL2Distance_common<BF16ToF32>(x, y, d); }
+
+f32 F32BF16IPDistance_common(const f32 *x, const u16 *y, SizeT d) { return HalfIPDistance_common<BF16ToF32>(x, y, d); }
+
+f32 F32BF16CosineDistance_common(const f32 *x, const u16 *y, SizeT d) { return HalfCosineDistance_common<BF16ToF32>(x, y, d); }
+
+#if defined(__SSE2__)
+// Also the path on aarch64, where the SSE2 intrinsics are mapped to NEON
+f32 F32BF16L2Distance_sse2(const f32 *x, const u16 *y, SizeT d) {
+    __m128 sum_1 = _mm_setzero_ps();
+    __m128 sum_2 = _mm_setzero_ps();
+    SizeT i = 0;
+    for (; i + 8 <= d; i += 8) {
+        const __m128 diff_1 = _mm_sub_ps(_mm_loadu_ps(x + i), LoadBF16x4_sse2(y + i));
+        const __m128 diff_2 = _mm_sub_ps(_mm_loadu_ps(x + i + 4), LoadBF16x4_sse2(y + i + 4));
+        sum_1 = _mm_add_ps(sum_1, _mm_mul_ps(diff_1, diff_1));
+        sum_2 = _mm_add_ps(sum_2, _mm_mul_ps(diff_2, diff_2));
+    }
+    f32 distance = hsum_ps_sse1(_mm_add_ps(sum_1, sum_2));
+    if (i < d) [[unlikely]] {
+        distance += F32BF16L2Distance_common(x + i, y + i, d - i);
+    }
+    return distance;
+}
+
+f32 F32BF16IPDistance_sse2(const f32 *x, const u16 *y, SizeT d) {
+    __m128 sum_1 = _mm_setzero_ps();
+    __m128 sum_2 = _mm_setzero_ps();
+    SizeT i = 0;
+    for (; i + 8 <= d; i += 8) {
+        sum_1 = _mm_add_ps(sum_1, _mm_mul_ps(_mm_loadu_ps(x + i), LoadBF16x4_sse2(y + i)));
+        sum_2 = _mm_add_ps(sum_2, _mm_mul_ps(_mm_loadu_ps(x + i + 4), LoadBF16x4_sse2(y + i + 4)));
+    }
+    f32 distance = hsum_ps_sse1(_mm_add_ps(sum_1, sum_2));
+    if (i < d) [[unlikely]] {
+        distance += F32BF16IPDistance_common(x + i, y + i, d - i);
+    }
+    return distance;
+}
+
+f32 F32BF16CosineDistance_sse2(const f32 *x, const u16 *y, SizeT d) {
+    __m128 dot_sum = _mm_setzero_ps();
+    __m128 norm_x_sum = _mm_setzero_ps();
+    __m128 norm_y_sum = _mm_setzero_ps();
+    SizeT i = 0;
+    for (; i + 4 <= d; i += 4) {
+        const __m128 x_i = _mm_loadu_ps(x + i);
+        const __m128 y_i = LoadBF16x4_sse2(y + i);
+        dot_sum = _mm_add_ps(dot_sum, _mm_mul_ps(x_i, y_i));
+        norm_x_sum = _mm_add_ps(norm_x_sum, _mm_mul_ps(x_i, x_i));
+        norm_y_sum = _mm_add_ps(norm_y_sum, _mm_mul_ps(y_i, y_i));
+    }
+    f32 dot = hsum_ps_sse1(dot_sum);
+    f32 norm_x = hsum_ps_sse1(norm_x_sum);
+    f32 norm_y = hsum_ps_sse1(norm_y_sum);
+    for (; i < d; ++i) {
+        const f32 y_i = BF16ToF32(y[i]);
+        dot += x[i] * y_i;
+        norm_x += x[i] * x[i];
+        norm_y += y_i * y_i;
+    }
+    return dot ? dot / sqrt(norm_x * norm_y) : 0.0f;
+}
+#endif
+
+#if defined(__AVX2__)
+f32 F32BF16L2Distance_avx2(const f32 *x, const u16 *y, SizeT d) { return HalfL2Distance_avx2<LoadBF16x8_avx2, BF16ToF32>(x, y, d); }
+
+f32 F32BF16IPDistance_avx2(const f32 *x, const u16 *y, SizeT d) { return HalfIPDistance_avx2<LoadBF16x8_avx2, BF16ToF32>(x, y, d); }
+
+f32 F32BF16CosineDistance_avx2(const f32 *x, const u16 *y, SizeT d) { return HalfCosineDistance_avx2<LoadBF16x8_avx2, BF16ToF32>(x, y, d); }
+#endif
+
+#if defined(__AVX2__) && defined(__F16C__)
+f32 F32F16L2Distance_avx2(const f32 *x, const u16 *y, SizeT d) { return HalfL2Distance_avx2<LoadF16x8_avx2, F16ToF32>(x, y, d); }
+
+f32 F32F16IPDistance_avx2(const f32 *x, const u16 *y, SizeT d) { return HalfIPDistance_avx2<LoadF16x8_avx2, F16ToF32>(x, y, d); }
+
+f32 F32F16CosineDistance_avx2(const f32 *x, const u16 *y, SizeT d) { return HalfCosineDistance_avx2<LoadF16x8_avx2, F16ToF32>(x, y, d); }
+#endif
+
+#if defined(__AVX512F__)
+f32 F32F16L2Distance_avx512(const f32 *x, const u16 *y, SizeT d) { return HalfL2Distance_avx512<LoadF16x16_avx512, F16ToF32>(x, y, d); }
+
+f32 F32F16IPDistance_avx512(const f32 *x, const u16 *y, SizeT d) { return HalfIPDistance_avx512<LoadF16x16_avx512, F16ToF32>(x, y, d); }
+
+f32 F32F16CosineDistance_avx512(const f32 *x, const u16 *y, SizeT d) {
+    return HalfCosineDistance_avx512<LoadF16x16_avx512, F16ToF32>(x, y, d);
+}
+
+f32 F32BF16L2Distance_avx512(const f32 *x, const u16 *y, SizeT d) { return HalfL2Distance_avx512<LoadBF16x16_avx512, BF16ToF32>(x, y, d); }
+
+f32 F32BF16IPDistance_avx512(const f32 *x, const u16 *y, SizeT d) { return HalfIPDistance_avx512<LoadBF16x16_avx512, BF16ToF32>(x, y, d); }
+
+f32 F32BF16CosineDistance_avx512(const f32 *x, const u16 *y, SizeT d) {
+    return HalfCosineDistance_avx512<LoadBF16x16_avx512, BF16ToF32>(x, y, d);
+}
+#endif
+
 } // namespace infinity
@@ -34,4 +34,55 @@ export f32 IPDistance_avx2(const f32 *vector1, const f32 *vector2, SizeT dimensi
 export f32 CosineDistance_avx2(const f32 *vector1, const f32 *vector2, SizeT dimension);
 #endif
 
+// f32 query against float16 or bfloat16 rows, given as raw bits. The rows are widened in registers.
+export f32 F32F16L2Distance_common(const f32 *x, const u16 *y, SizeT d);
+
+export f32 F32F16IPDistance_common(const f32 *x, const u16 *y, SizeT d);
+
+export f32 F32F16CosineDistance_common(const f32 *x, const u16 *y, SizeT d);
+
+export f32 F32BF16L2Distance_common(const f32 *x, const u16 *y, SizeT d);
+
+export f32 F32BF16IPDistance_common(const f32 *x, const u16 *y, SizeT d);
+
+export f32 F32BF16CosineDistance_common(const f32 *x, const u16 *y, SizeT d);
+
+#if defined(__SSE2__)
+export f32 F32BF16L2Distance_sse2(const f32 *x, const u16 *y, SizeT d);
+
+export f32 F32BF16IPDistance_sse2(const f32 *x, const u16 *y, SizeT d);
+
+export f32 F32BF16CosineDistance_sse2(const f32 *x, const u16 *y, SizeT d);
+#endif
+
+#if defined(__AVX2__)
+export f32 F32BF16L2Distance_avx2(const f32 *x, const u16 *y, SizeT d);
+
+export f32 F32BF16IPDistance_avx2(const f32 *x, const u16 *y, SizeT d);
+
+export f32 F32BF16CosineDistance_avx2(const f32 *x, const u16 *y, SizeT d);
+#endif
+
+#if defined(__AVX2__) && defined(__F16C__)
+export f32 F32F16L2Distance_avx2(const f32 *x, const u16 *y, SizeT d);
+
+export f32 F32F16IPDistance_avx2(const f32 *x, const u16 *y, SizeT d);
+
+export f32 F32F16CosineDistance_avx2(const f32 *x, const u16 *y, SizeT d);
+#endif
+
+#if defined(__AVX512F__)
+export f32 F32F16L2Distance_avx512(const f32 *x, const u16 *y, SizeT d);
+
+export f32 F32F16IPDistance_avx512(const f32 *x, const u16 *y, SizeT d);
+
+export f32 F32F16CosineDistance_avx512(const f32 *x, const u16 *y, SizeT d);
+
+export f32 F32BF16L2Distance_avx512(const f32 *x, const u16 *y, SizeT d);
+
+export f32 F32BF16IPDistance_avx512(const f32 *x, const u16 *y, SizeT d);
+
+export f32 F32BF16CosineDistance_avx512(const f32 *x, const u16 *y, SizeT d);
+#endif
+
 } // namespace infinity
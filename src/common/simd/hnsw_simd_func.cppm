@@ -271,6 +271,35 @@ export int32_t I8IPAVX512Residual(const int8_t *pv1, const int8_t *pv2, SizeT di
 }
 #endif
 
+#if defined(__AVX512VNNI__)
+
+// vpdpbusd multiplies unsigned bytes by signed bytes, so pv1 is biased by 128 and 128 * sum(pv2) is taken back
+export int32_t I8IPAVX512VNNI(const int8_t *pv1, const int8_t *pv2, SizeT dim) {
+    SizeT dim64 = dim >> 6;
+    const int8_t *pend1 = pv1 + (dim64 << 6);
+
+    const __m512i bias = _mm512_set1_epi8(0x80);
+    const __m512i ones = _mm512_set1_epi8(1);
+    __m512i sum = _mm512_setzero_si512();
+    __m512i sum_v2 = _mm512_setzero_si512();
+    while (pv1 < pend1) {
+        __m512i v1 = _mm512_xor_si512(_mm512_loadu_si512((__m512i_u *)pv1), bias);
+        pv1 += 64;
+        __m512i v2 = _mm512_loadu_si512((__m512i_u *)pv2);
+        pv2 += 64;
+
+        sum = _mm512_dpbusd_epi32(sum, v1, v2);
+        sum_v2 = _mm512_dpbusd_epi32(sum_v2, ones, v2);
+    }
+
+    return _mm512_reduce_add_epi32(sum) - 128 * _mm512_reduce_add_epi32(sum_v2);
+}
+
+export int32_t I8IPAVX512VNNIResidual(const int8_t *pv1, const int8_t *pv2, SizeT dim) {
+    return I8IPAVX512VNNI(pv1, pv2, dim) + I8IPBF(pv1 + (dim & ~63), pv2 + (dim & ~63), dim & 63);
+}
+#endif
+
 #if defined(__AVX2__)
 
 export int32_t I8IPAVX(const int8_t *pv1, const int8_t *pv2, SizeT dim) {
@@ -26,6 +26,14 @@ export struct SIMD_FUNCTIONS {
     F32DistanceFuncType IPDistance_func_ptr_ = GetIPDistanceFuncPtr();
     F32DistanceFuncType CosineDistance_func_ptr_ = GetCosineDistanceFuncPtr();
 
+    // F32 query, F16 / BF16 data distance functions
+    F32HalfDistanceFuncType F32F16L2Distance_func_ptr_ = GetF32F16L2DistanceFuncPtr();
+    F32HalfDistanceFuncType F32F16IPDistance_func_ptr_ = GetF32F16IPDistanceFuncPtr();
+    F32HalfDistanceFuncType F32F16CosineDistance_func_ptr_ = GetF32F16CosineDistanceFuncPtr();
+    F32HalfDistanceFuncType F32BF16L2Distance_func_ptr_ = GetF32BF16L2DistanceFuncPtr();
+    F32HalfDistanceFuncType F32BF16IPDistance_func_ptr_ = GetF32BF16IPDistanceFuncPtr();
+    F32HalfDistanceFuncType F32BF16CosineDistance_func_ptr_ = GetF32BF16CosineDistanceFuncPtr();
+
     // HNSW F32
     F32DistanceFuncType HNSW_F32L2_ptr_ = Get_HNSW_F32L2_ptr();
     F32DistanceFuncType HNSW_F32L2_16_ptr_ = Get_HNSW_F32L2_16_ptr();
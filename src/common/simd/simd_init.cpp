@@ -66,6 +66,105 @@ F32DistanceFuncType GetCosineDistanceFuncPtr() {
     return &CosineDistance_common;
 }
 
+F32HalfDistanceFuncType GetF32F16L2DistanceFuncPtr() {
+#if defined(__AVX512F__)
+    if (IsAVX512Supported()) {
+        return &F32F16L2Distance_avx512;
+    }
+#endif
+#if defined(__AVX2__) && defined(__F16C__)
+    if (IsAVX2Supported() && IsF16CSupported()) {
+        return &F32F16L2Distance_avx2;
+    }
+#endif
+    return &F32F16L2Distance_common;
+}
+
+F32HalfDistanceFuncType GetF32F16IPDistanceFuncPtr() {
+#if defined(__AVX512F__)
+    if (IsAVX512Supported()) {
+        return &F32F16IPDistance_avx512;
+    }
+#endif
+#if defined(__AVX2__) && defined(__F16C__)
+    if (IsAVX2Supported() && IsF16CSupported()) {
+        return &F32F16IPDistance_avx2;
+    }
+#endif
+    return &F32F16IPDistance_common;
+}
+
+F32HalfDistanceFuncType GetF32F16CosineDistanceFuncPtr() {
+#if defined(__AVX512F__)
+    if (IsAVX512Supported()) {
+        return &F32F16CosineDistance_avx512;
+    }
+#endif
+#if defined(__AVX2__) && defined(__F16C__)
+    if (IsAVX2Supported() && IsF16CSupported()) {
+        return &F32F16CosineDistance_avx2;
+    }
+#endif
+    return &F32F16CosineDistance_common;
+}
+
+F32HalfDistanceFuncType GetF32BF16L2DistanceFuncPtr() {
+#if defined(__AVX512F__)
+    if (IsAVX512Supported()) {
+        return &F32BF16L2Distance_avx512;
+    }
+#endif
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        return &F32BF16L2Distance_avx2;
+    }
+#endif
+#if defined(__SSE2__)
+    if (IsSSE2Supported()) {
+        return &F32BF16L2Distance_sse2;
+    }
+#endif
+    return &F32BF16L2Distance_common;
+}
+
+F32HalfDistanceFuncType GetF32BF16IPDistanceFuncPtr() {
+#if defined(__AVX512F__)
+    if (IsAVX512Supported()) {
+        return &F32BF16IPDistance_avx512;
+    }
+#endif
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        return &F32BF16IPDistance_avx2;
+    }
+#endif
+#if defined(__SSE2__)
+    if (IsSSE2Supported()) {
+        return &F32BF16IPDistance_sse2;
+    }
+#endif
+    return &F32BF16IPDistance_common;
+}
+
+F32HalfDistanceFuncType GetF32BF16CosineDistanceFuncPtr() {
+#if defined(__AVX512F__)
+    if (IsAVX512Supported()) {
+        return &F32BF16CosineDistance_avx512;
+    }
+#endif
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        return &F32BF16CosineDistance_avx2;
+    }
+#endif
+#if defined(__SSE2__)
+    if (IsSSE2Supported()) {
+        return &F32BF16CosineDistance_sse2;
+    }
+#endif
+    return &F32BF16CosineDistance_common;
+}
+
 F32DistanceFuncType Get_HNSW_F32L2_16_ptr() {
 #if defined(__AVX512F__)
     if (IsAVX512Supported()) {
@@ -181,6 +280,11 @@ F32DistanceFuncType Get_HNSW_F32Cos_ptr() {
 }
 
 I8DistanceFuncType Get_HNSW_I8IP_64_ptr() {
+#if defined(__AVX512VNNI__)
+    if (IsAVX512VNNISupported()) {
+        return &I8IPAVX512VNNI;
+    }
+#endif
 #if defined(__AVX512F__)
     if (IsAVX512Supported()) {
         return &I8IPAVX512;
@@ -200,6 +304,11 @@ I8DistanceFuncType Get_HNSW_I8IP_64_ptr() {
 }
 
 I8DistanceFuncType Get_HNSW_I8IP_32_ptr() {
+#if defined(__AVX512VNNI__)
+    if (IsAVX512VNNISupported()) {
+        return &I8IPAVX512VNNIResidual;
+    }
+#endif
 #if defined(__AVX512F__)
     if (IsAVX512Supported()) {
         return &I8IPAVX512Residual;
@@ -219,6 +328,11 @@ I8DistanceFuncType Get_HNSW_I8IP_32_ptr() {
 }
 
 I8DistanceFuncType Get_HNSW_I8IP_16_ptr() {
+#if defined(__AVX512VNNI__)
+    if (IsAVX512VNNISupported()) {
+        return &I8IPAVX512VNNIResidual;
+    }
+#endif
 #if defined(__AVX512F__)
     if (IsAVX512Supported()) {
         return &I8IPAVX512Residual;
@@ -238,6 +352,11 @@ I8DistanceFuncType Get_HNSW_I8IP_16_ptr() {
 }
 
 I8DistanceFuncType Get_HNSW_I8IP_ptr() {
+#if defined(__AVX512VNNI__)
+    if (IsAVX512VNNISupported()) {
+        return &I8IPAVX512VNNIResidual;
+    }
+#endif
 #if defined(__AVX512F__)
     if (IsAVX512Supported()) {
         return &I8IPAVX512Residual;
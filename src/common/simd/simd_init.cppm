@@ -26,8 +26,11 @@ export using infinity::IsSSE2Supported;
 export using infinity::IsAVX2Supported;
 export using infinity::IsAVX512Supported;
 export using infinity::IsAVX512BWSupported;
+export using infinity::IsAVX512VNNISupported;
 
 export using F32DistanceFuncType = f32(*)(const f32 *, const f32 *, SizeT);
+// f32 query against rows of float16 or bfloat16, passed as their raw bits
+export using F32HalfDistanceFuncType = f32(*)(const f32 *, const u16 *, SizeT);
 export using I8DistanceFuncType = i32(*)(const i8 *, const i8 *, SizeT);
 export using I8CosDistanceFuncType = f32(*)(const i8 *, const i8 *, SizeT);
 export using U8DistanceFuncType = i32(*)(const u8 *, const u8 *, SizeT);
@@ -42,6 +45,13 @@ export using SearchTop1WithDisF32U32FuncType = void(*)(u32, u32, const f32 *, u3
 export F32DistanceFuncType GetL2DistanceFuncPtr();
 export F32DistanceFuncType GetIPDistanceFuncPtr();
 export F32DistanceFuncType GetCosineDistanceFuncPtr();
+// F32 query, F16 / BF16 data distance functions
+export F32HalfDistanceFuncType GetF32F16L2DistanceFuncPtr();
+export F32HalfDistanceFuncType GetF32F16IPDistanceFuncPtr();
+export F32HalfDistanceFuncType GetF32F16CosineDistanceFuncPtr();
+export F32HalfDistanceFuncType GetF32BF16L2DistanceFuncPtr();
+export F32HalfDistanceFuncType GetF32BF16IPDistanceFuncPtr();
+export F32HalfDistanceFuncType GetF32BF16CosineDistanceFuncPtr();
 // HNSW F32
 export F32DistanceFuncType Get_HNSW_F32L2_ptr();
 export F32DistanceFuncType Get_HNSW_F32L2_16_ptr();
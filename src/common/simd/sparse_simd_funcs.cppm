@@ -0,0 +1,164 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include "simd_common_intrin_include.h"
+#include <algorithm>
+#include <bit>
+
+export module sparse_simd_funcs;
+
+import stl;
+
+namespace infinity {
+
+// The indices of a sparse vector are sorted and unique. The functions below call `fn(i, j)` for every idx1[i] == idx2[j],
+// in increasing order of the index, so that the sums of the callers don't depend on the kernel.
+
+// A side this many times longer than the other is searched by galloping instead of merged
+constexpr SizeT kSparseGallopRatio = 32;
+
+template <typename IdxType, typename Fn>
+void SparseIntersectMerge(const IdxType *idx1, SizeT nnz1, const IdxType *idx2, SizeT nnz2, SizeT i, SizeT j, Fn &fn) {
+    while (i < nnz1 && j < nnz2) {
+        if (idx1[i] == idx2[j]) {
+            fn(i, j);
+            ++i;
+            ++j;
+        } else if (idx1[i] < idx2[j]) {
+            ++i;
+        } else {
+            ++j;
+        }
+    }
+}
+
+// Every index of the short side is found in the long side by an exponential search from the last position
+template <typename IdxType, typename Fn>
+void SparseIntersectGallop(const IdxType *short_idx, SizeT short_nnz, const IdxType *long_idx, SizeT long_nnz, Fn &fn) {
+    SizeT j = 0;
+    for (SizeT i = 0; i < short_nnz && j < long_nnz; ++i) {
+        const IdxType target = short_idx[i];
+        SizeT bound = 1;
+        while (j + bound < long_nnz && long_idx[j + bound] < target) {
+            bound *= 2;
+        }
+        const IdxType *begin = long_idx + j + bound / 2;
+        const IdxType *end = long_idx + std::min(j + bound + 1, long_nnz);
+        j = std::lower_bound(begin, end, target) - long_idx;
+        if (j < long_nnz && long_idx[j] == target) {
+            fn(i, j);
+            ++j;
+        }
+    }
+}
+
+#if defined(__SSE4_2__)
+// 8 x 8 indices are compared at once by pcmpestrm. The matched lanes of both sides hold the same indices in the same order.
+template <typename Fn>
+void SparseIntersectI16_sse42(const i16 *idx1, SizeT nnz1, const i16 *idx2, SizeT nnz2, Fn &fn) {
+    constexpr int mode = _SIDD_UWORD_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_BIT_MASK;
+    SizeT i = 0, j = 0;
+    while (i + 8 <= nnz1 && j + 8 <= nnz2) {
+        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(idx1 + i));
+        const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(idx2 + j));
+        // bit k is set if lane k of the second operand equals any lane of the first
+        u32 mask1 = _mm_cvtsi128_si32(_mm_cmpestrm(v2, 8, v1, 8, mode));
+        if (mask1 != 0) {
+            u32 mask2 = _mm_cvtsi128_si32(_mm_cmpestrm(v1, 8, v2, 8, mode));
+            do {
+                fn(i + std::countr_zero(mask1), j + std::countr_zero(mask2));
+                mask1 &= mask1 - 1;
+                mask2 &= mask2 - 1;
+            } while (mask1 != 0);
+        }
+        const i16 max1 = idx1[i + 7];
+        const i16 max2 = idx2[j + 7];
+        if (max1 <= max2) {
+            i += 8;
+        }
+        if (max2 <= max1) {
+            j += 8;
+        }
+    }
+    SparseIntersectMerge(idx1, nnz1, idx2, nnz2, i, j, fn);
+}
+#endif
+
+#if defined(__SSE2__)
+inline __m128i AnyEqualI32x4_sse2(__m128i v, __m128i others) {
+    __m128i eq = _mm_cmpeq_epi32(v, others);
+    eq = _mm_or_si128(eq, _mm_cmpeq_epi32(v, _mm_shuffle_epi32(others, _MM_SHUFFLE(0, 3, 2, 1))));
+    eq = _mm_or_si128(eq, _mm_cmpeq_epi32(v, _mm_shuffle_epi32(others, _MM_SHUFFLE(1, 0, 3, 2))));
+    eq = _mm_or_si128(eq, _mm_cmpeq_epi32(v, _mm_shuffle_epi32(others, _MM_SHUFFLE(2, 1, 0, 3))));
+    return eq;
+}
+
+// 4 x 4 indices are compared at once against the rotations of the other side
+template <typename Fn>
+void SparseIntersectI32_sse2(const i32 *idx1, SizeT nnz1, const i32 *idx2, SizeT nnz2, Fn &fn) {
+    SizeT i = 0, j = 0;
+    while (i + 4 <= nnz1 && j + 4 <= nnz2) {
+        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(idx1 + i));
+        const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(idx2 + j));
+        u32 mask1 = _mm_movemask_ps(_mm_castsi128_ps(AnyEqualI32x4_sse2(v1, v2)));
+        if (mask1 != 0) {
+            u32 mask2 = _mm_movemask_ps(_mm_castsi128_ps(AnyEqualI32x4_sse2(v2, v1)));
+            do {
+                fn(i + std::countr_zero(mask1), j + std::countr_zero(mask2));
+                mask1 &= mask1 - 1;
+                mask2 &= mask2 - 1;
+            } while (mask1 != 0);
+        }
+        const i32 max1 = idx1[i + 3];
+        const i32 max2 = idx2[j + 3];
+        if (max1 <= max2) {
+            i += 4;
+        }
+        if (max2 <= max1) {
+            j += 4;
+        }
+    }
+    SparseIntersectMerge(idx1, nnz1, idx2, nnz2, i, j, fn);
+}
+#endif
+
+export template <typename IdxType, typename Fn>
+void SparseIntersect(const IdxType *idx1, SizeT nnz1, const IdxType *idx2, SizeT nnz2, Fn &&fn) {
+    if (nnz1 * kSparseGallopRatio < nnz2) {
+        SparseIntersectGallop(idx1, nnz1, idx2, nnz2, fn);
+        return;
+    }
+    if (nnz2 * kSparseGallopRatio < nnz1) {
+        auto swapped_fn = [&fn](SizeT j, SizeT i) { fn(i, j); };
+        SparseIntersectGallop(idx2, nnz2, idx1, nnz1, swapped_fn);
+        return;
+    }
+#if defined(__SSE4_2__)
+    if constexpr (std::is_same_v<IdxType, i16>) {
+        SparseIntersectI16_sse42(idx1, nnz1, idx2, nnz2, fn);
+        return;
+    }
+#endif
+#if defined(__SSE2__)
+    if constexpr (std::is_same_v<IdxType, i32>) {
+        SparseIntersectI32_sse2(idx1, nnz1, idx2, nnz2, fn);
+        return;
+    }
+#endif
+    SparseIntersectMerge(idx1, nnz1, idx2, nnz2, 0, 0, fn);
+}
+
+} // namespace infinity
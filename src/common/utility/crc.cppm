@@ -4,6 +4,13 @@
 
 module;
 
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+#include <cstring>
+
 export module crc;
 
 import stl;
@@ -47,4 +54,42 @@ CRCBase<T> CRCImpl<T, polynomial, initial_remainder, final_xor_value>::base{poly
 constexpr u32 CRC32_IEEE = 0xEDB88320;
 using CRC32IEEE = CRCImpl<u32, CRC32_IEEE, 0xFFFFFFFF, 0xFFFFFFFF>;
 
+// CRC32C (Castagnoli), with the crc32 instructions of SSE4.2 or ARMv8 when the build targets them.
+// Extend() continues a checksum returned by a previous call, so that data can be checksummed while it is streamed.
+constexpr u32 CRC32_C = 0x82F63B78;
+
+struct CRC32C {
+    static u32 Extend(u32 crc, const void *data, SizeT size) {
+        const auto *p = static_cast<const unsigned char *>(data);
+        u32 c = ~crc;
+#if defined(__SSE4_2__) || defined(__ARM_FEATURE_CRC32)
+        for (; size >= sizeof(u64); size -= sizeof(u64), p += sizeof(u64)) {
+            u64 word;
+            std::memcpy(&word, p, sizeof(word));
+#if defined(__SSE4_2__)
+            c = static_cast<u32>(_mm_crc32_u64(c, word));
+#else
+            c = __crc32cd(c, word);
+#endif
+        }
+        for (; size > 0; --size, ++p) {
+#if defined(__SSE4_2__)
+            c = _mm_crc32_u8(c, *p);
+#else
+            c = __crc32cb(c, *p);
+#endif
+        }
+#else
+        for (; size > 0; --size, ++p) {
+            c = base.tab[(c ^ *p) & 0xff] ^ (c >> 8);
+        }
+#endif
+        return ~c;
+    }
+
+    static u32 Value(const void *data, SizeT size) { return Extend(0, data, size); }
+
+    inline static CRCBase<u32> base{CRC32_C};
+};
+
 } // namespace infinity
@@ -2,6 +2,7 @@ module;
 #include <cassert>
 #include <cstring>
 #include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>
 #include <string>
 
 module wrap_infinity;
@@ -25,6 +26,7 @@ import explain_statement;
 import command_statement;
 import infinity;
 import data_block;
+import data_table;
 import value;
 import data_type;
 import type_info;
@@ -1028,7 +1030,114 @@ void HandleRowIDType(ColumnField &output_column_field, SizeT row_count, const Sh
     output_column_field.column_type = column_vector->data_type()->type();
 }
 
-void ProcessColumnFieldType(ColumnField &output_column_field, SizeT row_count, const SharedPtr<ColumnVector> &column_vector) {
+bool EmbeddingNumpyDType(EmbeddingDataType element_type, nb::dlpack::dtype &dtype) {
+    switch (element_type) {
+        case EmbeddingDataType::kElemInt8: {
+            dtype = nb::dtype<i8>();
+            return true;
+        }
+        case EmbeddingDataType::kElemUInt8: {
+            dtype = nb::dtype<u8>();
+            return true;
+        }
+        case EmbeddingDataType::kElemInt16: {
+            dtype = nb::dtype<i16>();
+            return true;
+        }
+        case EmbeddingDataType::kElemInt32: {
+            dtype = nb::dtype<i32>();
+            return true;
+        }
+        case EmbeddingDataType::kElemInt64: {
+            dtype = nb::dtype<i64>();
+            return true;
+        }
+        case EmbeddingDataType::kElemFloat: {
+            dtype = nb::dtype<f32>();
+            return true;
+        }
+        case EmbeddingDataType::kElemDouble: {
+            dtype = nb::dtype<f64>();
+            return true;
+        }
+        case EmbeddingDataType::kElemFloat16: {
+            dtype = nb::dlpack::dtype{static_cast<u8>(nb::dlpack::dtype_code::Float), 16, 1};
+            return true;
+        }
+        case EmbeddingDataType::kElemBFloat16: {
+            // NumPy has no bfloat16, the raw bits are handed over as uint16
+            dtype = nb::dtype<u16>();
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+// Fixed-width column types which can be viewed as a NumPy array without conversion.
+// Embeddings become [row_count, dimension] arrays.
+bool NumpyDType(const SharedPtr<DataType> &data_type, nb::dlpack::dtype &dtype, SizeT &dimension) {
+    dimension = 1;
+    switch (data_type->type()) {
+        case LogicalType::kTinyInt: {
+            dtype = nb::dtype<i8>();
+            return true;
+        }
+        case LogicalType::kSmallInt: {
+            dtype = nb::dtype<i16>();
+            return true;
+        }
+        case LogicalType::kInteger: {
+            dtype = nb::dtype<i32>();
+            return true;
+        }
+        case LogicalType::kBigInt: {
+            dtype = nb::dtype<i64>();
+            return true;
+        }
+        case LogicalType::kFloat16: {
+            return EmbeddingNumpyDType(EmbeddingDataType::kElemFloat16, dtype);
+        }
+        case LogicalType::kBFloat16: {
+            return EmbeddingNumpyDType(EmbeddingDataType::kElemBFloat16, dtype);
+        }
+        case LogicalType::kFloat: {
+            dtype = nb::dtype<f32>();
+            return true;
+        }
+        case LogicalType::kDouble: {
+            dtype = nb::dtype<f64>();
+            return true;
+        }
+        case LogicalType::kEmbedding: {
+            auto embedding_info = static_cast<EmbeddingInfo *>(data_type->type_info().get());
+            dimension = embedding_info->Dimension();
+            return EmbeddingNumpyDType(embedding_info->Type(), dtype);
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+// The array borrows the column vector buffer, `owner` keeps the result table alive as long as the array is referenced
+bool HandleNumpyType(ColumnField &output_column_field, SizeT row_count, const SharedPtr<ColumnVector> &column_vector, nb::handle owner) {
+    nb::dlpack::dtype dtype;
+    SizeT dimension = 0;
+    if (!NumpyDType(column_vector->data_type(), dtype, dimension)) {
+        return false;
+    }
+    const SizeT shape[2] = {row_count, dimension};
+    const SizeT ndim = column_vector->data_type()->type() == LogicalType::kEmbedding ? 2 : 1;
+    output_column_field.column_arrays.emplace_back(column_vector->data(), ndim, shape, owner, nullptr, dtype);
+    return true;
+}
+
+void ProcessColumnFieldType(ColumnField &output_column_field, SizeT row_count, const SharedPtr<ColumnVector> &column_vector, nb::handle owner) {
+    if (HandleNumpyType(output_column_field, row_count, column_vector, owner)) {
+        return;
+    }
     switch (column_vector->data_type()->type()) {
         case LogicalType::kBoolean: {
             HandleBoolType(output_column_field, row_count, column_vector);
@@ -1080,13 +1189,13 @@ void ProcessColumnFieldType(ColumnField &output_column_field, SizeT row_count, c
     }
 }
 
-void ProcessColumns(const SharedPtr<DataBlock> &data_block, SizeT column_count, Vector<ColumnField> &columns) {
+void ProcessColumns(const SharedPtr<DataBlock> &data_block, SizeT column_count, Vector<ColumnField> &columns, nb::handle owner) {
     auto row_count = data_block->row_count();
     for (SizeT col_index = 0; col_index < column_count; ++col_index) {
         auto &result_column_vector = data_block->column_vectors[col_index];
         ColumnField &output_column_field = columns[col_index];
         output_column_field.column_type = result_column_vector->data_type()->type();
-        ProcessColumnFieldType(output_column_field, row_count, result_column_vector);
+        ProcessColumnFieldType(output_column_field, row_count, result_column_vector, owner);
     }
 }
 
@@ -1154,10 +1263,12 @@ void HandleColumnDef(WrapQueryResult &wrap_query_result, SizeT column_count, Sha
 }
 
 void ProcessDataBlocks(QueryResult &query_result, WrapQueryResult &wrap_query_result, Vector<ColumnField> &columns) {
+    auto *result_table = new SharedPtr<DataTable>(query_result.result_table_);
+    nb::capsule owner(result_table, [](void *p) noexcept { delete static_cast<SharedPtr<DataTable> *>(p); });
     SizeT blocks_count = query_result.result_table_->DataBlockCount();
     for (SizeT block_idx = 0; block_idx < blocks_count; ++block_idx) {
         auto data_block = query_result.result_table_->GetDataBlockById(block_idx);
-        ProcessColumns(data_block, query_result.result_table_->ColumnCount(), columns);
+        ProcessColumns(data_block, query_result.result_table_->ColumnCount(), columns, owner);
     }
     HandleColumnDef(wrap_query_result, query_result.result_table_->ColumnCount(), query_result.result_table_->definition_ptr_, columns);
 }
@@ -3,6 +3,7 @@ module;
 #include "parser/type/complex/embedding_type.h"
 #include <cstring>
 #include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>
 #include <string>
 
 export module wrap_infinity;
@@ -54,6 +55,8 @@ namespace infinity {
 export struct ColumnField {
     LogicalType column_type;
     Vector<nb::bytes> column_vectors;
+    // Fixed-width columns are returned as NumPy arrays borrowing the result buffers, one per data block
+    Vector<nb::ndarray<nb::numpy>> column_arrays;
     String column_name;
 };
 
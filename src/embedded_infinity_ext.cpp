@@ -1,4 +1,5 @@
 #include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>
 #include <nanobind/stl/set.h>
 #include <nanobind/stl/shared_ptr.h>
 #include <nanobind/stl/string.h>
@@ -61,6 +62,7 @@ NB_MODULE(embedded_infinity_ext, m) {
         .def(nb::init<>())
         .def_rw("column_type", &ColumnField::column_type)
         .def_rw("column_vectors", &ColumnField::column_vectors)
+        .def_rw("column_arrays", &ColumnField::column_arrays)
         .def_rw("column_name", &ColumnField::column_name);
 
     nb::class_<WrapDataType>(m, "WrapDataType")
@@ -82,7 +84,32 @@ NB_MODULE(embedded_infinity_ext, m) {
         .def_rw("f64_tensor_value", &WrapConstantExpr::f64_tensor_value)
         .def_rw("i64_tensor_array_value", &WrapConstantExpr::i64_tensor_array_value)
         .def_rw("f64_tensor_array_value", &WrapConstantExpr::f64_tensor_array_value)
-        .def_rw("i64_array_idx", &WrapConstantExpr::i64_array_idx);
+        .def_rw("i64_array_idx", &WrapConstantExpr::i64_array_idx)
+        // NumPy arrays are copied in one pass instead of being converted element by element from a Python list
+        .def("set_i64_array",
+             [](WrapConstantExpr &self, nb::ndarray<const i64, nb::ndim<1>, nb::c_contig, nb::device::cpu> array) {
+                 self.i64_array_value.assign(array.data(), array.data() + array.shape(0));
+             })
+        .def("set_f64_array",
+             [](WrapConstantExpr &self, nb::ndarray<const f64, nb::ndim<1>, nb::c_contig, nb::device::cpu> array) {
+                 self.f64_array_value.assign(array.data(), array.data() + array.shape(0));
+             })
+        .def("set_i64_tensor",
+             [](WrapConstantExpr &self, nb::ndarray<const i64, nb::ndim<2>, nb::c_contig, nb::device::cpu> array) {
+                 self.i64_tensor_value.resize(array.shape(0));
+                 for (SizeT i = 0; i < array.shape(0); ++i) {
+                     const i64 *row = array.data() + i * array.shape(1);
+                     self.i64_tensor_value[i].assign(row, row + array.shape(1));
+                 }
+             })
+        .def("set_f64_tensor",
+             [](WrapConstantExpr &self, nb::ndarray<const f64, nb::ndim<2>, nb::c_contig, nb::device::cpu> array) {
+                 self.f64_tensor_value.resize(array.shape(0));
+                 for (SizeT i = 0; i < array.shape(0); ++i) {
+                     const f64 *row = array.data() + i * array.shape(1);
+                     self.f64_tensor_value[i].assign(row, row + array.shape(1));
+                 }
+             });
 
     nb::class_<WrapColumnDef>(m, "WrapColumnDef")
         .def(nb::init<>())
@@ -313,6 +340,11 @@ NB_MODULE(embedded_infinity_ext, m) {
         .value("kBVECS", CopyFileType::kBVECS)
         .value("kInvalid", CopyFileType::kInvalid);
 
+    nb::enum_<CopyCompressionType>(m, "CopyCompressionType")
+        .value("kNone", CopyCompressionType::kNone)
+        .value("kZstd", CopyCompressionType::kZstd)
+        .value("kLz4", CopyCompressionType::kLz4);
+
     nb::class_<InitParameter>(m, "InitParameter")
         .def(nb::init<>())
         .def_rw("param_name", &InitParameter::param_name_)
@@ -366,7 +398,8 @@ NB_MODULE(embedded_infinity_ext, m) {
         .def_rw("offset", &ExportOptions::offset_)
         .def_rw("limit", &ExportOptions::limit_)
         .def_rw("row_limit", &ExportOptions::row_limit_)
-        .def_rw("copy_file_type", &ExportOptions::copy_file_type_);
+        .def_rw("copy_file_type", &ExportOptions::copy_file_type_)
+        .def_rw("compression_type", &ExportOptions::compression_type_);
 
     nb::class_<WrapOptimizeOptions>(m, "WrapOptimizeOptions")
         .def(nb::init<>())
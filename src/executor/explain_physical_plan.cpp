@@ -90,11 +90,28 @@ import column_def;
 import statement_common;
 import flush_statement;
 import common_query_filter;
+import block_index;
 import table_entry;
 import logger;
 
 namespace infinity {
 
+static void ExplainFastRoughFilterPruning(const CommonQueryFilter *filter, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) {
+    if (filter == nullptr or filter->original_filter_ == nullptr) {
+        return;
+    }
+    SizeT pruned_segment_count = 0;
+    SizeT pruned_block_count = 0;
+    filter->EstimateFastRoughFilterPruning(pruned_segment_count, pruned_block_count);
+    const BlockIndex *block_index = filter->base_table_ref_->block_index_.get();
+    String pruning_str = String(intent_size, ' ') + fmt::format(" - fast rough filter pruned: {}/{} segments, {}/{} blocks",
+                                                                pruned_segment_count,
+                                                                block_index->SegmentCount(),
+                                                                pruned_block_count,
+                                                                block_index->BlockCount());
+    result->emplace_back(MakeShared<String>(std::move(pruning_str)));
+}
+
 void ExplainPhysicalPlan::Explain(const PhysicalOperator *op, SharedPtr<Vector<SharedPtr<String>>> &result, bool is_recursive, i64 intent_size) {
     switch (op->operator_type()) {
         case PhysicalOperatorType::kAggregate: {
@@ -843,6 +860,7 @@ void ExplainPhysicalPlan::Explain(const PhysicalKnnScan *knn_scan_node, SharedPt
         ExplainLogicalPlan::Explain(knn_scan_node->common_query_filter_->original_filter_.get(), filter_str);
         result->emplace_back(MakeShared<String>(filter_str));
     }
+    ExplainFastRoughFilterPruning(knn_scan_node->common_query_filter(), result, intent_size);
 
     // Output columns
     String output_columns = String(intent_size, ' ') + " - output columns: [";
@@ -1267,6 +1285,21 @@ void ExplainPhysicalPlan::Explain(const PhysicalShow *show_node, SharedPtr<Vecto
             result->emplace_back(MakeShared<String>(output_columns_str));
             break;
         }
+        case ShowType::kShowIndexBuilds: {
+            String show_str;
+            if (intent_size != 0) {
+                show_str = String(intent_size - 2, ' ') + "-> SHOW INDEX BUILDS ";
+            } else {
+                show_str = "SHOW INDEX BUILDS ";
+            }
+            show_str += "(" + std::to_string(show_node->node_id()) + ")";
+            result->emplace_back(MakeShared<String>(show_str));
+
+            String output_columns_str = String(intent_size, ' ') + " - output columns: [job_id, db_name, table_name, index_name, segments, "
+                                                                   "built_segments, rows, processed_rows, elapsed_ms, remaining_ms]";
+            result->emplace_back(MakeShared<String>(output_columns_str));
+            break;
+        }
         case ShowType::kShowViews: {
             String show_str;
             if (intent_size != 0) {
@@ -2402,6 +2435,8 @@ void ExplainPhysicalPlan::Explain(const PhysicalMatch *match_node, SharedPtr<Vec
         }
     }
 
+    ExplainFastRoughFilterPruning(match_node->common_query_filter(), result, intent_size);
+
     // Output columns
     String output_columns = String(intent_size, ' ') + " - output columns: [";
     SizeT column_count = match_node->GetOutputNames()->size();
@@ -2471,6 +2506,8 @@ void ExplainPhysicalPlan::Explain(const PhysicalMatchTensorScan *match_tensor_no
         }
     }
 
+    ExplainFastRoughFilterPruning(match_tensor_node->common_query_filter(), result, intent_size);
+
     // Output columns
     String output_columns = String(intent_size, ' ') + " - output columns: [";
     SizeT column_count = match_tensor_node->GetOutputNames()->size();
@@ -2491,6 +2528,53 @@ void ExplainPhysicalPlan::Explain(const PhysicalMatchTensorScan *match_tensor_no
     }
 }
 
+void ExplainPhysicalPlan::Explain(const PhysicalMatchSparseScan *match_sparse_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) {
+    String explain_header_str;
+    if (intent_size != 0) {
+        explain_header_str = String(intent_size - 2, ' ') + "-> MatchSparseScan ";
+    } else {
+        explain_header_str = "MatchSparseScan ";
+    }
+    explain_header_str += "(" + std::to_string(match_sparse_node->node_id()) + ")";
+    result->emplace_back(MakeShared<String>(explain_header_str));
+
+    // Table alias and name
+    String table_name = String(intent_size, ' ') + " - table name: " + match_sparse_node->TableAlias() + "(";
+
+    table_name += *match_sparse_node->table_collection_ptr()->GetDBName() + ".";
+    table_name += *match_sparse_node->table_collection_ptr()->GetTableName() + ")";
+    result->emplace_back(MakeShared<String>(table_name));
+
+    // Table index
+    String table_index = String(intent_size, ' ') + " - table index: #" + std::to_string(match_sparse_node->table_index());
+    result->emplace_back(MakeShared<String>(table_index));
+
+    String match_sparse_expression = String(intent_size, ' ') + " - MatchSparse expression: " + match_sparse_node->match_sparse_expr()->ToString();
+    result->emplace_back(MakeShared<String>(std::move(match_sparse_expression)));
+
+    // filter expression
+    if (const CommonQueryFilter *filter = match_sparse_node->common_query_filter(); filter and filter->original_filter_) {
+        String filter_str = String(intent_size, ' ') + " - filter: ";
+        ExplainLogicalPlan::Explain(filter->original_filter_.get(), filter_str);
+        result->emplace_back(MakeShared<String>(filter_str));
+    }
+    ExplainFastRoughFilterPruning(match_sparse_node->common_query_filter(), result, intent_size);
+
+    // Output columns
+    String output_columns = String(intent_size, ' ') + " - output columns: [";
+    SizeT column_count = match_sparse_node->GetOutputNames()->size();
+    if (column_count == 0) {
+        String error_message = "No column in PhysicalMatchSparseScan node.";
+        UnrecoverableError(error_message);
+    }
+    for (SizeT idx = 0; idx < column_count - 1; ++idx) {
+        output_columns += match_sparse_node->GetOutputNames()->at(idx) + ", ";
+    }
+    output_columns += match_sparse_node->GetOutputNames()->back();
+    output_columns += "]";
+    result->emplace_back(MakeShared<String>(output_columns));
+}
+
 void ExplainPhysicalPlan::Explain(const PhysicalMergeMatchTensor *merge_match_tensor_node,
                                   SharedPtr<Vector<SharedPtr<String>>> &result,
                                   i64 intent_size) {
@@ -29,6 +29,10 @@ import in_expression;
 import data_block;
 import column_vector;
 import expression_state;
+import in_value_set;
+import expression_selector;
+import selection;
+import logical_type;
 import status;
 import third_party;
 import infinity_exception;
@@ -40,6 +44,51 @@ namespace infinity {
 
 void ExpressionEvaluator::Init(const DataBlock *input_data_block) { input_data_block_ = input_data_block; }
 
+namespace {
+
+void CollectReferencedColumns(const SharedPtr<BaseExpression> &expr, Vector<SizeT> &column_ids) {
+    if (expr.get() == nullptr) {
+        return;
+    }
+    switch (expr->type()) {
+        case ExpressionType::kReference: {
+            column_ids.push_back(static_cast<const ReferenceExpression *>(expr.get())->column_index());
+            return;
+        }
+        case ExpressionType::kIn: {
+            CollectReferencedColumns(static_cast<InExpression *>(expr.get())->left_operand(), column_ids);
+            break;
+        }
+        case ExpressionType::kCase: {
+            auto *case_expr = static_cast<CaseExpression *>(expr.get());
+            for (const CaseCheck &case_check : case_expr->CaseExpr()) {
+                CollectReferencedColumns(case_check.when_expr_, column_ids);
+                CollectReferencedColumns(case_check.then_expr_, column_ids);
+            }
+            CollectReferencedColumns(case_expr->ElseExpr(), column_ids);
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    for (const auto &argument : expr->arguments()) {
+        CollectReferencedColumns(argument, column_ids);
+    }
+}
+
+} // namespace
+
+Vector<SizeT> ExpressionEvaluator::ReferencedColumns(const Vector<SharedPtr<BaseExpression>> &expressions) {
+    Vector<SizeT> column_ids;
+    for (const auto &expr : expressions) {
+        CollectReferencedColumns(expr, column_ids);
+    }
+    std::sort(column_ids.begin(), column_ids.end());
+    column_ids.erase(std::unique(column_ids.begin(), column_ids.end()), column_ids.end());
+    return column_ids;
+}
+
 void ExpressionEvaluator::Execute(const SharedPtr<BaseExpression> &expr, SharedPtr<ExpressionState> &state, SharedPtr<ColumnVector> &output_column) {
 
     switch (expr->type()) {
@@ -132,9 +181,132 @@ void ExpressionEvaluator::Execute(const SharedPtr<CastExpression> &expr,
     expr->func_.function(child_output, output_column_vector, child_output->Size(), cast_parameters);
 }
 
-void ExpressionEvaluator::Execute(const SharedPtr<CaseExpression> &, SharedPtr<ExpressionState> &, SharedPtr<ColumnVector> &) {
-    String error_message = "Case execution";
-    UnrecoverableError(error_message);
+namespace {
+
+// The rows of input_data_block in select, with the columns read by exprs
+UniquePtr<DataBlock> SelectRows(const DataBlock *input_data_block, SharedPtr<Selection> select, const Vector<SharedPtr<BaseExpression>> &exprs) {
+    DataBlock selected_block;
+    selected_block.InitWithSelection(input_data_block, std::move(select));
+    return selected_block.CompactColumns(ExpressionEvaluator::ReferencedColumns(exprs));
+}
+
+} // namespace
+
+void ExpressionEvaluator::Execute(const SharedPtr<CaseExpression> &expr,
+                                  SharedPtr<ExpressionState> &state,
+                                  SharedPtr<ColumnVector> &output_column_vector) {
+    const DataBlock *input_data_block = input_data_block_;
+    SizeT row_count = 1;
+    if (output_column_vector->vector_type() != ColumnVectorType::kConstant && input_data_block != nullptr) {
+        row_count = input_data_block->row_count();
+    }
+    output_column_vector->Finalize(row_count);
+    if (row_count == 0) {
+        return;
+    }
+    output_column_vector->nulls_ptr_->SetAllTrue();
+
+    // Rows which haven't matched a condition yet. Row i of branch_input_block goes to output row output_rows[i].
+    auto output_rows = MakeShared<Selection>();
+    output_rows->Initialize(row_count);
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        output_rows->Append(row_idx);
+    }
+    const DataBlock *branch_input_block = input_data_block;
+    UniquePtr<DataBlock> remaining_block{};
+
+    Vector<CaseCheck> &case_checks = expr->CaseExpr();
+    Vector<SharedPtr<ExpressionState>> &child_states = state->Children();
+    for (SizeT check_idx = 0; check_idx < case_checks.size() && output_rows.get() != nullptr; ++check_idx) {
+        CaseCheck &case_check = case_checks[check_idx];
+        SharedPtr<ExpressionState> &when_state = child_states[check_idx * 2];
+        SharedPtr<ExpressionState> &then_state = child_states[check_idx * 2 + 1];
+
+        const SizeT remaining_count = output_rows->Size();
+        input_data_block_ = branch_input_block;
+        SharedPtr<ColumnVector> &when_output = when_state->OutputColumnVector();
+        Execute(case_check.when_expr_, when_state, when_output);
+
+        SharedPtr<Selection> true_select{};
+        if (when_output->vector_type() == ColumnVectorType::kConstant) {
+            // A constant condition takes all rows or none of them
+            if (!when_output->nulls_ptr_->IsTrue(0) || !when_output->buffer_->GetCompactBit(0)) {
+                continue;
+            }
+        } else {
+            true_select = MakeShared<Selection>();
+            true_select->Initialize(remaining_count);
+            ExpressionSelector::Select(when_output, remaining_count, true_select, true);
+            if (true_select->Size() == 0) {
+                continue;
+            }
+            if (true_select->Size() == remaining_count) {
+                true_select.reset();
+            }
+        }
+
+        if (true_select.get() == nullptr) {
+            // Every remaining row takes this branch, so the rows don't have to be split
+            ExecuteCaseBranch(case_check.then_expr_, then_state, branch_input_block, *output_rows, output_column_vector);
+            output_rows.reset();
+            break;
+        }
+
+        auto then_rows = MakeShared<Selection>();
+        then_rows->Initialize(true_select->Size());
+        auto false_select = MakeShared<Selection>();
+        false_select->Initialize(remaining_count - true_select->Size());
+        auto next_output_rows = MakeShared<Selection>();
+        next_output_rows->Initialize(remaining_count - true_select->Size());
+        for (SizeT row_idx = 0, true_idx = 0; row_idx < remaining_count; ++row_idx) {
+            if (true_idx < true_select->Size() && (*true_select)[true_idx] == row_idx) {
+                then_rows->Append((*output_rows)[row_idx]);
+                ++true_idx;
+            } else {
+                false_select->Append(row_idx);
+                next_output_rows->Append((*output_rows)[row_idx]);
+            }
+        }
+
+        UniquePtr<DataBlock> then_block = SelectRows(branch_input_block, true_select, {case_check.then_expr_});
+        ExecuteCaseBranch(case_check.then_expr_, then_state, then_block.get(), *then_rows, output_column_vector);
+
+        // The other rows go on to the next conditions, with only the columns those read
+        Vector<SharedPtr<BaseExpression>> next_exprs;
+        for (SizeT next_idx = check_idx + 1; next_idx < case_checks.size(); ++next_idx) {
+            next_exprs.emplace_back(case_checks[next_idx].when_expr_);
+            next_exprs.emplace_back(case_checks[next_idx].then_expr_);
+        }
+        next_exprs.emplace_back(expr->ElseExpr());
+        UniquePtr<DataBlock> next_block = SelectRows(branch_input_block, false_select, next_exprs);
+        remaining_block = std::move(next_block);
+        branch_input_block = remaining_block.get();
+        output_rows = std::move(next_output_rows);
+    }
+
+    if (output_rows.get() != nullptr) {
+        ExecuteCaseBranch(expr->ElseExpr(), child_states.back(), branch_input_block, *output_rows, output_column_vector);
+    }
+    input_data_block_ = input_data_block;
+}
+
+void ExpressionEvaluator::ExecuteCaseBranch(const SharedPtr<BaseExpression> &expr,
+                                            SharedPtr<ExpressionState> &state,
+                                            const DataBlock *branch_input_block,
+                                            const Selection &output_rows,
+                                            SharedPtr<ColumnVector> &output_column_vector) {
+    if (expr->Type().type() == LogicalType::kNull) {
+        // THEN NULL, or no ELSE
+        for (SizeT idx = 0; idx < output_rows.Size(); ++idx) {
+            output_column_vector->nulls_ptr_->SetFalse(output_rows[idx]);
+        }
+        return;
+    }
+    input_data_block_ = branch_input_block;
+    SharedPtr<ColumnVector> &branch_output = state->OutputColumnVector();
+    Execute(expr, state, branch_output);
+    // A constant result is evaluated once and copied to every row
+    output_column_vector->ScatterWith(*branch_output, output_rows);
 }
 
 void ExpressionEvaluator::Execute(const SharedPtr<ColumnExpression> &, SharedPtr<ExpressionState> &, SharedPtr<ColumnVector> &) {
@@ -190,9 +362,31 @@ void ExpressionEvaluator::Execute(const SharedPtr<ReferenceExpression> &expr,
     output_column_vector = input_data_block_->column_vectors[column_index];
 }
 
-void ExpressionEvaluator::Execute(const SharedPtr<InExpression> &, SharedPtr<ExpressionState> &, SharedPtr<ColumnVector> &) {
-    Status status = Status::NotSupport("IN execution isn't implemented yet.");
-    RecoverableError(status);
+void ExpressionEvaluator::Execute(const SharedPtr<InExpression> &expr,
+                                  SharedPtr<ExpressionState> &state,
+                                  SharedPtr<ColumnVector> &output_column_vector) {
+    SharedPtr<ExpressionState> &left_state = state->Children()[0];
+    SharedPtr<ColumnVector> &left_output = left_state->OutputColumnVector();
+    Execute(expr->left_operand(), left_state, left_output);
+
+    if (state->in_value_set_.get() == nullptr) {
+        // The binder only keeps constant values of the type of the left operand in the list
+        Vector<SharedPtr<ColumnVector>> value_columns;
+        value_columns.reserve(expr->arguments().size());
+        for (SizeT i = 0; i < expr->arguments().size(); ++i) {
+            SharedPtr<ExpressionState> &value_state = state->Children()[i + 1];
+            SharedPtr<ColumnVector> &value_output = value_state->OutputColumnVector();
+            Execute(expr->arguments()[i], value_state, value_output);
+            value_columns.emplace_back(value_output);
+        }
+        state->in_value_set_ = InValueSet::Make(expr->left_operand()->Type(), value_columns, expr->has_null_value());
+        if (state->in_value_set_.get() == nullptr) {
+            String error_message = fmt::format("IN execution doesn't support type {}", expr->left_operand()->Type().ToString());
+            UnrecoverableError(error_message);
+        }
+    }
+
+    state->in_value_set_->Probe(*left_output, left_output->Size(), expr->in_type() == InType::kNotIn, *output_column_vector);
 }
 
 } // namespace infinity
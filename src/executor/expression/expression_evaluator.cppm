@@ -29,6 +29,7 @@ import in_expression;
 import data_block;
 import column_vector;
 import expression_state;
+import selection;
 
 namespace infinity {
 
@@ -36,6 +37,9 @@ export class ExpressionEvaluator {
 public:
     void Init(const DataBlock *input_data_block);
 
+    // Ids of the input columns read by the expressions, the columns to compact for a block with selection
+    static Vector<SizeT> ReferencedColumns(const Vector<SharedPtr<BaseExpression>> &expressions);
+
     void Execute(const SharedPtr<BaseExpression> &expr, SharedPtr<ExpressionState> &state, SharedPtr<ColumnVector> &output_column_vector);
 
     void Execute(const SharedPtr<AggregateExpression> &expr, SharedPtr<ExpressionState> &state, SharedPtr<ColumnVector> &output_column_vector);
@@ -55,6 +59,13 @@ public:
     void Execute(const SharedPtr<InExpression> &expr, SharedPtr<ExpressionState> &state, SharedPtr<ColumnVector> &output_column_vector);
 
 private:
+    // Evaluate a result of a CASE expression over branch_input_block and write its row i to output row output_rows[i]
+    void ExecuteCaseBranch(const SharedPtr<BaseExpression> &expr,
+                           SharedPtr<ExpressionState> &state,
+                           const DataBlock *branch_input_block,
+                           const Selection &output_rows,
+                           SharedPtr<ColumnVector> &output_column_vector);
+
     const DataBlock *input_data_block_{};
     bool in_aggregate_{false};
 };
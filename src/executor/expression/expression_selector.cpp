@@ -39,13 +39,9 @@ SizeT ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
                                  const DataBlock *input_data_block,
                                  DataBlock *output_data_block,
                                  SizeT count) {
-    this->input_data_ = input_data_block;
-    SharedPtr<Selection> input_select = nullptr;
     SharedPtr<Selection> output_true_select = MakeShared<Selection>();
     output_true_select->Initialize(count);
-    SharedPtr<Selection> output_false_select = nullptr;
-
-    Select(expr, state, count, input_select, output_true_select, output_false_select);
+    Select(expr, state, input_data_block, count, output_true_select);
 
     // Shrink the input data block into output data block
     // this Init function will throw if output_data_block is already initialized before
@@ -53,6 +49,18 @@ SizeT ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
     return output_true_select->Size();
 }
 
+void ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
+                                SharedPtr<ExpressionState> &state,
+                                const DataBlock *input_data_block,
+                                SizeT count,
+                                SharedPtr<Selection> &output_true_select) {
+    this->input_data_ = input_data_block;
+    SharedPtr<Selection> input_select = nullptr;
+    SharedPtr<Selection> output_false_select = nullptr;
+
+    Select(expr, state, count, input_select, output_true_select, output_false_select);
+}
+
 void ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
                                 SharedPtr<ExpressionState> &state,
                                 SizeT count,
@@ -33,6 +33,13 @@ public:
                  DataBlock *output_data_block,
                  SizeT count);
 
+    // Append the ids of the rows of input_data_block which satisfy expr to output_true_select
+    void Select(const SharedPtr<BaseExpression> &expr,
+                SharedPtr<ExpressionState> &state,
+                const DataBlock *input_data_block,
+                SizeT count,
+                SharedPtr<Selection> &output_true_select);
+
     void Select(const SharedPtr<BaseExpression> &expr,
                 SharedPtr<ExpressionState> &state,
                 SizeT count,
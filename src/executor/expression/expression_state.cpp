@@ -102,7 +102,7 @@ SharedPtr<ExpressionState> ExpressionState::CreateState(const SharedPtr<CaseExpr
 
     ColumnVectorType result_column_vector_type = ColumnVectorType::kConstant;
     for (SizeT idx = 0; idx < result->Children().size(); ++idx) {
-        if (result->Children()[idx]->OutputColumnVector()->vector_type() != ColumnVectorType::kConstant) {
+        if (auto &column_ptr = result->Children()[idx]->OutputColumnVector(); !column_ptr || column_ptr->vector_type() != ColumnVectorType::kConstant) {
             result_column_vector_type = ColumnVectorType::kFlat;
             break;
         }
@@ -182,6 +182,10 @@ SharedPtr<ExpressionState> ExpressionState::CreateState(const SharedPtr<Function
 
 SharedPtr<ExpressionState> ExpressionState::CreateState(const SharedPtr<ValueExpression> &value_expr) {
     SharedPtr<ExpressionState> result = MakeShared<ExpressionState>();
+    if (value_expr->Type().type() == LogicalType::kNull) {
+        // Untyped NULL, such as a missing ELSE of CASE, has no column
+        return result;
+    }
     SharedPtr<DataType> value_data_type = MakeShared<DataType>(value_expr->Type());
 
     result->column_vector_ = MakeShared<ColumnVector>(value_data_type);
@@ -203,7 +207,7 @@ SharedPtr<ExpressionState> ExpressionState::CreateState(const SharedPtr<InExpres
 
     ColumnVectorType result_column_vector_type = ColumnVectorType::kConstant;
     for (SizeT idx = 0; idx < result->Children().size(); ++idx) {
-        if (result->Children()[idx]->OutputColumnVector()->vector_type() != ColumnVectorType::kConstant) {
+        if (auto &column_ptr = result->Children()[idx]->OutputColumnVector(); !column_ptr || column_ptr->vector_type() != ColumnVectorType::kConstant) {
             result_column_vector_type = ColumnVectorType::kFlat;
             break;
         }
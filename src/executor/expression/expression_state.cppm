@@ -26,6 +26,7 @@ import function_expression;
 import value_expression;
 import in_expression;
 import column_vector;
+import in_value_set;
 
 namespace infinity {
 
@@ -66,6 +67,9 @@ public:
 
     AggregateFlag agg_flag_{AggregateFlag::kUninitialized};
 
+    // Values of an IN list, built on the first execution
+    UniquePtr<InValueSet> in_value_set_{};
+
 private:
     Vector<SharedPtr<ExpressionState>> children_;
     String name_;
@@ -0,0 +1,207 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cstring>
+#include <string_view>
+
+module in_value_set;
+
+import stl;
+import column_vector;
+import data_type;
+import logical_type;
+import internal_types;
+import infinity_exception;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+// Values are compared by their bits, except floating point values which are compared by value
+template <typename Key>
+inline Key GetKey(const ColumnVector &column_vector, SizeT row) {
+    Key key{};
+    std::memcpy(&key, column_vector.data() + row * sizeof(Key), sizeof(Key));
+    return key;
+}
+
+template <typename Key>
+class InValueSetT final : public InValueSet {
+public:
+    explicit InValueSetT(const Vector<SharedPtr<ColumnVector>> &value_columns) {
+        for (const auto &value_column : value_columns) {
+            if (!value_column->nulls_ptr_->IsTrue(0)) {
+                has_null_ = true;
+                continue;
+            }
+            values_.push_back(GetKey<Key>(*value_column, 0));
+        }
+        if (values_.size() > kScanLimit) {
+            set_.insert(values_.begin(), values_.end());
+            values_.clear();
+        }
+    }
+
+protected:
+    void Lookup(const ColumnVector &input, SizeT count, u8 *found) const final {
+        if (set_.empty()) {
+            for (SizeT i = 0; i < count; ++i) {
+                const Key key = GetKey<Key>(input, i);
+                u8 hit = 0;
+                for (const Key value : values_) {
+                    hit |= static_cast<u8>(value == key);
+                }
+                found[i] = hit;
+            }
+        } else {
+            for (SizeT i = 0; i < count; ++i) {
+                found[i] = set_.contains(GetKey<Key>(input, i));
+            }
+        }
+    }
+
+private:
+    Vector<Key> values_{};
+    HashSet<Key> set_{};
+};
+
+class InValueSetVarchar final : public InValueSet {
+public:
+    explicit InValueSetVarchar(const Vector<SharedPtr<ColumnVector>> &value_columns) {
+        // The set refers to the strings, so they must not move
+        strings_.reserve(value_columns.size());
+        for (const auto &value_column : value_columns) {
+            if (!value_column->nulls_ptr_->IsTrue(0)) {
+                has_null_ = true;
+                continue;
+            }
+            Span<const char> value = value_column->GetVarchar(0);
+            const String &str = strings_.emplace_back(value.data(), value.size());
+            set_.emplace(str);
+        }
+    }
+
+protected:
+    void Lookup(const ColumnVector &input, SizeT count, u8 *found) const final {
+        for (SizeT i = 0; i < count; ++i) {
+            Span<const char> value = input.GetVarchar(i);
+            found[i] = set_.contains(std::string_view(value.data(), value.size()));
+        }
+    }
+
+private:
+    Vector<String> strings_{};
+    HashSet<std::string_view> set_{};
+};
+
+} // namespace
+
+bool InValueSet::SupportType(const DataType &data_type) {
+    switch (data_type.type()) {
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kDate:
+        case LogicalType::kTime:
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp:
+        case LogicalType::kVarchar: {
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+UniquePtr<InValueSet> InValueSet::Make(const DataType &data_type, const Vector<SharedPtr<ColumnVector>> &value_columns, bool has_null_value) {
+    for (const auto &value_column : value_columns) {
+        if (value_column->vector_type() != ColumnVectorType::kConstant || *value_column->data_type() != data_type) {
+            String error_message = fmt::format("IN list value isn't a constant of type {}", data_type.ToString());
+            UnrecoverableError(error_message);
+        }
+    }
+    UniquePtr<InValueSet> in_value_set;
+    switch (data_type.type()) {
+        case LogicalType::kTinyInt: {
+            in_value_set = MakeUnique<InValueSetT<u8>>(value_columns);
+            break;
+        }
+        case LogicalType::kSmallInt: {
+            in_value_set = MakeUnique<InValueSetT<u16>>(value_columns);
+            break;
+        }
+        case LogicalType::kInteger:
+        case LogicalType::kDate:
+        case LogicalType::kTime: {
+            in_value_set = MakeUnique<InValueSetT<u32>>(value_columns);
+            break;
+        }
+        case LogicalType::kBigInt:
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp: {
+            in_value_set = MakeUnique<InValueSetT<u64>>(value_columns);
+            break;
+        }
+        case LogicalType::kFloat: {
+            in_value_set = MakeUnique<InValueSetT<FloatT>>(value_columns);
+            break;
+        }
+        case LogicalType::kDouble: {
+            in_value_set = MakeUnique<InValueSetT<DoubleT>>(value_columns);
+            break;
+        }
+        case LogicalType::kVarchar: {
+            in_value_set = MakeUnique<InValueSetVarchar>(value_columns);
+            break;
+        }
+        default: {
+            return nullptr;
+        }
+    }
+    in_value_set->has_null_ |= has_null_value;
+    return in_value_set;
+}
+
+void InValueSet::Probe(const ColumnVector &input, SizeT count, bool negate, ColumnVector &output) const {
+    Vector<u8> found(count);
+    Lookup(input, count, found.data());
+
+    auto &output_null = output.nulls_ptr_;
+    output_null->SetAllTrue();
+    const bool input_has_null = !input.nulls_ptr_->IsAllTrue();
+    auto *output_u8 = reinterpret_cast<u8 *>(output.data());
+    for (SizeT byte_idx = 0; byte_idx * 8 < count; ++byte_idx) {
+        const SizeT begin = byte_idx * 8;
+        const SizeT end = std::min(begin + 8, count);
+        u8 bits = 0;
+        for (SizeT i = begin; i < end; ++i) {
+            bits |= static_cast<u8>((found[i] ^ static_cast<u8>(negate)) << (i - begin));
+            if ((input_has_null && !input.nulls_ptr_->IsTrue(i)) || (has_null_ && !found[i])) {
+                output_null->SetFalse(i);
+            }
+        }
+        const u8 keep_mask = end - begin == 8 ? u8(0) : static_cast<u8>(u8(0xff) << (end - begin));
+        output_u8[byte_idx] = (output_u8[byte_idx] & keep_mask) | bits;
+    }
+    output.Finalize(count);
+}
+
+} // namespace infinity
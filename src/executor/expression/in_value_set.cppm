@@ -0,0 +1,50 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module in_value_set;
+
+import stl;
+import column_vector;
+import data_type;
+
+namespace infinity {
+
+// Values of an IN list, built once per expression state and probed with every row of the left operand.
+// Small lists are scanned with a branch-free loop, which the compiler vectorizes. Larger lists are put in a hash set.
+export class InValueSet {
+public:
+    static constexpr SizeT kScanLimit = 16;
+
+    // Every value column is a constant column of `data_type`, `has_null_value` tells whether the list also had NULL literals.
+    // Returns nullptr if the type isn't supported.
+    static UniquePtr<InValueSet> Make(const DataType &data_type, const Vector<SharedPtr<ColumnVector>> &value_columns, bool has_null_value);
+
+    static bool SupportType(const DataType &data_type);
+
+    virtual ~InValueSet() = default;
+
+    // Write `input[i] IN (values)` of the first `count` rows to the boolean `output`, or NOT IN if `negate`.
+    // A row is null if its input is null, or if it isn't found and the list contains a null.
+    void Probe(const ColumnVector &input, SizeT count, bool negate, ColumnVector &output) const;
+
+protected:
+    // found[i] = 1 if input row i is in the set
+    virtual void Lookup(const ColumnVector &input, SizeT count, u8 *found) const = 0;
+
+    bool has_null_{false};
+};
+
+} // namespace infinity
@@ -647,6 +647,12 @@ bool PhysicalAggregate::SimpleAggregateExecute(const Vector<UniquePtr<DataBlock>
 
     for (SizeT block_idx = 0; block_idx < input_block_count; ++block_idx) {
         DataBlock *input_data_block = input_blocks[block_idx].get();
+        UniquePtr<DataBlock> compacted_data_block{};
+        if (input_data_block->HasSelection()) {
+            // Only the columns used by the aggregates are copied
+            compacted_data_block = input_data_block->CompactColumns(ExpressionEvaluator::ReferencedColumns(aggregates_));
+            input_data_block = compacted_data_block.get();
+        }
 
         DataBlock *output_data_block = output_blocks[block_idx].get();
 
@@ -689,9 +695,27 @@ bool PhysicalAggregate::SimpleAggregateExecute(const Vector<UniquePtr<DataBlock>
         //     }
         // }
     }
+    if (task_completed && merge_partial_states_) {
+        std::lock_guard<std::mutex> lock(partial_states_mutex_);
+        partial_states_.resize(aggregates_count);
+        for (SizeT expr_idx = 0; expr_idx < aggregates_count; ++expr_idx) {
+            const auto &aggregate_function = static_cast<AggregateExpression *>(aggregates_[expr_idx].get())->aggregate_function_;
+            if (aggregate_function.merge_func_) {
+                partial_states_[expr_idx].emplace_back(std::move(states[expr_idx]));
+            }
+        }
+    }
     return true;
 }
 
+Vector<UniquePtr<char[]>> PhysicalAggregate::TakePartialStates(SizeT aggregate_idx) {
+    std::lock_guard<std::mutex> lock(partial_states_mutex_);
+    if (aggregate_idx >= partial_states_.size()) {
+        return {};
+    }
+    return std::move(partial_states_[aggregate_idx]);
+}
+
 SharedPtr<Vector<String>> PhysicalAggregate::GetOutputNames() const {
     SharedPtr<Vector<String>> result = MakeShared<Vector<String>>();
     SizeT groups_count = groups_.size();
@@ -88,10 +88,21 @@ public:
 
     Vector<HashRange> GetHashRanges(i64 parallel_count) const;
 
+    // Set when the results of parallel tasks are merged by a PhysicalMergeAggregate. The tasks then keep the states of
+    // the aggregates which can't be merged from their final values, e.g. the sketches of approximate aggregates.
+    inline void SetMergePartialStates() { merge_partial_states_ = true; }
+
+    // The states of aggregate `aggregate_idx` left by the completed tasks
+    Vector<UniquePtr<char[]>> TakePartialStates(SizeT aggregate_idx);
+
 private:
     SharedPtr<DataTable> input_table_{};
     u64 groupby_index_{};
     u64 aggregate_index_{};
+
+    bool merge_partial_states_{false};
+    std::mutex partial_states_mutex_{};
+    Vector<Vector<UniquePtr<char[]>>> partial_states_{};
 };
 
 } // namespace infinity
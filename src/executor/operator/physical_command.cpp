@@ -44,9 +44,64 @@ import variables;
 import logger;
 import table_entry;
 import txn;
+import block_index;
+import block_entry;
+import block_column_entry;
+import block_version;
+import segment_index_entry;
+import table_index_entry;
+import index_base;
+import chunk_index_entry;
+import buffer_obj;
+import bg_task;
+import compaction_process;
+import index_build_tracer;
+import infinity_context;
 
 namespace infinity {
 
+namespace {
+
+// Paths of the data and index files of the table visible to `txn`, as read by the file workers
+Vector<String> ScrubFilePaths(TableEntry *table_entry, Txn *txn, const String &data_dir) {
+    Vector<String> file_paths;
+    SharedPtr<BlockIndex> block_index = table_entry->GetBlockIndex(txn);
+    for (const auto &[segment_id, segment_snapshot] : block_index->segment_block_index_) {
+        for (BlockEntry *block_entry : segment_snapshot.block_map_) {
+            for (const auto &column : block_entry->columns()) {
+                for (const String &path : column->FilePaths()) {
+                    file_paths.push_back(Path(data_dir) / path);
+                }
+            }
+            file_paths.push_back(Path(data_dir) / *block_entry->block_dir() / *BlockVersion::FileName());
+        }
+    }
+    SharedPtr<IndexIndex> index_index = table_entry->GetIndexIndex(txn);
+    for (const IndexSnapshot *index_snapshot : index_index->index_snapshots_vec_) {
+        for (const auto &[segment_id, segment_index_entry] : index_snapshot->segment_index_entries_) {
+            Vector<SharedPtr<ChunkIndexEntry>> chunk_index_entries;
+            segment_index_entry->GetChunkIndexEntries(chunk_index_entries, txn);
+            for (const auto &chunk_index_entry : chunk_index_entries) {
+                // Full text index files are not written by file workers
+                BufferObj *buffer_obj = chunk_index_entry->GetBufferObj();
+                if (buffer_obj == nullptr) {
+                    continue;
+                }
+                String index_file_path = buffer_obj->GetFilename();
+                file_paths.push_back(index_file_path);
+                if (index_snapshot->table_index_entry_->index_base()->index_type_ == IndexType::kSecondary) {
+                    for (u32 part_id = 0; part_id < chunk_index_entry->GetPartNum(); ++part_id) {
+                        file_paths.push_back(fmt::format("{}_part{}", index_file_path, part_id));
+                    }
+                }
+            }
+        }
+    }
+    return file_paths;
+}
+
+} // namespace
+
 void PhysicalCommand::Init() {}
 
 bool PhysicalCommand::Execute(QueryContext *query_context, OperatorState *operator_state) {
@@ -227,6 +282,16 @@ bool PhysicalCommand::Execute(QueryContext *query_context, OperatorState *operat
                             config->SetOptimizeInterval(interval);
                             break;
                         }
+                        case GlobalOptionIndex::kIndexBuildCPUShare: {
+                            i64 cpu_share = set_command->value_int();
+                            if (cpu_share < 1 || cpu_share > 100) {
+                                Status status = Status::InvalidCommand(fmt::format("Attempt to set index build cpu share: {}", cpu_share));
+                                RecoverableError(status);
+                            }
+                            config->SetIndexBuildCPUShare(cpu_share);
+                            InfinityContext::instance().ResizeIndexBuildThreadPool();
+                            break;
+                        }
                         case GlobalOptionIndex::kInvalid: {
                             Status status = Status::InvalidCommand(fmt::format("Unknown config: {}", set_command->var_name()));
                             RecoverableError(status);
@@ -275,6 +340,33 @@ bool PhysicalCommand::Execute(QueryContext *query_context, OperatorState *operat
             table_entry->SetLocked();
             break;
         }
+        case CommandType::kScrubTable: {
+            auto *scrub_table_command = static_cast<ScrubCmd *>(command_info_.get());
+            auto *txn = query_context->GetTxn();
+            auto [table_entry, status] = txn->GetTableByName(scrub_table_command->db_name(), scrub_table_command->table_name());
+            if (!status.ok()) {
+                RecoverableError(status);
+            }
+            CompactionProcessor *compaction_processor = query_context->storage()->compaction_processor();
+            if (compaction_processor == nullptr) {
+                RecoverableError(Status::NotSupport("Scrub table isn't supported in this server mode"));
+            }
+            Vector<String> file_paths = ScrubFilePaths(table_entry, txn, query_context->global_config()->DataDir());
+            LOG_INFO(fmt::format("Scrub table {}.{}: {} files", scrub_table_command->db_name(), scrub_table_command->table_name(), file_paths.size()));
+            auto scrub_task = MakeShared<ScrubTableTask>(scrub_table_command->db_name(), scrub_table_command->table_name(), std::move(file_paths));
+            compaction_processor->Submit(std::move(scrub_task));
+            break;
+        }
+        case CommandType::kCancelIndexBuild: {
+            auto *cancel_index_build_command = static_cast<CancelIndexBuildCmd *>(command_info_.get());
+            i64 job_id = cancel_index_build_command->job_id();
+            if (job_id <= 0 || !query_context->storage()->index_build_tracer()->CancelJob(job_id)) {
+                Status status = Status::InvalidCommand(fmt::format("Index build {} isn't running", job_id));
+                RecoverableError(status);
+            }
+            LOG_INFO(fmt::format("Index build {} is cancelled", job_id));
+            break;
+        }
         case CommandType::kUnlockTable: {
             [[maybe_unused]] auto *unlock_table_command = static_cast<UnlockCmd *>(command_info_.get());
             auto *txn = query_context->GetTxn();
@@ -35,6 +35,7 @@ import infinity_exception;
 import third_party;
 import status;
 import wal_entry;
+import clustering_key;
 
 namespace infinity {
 
@@ -154,49 +155,111 @@ bool PhysicalCompact::Execute(QueryContext *query_context, OperatorState *operat
     UniquePtr<BlockEntry> new_block =
         BlockEntry::NewBlockEntry(new_segment.get(), new_segment->GetNextBlockID(), 0 /*checkpoint_ts*/, column_count, txn);
     const SizeT block_capacity = new_block->row_capacity();
+    Vector<CompactRowRange> row_ranges;
+
+    // Append `row_count` rows of a compacted block, starting from `row_begin`, to the new segment
+    auto append_rows =
+        [&](const Vector<ColumnVector> &input_column_vectors, SegmentID segment_id, BlockID block_id, BlockOffset row_begin, SizeT row_count) {
+            while (row_count > 0) {
+                SizeT append_size = std::min(row_count, block_capacity - new_block->row_count());
+                RowID new_row_id(new_segment_id, new_block->block_id() * block_capacity + new_block->row_count());
+                new_block->AppendBlock(input_column_vectors, row_begin, append_size, buffer_mgr);
+                remapper.AddMap(segment_id, block_id, row_begin, new_row_id);
+                row_ranges.push_back(CompactRowRange{segment_id,
+                                                     static_cast<SegmentOffset>(block_id * block_capacity + row_begin),
+                                                     new_row_id.segment_offset_,
+                                                     static_cast<u32>(append_size)});
+                row_begin += append_size;
+                row_count -= append_size;
+                if (new_block->row_count() == block_capacity) {
+                    new_segment->AppendBlockEntry(std::move(new_block));
+                    new_block = BlockEntry::NewBlockEntry(new_segment.get(), new_segment->GetNextBlockID(), 0, column_count, txn);
+                }
+            }
+        };
+
+    auto get_input_column_vectors = [&](const BlockEntry *block_entry) {
+        Vector<ColumnVector> input_column_vectors;
+        for (ColumnID column_id = 0; column_id < column_count; ++column_id) {
+            auto *column_block_entry = block_entry->GetColumnBlockEntry(column_id);
+            input_column_vectors.emplace_back(column_block_entry->GetConstColumnVector(buffer_mgr));
+        }
+        return input_column_vectors;
+    };
 
     Vector<SegmentID> old_segment_ids;
     for (SegmentEntry *segment : compactible_segments) {
-        SegmentID segment_id = segment->segment_id();
-        old_segment_ids.push_back(segment_id);
-        const auto &segment_info = block_index->segment_block_index_.at(segment_id);
-        for (const auto *block_entry : segment_info.block_map_) {
-            BlockID block_id = block_entry->block_id();
-            Vector<ColumnVector> input_column_vectors;
-            for (ColumnID column_id = 0; column_id < column_count; ++column_id) {
-                auto *column_block_entry = block_entry->GetColumnBlockEntry(column_id);
-                input_column_vectors.emplace_back(column_block_entry->GetConstColumnVector(buffer_mgr));
-            }
-            SizeT read_offset = 0;
-            while (true) {
-                auto [row_begin, row_end] = block_entry->GetVisibleRange(scan_ts, read_offset);
-                SizeT read_size = row_end - row_begin;
-                if (read_size == 0) {
-                    break;
-                }
+        old_segment_ids.push_back(segment->segment_id());
+    }
 
-                auto block_entry_append = [&](SizeT row_begin, SizeT read_size1) {
-                    if (read_size1 == 0) {
-                        return;
+    ClusteringKey clustering_key = ClusteringKey::Make(table_entry->column_defs());
+    if (clustering_key.Empty()) {
+        // Rows keep their arrival order
+        for (SegmentEntry *segment : compactible_segments) {
+            SegmentID segment_id = segment->segment_id();
+            const auto &segment_info = block_index->segment_block_index_.at(segment_id);
+            for (const auto *block_entry : segment_info.block_map_) {
+                BlockID block_id = block_entry->block_id();
+                Vector<ColumnVector> input_column_vectors = get_input_column_vectors(block_entry);
+                BlockOffset read_offset = 0;
+                while (true) {
+                    auto [row_begin, row_end] = block_entry->GetVisibleRange(scan_ts, read_offset);
+                    if (row_end == row_begin) {
+                        break;
                     }
-                    RowID new_row_id(new_segment_id, new_block->block_id() * block_capacity + new_block->row_count());
-                    new_block->AppendBlock(input_column_vectors, row_begin, read_size1, buffer_mgr);
-                    remapper.AddMap(segment_id, block_id, row_begin, new_row_id);
-                    read_offset = row_begin + read_size1;
-                };
-
-                if (read_size + new_block->row_count() > block_capacity) {
-                    SizeT read_size1 = block_capacity - new_block->row_count();
-                    block_entry_append(row_begin, read_size1);
-                    row_begin += read_size1;
-                    read_size -= read_size1;
-                    new_segment->AppendBlockEntry(std::move(new_block));
-
-                    new_block = BlockEntry::NewBlockEntry(new_segment.get(), new_segment->GetNextBlockID(), 0, column_count, txn);
+                    append_rows(input_column_vectors, segment_id, block_id, row_begin, row_end - row_begin);
+                    read_offset = row_end;
                 }
-                block_entry_append(row_begin, read_size);
             }
         }
+    } else {
+        // Rows are written in the clustering key order, so that the min-max filters of the new segment and its blocks are narrow.
+        // All compacted blocks stay loaded until the new segment is written.
+        struct SourceBlock {
+            SegmentID segment_id_;
+            BlockID block_id_;
+            Vector<ColumnVector> column_vectors_;
+        };
+        Vector<SourceBlock> source_blocks;
+        Vector<Pair<u32, BlockOffset>> rows;
+        const Vector<ColumnID> &key_column_ids = clustering_key.column_ids();
+        Vector<Vector<String>> column_keys(key_column_ids.size());
+        for (SegmentEntry *segment : compactible_segments) {
+            SegmentID segment_id = segment->segment_id();
+            const auto &segment_info = block_index->segment_block_index_.at(segment_id);
+            for (const auto *block_entry : segment_info.block_map_) {
+                const u32 source_idx = source_blocks.size();
+                source_blocks.push_back(SourceBlock{segment_id, block_entry->block_id(), get_input_column_vectors(block_entry)});
+                const SourceBlock &source_block = source_blocks.back();
+                BlockOffset read_offset = 0;
+                while (true) {
+                    auto [row_begin, row_end] = block_entry->GetVisibleRange(scan_ts, read_offset);
+                    if (row_end == row_begin) {
+                        break;
+                    }
+                    for (BlockOffset row = row_begin; row < row_end; ++row) {
+                        rows.emplace_back(source_idx, row);
+                        for (SizeT i = 0; i < key_column_ids.size(); ++i) {
+                            ClusteringKey::AppendNormalizedKey(source_block.column_vectors_[key_column_ids[i]], row, column_keys[i].emplace_back());
+                        }
+                    }
+                    read_offset = row_end;
+                }
+            }
+        }
+        Vector<u32> order = clustering_key.SortRows(column_keys);
+        column_keys.clear();
+        // Consecutive rows of the same compacted block are appended together
+        for (SizeT i = 0; i < order.size();) {
+            const auto [source_idx, row_begin] = rows[order[i]];
+            SizeT run_length = 1;
+            while (i + run_length < order.size() && rows[order[i + run_length]] == Pair<u32, BlockOffset>(source_idx, row_begin + run_length)) {
+                ++run_length;
+            }
+            const SourceBlock &source_block = source_blocks[source_idx];
+            append_rows(source_block.column_vectors_, source_block.segment_id_, source_block.block_id_, row_begin, run_length);
+            i += run_length;
+        }
     }
     if (new_block->row_count() > 0) {
         new_segment->AppendBlockEntry(std::move(new_block));
@@ -206,7 +269,7 @@ bool PhysicalCompact::Execute(QueryContext *query_context, OperatorState *operat
     if (new_segment->actual_row_count() > new_segment->row_capacity()) {
         UnrecoverableError(fmt::format("Compact segment {} error because of row count overflow.", new_segment_id));
     }
-    compact_state_data->AddNewSegment(new_segment, std::move(compactible_segments), txn);
+    compact_state_data->AddNewSegment(new_segment, std::move(compactible_segments), std::move(row_ranges), txn);
     compact_operator_state->compact_idx_ = ++group_idx;
     if (group_idx == compact_operator_state->segment_groups_.size()) {
         compact_operator_state->SetComplete();
@@ -26,9 +26,39 @@ import block_index;
 import txn;
 import status;
 import base_table_ref;
+import compact_state_data;
+import segment_entry;
+import segment_index_entry;
+import index_base;
+import logger;
+import third_party;
 
 namespace infinity {
 
+namespace {
+
+// Index of a new segment merged from the indexes of its compacted segments, or nullptr if it has to be built from the segment
+SegmentIndexEntry *
+MergeCompactedIndexes(TableIndexEntry *table_index_entry, const IndexSnapshot &index_snapshot, const CompactSegmentData &segment_data, Txn *txn) {
+    const bool keep_row_order = segment_data.KeepRowOrder();
+    if (!SegmentIndexEntry::CanPopulateByMerge(table_index_entry->index_base(), keep_row_order)) {
+        return nullptr;
+    }
+    Vector<CompactedSegmentIndex> compacted_indexes;
+    for (SegmentEntry *old_segment : segment_data.old_segments_) {
+        SegmentID old_segment_id = old_segment->segment_id();
+        auto iter = index_snapshot.segment_index_entries_.find(old_segment_id);
+        if (iter == index_snapshot.segment_index_entries_.end()) {
+            return nullptr;
+        }
+        SizeT row_count = old_segment->row_count();
+        compacted_indexes.push_back(CompactedSegmentIndex{iter->second, row_count, segment_data.GetRowMap(old_segment_id, row_count)});
+    }
+    return table_index_entry->CreateIndexByMerge(segment_data.new_segment_.get(), compacted_indexes, keep_row_order, txn);
+}
+
+} // namespace
+
 bool PhysicalCompactIndexPrepare::Execute(QueryContext *query_context, OperatorState *operator_state) {
     auto *compact_index_prepare_operator_state = static_cast<CompactIndexPrepareOperatorState *>(operator_state);
     auto *compact_state_data = compact_index_prepare_operator_state->compact_state_data_.get();
@@ -45,7 +75,8 @@ bool PhysicalCompactIndexPrepare::Execute(QueryContext *query_context, OperatorS
         operator_state->SetComplete();
         return true;
     }
-    auto *table_index_entry = index_index->index_snapshots_vec_[create_index_idx]->table_index_entry_;
+    const IndexSnapshot *index_snapshot = index_index->index_snapshots_vec_[create_index_idx];
+    auto *table_index_entry = index_snapshot->table_index_entry_;
 
     const auto *create_index_shared_data = compact_index_prepare_operator_state->create_index_shared_data_.get();
     if (create_index_shared_data != nullptr) {
@@ -53,13 +84,30 @@ bool PhysicalCompactIndexPrepare::Execute(QueryContext *query_context, OperatorS
     }
 
     Txn *txn = query_context->GetTxn();
-    auto [segment_index_entries, status] = txn->CreateIndexPrepare(table_index_entry, new_table_ref, prepare_, false);
-    if (!status.ok()) {
-        operator_state->status_ = status;
-        return true;
+    // Merge the index chunks of the compacted segments, the segments whose index can't be merged are read again
+    auto rebuild_table_ref = MakeShared<BaseTableRef>(new_table_ref->table_entry_ptr_, MakeShared<BlockIndex>());
+    for (const CompactSegmentData &segment_data : compact_state_data->segment_data_list_) {
+        SegmentID segment_id = segment_data.new_segment_->segment_id();
+        SegmentIndexEntry *segment_index_entry = MergeCompactedIndexes(table_index_entry, *index_snapshot, segment_data, txn);
+        if (segment_index_entry != nullptr) {
+            LOG_INFO(fmt::format("Index {} of compacted segment {} is merged", *table_index_entry->GetIndexName(), segment_id));
+            compact_state_data->AddNewIndexSegment(table_index_entry, segment_index_entry);
+            continue;
+        }
+        const auto &segment_block_index = new_table_ref->block_index_->segment_block_index_;
+        if (auto iter = segment_block_index.find(segment_id); iter != segment_block_index.end()) {
+            rebuild_table_ref->block_index_->segment_block_index_.emplace(segment_id, iter->second);
+        }
     }
-    for (auto *segment_index_entry : segment_index_entries) {
-        compact_state_data->AddNewIndexSegment(table_index_entry, segment_index_entry);
+    if (!rebuild_table_ref->block_index_->IsEmpty()) {
+        auto [segment_index_entries, status] = txn->CreateIndexPrepare(table_index_entry, rebuild_table_ref.get(), prepare_, false);
+        if (!status.ok()) {
+            operator_state->status_ = status;
+            return true;
+        }
+        for (auto *segment_index_entry : segment_index_entries) {
+            compact_state_data->AddNewIndexSegment(table_index_entry, segment_index_entry);
+        }
     }
 
     compact_index_prepare_operator_state->create_index_idx_ = ++create_index_idx;
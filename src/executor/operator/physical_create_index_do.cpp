@@ -50,13 +50,13 @@ PhysicalCreateIndexDo::PhysicalCreateIndexDo(u64 id,
 
 void PhysicalCreateIndexDo::Init() {}
 
-// FIXME: fetch and add a block one time
 bool PhysicalCreateIndexDo::Execute(QueryContext *query_context, OperatorState *operator_state) {
     auto *txn = query_context->GetTxn();
     auto *create_index_do_state = static_cast<CreateIndexDoOperatorState *>(operator_state);
-    auto &create_index_idxes = create_index_do_state->create_index_shared_data_->create_index_idxes_;
+    auto *create_index_shared_data = create_index_do_state->create_index_shared_data_;
+    auto &create_index_idxes = create_index_shared_data->create_index_idxes_;
 
-    auto status = txn->CreateIndexDo(base_table_ref_.get(), *index_name_, create_index_idxes);
+    auto status = txn->CreateIndexDo(base_table_ref_.get(), *index_name_, create_index_idxes, create_index_shared_data->build_job_.get());
     if (!status.ok()) {
         operator_state->status_ = status;
         return false;
@@ -38,6 +38,12 @@ import default_values;
 import txn_store;
 import base_table_ref;
 import extra_ddl_info;
+import logger;
+import third_party;
+import block_index;
+import table_entry;
+import table_index_entry;
+import segment_index_entry;
 
 namespace infinity {
 PhysicalCreateIndexPrepare::PhysicalCreateIndexPrepare(u64 id,
@@ -47,20 +53,32 @@ PhysicalCreateIndexPrepare::PhysicalCreateIndexPrepare(u64 id,
                                                        SharedPtr<Vector<String>> output_names,
                                                        SharedPtr<Vector<SharedPtr<DataType>>> output_types,
                                                        SharedPtr<Vector<LoadMeta>> load_metas,
-                                                       bool prepare)
+                                                       bool prepare,
+                                                       bool resume)
     : PhysicalOperator(PhysicalOperatorType::kCreateIndexPrepare, nullptr, nullptr, id, load_metas), base_table_ref_(base_table_ref),
-      index_def_ptr_(index_definition), conflict_type_(conflict_type), output_names_(output_names), output_types_(output_types), prepare_(prepare) {}
+      index_def_ptr_(index_definition), conflict_type_(conflict_type), output_names_(output_names), output_types_(output_types), prepare_(prepare),
+      resume_(resume) {}
 
 void PhysicalCreateIndexPrepare::Init() {}
 
 bool PhysicalCreateIndexPrepare::Execute(QueryContext *query_context, OperatorState *operator_state) {
     auto *txn = query_context->GetTxn();
     auto *table_entry = base_table_ref_->table_entry_ptr_;
+    if (resume_) {
+        auto status = ResumeIndex(txn);
+        if (!status.ok()) {
+            operator_state->status_ = status;
+        }
+        operator_state->SetComplete();
+        return true;
+    }
     auto [table_index_entry, status] = txn->CreateIndexDef(table_entry, index_def_ptr_, conflict_type_);
     if (!status.ok()) {
         operator_state->status_ = status;
     } else {
-        auto [segment_index_entries, status] = txn->CreateIndexPrepare(table_index_entry, base_table_ref_.get(), prepare_);
+        // With `prepare_`, the segments are populated by the tasks of `PhysicalCreateIndexDo`
+        auto [segment_index_entries, status] = prepare_ ? txn->CreateIndexPrepareDeferred(table_index_entry, base_table_ref_.get())
+                                                        : txn->CreateIndexPrepare(table_index_entry, base_table_ref_.get(), false);
         if (!status.ok()) {
             operator_state->status_ = status;
             return true;
@@ -79,4 +97,25 @@ bool PhysicalCreateIndexPrepare::Execute(QueryContext *query_context, OperatorSt
     operator_state->SetComplete();
     return true;
 }
+
+Status PhysicalCreateIndexPrepare::ResumeIndex(Txn *txn) {
+    auto *table_entry = base_table_ref_->table_entry_ptr_;
+    auto [table_index_entry, status] = txn->GetIndexByName(*table_entry->GetDBName(), *table_entry->GetTableName(), *index_def_ptr_->index_name_);
+    if (!status.ok()) {
+        return status;
+    }
+    Vector<SegmentIndexEntry *> segment_index_entries = txn->CreateIndexResume(table_index_entry, base_table_ref_.get());
+    if (segment_index_entries.empty()) {
+        LOG_INFO(fmt::format("Index {} is fully built, nothing to resume", *index_def_ptr_->index_name_));
+        return Status::OK();
+    }
+    LOG_INFO(fmt::format("Resume building index {} of {} segments", *index_def_ptr_->index_name_, segment_index_entries.size()));
+    if (base_table_ref_->index_index_.get() == nullptr) {
+        base_table_ref_->index_index_ = MakeShared<IndexIndex>();
+    }
+    for (auto *segment_index_entry : segment_index_entries) {
+        base_table_ref_->index_index_->Insert(table_index_entry, segment_index_entry);
+    }
+    return Status::OK();
+}
 } // namespace infinity
\ No newline at end of file
@@ -28,6 +28,7 @@ import index_base;
 import internal_types;
 import extra_ddl_info;
 import data_type;
+import txn;
 
 namespace infinity {
 export class PhysicalCreateIndexPrepare : public PhysicalOperator {
@@ -39,7 +40,8 @@ public:
                                SharedPtr<Vector<String>> output_names,
                                SharedPtr<Vector<SharedPtr<DataType>>> output_types,
                                SharedPtr<Vector<LoadMeta>> load_metas,
-                               bool prepare);
+                               bool prepare,
+                               bool resume = false);
 
 public:
     void Init() override;
@@ -52,6 +54,10 @@ public:
 
     SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const override { return output_types_; }
 
+private:
+    // Leave the segments that a cancelled build left without index to `PhysicalCreateIndexDo`
+    Status ResumeIndex(Txn *txn);
+
 public:
     const SharedPtr<BaseTableRef> base_table_ref_{};
 
@@ -63,6 +69,8 @@ public:
 
     // if prepare_ is true, then index is constructed with multiple threads
     const bool prepare_;
+    // if resume_ is true, the existing index is built on its segments without index instead of being created
+    const bool resume_;
 };
 
 } // namespace infinity
\ No newline at end of file
@@ -18,8 +18,12 @@ module;
 #include <arrow/io/caching.h>
 #include <arrow/io/file.h>
 #include <parquet/arrow/writer.h>
+#include <functional>
+#include <future>
+#include <lz4frame.h>
 #include <parquet/properties.h>
 #include <string>
+#include <zstd.h>
 
 module physical_export;
 
@@ -44,9 +48,284 @@ import status;
 import buffer_manager;
 import default_values;
 import internal_types;
+import data_type;
+import infinity_context;
+import infinity_exception;
 
 namespace infinity {
 
+namespace {
+
+// Compress one chunk of exported text as a standalone frame. Both zstd and lz4 decoders accept concatenated frames, so
+// chunks compressed independently by the export workers can simply be appended to the output file.
+String CompressExportChunk(CopyCompressionType compression_type, String chunk) {
+    switch (compression_type) {
+        case CopyCompressionType::kNone: {
+            return chunk;
+        }
+        case CopyCompressionType::kZstd: {
+            String compressed(ZSTD_compressBound(chunk.size()), '\0');
+            SizeT compressed_size = ZSTD_compress(compressed.data(), compressed.size(), chunk.data(), chunk.size(), ZSTD_CLEVEL_DEFAULT);
+            if (ZSTD_isError(compressed_size)) {
+                String error_message = fmt::format("Failed to compress export data with zstd: {}", ZSTD_getErrorName(compressed_size));
+                UnrecoverableError(error_message);
+            }
+            compressed.resize(compressed_size);
+            return compressed;
+        }
+        case CopyCompressionType::kLz4: {
+            String compressed(LZ4F_compressFrameBound(chunk.size(), nullptr), '\0');
+            SizeT compressed_size = LZ4F_compressFrame(compressed.data(), compressed.size(), chunk.data(), chunk.size(), nullptr);
+            if (LZ4F_isError(compressed_size)) {
+                String error_message = fmt::format("Failed to compress export data with lz4: {}", LZ4F_getErrorName(compressed_size));
+                UnrecoverableError(error_message);
+            }
+            compressed.resize(compressed_size);
+            return compressed;
+        }
+    }
+    return chunk;
+}
+
+// Appends encoded chunks to the export file and switches to `<file_path>.part<N>` when a chunk belongs to the next part.
+class ExportFileWriter {
+public:
+    explicit ExportFileWriter(const String &file_path) : file_path_(file_path) { Open(file_path_); }
+
+    ~ExportFileWriter() { fs_.Close(*file_handler_); }
+
+    void Write(SizeT part_no, const String &chunk) {
+        if (part_no != part_no_) {
+            fs_.Close(*file_handler_);
+            part_no_ = part_no;
+            Open(fmt::format("{}.part{}", file_path_, part_no_));
+        }
+        fs_.Write(*file_handler_, chunk.data(), chunk.size());
+    }
+
+private:
+    void Open(const String &path) {
+        auto [file_handler, status] = fs_.OpenFile(path, FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG, FileLockType::kWriteLock);
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+        file_handler_ = std::move(file_handler);
+    }
+
+    LocalFileSystem fs_;
+    String file_path_;
+    UniquePtr<FileHandler> file_handler_{};
+    SizeT part_no_{0};
+};
+
+// Encode block ranges on the export thread pool and hand the results to `write` in snapshot order. At most two blocks per
+// worker are in flight, so memory stays bounded however large the table is.
+template <typename Encoded>
+void RunExportPipeline(const Vector<ExportBlockRange> &block_ranges,
+                       const std::function<Encoded(const ExportBlockRange &)> &encode,
+                       const std::function<void(Encoded &)> &write) {
+    ThreadPool &thread_pool = InfinityContext::instance().GetExportThreadPool();
+    const SizeT max_in_flight = 2 * std::max(1, thread_pool.size());
+
+    Deque<std::future<Encoded>> in_flight;
+    auto write_front = [&] {
+        Encoded encoded = in_flight.front().get();
+        in_flight.pop_front();
+        write(encoded);
+    };
+    try {
+        for (const ExportBlockRange &block_range : block_ranges) {
+            if (in_flight.size() >= max_in_flight) {
+                write_front();
+            }
+            in_flight.emplace_back(thread_pool.push([&encode, &block_range](int) { return encode(block_range); }));
+        }
+        while (!in_flight.empty()) {
+            write_front();
+        }
+    } catch (...) {
+        // The tasks reference the caller's stack, wait for them before unwinding.
+        for (auto &fut : in_flight) {
+            fut.wait();
+        }
+        throw;
+    }
+}
+
+template <typename Builder, typename T>
+void AppendRawValues(arrow::ArrayBuilder *array_builder, const T *values, SizeT count) {
+    auto status = static_cast<Builder *>(array_builder)->AppendValues(values, count);
+    if (!status.ok()) {
+        String error_message = fmt::format("Failed to append values to arrow array: {}", status.message());
+        UnrecoverableError(error_message);
+    }
+}
+
+bool IsRawArrowElement(EmbeddingDataType element_type) {
+    switch (element_type) {
+        case EmbeddingDataType::kElemInt8:
+        case EmbeddingDataType::kElemInt16:
+        case EmbeddingDataType::kElemInt32:
+        case EmbeddingDataType::kElemInt64:
+        case EmbeddingDataType::kElemFloat:
+        case EmbeddingDataType::kElemDouble:
+        case EmbeddingDataType::kElemUInt8:
+        case EmbeddingDataType::kElemFloat16: {
+            return true;
+        }
+        default: {
+            // Bits are unpacked to booleans and bfloat16 is widened to float, both go through Value
+            return false;
+        }
+    }
+}
+
+void AppendRawElements(EmbeddingDataType element_type, const char *data, SizeT count, arrow::ArrayBuilder *element_builder) {
+    switch (element_type) {
+        case EmbeddingDataType::kElemInt8: {
+            AppendRawValues<arrow::Int8Builder>(element_builder, reinterpret_cast<const i8 *>(data), count);
+            break;
+        }
+        case EmbeddingDataType::kElemInt16: {
+            AppendRawValues<arrow::Int16Builder>(element_builder, reinterpret_cast<const i16 *>(data), count);
+            break;
+        }
+        case EmbeddingDataType::kElemInt32: {
+            AppendRawValues<arrow::Int32Builder>(element_builder, reinterpret_cast<const i32 *>(data), count);
+            break;
+        }
+        case EmbeddingDataType::kElemInt64: {
+            AppendRawValues<arrow::Int64Builder>(element_builder, reinterpret_cast<const i64 *>(data), count);
+            break;
+        }
+        case EmbeddingDataType::kElemFloat: {
+            AppendRawValues<arrow::FloatBuilder>(element_builder, reinterpret_cast<const f32 *>(data), count);
+            break;
+        }
+        case EmbeddingDataType::kElemDouble: {
+            AppendRawValues<arrow::DoubleBuilder>(element_builder, reinterpret_cast<const f64 *>(data), count);
+            break;
+        }
+        case EmbeddingDataType::kElemUInt8: {
+            AppendRawValues<arrow::UInt8Builder>(element_builder, reinterpret_cast<const u8 *>(data), count);
+            break;
+        }
+        case EmbeddingDataType::kElemFloat16: {
+            AppendRawValues<arrow::HalfFloatBuilder>(element_builder, reinterpret_cast<const u16 *>(data), count);
+            break;
+        }
+        default: {
+            String error_message = "Unexpected embedding element type for raw arrow append";
+            UnrecoverableError(error_message);
+        }
+    }
+}
+
+// Append rows [row_begin, row_end) straight from the column vector buffers. Returns false for the types that still need
+// the per row Value conversion.
+bool AppendColumnVectorToArrow(const DataType &column_type, const ColumnVector &column_vector, SizeT row_begin, SizeT row_end, arrow::ArrayBuilder *array_builder) {
+    const SizeT row_count = row_end - row_begin;
+    const char *data = reinterpret_cast<const char *>(column_vector.data());
+    switch (column_type.type()) {
+        case LogicalType::kTinyInt: {
+            AppendRawValues<arrow::Int8Builder>(array_builder, reinterpret_cast<const TinyIntT *>(data) + row_begin, row_count);
+            return true;
+        }
+        case LogicalType::kSmallInt: {
+            AppendRawValues<arrow::Int16Builder>(array_builder, reinterpret_cast<const SmallIntT *>(data) + row_begin, row_count);
+            return true;
+        }
+        case LogicalType::kInteger: {
+            AppendRawValues<arrow::Int32Builder>(array_builder, reinterpret_cast<const IntegerT *>(data) + row_begin, row_count);
+            return true;
+        }
+        case LogicalType::kBigInt: {
+            AppendRawValues<arrow::Int64Builder>(array_builder, reinterpret_cast<const BigIntT *>(data) + row_begin, row_count);
+            return true;
+        }
+        case LogicalType::kFloat: {
+            AppendRawValues<arrow::FloatBuilder>(array_builder, reinterpret_cast<const FloatT *>(data) + row_begin, row_count);
+            return true;
+        }
+        case LogicalType::kDouble: {
+            AppendRawValues<arrow::DoubleBuilder>(array_builder, reinterpret_cast<const DoubleT *>(data) + row_begin, row_count);
+            return true;
+        }
+        case LogicalType::kFloat16: {
+            AppendRawValues<arrow::HalfFloatBuilder>(array_builder, reinterpret_cast<const u16 *>(data) + row_begin, row_count);
+            return true;
+        }
+        case LogicalType::kDate: {
+            AppendRawValues<arrow::Date32Builder>(array_builder, reinterpret_cast<const i32 *>(data) + row_begin, row_count);
+            return true;
+        }
+        case LogicalType::kTime: {
+            AppendRawValues<arrow::Time32Builder>(array_builder, reinterpret_cast<const i32 *>(data) + row_begin, row_count);
+            return true;
+        }
+        case LogicalType::kVarchar: {
+            auto *string_builder = static_cast<arrow::StringBuilder *>(array_builder);
+            for (SizeT row_idx = row_begin; row_idx < row_end; ++row_idx) {
+                Span<const char> varchar = column_vector.GetVarchar(row_idx);
+                auto status = string_builder->Append(varchar.data(), varchar.size());
+                if (!status.ok()) {
+                    String error_message = fmt::format("Failed to append values to arrow array: {}", status.message());
+                    UnrecoverableError(error_message);
+                }
+            }
+            return true;
+        }
+        case LogicalType::kEmbedding: {
+            const auto *embedding_info = static_cast<const EmbeddingInfo *>(column_type.type_info().get());
+            if (!IsRawArrowElement(embedding_info->Type())) {
+                return false;
+            }
+            auto *fixed_list_builder = static_cast<arrow::FixedSizeListBuilder *>(array_builder);
+            AppendRawElements(embedding_info->Type(),
+                              data + row_begin * embedding_info->Size(),
+                              row_count * embedding_info->Dimension(),
+                              fixed_list_builder->value_builder());
+            auto status = fixed_list_builder->AppendValues(row_count);
+            if (!status.ok()) {
+                String error_message = fmt::format("Failed to append values to arrow array: {}", status.message());
+                UnrecoverableError(error_message);
+            }
+            return true;
+        }
+        case LogicalType::kMultiVector:
+        case LogicalType::kTensor: {
+            const auto *embedding_info = static_cast<const EmbeddingInfo *>(column_type.type_info().get());
+            if (!IsRawArrowElement(embedding_info->Type())) {
+                return false;
+            }
+            auto *list_builder = static_cast<arrow::ListBuilder *>(array_builder);
+            auto *fixed_list_builder = static_cast<arrow::FixedSizeListBuilder *>(list_builder->value_builder());
+            for (SizeT row_idx = row_begin; row_idx < row_end; ++row_idx) {
+                auto [raw_data, embedding_num] = column_type.type() == LogicalType::kTensor ? column_vector.GetTensorRaw(row_idx)
+                                                                                             : column_vector.GetMultiVectorRaw(row_idx);
+                auto status = list_builder->Append();
+                AppendRawElements(embedding_info->Type(),
+                                  raw_data.data(),
+                                  embedding_num * embedding_info->Dimension(),
+                                  fixed_list_builder->value_builder());
+                if (status.ok()) {
+                    status = fixed_list_builder->AppendValues(embedding_num);
+                }
+                if (!status.ok()) {
+                    String error_message = fmt::format("Failed to append values to arrow array: {}", status.message());
+                    UnrecoverableError(error_message);
+                }
+            }
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+} // namespace
+
 void PhysicalExport::Init() {}
 
 bool PhysicalExport::Execute(QueryContext *query_context, OperatorState *operator_state) {
@@ -82,29 +361,108 @@ bool PhysicalExport::Execute(QueryContext *query_context, OperatorState *operato
     return true;
 }
 
-SizeT PhysicalExport::ExportToCSV(QueryContext *query_context, ExportOperatorState *export_op_state) {
-    const Vector<SharedPtr<ColumnDef>> &column_defs = table_entry_->column_defs();
-
-    Vector<ColumnID> select_columns;
+Vector<ColumnID> PhysicalExport::SelectColumns() const {
     // export all columns or export specific column index
-    if (column_idx_array_.empty()) {
-        SizeT column_count = column_defs.size();
-        select_columns.reserve(column_count);
-        for (ColumnID idx = 0; idx < column_count; ++idx) {
-            select_columns.emplace_back(idx);
-        }
-    } else {
-        select_columns = column_idx_array_;
+    if (!column_idx_array_.empty()) {
+        return column_idx_array_;
+    }
+    SizeT column_count = table_entry_->column_defs().size();
+    Vector<ColumnID> select_columns;
+    select_columns.reserve(column_count);
+    for (ColumnID idx = 0; idx < column_count; ++idx) {
+        select_columns.emplace_back(idx);
     }
+    return select_columns;
+}
 
-    SizeT select_column_count = select_columns.size();
+Vector<ExportBlockRange> PhysicalExport::PlanBlockRanges() const {
+    Vector<ExportBlockRange> block_ranges;
+    SizeT offset = offset_;
+    SizeT export_row_count{0};
+    for (auto &[segment_id, segment_snapshot] : block_index_->segment_block_index_) {
+        LOG_DEBUG(fmt::format("Export segment_id: {}, with block count: {}", segment_id, segment_snapshot.block_map_.size()));
+        for (BlockEntry *block_entry : segment_snapshot.block_map_) {
+            // TODO: Check the visibility
+            SizeT block_row_count = block_entry->row_count();
+            SizeT row_begin = std::min(offset, block_row_count);
+            offset -= row_begin;
+            SizeT row_end = block_row_count;
+            if (limit_ != 0) {
+                row_end = std::min(row_end, row_begin + (limit_ - export_row_count));
+            }
+            if (row_begin == row_end) {
+                continue;
+            }
+            block_ranges.push_back({segment_id, block_entry, row_begin, row_end, export_row_count});
+            export_row_count += row_end - row_begin;
+            if (limit_ != 0 && export_row_count == limit_) {
+                return block_ranges;
+            }
+        }
+    }
+    return block_ranges;
+}
 
-    LocalFileSystem fs;
-    auto [file_handler, status] = fs.OpenFile(file_path_, FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG, FileLockType::kWriteLock);
-    if (!status.ok()) {
-        RecoverableError(status);
+Vector<ExportPartRange> PhysicalExport::SplitByPart(const ExportBlockRange &block_range) const {
+    if (row_limit_ == 0) {
+        return {{0, block_range.row_begin_, block_range.row_end_}};
+    }
+    Vector<ExportPartRange> part_ranges;
+    SizeT export_row_idx = block_range.export_row_begin_;
+    for (SizeT row_begin = block_range.row_begin_; row_begin < block_range.row_end_;) {
+        SizeT part_no = export_row_idx / row_limit_;
+        SizeT row_end = std::min(block_range.row_end_, row_begin + ((part_no + 1) * row_limit_ - export_row_idx));
+        part_ranges.push_back({part_no, row_begin, row_end});
+        export_row_idx += row_end - row_begin;
+        row_begin = row_end;
     }
-    DeferFn file_defer([&]() { fs.Close(*file_handler); });
+    return part_ranges;
+}
+
+Vector<ColumnVector>
+PhysicalExport::LoadBlockColumns(const ExportBlockRange &block_range, const Vector<ColumnID> &select_columns, BufferManager *buffer_manager) const {
+    BlockEntry *block_entry = block_range.block_entry_;
+    SizeT block_row_count = block_entry->row_count();
+
+    Vector<ColumnVector> column_vectors;
+    column_vectors.reserve(select_columns.size());
+    for (ColumnID select_column_idx : select_columns) {
+        switch (select_column_idx) {
+            case COLUMN_IDENTIFIER_ROW_ID: {
+                u16 block_id = block_entry->block_id();
+                u32 segment_offset = block_id * DEFAULT_BLOCK_CAPACITY;
+                auto column_vector = ColumnVector(MakeShared<DataType>(LogicalType::kRowID));
+                column_vector.Initialize();
+                column_vector.AppendWith(RowID(block_range.segment_id_, segment_offset), block_row_count);
+                column_vectors.emplace_back(column_vector);
+                break;
+            }
+            case COLUMN_IDENTIFIER_CREATE: {
+                column_vectors.emplace_back(block_entry->GetCreateTSVector(buffer_manager, 0, block_row_count));
+                break;
+            }
+            case COLUMN_IDENTIFIER_DELETE: {
+                column_vectors.emplace_back(block_entry->GetDeleteTSVector(buffer_manager, 0, block_row_count));
+                break;
+            }
+            default: {
+                column_vectors.emplace_back(block_entry->GetColumnBlockEntry(select_column_idx)->GetConstColumnVector(buffer_manager));
+                if (column_vectors.back().Size() != block_row_count) {
+                    String error_message = "Unmatched row_count between block and block_column";
+                    UnrecoverableError(error_message);
+                }
+            }
+        }
+    }
+    return column_vectors;
+}
+
+SizeT PhysicalExport::ExportToCSV(QueryContext *query_context, ExportOperatorState *export_op_state) {
+    const Vector<SharedPtr<ColumnDef>> &column_defs = table_entry_->column_defs();
+    Vector<ColumnID> select_columns = SelectColumns();
+    SizeT select_column_count = select_columns.size();
+
+    ExportFileWriter file_writer(file_path_);
 
     if (header_) {
         // Output CSV header
@@ -135,64 +493,17 @@ SizeT PhysicalExport::ExportToCSV(QueryContext *query_context, ExportOperatorSta
                 header += '\n';
             }
         }
-        fs.Write(*file_handler, header.c_str(), header.size());
+        file_writer.Write(0, CompressExportChunk(compression_type_, std::move(header)));
     }
 
-    SizeT offset = offset_;
-    SizeT row_count{0};
-    SizeT file_no_{0};
-    Map<SegmentID, SegmentSnapshot> &segment_block_index_ref = block_index_->segment_block_index_;
     BufferManager *buffer_manager = query_context->storage()->buffer_manager();
-    for (auto &[segment_id, segment_snapshot] : segment_block_index_ref) {
-        LOG_DEBUG(fmt::format("Export segment_id: {}", segment_id));
-        SizeT block_count = segment_snapshot.block_map_.size();
-        for (SizeT block_idx = 0; block_idx < block_count; ++block_idx) {
-            LOG_DEBUG(fmt::format("Export block_idx: {}", block_idx));
-            BlockEntry *block_entry = segment_snapshot.block_map_[block_idx];
-            SizeT block_row_count = block_entry->row_count();
-
-            Vector<ColumnVector> column_vectors;
-            column_vectors.reserve(select_column_count);
-
-            for (ColumnID block_column_idx = 0; block_column_idx < select_column_count; ++block_column_idx) {
-                ColumnID select_column_idx = select_columns[block_column_idx];
-                switch (select_column_idx) {
-                    case COLUMN_IDENTIFIER_ROW_ID: {
-                        u16 block_id = block_entry->block_id();
-                        u32 segment_offset = block_id * DEFAULT_BLOCK_CAPACITY;
-                        auto column_vector = ColumnVector(MakeShared<DataType>(LogicalType::kRowID));
-                        column_vector.Initialize();
-                        column_vector.AppendWith(RowID(segment_id, segment_offset), block_row_count);
-                        column_vectors.emplace_back(column_vector);
-                        break;
-                    }
-                    case COLUMN_IDENTIFIER_CREATE: {
-                        ColumnVector column_vector = block_entry->GetCreateTSVector(buffer_manager, 0, block_row_count);
-                        column_vectors.emplace_back(column_vector);
-                        break;
-                    }
-                    case COLUMN_IDENTIFIER_DELETE: {
-                        ColumnVector column_vector = block_entry->GetDeleteTSVector(buffer_manager, 0, block_row_count);
-                        column_vectors.emplace_back(column_vector);
-                        break;
-                    }
-                    default: {
-                        column_vectors.emplace_back(block_entry->GetColumnBlockEntry(select_column_idx)->GetConstColumnVector(buffer_manager));
-                        if (column_vectors[block_column_idx].Size() != block_row_count) {
-                            String error_message = "Unmatched row_count between block and block_column";
-                            UnrecoverableError(error_message);
-                        }
-                    }
-                }
-            }
-
-            for (SizeT row_idx = 0; row_idx < block_row_count; ++row_idx) {
-                // TODO: Check the visibility
-                if (offset > 0) {
-                    --offset;
-                    continue;
-                }
-                String line;
+    using EncodedParts = Vector<Pair<SizeT, String>>;
+    auto encode = [&](const ExportBlockRange &block_range) {
+        Vector<ColumnVector> column_vectors = LoadBlockColumns(block_range, select_columns, buffer_manager);
+        EncodedParts encoded_parts;
+        for (const ExportPartRange &part_range : SplitByPart(block_range)) {
+            String lines;
+            for (SizeT row_idx = part_range.row_begin_; row_idx < part_range.row_end_; ++row_idx) {
                 for (SizeT select_column_idx = 0; select_column_idx < select_column_count; ++select_column_idx) {
                     Value v = column_vectors[select_column_idx].GetValue(row_idx);
                     switch (v.type().type()) {
@@ -201,171 +512,94 @@ SizeT PhysicalExport::ExportToCSV(QueryContext *query_context, ExportOperatorSta
                         case LogicalType::kTensor:
                         case LogicalType::kTensorArray:
                         case LogicalType::kSparse: {
-                            line += fmt::format("\"{}\"", v.ToString());
+                            lines += fmt::format("\"{}\"", v.ToString());
                             break;
                         }
                         default: {
-                            line += v.ToString();
+                            lines += v.ToString();
                         }
                     }
                     if (select_column_idx == select_column_count - 1) {
-                        line += "\n";
+                        lines += "\n";
                     } else {
-                        line += delimiter_;
+                        lines += delimiter_;
                     }
                 }
-
-                if (row_count > 0 && this->row_limit_ != 0 && (row_count % this->row_limit_) == 0) {
-                    ++file_no_;
-                    fs.Close(*file_handler);
-                    String new_file_path = fmt::format("{}.part{}", file_path_, file_no_);
-                    auto result = fs.OpenFile(new_file_path, FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG, FileLockType::kWriteLock);
-                    if (!result.second.ok()) {
-                        RecoverableError(result.second);
-                    }
-                    file_handler = std::move(result.first);
-                }
-
-                fs.Write(*file_handler, line.c_str(), line.size());
-
-                ++row_count;
-                if (limit_ != 0 && row_count == limit_) {
-                    return row_count;
-                }
             }
+            encoded_parts.emplace_back(part_range.part_no_, CompressExportChunk(compression_type_, std::move(lines)));
         }
-    }
+        return encoded_parts;
+    };
+    auto write = [&](EncodedParts &encoded_parts) {
+        for (auto &[part_no, chunk] : encoded_parts) {
+            file_writer.Write(part_no, chunk);
+        }
+    };
+
+    Vector<ExportBlockRange> block_ranges = PlanBlockRanges();
+    RunExportPipeline<EncodedParts>(block_ranges, encode, write);
+
+    SizeT row_count = block_ranges.empty() ? 0 : block_ranges.back().export_row_begin_ + block_ranges.back().row_end_ - block_ranges.back().row_begin_;
     LOG_DEBUG(fmt::format("Export to CSV, db {}, table {}, file: {}, row: {}", schema_name_, table_name_, file_path_, row_count));
     return row_count;
 }
 
 SizeT PhysicalExport::ExportToJSONL(QueryContext *query_context, ExportOperatorState *export_op_state) {
-
     const Vector<SharedPtr<ColumnDef>> &column_defs = table_entry_->column_defs();
-
-    Vector<ColumnID> select_columns;
-    // export all columns or export specific column index
-    if (column_idx_array_.empty()) {
-        SizeT column_count = column_defs.size();
-        select_columns.reserve(column_count);
-        for (ColumnID idx = 0; idx < column_count; ++idx) {
-            select_columns.emplace_back(idx);
-        }
-    } else {
-        select_columns = column_idx_array_;
-    }
-
+    Vector<ColumnID> select_columns = SelectColumns();
     SizeT select_column_count = select_columns.size();
 
-    LocalFileSystem fs;
-    auto [file_handler, status] = fs.OpenFile(file_path_, FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG, FileLockType::kWriteLock);
-    if (!status.ok()) {
-        RecoverableError(status);
-    }
-    DeferFn file_defer([&]() { fs.Close(*file_handler); });
+    ExportFileWriter file_writer(file_path_);
 
-    SizeT offset = offset_;
-    SizeT row_count{0};
-    SizeT file_no_{0};
-    Map<SegmentID, SegmentSnapshot> &segment_block_index_ref = block_index_->segment_block_index_;
     BufferManager *buffer_manager = query_context->storage()->buffer_manager();
-    LOG_DEBUG(fmt::format("Going to export segment count: {}", segment_block_index_ref.size()));
-    for (auto &[segment_id, segment_snapshot] : segment_block_index_ref) {
-        SizeT block_count = segment_snapshot.block_map_.size();
-        LOG_DEBUG(fmt::format("Export segment_id: {}, with block count: {}", segment_id, block_count));
-        for (SizeT block_idx = 0; block_idx < block_count; ++block_idx) {
-            LOG_DEBUG(fmt::format("Export block_idx: {}", block_idx));
-            BlockEntry *block_entry = segment_snapshot.block_map_[block_idx];
-            SizeT block_row_count = block_entry->row_count();
-
-            Vector<ColumnVector> column_vectors;
-            column_vectors.reserve(select_column_count);
-
-            for (ColumnID block_column_idx = 0; block_column_idx < select_column_count; ++block_column_idx) {
-                ColumnID select_column_idx = select_columns[block_column_idx];
-                switch (select_column_idx) {
-                    case COLUMN_IDENTIFIER_ROW_ID: {
-                        u16 block_id = block_entry->block_id();
-                        u32 segment_offset = block_id * DEFAULT_BLOCK_CAPACITY;
-                        auto column_vector = ColumnVector(MakeShared<DataType>(LogicalType::kRowID));
-                        column_vector.Initialize();
-                        column_vector.AppendWith(RowID(segment_id, segment_offset), block_row_count);
-                        column_vectors.emplace_back(column_vector);
-                        break;
-                    }
-                    case COLUMN_IDENTIFIER_CREATE: {
-                        ColumnVector column_vector = block_entry->GetCreateTSVector(buffer_manager, 0, block_row_count);
-                        column_vectors.emplace_back(column_vector);
-                        break;
-                    }
-                    case COLUMN_IDENTIFIER_DELETE: {
-                        ColumnVector column_vector = block_entry->GetDeleteTSVector(buffer_manager, 0, block_row_count);
-                        column_vectors.emplace_back(column_vector);
-                        break;
-                    }
-                    default: {
-                        column_vectors.emplace_back(block_entry->GetColumnBlockEntry(select_column_idx)->GetConstColumnVector(buffer_manager));
-                        if (column_vectors[block_column_idx].Size() != block_row_count) {
-                            String error_message = "Unmatched row_count between block and block_column";
-                            UnrecoverableError(error_message);
-                        }
-                    }
-                }
-            }
-
-            for (SizeT row_idx = 0; row_idx < block_row_count; ++row_idx) {
-                // TODO: Need to check visibility
-                if (offset > 0) {
-                    --offset;
-                    continue;
-                }
+    using EncodedParts = Vector<Pair<SizeT, String>>;
+    auto encode = [&](const ExportBlockRange &block_range) {
+        Vector<ColumnVector> column_vectors = LoadBlockColumns(block_range, select_columns, buffer_manager);
+        EncodedParts encoded_parts;
+        for (const ExportPartRange &part_range : SplitByPart(block_range)) {
+            String lines;
+            for (SizeT row_idx = part_range.row_begin_; row_idx < part_range.row_end_; ++row_idx) {
                 nlohmann::json line_json;
                 for (ColumnID block_column_idx = 0; block_column_idx < select_column_count; ++block_column_idx) {
                     ColumnID select_column_idx = select_columns[block_column_idx];
+                    Value v = column_vectors[block_column_idx].GetValue(row_idx);
                     switch (select_column_idx) {
                         case COLUMN_IDENTIFIER_ROW_ID: {
-                            Value v = column_vectors[block_column_idx].GetValue(row_idx);
                             v.AppendToJson("_row_id", line_json);
                             break;
                         }
                         case COLUMN_IDENTIFIER_CREATE: {
-                            Value v = column_vectors[block_column_idx].GetValue(row_idx);
                             v.AppendToJson("_create_timestamp", line_json);
                             break;
                         }
                         case COLUMN_IDENTIFIER_DELETE: {
-                            Value v = column_vectors[block_column_idx].GetValue(row_idx);
                             v.AppendToJson("_delete_timestamp", line_json);
                             break;
                         }
                         default: {
                             ColumnDef *column_def = column_defs[select_column_idx].get();
-                            Value v = column_vectors[block_column_idx].GetValue(row_idx);
                             v.AppendToJson(column_def->name(), line_json);
                         }
                     }
                 }
-                if (row_count > 0 && this->row_limit_ != 0 && (row_count % this->row_limit_) == 0) {
-                    ++file_no_;
-                    fs.Close(*file_handler);
-                    String new_file_path = fmt::format("{}.part{}", file_path_, file_no_);
-                    auto result = fs.OpenFile(new_file_path, FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG, FileLockType::kWriteLock);
-                    if (!result.second.ok()) {
-                        RecoverableError(result.second);
-                    }
-                    file_handler = std::move(result.first);
-                }
-
-                // LOG_DEBUG(line_json.dump());
-                String to_write = line_json.dump() + "\n";
-                fs.Write(*file_handler, to_write.c_str(), to_write.size());
-                ++row_count;
-                if (limit_ != 0 && row_count == limit_) {
-                    return row_count;
-                }
+                lines += line_json.dump();
+                lines += "\n";
             }
+            encoded_parts.emplace_back(part_range.part_no_, CompressExportChunk(compression_type_, std::move(lines)));
         }
-    }
+        return encoded_parts;
+    };
+    auto write = [&](EncodedParts &encoded_parts) {
+        for (auto &[part_no, chunk] : encoded_parts) {
+            file_writer.Write(part_no, chunk);
+        }
+    };
+
+    Vector<ExportBlockRange> block_ranges = PlanBlockRanges();
+    LOG_DEBUG(fmt::format("Going to export block count: {}", block_ranges.size()));
+    RunExportPipeline<EncodedParts>(block_ranges, encode, write);
+
+    SizeT row_count = block_ranges.empty() ? 0 : block_ranges.back().export_row_begin_ + block_ranges.back().row_end_ - block_ranges.back().row_begin_;
     LOG_DEBUG(fmt::format("Export to JSONL, db {}, table {}, file: {}, row: {}", schema_name_, table_name_, file_path_, row_count));
     return row_count;
 }
@@ -398,82 +632,46 @@ SizeT PhysicalExport::ExportToFVECS(QueryContext *query_context, ExportOperatorS
     }
 
     i32 dimension = embedding_type_info->Dimension();
+    SizeT embedding_size = embedding_type_info->Size();
 
-    LocalFileSystem fs;
-    auto [file_handler, status] = fs.OpenFile(file_path_, FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG, FileLockType::kWriteLock);
-    if (!status.ok()) {
-        RecoverableError(status);
-    }
-    DeferFn file_defer([&]() { fs.Close(*file_handler); });
+    ExportFileWriter file_writer(file_path_);
 
-    SizeT offset = offset_;
-    SizeT row_count{0};
-    SizeT file_no_{0};
-    Map<SegmentID, SegmentSnapshot> &segment_block_index_ref = block_index_->segment_block_index_;
     BufferManager *buffer_manager = query_context->storage()->buffer_manager();
-    // Write header
-    LOG_DEBUG(fmt::format("Going to export segment count: {}", segment_block_index_ref.size()));
-    for (auto &[segment_id, segment_snapshot] : segment_block_index_ref) {
-        SizeT block_count = segment_snapshot.block_map_.size();
-        LOG_DEBUG(fmt::format("Export segment_id: {}, with block count: {}", segment_id, block_count));
-        for (SizeT block_idx = 0; block_idx < block_count; ++block_idx) {
-            LOG_DEBUG(fmt::format("Export block_idx: {}", block_idx));
-            BlockEntry *block_entry = segment_snapshot.block_map_[block_idx];
-            SizeT block_row_count = block_entry->row_count();
-
-            ColumnVector exported_column_vector = block_entry->GetColumnBlockEntry(exported_column_idx)->GetConstColumnVector(buffer_manager);
-            if (exported_column_vector.Size() != block_row_count) {
-                String error_message = "Unmatched row_count between block and block_column";
-                UnrecoverableError(error_message);
+    Vector<ColumnID> select_columns{exported_column_idx};
+    using EncodedParts = Vector<Pair<SizeT, String>>;
+    auto encode = [&](const ExportBlockRange &block_range) {
+        Vector<ColumnVector> column_vectors = LoadBlockColumns(block_range, select_columns, buffer_manager);
+        const char *embedding_data = reinterpret_cast<const char *>(column_vectors[0].data());
+        EncodedParts encoded_parts;
+        for (const ExportPartRange &part_range : SplitByPart(block_range)) {
+            String vecs;
+            vecs.reserve((part_range.row_end_ - part_range.row_begin_) * (sizeof(dimension) + embedding_size));
+            for (SizeT row_idx = part_range.row_begin_; row_idx < part_range.row_end_; ++row_idx) {
+                vecs.append(reinterpret_cast<const char *>(&dimension), sizeof(dimension));
+                vecs.append(embedding_data + row_idx * embedding_size, embedding_size);
             }
+            encoded_parts.emplace_back(part_range.part_no_, std::move(vecs));
+        }
+        return encoded_parts;
+    };
+    auto write = [&](EncodedParts &encoded_parts) {
+        for (auto &[part_no, chunk] : encoded_parts) {
+            file_writer.Write(part_no, chunk);
+        }
+    };
 
-            for (SizeT row_idx = 0; row_idx < block_row_count; ++row_idx) {
-                if (offset > 0) {
-                    --offset;
-                    continue;
-                }
-
-                Value v = exported_column_vector.GetValue(row_idx);
-                Span<char> embedding = v.GetEmbedding();
-
-                if (row_count > 0 && this->row_limit_ != 0 && (row_count % this->row_limit_) == 0) {
-                    ++file_no_;
-                    fs.Close(*file_handler);
-                    String new_file_path = fmt::format("{}.part{}", file_path_, file_no_);
-                    auto result = fs.OpenFile(new_file_path, FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG, FileLockType::kWriteLock);
-                    if (!result.second.ok()) {
-                        RecoverableError(result.second);
-                    }
-                    file_handler = std::move(result.first);
-                }
+    Vector<ExportBlockRange> block_ranges = PlanBlockRanges();
+    LOG_DEBUG(fmt::format("Going to export block count: {}", block_ranges.size()));
+    RunExportPipeline<EncodedParts>(block_ranges, encode, write);
 
-                fs.Write(*file_handler, &dimension, sizeof(dimension));
-                fs.Write(*file_handler, embedding.data(), embedding.size_bytes());
-                ++row_count;
-                if (limit_ != 0 && row_count == limit_) {
-                    return row_count;
-                }
-            }
-        }
-    }
+    SizeT row_count = block_ranges.empty() ? 0 : block_ranges.back().export_row_begin_ + block_ranges.back().row_end_ - block_ranges.back().row_begin_;
     LOG_DEBUG(fmt::format("Export to FVECS, db {}, table {}, file: {}, row: {}", schema_name_, table_name_, file_path_, row_count));
     return row_count;
 }
 
 SizeT PhysicalExport::ExportToPARQUET(QueryContext *query_context, ExportOperatorState *export_op_state) {
     const Vector<SharedPtr<ColumnDef>> &column_defs = table_entry_->column_defs();
-    Vector<ColumnID> select_columns;
-    // export all columns or export specific column index
-    if (column_idx_array_.empty()) {
-        SizeT column_count = column_defs.size();
-        select_columns.reserve(column_count);
-        for (ColumnID idx = 0; idx < column_count; ++idx) {
-            select_columns.emplace_back(idx);
-        }
-    } else {
-        select_columns = column_idx_array_;
-    }
-
+    Vector<ColumnID> select_columns = SelectColumns();
     SizeT select_column_count = select_columns.size();
 
     Vector<SharedPtr<arrow::Field>> fields;
@@ -485,84 +683,62 @@ SizeT PhysicalExport::ExportToPARQUET(QueryContext *query_context, ExportOperato
 
     arrow::MemoryPool *pool = arrow::DefaultMemoryPool();
     SharedPtr<arrow::Schema> schema = ::arrow::schema(std::move(fields));
-    SharedPtr<::arrow::io::FileOutputStream> file_stream;
     SharedPtr<::parquet::arrow::FileWriter> file_writer;
+    SizeT part_no{0};
 
-    file_stream = ::arrow::io::FileOutputStream::Open(file_path_, pool).ValueOrDie();
-    file_writer = ::parquet::arrow::FileWriter::Open(*schema, pool, file_stream, ::parquet::default_writer_properties()).ValueOrDie();
+    auto open_file = [&](const String &path) {
+        auto file_stream = ::arrow::io::FileOutputStream::Open(path, pool).ValueOrDie();
+        file_writer = ::parquet::arrow::FileWriter::Open(*schema, pool, file_stream, ::parquet::default_writer_properties()).ValueOrDie();
+    };
+    auto close_file = [&]() {
+        auto status = file_writer->Close();
+        if (!status.ok()) {
+            String error_message = fmt::format("Failed to close parquet file: {}", status.message());
+            LOG_CRITICAL(error_message);
+            UnrecoverableError(error_message);
+        }
+    };
+    open_file(file_path_);
 
-    SizeT row_count{0};
-    Map<SegmentID, SegmentSnapshot> &segment_block_index_ref = block_index_->segment_block_index_;
     BufferManager *buffer_manager = query_context->storage()->buffer_manager();
-    for (auto &[segment_id, segment_snapshot] : segment_block_index_ref) {
-        SizeT block_count = segment_snapshot.block_map_.size();
-        LOG_DEBUG(fmt::format("Export segment_id: {}, with block count: {}", segment_id, block_count));
-        for (SizeT block_idx = 0; block_idx < block_count; ++block_idx) {
-            LOG_DEBUG(fmt::format("Export block_idx: {}", block_idx));
-            BlockEntry *block_entry = segment_snapshot.block_map_[block_idx];
-            SizeT block_row_count = block_entry->row_count();
-
-            Vector<ColumnVector> column_vectors;
-            column_vectors.reserve(select_column_count);
-
-            for (ColumnID block_column_idx = 0; block_column_idx < select_column_count; ++block_column_idx) {
-                ColumnID select_column_idx = select_columns[block_column_idx];
-                switch (select_column_idx) {
-                    case COLUMN_IDENTIFIER_ROW_ID: {
-                        u16 block_id = block_entry->block_id();
-                        u32 segment_offset = block_id * DEFAULT_BLOCK_CAPACITY;
-                        auto column_vector = ColumnVector(MakeShared<DataType>(LogicalType::kRowID));
-                        column_vector.Initialize();
-                        column_vector.AppendWith(RowID(segment_id, segment_offset), block_row_count);
-                        column_vectors.emplace_back(column_vector);
-                        break;
-                    }
-                    case COLUMN_IDENTIFIER_CREATE: {
-                        ColumnVector column_vector = block_entry->GetCreateTSVector(buffer_manager, 0, block_row_count);
-                        column_vectors.emplace_back(column_vector);
-                        break;
-                    }
-                    case COLUMN_IDENTIFIER_DELETE: {
-                        ColumnVector column_vector = block_entry->GetDeleteTSVector(buffer_manager, 0, block_row_count);
-                        column_vectors.emplace_back(column_vector);
-                        break;
-                    }
-                    default: {
-                        column_vectors.emplace_back(block_entry->GetColumnBlockEntry(select_column_idx)->GetConstColumnVector(buffer_manager));
-                        if (column_vectors[block_column_idx].Size() != block_row_count) {
-                            String error_message = "Unmatched row_count between block and block_column";
-                            LOG_CRITICAL(error_message);
-                            UnrecoverableError(error_message);
-                        }
-                    }
-                }
-            }
-
+    // Each part range of a block becomes one row group, built from the column buffers on the export workers.
+    using EncodedBatches = Vector<Pair<SizeT, SharedPtr<arrow::RecordBatch>>>;
+    auto encode = [&](const ExportBlockRange &block_range) {
+        Vector<ColumnVector> column_vectors = LoadBlockColumns(block_range, select_columns, buffer_manager);
+        EncodedBatches encoded_batches;
+        for (const ExportPartRange &part_range : SplitByPart(block_range)) {
             Vector<SharedPtr<arrow::Array>> block_arrays;
+            block_arrays.reserve(select_column_count);
             for (ColumnID block_column_idx = 0; block_column_idx < select_column_count; ++block_column_idx) {
-                ColumnID select_column_idx = select_columns[block_column_idx];
-                ColumnDef *column_def = column_defs[select_column_idx].get();
-                ColumnVector &column_vector = column_vectors[block_column_idx];
-                block_arrays.emplace_back(BuildArrowArray(column_def, column_vector));
+                ColumnDef *column_def = column_defs[select_columns[block_column_idx]].get();
+                block_arrays.emplace_back(BuildArrowArray(column_def, column_vectors[block_column_idx], part_range.row_begin_, part_range.row_end_));
+            }
+            SizeT batch_row_count = part_range.row_end_ - part_range.row_begin_;
+            encoded_batches.emplace_back(part_range.part_no_, arrow::RecordBatch::Make(schema, batch_row_count, std::move(block_arrays)));
+        }
+        return encoded_batches;
+    };
+    auto write = [&](EncodedBatches &encoded_batches) {
+        for (auto &[batch_part_no, block_batch] : encoded_batches) {
+            if (batch_part_no != part_no) {
+                close_file();
+                part_no = batch_part_no;
+                open_file(fmt::format("{}.part{}", file_path_, part_no));
             }
-
-            SharedPtr<arrow::RecordBatch> block_batch = arrow::RecordBatch::Make(schema, block_row_count, block_arrays);
             auto status = file_writer->WriteRecordBatch(*block_batch);
             if (!status.ok()) {
                 String error_message = fmt::format("Failed to write record batch to parquet file: {}", status.message());
                 LOG_CRITICAL(error_message);
                 UnrecoverableError(error_message);
             }
-            row_count += block_row_count;
         }
-    }
+    };
 
-    auto status = file_writer->Close();
-    if (!status.ok()) {
-        String error_message = fmt::format("Failed to close parquet file: {}", status.message());
-        LOG_CRITICAL(error_message);
-        UnrecoverableError(error_message);
-    }
+    Vector<ExportBlockRange> block_ranges = PlanBlockRanges();
+    RunExportPipeline<EncodedBatches>(block_ranges, encode, write);
+    close_file();
+
+    SizeT row_count = block_ranges.empty() ? 0 : block_ranges.back().export_row_begin_ + block_ranges.back().row_end_ - block_ranges.back().row_begin_;
     LOG_DEBUG(fmt::format("Export to PARQUET, db {}, table {}, file: {}, row: {}", schema_name_, table_name_, file_path_, row_count));
     return row_count;
 }
@@ -767,7 +943,7 @@ SharedPtr<arrow::DataType> PhysicalExport::GetArrowType(ColumnDef *column_def) {
     return nullptr;
 }
 
-SharedPtr<arrow::Array> PhysicalExport::BuildArrowArray(ColumnDef *column_def, const ColumnVector &column_vector) {
+SharedPtr<arrow::Array> PhysicalExport::BuildArrowArray(ColumnDef *column_def, const ColumnVector &column_vector, SizeT row_begin, SizeT row_end) {
     SharedPtr<arrow::ArrayBuilder> array_builder = nullptr;
     auto &column_type = column_def->type();
 
@@ -1012,9 +1188,11 @@ SharedPtr<arrow::Array> PhysicalExport::BuildArrowArray(ColumnDef *column_def, c
         }
     }
 
-    for (SizeT i = 0; i < column_vector.Size(); ++i) {
-        auto value = column_vector.GetValue(i);
-        value.AppendToArrowArray(column_type, array_builder);
+    if (!AppendColumnVectorToArrow(*column_type, column_vector, row_begin, row_end, array_builder.get())) {
+        for (SizeT i = row_begin; i < row_end; ++i) {
+            auto value = column_vector.GetValue(i);
+            value.AppendToArrowArray(column_type, array_builder);
+        }
     }
 
     SharedPtr<arrow::Array> array;
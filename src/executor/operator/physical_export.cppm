@@ -33,9 +33,27 @@ import logger;
 import third_party;
 import column_def;
 import column_vector;
+import block_entry;
+import buffer_manager;
 
 namespace infinity {
 
+// Rows [row_begin_, row_end_) of a block; the first one is the export_row_begin_-th exported row.
+struct ExportBlockRange {
+    SegmentID segment_id_{};
+    BlockEntry *block_entry_{};
+    SizeT row_begin_{};
+    SizeT row_end_{};
+    SizeT export_row_begin_{};
+};
+
+// Rows [row_begin_, row_end_) of a block range that go to the part_no_-th output file.
+struct ExportPartRange {
+    SizeT part_no_{};
+    SizeT row_begin_{};
+    SizeT row_end_{};
+};
+
 export class PhysicalExport : public PhysicalOperator {
 public:
     explicit PhysicalExport(u64 id,
@@ -49,11 +67,13 @@ public:
                             SizeT offset,
                             SizeT limit,
                             SizeT row_limit,
+                            CopyCompressionType compression_type,
                             Vector<u64> column_idx_array,
                             SharedPtr<BlockIndex> block_index,
                             SharedPtr<Vector<LoadMeta>> load_metas)
         : PhysicalOperator(PhysicalOperatorType::kExport, nullptr, nullptr, id, load_metas), table_entry_(table_entry), file_type_(type), file_path_(std::move(file_path)),
-          table_name_(std::move(table_name)), schema_name_(std::move(schema_name)), header_(header), delimiter_(delimiter), offset_(offset), limit_(limit), row_limit_(row_limit), column_idx_array_(std::move(column_idx_array)), block_index_(std::move(block_index)) {}
+          table_name_(std::move(table_name)), schema_name_(std::move(schema_name)), header_(header), delimiter_(delimiter), offset_(offset), limit_(limit), row_limit_(row_limit), compression_type_(compression_type),
+          column_idx_array_(std::move(column_idx_array)), block_index_(std::move(block_index)) {}
 
     ~PhysicalExport() override = default;
 
@@ -91,10 +111,22 @@ public:
 
     inline char delimiter() const { return delimiter_; }
 
+    inline CopyCompressionType compression_type() const { return compression_type_; }
+
 private:
+    Vector<ColumnID> SelectColumns() const;
+
+    // Split the snapshot into per-block row ranges, with offset and limit applied.
+    Vector<ExportBlockRange> PlanBlockRanges() const;
+
+    // Split a block range at the row_limit boundaries of the part files.
+    Vector<ExportPartRange> SplitByPart(const ExportBlockRange &block_range) const;
+
+    Vector<ColumnVector> LoadBlockColumns(const ExportBlockRange &block_range, const Vector<ColumnID> &select_columns, BufferManager *buffer_manager) const;
+
     SharedPtr<arrow::DataType> GetArrowType(ColumnDef *column_def);
 
-    SharedPtr<arrow::Array> BuildArrowArray(ColumnDef *column_def, const ColumnVector &column_vectors);
+    SharedPtr<arrow::Array> BuildArrowArray(ColumnDef *column_def, const ColumnVector &column_vector, SizeT row_begin, SizeT row_end);
 
 private:
     SharedPtr<Vector<String>> output_names_{};
@@ -110,6 +142,7 @@ private:
     SizeT offset_{};
     SizeT limit_{};
     SizeT row_limit_{};
+    CopyCompressionType compression_type_{CopyCompressionType::kNone};
     Vector<u64> column_idx_array_;
     SharedPtr<BlockIndex> block_index_{};
 };
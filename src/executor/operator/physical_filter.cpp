@@ -27,6 +27,7 @@ import operator_state;
 import expression_state;
 import expression_selector;
 import data_block;
+import selection;
 import logger;
 import third_party;
 
@@ -67,18 +68,29 @@ bool PhysicalFilter::Execute(QueryContext *, OperatorState *operator_state) {
     SizeT input_block_count = prev_op_state->data_block_array_.size();
 
     for(SizeT block_idx = 0; block_idx < input_block_count; ++ block_idx) {
-
-        // create uninitialized data block for output
-        UniquePtr<DataBlock> data_block = DataBlock::MakeUniquePtr();
-        DataBlock* output_data_block = data_block.get();
-        operator_state->data_block_array_.emplace_back(std::move(data_block));
-
         SharedPtr<ExpressionState> condition_state = ExpressionState::CreateState(condition_);
-        DataBlock* input_data_block = prev_op_state->data_block_array_[block_idx].get();
+        UniquePtr<DataBlock> &input_data_block = prev_op_state->data_block_array_[block_idx];
+        SizeT input_row_count = input_data_block->row_count();
 
         // selector contains a pointer to input data, which should not be shared by multiple tasks
         ExpressionSelector selector;
-        SizeT selected_count = selector.Select(condition_, condition_state, input_data_block, output_data_block, input_data_block->row_count());
+        SharedPtr<Selection> selection = MakeShared<Selection>();
+        selection->Initialize(input_row_count);
+        selector.Select(condition_, condition_state, input_data_block.get(), input_row_count, selection);
+        SizeT selected_count = selection->Size();
+
+        if (selected_count == input_row_count) {
+            // All rows pass the filter, the input block is the output
+            operator_state->data_block_array_.emplace_back(std::move(input_data_block));
+        } else {
+            UniquePtr<DataBlock> output_data_block = DataBlock::MakeUniquePtr();
+            if (output_selection_ && selected_count * 100 >= input_row_count * kCompactSelectivityPercent) {
+                output_data_block->InitWithSelection(input_data_block.get(), std::move(selection));
+            } else {
+                output_data_block->Init(input_data_block.get(), selection);
+            }
+            operator_state->data_block_array_.emplace_back(std::move(output_data_block));
+        }
 
         LOG_TRACE(fmt::format("{} rows after filter", selected_count));
     }
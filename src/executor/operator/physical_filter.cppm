@@ -50,8 +50,17 @@ public:
 
     inline const SharedPtr<BaseExpression> &condition() const { return condition_; }
 
+    // Set by the planner when the parent operator reads the output blocks through their selection
+    inline void SetOutputSelection(bool output_selection) { output_selection_ = output_selection; }
+
+    inline bool output_selection() const { return output_selection_; }
+
+    // Below this percentage of selected rows, the selected rows are copied into a dense block anyway
+    static constexpr SizeT kCompactSelectivityPercent = 25;
+
 private:
     SharedPtr<BaseExpression> condition_;
+    bool output_selection_{false};
 
     SharedPtr<DataTable> input_table_{};
 };
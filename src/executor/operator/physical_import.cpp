@@ -22,6 +22,8 @@ module;
 #include <cerrno>
 #include <cstdio>
 #include <cstring>
+#include <exception>
+#include <future>
 
 #include <vector>
 
@@ -66,6 +68,7 @@ import catalog_delta_entry;
 import build_fast_rough_filter_task;
 import stream_io;
 import parser_assert;
+import infinity_context;
 
 namespace infinity {
 
@@ -475,6 +478,11 @@ void PhysicalImport::ImportCSR(QueryContext *query_context, ImportOperatorState
 }
 
 void PhysicalImport::ImportCSV(QueryContext *query_context, ImportOperatorState *import_op_state) {
+    if (Vector<ImportRange> ranges = SplitImportFile(true); !ranges.empty()) {
+        ImportRangesParallel(query_context, import_op_state, ranges);
+        return;
+    }
+
     // opts, parser and parser_context points to each other.
     // opt -> parser_context
     // parser->opt
@@ -563,6 +571,11 @@ void PhysicalImport::ImportCSV(QueryContext *query_context, ImportOperatorState
 }
 
 void PhysicalImport::ImportJSONL(QueryContext *query_context, ImportOperatorState *import_op_state) {
+    if (Vector<ImportRange> ranges = SplitImportFile(false); !ranges.empty()) {
+        ImportRangesParallel(query_context, import_op_state, ranges);
+        return;
+    }
+
     StreamIO stream_io;
     stream_io.Init(file_path_, FileFlags::READ_FLAG);
     DeferFn file_defer([&]() { stream_io.Close(); });
@@ -579,17 +592,25 @@ void PhysicalImport::ImportJSONL(QueryContext *query_context, ImportOperatorStat
     }
 
     SizeT row_count{0};
+    SizeT line_number{0};
     while (true) {
         String json_str;
         if (stream_io.ReadLine(json_str)) {
-            nlohmann::json line_json = nlohmann::json::parse(json_str);
-            try {
-                JSONLRowHandler(line_json, column_vectors);
-            } catch (const RecoverableException &e) {
+            ++line_number;
+            auto cleanup = [&]() {
                 column_vectors.clear();
                 std::move(*block_entry).Cleanup();
                 std::move(*segment_entry).Cleanup();
+            };
+            try {
+                nlohmann::json line_json = nlohmann::json::parse(json_str);
+                JSONLRowHandler(line_json, column_vectors);
+            } catch (const RecoverableException &e) {
+                cleanup();
                 throw;
+            } catch (const nlohmann::json::exception &e) {
+                cleanup();
+                RecoverableError(Status::InvalidJsonFormat(fmt::format("{} line {}: {}", file_path_, line_number, e.what())));
             }
             block_entry->IncreaseRowCount(1);
             ++row_count;
@@ -632,6 +653,407 @@ void PhysicalImport::ImportJSONL(QueryContext *query_context, ImportOperatorStat
     import_op_state->result_msg_ = std::move(result_msg);
 }
 
+namespace {
+
+// Byte range of the import file handed to zsv as its input stream.
+struct ImportRangeStream {
+    FILE *fp_{};
+    SizeT remaining_{};
+};
+
+size_t ReadImportRange(void *buffer, size_t n, size_t size, void *stream) {
+    auto *range_stream = static_cast<ImportRangeStream *>(stream);
+    SizeT to_read = std::min(n * size, range_stream->remaining_);
+    SizeT read_n = fread(buffer, 1, to_read, range_stream->fp_);
+    range_stream->remaining_ -= read_n;
+    return read_n / n;
+}
+
+// Quote and newline counts of a chunk, and the first newline after an even / odd number of quotes from the chunk start
+// with the number of newlines before it.
+struct ImportChunkScan {
+    SizeT quote_count_{};
+    SizeT newline_count_{};
+    Optional<SizeT> newline_pos_[2]{};
+    SizeT newline_rank_[2]{};
+};
+
+ImportChunkScan ScanImportChunk(const String &file_path, SizeT begin, SizeT end, bool quoted) {
+    FILE *fp = fopen(file_path.c_str(), "rb");
+    if (!fp) {
+        UnrecoverableError(strerror(errno));
+    }
+    DeferFn file_defer([&]() { fclose(fp); });
+    fseeko(fp, begin, SEEK_SET);
+
+    ImportChunkScan scan;
+    Vector<char> buffer(DEFAULT_IMPORT_READ_BUFFER_SIZE);
+    for (SizeT pos = begin; pos < end;) {
+        SizeT read_n = fread(buffer.data(), 1, std::min(buffer.size(), end - pos), fp);
+        if (read_n == 0) {
+            break;
+        }
+        for (SizeT i = 0; i < read_n; ++i) {
+            if (quoted && buffer[i] == '"') {
+                ++scan.quote_count_;
+            } else if (buffer[i] == '\n') {
+                if (!scan.newline_pos_[scan.quote_count_ % 2].has_value()) {
+                    scan.newline_pos_[scan.quote_count_ % 2] = pos + i;
+                    scan.newline_rank_[scan.quote_count_ % 2] = scan.newline_count_;
+                }
+                ++scan.newline_count_;
+            }
+        }
+        pos += read_n;
+    }
+    return scan;
+}
+
+void CleanupParsedSegments(Vector<SharedPtr<SegmentEntry>> &segments) {
+    for (auto &segment_entry : segments) {
+        std::move(*segment_entry).Cleanup();
+    }
+    segments.clear();
+}
+
+} // namespace
+
+Atomic<SizeT> PhysicalImport::import_range_min_size_{DEFAULT_IMPORT_RANGE_MIN_SIZE};
+
+Vector<ImportRange> PhysicalImport::SplitImportFile(bool quoted) const {
+    LocalFileSystem fs;
+    auto [file_handler, status] = fs.OpenFile(file_path_, FileFlags::READ_FLAG, FileLockType::kReadLock);
+    if (!status.ok()) {
+        RecoverableError(status);
+    }
+    SizeT file_size = fs.GetFileSize(*file_handler);
+    fs.Close(*file_handler);
+
+    ThreadPool &thread_pool = InfinityContext::instance().GetImportThreadPool();
+    SizeT range_count = std::min(SizeT(thread_pool.size()), file_size / ImportRangeMinSize());
+    if (range_count <= 1) {
+        return {};
+    }
+
+    // Find where records start near each split point. A newline only ends a CSV record outside a quoted field, which
+    // depends on the quotes before it: scan the chunks concurrently for both parities, then resolve them in order.
+    // The newlines of a range, plus its last record when the file doesn't end with one, bound the records of the range.
+    Vector<std::future<ImportChunkScan>> futs;
+    futs.reserve(range_count);
+    for (SizeT i = 0; i < range_count; ++i) {
+        SizeT begin = file_size * i / range_count;
+        SizeT end = file_size * (i + 1) / range_count;
+        futs.emplace_back(thread_pool.push([file_path = file_path_, begin, end, quoted](int) { return ScanImportChunk(file_path, begin, end, quoted); }));
+    }
+
+    // record boundaries, with the number of newlines before each
+    Vector<Pair<SizeT, SizeT>> boundaries{{0, 0}};
+    SizeT quote_count{0};
+    SizeT newline_count{0};
+    for (SizeT i = 0; i < range_count; ++i) {
+        ImportChunkScan scan = futs[i].get();
+        // A chunk without a record boundary is merged into the previous range
+        const SizeT parity = quote_count % 2;
+        if (const auto &newline_pos = scan.newline_pos_[parity]; i > 0 && newline_pos.has_value() && *newline_pos + 1 < file_size) {
+            boundaries.emplace_back(*newline_pos + 1, newline_count + scan.newline_rank_[parity] + 1);
+        }
+        quote_count += scan.quote_count_;
+        newline_count += scan.newline_count_;
+    }
+    boundaries.emplace_back(file_size, newline_count);
+    if (boundaries.size() <= 2) {
+        return {};
+    }
+
+    Vector<ImportRange> ranges;
+    for (SizeT i = 0; i + 1 < boundaries.size(); ++i) {
+        ranges.push_back({boundaries[i].first, boundaries[i + 1].first, boundaries[i + 1].second - boundaries[i].second + 1, boundaries[i].second + 1});
+    }
+    return ranges;
+}
+
+void PhysicalImport::ImportRangesParallel(QueryContext *query_context, ImportOperatorState *import_op_state, const Vector<ImportRange> &ranges) {
+    Txn *txn = query_context->GetTxn();
+    ThreadPool &thread_pool = InfinityContext::instance().GetImportThreadPool();
+    LOG_INFO(fmt::format("Import {} in {} ranges", file_path_, ranges.size()));
+
+    // Reserving the segment ids of each range up front keeps the segments in file order whichever range finishes first.
+    // A new segment is opened once the previous one is full, hence the one more id than the full segments of the range.
+    Vector<SizeT> segment_counts;
+    SizeT total_segment_count = 0;
+    for (const auto &range : ranges) {
+        segment_counts.push_back(range.max_row_count_ / DEFAULT_SEGMENT_CAPACITY + 1);
+        total_segment_count += segment_counts.back();
+    }
+    const SegmentID first_segment_id = table_entry_->ReserveSegmentIDs(total_segment_count);
+    const SegmentID reserved_end_segment_id = first_segment_id + total_segment_count;
+
+    Vector<std::future<ImportRangeResult>> futs;
+    futs.reserve(ranges.size());
+    SegmentID range_first_segment_id = first_segment_id;
+    for (SizeT i = 0; i < ranges.size(); ++i) {
+        const ImportRange &range = ranges[i];
+        const SegmentID range_end_segment_id = range_first_segment_id + segment_counts[i];
+        futs.emplace_back(thread_pool.push([this, txn, &range, range_first_segment_id, range_end_segment_id](int) {
+            if (file_type_ == CopyFileType::kCSV) {
+                return ImportCSVRange(txn, range.begin_, range.end_, range_first_segment_id, range_end_segment_id);
+            }
+            return ImportJSONLRange(txn, range, range_first_segment_id, range_end_segment_id);
+        }));
+        range_first_segment_id = range_end_segment_id;
+    }
+
+    Vector<ImportRangeResult> results;
+    results.reserve(ranges.size());
+    std::exception_ptr first_error = nullptr;
+    for (auto &fut : futs) {
+        try {
+            results.push_back(fut.get());
+        } catch (...) {
+            if (first_error == nullptr) {
+                first_error = std::current_exception();
+            }
+        }
+    }
+    if (first_error != nullptr) {
+        for (auto &result : results) {
+            CleanupParsedSegments(result.segments_);
+        }
+        // none of the reserved ids is used, give them back unless another import reserved ids after them
+        table_entry_->ReleaseSegmentIDs(first_segment_id, reserved_end_segment_id);
+        std::rethrow_exception(first_error);
+    }
+
+    // The ids the last range didn't use are given back. The records of a range are bounded by its newlines, so the other
+    // ranges only leave ids unused when quoted fields span lines.
+    table_entry_->ReleaseSegmentIDs(results.back().end_segment_id_, reserved_end_segment_id);
+
+    // All ranges are parsed, add their segments to the txn in file order so that they commit together
+    SizeT row_count{0};
+    for (auto &result : results) {
+        row_count += result.row_count_;
+        for (auto &segment_entry : result.segments_) {
+            txn->Import(table_entry_, std::move(segment_entry));
+        }
+    }
+
+    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
+    import_op_state->result_msg_ = std::move(result_msg);
+}
+
+ImportRangeResult PhysicalImport::ImportCSVRange(Txn *txn, SizeT begin, SizeT end, SegmentID first_segment_id, SegmentID end_segment_id) {
+    FILE *fp = fopen(file_path_.c_str(), "rb");
+    if (!fp) {
+        UnrecoverableError(strerror(errno));
+    }
+    DeferFn file_defer([&]() { fclose(fp); });
+    fseeko(fp, begin, SEEK_SET);
+    ImportRangeStream range_stream{fp, end - begin};
+
+    UniquePtr<ZxvParserCtx> parser_context = nullptr;
+    {
+        auto *buffer_mgr = txn->buffer_mgr();
+        SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, first_segment_id, txn);
+        UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), 0, 0, table_entry_->ColumnCount(), txn);
+        Vector<ColumnVector> column_vectors;
+        SizeT column_count = table_entry_->ColumnCount();
+        for (SizeT i = 0; i < column_count; ++i) {
+            auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
+            column_vectors.emplace_back(block_column_entry->GetColumnVector(buffer_mgr));
+        }
+        parser_context = MakeUnique<ZxvParserCtx>(table_entry_, txn, segment_entry, std::move(block_entry), std::move(column_vectors), delimiter_);
+        parser_context->defer_import_ = true;
+        parser_context->next_segment_id_ = first_segment_id + 1;
+        parser_context->end_segment_id_ = end_segment_id;
+    }
+
+    auto opts = MakeUnique<ZsvOpts>();
+    // Only the first range contains the header
+    if (header_ && begin == 0) {
+        opts->row_handler = CSVHeaderHandler;
+    } else {
+        opts->row_handler = CSVRowHandler;
+    }
+    opts->delimiter = delimiter_;
+    opts->stream = &range_stream;
+    opts->read = ReadImportRange;
+    opts->ctx = parser_context.get();
+    opts->buffsize = (1 << 20);
+
+    parser_context->parser_ = ZsvParser(opts.get());
+
+    auto cleanup = [&]() {
+        parser_context->column_vectors_.clear();
+        std::move(*parser_context->block_entry_).Cleanup();
+        std::move(*parser_context->segment_entry_).Cleanup();
+        CleanupParsedSegments(parser_context->parsed_segments_);
+    };
+
+    ZsvStatus csv_parser_status;
+    try {
+        while ((csv_parser_status = parser_context->parser_.ParseMore()) == zsv_status_ok) {
+            ;
+        }
+    } catch (const ParserException &e) {
+        cleanup();
+        throw;
+    } catch (const RecoverableException &e) {
+        cleanup();
+        throw;
+    }
+    parser_context->parser_.Finish();
+
+    if (csv_parser_status != zsv_status_no_more_input) {
+        cleanup();
+        if (parser_context->err_msg_.get() != nullptr) {
+            UnrecoverableError(*parser_context->err_msg_);
+        } else {
+            String err_msg = ZsvParser::ParseStatusDesc(csv_parser_status);
+            UnrecoverableError(err_msg);
+        }
+    }
+
+    { // add the last segment entry
+        auto segment_entry = parser_context->segment_entry_;
+        auto &block_entry = parser_context->block_entry_;
+        if (block_entry->row_count() > 0) {
+            segment_entry->AppendBlockEntry(std::move(block_entry));
+        } else {
+            parser_context->column_vectors_.clear();
+            std::move(*block_entry).Cleanup();
+        }
+        if (segment_entry->row_count() == 0) {
+            parser_context->column_vectors_.clear();
+            std::move(*segment_entry).Cleanup();
+        } else {
+            segment_entry->FlushNewData();
+            parser_context->parsed_segments_.push_back(segment_entry);
+        }
+    }
+
+    LOG_DEBUG(fmt::format("Import CSV range [{}, {}), rows: {}", begin, end, parser_context->row_count_));
+    return {parser_context->row_count_, std::move(parser_context->parsed_segments_), parser_context->next_segment_id_};
+}
+
+ImportRangeResult PhysicalImport::ImportJSONLRange(Txn *txn, const ImportRange &range, SegmentID first_segment_id, SegmentID end_segment_id) {
+    const SizeT begin = range.begin_;
+    const SizeT end = range.end_;
+    FILE *fp = fopen(file_path_.c_str(), "rb");
+    if (!fp) {
+        UnrecoverableError(strerror(errno));
+    }
+    DeferFn file_defer([&]() { fclose(fp); });
+    fseeko(fp, begin, SEEK_SET);
+
+    SegmentID next_segment_id = first_segment_id;
+    auto new_segment_id = [&]() {
+        if (next_segment_id >= end_segment_id) {
+            String error_message = "Segment ids reserved for the import range are used up";
+            UnrecoverableError(error_message);
+        }
+        return next_segment_id++;
+    };
+
+    SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, new_segment_id(), txn);
+    UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), 0, 0, table_entry_->ColumnCount(), txn);
+
+    Vector<ColumnVector> column_vectors;
+    for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
+        auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
+        column_vectors.emplace_back(block_column_entry->GetColumnVector(txn->buffer_mgr()));
+    }
+
+    ImportRangeResult result;
+    // the line being imported, counted in the whole file for error messages
+    SizeT line_number = range.first_line_ - 1;
+    auto import_line = [&](std::string_view json_str) {
+        ++line_number;
+        if (json_str.empty()) {
+            return;
+        }
+        nlohmann::json line_json = nlohmann::json::parse(json_str);
+        JSONLRowHandler(line_json, column_vectors);
+        block_entry->IncreaseRowCount(1);
+        ++result.row_count_;
+
+        if (block_entry->GetAvailableCapacity() <= 0) {
+            segment_entry->AppendBlockEntry(std::move(block_entry));
+            if (segment_entry->Room() <= 0) {
+                segment_entry->FlushNewData();
+                result.segments_.push_back(segment_entry);
+                segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, new_segment_id(), txn);
+            }
+
+            block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), segment_entry->GetNextBlockID(), 0, table_entry_->ColumnCount(), txn);
+            column_vectors.clear();
+            for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
+                auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
+                column_vectors.emplace_back(block_column_entry->GetColumnVector(txn->buffer_mgr()));
+            }
+        }
+    };
+
+    auto cleanup = [&]() {
+        column_vectors.clear();
+        std::move(*block_entry).Cleanup();
+        std::move(*segment_entry).Cleanup();
+        CleanupParsedSegments(result.segments_);
+    };
+
+    try {
+        String pending_line;
+        Vector<char> buffer(DEFAULT_IMPORT_READ_BUFFER_SIZE);
+        for (SizeT pos = begin; pos < end;) {
+            SizeT read_n = fread(buffer.data(), 1, std::min(buffer.size(), end - pos), fp);
+            if (read_n == 0) {
+                String error_message = fmt::format("Failed to read {} at offset {}", file_path_, pos);
+                UnrecoverableError(error_message);
+            }
+            pos += read_n;
+            const char *line_begin = buffer.data();
+            const char *buffer_end = buffer.data() + read_n;
+            while (const char *line_end = static_cast<const char *>(std::memchr(line_begin, '\n', buffer_end - line_begin))) {
+                if (pending_line.empty()) {
+                    import_line(std::string_view(line_begin, line_end - line_begin));
+                } else {
+                    pending_line.append(line_begin, line_end);
+                    import_line(pending_line);
+                    pending_line.clear();
+                }
+                line_begin = line_end + 1;
+            }
+            pending_line.append(line_begin, buffer_end);
+        }
+        if (!pending_line.empty()) {
+            import_line(pending_line);
+        }
+    } catch (const RecoverableException &e) {
+        cleanup();
+        throw;
+    } catch (const nlohmann::json::exception &e) {
+        // malformed json, or a value of the wrong json type for its column
+        cleanup();
+        RecoverableError(Status::InvalidJsonFormat(fmt::format("{} line {}: {}", file_path_, line_number, e.what())));
+    }
+
+    if (block_entry->row_count() == 0) {
+        column_vectors.clear();
+        std::move(*block_entry).Cleanup();
+    } else {
+        segment_entry->AppendBlockEntry(std::move(block_entry));
+    }
+    if (segment_entry->row_count() == 0) {
+        std::move(*segment_entry).Cleanup();
+    } else {
+        segment_entry->FlushNewData();
+        result.segments_.push_back(segment_entry);
+    }
+
+    LOG_DEBUG(fmt::format("Import JSONL range [{}, {}), rows: {}", begin, end, result.row_count_));
+    result.end_segment_id_ = next_segment_id;
+    return result;
+}
+
 void PhysicalImport::ImportJSON(QueryContext *query_context, ImportOperatorState *import_op_state) {
     nlohmann::json json_arr;
     {
@@ -810,8 +1232,13 @@ void PhysicalImport::CSVRowHandler(void *context) {
         // we have already used all space of the segment
         if (segment_entry->Room() <= 0) {
             LOG_DEBUG(fmt::format("Segment {} saved", segment_entry->segment_id()));
-            SaveSegmentData(table_entry, txn, segment_entry);
-            u64 segment_id = Catalog::GetNextSegmentID(parser_context->table_entry_);
+            if (parser_context->defer_import_) {
+                segment_entry->FlushNewData();
+                parser_context->parsed_segments_.push_back(segment_entry);
+            } else {
+                SaveSegmentData(table_entry, txn, segment_entry);
+            }
+            u64 segment_id = parser_context->NextSegmentID();
             segment_entry = SegmentEntry::NewSegmentEntry(table_entry, segment_id, txn);
             parser_context->segment_entry_ = segment_entry;
         }
@@ -53,6 +53,13 @@ public:
     Vector<ColumnVector> column_vectors_{};
     const char delimiter_{};
 
+    // Set when parsing one byte range of a parallel import: full segments are flushed and kept in parsed_segments_, and
+    // the caller imports them in file order once every range is parsed. Segment ids come from [next_segment_id_, end_segment_id_).
+    bool defer_import_{false};
+    Vector<SharedPtr<SegmentEntry>> parsed_segments_{};
+    SegmentID next_segment_id_{};
+    SegmentID end_segment_id_{};
+
 public:
     ZxvParserCtx(TableEntry *table_entry,
                  Txn *txn,
@@ -62,6 +69,32 @@ public:
                  char delimiter)
         : row_count_(0), err_msg_(nullptr), table_entry_(table_entry), txn_(txn), segment_entry_(segment_entry), block_entry_(std::move(block_entry)),
           column_vectors_(std::move(column_vectors)), delimiter_(delimiter) {}
+
+    SegmentID NextSegmentID() {
+        if (!defer_import_) {
+            return table_entry_->GetNextSegmentID();
+        }
+        if (next_segment_id_ >= end_segment_id_) {
+            String error_message = "Segment ids reserved for the import range are used up";
+            UnrecoverableError(error_message);
+        }
+        return next_segment_id_++;
+    }
+};
+
+// Byte range of a parallel import starting at a record boundary, with a bound of its records and the line it starts at.
+struct ImportRange {
+    SizeT begin_{};
+    SizeT end_{};
+    SizeT max_row_count_{};
+    SizeT first_line_{};
+};
+
+// Rows parsed from one byte range of a parallel import, segments already flushed. Segment ids before end_segment_id_ are used.
+struct ImportRangeResult {
+    SizeT row_count_{};
+    Vector<SharedPtr<SegmentEntry>> segments_{};
+    SegmentID end_segment_id_{};
 };
 
 export class PhysicalImport : public PhysicalOperator {
@@ -120,7 +153,22 @@ public:
 
     static void SaveSegmentData(TableEntry *table_entry, Txn *txn, SharedPtr<SegmentEntry> segment_entry);
 
+    // Files of at least two ranges of this size are imported in parallel
+    static SizeT ImportRangeMinSize() { return import_range_min_size_.load(); }
+
+    static void SetImportRangeMinSize(SizeT import_range_min_size) { import_range_min_size_.store(import_range_min_size); }
+
 private:
+    // Split the file into byte ranges starting at record boundaries, one per import worker. Returns an empty vector when
+    // the file is too small to be worth splitting.
+    Vector<ImportRange> SplitImportFile(bool quoted) const;
+
+    void ImportRangesParallel(QueryContext *query_context, ImportOperatorState *import_op_state, const Vector<ImportRange> &ranges);
+
+    ImportRangeResult ImportCSVRange(Txn *txn, SizeT begin, SizeT end, SegmentID first_segment_id, SegmentID end_segment_id);
+
+    ImportRangeResult ImportJSONLRange(Txn *txn, const ImportRange &range, SegmentID first_segment_id, SegmentID end_segment_id);
+
     static void CSVHeaderHandler(void *);
 
     static void CSVRowHandler(void *);
@@ -138,6 +186,8 @@ private:
     String file_path_{};
     bool header_{false};
     char delimiter_{','};
+
+    static Atomic<SizeT> import_range_min_size_;
 };
 
 export SharedPtr<ConstantExpr> BuildConstantExprFromJson(const nlohmann::json &json_object);
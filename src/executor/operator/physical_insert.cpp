@@ -61,8 +61,25 @@ bool PhysicalInsert::Execute(QueryContext *query_context, OperatorState *operato
         output_types.emplace_back(MakeShared<DataType>(data_type));
     }
 
-    SharedPtr<DataBlock> output_block = DataBlock::Make();
-    output_block->Init(output_types);
+    // The rows are streamed into blocks of DEFAULT_BLOCK_CAPACITY, each block is logged as one append of the txn
+    auto *txn = query_context->GetTxn();
+    SizeT inserted_row_count = 0;
+    i64 wal_size = 0;
+    SharedPtr<DataBlock> output_block{};
+    SizeT block_row_count = 0;
+    auto append_block = [&] {
+        output_block->Finalize();
+        // The wal entry of the txn is sized with i32
+        wal_size += output_block->GetSizeInBytes();
+        if (wal_size > INSERT_MAX_WAL_SIZE) {
+            RecoverableError(Status::NotSupport(
+                fmt::format("Insert {} rows larger than {} bytes in WAL, split them into smaller batches", row_count, INSERT_MAX_WAL_SIZE)));
+        }
+        inserted_row_count += block_row_count;
+        txn->Append(table_entry_, output_block);
+        output_block.reset();
+        block_row_count = 0;
+    };
     SharedPtr<DataBlock> output_block_tmp = DataBlock::Make();
     output_block_tmp->Init(output_types);
 
@@ -70,19 +87,25 @@ bool PhysicalInsert::Execute(QueryContext *query_context, OperatorState *operato
     evaluator.Init(nullptr);
     // Each cell's expression of a column may differ. So we have to evaluate each cell instead of column here.
     for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        if (output_block.get() == nullptr) {
+            output_block = DataBlock::Make();
+            output_block->Init(output_types);
+        }
         for (SizeT expr_idx = 0; expr_idx < column_count; ++expr_idx) {
             const SharedPtr<BaseExpression> &expr = value_list_[row_idx][expr_idx];
             SharedPtr<ExpressionState> expr_state = ExpressionState::CreateState(expr);
             evaluator.Execute(expr, expr_state, output_block_tmp->column_vectors[expr_idx]);
         }
         output_block->AppendWith(output_block_tmp);
+        if (++block_row_count == static_cast<SizeT>(DEFAULT_BLOCK_CAPACITY)) {
+            append_block();
+        }
+    }
+    if (output_block.get() != nullptr) {
+        append_block();
     }
-    output_block->Finalize();
-
-    auto *txn = query_context->GetTxn();
-    txn->Append(table_entry_, output_block);
 
-    UniquePtr<String> result_msg = MakeUnique<String>(fmt::format("INSERTED {} Rows", output_block->row_count()));
+    UniquePtr<String> result_msg = MakeUnique<String>(fmt::format("INSERTED {} Rows", inserted_row_count));
     if (operator_state == nullptr) {
         // Generate the result table
         Vector<SharedPtr<ColumnDef>> column_defs;
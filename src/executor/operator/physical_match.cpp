@@ -80,6 +80,13 @@ public:
     bool Next(RowID doc_id) override {
         bool ok = false;
         while (1) {
+            if (common_query_filter_ != nullptr) {
+                // seek over segments pruned by the filter instead of decoding their postings
+                doc_id = common_query_filter_->NextCandidate(doc_id);
+                if (doc_id == INVALID_ROWID) {
+                    break;
+                }
+            }
             ok = query_iterator_->Next(doc_id);
             if (!ok) {
                 break;
@@ -103,7 +110,9 @@ public:
     void PrintTree(std::ostream &os, const String &prefix, bool is_final) const override {
         os << prefix;
         os << (is_final ? "└──" : "├──");
-        os << "FilterIterator (fake_doc_freq: " << common_query_filter_->filter_result_count_ << ") (secondary_index_filter: ";
+        os << "FilterIterator (fake_doc_freq: " << common_query_filter_->filter_result_count_
+           << ") (pruned_segments: " << common_query_filter_->fast_rough_filter_pruned_segment_count_
+           << ") (pruned_blocks: " << common_query_filter_->fast_rough_filter_pruned_block_count_ << ") (secondary_index_filter: ";
         String filter_str;
         if (common_query_filter_->secondary_index_filter_qualified_.get()) {
             ExplainLogicalPlan::Explain(common_query_filter_->secondary_index_filter_qualified_.get(), filter_str);
@@ -82,7 +82,7 @@ public:
 
     [[nodiscard]] inline MatchExpression *match_expr() const { return match_expr_.get(); }
 
-    [[nodiscard]] inline const CommonQueryFilter *common_query_filter() const { return common_query_filter_.get(); }
+    [[nodiscard]] const CommonQueryFilter *common_query_filter() const override { return common_query_filter_.get(); }
 
 private:
     u64 table_index_ = 0;
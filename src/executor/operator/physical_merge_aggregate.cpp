@@ -28,6 +28,7 @@ import data_block;
 import logical_type;
 import physical_aggregate;
 import aggregate_expression;
+import aggregate_function;
 import infinity_exception;
 
 namespace infinity {
@@ -46,6 +47,7 @@ bool PhysicalMergeAggregate::Execute(QueryContext *query_context, OperatorState
     if (merge_aggregate_op_state->input_complete_) {
 
         LOG_TRACE("PhysicalMergeAggregate::Input is complete");
+        MergePartialStates(merge_aggregate_op_state);
         for (auto &output_block : merge_aggregate_op_state->data_block_array_) {
             output_block->Finalize();
         }
@@ -67,6 +69,11 @@ void PhysicalMergeAggregate::SimpleMergeAggregateExecute(MergeAggregateOperatorS
         for (SizeT col_idx = 0; col_idx < aggs_size; ++col_idx) {
             auto agg_expression = static_cast<AggregateExpression *>(agg_op->aggregates_[col_idx].get());
 
+            if (agg_expression->aggregate_function_.merge_func_) {
+                // Merged from the partial states when the input is complete
+                continue;
+            }
+
             auto function_name = agg_expression->aggregate_function_.GetFuncName();
 
             auto func_return_type = agg_expression->aggregate_function_.return_type_;
@@ -106,6 +113,44 @@ void PhysicalMergeAggregate::SimpleMergeAggregateExecute(MergeAggregateOperatorS
     }
 }
 
+void PhysicalMergeAggregate::MergePartialStates(MergeAggregateOperatorState *op_state) {
+    if (op_state->data_block_array_.empty()) {
+        return;
+    }
+    auto agg_op = dynamic_cast<PhysicalAggregate *>(this->left());
+    SizeT aggs_size = agg_op->aggregates_.size();
+    for (SizeT col_idx = 0; col_idx < aggs_size; ++col_idx) {
+        auto agg_expression = static_cast<AggregateExpression *>(agg_op->aggregates_[col_idx].get());
+        const AggregateFunction &aggregate_function = agg_expression->aggregate_function_;
+        if (!aggregate_function.merge_func_) {
+            continue;
+        }
+        Vector<UniquePtr<char[]>> partial_states = agg_op->TakePartialStates(col_idx);
+        if (partial_states.empty()) {
+            continue;
+        }
+        for (SizeT state_idx = 1; state_idx < partial_states.size(); ++state_idx) {
+            aggregate_function.merge_func_(partial_states[0].get(), partial_states[state_idx].get());
+        }
+        ptr_t result = aggregate_function.finalize_func_(partial_states[0].get());
+        switch (aggregate_function.return_type_.type()) {
+            case LogicalType::kBigInt: {
+                op_state->data_block_array_[0]->SetValue(col_idx, 0, Value::MakeBigInt(*(BigIntT *)result));
+                break;
+            }
+            case LogicalType::kDouble: {
+                op_state->data_block_array_[0]->SetValue(col_idx, 0, Value::MakeDouble(*(DoubleT *)result));
+                break;
+            }
+            default: {
+                String error_message =
+                    fmt::format("Merged aggregate {} returns {}", aggregate_function.GetFuncName(), aggregate_function.return_type_.ToString());
+                UnrecoverableError(error_message);
+            }
+        }
+    }
+}
+
 template <typename T>
 void PhysicalMergeAggregate::HandleAggregateFunction(const String &function_name, MergeAggregateOperatorState *op_state, SizeT col_idx) {
     LOG_TRACE(function_name);
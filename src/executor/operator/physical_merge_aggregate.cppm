@@ -72,6 +72,9 @@ public:
 
     void SimpleMergeAggregateExecute(MergeAggregateOperatorState *merge_aggregate_op_state);
 
+    // Merge the partial states of the aggregates with a merge function and write their results
+    void MergePartialStates(MergeAggregateOperatorState *merge_aggregate_op_state);
+
     template <typename T>
     void UpdateData(MergeAggregateOperatorState *op_state, MathOperation<T> operation, SizeT col_idx);
 
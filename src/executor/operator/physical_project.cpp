@@ -80,6 +80,12 @@ bool PhysicalProject::Execute(QueryContext *, OperatorState *operator_state) {
         SizeT input_block_count = prev_op_state->data_block_array_.size();
         for(SizeT block_idx = 0; block_idx < input_block_count; ++ block_idx) {
             DataBlock* input_data_block = prev_op_state->data_block_array_[block_idx].get();
+            UniquePtr<DataBlock> compacted_data_block{};
+            if (input_data_block->HasSelection()) {
+                // Only the columns used by the expressions are copied
+                compacted_data_block = input_data_block->CompactColumns(ExpressionEvaluator::ReferencedColumns(expressions_));
+                input_data_block = compacted_data_block.get();
+            }
 
             project_operator_state->data_block_array_.emplace_back(DataBlock::MakeUniquePtr());
             DataBlock* output_data_block = project_operator_state->data_block_array_.back().get();
@@ -49,6 +49,10 @@ bool PhysicalFilterScanBase::CalculateFilterBitmask(SegmentID segment_id, BlockI
     middle_bitmask.SetAllFalse();
     middle_bitmask.SetTrueRange(block_start_offset, block_end_offset);
     middle_bitmask.MergeAnd(filter_result);
+    if (middle_bitmask.CountTrue() == 0) {
+        // the whole block is pruned, skip loading its column data
+        return false;
+    }
     middle_bitmask.RoaringBitmapApplyFunc([&](const u32 offset) {
         bitmask.SetTrue(offset - block_start_offset);
         return true;
@@ -39,6 +39,8 @@ public:
 
     bool CalculateFilterBitmask(SegmentID segment_id, BlockID block_id, BlockOffset row_count, Bitmask &bitmask) const;
 
+    [[nodiscard]] const CommonQueryFilter *common_query_filter() const override { return common_query_filter_.get(); }
+
 public:
     // for filter
     SharedPtr<CommonQueryFilter> common_query_filter_;
@@ -48,7 +48,7 @@ PhysicalIndexScan::PhysicalIndexScan(const u64 id,
                                      SharedPtr<BaseExpression> index_filter_qualified,
                                      HashMap<ColumnID, TableIndexEntry *> &&column_index_map,
                                      Vector<FilterExecuteElem> &&filter_execute_command,
-                                     UniquePtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
+                                     SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator,
                                      SharedPtr<Vector<LoadMeta>> load_metas,
                                      SharedPtr<Vector<String>> output_names,
                                      SharedPtr<Vector<SharedPtr<DataType>>> output_types,
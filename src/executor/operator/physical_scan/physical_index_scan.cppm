@@ -56,7 +56,7 @@ public:
                                SharedPtr<BaseExpression> index_filter_qualified,
                                HashMap<ColumnID, TableIndexEntry *> &&column_index_map,
                                Vector<FilterExecuteElem> &&filter_execute_command,
-                               UniquePtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
+                               SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator,
                                SharedPtr<Vector<LoadMeta>> load_metas,
                                SharedPtr<Vector<String>> output_names,
                                SharedPtr<Vector<SharedPtr<DataType>>> output_types,
@@ -104,7 +104,7 @@ private:
     // Commands used in ExecuteInternal()
     Vector<FilterExecuteElem> filter_execute_command_{};
 
-    UniquePtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_{};
+    SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_{};
 
     SharedPtr<Vector<String>> output_names_{};
     SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
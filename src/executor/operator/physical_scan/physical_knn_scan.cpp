@@ -355,6 +355,7 @@ void PhysicalKnnScan::PlanWithIndex(QueryContext *query_context) { // TODO: retu
 
     block_column_entries_ = MakeUnique<Vector<BlockColumnEntry *>>();
     index_entries_ = MakeUnique<Vector<SegmentIndexEntry *>>();
+    index_chunk_slots_ = MakeUnique<Vector<Pair<u32, u32>>>();
 
     TableEntry *table_entry = base_table_ref_->table_entry_ptr_;
     Map<u32, SharedPtr<SegmentIndexEntry>> index_entry_map;
@@ -430,7 +431,21 @@ void PhysicalKnnScan::PlanWithIndex(QueryContext *query_context) { // TODO: retu
     BlockIndex *block_index = base_table_ref_->block_index_.get();
     for (const auto &[segment_id, segment_info] : block_index->segment_block_index_) {
         if (auto iter = index_entry_map.find(segment_id); iter != index_entry_map.end()) {
-            index_entries_->emplace_back(iter->second.get());
+            SegmentIndexEntry *segment_index_entry = iter->second.get();
+            u32 slot_n = 1;
+            if (segment_index_entry->table_index_entry()->index_base()->index_type_ == IndexType::kHnsw) {
+                // one task per chunk (and memindex), so that the chunks of a segment are searched concurrently
+                auto [chunk_index_entries, memory_hnsw_index] = segment_index_entry->GetHnswIndexSnapshot();
+                slot_n = 0;
+                for (const auto &chunk_index_entry : chunk_index_entries) {
+                    slot_n += chunk_index_entry->CheckVisible(txn);
+                }
+                slot_n = std::max(1u, slot_n + (memory_hnsw_index.get() != nullptr));
+            }
+            for (u32 slot = 0; slot < slot_n; ++slot) {
+                index_entries_->emplace_back(segment_index_entry);
+                index_chunk_slots_->emplace_back(slot, slot_n);
+            }
         } else {
             const auto &block_map = segment_info.block_map_;
             for (const auto *block_entry : block_map) {
@@ -538,6 +553,7 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
         LOG_TRACE(fmt::format("KnnScan: {} index {}/{}", knn_scan_function_data->task_id_, index_idx + 1, index_task_n));
         // with index
         SegmentIndexEntry *segment_index_entry = knn_scan_shared_data->index_entries_->at(index_idx);
+        const auto [chunk_slot, chunk_slot_n] = knn_scan_shared_data->index_chunk_slots_->at(index_idx);
 
         auto segment_id = segment_index_entry->segment_id();
         SegmentOffset segment_row_count = 0;
@@ -643,10 +659,17 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                                 }
                             }
 
-                            i64 result_n = -1;
+                            // cosine and inner product are negated in hnsw, so that smaller is always better there
+                            const bool negate_dist = knn_scan_shared_data->knn_distance_type_ == KnnDistanceType::kCosine ||
+                                                     knn_scan_shared_data->knn_distance_type_ == KnnDistanceType::kInnerProduct;
+
                             for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
                                 const auto *query = static_cast<const QueryDataType *>(knn_scan_shared_data->query_embedding_) +
                                                     query_idx * knn_scan_shared_data->dimension_;
+                                if (!rerank) {
+                                    // reranked results use exact distances which are not comparable with the index distances
+                                    search_option.dist_bound_ = knn_scan_shared_data->GetHnswDistBound(query_idx);
+                                }
 
                                 SizeT result_n1 = 0;
                                 UniquePtr<DistanceDataType[]> d_ptr = nullptr;
@@ -681,12 +704,8 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                                     }
                                 }
 
-                                if (result_n < 0) {
-                                    result_n = result_n1;
-                                } else if (result_n != (i64)result_n1) {
-                                    String error_message = "KnnScan: result_n mismatch";
-                                    UnrecoverableError(error_message);
-                                }
+                                // results farther than the bound of the query are dropped, so the count differs between queries
+                                const i64 result_n = result_n1;
 
                                 if (rerank) {
                                     Vector<SizeT> idxes(result_n);
@@ -755,6 +774,9 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                                     }
 
                                     merge_heap->Search(0, d_ptr.get(), row_ids.get(), result_n);
+                                    if (auto kth_dist = merge_heap->GetKthDistance(0); kth_dist.has_value()) {
+                                        knn_scan_shared_data->UpdateHnswDistBound(query_idx, negate_dist ? -*kth_dist : *kth_dist);
+                                    }
                                 }
                             }
                         };
@@ -773,15 +795,21 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                                 abstract_hnsw);
                         };
 
+                        // the task of slot i searches the i-th visible chunk, the last slot also searches the remaining chunks and the memindex
                         auto [chunk_index_entries, memory_hnsw_index] = segment_index_entry->GetHnswIndexSnapshot();
+                        const bool last_slot = chunk_slot + 1 == chunk_slot_n;
+                        u32 visible_chunk_idx = 0;
                         for (auto &chunk_index_entry : chunk_index_entries) {
-                            if (chunk_index_entry->CheckVisible(txn)) {
+                            if (!chunk_index_entry->CheckVisible(txn)) {
+                                continue;
+                            }
+                            if (u32 idx = visible_chunk_idx++; idx == chunk_slot || (last_slot && idx > chunk_slot)) {
                                 BufferHandle index_handle = chunk_index_entry->GetIndex();
                                 const auto *abstract_hnsw = reinterpret_cast<const AbstractHnsw *>(index_handle.GetData());
                                 abstract_hnsw_search(*abstract_hnsw, false);
                             }
                         }
-                        if (memory_hnsw_index.get() != nullptr) {
+                        if (last_slot && memory_hnsw_index.get() != nullptr) {
                             const AbstractHnsw &abstract_hnsw = memory_hnsw_index->get();
                             abstract_hnsw_search(abstract_hnsw, true);
                         }
@@ -830,7 +858,22 @@ struct BruteForceBlockScan<LogicalType::kEmbedding, ColumnDataType, QueryDataTyp
         const QueryDataType *target_ptr = nullptr;
         if constexpr (std::is_same_v<ColumnDataType, QueryDataType>) {
             target_ptr = data;
-        } else {
+        } else if constexpr (IsAnyOf<ColumnDataType, Float16T, BFloat16T>) {
+            // half precision rows are widened inside the distance kernel
+            auto half_dist_func = std::is_same_v<ColumnDataType, Float16T> ? dist_func->f16_dist_func_ : dist_func->bf16_dist_func_;
+            if (half_dist_func != nullptr) {
+                merge_heap->Search(knn_query_ptr,
+                                   reinterpret_cast<const u16 *>(data),
+                                   embedding_dim,
+                                   half_dist_func,
+                                   row_count,
+                                   segment_id,
+                                   block_id,
+                                   bitmask);
+                return;
+            }
+        }
+        if constexpr (!std::is_same_v<ColumnDataType, QueryDataType>) {
             if (!buffer_ptr_for_cast) {
                 buffer_ptr_for_cast = MakeUniqueForOverwrite<QueryDataType[]>(DEFAULT_BLOCK_CAPACITY * embedding_dim);
             }
@@ -894,7 +937,22 @@ void MultiVectorSearchOneLine(MergeKnn<QueryDataType, C, DistanceDataType> *merg
     const auto [data_span, embedding_num] = column_vector.GetMultiVectorRaw(block_offset);
     auto result_dist = Compare::InitialValue();
     auto raw_data_ptr = reinterpret_cast<const ColumnDataType *>(data_span.data());
+    [[maybe_unused]] typename KnnDistance1<QueryDataType, DistanceDataType>::HalfDistFunc half_dist_func = nullptr;
+    if constexpr (std::is_same_v<ColumnDataType, Float16T>) {
+        half_dist_func = dist_func->f16_dist_func_;
+    } else if constexpr (std::is_same_v<ColumnDataType, BFloat16T>) {
+        half_dist_func = dist_func->bf16_dist_func_;
+    }
     for (u32 i = 0; i < embedding_num; ++i) {
+        DistanceDataType new_dist;
+        if constexpr (IsAnyOf<ColumnDataType, Float16T, BFloat16T>) {
+            if (half_dist_func != nullptr) {
+                new_dist = half_dist_func(knn_query_ptr, reinterpret_cast<const u16 *>(raw_data_ptr), embedding_dim);
+                result_dist = Compare::Compare(result_dist, new_dist) ? new_dist : result_dist;
+                raw_data_ptr += embedding_dim;
+                continue;
+            }
+        }
         if constexpr (!std::is_same_v<ColumnDataType, QueryDataType>) {
             for (u32 j = 0; j < embedding_dim; ++j) {
                 buffer_ptr_for_cast[j] = static_cast<QueryDataType>(raw_data_ptr[j]);
@@ -902,7 +960,7 @@ void MultiVectorSearchOneLine(MergeKnn<QueryDataType, C, DistanceDataType> *merg
         } else {
             target_ptr = raw_data_ptr;
         }
-        const auto new_dist = dist_func->dist_func_(knn_query_ptr, target_ptr, embedding_dim);
+        new_dist = dist_func->dist_func_(knn_query_ptr, target_ptr, embedding_dim);
         static_assert(std::is_same_v<decltype(result_dist), std::decay_t<decltype(new_dist)>>);
         result_dist = Compare::Compare(result_dist, new_dist) ? new_dist : result_dist;
         raw_data_ptr += embedding_dim;
@@ -98,6 +98,7 @@ public:
     u32 index_entries_size_ = 0;
     UniquePtr<Vector<BlockColumnEntry *>> block_column_entries_{};
     UniquePtr<Vector<SegmentIndexEntry *>> index_entries_{};
+    UniquePtr<Vector<Pair<u32, u32>>> index_chunk_slots_{};
 
 private:
     void InitBlockParallelOption();
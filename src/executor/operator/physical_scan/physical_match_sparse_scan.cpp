@@ -61,6 +61,8 @@ import bmp_util;
 import knn_filter;
 import segment_entry;
 import abstract_bmp;
+import block_column_entry;
+import sparse_block_max_ivt;
 
 namespace infinity {
 
@@ -137,6 +139,11 @@ SizeT PhysicalMatchSparseScan::GetTaskletCount(QueryContext *query_context) {
                 LOG_TRACE(fmt::format("KnnScan: PlanWithIndex(): Skipping non-knn index."));
                 continue;
             }
+            if (table_index_entry->PartiallyBuilt(block_index)) {
+                // Left by a cancelled build, the blocks are scanned instead
+                LOG_TRACE(fmt::format("MatchSparseScan: index {} is partially built, skipped", idx_name));
+                continue;
+            }
             if (base_table_ref_->index_index_.get() == nullptr) {
                 base_table_ref_->index_index_ = MakeShared<IndexIndex>();
             }
@@ -394,6 +401,39 @@ void PhysicalMatchSparseScan::ExecuteInnerT(DistFunc *dist_func,
         auto *block_column_entry = block_entry->GetColumnBlockEntry(search_column_id_);
         ColumnVector column_vector = block_column_entry->GetConstColumnVector(buffer_mgr);
 
+        if constexpr (!std::is_same_v<typename DistFunc::DataT, bool>) {
+            // Large blocks are searched by a block-max inverted index kept with the block, which skips the rows that can't
+            // enter the top-k
+            using BlockMaxIvt = SparseBlockMaxIvt<typename DistFunc::DataT, typename DistFunc::IndexT>;
+            if (row_cnt >= BlockMaxIvt::kMinRowCount) {
+                auto get_row = [&](SizeT row) { return get_ele(column_vector, row); };
+                SharedPtr<SparseBlockMaxIvtBase> ivt_ptr =
+                    block_column_entry->GetSparseBlockMaxIvt(row_cnt, [&](const SparseBlockMaxIvtBase *old) -> SharedPtr<SparseBlockMaxIvtBase> {
+                        if (old != nullptr) {
+                            return static_cast<const BlockMaxIvt *>(old)->Extend(row_cnt, get_row);
+                        }
+                        return MakeShared<BlockMaxIvt>(row_cnt, get_row);
+                    });
+                const auto *ivt = static_cast<const BlockMaxIvt *>(ivt_ptr.get());
+                for (SizeT query_id = 0; query_id < query_n; ++query_id) {
+                    auto query_sparse = get_ele(query_vector, query_id);
+                    auto kth_score = [&] { return merge_heap->GetKthDistance(query_id); };
+                    // The index only bounds the scores, the rows are scored as the scan below does
+                    auto score_row = [&](SizeT row) -> ResultType {
+                        return bitmask.IsTrue(row) ? dist_func->Calculate(query_sparse, get_row(row)) : ResultType{};
+                    };
+                    auto add_result = [&](SizeT row, ResultType d) {
+                        if (bitmask.IsTrue(row)) {
+                            RowID row_id(segment_id, block_id * DEFAULT_BLOCK_CAPACITY + row);
+                            merge_heap->Search(query_id, &d, &row_id, 1);
+                        }
+                    };
+                    ivt->template Search<ResultType>(query_sparse, row_cnt, kth_score, score_row, add_result);
+                }
+                break;
+            }
+        }
+
         for (SizeT query_id = 0; query_id < query_n; ++query_id) {
             auto query_sparse = get_ele(query_vector, query_id);
             for (BlockOffset i = 0; i < row_cnt; ++i) {
@@ -14,6 +14,7 @@
 
 module;
 
+#include <algorithm>
 #include <bit>
 #include <cstdlib>
 #include <memory>
@@ -57,6 +58,7 @@ import segment_index_entry;
 import chunk_index_entry;
 import emvb_index_in_mem;
 import emvb_index;
+import tensor_centroid_codes;
 import knn_filter;
 import global_block_id;
 import block_index;
@@ -190,10 +192,21 @@ void PhysicalMatchTensorScan::PlanWithIndex(QueryContext *query_context) {
         break;
     }
 
-    // Generate task set: index segment and no index block
+    // Segments without index are ranked by their centroid codes if they are sealed and have enough documents to prune
+    bool use_centroid_codes = false;
+    if (const u32 centroid_n_doc_to_score = index_options_.centroid_n_doc_to_score_; centroid_n_doc_to_score > 0) {
+        const auto &column_type = table_entry->GetColumnDefByID(search_column_id)->type();
+        use_centroid_codes = column_type->type() == LogicalType::kTensor &&
+                             TensorCentroidCodes::SupportType(static_cast<const EmbeddingInfo *>(column_type->type_info().get())->Type());
+    }
+
+    // Generate task set: index segment, segment with centroid codes and no index block
     for (BlockIndex *block_index = base_table_ref_->block_index_.get(); const auto &[segment_id, segment_info] : block_index->segment_block_index_) {
         if (auto iter = index_entry_map.find(segment_id); iter != index_entry_map.end()) {
             index_entries_.emplace_back(iter->second.get());
+        } else if (use_centroid_codes && segment_info.segment_entry_->status() != SegmentStatus::kUnsealed &&
+                   segment_info.segment_offset_ > index_options_.centroid_n_doc_to_score_) {
+            centroid_segment_entries_.emplace_back(segment_info.segment_entry_);
         } else {
             for (const auto &block_map = segment_info.block_map_; const auto *block_entry : block_map) {
                 BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(search_column_id);
@@ -201,13 +214,17 @@ void PhysicalMatchTensorScan::PlanWithIndex(QueryContext *query_context) {
             }
         }
     }
-    if (!block_column_entries_.empty()) {
+    if (!block_column_entries_.empty() || !centroid_segment_entries_.empty()) {
         // check unused option text
-        if (const SearchOptions options(src_match_tensor_expr_->options_text_); options.size() != options.options_.count("topn")) {
+        if (const SearchOptions options(src_match_tensor_expr_->options_text_);
+            options.size() != options.options_.count("topn") + options.options_.count("centroid_n_doc_to_score")) {
             RecoverableError(Status::SyntaxError(fmt::format(R"(Input option text "{}" has unused part.)", src_match_tensor_expr_->options_text_)));
         }
     }
-    LOG_TRACE(fmt::format("MatchTensorScan: brute force task: {}, index task: {}", block_column_entries_.size(), index_entries_.size()));
+    LOG_TRACE(fmt::format("MatchTensorScan: brute force task: {}, centroid codes task: {}, index task: {}",
+                          block_column_entries_.size(),
+                          centroid_segment_entries_.size(),
+                          index_entries_.size()));
 }
 
 Vector<SharedPtr<Vector<GlobalBlockID>>> PhysicalMatchTensorScan::PlanBlockEntries(i64 parallel_count) const {
@@ -216,7 +233,7 @@ Vector<SharedPtr<Vector<GlobalBlockID>>> PhysicalMatchTensorScan::PlanBlockEntri
 }
 
 // TODO: how many threads for brute force scan?
-SizeT PhysicalMatchTensorScan::TaskletCount() { return block_column_entries_.size() + index_entries_.size(); }
+SizeT PhysicalMatchTensorScan::TaskletCount() { return block_column_entries_.size() + centroid_segment_entries_.size() + index_entries_.size(); }
 
 bool PhysicalMatchTensorScan::Execute(QueryContext *query_context, OperatorState *operator_state) {
     auto *match_tensor_scan_operator_state = static_cast<MatchTensorScanOperatorState *>(operator_state);
@@ -365,20 +382,10 @@ void PhysicalMatchTensorScan::ExecuteInner(QueryContext *query_context, MatchTen
                 }
             }
         }
-    } else if (const u32 task_job_block = task_job_index - index_entries_.size(); task_job_block < block_column_entries_.size()) {
-        auto *block_column_entry = block_column_entries_[task_job_block];
-        const BlockEntry *block_entry = block_column_entry->GetBlockEntry();
-        const BlockID block_id = block_entry->block_id();
-        const SegmentEntry *segment_entry = block_entry->GetSegmentEntry();
-        const SegmentID segment_id = segment_entry->segment_id();
-        BlockOffset row_count = block_index->GetBlockOffset(segment_id, block_id);
-        Bitmask bitmask;
-        if (this->CalculateFilterBitmask(segment_id, block_id, row_count, bitmask)) {
-            block_entry->SetDeleteBitmask(begin_ts, bitmask);
-            auto column_vector = block_column_entry->GetConstColumnVector(buffer_mgr);
-            // output score will always be float type
-            CalculateScoreOnColumnVector(column_vector, segment_id, block_id, 0, row_count, bitmask, *calc_match_tensor_expr_, function_data);
-        }
+    } else if (const u32 task_job_segment = task_job_index - index_entries_.size(); task_job_segment < centroid_segment_entries_.size()) {
+        ExecuteWithCentroidCodes(centroid_segment_entries_[task_job_segment], begin_ts, buffer_mgr, function_data);
+    } else if (const u32 task_job_block = task_job_segment - centroid_segment_entries_.size(); task_job_block < block_column_entries_.size()) {
+        ExecuteOnBlock(block_column_entries_[task_job_block]->GetBlockEntry(), begin_ts, buffer_mgr, function_data);
     } else {
         // all task Complete
         const u32 result_n = function_data.End();
@@ -431,6 +438,98 @@ void PhysicalMatchTensorScan::ExecuteInner(QueryContext *query_context, MatchTen
     }
 }
 
+void PhysicalMatchTensorScan::ExecuteOnBlock(const BlockEntry *block_entry,
+                                             const TxnTimeStamp begin_ts,
+                                             BufferManager *buffer_mgr,
+                                             MatchTensorScanFunctionData &function_data) const {
+    const BlockIndex *block_index = base_table_ref_->block_index_.get();
+    const BlockID block_id = block_entry->block_id();
+    const SegmentID segment_id = block_entry->GetSegmentEntry()->segment_id();
+    BlockOffset row_count = block_index->GetBlockOffset(segment_id, block_id);
+    Bitmask bitmask;
+    if (this->CalculateFilterBitmask(segment_id, block_id, row_count, bitmask)) {
+        block_entry->SetDeleteBitmask(begin_ts, bitmask);
+        auto column_vector = block_entry->GetColumnBlockEntry(search_column_id_)->GetConstColumnVector(buffer_mgr);
+        // output score will always be float type
+        CalculateScoreOnColumnVector(column_vector, segment_id, block_id, 0, row_count, bitmask, *calc_match_tensor_expr_, function_data);
+    }
+}
+
+void PhysicalMatchTensorScan::ExecuteWithCentroidCodes(SegmentEntry *segment_entry,
+                                                       const TxnTimeStamp begin_ts,
+                                                       BufferManager *buffer_mgr,
+                                                       MatchTensorScanFunctionData &function_data) const {
+    const BlockIndex *block_index = base_table_ref_->block_index_.get();
+    const SegmentID segment_id = segment_entry->segment_id();
+    const SegmentSnapshot &segment_snapshot = block_index->segment_block_index_.at(segment_id);
+    const SharedPtr<TensorCentroidCodes> centroid_codes = segment_entry->GetTensorCentroidCodes(search_column_id_);
+    if (!centroid_codes) {
+        // Not built yet if this is the first pruned search of the segment, or too few embeddings to learn centroids from,
+        // or over the memory limit of the codes
+        TensorCentroidCodes::ScheduleForSegment(segment_entry);
+        for (const BlockEntry *block_entry : segment_snapshot.block_map_) {
+            ExecuteOnBlock(block_entry, begin_ts, buffer_mgr, function_data);
+        }
+        return;
+    }
+
+    // 1. keep the documents with the highest approximate score, in a min heap
+    const u32 query_embedding_num = calc_match_tensor_expr_->num_of_embedding_in_query_tensor_;
+    const Vector<f32> query_centroid_scores = centroid_codes->QueryCentroidScores(calc_match_tensor_expr_->query_embedding_.ptr,
+                                                                                  calc_match_tensor_expr_->embedding_data_type_,
+                                                                                  query_embedding_num);
+    const u32 n_doc_to_score = index_options_.centroid_n_doc_to_score_;
+    Vector<Pair<f32, SegmentOffset>> candidates;
+    candidates.reserve(n_doc_to_score);
+    const auto heap_cmp = [](const Pair<f32, SegmentOffset> &left, const Pair<f32, SegmentOffset> &right) { return left.first > right.first; };
+    for (const BlockEntry *block_entry : segment_snapshot.block_map_) {
+        const BlockID block_id = block_entry->block_id();
+        const BlockOffset row_count = block_index->GetBlockOffset(segment_id, block_id);
+        Bitmask bitmask;
+        if (!this->CalculateFilterBitmask(segment_id, block_id, row_count, bitmask)) {
+            continue;
+        }
+        block_entry->SetDeleteBitmask(begin_ts, bitmask);
+        const SegmentOffset block_start_offset = block_id * DEFAULT_BLOCK_CAPACITY;
+        if (block_start_offset + row_count > centroid_codes->row_count()) {
+            String error_message = fmt::format("Segment {} has more rows than its centroid codes: {}", segment_id, centroid_codes->row_count());
+            UnrecoverableError(error_message);
+        }
+        for (BlockOffset block_offset = 0; block_offset < row_count; ++block_offset) {
+            if (!bitmask.IsTrue(block_offset)) {
+                continue;
+            }
+            const SegmentOffset segment_offset = block_start_offset + block_offset;
+            const f32 score = centroid_codes->ApproximateScore(query_centroid_scores.data(), query_embedding_num, segment_offset);
+            if (candidates.size() < n_doc_to_score) {
+                candidates.emplace_back(score, segment_offset);
+                std::push_heap(candidates.begin(), candidates.end(), heap_cmp);
+            } else if (score > candidates.front().first) {
+                std::pop_heap(candidates.begin(), candidates.end(), heap_cmp);
+                candidates.back() = {score, segment_offset};
+                std::push_heap(candidates.begin(), candidates.end(), heap_cmp);
+            }
+        }
+    }
+
+    // 2. exact MaxSim of the candidates, block by block
+    std::sort(candidates.begin(), candidates.end(), [](const auto &left, const auto &right) { return left.second < right.second; });
+    for (SizeT candidate_begin = 0; candidate_begin < candidates.size();) {
+        const BlockID block_id = candidates[candidate_begin].second / DEFAULT_BLOCK_CAPACITY;
+        const BlockOffset row_count = block_index->GetBlockOffset(segment_id, block_id);
+        Bitmask candidate_bitmask(row_count);
+        candidate_bitmask.SetAllFalse();
+        SizeT candidate_end = candidate_begin;
+        for (; candidate_end < candidates.size() && candidates[candidate_end].second / DEFAULT_BLOCK_CAPACITY == block_id; ++candidate_end) {
+            candidate_bitmask.SetTrue(candidates[candidate_end].second % DEFAULT_BLOCK_CAPACITY);
+        }
+        const BlockEntry *block_entry = block_index->GetBlockEntry(segment_id, block_id);
+        auto column_vector = block_entry->GetColumnBlockEntry(search_column_id_)->GetConstColumnVector(buffer_mgr);
+        CalculateScoreOnColumnVector(column_vector, segment_id, block_id, 0, row_count, candidate_bitmask, *calc_match_tensor_expr_, function_data);
+        candidate_begin = candidate_end;
+    }
+}
+
 // TensorElemT: bit, QueryElemT: bit (unaligned).
 // TensorElemT: bit, QueryElemT: f32, i32, i64 (aligned).
 // TensorElemT: u8, QueryElemT: u8 (unaligned).
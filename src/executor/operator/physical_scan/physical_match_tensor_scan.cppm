@@ -33,8 +33,12 @@ import internal_types;
 namespace infinity {
 struct LoadMeta;
 struct BlockIndex;
+struct BlockEntry;
 struct BlockColumnEntry;
+struct SegmentEntry;
 class SegmentIndexEntry;
+class BufferManager;
+class MatchTensorScanFunctionData;
 
 export class PhysicalMatchTensorScan final : public PhysicalFilterScanBase {
 public:
@@ -77,8 +81,6 @@ public:
 
     [[nodiscard]] inline MatchTensorExpression *match_tensor_expr() const { return src_match_tensor_expr_.get(); }
 
-    [[nodiscard]] inline const CommonQueryFilter *common_query_filter() const { return common_query_filter_.get(); }
-
     [[nodiscard]] inline u32 GetTopN() const { return topn_; }
 
 private:
@@ -98,14 +100,25 @@ private:
     ColumnID search_column_id_ = 0;
 
     Vector<SegmentIndexEntry *> index_entries_;
+    // sealed segments without index, whose documents are ranked by their centroid codes before the exact MaxSim
+    Vector<SegmentEntry *> centroid_segment_entries_;
     Vector<BlockColumnEntry *> block_column_entries_;
     mutable atomic_u32 task_executed_ = 0;
 
     void ExecuteInner(QueryContext *query_context, MatchTensorScanOperatorState *operator_state) const;
+
+    void ExecuteOnBlock(const BlockEntry *block_entry,
+                        TxnTimeStamp begin_ts,
+                        BufferManager *buffer_mgr,
+                        MatchTensorScanFunctionData &function_data) const;
+
+    void ExecuteWithCentroidCodes(SegmentEntry *segment_entry,
+                                  TxnTimeStamp begin_ts,
+                                  BufferManager *buffer_mgr,
+                                  MatchTensorScanFunctionData &function_data) const;
 };
 
 struct MatchTensorRerankDoc;
-class BufferManager;
 export void CalculateFusionMatchTensorRerankerScores(Vector<MatchTensorRerankDoc> &rerank_docs,
                                                      BufferManager *buffer_mgr,
                                                      const DataType *column_data_type,
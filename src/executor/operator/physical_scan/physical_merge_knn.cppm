@@ -59,6 +59,10 @@ public:
 
     inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return output_types_; }
 
+    void FillingTableRefs(HashMap<SizeT, SharedPtr<BaseTableRef>> &table_refs) override {
+        table_refs.insert({base_table_ref_->table_index_, base_table_ref_});
+    }
+
     SizeT TaskletCount() override {
         String error_message = "Not implement: TaskletCount not Implement";
         UnrecoverableError(error_message);
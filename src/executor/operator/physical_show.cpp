@@ -74,6 +74,7 @@ import system_info;
 import wal_entry;
 import catalog_delta_entry;
 import memindex_tracer;
+import index_build_tracer;
 import persistence_manager;
 import global_resource_usage;
 import infinity_context;
@@ -416,6 +417,31 @@ void PhysicalShow::Init() {
             output_types_->emplace_back(bigint_type);
             break;
         }
+        case ShowType::kShowIndexBuilds: {
+            output_names_->reserve(10);
+            output_types_->reserve(10);
+            output_names_->emplace_back("job_id");
+            output_names_->emplace_back("db_name");
+            output_names_->emplace_back("table_name");
+            output_names_->emplace_back("index_name");
+            output_names_->emplace_back("segments");
+            output_names_->emplace_back("built_segments");
+            output_names_->emplace_back("rows");
+            output_names_->emplace_back("processed_rows");
+            output_names_->emplace_back("elapsed_ms");
+            output_names_->emplace_back("remaining_ms");
+            output_types_->emplace_back(bigint_type);
+            output_types_->emplace_back(varchar_type);
+            output_types_->emplace_back(varchar_type);
+            output_types_->emplace_back(varchar_type);
+            output_types_->emplace_back(bigint_type);
+            output_types_->emplace_back(bigint_type);
+            output_types_->emplace_back(bigint_type);
+            output_types_->emplace_back(bigint_type);
+            output_types_->emplace_back(bigint_type);
+            output_types_->emplace_back(bigint_type);
+            break;
+        }
         case ShowType::kShowQueries: {
             output_names_->reserve(5);
             output_types_->reserve(5);
@@ -667,6 +693,10 @@ bool PhysicalShow::Execute(QueryContext *query_context, OperatorState *operator_
             ExecuteShowMemIndex(query_context, show_operator_state);
             break;
         }
+        case ShowType::kShowIndexBuilds: {
+            ExecuteShowIndexBuilds(query_context, show_operator_state);
+            break;
+        }
         case ShowType::kShowQueries: {
             ExecuteShowQueries(query_context, show_operator_state);
             break;
@@ -4765,6 +4795,64 @@ void PhysicalShow::ExecuteShowMemIndex(QueryContext *query_context, ShowOperator
     return;
 }
 
+void PhysicalShow::ExecuteShowIndexBuilds(QueryContext *query_context, ShowOperatorState *operator_state) {
+    auto varchar_type = MakeShared<DataType>(LogicalType::kVarchar);
+    auto bigint_type = MakeShared<DataType>(LogicalType::kBigInt);
+
+    Vector<SharedPtr<DataType>> column_types{
+        bigint_type,
+        varchar_type,
+        varchar_type,
+        varchar_type,
+        bigint_type,
+        bigint_type,
+        bigint_type,
+        bigint_type,
+        bigint_type,
+        bigint_type,
+    };
+    UniquePtr<DataBlock> output_block_ptr = DataBlock::MakeUniquePtr();
+    output_block_ptr->Init(column_types);
+    SizeT row_count = 0;
+
+    Vector<SharedPtr<IndexBuildJob>> index_build_jobs = query_context->storage()->index_build_tracer()->GetJobs();
+    for (const auto &index_build_job : index_build_jobs) {
+        if (output_block_ptr.get() == nullptr) {
+            output_block_ptr = DataBlock::MakeUniquePtr();
+            output_block_ptr->Init(column_types);
+        }
+
+        Vector<Value> values = {
+            Value::MakeBigInt(index_build_job->job_id_),
+            Value::MakeVarchar(index_build_job->db_name_),
+            Value::MakeVarchar(index_build_job->table_name_),
+            Value::MakeVarchar(index_build_job->index_name_),
+            Value::MakeBigInt(index_build_job->segment_count_),
+            Value::MakeBigInt(index_build_job->finished_segments()),
+            Value::MakeBigInt(index_build_job->total_rows_),
+            Value::MakeBigInt(index_build_job->processed_rows()),
+            Value::MakeBigInt(index_build_job->ElapsedMs()),
+            Value::MakeBigInt(index_build_job->RemainingMs()),
+        };
+        for (SizeT column_id = 0; column_id < values.size(); ++column_id) {
+            ValueExpression value_expr(values[column_id]);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[column_id]);
+        }
+
+        ++row_count;
+        if (row_count == output_block_ptr->capacity()) {
+            output_block_ptr->Finalize();
+            operator_state->output_.emplace_back(std::move(output_block_ptr));
+            output_block_ptr = nullptr;
+            row_count = 0;
+        }
+    }
+    if (output_block_ptr.get() != nullptr) {
+        output_block_ptr->Finalize();
+        operator_state->output_.emplace_back(std::move(output_block_ptr));
+    }
+}
+
 void PhysicalShow::ExecuteShowQueries(QueryContext *query_context, ShowOperatorState *operator_state) {
     auto varchar_type = MakeShared<DataType>(LogicalType::kVarchar);
     auto bigint_type = MakeShared<DataType>(LogicalType::kBigInt);
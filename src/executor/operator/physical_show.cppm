@@ -129,6 +129,8 @@ private:
     
     void ExecuteShowMemIndex(QueryContext *query_context, ShowOperatorState *operator_state);
 
+    void ExecuteShowIndexBuilds(QueryContext *query_context, ShowOperatorState *operator_state);
+
     void ExecuteShowQueries(QueryContext *query_context, ShowOperatorState *operator_state);
 
     void ExecuteShowQuery(QueryContext *query_context, ShowOperatorState *operator_state);
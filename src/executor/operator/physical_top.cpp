@@ -412,7 +412,15 @@ Vector<Vector<SharedPtr<ColumnVector>>> PhysicalTop::GetEvalColumns(const Vector
     for (auto &data_block_ptr : data_block_array) {
         Vector<SharedPtr<ColumnVector>> results;
         ExpressionEvaluator expr_evaluator;
-        expr_evaluator.Init(data_block_ptr.get());
+        UniquePtr<DataBlock> compacted_data_block{};
+        if (data_block_ptr->HasSelection()) {
+            // Evaluate the sort expressions on the selected rows of the columns they use,
+            // the top rows are then copied through the selection.
+            compacted_data_block = data_block_ptr->CompactColumns(ExpressionEvaluator::ReferencedColumns(expressions));
+            expr_evaluator.Init(compacted_data_block.get());
+        } else {
+            expr_evaluator.Init(data_block_ptr.get());
+        }
         results.reserve(sort_expr_count);
         for (u32 expr_id = 0; expr_id < sort_expr_count; ++expr_id) {
             auto &expr = expressions[expr_id];
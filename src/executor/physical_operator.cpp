@@ -33,6 +33,7 @@ import logical_type;
 import internal_types;
 
 import logger;
+import buffer_manager;
 
 namespace infinity {
 
@@ -52,6 +53,7 @@ void PhysicalOperator::InputLoad(QueryContext *query_context, OperatorState *ope
         UnrecoverableError(error_message);
     }
 
+    BufferManager *buffer_mgr = query_context->storage()->buffer_manager();
     for (SizeT i = 0; i < operator_state->prev_op_state_->data_block_array_.size(); ++i) {
         auto input_block = operator_state->prev_op_state_->data_block_array_[i].get();
         SizeT load_column_count = load_metas_->size();
@@ -70,22 +72,42 @@ void PhysicalOperator::InputLoad(QueryContext *query_context, OperatorState *ope
         }
 
         auto row_column_id = input_block->column_count() - 1;
+        const auto *row_ids = reinterpret_cast<const RowID *>(input_block->column_vectors[row_column_id]->data());
+
+        // Rows are visited in row id order, so that the columns of each block are fetched once and blocks are read in storage order.
+        // The loaded values are then appended in the input order.
+        Vector<u32> row_order(row_count);
+        std::iota(row_order.begin(), row_order.end(), 0);
+        std::sort(row_order.begin(), row_order.end(), [&](u32 lhs, u32 rhs) { return row_ids[lhs] < row_ids[rhs]; });
+        Vector<Vector<ColumnVector>> block_column_vectors;
+        Vector<u32> row_block_idx(row_count);
+        Optional<Pair<SegmentID, BlockID>> last_block;
+        for (u32 j : row_order) {
+            SegmentID segment_id = row_ids[j].segment_id_;
+            BlockID block_id = row_ids[j].segment_offset_ / DEFAULT_BLOCK_CAPACITY;
+            if (!last_block.has_value() || *last_block != Pair<SegmentID, BlockID>(segment_id, block_id)) {
+                last_block = Pair<SegmentID, BlockID>(segment_id, block_id);
+                const BlockEntry *block_entry = table_ref->block_index_->GetBlockEntry(segment_id, block_id);
+                if (block_entry == nullptr) {
+                    String error_message = fmt::format("Cannot find segment id: {}, block id: {}", segment_id, block_id);
+                    UnrecoverableError(error_message);
+                }
+                Vector<ColumnVector> &column_vectors = block_column_vectors.emplace_back();
+                column_vectors.reserve(load_column_count);
+                for (SizeT k = 0; k < load_column_count; ++k) {
+                    BlockColumnEntry *block_column_ptr = block_entry->GetColumnBlockEntry(load_metas[k].binding_.column_idx);
+                    column_vectors.emplace_back(block_column_ptr->GetConstColumnVector(buffer_mgr));
+                }
+            }
+            row_block_idx[j] = block_column_vectors.size() - 1;
+        }
 
         for (SizeT j = 0; j < row_count; ++j) {
             // If late materialization needs to be optional, then this needs to be modified
-            RowID row_id = input_block->GetValue(row_column_id, j).value_.row;
-            u32 segment_id = row_id.segment_id_;
-            u32 segment_offset = row_id.segment_offset_;
-            u16 block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
-            u16 block_offset = segment_offset % DEFAULT_BLOCK_CAPACITY;
-
-            const BlockEntry *block_entry = table_ref->block_index_->GetBlockEntry(segment_id, block_id);
+            BlockOffset block_offset = row_ids[j].segment_offset_ % DEFAULT_BLOCK_CAPACITY;
+            const Vector<ColumnVector> &column_vectors = block_column_vectors[row_block_idx[j]];
             for (SizeT k = 0; k < load_column_count; ++k) {
-                auto binding = load_metas[k].binding_;
-                BlockColumnEntry *block_column_ptr = block_entry->GetColumnBlockEntry(binding.column_idx);
-
-                ColumnVector column_vector = block_column_ptr->GetConstColumnVector(query_context->storage()->buffer_manager());
-                input_block->column_vectors[load_metas[k].index_]->AppendWith(column_vector, block_offset, 1);
+                input_block->column_vectors[load_metas[k].index_]->AppendWith(column_vectors[k], block_offset, 1);
             }
         }
     }
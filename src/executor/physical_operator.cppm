@@ -27,6 +27,7 @@ import load_meta;
 import internal_types;
 import data_type;
 import column_binding;
+import common_query_filter;
 
 namespace infinity {
 
@@ -71,6 +72,9 @@ public:
 
     const SharedPtr<Vector<LoadMeta>> &load_metas() const { return load_metas_; }
 
+    // filter shared by search operators, nullptr for the others
+    [[nodiscard]] virtual const CommonQueryFilter *common_query_filter() const { return nullptr; }
+
 protected:
     u64 operator_id_;
     PhysicalOperatorType operator_type_{PhysicalOperatorType::kInvalid};
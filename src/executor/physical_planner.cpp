@@ -147,6 +147,18 @@ import logger;
 
 namespace infinity {
 
+namespace {
+
+// Project, aggregate, top and limit read their input blocks through the selection of the filter below them,
+// so the filter doesn't need to copy the rows passing it.
+void AcceptFilterSelection(PhysicalOperator *input_physical_operator) {
+    if (input_physical_operator != nullptr && input_physical_operator->operator_type() == PhysicalOperatorType::kFilter) {
+        static_cast<PhysicalFilter *>(input_physical_operator)->SetOutputSelection(true);
+    }
+}
+
+} // namespace
+
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildPhysicalOperator(const SharedPtr<LogicalNode> &logical_operator) const {
 
     UniquePtr<PhysicalOperator> result{nullptr};
@@ -365,18 +377,6 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildCreateIndex(const SharedPtr<Lo
     auto logical_create_index = static_pointer_cast<LogicalCreateIndex>(logical_operator);
     SharedPtr<String> schema_name = logical_create_index->base_table_ref()->schema_name();
     SharedPtr<String> table_name = logical_create_index->base_table_ref()->table_name();
-    const auto &index_def_ptr = logical_create_index->index_definition();
-    if (index_def_ptr->index_type_ != IndexType::kHnsw) {
-        // TODO: support other index types build in parallel.
-        return MakeUnique<PhysicalCreateIndexPrepare>(logical_create_index->node_id(),
-                                                      logical_create_index->base_table_ref(),
-                                                      logical_create_index->index_definition(),
-                                                      logical_create_index->conflict_type(),
-                                                      logical_create_index->GetOutputNames(),
-                                                      logical_create_index->GetOutputTypes(),
-                                                      logical_create_index->load_metas(),
-                                                      false);
-    }
 
     // use new `PhysicalCreateIndexPrepare` `PhysicalCreateIndexDo` `PhysicalCreateIndexFinish`
     auto create_index_prepare = MakeUnique<PhysicalCreateIndexPrepare>(logical_create_index->node_id(),
@@ -386,7 +386,8 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildCreateIndex(const SharedPtr<Lo
                                                                        logical_create_index->GetOutputNames(),
                                                                        logical_create_index->GetOutputTypes(),
                                                                        logical_create_index->load_metas(),
-                                                                       true);
+                                                                       true,
+                                                                       logical_create_index->resume());
     auto create_index_do = MakeUnique<PhysicalCreateIndexDo>(logical_create_index->node_id(),
                                                              std::move(create_index_prepare),
                                                              logical_create_index->base_table_ref(),
@@ -569,6 +570,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildExport(const SharedPtr<Logical
                                       logical_export->offset(),
                                       logical_export->limit(),
                                       logical_export->row_limit(),
+                                      logical_export->compression_type(),
                                       logical_export->column_idx_array(),
                                       logical_export->block_index(),
                                       logical_operator->load_metas());
@@ -615,6 +617,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildAggregate(const SharedPtr<Logi
     }
 
     SizeT tasklet_count = input_physical_operator->TaskletCount();
+    AcceptFilterSelection(input_physical_operator.get());
 
     auto physical_agg_op = MakeUnique<PhysicalAggregate>(logical_aggregate->node_id(),
                                                          std::move(input_physical_operator),
@@ -627,6 +630,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildAggregate(const SharedPtr<Logi
     if (tasklet_count == 1) {
         return physical_agg_op;
     } else {
+        physical_agg_op->SetMergePartialStates();
         return MakeUnique<PhysicalMergeAggregate>(query_context_ptr_->GetNextNodeID(),
                                                   logical_aggregate->base_table_ref_,
                                                   std::move(physical_agg_op),
@@ -731,6 +735,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildLimit(const SharedPtr<LogicalN
 
     SharedPtr<LogicalLimit> logical_limit = static_pointer_cast<LogicalLimit>(logical_operator);
     UniquePtr<PhysicalOperator> input_physical_operator = BuildPhysicalOperator(input_logical_node);
+    AcceptFilterSelection(input_physical_operator.get());
     if (input_physical_operator->TaskletCount() <= 1) {
         return MakeUnique<PhysicalLimit>(logical_operator->node_id(),
                                          std::move(input_physical_operator),
@@ -768,6 +773,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildTop(const SharedPtr<LogicalNod
         UnrecoverableError(error_message);
     }
     auto input_physical_operator = BuildPhysicalOperator(input_logical_node);
+    AcceptFilterSelection(input_physical_operator.get());
     i64 merge_offset{};
     i64 merge_limit = (static_pointer_cast<ValueExpression>(logical_operator_top->limit_expression_))->GetValue().value_.big_int;
     if (auto &offset = logical_operator_top->offset_expression_; offset.get() != nullptr) {
@@ -825,6 +831,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildProjection(const SharedPtr<Log
     UniquePtr<PhysicalOperator> input_physical_operator{};
     if (input_logical_node.get() != nullptr) {
         input_physical_operator = BuildPhysicalOperator(input_logical_node);
+        AcceptFilterSelection(input_physical_operator.get());
     }
     return MakeUnique<PhysicalProject>(logical_operator->node_id(),
                                        logical_project->table_index_,
@@ -887,19 +894,22 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildTableScan(const SharedPtr<Logi
     SharedPtr<LogicalTableScan> logical_table_scan = static_pointer_cast<LogicalTableScan>(logical_operator);
     return MakeUnique<PhysicalTableScan>(logical_operator->node_id(),
                                          logical_table_scan->base_table_ref_,
-                                         std::move(logical_table_scan->fast_rough_filter_evaluator_),
+                                         logical_table_scan->fast_rough_filter_evaluator_,
                                          logical_operator->load_metas(),
                                          logical_table_scan->add_row_id_);
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildIndexScan(const SharedPtr<LogicalNode> &logical_operator) const {
     SharedPtr<LogicalIndexScan> logical_index_scan = static_pointer_cast<LogicalIndexScan>(logical_operator);
+    // Copy instead of move: the logical plan may be cached by a prepared statement and planned again.
+    auto column_index_map = logical_index_scan->column_index_map_;
+    auto filter_execute_command = logical_index_scan->filter_execute_command_;
     return MakeUnique<PhysicalIndexScan>(logical_operator->node_id(),
                                          logical_index_scan->base_table_ref_,
                                          logical_index_scan->index_filter_qualified_,
-                                         std::move(logical_index_scan->column_index_map_),
-                                         std::move(logical_index_scan->filter_execute_command_),
-                                         std::move(logical_index_scan->fast_rough_filter_evaluator_),
+                                         std::move(column_index_map),
+                                         std::move(filter_execute_command),
+                                         logical_index_scan->fast_rough_filter_evaluator_,
                                          logical_operator->load_metas(),
                                          logical_operator->GetOutputNames(),
                                          logical_operator->GetOutputTypes(),
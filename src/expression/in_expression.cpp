@@ -25,8 +25,12 @@ module in_expression;
 
 namespace infinity {
 
-InExpression::InExpression(InType in_type, SharedPtr<BaseExpression> left_operand, const Vector<SharedPtr<BaseExpression>> &value_list)
-    : BaseExpression(ExpressionType::kIn, value_list), left_operand_ptr_(std::move(left_operand)), in_type_(in_type) {}
+InExpression::InExpression(InType in_type,
+                           SharedPtr<BaseExpression> left_operand,
+                           const Vector<SharedPtr<BaseExpression>> &value_list,
+                           bool has_null_value)
+    : BaseExpression(ExpressionType::kIn, value_list), left_operand_ptr_(std::move(left_operand)), in_type_(in_type),
+      has_null_value_(has_null_value) {}
 
 String InExpression::ToString() const {
 
@@ -55,6 +59,9 @@ String InExpression::ToString() const {
     for (auto &argument_ptr : arguments_) {
         op << argument_ptr->Name() << ", ";
     }
+    if (has_null_value_) {
+        op << "NULL, ";
+    }
 
     op << ")" << std::endl;
 
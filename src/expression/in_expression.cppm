@@ -33,7 +33,10 @@ export enum class InType {
 
 export class InExpression : public BaseExpression {
 public:
-    InExpression(InType in_type, SharedPtr<BaseExpression> left_operand, const Vector<SharedPtr<BaseExpression>> &value_list);
+    InExpression(InType in_type,
+                 SharedPtr<BaseExpression> left_operand,
+                 const Vector<SharedPtr<BaseExpression>> &value_list,
+                 bool has_null_value = false);
 
     String ToString() const override;
 
@@ -45,9 +48,13 @@ public:
 
     inline InType in_type() const { return in_type_; }
 
+    // NULL literals aren't kept in the value list, only whether there was one
+    inline bool has_null_value() const { return has_null_value_; }
+
 private:
     SharedPtr<BaseExpression> left_operand_ptr_;
     InType in_type_;
+    bool has_null_value_{false};
 };
 
 } // namespace infinity
@@ -40,6 +40,9 @@ public:
 
     const Value &GetValue() const { return value_; }
 
+    // Only the parameter slots of a cached prepared plan are rewritten, see PreparedPlan::TryReuse().
+    void SetValue(Value value) { value_ = std::move(value); }
+
 private:
     Value value_;
 };
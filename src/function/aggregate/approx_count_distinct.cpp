@@ -0,0 +1,181 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+module approx_count_distinct;
+
+import stl;
+import catalog;
+import infinity_exception;
+import aggregate_function;
+import aggregate_function_set;
+import column_vector;
+
+import third_party;
+import logical_type;
+import internal_types;
+import data_type;
+
+namespace infinity {
+
+namespace {
+
+// Finalizer of 64 bit MurmurHash3, every input bit affects every output bit
+inline u64 MixHash(u64 key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return key;
+}
+
+template <typename ValueType>
+inline u64 HashValue(const ValueType &value) {
+    static_assert(sizeof(ValueType) <= sizeof(u64));
+    if constexpr (std::is_floating_point_v<ValueType>) {
+        if (value == 0) {
+            // 0.0 and -0.0 are the same value
+            return MixHash(0);
+        }
+    }
+    u64 bits = 0;
+    std::memcpy(&bits, &value, sizeof(ValueType));
+    return MixHash(bits);
+}
+
+// HyperLogLog with 2^14 one byte registers, the standard error of the estimate is about 0.8%
+struct HyperLogLog {
+    static constexpr u32 kPrecision = 14;
+    static constexpr SizeT kRegisterCount = SizeT(1) << kPrecision;
+
+    u8 registers_[kRegisterCount];
+
+    void Initialize() { std::memset(registers_, 0, kRegisterCount); }
+
+    inline void Add(u64 hash) {
+        // The first bits choose the register, which keeps the longest run of leading zeros of the other bits
+        const SizeT register_idx = hash >> (64 - kPrecision);
+        const u64 rest = hash << kPrecision;
+        const u8 rank = rest == 0 ? 64 - kPrecision + 1 : std::countl_zero(rest) + 1;
+        registers_[register_idx] = std::max(registers_[register_idx], rank);
+    }
+
+    void Merge(const HyperLogLog &other) {
+        for (SizeT idx = 0; idx < kRegisterCount; ++idx) {
+            registers_[idx] = std::max(registers_[idx], other.registers_[idx]);
+        }
+    }
+
+    i64 Estimate() const {
+        f64 sum = 0;
+        SizeT zero_count = 0;
+        for (SizeT idx = 0; idx < kRegisterCount; ++idx) {
+            sum += std::ldexp(1.0, -registers_[idx]);
+            zero_count += registers_[idx] == 0;
+        }
+        const f64 m = kRegisterCount;
+        const f64 alpha = 0.7213 / (1 + 1.079 / m);
+        f64 estimate = alpha * m * m / sum;
+        if (estimate <= 2.5 * m && zero_count > 0) {
+            // Linear counting is more accurate for small cardinalities
+            estimate = m * std::log(m / zero_count);
+        }
+        return std::llround(estimate);
+    }
+};
+
+template <typename ValueType>
+struct ApproxCountDistinctState {
+public:
+    HyperLogLog sketch_;
+    i64 result_;
+
+    inline void Initialize() {
+        sketch_.Initialize();
+        result_ = 0;
+    }
+
+    inline void Update(const ValueType *__restrict input, SizeT idx) {
+        if constexpr (std::is_same_v<ValueType, VarcharT>) {
+            String error_message = "Varchar is hashed from its column vector";
+            UnrecoverableError(error_message);
+        } else {
+            sketch_.Add(HashValue(input[idx]));
+        }
+    }
+
+    inline void ConstantUpdate(const ValueType *__restrict input, SizeT idx, SizeT) { Update(input, idx); }
+
+    inline void Merge(const ApproxCountDistinctState &other) { sketch_.Merge(other.sketch_); }
+
+    inline ptr_t Finalize() {
+        result_ = sketch_.Estimate();
+        return (ptr_t)&result_;
+    }
+
+    inline static SizeT Size(const DataType &) { return sizeof(ApproxCountDistinctState); }
+};
+
+// Long strings are out of line, so they are read through the column vector
+void UpdateVarcharState(const ptr_t state, const SharedPtr<ColumnVector> &input_column_vector) {
+    auto *count_distinct_state = (ApproxCountDistinctState<VarcharT> *)state;
+    SizeT row_count = input_column_vector->vector_type() == ColumnVectorType::kConstant ? 1 : input_column_vector->Size();
+    for (SizeT idx = 0; idx < row_count; ++idx) {
+        Span<const char> value = input_column_vector->GetVarchar(idx);
+        count_distinct_state->sketch_.Add(MixHash(std::hash<std::string_view>{}(std::string_view(value.data(), value.size()))));
+    }
+}
+
+template <typename ValueType>
+void AddFunction(const String &func_name, SharedPtr<AggregateFunctionSet> &function_set_ptr, LogicalType logical_type) {
+    AggregateFunction function = MergeableUnaryAggregate<ApproxCountDistinctState<ValueType>, ValueType, BigIntT>(func_name,
+                                                                                                                   DataType(logical_type),
+                                                                                                                   DataType(LogicalType::kBigInt));
+    if constexpr (std::is_same_v<ValueType, VarcharT>) {
+        function.update_func_ = UpdateVarcharState;
+    }
+    function_set_ptr->AddFunction(function);
+}
+
+} // namespace
+
+void RegisterApproxCountDistinctFunction(const UniquePtr<Catalog> &catalog_ptr) {
+    String func_name = "APPROX_COUNT_DISTINCT";
+
+    SharedPtr<AggregateFunctionSet> function_set_ptr = MakeShared<AggregateFunctionSet>(func_name);
+
+    AddFunction<TinyIntT>(func_name, function_set_ptr, LogicalType::kTinyInt);
+    AddFunction<SmallIntT>(func_name, function_set_ptr, LogicalType::kSmallInt);
+    AddFunction<IntegerT>(func_name, function_set_ptr, LogicalType::kInteger);
+    AddFunction<BigIntT>(func_name, function_set_ptr, LogicalType::kBigInt);
+    AddFunction<FloatT>(func_name, function_set_ptr, LogicalType::kFloat);
+    AddFunction<DoubleT>(func_name, function_set_ptr, LogicalType::kDouble);
+    AddFunction<DateT>(func_name, function_set_ptr, LogicalType::kDate);
+    AddFunction<TimeT>(func_name, function_set_ptr, LogicalType::kTime);
+    AddFunction<DateTimeT>(func_name, function_set_ptr, LogicalType::kDateTime);
+    AddFunction<TimestampT>(func_name, function_set_ptr, LogicalType::kTimestamp);
+    AddFunction<VarcharT>(func_name, function_set_ptr, LogicalType::kVarchar);
+
+    Catalog::AddFunctionSet(catalog_ptr.get(), function_set_ptr);
+}
+
+} // namespace infinity
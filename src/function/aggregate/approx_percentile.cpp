@@ -0,0 +1,220 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+module approx_percentile;
+
+import stl;
+import catalog;
+import infinity_exception;
+import aggregate_function;
+import aggregate_function_set;
+
+import third_party;
+import logical_type;
+import internal_types;
+import data_type;
+
+namespace infinity {
+
+namespace {
+
+struct Centroid {
+    f64 mean_;
+    f64 weight_;
+};
+
+// Merging t-digest. Values are buffered and, when the buffer is full, sorted together with the centroids and merged
+// into new centroids. The k1 scale function keeps the centroids small near the tails, so extreme quantiles stay accurate.
+// The digest lives in a raw state buffer, so it has a fixed size and doesn't allocate.
+struct TDigest {
+    static constexpr f64 kCompression = 100;
+    static constexpr SizeT kMaxCentroidCount = 2 * SizeT(kCompression) + 8;
+    static constexpr SizeT kBufferSize = 512;
+
+    Centroid centroids_[kMaxCentroidCount + kBufferSize];
+    SizeT centroid_count_;
+    SizeT buffer_count_;
+    f64 total_weight_;
+    f64 min_;
+    f64 max_;
+
+    void Initialize() {
+        centroid_count_ = 0;
+        buffer_count_ = 0;
+        total_weight_ = 0;
+        min_ = std::numeric_limits<f64>::infinity();
+        max_ = -std::numeric_limits<f64>::infinity();
+    }
+
+    inline void Add(f64 value, f64 weight = 1) {
+        if (std::isnan(value)) {
+            return;
+        }
+        if (buffer_count_ == kBufferSize) {
+            Compress();
+        }
+        centroids_[centroid_count_ + buffer_count_++] = Centroid{value, weight};
+        total_weight_ += weight;
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+    }
+
+    void Merge(const TDigest &other) {
+        const SizeT other_count = other.centroid_count_ + other.buffer_count_;
+        for (SizeT idx = 0; idx < other_count; ++idx) {
+            Add(other.centroids_[idx].mean_, other.centroids_[idx].weight_);
+        }
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+    }
+
+    void Compress() {
+        if (buffer_count_ == 0) {
+            return;
+        }
+        const SizeT count = centroid_count_ + buffer_count_;
+        std::sort(centroids_, centroids_ + count, [](const Centroid &left, const Centroid &right) { return left.mean_ < right.mean_; });
+
+        SizeT output_count = 0;
+        f64 weight_so_far = 0;
+        f64 weight_limit = total_weight_ * QuantileLimit(0);
+        Centroid current = centroids_[0];
+        for (SizeT idx = 1; idx < count; ++idx) {
+            const Centroid &next = centroids_[idx];
+            if (weight_so_far + current.weight_ + next.weight_ <= weight_limit || output_count + 1 == kMaxCentroidCount) {
+                current.weight_ += next.weight_;
+                current.mean_ += (next.mean_ - current.mean_) * next.weight_ / current.weight_;
+            } else {
+                weight_so_far += current.weight_;
+                weight_limit = total_weight_ * QuantileLimit(weight_so_far / total_weight_);
+                centroids_[output_count++] = current;
+                current = next;
+            }
+        }
+        centroids_[output_count++] = current;
+        centroid_count_ = output_count;
+        buffer_count_ = 0;
+    }
+
+    f64 Quantile(f64 quantile) {
+        Compress();
+        if (centroid_count_ == 0) {
+            return 0;
+        }
+        if (centroid_count_ == 1) {
+            return centroids_[0].mean_;
+        }
+        // Each centroid is assumed to be centered at the middle of its weight, values are interpolated between the centers
+        const f64 target = quantile * total_weight_;
+        const Centroid &first = centroids_[0];
+        if (target < first.weight_ / 2) {
+            return min_ + (first.mean_ - min_) * target / (first.weight_ / 2);
+        }
+        f64 weight_so_far = first.weight_ / 2;
+        for (SizeT idx = 1; idx < centroid_count_; ++idx) {
+            const Centroid &left = centroids_[idx - 1];
+            const Centroid &right = centroids_[idx];
+            const f64 gap = (left.weight_ + right.weight_) / 2;
+            if (target < weight_so_far + gap) {
+                return left.mean_ + (right.mean_ - left.mean_) * (target - weight_so_far) / gap;
+            }
+            weight_so_far += gap;
+        }
+        const Centroid &last = centroids_[centroid_count_ - 1];
+        const f64 tail = last.weight_ / 2;
+        return last.mean_ + (max_ - last.mean_) * std::min(1.0, (target - weight_so_far) / tail);
+    }
+
+private:
+    // The quantile where the centroid starting at `quantile` must end, k(q) = compression / (2 * pi) * asin(2q - 1)
+    static f64 QuantileLimit(f64 quantile) {
+        const f64 k = kCompression / (2 * std::numbers::pi) * std::asin(2 * quantile - 1);
+        const f64 next_k = std::min(k + 1, kCompression / 4);
+        return (std::sin(next_k * 2 * std::numbers::pi / kCompression) + 1) / 2;
+    }
+};
+
+struct ApproxPercentileStateBase {
+    f64 quantile_;
+    TDigest digest_;
+    f64 result_;
+};
+
+template <typename ValueType>
+struct ApproxPercentileState : public ApproxPercentileStateBase {
+public:
+    inline void Initialize() {
+        quantile_ = 0.5;
+        digest_.Initialize();
+        result_ = 0;
+    }
+
+    inline void Update(const ValueType *__restrict input, SizeT idx) { digest_.Add(static_cast<f64>(input[idx])); }
+
+    inline void ConstantUpdate(const ValueType *__restrict input, SizeT idx, SizeT count) { digest_.Add(static_cast<f64>(input[idx]), count); }
+
+    inline void Merge(const ApproxPercentileState &other) { digest_.Merge(other.digest_); }
+
+    inline ptr_t Finalize() {
+        result_ = digest_.Quantile(quantile_);
+        return (ptr_t)&result_;
+    }
+
+    inline static SizeT Size(const DataType &) { return sizeof(ApproxPercentileState); }
+};
+
+template <typename ValueType>
+void AddFunction(const String &func_name, SharedPtr<AggregateFunctionSet> &function_set_ptr, LogicalType logical_type) {
+    AggregateFunction function =
+        MergeableUnaryAggregate<ApproxPercentileState<ValueType>, ValueType, DoubleT>(func_name, DataType(logical_type), DataType(LogicalType::kDouble));
+    function_set_ptr->AddFunction(function);
+}
+
+} // namespace
+
+void RegisterApproxPercentileFunction(const UniquePtr<Catalog> &catalog_ptr) {
+    String func_name = "APPROX_PERCENTILE";
+
+    SharedPtr<AggregateFunctionSet> function_set_ptr = MakeShared<AggregateFunctionSet>(func_name);
+
+    AddFunction<TinyIntT>(func_name, function_set_ptr, LogicalType::kTinyInt);
+    AddFunction<SmallIntT>(func_name, function_set_ptr, LogicalType::kSmallInt);
+    AddFunction<IntegerT>(func_name, function_set_ptr, LogicalType::kInteger);
+    AddFunction<BigIntT>(func_name, function_set_ptr, LogicalType::kBigInt);
+    AddFunction<FloatT>(func_name, function_set_ptr, LogicalType::kFloat);
+    AddFunction<DoubleT>(func_name, function_set_ptr, LogicalType::kDouble);
+
+    Catalog::AddFunctionSet(catalog_ptr.get(), function_set_ptr);
+}
+
+void BindApproxPercentile(AggregateFunction &function, f64 quantile) {
+    if (quantile < 0 || quantile > 1) {
+        String error_message = fmt::format("Percentile {} isn't in [0, 1]", quantile);
+        UnrecoverableError(error_message);
+    }
+    // Every state type of the function starts with ApproxPercentileStateBase
+    function.init_func_ = [init_func = std::move(function.init_func_), quantile](ptr_t state) {
+        init_func(state);
+        ((ApproxPercentileStateBase *)state)->quantile_ = quantile;
+    };
+}
+
+} // namespace infinity
@@ -0,0 +1,31 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module approx_percentile;
+
+import stl;
+import aggregate_function;
+
+namespace infinity {
+
+class Catalog;
+
+export void RegisterApproxPercentileFunction(const UniquePtr<Catalog> &catalog_ptr);
+
+// Set the quantile in [0, 1] which `function` computes, the median is computed if it isn't set
+export void BindApproxPercentile(AggregateFunction &function, f64 quantile);
+
+} // namespace infinity
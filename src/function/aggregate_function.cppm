@@ -35,6 +35,7 @@ namespace infinity {
 using AggregateInitializeFuncType = std::function<void(ptr_t)>;
 using AggregateUpdateFuncType = std::function<void(ptr_t, const SharedPtr<ColumnVector> &)>;
 using AggregateFinalizeFuncType = std::function<ptr_t(ptr_t)>;
+using AggregateMergeFuncType = std::function<void(ptr_t, const_ptr_t)>;
 
 class AggregateOperation {
 public:
@@ -98,6 +99,11 @@ public:
         }
     }
 
+    template <typename AggregateState>
+    static inline void StateMerge(const ptr_t state, const_ptr_t other_state) {
+        ((AggregateState *)state)->Merge(*(const AggregateState *)other_state);
+    }
+
     template <typename AggregateState, typename ResultType>
     static inline ptr_t StateFinalize(const ptr_t state) {
         // Loop execute state update according to the input column vector
@@ -133,6 +139,8 @@ public:
     AggregateInitializeFuncType init_func_;
     AggregateUpdateFuncType update_func_;
     AggregateFinalizeFuncType finalize_func_;
+    // Set for the functions whose partial states of parallel tasks are merged, see PhysicalMergeAggregate
+    AggregateMergeFuncType merge_func_{};
 
     DataType argument_type_;
     DataType return_type_;
@@ -151,4 +159,12 @@ inline AggregateFunction UnaryAggregate(const String &name, const DataType &inpu
                              AggregateOperation::StateFinalize<AggregateState, ResultType>);
 }
 
+// An aggregate whose state has a Merge(const AggregateState &) method
+export template <typename AggregateState, typename InputType, typename ResultType>
+inline AggregateFunction MergeableUnaryAggregate(const String &name, const DataType &input_type, const DataType &return_type) {
+    AggregateFunction function = UnaryAggregate<AggregateState, InputType, ResultType>(name, input_type, return_type);
+    function.merge_func_ = AggregateOperation::StateMerge<AggregateState>;
+    return function;
+}
+
 } // namespace infinity
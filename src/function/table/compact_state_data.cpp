@@ -63,6 +63,42 @@ RowID RowIDRemap::GetNewRowID(RowID old_row_id) const {
     return GetNewRowID(old_row_id.segment_id_, old_row_id.segment_offset_ / block_capacity_, old_row_id.segment_offset_ % block_capacity_);
 }
 
+Vector<SegmentOffset> CompactSegmentData::GetRowMap(SegmentID old_segment_id, SizeT old_row_count) const {
+    Vector<SegmentOffset> row_map(old_row_count, INVALID_SEGMENT_OFFSET);
+    for (const auto &row_range : row_ranges_) {
+        if (row_range.old_segment_id_ != old_segment_id) {
+            continue;
+        }
+        if (row_range.old_offset_ + row_range.row_count_ > old_row_count) {
+            UnrecoverableError(fmt::format("Compacted rows {}..{} are out of segment {}",
+                                           row_range.old_offset_,
+                                           row_range.old_offset_ + row_range.row_count_,
+                                           old_segment_id));
+        }
+        for (u32 i = 0; i < row_range.row_count_; ++i) {
+            row_map[row_range.old_offset_ + i] = row_range.new_offset_ + i;
+        }
+    }
+    return row_map;
+}
+
+bool CompactSegmentData::KeepRowOrder() const {
+    HashMap<SegmentID, SizeT> segment_positions;
+    for (SizeT i = 0; i < old_segments_.size(); ++i) {
+        segment_positions.emplace(old_segments_[i]->segment_id(), i);
+    }
+    for (SizeT i = 1; i < row_ranges_.size(); ++i) {
+        const auto &prev = row_ranges_[i - 1];
+        const auto &cur = row_ranges_[i];
+        SizeT prev_position = segment_positions.at(prev.old_segment_id_);
+        SizeT cur_position = segment_positions.at(cur.old_segment_id_);
+        if (cur_position < prev_position || (cur_position == prev_position && cur.old_offset_ < prev.old_offset_ + prev.row_count_)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void CompactStateData::AddToDelete(TxnTimeStamp commit_ts, SegmentID segment_id, Vector<SegmentOffset> delete_offsets) {
     std::lock_guard lock(mutex_);
     to_delete_.emplace_back(commit_ts, segment_id, std::move(delete_offsets));
@@ -78,12 +114,15 @@ Vector<Pair<SegmentID, Vector<SegmentOffset>>> CompactStateData::GetToDelete() c
     return res;
 }
 
-void CompactStateData::AddNewSegment(SharedPtr<SegmentEntry> new_segment, Vector<SegmentEntry *> compacted_segments, Txn *txn) {
+void CompactStateData::AddNewSegment(SharedPtr<SegmentEntry> new_segment,
+                                     Vector<SegmentEntry *> compacted_segments,
+                                     Vector<CompactRowRange> row_ranges,
+                                     Txn *txn) {
     std::lock_guard lock(mutex2_);
     auto *block_index = new_table_ref_->block_index_.get();
     block_index->Insert(new_segment.get(), txn);
 
-    CompactSegmentData data{new_segment, std::move(compacted_segments)};
+    CompactSegmentData data{new_segment, std::move(compacted_segments), std::move(row_ranges)};
     segment_data_list_.push_back(std::move(data));
 }
 
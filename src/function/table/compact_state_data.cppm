@@ -53,10 +53,26 @@ private:
     RowIDMap row_id_map_;
 };
 
+// Consecutive rows of a compacted segment copied to the new segment
+export struct CompactRowRange {
+    SegmentID old_segment_id_{};
+    SegmentOffset old_offset_{};
+    SegmentOffset new_offset_{};
+    u32 row_count_{};
+};
+
 export class CompactSegmentData {
+public:
+    // New segment offset of each row of a compacted segment, INVALID_SEGMENT_OFFSET for the rows which were not copied
+    Vector<SegmentOffset> GetRowMap(SegmentID old_segment_id, SizeT old_row_count) const;
+
+    // The compacted segments follow each other in the new segment, in the order of `old_segments_`, and their rows keep their order
+    bool KeepRowOrder() const;
+
 public:
     SharedPtr<SegmentEntry> new_segment_{};
     Vector<SegmentEntry *> old_segments_{};
+    Vector<CompactRowRange> row_ranges_{}; // in the order of the new segment
 };
 
 export class CompactStateData {
@@ -67,7 +83,7 @@ public:
 
     Vector<Pair<SegmentID, Vector<SegmentOffset>>> GetToDelete() const;
 
-    void AddNewSegment(SharedPtr<SegmentEntry> new_segment, Vector<SegmentEntry *> compacted_segments, Txn *txn);
+    void AddNewSegment(SharedPtr<SegmentEntry> new_segment, Vector<SegmentEntry *> compacted_segments, Vector<CompactRowRange> row_ranges, Txn *txn);
 
     void AddNewIndex(TableIndexEntry *table_index_entry, Txn *txn);
 
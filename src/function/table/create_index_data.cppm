@@ -22,6 +22,7 @@ import block_index;
 import third_party;
 import infinity_exception;
 import logger;
+import index_build_tracer;
 
 namespace infinity {
 
@@ -41,6 +42,9 @@ export struct CreateIndexSharedData {
     }
 
     HashMap<u32, atomic_u64> create_index_idxes_{};
+
+    // Listed by SHOW INDEX BUILDS until the statement is done
+    SharedPtr<IndexBuildJob> build_job_{};
 };
 
 }; // namespace infinity
\ No newline at end of file
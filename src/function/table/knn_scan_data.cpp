@@ -51,14 +51,20 @@ KnnDistance1<f32, f32>::KnnDistance1(KnnDistanceType dist_type) {
     switch (dist_type) {
         case KnnDistanceType::kL2: {
             dist_func_ = GetSIMD_FUNCTIONS().L2Distance_func_ptr_;
+            f16_dist_func_ = GetSIMD_FUNCTIONS().F32F16L2Distance_func_ptr_;
+            bf16_dist_func_ = GetSIMD_FUNCTIONS().F32BF16L2Distance_func_ptr_;
             break;
         }
         case KnnDistanceType::kCosine: {
             dist_func_ = GetSIMD_FUNCTIONS().CosineDistance_func_ptr_;
+            f16_dist_func_ = GetSIMD_FUNCTIONS().F32F16CosineDistance_func_ptr_;
+            bf16_dist_func_ = GetSIMD_FUNCTIONS().F32BF16CosineDistance_func_ptr_;
             break;
         }
         case KnnDistanceType::kInnerProduct: {
             dist_func_ = GetSIMD_FUNCTIONS().IPDistance_func_ptr_;
+            f16_dist_func_ = GetSIMD_FUNCTIONS().F32F16IPDistance_func_ptr_;
+            bf16_dist_func_ = GetSIMD_FUNCTIONS().F32BF16IPDistance_func_ptr_;
             break;
         }
         default: {
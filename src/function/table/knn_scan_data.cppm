@@ -42,6 +42,7 @@ public:
     KnnScanSharedData(SharedPtr<BaseTableRef> table_ref,
                       UniquePtr<Vector<BlockColumnEntry *>> block_column_entries,
                       UniquePtr<Vector<SegmentIndexEntry *>> index_entries,
+                      UniquePtr<Vector<Pair<u32, u32>>> index_chunk_slots,
                       Vector<InitParameter> opt_params,
                       i64 topk,
                       i64 dimension,
@@ -50,14 +51,29 @@ public:
                       EmbeddingDataType elem_type,
                       KnnDistanceType knn_distance_type)
         : table_ref_(table_ref), block_column_entries_(std::move(block_column_entries)), index_entries_(std::move(index_entries)),
-          opt_params_(std::move(opt_params)), topk_(topk), dimension_(dimension), query_count_(query_embedding_count),
-          query_embedding_(query_embedding), query_elem_type_(elem_type), knn_distance_type_(knn_distance_type) {}
+          index_chunk_slots_(std::move(index_chunk_slots)), opt_params_(std::move(opt_params)), topk_(topk), dimension_(dimension),
+          query_count_(query_embedding_count), query_embedding_(query_embedding), query_elem_type_(elem_type),
+          knn_distance_type_(knn_distance_type), hnsw_dist_bounds_(MakeUnique<Atomic<f32>[]>(query_embedding_count)) {
+        for (u64 i = 0; i < query_count_; ++i) {
+            hnsw_dist_bounds_[i].store(std::numeric_limits<f32>::max());
+        }
+    }
+
+    f32 GetHnswDistBound(u64 query_idx) const { return hnsw_dist_bounds_[query_idx].load(std::memory_order_relaxed); }
+
+    void UpdateHnswDistBound(u64 query_idx, f32 dist) {
+        f32 old_dist = hnsw_dist_bounds_[query_idx].load(std::memory_order_relaxed);
+        while (dist < old_dist && !hnsw_dist_bounds_[query_idx].compare_exchange_weak(old_dist, dist, std::memory_order_relaxed)) {
+        }
+    }
 
 public:
     const SharedPtr<BaseTableRef> table_ref_{};
 
     const UniquePtr<Vector<BlockColumnEntry *>> block_column_entries_{};
     const UniquePtr<Vector<SegmentIndexEntry *>> index_entries_{};
+    // (chunk slot, slot count) of each index task, the chunks of one segment index may be searched by several tasks
+    const UniquePtr<Vector<Pair<u32, u32>>> index_chunk_slots_{};
 
     const Vector<InitParameter> opt_params_{};
     const i64 topk_;
@@ -69,6 +85,10 @@ public:
 
     atomic_u64 current_block_idx_{0};
     atomic_u64 current_index_idx_{0};
+
+private:
+    // k-th best hnsw distance of each query found by any index task so far
+    UniquePtr<Atomic<f32>[]> hnsw_dist_bounds_{};
 };
 
 //-------------------------------------------------------------------
@@ -103,8 +123,12 @@ public:
 
 public:
     using DistFunc = DistType (*)(const QueryDataType *, const QueryDataType *, SizeT);
+    // Rows of float16 or bfloat16 given as raw bits, only set for f32 queries
+    using HalfDistFunc = DistType (*)(const QueryDataType *, const u16 *, SizeT);
 
     DistFunc dist_func_{};
+    HalfDistFunc f16_dist_func_{};
+    HalfDistFunc bf16_dist_func_{};
 };
 
 template <>
@@ -23,9 +23,66 @@ import infinity_context;
 import logger;
 import infinity_exception;
 import peer_server_thrift_types;
+import status;
+import storage;
+import wal_manager;
+import wal_entry;
+import persistence_manager;
 
 namespace infinity {
 
+namespace {
+
+// Import, compact and dump index entries refer to the files persisted by leader, which a follower reads from the persistence
+// dir it shares with the leader. An entry whose files aren't there can't be applied.
+Status CheckSyncedFiles(const WalEntry &wal_entry) {
+    PersistenceManager *pm = InfinityContext::instance().persistence_manager();
+    for (const SharedPtr<WalCmd> &cmd : wal_entry.cmds_) {
+        Vector<const AddrSerializer *> addr_serializers;
+        switch (cmd->GetType()) {
+            case WalCommandType::IMPORT: {
+                for (const WalBlockInfo &block_info : static_cast<const WalCmdImport &>(*cmd).segment_info_.block_infos_) {
+                    addr_serializers.push_back(&block_info.addr_serializer_);
+                }
+                break;
+            }
+            case WalCommandType::COMPACT: {
+                for (const WalSegmentInfo &segment_info : static_cast<const WalCmdCompact &>(*cmd).new_segment_infos_) {
+                    for (const WalBlockInfo &block_info : segment_info.block_infos_) {
+                        addr_serializers.push_back(&block_info.addr_serializer_);
+                    }
+                }
+                break;
+            }
+            case WalCommandType::DUMP_INDEX: {
+                for (const WalChunkIndexInfo &chunk_info : static_cast<const WalCmdDumpIndex &>(*cmd).chunk_infos_) {
+                    addr_serializers.push_back(&chunk_info.addr_serializer_);
+                }
+                break;
+            }
+            default: {
+                // The other entries carry their data, optimize rebuilds the index chunks this node already has
+                continue;
+            }
+        }
+        const String cmd_type = WalCmd::WalCommandTypeToString(cmd->GetType());
+        if (pm == nullptr) {
+            return Status::NotSupport(fmt::format("{} entry can only be synced with the persistence dir of leader shared", cmd_type));
+        }
+        for (const AddrSerializer *addr_serializer : addr_serializers) {
+            for (SizeT i = 0; i < addr_serializer->paths_.size(); ++i) {
+                if (!pm->ObjExists(addr_serializer->obj_addrs_[i])) {
+                    return Status::InvalidNodeStatus(
+                        fmt::format("File {} of {} entry isn't in the persistence dir shared with leader", addr_serializer->paths_[i], cmd_type));
+                }
+            }
+        }
+    }
+    return Status::OK();
+}
+
+} // namespace
+
 ClusterManager::~ClusterManager() {
     other_nodes_.clear();
     this_node_.reset();
@@ -82,6 +139,16 @@ Status ClusterManager::InitAsFollower(const String &node_name, const String &lea
         return client_status;
     }
 
+    {
+        // The data of this node is complete up to its timestamp, the leader ships the entries committed after it
+        std::unique_lock<std::mutex> sync_log_lock(sync_log_mutex_);
+        last_synced_ts_ = txn_manager_->CurrentTS();
+    }
+    if (PersistenceManager *pm = InfinityContext::instance().persistence_manager(); pm != nullptr) {
+        // The objects of the shared persistence dir are removed by leader
+        pm->SetSharedWorkspace(true);
+    }
+
     // Register to leader;
     SharedPtr<RegisterPeerTask> register_peer_task = MakeShared<RegisterPeerTask>(this_node_->node_name_,
                                                                                   this_node_->node_role_,
@@ -143,6 +210,16 @@ Status ClusterManager::InitAsLearner(const String &node_name, const String &lead
         return client_status;
     }
 
+    {
+        // The data of this node is complete up to its timestamp, the leader ships the entries committed after it
+        std::unique_lock<std::mutex> sync_log_lock(sync_log_mutex_);
+        last_synced_ts_ = txn_manager_->CurrentTS();
+    }
+    if (PersistenceManager *pm = InfinityContext::instance().persistence_manager(); pm != nullptr) {
+        // The objects of the shared persistence dir are removed by leader
+        pm->SetSharedWorkspace(true);
+    }
+
     // Register to leader;
     SharedPtr<RegisterPeerTask> register_peer_task = MakeShared<RegisterPeerTask>(this_node_->node_name_,
                                                                                   this_node_->node_role_,
@@ -206,6 +283,15 @@ Status ClusterManager::UnInit() {
         }
     }
 
+    for (auto &[node_name, follower_client] : follower_clients_) {
+        follower_client->UnInit();
+    }
+    follower_clients_.clear();
+    for (auto &retired_client : retired_clients_) {
+        retired_client->UnInit();
+    }
+    retired_clients_.clear();
+
     other_nodes_.clear();
     this_node_.reset();
     if (peer_client_.get() != nullptr) {
@@ -241,7 +327,12 @@ void ClusterManager::HeartBeatToLeader() {
                                   leader_node_->ip_address_,
                                   leader_node_->port_,
                                   hb_task->error_message_));
-            leader_node_->node_status_ = NodeStatus::kTimeout;
+            if (hb_task->error_code_ == static_cast<i64>(ErrorCode::kInvalidNodeStatus)) {
+                // Leader is alive but stopped syncing logs to this node
+                MarkOutOfSync(hb_task->error_message_);
+            } else {
+                leader_node_->node_status_ = NodeStatus::kTimeout;
+            }
             continue;
         }
 
@@ -261,6 +352,185 @@ void ClusterManager::HeartBeatToLeader() {
     return ;
 }
 
+void ClusterManager::SyncLogs(const SharedPtr<Vector<String>> &log_strings, TxnTimeStamp last_commit_ts) {
+    String this_node_name;
+    Vector<Pair<String, SharedPtr<PeerClient>>> log_receivers;
+    Vector<SharedPtr<PeerClient>> stopped_clients;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (this_node_.get() == nullptr or this_node_->node_role_ != NodeRole::kLeader) {
+            return;
+        }
+        this_node_name = this_node_->node_name_;
+        log_receivers.assign(follower_clients_.begin(), follower_clients_.end());
+        std::erase_if(retired_clients_, [&](SharedPtr<PeerClient> &client) {
+            if (!client->Stopped()) {
+                return false;
+            }
+            stopped_clients.emplace_back(std::move(client));
+            return true;
+        });
+    }
+    // Their processors have exited, so this doesn't wait
+    for (const SharedPtr<PeerClient> &stopped_client : stopped_clients) {
+        stopped_client->UnInit();
+    }
+
+    // Forget the tasks of the followers which are removed
+    std::erase_if(sync_log_tasks_, [&](const auto &node_tasks) {
+        return std::none_of(log_receivers.begin(), log_receivers.end(), [&](const auto &receiver) { return receiver.first == node_tasks.first; });
+    });
+
+    // Each follower has its own sender, the flush thread never waits for it. A follower which falls kSyncLogMaxInFlight
+    // batches behind is dropped.
+    for (const auto &[node_name, follower_client] : log_receivers) {
+        Deque<SharedPtr<SyncLogTask>> &in_flight_tasks = sync_log_tasks_[node_name];
+        bool in_sync = true;
+        while (in_sync && !in_flight_tasks.empty() && in_flight_tasks.front()->IsComplete()) {
+            SharedPtr<SyncLogTask> finished_task = std::move(in_flight_tasks.front());
+            in_flight_tasks.pop_front();
+            // The follower missed some logs, it needs to register again to be in sync.
+            in_sync = FinishSyncLogTask(*finished_task, node_name);
+        }
+        if (in_sync && in_flight_tasks.size() >= kSyncLogMaxInFlight) {
+            LOG_WARN(fmt::format("Node: {} has {} log batches not applied, stop syncing logs to it", node_name, in_flight_tasks.size()));
+            MarkNodeTimeout(node_name);
+            in_sync = false;
+        }
+        if (!in_sync) {
+            sync_log_tasks_.erase(node_name);
+            RemoveLogReceiver(node_name);
+            continue;
+        }
+
+        SharedPtr<SyncLogTask> sync_log_task = MakeShared<SyncLogTask>(this_node_name, log_strings, last_shipped_ts_);
+        follower_client->Send(sync_log_task);
+        in_flight_tasks.emplace_back(std::move(sync_log_task));
+    }
+    last_shipped_ts_ = last_commit_ts;
+}
+
+void ClusterManager::MarkNodeTimeout(const String &node_name) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (const SharedPtr<NodeInfo> &other_node : other_nodes_) {
+        if (other_node->node_name_ == node_name) {
+            other_node->node_status_ = NodeStatus::kTimeout;
+        }
+    }
+}
+
+bool ClusterManager::FinishSyncLogTask(const SyncLogTask &sync_log_task, const String &node_name) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (const SharedPtr<NodeInfo> &other_node : other_nodes_) {
+        if (other_node->node_name_ != node_name) {
+            continue;
+        }
+        if (sync_log_task.error_code_ != 0) {
+            LOG_ERROR(fmt::format("Fail to sync logs to node: {}, error: {}", node_name, sync_log_task.error_message_));
+            other_node->node_status_ = NodeStatus::kTimeout;
+            return false;
+        }
+        other_node->txn_timestamp_ = sync_log_task.txn_ts_;
+        return true;
+    }
+    return sync_log_task.error_code_ == 0;
+}
+
+void ClusterManager::RemoveLogReceiver(const String &node_name) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto iter = follower_clients_.find(node_name);
+    if (iter == follower_clients_.end()) {
+        return;
+    }
+    // The pending batches fail without being sent, the client is joined once its processor exits
+    iter->second->Stop();
+    retired_clients_.emplace_back(std::move(iter->second));
+    follower_clients_.erase(iter);
+}
+
+Status ClusterManager::ApplySyncedLogs(const Vector<String> &log_strings, i64 prev_commit_ts, i64 &txn_timestamp) {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (this_node_.get() == nullptr or (this_node_->node_role_ != NodeRole::kFollower and this_node_->node_role_ != NodeRole::kLearner)) {
+            return Status::InvalidNodeRole(this_node_.get() == nullptr ? "uninitialized" : ToString(this_node_->node_role_));
+        }
+        if (this_node_->node_status_ == NodeStatus::kTimeout) {
+            return Status::InvalidNodeStatus(fmt::format("Node: {} missed some logs, it needs to register again", this_node_->node_name_));
+        }
+    }
+
+    std::unique_lock<std::mutex> sync_log_lock(sync_log_mutex_);
+    if (static_cast<TxnTimeStamp>(prev_commit_ts) > last_synced_ts_) {
+        // The entries committed in between were never received, applying these ones would hide the gap
+        String error_message = fmt::format("Missed the logs committed from {} to {}", last_synced_ts_, prev_commit_ts);
+        MarkOutOfSync(error_message);
+        return Status::InvalidNodeStatus(error_message);
+    }
+    WalManager *wal_manager = InfinityContext::instance().storage()->wal_manager();
+    for (const String &log_string : log_strings) {
+        // The entry is checked in place, so it needs a writable copy
+        String log_buffer = log_string;
+        const char *ptr = log_buffer.data();
+        SharedPtr<WalEntry> wal_entry;
+        try {
+            wal_entry = WalEntry::ReadAdv(ptr, static_cast<i32>(log_buffer.size()));
+        } catch (UnrecoverableException &e) {
+            wal_entry = nullptr;
+        }
+        if (wal_entry.get() == nullptr) {
+            MarkOutOfSync("Corrupted synced wal entry");
+            return Status::DataCorrupted("synced wal entry");
+        }
+        if (wal_entry->commit_ts_ <= last_synced_ts_) {
+            // Sent again by leader
+            continue;
+        }
+        Status status = CheckSyncedFiles(*wal_entry);
+        if (!status.ok()) {
+            // This node needs to start again from a copy of the leader's data
+            MarkOutOfSync(status.message());
+            return status;
+        }
+        try {
+            // Replayed as a write txn of this node, so the reads don't see a partially replayed entry
+            status = txn_manager_->ReplayCommitted(wal_entry->commit_ts_, [&] { wal_manager->ReplayWalEntry(*wal_entry); });
+        } catch (RecoverableException &e) {
+            status = Status(e.ErrorCode(), e.what());
+        } catch (UnrecoverableException &e) {
+            // The catalog of this node doesn't match the entry, which may be partially applied
+            status = Status::UnexpectedError(fmt::format("Fail to replay synced wal entry at {}: {}", wal_entry->commit_ts_, e.what()));
+        }
+        if (!status.ok()) {
+            // Leader drops this node, the entries after this one won't be received
+            MarkOutOfSync(status.message());
+            return status;
+        }
+        last_synced_ts_ = wal_entry->commit_ts_;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    leader_node_->txn_timestamp_ = last_synced_ts_;
+    txn_timestamp = txn_manager_->CurrentTS();
+    return Status::OK();
+}
+
+void ClusterManager::MarkOutOfSync(const String &reason) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (this_node_.get() == nullptr or this_node_->node_status_ == NodeStatus::kTimeout) {
+        return;
+    }
+    LOG_ERROR(fmt::format("Node: {} is out of sync with leader and stops serving reads: {}", this_node_->node_name_, reason));
+    this_node_->node_status_ = NodeStatus::kTimeout;
+}
+
+bool ClusterManager::ServesReads() const {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (this_node_.get() == nullptr or (this_node_->node_role_ != NodeRole::kFollower and this_node_->node_role_ != NodeRole::kLearner)) {
+        return true;
+    }
+    return this_node_->node_status_ != NodeStatus::kTimeout;
+}
+
 // Status ClusterManager::Register(SharedPtr<NodeInfo> server_node) {
 //     std::unique_lock<std::mutex> lock(mutex_);
 //     return Status::OK();
@@ -271,21 +541,39 @@ void ClusterManager::HeartBeatToLeader() {
 // }
 
 Status ClusterManager::AddNodeInfo(const SharedPtr<NodeInfo> &node_info) {
+    // Connect to the new node before taking the lock, the logs are shipped through this client.
+    SharedPtr<PeerClient> follower_client = MakeShared<PeerClient>(node_info->ip_address_, node_info->port_, node_info->node_name_);
+    Status client_status = follower_client->Init();
+    if (!client_status.ok()) {
+        return client_status;
+    }
+
     std::unique_lock<std::mutex> lock(mutex_);
     if (this_node_->node_role_ == NodeRole::kLeader) {
         // Add by register
         bool found = false;
-        for (const SharedPtr<NodeInfo> &other_node : other_nodes_) {
+        for (SharedPtr<NodeInfo> &other_node : other_nodes_) {
             if (other_node->node_name_ == node_info->node_name_) {
-                // Found the node, duplicate node
+                // Found the node, it's a duplicate node unless it's registering again after a failure
+                if (other_node->node_status_ != NodeStatus::kTimeout) {
+                    lock.unlock();
+                    follower_client->UnInit();
+                    return Status::DuplicateNode(node_info->node_name_);
+                }
+                other_node = node_info;
                 found = true;
                 break;
             }
         }
-        if (found) {
-            return Status::DuplicateNode(node_info->node_name_);
+        if (!found) {
+            other_nodes_.emplace_back(node_info);
+        }
+        SharedPtr<PeerClient> &node_client = follower_clients_[node_info->node_name_];
+        if (node_client.get() != nullptr) {
+            node_client->Stop();
+            retired_clients_.emplace_back(std::move(node_client));
         }
-        other_nodes_.emplace_back(node_info);
+        node_client = std::move(follower_client);
     } else {
         String error_message = "Invalid node role.";
         UnrecoverableError(error_message);
@@ -294,6 +582,8 @@ Status ClusterManager::AddNodeInfo(const SharedPtr<NodeInfo> &node_info) {
 }
 
 Status ClusterManager::RemoveNode(const String& node_name) {
+    RemoveLogReceiver(node_name);
+
     std::unique_lock<std::mutex> lock(mutex_);
     u64 found_count = 0;
     std::erase_if(other_nodes_, [&](const SharedPtr<NodeInfo>& node) {
@@ -323,6 +613,7 @@ Status ClusterManager::UpdateNodeInfoByHeartBeat(const String& node_name, i64 tx
     if (this_node_->node_role_ == NodeRole::kLeader) {
         other_nodes.reserve(other_nodes_.size());
         leader_term = this_node_->leader_term_;
+        bool dropped = false;
         for (const SharedPtr<NodeInfo> &other_node : other_nodes_) {
             if (other_node->node_name_ == node_name) {
                 // Found the node, just update the timestamp
@@ -331,6 +622,7 @@ Status ClusterManager::UpdateNodeInfoByHeartBeat(const String& node_name, i64 tx
                 auto time_since_epoch = now.time_since_epoch();
                 other_node->last_update_ts_ = std::chrono::duration_cast<std::chrono::seconds>(time_since_epoch).count();
                 ++ other_node->heartbeat_count_;
+                dropped = other_node->node_status_ == NodeStatus::kTimeout;
             } else {
                 infinity_peer_server::NodeInfo thrift_node_info;
                 thrift_node_info.node_name = other_node->node_name_;
@@ -374,6 +666,10 @@ Status ClusterManager::UpdateNodeInfoByHeartBeat(const String& node_name, i64 tx
                 other_nodes.emplace_back(thrift_node_info);
             }
         }
+        if (dropped) {
+            // No more logs are shipped to the node, tell it that its data is stale
+            return Status::InvalidNodeStatus(fmt::format("Node: {} is no longer synced by leader, it needs to register again", node_name));
+        }
     } else {
         String error_message = "Invalid node role.";
         UnrecoverableError(error_message);
@@ -402,6 +698,7 @@ Status ClusterManager::UpdateNodeInfoNoLock(const Vector<SharedPtr<NodeInfo>> &i
 }
 Vector<SharedPtr<NodeInfo>> ClusterManager::ListNodes() const {
     std::unique_lock<std::mutex> lock(mutex_);
+    this_node_->txn_timestamp_ = txn_manager_->CurrentTS();
     Vector<SharedPtr<NodeInfo>> result = other_nodes_;
     result.emplace_back(this_node_);
     if (this_node_->node_role_ == NodeRole::kFollower or this_node_->node_role_ == NodeRole::kLearner) {
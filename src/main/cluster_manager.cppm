@@ -43,6 +43,16 @@ public:
 public:
     void HeartBeatToLeader();
 
+    // Used by leader, called by the WAL flush thread with the serialized entries of each flushed batch and the commit ts of its last entry.
+    void SyncLogs(const SharedPtr<Vector<String>> &log_strings, TxnTimeStamp last_commit_ts);
+
+    // Used by follower / learner, replay the entries sent by leader. `prev_commit_ts` is the commit ts of the entry shipped before them,
+    // `txn_timestamp` is the timestamp new reads start from.
+    Status ApplySyncedLogs(const Vector<String> &log_strings, i64 prev_commit_ts, i64 &txn_timestamp);
+
+    // False on a follower / learner which missed some logs of leader, its data is stale until it registers again.
+    bool ServesReads() const;
+
 public:
     Status AddNodeInfo(const SharedPtr<NodeInfo>& new_node);
     Status RemoveNode(const String& node_name);
@@ -52,7 +62,20 @@ public:
     Vector<SharedPtr<NodeInfo>> ListNodes() const;
     SharedPtr<NodeInfo> GetNodeInfoPtrByName(const String& node_name) const;
     SharedPtr<NodeInfo> ThisNode() const;
+
 private:
+    // Returns false if the follower failed to apply the logs and shouldn't receive more.
+    bool FinishSyncLogTask(const SyncLogTask &sync_log_task, const String &node_name);
+    void MarkNodeTimeout(const String &node_name);
+    // Used by follower / learner, stop serving reads after missing some logs.
+    void MarkOutOfSync(const String &reason);
+    // Stop shipping logs to the node without waiting for its pending batches.
+    void RemoveLogReceiver(const String &node_name);
+
+private:
+    // A follower with this many batches sent to it but not applied yet is marked timeout and no longer synced.
+    static constexpr SizeT kSyncLogMaxInFlight = 64;
+
     TxnManager* txn_manager_{};
     mutable std::mutex mutex_;
 
@@ -63,6 +86,12 @@ private:
     SharedPtr<PeerClient> peer_client_{}; // Used by follower and learner;
 
     Map<String, SharedPtr<PeerClient>> follower_clients_{}; // Used by leader;
+    Map<String, Deque<SharedPtr<SyncLogTask>>> sync_log_tasks_{}; // Used by leader, only accessed by the WAL flush thread
+    Vector<SharedPtr<PeerClient>> retired_clients_{}; // Used by leader, the clients of removed followers still stopping
+    TxnTimeStamp last_shipped_ts_{}; // Used by leader, commit ts of the last entry shipped, only accessed by the WAL flush thread
+
+    std::mutex sync_log_mutex_{}; // Used by follower / learner, serializes the replay of synced logs
+    TxnTimeStamp last_synced_ts_{}; // Used by follower / learner, commit ts of the last replayed entry
 
     SharedPtr<Thread> hb_periodic_thread_{};
     std::mutex hb_mutex_;
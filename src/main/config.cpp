@@ -384,6 +384,44 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
             UnrecoverableError(status.message());
         }
 
+        // Index mmap load
+        bool index_mmap_load = false;
+        UniquePtr<BooleanOption> index_mmap_load_option = MakeUnique<BooleanOption>(INDEX_MMAP_LOAD_OPTION_NAME, index_mmap_load);
+        status = global_options_.AddOption(std::move(index_mmap_load_option));
+        if(!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
+        // Verify file checksum
+        bool verify_file_checksum = false;
+        UniquePtr<BooleanOption> verify_file_checksum_option = MakeUnique<BooleanOption>(VERIFY_FILE_CHECKSUM_OPTION_NAME, verify_file_checksum);
+        status = global_options_.AddOption(std::move(verify_file_checksum_option));
+        if(!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
+        // Scrub IO rate limit
+        i64 scrub_io_rate_limit = DEFAULT_SCRUB_IO_RATE_LIMIT;
+        UniquePtr<IntegerOption> scrub_io_rate_limit_option =
+            MakeUnique<IntegerOption>(SCRUB_IO_RATE_LIMIT_OPTION_NAME, scrub_io_rate_limit, std::numeric_limits<i64>::max(), 0);
+        status = global_options_.AddOption(std::move(scrub_io_rate_limit_option));
+        if(!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
+        // Index build cpu share
+        i64 index_build_cpu_share = DEFAULT_INDEX_BUILD_CPU_SHARE;
+        UniquePtr<IntegerOption> index_build_cpu_share_option =
+            MakeUnique<IntegerOption>(INDEX_BUILD_CPU_SHARE_OPTION_NAME, index_build_cpu_share, 100, 1);
+        status = global_options_.AddOption(std::move(index_build_cpu_share_option));
+        if(!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
         // Buffer Manager Size
         i64 buffer_manager_size = DEFAULT_BUFFER_MANAGER_SIZE;
         UniquePtr<IntegerOption> buffer_manager_size_option =
@@ -1348,6 +1386,79 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                             }
                             break;
                         }
+                        case GlobalOptionIndex::kIndexMmapLoad: {
+                            // Index mmap load
+                            bool index_mmap_load = false;
+                            if (elem.second.is_boolean()) {
+                                index_mmap_load = elem.second.value_or(index_mmap_load);
+                            } else {
+                                return Status::InvalidConfig("'index_mmap_load' field isn't boolean.");
+                            }
+                            UniquePtr<BooleanOption> index_mmap_load_option = MakeUnique<BooleanOption>(INDEX_MMAP_LOAD_OPTION_NAME, index_mmap_load);
+                            Status status = global_options_.AddOption(std::move(index_mmap_load_option));
+                            if(!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
+                        case GlobalOptionIndex::kVerifyFileChecksum: {
+                            // Verify file checksum
+                            bool verify_file_checksum = false;
+                            if (elem.second.is_boolean()) {
+                                verify_file_checksum = elem.second.value_or(verify_file_checksum);
+                            } else {
+                                return Status::InvalidConfig("'verify_file_checksum' field isn't boolean.");
+                            }
+                            UniquePtr<BooleanOption> verify_file_checksum_option =
+                                MakeUnique<BooleanOption>(VERIFY_FILE_CHECKSUM_OPTION_NAME, verify_file_checksum);
+                            Status status = global_options_.AddOption(std::move(verify_file_checksum_option));
+                            if(!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
+                        case GlobalOptionIndex::kScrubIORateLimit: {
+                            // Scrub IO rate limit
+                            i64 scrub_io_rate_limit = DEFAULT_SCRUB_IO_RATE_LIMIT;
+                            if(elem.second.is_string()) {
+                                String scrub_io_rate_limit_str = elem.second.value_or(DEFAULT_SCRUB_IO_RATE_LIMIT_STR.data());
+                                auto res = ParseByteSize(scrub_io_rate_limit_str, scrub_io_rate_limit);
+                                if (!res.ok()) {
+                                    return res;
+                                }
+                            } else {
+                                return Status::InvalidConfig("'scrub_io_rate_limit' field isn't string, such as \"64MB\"");
+                            }
+                            UniquePtr<IntegerOption> scrub_io_rate_limit_option =
+                                MakeUnique<IntegerOption>(SCRUB_IO_RATE_LIMIT_OPTION_NAME, scrub_io_rate_limit, std::numeric_limits<i64>::max(), 0);
+                            if (!scrub_io_rate_limit_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid scrub IO rate limit: {}", scrub_io_rate_limit));
+                            }
+                            Status status = global_options_.AddOption(std::move(scrub_io_rate_limit_option));
+                            if(!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
+                        case GlobalOptionIndex::kIndexBuildCPUShare: {
+                            // Index build cpu share
+                            i64 index_build_cpu_share = DEFAULT_INDEX_BUILD_CPU_SHARE;
+                            if(elem.second.is_integer()) {
+                                index_build_cpu_share = elem.second.value_or(index_build_cpu_share);
+                            } else {
+                                return Status::InvalidConfig("'index_build_cpu_share' field isn't integer.");
+                            }
+                            UniquePtr<IntegerOption> index_build_cpu_share_option =
+                                MakeUnique<IntegerOption>(INDEX_BUILD_CPU_SHARE_OPTION_NAME, index_build_cpu_share, 100, 1);
+                            if (!index_build_cpu_share_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid index build cpu share: {}", index_build_cpu_share));
+                            }
+                            Status status = global_options_.AddOption(std::move(index_build_cpu_share_option));
+                            if(!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
                         default: {
                             return Status::InvalidConfig(fmt::format("Unrecognized config parameter: {} in 'storage' field", var_name));
                         }
@@ -1423,6 +1534,49 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                     }
                 }
 
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kIndexMmapLoad) == nullptr) {
+                    // Index mmap load
+                    bool index_mmap_load = false;
+                    UniquePtr<BooleanOption> index_mmap_load_option = MakeUnique<BooleanOption>(INDEX_MMAP_LOAD_OPTION_NAME, index_mmap_load);
+                    Status status = global_options_.AddOption(std::move(index_mmap_load_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kVerifyFileChecksum) == nullptr) {
+                    // Verify file checksum
+                    bool verify_file_checksum = false;
+                    UniquePtr<BooleanOption> verify_file_checksum_option =
+                        MakeUnique<BooleanOption>(VERIFY_FILE_CHECKSUM_OPTION_NAME, verify_file_checksum);
+                    Status status = global_options_.AddOption(std::move(verify_file_checksum_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kScrubIORateLimit) == nullptr) {
+                    // Scrub IO rate limit
+                    i64 scrub_io_rate_limit = DEFAULT_SCRUB_IO_RATE_LIMIT;
+                    UniquePtr<IntegerOption> scrub_io_rate_limit_option =
+                        MakeUnique<IntegerOption>(SCRUB_IO_RATE_LIMIT_OPTION_NAME, scrub_io_rate_limit, std::numeric_limits<i64>::max(), 0);
+                    Status status = global_options_.AddOption(std::move(scrub_io_rate_limit_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kIndexBuildCPUShare) == nullptr) {
+                    // Index build cpu share
+                    i64 index_build_cpu_share = DEFAULT_INDEX_BUILD_CPU_SHARE;
+                    UniquePtr<IntegerOption> index_build_cpu_share_option =
+                        MakeUnique<IntegerOption>(INDEX_BUILD_CPU_SHARE_OPTION_NAME, index_build_cpu_share, 100, 1);
+                    Status status = global_options_.AddOption(std::move(index_build_cpu_share_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
             } else {
                 return Status::InvalidConfig("No 'storage' section in configure file.");
             }
@@ -2061,6 +2215,37 @@ i64 Config::MemIndexCapacity() {
     return global_options_.GetIntegerValue(GlobalOptionIndex::kMemIndexCapacity);
 }
 
+bool Config::IndexMmapLoad() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetBoolValue(GlobalOptionIndex::kIndexMmapLoad);
+}
+
+bool Config::VerifyFileChecksum() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetBoolValue(GlobalOptionIndex::kVerifyFileChecksum);
+}
+
+i64 Config::ScrubIORateLimit() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kScrubIORateLimit);
+}
+
+i64 Config::IndexBuildCPUShare() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kIndexBuildCPUShare);
+}
+
+void Config::SetIndexBuildCPUShare(i64 cpu_share) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    BaseOption *base_option = global_options_.GetOptionByIndex(GlobalOptionIndex::kIndexBuildCPUShare);
+    if (base_option->data_type_ != BaseOptionDataType::kInteger) {
+        String error_message = "Attempt to set non-integer value to index build cpu share";
+        UnrecoverableError(error_message);
+    }
+    IntegerOption *index_build_cpu_share_option = static_cast<IntegerOption *>(base_option);
+    index_build_cpu_share_option->value_ = cpu_share;
+}
+
 // Persistence
 String Config::PersistenceDir() {
     std::lock_guard<std::mutex> guard(mutex_);
@@ -2209,6 +2394,10 @@ void Config::PrintAll() {
     fmt::print(" - compact_interval: {}\n", Utility::FormatTimeInfo(CompactInterval()));
     fmt::print(" - optimize_index_interval: {}\n", Utility::FormatTimeInfo(OptimizeIndexInterval()));
     fmt::print(" - memindex_capacity: {}\n", Utility::FormatByteSize(MemIndexCapacity()));
+    fmt::print(" - index_mmap_load: {}\n", IndexMmapLoad());
+    fmt::print(" - verify_file_checksum: {}\n", VerifyFileChecksum());
+    fmt::print(" - scrub_io_rate_limit: {}\n", Utility::FormatByteSize(ScrubIORateLimit()));
+    fmt::print(" - index_build_cpu_share: {}%\n", IndexBuildCPUShare());
 
     // Buffer manager
     fmt::print(" - buffer_manager_size: {}\n", Utility::FormatByteSize(BufferManagerSize()));
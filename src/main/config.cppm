@@ -95,6 +95,15 @@ public:
 
     i64 MemIndexCapacity();
 
+    bool IndexMmapLoad();
+
+    bool VerifyFileChecksum();
+
+    i64 ScrubIORateLimit();
+
+    i64 IndexBuildCPUShare();
+    void SetIndexBuildCPUShare(i64 cpu_share);
+
     // Persistence
     String PersistenceDir();
     i64 PersistenceObjectSizeLimit();
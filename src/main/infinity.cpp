@@ -915,6 +915,7 @@ QueryResult Infinity::Export(const String &db_name, const String &table_name, Ve
     export_statement->offset_ = export_options.offset_;
     export_statement->limit_ = export_options.limit_;
     export_statement->row_limit_ = export_options.row_limit_;
+    export_statement->compression_type_ = export_options.compression_type_;
 
     QueryResult result = query_context_ptr->QueryStatement(export_statement.get());
     return result;
@@ -66,6 +66,8 @@ void InfinityContext::Init(const SharedPtr<String> &config_path, bool admin_flag
 
     resource_manager_ = MakeUnique<ResourceManager>(config_->CPULimit(), 0);
 
+    ResizeIndexBuildThreadPool();
+
     session_mgr_ = MakeUnique<SessionManager>();
 
     String persistence_dir = config_->PersistenceDir();
@@ -207,10 +209,10 @@ Status InfinityContext::ChangeRole(NodeRole target_role, const String& node_name
                     if(cluster_manager_ == nullptr) {
                         UnrecoverableError("cluster manager wasn't valid.");
                     }
-                    // TODO: disconnect with all follower/learner
+                    // Stop the WAL flush thread first, it ships the logs through cluster manager.
+                    storage_->SetStorageMode(StorageMode::kAdmin);
                     cluster_manager_->UnInit();
                     cluster_manager_.reset();
-                    storage_->SetStorageMode(StorageMode::kAdmin);
                     RestoreIndexThreadPoolToDefault();
 
                     task_scheduler_->UnInit();
@@ -341,12 +343,23 @@ void InfinityContext::SetIndexThreadPool(SizeT thread_num) {
     inverting_thread_pool_.resize(thread_num);
     commiting_thread_pool_.resize(thread_num);
     hnsw_build_thread_pool_.resize(thread_num);
+    import_thread_pool_.resize(thread_num);
+    export_thread_pool_.resize(thread_num);
 }
 
+SizeT InfinityContext::IndexBuildThreadNum() {
+    i64 thread_num = config_->CPULimit() * config_->IndexBuildCPUShare() / 100;
+    return std::max(thread_num, i64(1));
+}
+
+void InfinityContext::ResizeIndexBuildThreadPool() { hnsw_build_thread_pool_.resize(IndexBuildThreadNum()); }
+
 void InfinityContext::RestoreIndexThreadPoolToDefault() {
     inverting_thread_pool_.resize(4);
     commiting_thread_pool_.resize(2);
     hnsw_build_thread_pool_.resize(4);
+    import_thread_pool_.resize(4);
+    export_thread_pool_.resize(4);
 }
 
 } // namespace infinity
@@ -51,6 +51,8 @@ public:
     [[nodiscard]] inline ThreadPool &GetFulltextInvertingThreadPool() { return inverting_thread_pool_; }
     [[nodiscard]] inline ThreadPool &GetFulltextCommitingThreadPool() { return commiting_thread_pool_; }
     [[nodiscard]] inline ThreadPool &GetHnswBuildThreadPool() { return hnsw_build_thread_pool_; }
+    [[nodiscard]] inline ThreadPool &GetImportThreadPool() { return import_thread_pool_; }
+    [[nodiscard]] inline ThreadPool &GetExportThreadPool() { return export_thread_pool_; }
 
     NodeRole GetServerRole() const;
     void SetServerRole(NodeRole server_role);
@@ -66,6 +68,10 @@ public:
     void SetIndexThreadPool(SizeT thread_num);
     void RestoreIndexThreadPoolToDefault();
 
+    // Threads of the CREATE INDEX builds, `index_build_cpu_share` percent of `cpu_limit`
+    SizeT IndexBuildThreadNum();
+    void ResizeIndexBuildThreadPool();
+
 private:
     friend class Singleton;
 
@@ -83,9 +89,13 @@ private:
     ThreadPool inverting_thread_pool_{4};
     ThreadPool commiting_thread_pool_{2};
 
-    // For hnsw index
+    // For hnsw index, resized to IndexBuildThreadNum()
     ThreadPool hnsw_build_thread_pool_{4};
 
+    // For import and export
+    ThreadPool import_thread_pool_{4};
+    ThreadPool export_thread_pool_{4};
+
     mutable std::mutex mutex_;
     NodeRole current_server_role_{NodeRole::kUnInitialized};
 };
@@ -55,6 +55,10 @@ GlobalOptions::GlobalOptions() {
     name2index_[String(COMPACT_INTERVAL_OPTION_NAME)] = GlobalOptionIndex::kCompactInterval;
     name2index_[String(OPTIMIZE_INTERVAL_OPTION_NAME)] = GlobalOptionIndex::kOptimizeIndexInterval;
     name2index_[String(MEM_INDEX_CAPACITY_OPTION_NAME)] = GlobalOptionIndex::kMemIndexCapacity;
+    name2index_[String(INDEX_MMAP_LOAD_OPTION_NAME)] = GlobalOptionIndex::kIndexMmapLoad;
+    name2index_[String(VERIFY_FILE_CHECKSUM_OPTION_NAME)] = GlobalOptionIndex::kVerifyFileChecksum;
+    name2index_[String(SCRUB_IO_RATE_LIMIT_OPTION_NAME)] = GlobalOptionIndex::kScrubIORateLimit;
+    name2index_[String(INDEX_BUILD_CPU_SHARE_OPTION_NAME)] = GlobalOptionIndex::kIndexBuildCPUShare;
 
     name2index_[String(PERSISTENCE_DIR_OPTION_NAME)] = GlobalOptionIndex::kPersistenceDir;
     name2index_[String(PERSISTENCE_OBJECT_SIZE_LIMIT_OPTION_NAME)] = GlobalOptionIndex::kPersistenceObjectSizeLimit;
@@ -151,7 +151,11 @@ export enum class GlobalOptionIndex {
     kPeerServerIP = 35,
     kPeerServerPort = 36,
     kPeerServerConnectionPoolSize = 37,
-    kInvalid = 38,
+    kIndexMmapLoad = 38,
+    kVerifyFileChecksum = 39,
+    kScrubIORateLimit = 40,
+    kIndexBuildCPUShare = 41,
+    kInvalid = 42,
 };
 
 export struct GlobalOptions {
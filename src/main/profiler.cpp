@@ -25,6 +25,7 @@ import operator_state;
 import data_block;
 import logger;
 import infinity_exception;
+import common_query_filter;
 
 namespace infinity {
 
@@ -170,6 +171,10 @@ void TaskProfiler::StopOperator(const OperatorState *operator_state) {
     }
 
     OperatorInformation info(active_operator_->GetName(), profiler_.GetBegin(), profiler_.GetEnd(), profiler_.Elapsed(), input_rows, output_data_size, output_rows);
+    if (const CommonQueryFilter *filter = active_operator_->common_query_filter(); filter != nullptr) {
+        info.pruned_segments_ = filter->fast_rough_filter_pruned_segment_count_;
+        info.pruned_blocks_ = filter->fast_rough_filter_pruned_block_count_;
+    }
 
     timings_.push_back(std::move(info));
     active_operator_ = nullptr;
@@ -279,6 +284,8 @@ void QueryProfiler::ExecuteRender(std::stringstream &ss) const {
                        << ", InputRows: " << op.input_rows_
                        << ", OutputRows: " << op.output_rows_
                        << ", OutputDataSize: " << op.output_data_size_
+                       << ", PrunedSegments: " << op.pruned_segments_
+                       << ", PrunedBlocks: " << op.pruned_blocks_
                        << std::endl;
                 }
                 times ++;
@@ -347,6 +354,8 @@ nlohmann::json QueryProfiler::Serialize(const QueryProfiler *profiler) {
                     json_info["input_rows"] = op.input_rows_;
                     json_info["output_rows"] = op.output_rows_;
                     json_info["output_data_size"] = op.output_data_size_;
+                    json_info["pruned_segments"] = op.pruned_segments_;
+                    json_info["pruned_blocks"] = op.pruned_blocks_;
                     json_operators["infos"].push_back(json_info);
                 }
                 times ++;
@@ -93,13 +93,15 @@ struct OperatorInformation {
 
     OperatorInformation(const OperatorInformation& other)
         : name_(other.name_), start_(other.start_), end_(other.end_), elapsed_(other.elapsed_), input_rows_(other.input_rows_),
-          output_data_size_(other.output_data_size_), output_rows_(other.output_rows_) {
+          output_data_size_(other.output_data_size_), output_rows_(other.output_rows_),
+          pruned_segments_(other.pruned_segments_), pruned_blocks_(other.pruned_blocks_) {
 
     }
 
     OperatorInformation(OperatorInformation&& other)
         : name_(std::move(other.name_)), start_(other.start_), end_(other.end_), elapsed_(other.elapsed_), input_rows_(other.input_rows_),
-          output_data_size_(other.output_data_size_), output_rows_(other.output_rows_) {
+          output_data_size_(other.output_data_size_), output_rows_(other.output_rows_),
+          pruned_segments_(other.pruned_segments_), pruned_blocks_(other.pruned_blocks_) {
     }
 
     OperatorInformation(String name, i64 start, i64 end, i64 elapsed, u16 input_rows, i32 output_data_size, u16 output_rows)
@@ -115,6 +117,8 @@ struct OperatorInformation {
             input_rows_ = other.input_rows_;
             output_rows_ = other.output_rows_;
             output_data_size_ = other.output_data_size_;
+            pruned_segments_ = other.pruned_segments_;
+            pruned_blocks_ = other.pruned_blocks_;
         }
         return *this;
     }
@@ -127,6 +131,9 @@ struct OperatorInformation {
     u16 input_rows_ {};
     i32 output_data_size_ {};
     u16 output_rows_ {};
+    // segments and blocks pruned by the minmax and bloom filter, only for operators with a common query filter
+    u32 pruned_segments_ {};
+    u32 pruned_blocks_ {};
 };
 
 export struct TaskBinding {
@@ -58,6 +58,13 @@ import admin_executor;
 import persistence_manager;
 import global_resource_usage;
 import infinity_context;
+import cluster_manager;
+import defer_op;
+import prepare_statement;
+import execute_statement;
+import parsed_expr;
+import prepared_plan;
+import data_table;
 
 namespace infinity {
 
@@ -154,6 +161,10 @@ QueryResult QueryContext::Query(const String &query) {
         }
     }
 
+    if (base_statement->Type() == StatementType::kPrepare) {
+        return HandlePrepareStatement(std::move(parsed_result));
+    }
+
     QueryResult query_result = QueryStatement(base_statement);
     return query_result;
 }
@@ -165,11 +176,22 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *base_statement) {
         query_result.status_ = Status::AdminOnlySupportInMaintenanceMode();
         return query_result;
     }
+    if (base_statement->type_ == StatementType::kSelect or base_statement->type_ == StatementType::kExecute) {
+        // A follower / learner which missed some logs of leader would return stale rows
+        ClusterManager *cluster_manager = InfinityContext::instance().cluster_manager();
+        if (cluster_manager != nullptr and !cluster_manager->ServesReads()) {
+            query_result.result_table_ = nullptr;
+            query_result.status_ = Status::InvalidNodeStatus("This node is out of sync with leader and doesn't serve reads");
+            return query_result;
+        }
+    }
 
     Vector<SharedPtr<LogicalNode>> logical_plans{};
     Vector<UniquePtr<PhysicalOperator>> physical_plans{};
     SharedPtr<PlanFragment> plan_fragment{};
     UniquePtr<Notifier> notifier{};
+    SharedPtr<PreparedPlan> prepared_plan{};
+    const BaseStatement *planned_statement = base_statement;
 
     query_id_ = session_ptr_->query_count();
     //    ProfilerStart("Query");
@@ -205,25 +227,31 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *base_statement) {
         //                        base_statement->ToString()));
         RecordQueryProfiler(base_statement->type_);
 
-        // Build unoptimized logical plan for each SQL base_statement.
-        StartProfile(QueryPhase::kLogicalPlan);
-        SharedPtr<BindContext> bind_context;
-        auto status = logical_planner_->Build(base_statement, bind_context);
-        // FIXME
-        if (!status.ok()) {
-            RecoverableError(status);
-        }
+        if (base_statement->type_ == StatementType::kExecute) {
+            // Bound and optimized plan comes from the prepared statement, the cached one is reused if still valid.
+            prepared_plan = PlanPreparedStatement(static_cast<const ExecuteStatement *>(base_statement), logical_plans);
+            planned_statement = prepared_plan->statement();
+        } else {
+            // Build unoptimized logical plan for each SQL base_statement.
+            StartProfile(QueryPhase::kLogicalPlan);
+            SharedPtr<BindContext> bind_context;
+            auto status = logical_planner_->Build(base_statement, bind_context);
+            // FIXME
+            if (!status.ok()) {
+                RecoverableError(status);
+            }
 
-        current_max_node_id_ = bind_context->GetNewLogicalNodeId();
-        logical_plans = logical_planner_->LogicalPlans();
-        StopProfile(QueryPhase::kLogicalPlan);
-        //        LOG_WARN(fmt::format("Before optimizer cost: {}", profiler.ElapsedToString()));
-        // Apply optimized rule to the logical plan
-        StartProfile(QueryPhase::kOptimizer);
-        for (auto &logical_plan : logical_plans) {
-            optimizer_->optimize(logical_plan, base_statement->type_);
+            current_max_node_id_ = bind_context->GetNewLogicalNodeId();
+            logical_plans = logical_planner_->LogicalPlans();
+            StopProfile(QueryPhase::kLogicalPlan);
+            //        LOG_WARN(fmt::format("Before optimizer cost: {}", profiler.ElapsedToString()));
+            // Apply optimized rule to the logical plan
+            StartProfile(QueryPhase::kOptimizer);
+            for (auto &logical_plan : logical_plans) {
+                optimizer_->optimize(logical_plan, base_statement->type_);
+            }
+            StopProfile(QueryPhase::kOptimizer);
         }
-        StopProfile(QueryPhase::kOptimizer);
 
         // Build physical plan
         StartProfile(QueryPhase::kPhysicalPlan);
@@ -250,7 +278,7 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *base_statement) {
         StopProfile(QueryPhase::kTaskBuild);
         //        LOG_WARN(fmt::format("Before execution cost: {}", profiler.ElapsedToString()));
         StartProfile(QueryPhase::kExecution);
-        scheduler_->Schedule(plan_fragment.get(), base_statement);
+        scheduler_->Schedule(plan_fragment.get(), planned_statement);
         query_result.result_table_ = plan_fragment->GetResult();
         query_result.root_operator_type_ = logical_plans.back()->operator_type();
         StopProfile(QueryPhase::kExecution);
@@ -372,6 +400,80 @@ bool QueryContext::JoinBGStatement(BGQueryState &state, TxnTimeStamp &commit_ts,
 
 QueryResult QueryContext::HandleAdminStatement(const AdminStatement *admin_statement) { return AdminExecutor::Execute(this, admin_statement); }
 
+QueryResult QueryContext::HandlePrepareStatement(UniquePtr<ParserResult> parsed_result) {
+    QueryResult query_result;
+    auto *prepare_statement = static_cast<PrepareStatement *>(parsed_result->statements_ptr_->at(0));
+    if (prepare_statement->statement_ == nullptr || prepare_statement->statement_->type_ != StatementType::kSelect) {
+        query_result.status_ = Status::NotSupport("Only SELECT statement can be prepared.");
+        return query_result;
+    }
+
+    String name = prepare_statement->name_;
+    const BaseStatement *statement = prepare_statement->statement_;
+    SizeT parameter_count = prepare_statement->parameter_count_;
+    // The parser result owns the statement, keep it along with the prepared plan.
+    auto prepared_plan = MakeShared<PreparedPlan>(name, std::move(parsed_result), statement, parameter_count);
+    session_ptr_->AddPreparedPlan(name, std::move(prepared_plan));
+    LOG_DEBUG(fmt::format("Prepared statement: {}, parameter count: {}", name, parameter_count));
+
+    query_result.result_table_ = DataTable::MakeEmptyResultTable();
+    return query_result;
+}
+
+SharedPtr<PreparedPlan> QueryContext::PlanPreparedStatement(const ExecuteStatement *execute_statement, Vector<SharedPtr<LogicalNode>> &logical_plans) {
+    SharedPtr<PreparedPlan> prepared_plan = session_ptr_->GetPreparedPlan(execute_statement->name_);
+    if (prepared_plan.get() == nullptr) {
+        RecoverableError(Status::SyntaxError(fmt::format("Prepared statement {} doesn't exist.", execute_statement->name_)));
+    }
+    SizeT parameter_count = execute_statement->parameters_ == nullptr ? 0 : execute_statement->parameters_->size();
+    if (parameter_count != prepared_plan->parameter_count()) {
+        RecoverableError(Status::SyntaxError(fmt::format("Prepared statement {} expects {} parameters, but {} are given.",
+                                                         execute_statement->name_,
+                                                         prepared_plan->parameter_count(),
+                                                         parameter_count)));
+    }
+    Vector<String> parameter_keys;
+    parameter_keys.reserve(parameter_count);
+    for (SizeT i = 0; i < parameter_count; ++i) {
+        parameter_keys.emplace_back((*execute_statement->parameters_)[i]->ToString());
+    }
+
+    StartProfile(QueryPhase::kLogicalPlan);
+    if (prepared_plan->TryReuse(this, execute_statement->parameters_, parameter_keys, logical_plans, current_max_node_id_)) {
+        StopProfile(QueryPhase::kLogicalPlan);
+        return prepared_plan;
+    }
+
+    SharedPtr<BindContext> bind_context;
+    Status status;
+    {
+        parameters_ = execute_statement->parameters_;
+        parameter_slots_.clear();
+        DeferFn defer([this] { parameters_ = nullptr; });
+        status = logical_planner_->Build(prepared_plan->statement(), bind_context);
+    }
+    if (!status.ok()) {
+        RecoverableError(status);
+    }
+    current_max_node_id_ = bind_context->GetNewLogicalNodeId();
+    logical_plans = logical_planner_->LogicalPlans();
+    StopProfile(QueryPhase::kLogicalPlan);
+
+    StartProfile(QueryPhase::kOptimizer);
+    for (auto &logical_plan : logical_plans) {
+        optimizer_->optimize(logical_plan, prepared_plan->statement()->type_);
+    }
+    StopProfile(QueryPhase::kOptimizer);
+
+    prepared_plan->Cache(this,
+                         std::move(parameter_keys),
+                         std::move(parameter_slots_),
+                         std::move(bind_context),
+                         logical_plans,
+                         current_max_node_id_);
+    return prepared_plan;
+}
+
 void QueryContext::BeginTxn(const BaseStatement *base_statement) {
     if (session_ptr_->GetTxn() == nullptr) {
         bool is_checkpoint = base_statement != nullptr && base_statement->type_ == StatementType::kFlush;
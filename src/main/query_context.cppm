@@ -26,11 +26,15 @@ import storage;
 import txn;
 import data_table;
 import sql_parser;
+import parser_result;
 import optimizer;
 import status;
 import query_result;
 import base_statement;
 import admin_statement;
+import execute_statement;
+import parsed_expr;
+import logical_node;
 
 export module query_context;
 
@@ -41,6 +45,8 @@ class PhysicalPlanner;
 class FragmentBuilder;
 class TaskScheduler;
 struct BGQueryState;
+class PreparedPlan;
+class ValueExpression;
 
 export class QueryContext {
 
@@ -129,6 +135,19 @@ public:
 
     [[nodiscard]] BaseSession* current_session() const { return session_ptr_; }
 
+    // Argument of EXECUTE bound to the '?' placeholder at parameter_idx, nullptr if not available.
+    [[nodiscard]] const ParsedExpr *GetParameter(SizeT parameter_idx) const {
+        if (parameters_ == nullptr || parameter_idx >= parameters_->size()) {
+            return nullptr;
+        }
+        return (*parameters_)[parameter_idx];
+    }
+
+    // The '?' at parameter_idx was bound to value_expression, nullptr if its argument isn't bound to a plain value.
+    void AddParameterSlot(SizeT parameter_idx, SharedPtr<ValueExpression> value_expression) {
+        parameter_slots_.emplace_back(parameter_idx, std::move(value_expression));
+    }
+
     void FlushProfiler(TaskProfiler &&profiler) {
         if(query_profiler_) {
             query_profiler_->Flush(std::move(profiler));
@@ -138,6 +157,10 @@ public:
 private:
     QueryResult HandleAdminStatement(const AdminStatement* admin_statement);
 
+    QueryResult HandlePrepareStatement(UniquePtr<ParserResult> parsed_result);
+
+    SharedPtr<PreparedPlan> PlanPreparedStatement(const ExecuteStatement *execute_statement, Vector<SharedPtr<LogicalNode>> &logical_plans);
+
 private:
     inline void CreateQueryProfiler() {
         if (is_enable_profiling()) {
@@ -188,6 +211,11 @@ private:
 
     u64 catalog_version_{};
 
+    // Arguments of the EXECUTE statement being bound
+    const Vector<ParsedExpr *> *parameters_{};
+    // Values the placeholders were bound to, kept in the cached plan of the prepared statement
+    Vector<Pair<SizeT, SharedPtr<ValueExpression>>> parameter_slots_{};
+
     // User / Tenant information
     String tenant_name_;
     String user_name_;
@@ -66,6 +66,7 @@ public:
     SizeT limit_{0};
     SizeT row_limit_{0};
     CopyFileType copy_file_type_{CopyFileType::kInvalid};
+    CopyCompressionType compression_type_{CopyCompressionType::kNone};
 };
 
 export class OptimizeOptions {
@@ -26,6 +26,8 @@ import global_resource_usage;
 
 namespace infinity {
 
+class PreparedPlan;
+
 export enum class SessionType {
     kLocal,
     kRemote,
@@ -65,6 +67,21 @@ public:
 
     [[nodiscard]] bool GetProfile() const { return enable_profile_; }
 
+    // Prepared statements live until the session is closed or they are prepared again with the same name.
+    void AddPreparedPlan(const String &name, SharedPtr<PreparedPlan> prepared_plan) { prepared_plans_[name] = std::move(prepared_plan); }
+
+    void RemovePreparedPlan(const String &name) { prepared_plans_.erase(name); }
+
+    [[nodiscard]] SharedPtr<PreparedPlan> GetPreparedPlan(const String &name) const {
+        auto iter = prepared_plans_.find(name);
+        if (iter == prepared_plans_.end()) {
+            return nullptr;
+        }
+        return iter->second;
+    }
+
+    [[nodiscard]] SizeT PreparedPlanCount() const { return prepared_plans_.size(); }
+
 protected:
     std::time_t connected_time_;
 
@@ -84,6 +101,8 @@ protected:
     u64 rollbacked_txn_count_{0};
 
     bool enable_profile_{false};
+
+    HashMap<String, SharedPtr<PreparedPlan>> prepared_plans_{};
 };
 
 export class LocalSession : public BaseSession {
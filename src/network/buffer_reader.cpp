@@ -15,7 +15,10 @@
 module;
 
 #include <arpa/inet.h>
-#include <boost/asio/read.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
 
 import stl;
 import third_party;
@@ -144,48 +147,60 @@ String BufferReader::read_string(const SizeT string_length, NullTerminator null_
 }
 
 void BufferReader::receive_more(SizeT bytes) {
-    if (size() >= bytes) {
-        // Current data in buffer is enough for reading.
-        return;
-    }
+    // The connection is served by a pooled worker, a client stalling in the middle of a message mustn't hold the worker.
+    // So only read what is available once the socket is readable, and give up when nothing arrives before the deadline.
+    while (size() < bytes) {
+        wait_readable();
 
-    // Get the available size of the buffer;
-    const auto available_size = max_capacity() - size();
-
-    SizeT bytes_read{0};
-
-    boost::system::error_code boost_error;
-
-    if ((RingBufferIterator::Distance(start_pos_, current_pos_) < 0) || (start_pos_.position_ == 0)) {
-        bytes_read = boost::asio::read(*socket_,
-                                       boost::asio::buffer(current_pos_.position_addr(), available_size),
-                                       boost::asio::transfer_at_least(bytes - size()),
-                                       boost_error);
-    } else {
-        bytes_read = boost::asio::read(
-            *socket_,
-            std::array<boost::asio::mutable_buffer, 2>{boost::asio::buffer(current_pos_.position_addr(), PG_MSG_BUFFER_SIZE - current_pos_.position_),
-                                                       boost::asio::buffer(&data_[0], start_pos_.position_ - 1)},
-            boost::asio::transfer_at_least(bytes - size()),
-            boost_error);
-    }
+        // Get the available size of the buffer;
+        const auto available_size = max_capacity() - size();
 
-    if (boost_error == boost::asio::error::broken_pipe || boost_error == boost::asio::error::connection_reset) {
-        String error_message = fmt::format("Client close the connection: {}", boost_error.message());
-        RecoverableError(Status::ClientClose());
-    }
+        SizeT bytes_read{0};
 
-    if(bytes_read == 0) {
-        LOG_TRACE("Client is disconnected.");
-        RecoverableError(Status::ClientClose());
+        boost::system::error_code boost_error;
+
+        if ((RingBufferIterator::Distance(start_pos_, current_pos_) < 0) || (start_pos_.position_ == 0)) {
+            bytes_read = socket_->read_some(boost::asio::buffer(current_pos_.position_addr(), available_size), boost_error);
+        } else {
+            bytes_read = socket_->read_some(
+                std::array<boost::asio::mutable_buffer, 2>{boost::asio::buffer(current_pos_.position_addr(), PG_MSG_BUFFER_SIZE - current_pos_.position_),
+                                                           boost::asio::buffer(&data_[0], start_pos_.position_ - 1)},
+                boost_error);
+        }
+
+        if (boost_error == boost::asio::error::broken_pipe || boost_error == boost::asio::error::connection_reset) {
+            String error_message = fmt::format("Client close the connection: {}", boost_error.message());
+            RecoverableError(Status::ClientClose());
+        }
+
+        if (bytes_read == 0) {
+            LOG_TRACE("Client is disconnected.");
+            RecoverableError(Status::ClientClose());
+        }
+
+        if (boost_error) {
+            String error_message = boost_error.message();
+            RecoverableError(Status::IOError(error_message));
+        }
+
+        current_pos_.increment(bytes_read);
     }
+}
 
-    if (boost_error) {
-        String error_message = boost_error.message();
+void BufferReader::wait_readable() {
+    pollfd poll_fd{socket_->native_handle(), POLLIN, 0};
+    int ret = 0;
+    do {
+        ret = ::poll(&poll_fd, 1, PG_MSG_READ_TIMEOUT_MS);
+    } while (ret < 0 && errno == EINTR);
+    if (ret == 0) {
+        String error_message = fmt::format("No data is received from the client in {} ms.", PG_MSG_READ_TIMEOUT_MS);
+        RecoverableError(Status::IOError(error_message));
+    }
+    if (ret < 0) {
+        String error_message = fmt::format("Poll the client socket failed: {}", std::strerror(errno));
         RecoverableError(Status::IOError(error_message));
     }
-
-    current_pos_.increment(bytes_read);
 }
 
 } // namespace infinity
@@ -53,6 +53,9 @@ public:
 private:
     void receive_more(SizeT more_bytes = 1);
 
+    // Wait until the socket is readable, at most PG_MSG_READ_TIMEOUT_MS
+    void wait_readable();
+
     Array<char, PG_MSG_BUFFER_SIZE> data_{};
     RingBufferIterator start_pos_{data_};
     RingBufferIterator current_pos_{data_};
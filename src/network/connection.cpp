@@ -14,7 +14,12 @@
 
 module;
 
+#include <algorithm>
+#include <bit>
 #include <boost/asio/ip/tcp.hpp>
+#include <cctype>
+#include <cstdlib>
+#include <type_traits>
 
 module connection;
 
@@ -39,9 +44,391 @@ import logical_type;
 import embedding_info;
 import sparse_info;
 import data_type;
+import column_vector;
+import data_block;
+import value;
 
 namespace infinity {
 
+namespace {
+
+// PostgreSQL type OIDs used by parameters and binary results
+constexpr u32 PG_BOOL_OID = 16;
+constexpr u32 PG_CHAR_OID = 18;
+constexpr u32 PG_INT8_OID = 20;
+constexpr u32 PG_INT2_OID = 21;
+constexpr u32 PG_INT4_OID = 23;
+constexpr u32 PG_TEXT_OID = 25;
+constexpr u32 PG_FLOAT4_OID = 700;
+constexpr u32 PG_FLOAT8_OID = 701;
+constexpr u32 PG_NUMERIC_OID = 1700;
+
+bool IsNumberLiteral(const String &value) {
+    if (value.empty() || value.find_first_not_of("0123456789+-.eE") != String::npos) {
+        return false;
+    }
+    char *end = nullptr;
+    std::strtod(value.c_str(), &end);
+    return end == value.c_str() + value.size();
+}
+
+// Replace the $n placeholders of the query by '?'. Parameters are bound to '?' by position, so record the parameter index of each '?'.
+String RewritePlaceholders(const String &query, Vector<SizeT> &parameter_order, SizeT &parameter_count) {
+    String result;
+    result.reserve(query.size());
+    char quote = 0;
+    for (SizeT i = 0; i < query.size(); ++i) {
+        char c = query[i];
+        if (quote != 0) {
+            if (c == quote) {
+                quote = 0;
+            }
+        } else if (c == '\'' || c == '"') {
+            quote = c;
+        } else if (c == '$' && i + 1 < query.size() && std::isdigit(query[i + 1])) {
+            SizeT parameter_idx = 0;
+            while (i + 1 < query.size() && std::isdigit(query[i + 1])) {
+                parameter_idx = parameter_idx * 10 + (query[++i] - '0');
+            }
+            if (parameter_idx > 0) {
+                parameter_order.push_back(parameter_idx - 1);
+                parameter_count = std::max(parameter_count, parameter_idx);
+                result.push_back('?');
+                continue;
+            }
+        }
+        result.push_back(c);
+    }
+    return result;
+}
+
+// Replace each '?' of the query by the literal of its parameter
+String SubstituteParameters(const String &query, const Vector<String> &literals) {
+    String result;
+    SizeT literal_idx = 0;
+    char quote = 0;
+    for (char c : query) {
+        if (quote != 0) {
+            if (c == quote) {
+                quote = 0;
+            }
+        } else if (c == '\'' || c == '"') {
+            quote = c;
+        } else if (c == '?' && literal_idx < literals.size()) {
+            result += literals[literal_idx++];
+            continue;
+        }
+        result.push_back(c);
+    }
+    return result;
+}
+
+// Only SELECT statements can be prepared, others are executed with the parameters substituted into the query text.
+bool IsSelectQuery(const String &query) {
+    SizeT begin = query.find_first_not_of(" \t\r\n(");
+    if (begin == String::npos || query.size() - begin < 6) {
+        return false;
+    }
+    String keyword = query.substr(begin, 6);
+    std::transform(keyword.begin(), keyword.end(), keyword.begin(), ::tolower);
+    return keyword == "select";
+}
+
+// `value` holds exactly sizeof(T) bytes
+template <typename T>
+T ReadNetworkValue(const String &value) {
+    using U = std::conditional_t<sizeof(T) == 1, u8, std::conditional_t<sizeof(T) == 2, u16, std::conditional_t<sizeof(T) == 4, u32, u64>>>;
+    U bits = 0;
+    for (char c : value) {
+        bits = (bits << 8) | static_cast<u8>(c);
+    }
+    return std::bit_cast<T>(bits);
+}
+
+template <typename T>
+void AppendNetworkValue(String &buffer, T value) {
+    using U = std::conditional_t<sizeof(T) == 1, u8, std::conditional_t<sizeof(T) == 2, u16, std::conditional_t<sizeof(T) == 4, u32, u64>>>;
+    U bits = std::bit_cast<U>(value);
+    for (SizeT i = sizeof(U); i > 0; --i) {
+        buffer.push_back(static_cast<char>(bits >> ((i - 1) * 8)));
+    }
+}
+
+template <typename T>
+String BinaryLengthError(const String &data) {
+    return fmt::format("Binary parameter has {} bytes, {} bytes are expected", data.size(), sizeof(T));
+}
+
+template <typename T>
+Optional<String> BinaryNumberLiteral(const String &data, String &literal) {
+    if (data.size() != sizeof(T)) {
+        return BinaryLengthError<T>(data);
+    }
+    literal = fmt::format("{}", ReadNetworkValue<T>(data));
+    return None;
+}
+
+// Convert a bound parameter to a SQL literal. Returns an error message if the value can't be converted.
+Optional<String> ParameterToLiteral(const Optional<String> &value, PGFormatCode format, u32 type_oid, String &literal) {
+    if (!value.has_value()) {
+        literal = "NULL";
+        return None;
+    }
+    const String &data = value.value();
+    if (format == PGFormatCode::kBinary) {
+        switch (type_oid) {
+            case PG_BOOL_OID: {
+                if (data.size() != 1) {
+                    return BinaryLengthError<u8>(data);
+                }
+                literal = data[0] != 0 ? "true" : "false";
+                return None;
+            }
+            case PG_INT2_OID: {
+                return BinaryNumberLiteral<i16>(data, literal);
+            }
+            case PG_INT4_OID: {
+                return BinaryNumberLiteral<i32>(data, literal);
+            }
+            case PG_INT8_OID: {
+                return BinaryNumberLiteral<i64>(data, literal);
+            }
+            case PG_FLOAT4_OID: {
+                return BinaryNumberLiteral<f32>(data, literal);
+            }
+            case PG_FLOAT8_OID: {
+                return BinaryNumberLiteral<f64>(data, literal);
+            }
+            default: {
+                return fmt::format("Binary format isn't supported for parameter type {}", type_oid);
+            }
+        }
+    }
+
+    switch (type_oid) {
+        case PG_BOOL_OID: {
+            literal = (data == "t" || data == "true" || data == "1") ? "true" : "false";
+            return None;
+        }
+        case PG_INT2_OID:
+        case PG_INT4_OID:
+        case PG_INT8_OID:
+        case PG_FLOAT4_OID:
+        case PG_FLOAT8_OID:
+        case PG_NUMERIC_OID: {
+            if (!IsNumberLiteral(data)) {
+                return fmt::format("Invalid number parameter: {}", data);
+            }
+            literal = data;
+            return None;
+        }
+        case 1000:   // bool[]
+        case 1002:   // char[]
+        case 1005:   // int2[]
+        case 1007:   // int4[]
+        case 1016:   // int8[]
+        case 1021:   // float4[]
+        case 1022: { // float8[]
+            // Array '{1,2,3}' to embedding '[1,2,3]'
+            if (data.size() < 2 || data.front() != '{' || data.back() != '}' ||
+                data.find_first_not_of("0123456789+-.eE, ", 1) != data.size() - 1) {
+                return fmt::format("Invalid array parameter: {}", data);
+            }
+            literal = "[" + data.substr(1, data.size() - 2) + "]";
+            return None;
+        }
+        default: {
+            // Unspecified type: numbers are passed as is, others as strings
+            if (type_oid == 0 && IsNumberLiteral(data)) {
+                literal = data;
+                return None;
+            }
+            literal.clear();
+            literal.push_back('\'');
+            for (char c : data) {
+                if (c == '\'') {
+                    literal.push_back('\'');
+                }
+                literal.push_back(c);
+            }
+            literal.push_back('\'');
+            return None;
+        }
+    }
+}
+
+// Result columns of these types can be sent in binary format
+bool SupportBinaryFormat(const DataType &data_type) {
+    switch (data_type.type()) {
+        case LogicalType::kBoolean:
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kFloat16:
+        case LogicalType::kBFloat16:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kVarchar: {
+            return true;
+        }
+        case LogicalType::kEmbedding: {
+            const auto *embedding_info = static_cast<const EmbeddingInfo *>(data_type.type_info().get());
+            return embedding_info != nullptr && embedding_info->Type() != EmbeddingDataType::kElemInvalid;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+template <typename T, typename NetworkT = T>
+void AppendBinaryArray(String &buffer, const T *elements, SizeT dimension, u32 element_oid) {
+    // One dimensional array without null: ndim, has null, element type, dimension, lower bound, then (length, value) of each element
+    AppendNetworkValue<i32>(buffer, 1);
+    AppendNetworkValue<i32>(buffer, 0);
+    AppendNetworkValue<u32>(buffer, element_oid);
+    AppendNetworkValue<i32>(buffer, dimension);
+    AppendNetworkValue<i32>(buffer, 1);
+    for (SizeT i = 0; i < dimension; ++i) {
+        AppendNetworkValue<i32>(buffer, sizeof(NetworkT));
+        AppendNetworkValue<NetworkT>(buffer, static_cast<NetworkT>(elements[i]));
+    }
+}
+
+// Binary value of the row, in the types announced by Connection::SendTableDescription
+Optional<String> BinaryValue(const ColumnVector &column_vector, SizeT row_id) {
+    if (!column_vector.nulls_ptr_->IsTrue(row_id)) {
+        return None;
+    }
+    const DataType &data_type = *column_vector.data_type();
+    const_ptr_t data = column_vector.data();
+    String buffer;
+    switch (data_type.type()) {
+        case LogicalType::kBoolean: {
+            AppendNetworkValue<u8>(buffer, column_vector.GetValue(row_id).GetValue<BooleanT>() ? 1 : 0);
+            break;
+        }
+        case LogicalType::kTinyInt: {
+            AppendNetworkValue<i8>(buffer, reinterpret_cast<const TinyIntT *>(data)[row_id]);
+            break;
+        }
+        case LogicalType::kSmallInt: {
+            AppendNetworkValue<i16>(buffer, reinterpret_cast<const SmallIntT *>(data)[row_id]);
+            break;
+        }
+        case LogicalType::kInteger: {
+            AppendNetworkValue<i32>(buffer, reinterpret_cast<const IntegerT *>(data)[row_id]);
+            break;
+        }
+        case LogicalType::kBigInt: {
+            AppendNetworkValue<i64>(buffer, reinterpret_cast<const BigIntT *>(data)[row_id]);
+            break;
+        }
+        case LogicalType::kFloat16: {
+            AppendNetworkValue<f32>(buffer, static_cast<f32>(reinterpret_cast<const Float16T *>(data)[row_id]));
+            break;
+        }
+        case LogicalType::kBFloat16: {
+            AppendNetworkValue<f32>(buffer, static_cast<f32>(reinterpret_cast<const BFloat16T *>(data)[row_id]));
+            break;
+        }
+        case LogicalType::kFloat: {
+            AppendNetworkValue<f32>(buffer, reinterpret_cast<const FloatT *>(data)[row_id]);
+            break;
+        }
+        case LogicalType::kDouble: {
+            AppendNetworkValue<f64>(buffer, reinterpret_cast<const DoubleT *>(data)[row_id]);
+            break;
+        }
+        case LogicalType::kVarchar: {
+            // Binary format of text is the text itself
+            return column_vector.ToString(row_id);
+        }
+        case LogicalType::kEmbedding: {
+            const auto *embedding_info = static_cast<const EmbeddingInfo *>(data_type.type_info().get());
+            SizeT dimension = embedding_info->Dimension();
+            const_ptr_t embedding = data + row_id * embedding_info->Size();
+            switch (embedding_info->Type()) {
+                case EmbeddingDataType::kElemBit: {
+                    Vector<u8> bits(dimension);
+                    for (SizeT i = 0; i < dimension; ++i) {
+                        bits[i] = (static_cast<u8>(embedding[i / 8]) >> (i % 8)) & 1;
+                    }
+                    AppendBinaryArray<u8>(buffer, bits.data(), dimension, PG_BOOL_OID);
+                    break;
+                }
+                case EmbeddingDataType::kElemUInt8: {
+                    AppendBinaryArray<u8>(buffer, reinterpret_cast<const u8 *>(embedding), dimension, PG_CHAR_OID);
+                    break;
+                }
+                case EmbeddingDataType::kElemInt8: {
+                    AppendBinaryArray<i8>(buffer, reinterpret_cast<const i8 *>(embedding), dimension, PG_CHAR_OID);
+                    break;
+                }
+                case EmbeddingDataType::kElemInt16: {
+                    AppendBinaryArray<i16>(buffer, reinterpret_cast<const i16 *>(embedding), dimension, PG_INT2_OID);
+                    break;
+                }
+                case EmbeddingDataType::kElemInt32: {
+                    AppendBinaryArray<i32>(buffer, reinterpret_cast<const i32 *>(embedding), dimension, PG_INT4_OID);
+                    break;
+                }
+                case EmbeddingDataType::kElemInt64: {
+                    AppendBinaryArray<i64>(buffer, reinterpret_cast<const i64 *>(embedding), dimension, PG_INT8_OID);
+                    break;
+                }
+                case EmbeddingDataType::kElemFloat16: {
+                    AppendBinaryArray<Float16T, f32>(buffer, reinterpret_cast<const Float16T *>(embedding), dimension, PG_FLOAT4_OID);
+                    break;
+                }
+                case EmbeddingDataType::kElemBFloat16: {
+                    AppendBinaryArray<BFloat16T, f32>(buffer, reinterpret_cast<const BFloat16T *>(embedding), dimension, PG_FLOAT4_OID);
+                    break;
+                }
+                case EmbeddingDataType::kElemFloat: {
+                    AppendBinaryArray<f32>(buffer, reinterpret_cast<const f32 *>(embedding), dimension, PG_FLOAT4_OID);
+                    break;
+                }
+                case EmbeddingDataType::kElemDouble: {
+                    AppendBinaryArray<f64>(buffer, reinterpret_cast<const f64 *>(embedding), dimension, PG_FLOAT8_OID);
+                    break;
+                }
+                case EmbeddingDataType::kElemInvalid: {
+                    String error_message = "Invalid embedding data type";
+                    UnrecoverableError(error_message);
+                }
+            }
+            break;
+        }
+        default: {
+            String error_message = fmt::format("Binary format isn't supported for {}", data_type.ToString());
+            UnrecoverableError(error_message);
+        }
+    }
+    return buffer;
+}
+
+// Result format of each column: the requested format if it's supported by the column type, otherwise text
+Vector<PGFormatCode> ResultColumnFormats(const Vector<PGFormatCode> &result_formats, const DataTable &result_table) {
+    SizeT column_count = result_table.ColumnCount();
+    Vector<PGFormatCode> column_formats(column_count, PGFormatCode::kText);
+    for (SizeT idx = 0; idx < column_count; ++idx) {
+        PGFormatCode format = PGFormatCode::kText;
+        if (result_formats.size() == 1) {
+            format = result_formats[0];
+        } else if (idx < result_formats.size()) {
+            format = result_formats[idx];
+        }
+        if (format == PGFormatCode::kBinary && SupportBinaryFormat(*result_table.GetColumnTypeById(idx))) {
+            column_formats[idx] = PGFormatCode::kBinary;
+        }
+    }
+    return column_formats;
+}
+
+} // namespace
+
 Connection::Connection(boost::asio::io_service &io_service)
     : socket_(MakeShared<boost::asio::ip::tcp::socket>(io_service)), pg_handler_(MakeShared<PGProtocolHandler>(socket())) {}
 
@@ -62,15 +449,61 @@ void Connection::HandleError(const char* error_message) {
     pg_handler_->send_ready_for_query();
 }
 
+void Connection::HandleExtendedError(const String &error_message) {
+    HashMap<PGMessageType, String> error_message_map;
+    error_message_map[PGMessageType::kHumanReadableError] = error_message;
+    LOG_ERROR(error_message);
+    pg_handler_->send_error_response(error_message_map);
+    skip_until_sync_ = true;
+}
+
 void Connection::Run() {
+    while (HandleReceivedRequests()) {
+        ;
+    }
+}
+
+bool Connection::HandleReceivedRequests() {
+    if (!session_started_) {
+        session_started_ = true;
+        try {
+            if (!StartSession()) {
+                return false;
+            }
+        } catch (const infinity::RecoverableException &e) {
+            LOG_TRACE(fmt::format("Recoverable exception: {}", e.what()));
+            return false;
+        }
+        if (!pg_handler_->has_buffered_command()) {
+            return true;
+        }
+    }
+
+    // Handle the command which wakes up the connection, and the pipelined commands received along with it.
+    do {
+        try {
+            HandleRequest();
+        } catch (const infinity::RecoverableException &e) {
+            LOG_TRACE(fmt::format("Recoverable exception: {}", e.what()));
+            return false;
+        } catch (const infinity::UnrecoverableException &e) {
+            HandleError(e.what());
+        } catch (const std::exception &e) {
+            HandleError(e.what());
+        }
+    } while (!terminate_connection_ && pg_handler_->has_buffered_command());
+    return !terminate_connection_;
+}
+
+bool Connection::StartSession() {
     // Disable Nagle's algorithm to reduce TCP latency, but will reduce the throughput.
     socket_->set_option(boost::asio::ip::tcp::no_delay(true));
 
     SessionManager *session_manager = InfinityContext::instance().session_manager();
     SharedPtr<RemoteSession> remote_session = session_manager->CreateRemoteSession();
-    if(remote_session == nullptr) {
+    if (remote_session == nullptr) {
         HandleError("Infinity is running under maintenance mode, only one connection is allowed.");
-        return ;
+        return false;
     }
 
     session_ = std::move(remote_session);
@@ -78,19 +511,7 @@ void Connection::Run() {
     HandleConnection();
 
     session_->SetClientInfo(socket_->remote_endpoint().address().to_string(), socket_->remote_endpoint().port());
-
-    while (!terminate_connection_) {
-        try {
-            HandleRequest();
-        } catch (const infinity::RecoverableException &e) {
-            LOG_TRACE(fmt::format("Recoverable exception: {}", e.what()));
-            return ;
-        } catch (const infinity::UnrecoverableException& e) {
-            HandleError(e.what());
-        } catch (const std::exception &e) {
-            HandleError(e.what());
-        }
-    }
+    return true;
 }
 
 void Connection::HandleConnection() {
@@ -107,6 +528,10 @@ void Connection::HandleConnection() {
 
 void Connection::HandleRequest() {
     const auto cmd_type = pg_handler_->read_command_type();
+    if (skip_until_sync_ && cmd_type != PGMessageType::kSyncCommand && cmd_type != PGMessageType::kTerminateCommand) {
+        pg_handler_->skip_command_body();
+        return;
+    }
 
     // FIXME
     UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
@@ -120,18 +545,22 @@ void Connection::HandleRequest() {
     switch (cmd_type) {
         case PGMessageType::kBindCommand: {
             LOG_TRACE("BindCommand");
+            HandleBind();
             break;
         }
         case PGMessageType::kDescribeCommand: {
             LOG_TRACE("DescribeCommand");
+            HandleDescribe(query_context_ptr.get());
             break;
         }
         case PGMessageType::kExecuteCommand: {
             LOG_TRACE("ExecuteCommand");
+            HandleExecute(query_context_ptr.get());
             break;
         }
         case PGMessageType::kParseCommand: {
             LOG_TRACE("ParseCommand");
+            HandleParse(query_context_ptr.get());
             break;
         }
         case PGMessageType::kSimpleQueryCommand: {
@@ -140,6 +569,17 @@ void Connection::HandleRequest() {
         }
         case PGMessageType::kSyncCommand: {
             LOG_TRACE("SyncCommand");
+            HandleSync();
+            break;
+        }
+        case PGMessageType::kCloseCommand: {
+            LOG_TRACE("CloseCommand");
+            HandleClose();
+            break;
+        }
+        case PGMessageType::kFlushCommand: {
+            pg_handler_->skip_command_body();
+            pg_handler_->Flush();
             break;
         }
         case PGMessageType::kTerminateCommand: {
@@ -174,7 +614,213 @@ void Connection::HandlerSimpleQuery(QueryContext *query_context) {
     pg_handler_->send_ready_for_query();
 }
 
-void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table) {
+void Connection::HandleParse(QueryContext *query_context) {
+    PGParseMessage parse_message = pg_handler_->read_parse_message();
+    auto statement = MakeShared<PGStatement>();
+    statement->query_ = RewritePlaceholders(parse_message.query_, statement->parameter_order_, statement->parameter_count_);
+    statement->parameter_count_ = std::max(statement->parameter_count_, parse_message.parameter_types_.size());
+    statement->parameter_types_ = std::move(parse_message.parameter_types_);
+    LOG_TRACE(fmt::format("Parse statement {}: {}", parse_message.statement_name_, statement->query_));
+
+    if (IsSelectQuery(statement->query_)) {
+        // Prepare the query as a session prepared plan, so that its logical plan is cached across executions.
+        statement->prepared_name_ = fmt::format("pg_statement_{}", next_statement_id_++);
+        QueryResult result = query_context->Query(fmt::format("PREPARE {} AS {}", statement->prepared_name_, statement->query_));
+        if (!result.IsOk()) {
+            HandleExtendedError(result.status_.message());
+            return;
+        }
+    }
+
+    auto iter = statements_.find(parse_message.statement_name_);
+    if (iter != statements_.end()) {
+        if (!iter->second->prepared_name_.empty()) {
+            session_->RemovePreparedPlan(iter->second->prepared_name_);
+        }
+        iter->second = std::move(statement);
+    } else {
+        statements_.emplace(parse_message.statement_name_, std::move(statement));
+    }
+    pg_handler_->SendEmptyMessage(PGMessageType::kParseComplete);
+}
+
+void Connection::HandleBind() {
+    PGBindMessage bind_message = pg_handler_->read_bind_message();
+    auto iter = statements_.find(bind_message.statement_name_);
+    if (iter == statements_.end()) {
+        HandleExtendedError(fmt::format("Prepared statement \"{}\" doesn't exist", bind_message.statement_name_));
+        return;
+    }
+    const SharedPtr<PGStatement> &statement = iter->second;
+    if (bind_message.parameters_.size() != statement->parameter_count_) {
+        HandleExtendedError(fmt::format("Statement expects {} parameters, but {} are bound", statement->parameter_count_, bind_message.parameters_.size()));
+        return;
+    }
+
+    PGPortal portal;
+    portal.statement_ = statement;
+    portal.result_formats_ = std::move(bind_message.result_formats_);
+    SizeT parameter_count = bind_message.parameters_.size();
+    portal.parameters_.resize(parameter_count);
+    for (SizeT idx = 0; idx < parameter_count; ++idx) {
+        PGFormatCode format = PGFormatCode::kText;
+        if (bind_message.parameter_formats_.size() == 1) {
+            format = bind_message.parameter_formats_[0];
+        } else if (idx < bind_message.parameter_formats_.size()) {
+            format = bind_message.parameter_formats_[idx];
+        }
+        u32 type_oid = idx < statement->parameter_types_.size() ? statement->parameter_types_[idx] : 0;
+        Optional<String> error_message = ParameterToLiteral(bind_message.parameters_[idx], format, type_oid, portal.parameters_[idx]);
+        if (error_message.has_value()) {
+            HandleExtendedError(error_message.value());
+            return;
+        }
+    }
+    portals_[bind_message.portal_name_] = std::move(portal);
+    pg_handler_->SendEmptyMessage(PGMessageType::kBindComplete);
+}
+
+void Connection::HandleDescribe(QueryContext *query_context) {
+    PGTargetMessage describe_message = pg_handler_->read_target_message();
+    if (describe_message.target_type_ == 'S') {
+        auto iter = statements_.find(describe_message.name_);
+        if (iter == statements_.end()) {
+            HandleExtendedError(fmt::format("Prepared statement \"{}\" doesn't exist", describe_message.name_));
+            return;
+        }
+        const PGStatement &statement = *iter->second;
+        Vector<u32> parameter_types(statement.parameter_count_, PG_TEXT_OID);
+        for (SizeT idx = 0; idx < statement.parameter_types_.size(); ++idx) {
+            if (statement.parameter_types_[idx] != 0) {
+                parameter_types[idx] = statement.parameter_types_[idx];
+            }
+        }
+        pg_handler_->SendParameterDescription(parameter_types);
+        // Result columns are only known when a portal of the statement is described or executed
+        pg_handler_->SendEmptyMessage(PGMessageType::kNoData);
+        return;
+    }
+
+    auto iter = portals_.find(describe_message.name_);
+    if (iter == portals_.end()) {
+        HandleExtendedError(fmt::format("Portal \"{}\" doesn't exist", describe_message.name_));
+        return;
+    }
+    PGPortal &portal = iter->second;
+    if (!ExecutePortal(query_context, portal)) {
+        return;
+    }
+    const SharedPtr<DataTable> &result_table = portal.result_->result_table_;
+    if (!SendTableDescription(result_table, ResultColumnFormats(portal.result_formats_, *result_table))) {
+        pg_handler_->SendEmptyMessage(PGMessageType::kNoData);
+    }
+}
+
+void Connection::HandleExecute(QueryContext *query_context) {
+    PGExecuteMessage execute_message = pg_handler_->read_execute_message();
+    auto iter = portals_.find(execute_message.portal_name_);
+    if (iter == portals_.end()) {
+        HandleExtendedError(fmt::format("Portal \"{}\" doesn't exist", execute_message.portal_name_));
+        return;
+    }
+    PGPortal &portal = iter->second;
+    if (!ExecutePortal(query_context, portal)) {
+        return;
+    }
+    if (SendPortalRows(portal, execute_message.max_rows_)) {
+        SendCommandComplete(*portal.result_);
+    } else {
+        pg_handler_->SendEmptyMessage(PGMessageType::kPortalSuspended);
+    }
+}
+
+void Connection::HandleClose() {
+    PGTargetMessage close_message = pg_handler_->read_target_message();
+    if (close_message.target_type_ == 'S') {
+        auto iter = statements_.find(close_message.name_);
+        if (iter != statements_.end()) {
+            if (!iter->second->prepared_name_.empty()) {
+                session_->RemovePreparedPlan(iter->second->prepared_name_);
+            }
+            statements_.erase(iter);
+        }
+    } else {
+        portals_.erase(close_message.name_);
+    }
+    pg_handler_->SendEmptyMessage(PGMessageType::kCloseComplete);
+}
+
+void Connection::HandleSync() {
+    pg_handler_->skip_command_body();
+    skip_until_sync_ = false;
+    // The unnamed portal only lives until the end of the implicit transaction
+    portals_.erase(String());
+    pg_handler_->send_ready_for_query();
+}
+
+bool Connection::ExecutePortal(QueryContext *query_context, PGPortal &portal) {
+    if (portal.result_.get() != nullptr) {
+        return true;
+    }
+
+    const PGStatement &statement = *portal.statement_;
+    Vector<String> literals;
+    literals.reserve(statement.parameter_order_.size());
+    for (SizeT parameter_idx : statement.parameter_order_) {
+        literals.push_back(portal.parameters_[parameter_idx]);
+    }
+    String query;
+    if (statement.prepared_name_.empty()) {
+        query = SubstituteParameters(statement.query_, literals);
+    } else if (literals.empty()) {
+        query = fmt::format("EXECUTE {}", statement.prepared_name_);
+    } else {
+        query = fmt::format("EXECUTE {} ({})", statement.prepared_name_, fmt::join(literals, ", "));
+    }
+
+    QueryResult result = query_context->Query(query);
+    if (result.result_table_.get() == nullptr) {
+        HandleExtendedError(result.status_.message());
+        return false;
+    }
+    portal.result_ = MakeUnique<QueryResult>(std::move(result));
+    return true;
+}
+
+bool Connection::SendPortalRows(PGPortal &portal, u32 max_rows) {
+    const SharedPtr<DataTable> &result_table = portal.result_->result_table_;
+    Vector<PGFormatCode> column_formats = ResultColumnFormats(portal.result_formats_, *result_table);
+    SizeT column_count = result_table->ColumnCount();
+    auto values = Vector<Optional<String>>(column_count);
+    SizeT block_count = result_table->DataBlockCount();
+    SizeT sent_rows = 0;
+    for (; portal.block_idx_ < block_count; ++portal.block_idx_, portal.row_idx_ = 0) {
+        auto block = result_table->GetDataBlockById(portal.block_idx_);
+        SizeT row_count = block->row_count();
+        for (; portal.row_idx_ < row_count; ++portal.row_idx_) {
+            if (max_rows != 0 && sent_rows == max_rows) {
+                return false;
+            }
+            SizeT value_length_sum = 0;
+            for (SizeT column_id = 0; column_id < column_count; ++column_id) {
+                const ColumnVector &column_vector = *block->column_vectors[column_id];
+                if (column_formats[column_id] == PGFormatCode::kBinary) {
+                    values[column_id] = BinaryValue(column_vector, portal.row_idx_);
+                } else {
+                    values[column_id] = column_vector.ToString(portal.row_idx_);
+                }
+                if (values[column_id].has_value()) {
+                    value_length_sum += values[column_id]->size();
+                }
+            }
+            pg_handler_->SendData(values, value_length_sum);
+            ++sent_rows;
+        }
+    }
+    return true;
+}
+
+bool Connection::SendTableDescription(const SharedPtr<DataTable> &result_table, const Vector<PGFormatCode> &column_formats) {
     u32 column_name_length_sum = 0;
     SizeT column_count = result_table->ColumnCount();
     for (SizeT idx = 0; idx < column_count; ++idx) {
@@ -183,7 +829,7 @@ void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table)
 
     // No output columns, no need to send table description, just return.
     if (column_name_length_sum == 0)
-        return;
+        return false;
 
     pg_handler_->SendDescriptionHeader(column_name_length_sum, column_count);
 
@@ -377,8 +1023,10 @@ void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table)
             }
         }
 
-        pg_handler_->SendDescription(result_table->GetColumnNameById(idx), object_id, object_width);
+        PGFormatCode format = idx < column_formats.size() ? column_formats[idx] : PGFormatCode::kText;
+        pg_handler_->SendDescription(result_table->GetColumnNameById(idx), object_id, object_width, format);
     }
+    return true;
 }
 
 void Connection::SendQueryResponse(const QueryResult &query_result) {
@@ -405,6 +1053,10 @@ void Connection::SendQueryResponse(const QueryResult &query_result) {
         }
     }
 
+    SendCommandComplete(query_result);
+}
+
+void Connection::SendCommandComplete(const QueryResult &query_result) {
     String message;
     switch (query_result.root_operator_type_) {
         case LogicalNodeType::kInsert: {
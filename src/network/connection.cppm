@@ -23,9 +23,34 @@ import pg_protocol_handler;
 import query_context;
 import data_table;
 import query_result;
+import pg_message;
 
 namespace infinity {
 
+// A statement of the extended query protocol, created by Parse
+struct PGStatement {
+    // Query with the $n placeholders replaced by '?'
+    String query_{};
+    // Name of the session prepared plan. Empty if the query can't be prepared, then parameters are substituted into the query text.
+    String prepared_name_{};
+    // The i-th '?' of the query is bound to parameter parameter_order_[i]
+    Vector<SizeT> parameter_order_{};
+    SizeT parameter_count_{};
+    Vector<u32> parameter_types_{};
+};
+
+// A statement bound to its parameters, created by Bind
+struct PGPortal {
+    SharedPtr<PGStatement> statement_{};
+    // Parameters as SQL literals
+    Vector<String> parameters_{};
+    Vector<PGFormatCode> result_formats_{};
+    // The statement is executed on the first Describe or Execute of the portal, Execute may fetch the rows in several calls.
+    UniquePtr<QueryResult> result_{};
+    SizeT block_idx_{};
+    SizeT row_idx_{};
+};
+
 export class Connection {
 public:
     explicit Connection(boost::asio::io_service &io_service);
@@ -34,6 +59,10 @@ public:
 
     void Run();
 
+    // Handle the received commands of the connection, starting with the startup handshake of a new connection.
+    // Returns false if the connection shall be closed.
+    bool HandleReceivedRequests();
+
     inline SharedPtr<boost::asio::ip::tcp::socket> socket() { return socket_; }
 
     inline void GetClientInfo(String &ip_address, u16 &port) {
@@ -50,14 +79,40 @@ private:
 
     void HandleRequest();
 
+    bool StartSession();
+
     void HandlerSimpleQuery(QueryContext *query_context);
 
-    void SendTableDescription(const SharedPtr<DataTable> &result_table);
+    void HandleParse(QueryContext *query_context);
+
+    void HandleBind();
+
+    void HandleDescribe(QueryContext *query_context);
+
+    void HandleExecute(QueryContext *query_context);
+
+    void HandleClose();
+
+    void HandleSync();
+
+    // Execute the portal if it isn't executed yet. Returns false on error.
+    bool ExecutePortal(QueryContext *query_context, PGPortal &portal);
+
+    // Returns false if there is no column to describe.
+    bool SendTableDescription(const SharedPtr<DataTable> &result_table, const Vector<PGFormatCode> &column_formats = {});
 
     void SendQueryResponse(const QueryResult &query_result);
 
+    // Send the rows of the portal from its cursor, at most max_rows rows if it isn't 0. Returns true if all rows are sent.
+    bool SendPortalRows(PGPortal &portal, u32 max_rows);
+
+    void SendCommandComplete(const QueryResult &query_result);
+
     void HandleError(const char* error_message);
 
+    // Errors of the extended query protocol: send the error and discard the following commands until Sync.
+    void HandleExtendedError(const String &error_message);
+
 private:
     const SharedPtr<boost::asio::ip::tcp::socket> socket_{};
 
@@ -65,6 +120,16 @@ private:
 
     bool terminate_connection_ = false;
 
+    bool session_started_ = false;
+
+    bool skip_until_sync_ = false;
+
+    u64 next_statement_id_{0};
+
+    HashMap<String, SharedPtr<PGStatement>> statements_{};
+
+    HashMap<String, PGPortal> portals_{};
+
     SharedPtr<RemoteSession> session_{};
 };
 
@@ -677,6 +677,19 @@ public:
                 if (http_body_json.contains("row_limit")) {
                     export_options.row_limit_ = http_body_json["row_limit"];
                 }
+                if (http_body_json.contains("compression")) {
+                    String compression_str = http_body_json["compression"];
+                    ToLower(compression_str);
+                    if (compression_str == "zstd") {
+                        export_options.compression_type_ = CopyCompressionType::kZstd;
+                    } else if (compression_str == "lz4") {
+                        export_options.compression_type_ = CopyCompressionType::kLz4;
+                    } else if (compression_str != "none") {
+                        json_response["error_code"] = ErrorCode::kNotSupported;
+                        json_response["error_message"] = fmt::format("Not supported compression type: {}", compression_str);
+                        return ResponseFactory::createResponse(http_status, json_response.dump());
+                    }
+                }
                 if (http_body_json.contains("delimiter")) {
                     String delimiter = http_body_json["delimiter"];
                     if (delimiter.size() != 1) {
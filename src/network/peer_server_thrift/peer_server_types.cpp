@@ -1139,6 +1139,10 @@ void SyncLogRequest::__set_node_name(const std::string& val) {
 void SyncLogRequest::__set_log_entries(const std::vector<std::string> & val) {
   this->log_entries = val;
 }
+
+void SyncLogRequest::__set_prev_commit_ts(const int64_t val) {
+  this->prev_commit_ts = val;
+}
 std::ostream& operator<<(std::ostream& out, const SyncLogRequest& obj)
 {
   obj.printTo(out);
@@ -1195,6 +1199,14 @@ uint32_t SyncLogRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->prev_commit_ts);
+          this->__isset.prev_commit_ts = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1228,6 +1240,10 @@ uint32_t SyncLogRequest::write(::apache::thrift::protocol::TProtocol* oprot) con
   }
   xfer += oprot->writeFieldEnd();
 
+  xfer += oprot->writeFieldBegin("prev_commit_ts", ::apache::thrift::protocol::T_I64, 3);
+  xfer += oprot->writeI64(this->prev_commit_ts);
+  xfer += oprot->writeFieldEnd();
+
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -1237,17 +1253,20 @@ void swap(SyncLogRequest &a, SyncLogRequest &b) {
   using ::std::swap;
   swap(a.node_name, b.node_name);
   swap(a.log_entries, b.log_entries);
+  swap(a.prev_commit_ts, b.prev_commit_ts);
   swap(a.__isset, b.__isset);
 }
 
 SyncLogRequest::SyncLogRequest(const SyncLogRequest& other29) {
   node_name = other29.node_name;
   log_entries = other29.log_entries;
+  prev_commit_ts = other29.prev_commit_ts;
   __isset = other29.__isset;
 }
 SyncLogRequest& SyncLogRequest::operator=(const SyncLogRequest& other30) {
   node_name = other30.node_name;
   log_entries = other30.log_entries;
+  prev_commit_ts = other30.prev_commit_ts;
   __isset = other30.__isset;
   return *this;
 }
@@ -1256,6 +1275,7 @@ void SyncLogRequest::printTo(std::ostream& out) const {
   out << "SyncLogRequest(";
   out << "node_name=" << to_string(node_name);
   out << ", " << "log_entries=" << to_string(log_entries);
+  out << ", " << "prev_commit_ts=" << to_string(prev_commit_ts);
   out << ")";
 }
 
@@ -522,9 +522,10 @@ void swap(HeartBeatResponse &a, HeartBeatResponse &b);
 std::ostream& operator<<(std::ostream& out, const HeartBeatResponse& obj);
 
 typedef struct _SyncLogRequest__isset {
-  _SyncLogRequest__isset() : node_name(false), log_entries(false) {}
+  _SyncLogRequest__isset() : node_name(false), log_entries(false), prev_commit_ts(false) {}
   bool node_name :1;
   bool log_entries :1;
+  bool prev_commit_ts :1;
 } _SyncLogRequest__isset;
 
 class SyncLogRequest : public virtual ::apache::thrift::TBase {
@@ -533,12 +534,14 @@ class SyncLogRequest : public virtual ::apache::thrift::TBase {
   SyncLogRequest(const SyncLogRequest&);
   SyncLogRequest& operator=(const SyncLogRequest&);
   SyncLogRequest() noexcept
-                 : node_name() {
+                 : node_name(),
+                   prev_commit_ts(0) {
   }
 
   virtual ~SyncLogRequest() noexcept;
   std::string node_name;
   std::vector<std::string>  log_entries;
+  int64_t prev_commit_ts;
 
   _SyncLogRequest__isset __isset;
 
@@ -546,12 +549,16 @@ class SyncLogRequest : public virtual ::apache::thrift::TBase {
 
   void __set_log_entries(const std::vector<std::string> & val);
 
+  void __set_prev_commit_ts(const int64_t val);
+
   bool operator == (const SyncLogRequest & rhs) const
   {
     if (!(node_name == rhs.node_name))
       return false;
     if (!(log_entries == rhs.log_entries))
       return false;
+    if (!(prev_commit_ts == rhs.prev_commit_ts))
+      return false;
     return true;
   }
   bool operator != (const SyncLogRequest &rhs) const {
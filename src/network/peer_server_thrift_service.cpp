@@ -62,7 +62,12 @@ void PeerServerThriftService::Register(infinity_peer_server::RegisterResponse &r
         auto now = std::chrono::system_clock::now();
         auto time_since_epoch = now.time_since_epoch();
         non_leader_node_info->last_update_ts_ = std::chrono::duration_cast<std::chrono::seconds>(time_since_epoch).count();
-        InfinityContext::instance().cluster_manager()->AddNodeInfo(non_leader_node_info);
+        Status status = InfinityContext::instance().cluster_manager()->AddNodeInfo(non_leader_node_info);
+        if (!status.ok()) {
+            response.error_code = static_cast<i64>(status.code_);
+            response.error_message = status.message();
+            return;
+        }
 
         response.leader_name = leader_node->node_name_;
         response.leader_term = leader_node->leader_term_;
@@ -98,6 +103,10 @@ void PeerServerThriftService::HeartBeat(infinity_peer_server::HeartBeatResponse
                                                                                                  request.txn_timestamp,
                                                                                                  response.other_nodes,
                                                                                                  response.leader_term);
+        if (!status.ok()) {
+            response.error_code = static_cast<i64>(status.code_);
+            response.error_message = status.message();
+        }
     } else {
         response.error_code = static_cast<i64>(ErrorCode::kInvalidNodeRole);
         response.error_message = fmt::format("Attempt to unregister from a non-leader node: {}", ToString(leader_node->node_role_));
@@ -105,7 +114,12 @@ void PeerServerThriftService::HeartBeat(infinity_peer_server::HeartBeatResponse
     return;
 }
 void PeerServerThriftService::SyncLog(infinity_peer_server::SyncLogResponse &response, const infinity_peer_server::SyncLogRequest &request) {
-    LOG_INFO("Get SyncLog request");
+    LOG_TRACE(fmt::format("Get SyncLog request from {}, {} entries", request.node_name, request.log_entries.size()));
+    Status status = InfinityContext::instance().cluster_manager()->ApplySyncedLogs(request.log_entries, request.prev_commit_ts, response.txn_timestamp);
+    if (!status.ok()) {
+        response.error_code = static_cast<i64>(status.code_);
+        response.error_message = status.message();
+    }
     return;
 }
 void PeerServerThriftService::ChangeRole(infinity_peer_server::ChangeRoleResponse &response, const infinity_peer_server::ChangeRoleRequest &request) {
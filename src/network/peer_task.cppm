@@ -70,11 +70,15 @@ public:
         if (async_) {
             return;
         }
-        complete_ = false;
         std::unique_lock<std::mutex> locker(mutex_);
         cv_.wait(locker, [this] { return complete_; });
     }
 
+    bool IsComplete() const {
+        std::unique_lock<std::mutex> locker(mutex_);
+        return complete_;
+    }
+
     void Complete() {
         if (async_) {
             return;
@@ -157,4 +161,22 @@ public:
     Vector<SharedPtr<NodeInfo>> other_nodes_{};
 };
 
+export class SyncLogTask final : public PeerTask {
+public:
+    SyncLogTask(String node_name, SharedPtr<Vector<String>> log_strings, i64 prev_commit_ts)
+        : PeerTask(PeerTaskType::kLogSync), node_name_(std::move(node_name)), log_strings_(std::move(log_strings)),
+          prev_commit_ts_(prev_commit_ts) {}
+
+    String ToString() const final;
+
+    String node_name_{};
+    SharedPtr<Vector<String>> log_strings_{}; // serialized wal entries, shared by the tasks sent to all followers
+    i64 prev_commit_ts_{}; // commit ts of the last entry shipped before these ones, the follower must have applied it
+
+    // response
+    i64 error_code_{};
+    String error_message_{};
+    i64 txn_ts_{}; // commit ts of the last entry applied by the follower
+};
+
 } // namespace infinity
@@ -28,7 +28,7 @@ import peer_task;
 namespace infinity {
 
 PeerClient::~PeerClient() {
-    if(running_) {
+    if (processor_thread_.get() != nullptr) {
         UnInit();
     }
 }
@@ -40,11 +40,15 @@ Status PeerClient::Init() {
         socket_ = MakeShared<TSocket>(node_info_.ip_address_, node_info_.port_);
 
         TSocket* socket = static_cast<TSocket*>(socket_.get());
-        socket->setConnTimeout(2000); // 2s to timeout
+        socket->setConnTimeout(kConnTimeoutMs);
+        // A peer that stops answering fails the request instead of holding the processor
+        socket->setSendTimeout(kSendTimeoutMs);
+        socket->setRecvTimeout(kRecvTimeoutMs);
         transport_ = MakeShared<TBufferedTransport>(socket_);
         protocol_ = MakeShared<TBinaryProtocol>(transport_);
         client_ = MakeUnique<PeerServiceClient>(protocol_);
         transport_->open();
+        running_ = true;
         processor_thread_ = MakeShared<Thread>([this] { this->Process(); });
     } catch (const std::exception& e) {
         status = Status::CantConnectServer(node_info_.ip_address_, node_info_.port_, e.what());
@@ -57,23 +61,49 @@ Status PeerClient::Init() {
 Status PeerClient::UnInit() {
     LOG_INFO(fmt::format("Peer client: {} is stopping.", this_node_name_));
     if(processor_thread_.get() != nullptr) {
-        SharedPtr<TerminatePeerTask> terminate_task = MakeShared<TerminatePeerTask>();
-        peer_task_queue_.Enqueue(terminate_task);
-        terminate_task->Wait();
+        if (!stopping_) {
+            SharedPtr<TerminatePeerTask> terminate_task = MakeShared<TerminatePeerTask>();
+            peer_task_queue_.Enqueue(terminate_task);
+            terminate_task->Wait();
+        }
         processor_thread_->join();
+        processor_thread_.reset();
     }
     LOG_INFO(fmt::format("Peer client: {} is stopped.", this_node_name_));
     return Status::OK();
 }
 
+void PeerClient::Stop() {
+    if (processor_thread_.get() == nullptr || stopping_.exchange(true)) {
+        return;
+    }
+    peer_task_queue_.Enqueue(MakeShared<TerminatePeerTask>());
+}
+
 void PeerClient::Send(SharedPtr<PeerTask> peer_task) {
     ++peer_task_count_;
     peer_task_queue_.Enqueue(std::move(peer_task));
 }
 
+template <typename Rpc>
+Status PeerClient::CallRpc(Rpc &&rpc) {
+    try {
+        if (broken_) {
+            // A failed request may leave its response on the connection
+            transport_->close();
+            transport_->open();
+            broken_ = false;
+        }
+        rpc();
+    } catch (const std::exception &e) {
+        broken_ = true;
+        return Status::CantConnectServer(node_info_.ip_address_, node_info_.port_, e.what());
+    }
+    return Status::OK();
+}
+
 void PeerClient::Process() {
     Deque<SharedPtr<PeerTask>> peer_tasks;
-    running_ = true;
     while (running_) {
         peer_task_queue_.DequeueBulk(peer_tasks);
         for (const auto &peer_task : peer_tasks) {
@@ -101,6 +131,12 @@ void PeerClient::Process() {
                     HeartBeat(heartbeat_peer_task);
                     break;
                 }
+                case PeerTaskType::kLogSync: {
+                    LOG_TRACE(peer_task->ToString());
+                    SyncLogTask* sync_log_task = static_cast<SyncLogTask*>(peer_task.get());
+                    SyncLogs(sync_log_task);
+                    break;
+                }
                 default: {
                     String error_message = fmt::format("Invalid peer task type");
                     UnrecoverableError(error_message);
@@ -137,7 +173,12 @@ void PeerClient::Register(RegisterPeerTask* peer_task) {
     request.txn_timestamp = peer_task->txn_ts_;
 
     RegisterResponse response;
-    client_->Register(response, request);
+    Status status = CallRpc([&] { client_->Register(response, request); });
+    if (!status.ok()) {
+        peer_task->error_code_ = static_cast<i64>(status.code());
+        peer_task->error_message_ = status.message();
+        return;
+    }
     if(response.error_code != 0) {
         // Error
         peer_task->error_code_ = response.error_code;
@@ -154,7 +195,12 @@ void PeerClient::Unregister(UnregisterPeerTask* peer_task) {
     UnregisterResponse response;
     request.node_name = peer_task->node_name_;
 
-    client_->Unregister(response, request);
+    Status status = CallRpc([&] { client_->Unregister(response, request); });
+    if (!status.ok()) {
+        peer_task->error_code_ = static_cast<i64>(status.code());
+        peer_task->error_message_ = status.message();
+        return;
+    }
     if(response.error_code != 0) {
         // Error
         peer_task->error_code_ = response.error_code;
@@ -168,7 +214,12 @@ void PeerClient::HeartBeat(HeartBeatPeerTask* peer_task) {
     request.node_name = peer_task->node_name_;
     request.txn_timestamp = peer_task->txn_ts_;
 
-    client_->HeartBeat(response, request);
+    Status status = CallRpc([&] { client_->HeartBeat(response, request); });
+    if (!status.ok()) {
+        peer_task->error_code_ = static_cast<i64>(status.code());
+        peer_task->error_message_ = status.message();
+        return;
+    }
     if(response.error_code != 0) {
         // Error
         peer_task->error_code_ = response.error_code;
@@ -227,4 +278,32 @@ void PeerClient::HeartBeat(HeartBeatPeerTask* peer_task) {
     }
 }
 
+void PeerClient::SyncLogs(SyncLogTask* peer_task) {
+    if (stopping_) {
+        peer_task->error_code_ = static_cast<i64>(ErrorCode::kCantConnectServer);
+        peer_task->error_message_ = fmt::format("Peer client: {} is stopped", this_node_name_);
+        return;
+    }
+    SyncLogRequest request;
+    SyncLogResponse response;
+    request.node_name = peer_task->node_name_;
+    request.log_entries = *peer_task->log_strings_;
+    request.prev_commit_ts = peer_task->prev_commit_ts_;
+
+    Status status = CallRpc([&] { client_->SyncLog(response, request); });
+    if (!status.ok()) {
+        // The follower is gone or too slow, let the leader decide what to do with it
+        peer_task->error_code_ = static_cast<i64>(status.code());
+        peer_task->error_message_ = status.message();
+        return;
+    }
+    if(response.error_code != 0) {
+        // Error
+        peer_task->error_code_ = response.error_code;
+        peer_task->error_message_ = response.error_message;
+    } else {
+        peer_task->txn_ts_ = response.txn_timestamp;
+    }
+}
+
 } // namespace infinity
@@ -51,15 +51,30 @@ public:
 
     Status Init();
     Status UnInit();
+    // Stop without waiting for the pending tasks, which fail without being sent. UnInit() joins the processor.
+    void Stop();
+    // Whether the processor has exited after a Stop()
+    bool Stopped() const { return stopping_ && !running_; }
     void Send(SharedPtr<PeerTask> task);
+    u64 PendingTaskCount() const { return peer_task_count_; }
 
 private:
+    // Run the request of `rpc` and return an error if the connection failed or timed out.
+    template <typename Rpc>
+    Status CallRpc(Rpc &&rpc);
+
     void Process();
     void Register(RegisterPeerTask* peer_task);
     void Unregister(UnregisterPeerTask* peer_task);
     void HeartBeat(HeartBeatPeerTask* peer_task);
+    void SyncLogs(SyncLogTask* peer_task);
 
 private:
+    static constexpr i32 kConnTimeoutMs = 2000;
+    static constexpr i32 kSendTimeoutMs = 5000;
+    // A follower replays the synced logs before it responds
+    static constexpr i32 kRecvTimeoutMs = 10000;
+
     String this_node_name_;
     NodeInfo node_info_;
 
@@ -69,6 +84,8 @@ private:
     SharedPtr<TProtocol> protocol_{};
     UniquePtr<PeerServiceClient> client_{};
     Atomic<bool> running_{false};
+    Atomic<bool> stopping_{false};
+    bool broken_{false}; // The last request failed, so the connection is reopened before the next one
     BlockingQueue<SharedPtr<PeerTask>> peer_task_queue_{};
 
     SharedPtr<Thread> processor_thread_{};
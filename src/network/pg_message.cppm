@@ -40,6 +40,12 @@ enum class PGMessageType : unsigned char {
     kRowDescription = 'T',
     kData = 'D',
     kComplete = 'C',
+    kParseComplete = '1',
+    kBindComplete = '2',
+    kCloseComplete = '3',
+    kNoData = 'n',
+    kParameterDescription = 't',
+    kPortalSuspended = 's',
 
     // Errors
     kHumanReadableError = 'M',
@@ -60,6 +66,38 @@ enum class PGMessageType : unsigned char {
     kCloseCommand = 'C',
 };
 
+// Format code of parameter and result values
+enum class PGFormatCode : i16 {
+    kText = 0,
+    kBinary = 1,
+};
+
+// Extended query protocol messages
+struct PGParseMessage {
+    String statement_name_{};
+    String query_{};
+    Vector<u32> parameter_types_{};
+};
+
+struct PGBindMessage {
+    String portal_name_{};
+    String statement_name_{};
+    Vector<PGFormatCode> parameter_formats_{};
+    Vector<Optional<String>> parameters_{};
+    Vector<PGFormatCode> result_formats_{};
+};
+
+// Describe and Close: target is 'S' for a prepared statement or 'P' for a portal
+struct PGTargetMessage {
+    char target_type_{};
+    String name_{};
+};
+
+struct PGExecuteMessage {
+    String portal_name_{};
+    u32 max_rows_{}; // 0 means no limit
+};
+
 enum class TransactionStateType : unsigned char {
     kIDLE = 'I',  // Not in a transaction block
     kBlock = 'T', // In a transaction block
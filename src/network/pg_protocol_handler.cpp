@@ -77,6 +77,66 @@ String PGProtocolHandler::read_command_body() {
     return buffer_reader_.read_string(command_length);
 }
 
+void PGProtocolHandler::skip_command_body() {
+    const auto command_length = buffer_reader_.read_value_u32() - LENGTH_FIELD_SIZE;
+    buffer_reader_.read_string(command_length, NullTerminator::kNo);
+}
+
+PGParseMessage PGProtocolHandler::read_parse_message() {
+    buffer_reader_.read_value_u32(); // Message length
+    PGParseMessage parse_message;
+    parse_message.statement_name_ = buffer_reader_.read_string();
+    parse_message.query_ = buffer_reader_.read_string();
+    u16 parameter_type_count = buffer_reader_.read_value_u16();
+    parse_message.parameter_types_.reserve(parameter_type_count);
+    for (u16 i = 0; i < parameter_type_count; ++i) {
+        parse_message.parameter_types_.push_back(buffer_reader_.read_value_u32());
+    }
+    return parse_message;
+}
+
+PGBindMessage PGProtocolHandler::read_bind_message() {
+    buffer_reader_.read_value_u32(); // Message length
+    PGBindMessage bind_message;
+    bind_message.portal_name_ = buffer_reader_.read_string();
+    bind_message.statement_name_ = buffer_reader_.read_string();
+    u16 parameter_format_count = buffer_reader_.read_value_u16();
+    for (u16 i = 0; i < parameter_format_count; ++i) {
+        bind_message.parameter_formats_.push_back(static_cast<PGFormatCode>(buffer_reader_.read_value_i16()));
+    }
+    u16 parameter_count = buffer_reader_.read_value_u16();
+    for (u16 i = 0; i < parameter_count; ++i) {
+        i32 value_length = buffer_reader_.read_value_i32();
+        if (value_length < 0) {
+            // Null value
+            bind_message.parameters_.emplace_back(None);
+        } else {
+            bind_message.parameters_.emplace_back(buffer_reader_.read_string(value_length, NullTerminator::kNo));
+        }
+    }
+    u16 result_format_count = buffer_reader_.read_value_u16();
+    for (u16 i = 0; i < result_format_count; ++i) {
+        bind_message.result_formats_.push_back(static_cast<PGFormatCode>(buffer_reader_.read_value_i16()));
+    }
+    return bind_message;
+}
+
+PGTargetMessage PGProtocolHandler::read_target_message() {
+    buffer_reader_.read_value_u32(); // Message length
+    PGTargetMessage target_message;
+    target_message.target_type_ = buffer_reader_.read_value_i8();
+    target_message.name_ = buffer_reader_.read_string();
+    return target_message;
+}
+
+PGExecuteMessage PGProtocolHandler::read_execute_message() {
+    buffer_reader_.read_value_u32(); // Message length
+    PGExecuteMessage execute_message;
+    execute_message.portal_name_ = buffer_reader_.read_string();
+    execute_message.max_rows_ = buffer_reader_.read_value_u32();
+    return execute_message;
+}
+
 void PGProtocolHandler::send_error_response(const HashMap<PGMessageType, String> &error_response_map) {
     // message header
     buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kError));
@@ -112,7 +172,7 @@ void PGProtocolHandler::SendDescriptionHeader(u32 total_column_name_length, u32
     buffer_writer_.send_value_u16(column_count);
 }
 
-void PGProtocolHandler::SendDescription(const String &column_name, u32 object_id, u16 width) {
+void PGProtocolHandler::SendDescription(const String &column_name, u32 object_id, u16 width, PGFormatCode format) {
     buffer_writer_.send_string(column_name);
 
     buffer_writer_.send_value_u32(0); // No OID for the table;
@@ -121,7 +181,7 @@ void PGProtocolHandler::SendDescription(const String &column_name, u32 object_id
     buffer_writer_.send_value_u32(object_id); // OID of the type
     buffer_writer_.send_value_u16(width);     // Type width
     buffer_writer_.send_value_i32(-1);        // No modifier
-    buffer_writer_.send_value_i16(0);         // Text format
+    buffer_writer_.send_value_i16(static_cast<i16>(format));
 }
 
 void PGProtocolHandler::SendData(const Vector<Optional<String>> &values_as_strings, u64 string_length_sum) {
@@ -163,4 +223,18 @@ void PGProtocolHandler::SendComplete(const String &complete_message) {
     buffer_writer_.send_string(complete_message);
 }
 
+void PGProtocolHandler::SendEmptyMessage(PGMessageType message_type) {
+    buffer_writer_.send_value_u8(static_cast<u8>(message_type));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE);
+}
+
+void PGProtocolHandler::SendParameterDescription(const Vector<u32> &parameter_types) {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kParameterDescription));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE + sizeof(u16) + parameter_types.size() * sizeof(u32));
+    buffer_writer_.send_value_u16(parameter_types.size());
+    for (u32 parameter_type : parameter_types) {
+        buffer_writer_.send_value_u32(parameter_type);
+    }
+}
+
 } // namespace infinity
@@ -41,17 +41,38 @@ public:
 
     String read_command_body();
 
+    // Discard the body of a command, used to skip extended query messages after an error until Sync.
+    void skip_command_body();
+
+    // Whether the next command is already received, so that it can be handled without waiting for the socket.
+    [[nodiscard]] bool has_buffered_command() const { return buffer_reader_.size() > 0; }
+
+    PGParseMessage read_parse_message();
+
+    PGBindMessage read_bind_message();
+
+    PGTargetMessage read_target_message();
+
+    PGExecuteMessage read_execute_message();
+
     void send_error_response(const HashMap<PGMessageType, String> &error_response_map);
     //
     //    String read_query_packet();
 
     void SendDescriptionHeader(u32 total_column_name_length, u32 column_count);
 
-    void SendDescription(const String &column_name, u32 object_id, u16 width);
+    void SendDescription(const String &column_name, u32 object_id, u16 width, PGFormatCode format = PGFormatCode::kText);
 
     void SendData(const Vector<Optional<String>> &values_as_strings, u64 string_length_sum);
 
     void SendComplete(const String &complete_message);
+
+    // Replies of the extended query protocol without payload: ParseComplete, BindComplete, CloseComplete, NoData and PortalSuspended
+    void SendEmptyMessage(PGMessageType message_type);
+
+    void SendParameterDescription(const Vector<u32> &parameter_types);
+
+    void Flush() { buffer_writer_.flush(); }
     //
     //    pair<String, String> read_parse_packet();
     //    void read_sync_packet();
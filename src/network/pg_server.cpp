@@ -14,6 +14,7 @@
 
 module;
 
+#include <boost/asio/ip/tcp.hpp>
 #include <boost/bind.hpp>
 #include <thread>
 
@@ -49,6 +50,8 @@ void PGServer::Run() {
         return ;
     }
 
+    // Requests of all connections are handled by a bounded worker pool
+    worker_pool_ = MakeUnique<ThreadPool>(InfinityContext::instance().config()->ConnectionPoolSize());
     acceptor_ptr_ = MakeUnique<boost::asio::ip::tcp::acceptor>(io_service_, boost::asio::ip::tcp::endpoint(address, pg_port));
     CreateConnection();
 
@@ -68,6 +71,9 @@ void PGServer::Shutdown() {
 
     io_service_.stop();
     acceptor_ptr_->close();
+    if (worker_pool_.get() != nullptr) {
+        worker_pool_->stop(true);
+    }
 }
 
 void PGServer::CreateConnection() {
@@ -76,27 +82,45 @@ void PGServer::CreateConnection() {
 }
 
 void PGServer::StartConnection(SharedPtr<Connection> &connection) {
-    Thread connection_thread([connection = connection, &num_running_connections = this->running_connection_count_, initialized = bool(this->initialized_)]() mutable {
-        if(initialized) {
-            ++num_running_connections;
-            try {
-                connection->Run();
-            } catch (...) {
-                String ip_address;
-                u16 port;
-                connection->GetClientInfo(ip_address, port);
-                String msg = fmt::format("closed connection with {}:{} due to exception", ip_address, port);
-                LOG_ERROR(msg);
-            }
+    if (initialized_) {
+        // The client starts with the startup message
+        WaitRequest(connection);
+    }
+    CreateConnection();
+}
 
+void PGServer::WaitRequest(SharedPtr<Connection> connection) {
+    connection->socket()->async_wait(boost::asio::ip::tcp::socket::wait_read, [this, connection](const boost::system::error_code &error) {
+        if (error || !initialized_) {
+            // The connection is released along with this handler
+            return;
+        }
+        HandleRequest(connection);
+    });
+}
+
+void PGServer::HandleRequest(SharedPtr<Connection> connection) {
+    ++running_connection_count_;
+    worker_pool_->push([this, connection = std::move(connection)](int) mutable {
+        bool keep_alive = false;
+        try {
+            keep_alive = connection->HandleReceivedRequests();
+        } catch (...) {
+            String ip_address;
+            u16 port;
+            connection->GetClientInfo(ip_address, port);
+            String msg = fmt::format("closed connection with {}:{} due to exception", ip_address, port);
+            LOG_ERROR(msg);
+        }
+
+        if (keep_alive && initialized_) {
+            WaitRequest(std::move(connection));
+        } else {
             // User disconnected
             connection.reset();
-            --num_running_connections;
         }
+        --running_connection_count_;
     });
-
-    connection_thread.detach();
-    CreateConnection();
 }
 
 } // namespace infinity
@@ -34,8 +34,15 @@ private:
 
     void StartConnection(SharedPtr<Connection> &connection);
 
+    // Wait asynchronously until the connection has a new request, an idle connection doesn't hold any thread.
+    void WaitRequest(SharedPtr<Connection> connection);
+
+    void HandleRequest(SharedPtr<Connection> connection);
+
     atomic_bool initialized_{false};
+    // Count of connections whose requests are being handled
     atomic_u64 running_connection_count_{0};
+    UniquePtr<ThreadPool> worker_pool_{};
     boost::asio::io_service io_service_{};
     UniquePtr<boost::asio::ip::tcp::acceptor> acceptor_ptr_{};
 };
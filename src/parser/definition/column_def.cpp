@@ -79,7 +79,8 @@ ColumnDef::ColumnDef(LogicalType logical_type, const std::shared_ptr<TypeInfo> &
 bool ColumnDef::operator==(const ColumnDef &other) const {
     bool res = type_ == other.type_ && id_ == other.id_ && name_ == other.name_ && column_type_ != nullptr && other.column_type_ != nullptr &&
                *column_type_ == *other.column_type_ && constraints_.size() == other.constraints_.size() &&
-               build_bloom_filter_ == other.build_bloom_filter_;
+               build_bloom_filter_ == other.build_bloom_filter_ && clustering_key_idx_ == other.clustering_key_idx_ &&
+               clustering_z_order_ == other.clustering_z_order_;
     if (!res) {
         return false;
     }
@@ -91,6 +92,15 @@ bool ColumnDef::operator==(const ColumnDef &other) const {
     return true;
 }
 
+namespace {
+
+// Flag byte written after the default expression. Records before the clustering key only wrote 0 or 1 for the bloom filter, so
+// the clustering key fields follow only if kClusteringKeyFlag is set and those records are read as before.
+constexpr uint8_t kBloomFilterFlag = 1;
+constexpr uint8_t kClusteringKeyFlag = 1 << 1;
+
+} // namespace
+
 int32_t ColumnDef::GetSizeInBytes() const {
     int32_t size = 0;
     size += sizeof(int64_t); // id_
@@ -98,7 +108,11 @@ int32_t ColumnDef::GetSizeInBytes() const {
     size += sizeof(int32_t) + name_.size();
     size += sizeof(int32_t) + constraints_.size() * sizeof(ConstraintType);
     size += (dynamic_cast<ConstantExpr *>(default_expr_.get()))->GetSizeInBytes();
-    size += sizeof(uint8_t); // build_bloom_filter_
+    size += sizeof(uint8_t); // flags
+    if (has_clustering_key()) {
+        size += sizeof(int32_t); // clustering_key_idx_
+        size += sizeof(uint8_t); // clustering_z_order_
+    }
     return size;
 }
 
@@ -111,8 +125,16 @@ void ColumnDef::WriteAdv(char *&ptr) const {
         WriteBufAdv(ptr, cons);
     }
     (dynamic_cast<ConstantExpr *>(default_expr_.get()))->WriteAdv(ptr);
-    uint8_t bf = build_bloom_filter_ ? 1 : 0;
-    WriteBufAdv(ptr, bf);
+    uint8_t flags = build_bloom_filter_ ? kBloomFilterFlag : 0;
+    if (has_clustering_key()) {
+        flags |= kClusteringKeyFlag;
+    }
+    WriteBufAdv(ptr, flags);
+    if (has_clustering_key()) {
+        WriteBufAdv(ptr, clustering_key_idx_);
+        uint8_t z_order = clustering_z_order_ ? 1 : 0;
+        WriteBufAdv(ptr, z_order);
+    }
 }
 
 std::shared_ptr<ColumnDef> ColumnDef::ReadAdv(const char *&ptr, int32_t maxbytes) {
@@ -126,8 +148,13 @@ std::shared_ptr<ColumnDef> ColumnDef::ReadAdv(const char *&ptr, int32_t maxbytes
     }
     std::shared_ptr<ParsedExpr> default_expr = ConstantExpr::ReadAdv(ptr, maxbytes);
     auto column_def = std::make_shared<ColumnDef>(id, column_type, name, constraints, default_expr);
-    uint8_t bf = ReadBufAdv<uint8_t>(ptr);
-    column_def->build_bloom_filter_ = bf == 1;
+    uint8_t flags = ReadBufAdv<uint8_t>(ptr);
+    column_def->build_bloom_filter_ = (flags & kBloomFilterFlag) != 0;
+    if ((flags & kClusteringKeyFlag) != 0) {
+        column_def->clustering_key_idx_ = ReadBufAdv<int32_t>(ptr);
+        uint8_t z_order = ReadBufAdv<uint8_t>(ptr);
+        column_def->clustering_z_order_ = z_order == 1;
+    }
     return column_def;
 }
 
@@ -112,6 +112,8 @@ public:
         return std::dynamic_pointer_cast<ConstantExpr>(default_expr_);
     }
 
+    inline bool has_clustering_key() const { return clustering_key_idx_ >= 0; }
+
 public:
     int64_t id_{-1};
     const std::shared_ptr<DataType> column_type_{};
@@ -119,5 +121,9 @@ public:
     std::set<ConstraintType> constraints_{};
     std::shared_ptr<ParsedExpr> default_expr_{nullptr};
     bool build_bloom_filter_{};
+    // Position of the column in the clustering key of the table, -1 if the column is not part of it
+    int32_t clustering_key_idx_{-1};
+    // The clustering key is a Z-order over its columns instead of a sort order
+    bool clustering_z_order_{};
 };
 } // namespace infinity
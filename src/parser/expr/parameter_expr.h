@@ -0,0 +1,36 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "parsed_expr.h"
+#include <cstdint>
+#include <string>
+
+namespace infinity {
+
+// Placeholder '?' of a prepared statement, bound to the argument at position index_ of EXECUTE.
+class ParameterExpr : public ParsedExpr {
+public:
+    explicit ParameterExpr(size_t index) : ParsedExpr(ParsedExprType::kParameter), index_(index) {}
+
+    ~ParameterExpr() override;
+
+    [[nodiscard]] std::string ToString() const override;
+
+public:
+    size_t index_{0};
+};
+
+} // namespace infinity
@@ -331,122 +331,125 @@ enum yysymbol_kind_t
   YYSYMBOL_217_ = 217,                     /* '.'  */
   YYSYMBOL_218_ = 218,                     /* ';'  */
   YYSYMBOL_219_ = 219,                     /* ','  */
-  YYSYMBOL_220_ = 220,                     /* ':'  */
-  YYSYMBOL_YYACCEPT = 221,                 /* $accept  */
-  YYSYMBOL_input_pattern = 222,            /* input_pattern  */
-  YYSYMBOL_statement_list = 223,           /* statement_list  */
-  YYSYMBOL_statement = 224,                /* statement  */
-  YYSYMBOL_explainable_statement = 225,    /* explainable_statement  */
-  YYSYMBOL_create_statement = 226,         /* create_statement  */
-  YYSYMBOL_table_element_array = 227,      /* table_element_array  */
-  YYSYMBOL_table_element = 228,            /* table_element  */
-  YYSYMBOL_table_column = 229,             /* table_column  */
-  YYSYMBOL_column_type = 230,              /* column_type  */
-  YYSYMBOL_column_constraints = 231,       /* column_constraints  */
-  YYSYMBOL_column_constraint = 232,        /* column_constraint  */
-  YYSYMBOL_default_expr = 233,             /* default_expr  */
-  YYSYMBOL_table_constraint = 234,         /* table_constraint  */
-  YYSYMBOL_identifier_array = 235,         /* identifier_array  */
-  YYSYMBOL_delete_statement = 236,         /* delete_statement  */
-  YYSYMBOL_insert_statement = 237,         /* insert_statement  */
-  YYSYMBOL_optional_identifier_array = 238, /* optional_identifier_array  */
-  YYSYMBOL_explain_statement = 239,        /* explain_statement  */
-  YYSYMBOL_explain_type = 240,             /* explain_type  */
-  YYSYMBOL_update_statement = 241,         /* update_statement  */
-  YYSYMBOL_update_expr_array = 242,        /* update_expr_array  */
-  YYSYMBOL_update_expr = 243,              /* update_expr  */
-  YYSYMBOL_drop_statement = 244,           /* drop_statement  */
-  YYSYMBOL_copy_statement = 245,           /* copy_statement  */
-  YYSYMBOL_select_statement = 246,         /* select_statement  */
-  YYSYMBOL_select_with_paren = 247,        /* select_with_paren  */
-  YYSYMBOL_select_without_paren = 248,     /* select_without_paren  */
-  YYSYMBOL_select_clause_with_modifier = 249, /* select_clause_with_modifier  */
-  YYSYMBOL_select_clause_without_modifier_paren = 250, /* select_clause_without_modifier_paren  */
-  YYSYMBOL_select_clause_without_modifier = 251, /* select_clause_without_modifier  */
-  YYSYMBOL_order_by_clause = 252,          /* order_by_clause  */
-  YYSYMBOL_order_by_expr_list = 253,       /* order_by_expr_list  */
-  YYSYMBOL_order_by_expr = 254,            /* order_by_expr  */
-  YYSYMBOL_order_by_type = 255,            /* order_by_type  */
-  YYSYMBOL_limit_expr = 256,               /* limit_expr  */
-  YYSYMBOL_offset_expr = 257,              /* offset_expr  */
-  YYSYMBOL_distinct = 258,                 /* distinct  */
-  YYSYMBOL_from_clause = 259,              /* from_clause  */
-  YYSYMBOL_search_clause = 260,            /* search_clause  */
-  YYSYMBOL_optional_search_filter_expr = 261, /* optional_search_filter_expr  */
-  YYSYMBOL_where_clause = 262,             /* where_clause  */
-  YYSYMBOL_having_clause = 263,            /* having_clause  */
-  YYSYMBOL_group_by_clause = 264,          /* group_by_clause  */
-  YYSYMBOL_set_operator = 265,             /* set_operator  */
-  YYSYMBOL_table_reference = 266,          /* table_reference  */
-  YYSYMBOL_table_reference_unit = 267,     /* table_reference_unit  */
-  YYSYMBOL_table_reference_name = 268,     /* table_reference_name  */
-  YYSYMBOL_table_name = 269,               /* table_name  */
-  YYSYMBOL_table_alias = 270,              /* table_alias  */
-  YYSYMBOL_with_clause = 271,              /* with_clause  */
-  YYSYMBOL_with_expr_list = 272,           /* with_expr_list  */
-  YYSYMBOL_with_expr = 273,                /* with_expr  */
-  YYSYMBOL_join_clause = 274,              /* join_clause  */
-  YYSYMBOL_join_type = 275,                /* join_type  */
-  YYSYMBOL_show_statement = 276,           /* show_statement  */
-  YYSYMBOL_flush_statement = 277,          /* flush_statement  */
-  YYSYMBOL_optimize_statement = 278,       /* optimize_statement  */
-  YYSYMBOL_command_statement = 279,        /* command_statement  */
-  YYSYMBOL_compact_statement = 280,        /* compact_statement  */
-  YYSYMBOL_admin_statement = 281,          /* admin_statement  */
-  YYSYMBOL_alter_statement = 282,          /* alter_statement  */
-  YYSYMBOL_expr_array = 283,               /* expr_array  */
-  YYSYMBOL_expr_array_list = 284,          /* expr_array_list  */
-  YYSYMBOL_expr_alias = 285,               /* expr_alias  */
-  YYSYMBOL_expr = 286,                     /* expr  */
-  YYSYMBOL_operand = 287,                  /* operand  */
-  YYSYMBOL_match_tensor_expr = 288,        /* match_tensor_expr  */
-  YYSYMBOL_match_vector_expr = 289,        /* match_vector_expr  */
-  YYSYMBOL_match_sparse_expr = 290,        /* match_sparse_expr  */
-  YYSYMBOL_match_text_expr = 291,          /* match_text_expr  */
-  YYSYMBOL_query_expr = 292,               /* query_expr  */
-  YYSYMBOL_fusion_expr = 293,              /* fusion_expr  */
-  YYSYMBOL_sub_search = 294,               /* sub_search  */
-  YYSYMBOL_sub_search_array = 295,         /* sub_search_array  */
-  YYSYMBOL_function_expr = 296,            /* function_expr  */
-  YYSYMBOL_conjunction_expr = 297,         /* conjunction_expr  */
-  YYSYMBOL_between_expr = 298,             /* between_expr  */
-  YYSYMBOL_in_expr = 299,                  /* in_expr  */
-  YYSYMBOL_case_expr = 300,                /* case_expr  */
-  YYSYMBOL_case_check_array = 301,         /* case_check_array  */
-  YYSYMBOL_cast_expr = 302,                /* cast_expr  */
-  YYSYMBOL_subquery_expr = 303,            /* subquery_expr  */
-  YYSYMBOL_column_expr = 304,              /* column_expr  */
-  YYSYMBOL_constant_expr = 305,            /* constant_expr  */
-  YYSYMBOL_common_array_expr = 306,        /* common_array_expr  */
-  YYSYMBOL_common_sparse_array_expr = 307, /* common_sparse_array_expr  */
-  YYSYMBOL_subarray_array_expr = 308,      /* subarray_array_expr  */
-  YYSYMBOL_unclosed_subarray_array_expr = 309, /* unclosed_subarray_array_expr  */
-  YYSYMBOL_sparse_array_expr = 310,        /* sparse_array_expr  */
-  YYSYMBOL_long_sparse_array_expr = 311,   /* long_sparse_array_expr  */
-  YYSYMBOL_unclosed_long_sparse_array_expr = 312, /* unclosed_long_sparse_array_expr  */
-  YYSYMBOL_double_sparse_array_expr = 313, /* double_sparse_array_expr  */
-  YYSYMBOL_unclosed_double_sparse_array_expr = 314, /* unclosed_double_sparse_array_expr  */
-  YYSYMBOL_empty_array_expr = 315,         /* empty_array_expr  */
-  YYSYMBOL_int_sparse_ele = 316,           /* int_sparse_ele  */
-  YYSYMBOL_float_sparse_ele = 317,         /* float_sparse_ele  */
-  YYSYMBOL_array_expr = 318,               /* array_expr  */
-  YYSYMBOL_long_array_expr = 319,          /* long_array_expr  */
-  YYSYMBOL_unclosed_long_array_expr = 320, /* unclosed_long_array_expr  */
-  YYSYMBOL_double_array_expr = 321,        /* double_array_expr  */
-  YYSYMBOL_unclosed_double_array_expr = 322, /* unclosed_double_array_expr  */
-  YYSYMBOL_interval_expr = 323,            /* interval_expr  */
-  YYSYMBOL_copy_option_list = 324,         /* copy_option_list  */
-  YYSYMBOL_copy_option = 325,              /* copy_option  */
-  YYSYMBOL_file_path = 326,                /* file_path  */
-  YYSYMBOL_if_exists = 327,                /* if_exists  */
-  YYSYMBOL_if_not_exists = 328,            /* if_not_exists  */
-  YYSYMBOL_semicolon = 329,                /* semicolon  */
-  YYSYMBOL_if_not_exists_info = 330,       /* if_not_exists_info  */
-  YYSYMBOL_with_index_param_list = 331,    /* with_index_param_list  */
-  YYSYMBOL_optional_table_properties_list = 332, /* optional_table_properties_list  */
-  YYSYMBOL_index_param_list = 333,         /* index_param_list  */
-  YYSYMBOL_index_param = 334,              /* index_param  */
-  YYSYMBOL_index_info = 335                /* index_info  */
+  YYSYMBOL_220_ = 220,                     /* '?'  */
+  YYSYMBOL_221_ = 221,                     /* ':'  */
+  YYSYMBOL_YYACCEPT = 222,                 /* $accept  */
+  YYSYMBOL_input_pattern = 223,            /* input_pattern  */
+  YYSYMBOL_statement_list = 224,           /* statement_list  */
+  YYSYMBOL_statement = 225,                /* statement  */
+  YYSYMBOL_explainable_statement = 226,    /* explainable_statement  */
+  YYSYMBOL_create_statement = 227,         /* create_statement  */
+  YYSYMBOL_table_element_array = 228,      /* table_element_array  */
+  YYSYMBOL_table_element = 229,            /* table_element  */
+  YYSYMBOL_table_column = 230,             /* table_column  */
+  YYSYMBOL_column_type = 231,              /* column_type  */
+  YYSYMBOL_column_constraints = 232,       /* column_constraints  */
+  YYSYMBOL_column_constraint = 233,        /* column_constraint  */
+  YYSYMBOL_default_expr = 234,             /* default_expr  */
+  YYSYMBOL_table_constraint = 235,         /* table_constraint  */
+  YYSYMBOL_identifier_array = 236,         /* identifier_array  */
+  YYSYMBOL_delete_statement = 237,         /* delete_statement  */
+  YYSYMBOL_insert_statement = 238,         /* insert_statement  */
+  YYSYMBOL_optional_identifier_array = 239, /* optional_identifier_array  */
+  YYSYMBOL_explain_statement = 240,        /* explain_statement  */
+  YYSYMBOL_explain_type = 241,             /* explain_type  */
+  YYSYMBOL_prepare_statement = 242,        /* prepare_statement  */
+  YYSYMBOL_execute_statement = 243,        /* execute_statement  */
+  YYSYMBOL_update_statement = 244,         /* update_statement  */
+  YYSYMBOL_update_expr_array = 245,        /* update_expr_array  */
+  YYSYMBOL_update_expr = 246,              /* update_expr  */
+  YYSYMBOL_drop_statement = 247,           /* drop_statement  */
+  YYSYMBOL_copy_statement = 248,           /* copy_statement  */
+  YYSYMBOL_select_statement = 249,         /* select_statement  */
+  YYSYMBOL_select_with_paren = 250,        /* select_with_paren  */
+  YYSYMBOL_select_without_paren = 251,     /* select_without_paren  */
+  YYSYMBOL_select_clause_with_modifier = 252, /* select_clause_with_modifier  */
+  YYSYMBOL_select_clause_without_modifier_paren = 253, /* select_clause_without_modifier_paren  */
+  YYSYMBOL_select_clause_without_modifier = 254, /* select_clause_without_modifier  */
+  YYSYMBOL_order_by_clause = 255,          /* order_by_clause  */
+  YYSYMBOL_order_by_expr_list = 256,       /* order_by_expr_list  */
+  YYSYMBOL_order_by_expr = 257,            /* order_by_expr  */
+  YYSYMBOL_order_by_type = 258,            /* order_by_type  */
+  YYSYMBOL_limit_expr = 259,               /* limit_expr  */
+  YYSYMBOL_offset_expr = 260,              /* offset_expr  */
+  YYSYMBOL_distinct = 261,                 /* distinct  */
+  YYSYMBOL_from_clause = 262,              /* from_clause  */
+  YYSYMBOL_search_clause = 263,            /* search_clause  */
+  YYSYMBOL_optional_search_filter_expr = 264, /* optional_search_filter_expr  */
+  YYSYMBOL_where_clause = 265,             /* where_clause  */
+  YYSYMBOL_having_clause = 266,            /* having_clause  */
+  YYSYMBOL_group_by_clause = 267,          /* group_by_clause  */
+  YYSYMBOL_set_operator = 268,             /* set_operator  */
+  YYSYMBOL_table_reference = 269,          /* table_reference  */
+  YYSYMBOL_table_reference_unit = 270,     /* table_reference_unit  */
+  YYSYMBOL_table_reference_name = 271,     /* table_reference_name  */
+  YYSYMBOL_table_name = 272,               /* table_name  */
+  YYSYMBOL_table_alias = 273,              /* table_alias  */
+  YYSYMBOL_with_clause = 274,              /* with_clause  */
+  YYSYMBOL_with_expr_list = 275,           /* with_expr_list  */
+  YYSYMBOL_with_expr = 276,                /* with_expr  */
+  YYSYMBOL_join_clause = 277,              /* join_clause  */
+  YYSYMBOL_join_type = 278,                /* join_type  */
+  YYSYMBOL_show_statement = 279,           /* show_statement  */
+  YYSYMBOL_flush_statement = 280,          /* flush_statement  */
+  YYSYMBOL_optimize_statement = 281,       /* optimize_statement  */
+  YYSYMBOL_command_statement = 282,        /* command_statement  */
+  YYSYMBOL_compact_statement = 283,        /* compact_statement  */
+  YYSYMBOL_admin_statement = 284,          /* admin_statement  */
+  YYSYMBOL_alter_statement = 285,          /* alter_statement  */
+  YYSYMBOL_expr_array = 286,               /* expr_array  */
+  YYSYMBOL_expr_array_list = 287,          /* expr_array_list  */
+  YYSYMBOL_expr_alias = 288,               /* expr_alias  */
+  YYSYMBOL_expr = 289,                     /* expr  */
+  YYSYMBOL_operand = 290,                  /* operand  */
+  YYSYMBOL_match_tensor_expr = 291,        /* match_tensor_expr  */
+  YYSYMBOL_match_vector_expr = 292,        /* match_vector_expr  */
+  YYSYMBOL_match_sparse_expr = 293,        /* match_sparse_expr  */
+  YYSYMBOL_match_text_expr = 294,          /* match_text_expr  */
+  YYSYMBOL_query_expr = 295,               /* query_expr  */
+  YYSYMBOL_fusion_expr = 296,              /* fusion_expr  */
+  YYSYMBOL_sub_search = 297,               /* sub_search  */
+  YYSYMBOL_sub_search_array = 298,         /* sub_search_array  */
+  YYSYMBOL_function_expr = 299,            /* function_expr  */
+  YYSYMBOL_conjunction_expr = 300,         /* conjunction_expr  */
+  YYSYMBOL_between_expr = 301,             /* between_expr  */
+  YYSYMBOL_in_expr = 302,                  /* in_expr  */
+  YYSYMBOL_case_expr = 303,                /* case_expr  */
+  YYSYMBOL_case_check_array = 304,         /* case_check_array  */
+  YYSYMBOL_cast_expr = 305,                /* cast_expr  */
+  YYSYMBOL_subquery_expr = 306,            /* subquery_expr  */
+  YYSYMBOL_column_expr = 307,              /* column_expr  */
+  YYSYMBOL_constant_expr = 308,            /* constant_expr  */
+  YYSYMBOL_common_array_expr = 309,        /* common_array_expr  */
+  YYSYMBOL_common_sparse_array_expr = 310, /* common_sparse_array_expr  */
+  YYSYMBOL_subarray_array_expr = 311,      /* subarray_array_expr  */
+  YYSYMBOL_unclosed_subarray_array_expr = 312, /* unclosed_subarray_array_expr  */
+  YYSYMBOL_sparse_array_expr = 313,        /* sparse_array_expr  */
+  YYSYMBOL_long_sparse_array_expr = 314,   /* long_sparse_array_expr  */
+  YYSYMBOL_unclosed_long_sparse_array_expr = 315, /* unclosed_long_sparse_array_expr  */
+  YYSYMBOL_double_sparse_array_expr = 316, /* double_sparse_array_expr  */
+  YYSYMBOL_unclosed_double_sparse_array_expr = 317, /* unclosed_double_sparse_array_expr  */
+  YYSYMBOL_empty_array_expr = 318,         /* empty_array_expr  */
+  YYSYMBOL_int_sparse_ele = 319,           /* int_sparse_ele  */
+  YYSYMBOL_float_sparse_ele = 320,         /* float_sparse_ele  */
+  YYSYMBOL_array_expr = 321,               /* array_expr  */
+  YYSYMBOL_long_array_expr = 322,          /* long_array_expr  */
+  YYSYMBOL_unclosed_long_array_expr = 323, /* unclosed_long_array_expr  */
+  YYSYMBOL_double_array_expr = 324,        /* double_array_expr  */
+  YYSYMBOL_unclosed_double_array_expr = 325, /* unclosed_double_array_expr  */
+  YYSYMBOL_interval_expr = 326,            /* interval_expr  */
+  YYSYMBOL_copy_option_list = 327,         /* copy_option_list  */
+  YYSYMBOL_copy_option = 328,              /* copy_option  */
+  YYSYMBOL_file_path = 329,                /* file_path  */
+  YYSYMBOL_if_exists = 330,                /* if_exists  */
+  YYSYMBOL_if_not_exists = 331,            /* if_not_exists  */
+  YYSYMBOL_semicolon = 332,                /* semicolon  */
+  YYSYMBOL_if_not_exists_info = 333,       /* if_not_exists_info  */
+  YYSYMBOL_with_index_param_list = 334,    /* with_index_param_list  */
+  YYSYMBOL_optional_table_properties_list = 335, /* optional_table_properties_list  */
+  YYSYMBOL_index_param_list = 336,         /* index_param_list  */
+  YYSYMBOL_index_param = 337,              /* index_param  */
+  YYSYMBOL_index_info = 338                /* index_info  */
 };
 typedef enum yysymbol_kind_t yysymbol_kind_t;
 
@@ -460,7 +463,7 @@ typedef enum yysymbol_kind_t yysymbol_kind_t;
 #pragma GCC diagnostic ignored "-Wunused-but-set-variable"
 #endif
 
-#line 464 "parser.cpp"
+#line 467 "parser.cpp"
 
 #ifdef short
 # undef short
@@ -784,18 +787,18 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  108
+#define YYFINAL  118
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   1409
+#define YYLAST   1399
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  221
+#define YYNTOKENS  222
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  115
+#define YYNNTS  117
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  511
+#define YYNRULES  521
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  1138
+#define YYNSTATES  1160
 
 /* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   459
@@ -817,8 +820,8 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,   212,     2,     2,
      215,   216,   210,   208,   219,   209,   217,   211,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,   220,   218,
-     206,   205,   207,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   221,   218,
+     206,   205,   207,   220,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,   213,     2,   214,     2,     2,     2,     2,     2,     2,
@@ -864,58 +867,59 @@ static const yytype_uint8 yytranslate[] =
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   495,   495,   499,   505,   512,   513,   514,   515,   516,
-     517,   518,   519,   520,   521,   522,   523,   524,   525,   526,
-     528,   529,   530,   531,   532,   533,   534,   535,   536,   537,
-     538,   539,   546,   563,   579,   608,   624,   642,   671,   675,
-     681,   684,   691,   742,   781,   782,   783,   784,   785,   786,
-     787,   788,   789,   790,   791,   792,   793,   794,   795,   796,
-     797,   798,   799,   800,   801,   804,   806,   807,   808,   809,
-     812,   813,   814,   815,   816,   817,   818,   819,   820,   821,
-     822,   823,   824,   825,   826,   827,   828,   829,   830,   831,
-     832,   833,   834,   835,   836,   837,   838,   839,   840,   841,
-     842,   843,   844,   845,   846,   847,   848,   849,   850,   851,
-     852,   853,   854,   855,   856,   857,   858,   859,   860,   861,
-     862,   863,   864,   865,   866,   867,   868,   869,   870,   871,
-     872,   873,   874,   875,   876,   877,   896,   900,   910,   913,
-     916,   919,   923,   926,   931,   936,   943,   949,   959,   975,
-    1009,  1022,  1025,  1032,  1038,  1041,  1044,  1047,  1050,  1053,
-    1056,  1059,  1066,  1079,  1083,  1088,  1101,  1114,  1129,  1144,
-    1159,  1182,  1235,  1290,  1341,  1344,  1347,  1356,  1366,  1369,
-    1373,  1378,  1405,  1408,  1413,  1429,  1432,  1436,  1440,  1445,
-    1451,  1454,  1457,  1461,  1465,  1467,  1471,  1473,  1476,  1480,
-    1483,  1487,  1492,  1496,  1499,  1503,  1506,  1510,  1513,  1517,
-    1520,  1524,  1527,  1530,  1533,  1541,  1544,  1559,  1559,  1561,
-    1575,  1584,  1589,  1598,  1603,  1608,  1614,  1621,  1624,  1628,
-    1631,  1636,  1648,  1655,  1669,  1672,  1675,  1678,  1681,  1684,
-    1687,  1693,  1697,  1701,  1705,  1709,  1716,  1720,  1724,  1728,
-    1732,  1737,  1741,  1746,  1750,  1754,  1760,  1766,  1772,  1783,
-    1794,  1805,  1817,  1829,  1842,  1856,  1867,  1881,  1897,  1914,
-    1918,  1922,  1926,  1930,  1934,  1940,  1944,  1948,  1956,  1960,
-    1964,  1972,  1983,  2006,  2012,  2017,  2023,  2029,  2037,  2043,
-    2049,  2055,  2061,  2069,  2075,  2081,  2087,  2093,  2101,  2107,
-    2113,  2122,  2132,  2145,  2149,  2154,  2160,  2167,  2175,  2184,
-    2194,  2204,  2215,  2226,  2238,  2250,  2260,  2271,  2283,  2296,
-    2300,  2305,  2310,  2316,  2320,  2324,  2330,  2334,  2340,  2344,
-    2349,  2354,  2361,  2370,  2380,  2386,  2391,  2397,  2402,  2415,
-    2419,  2424,  2428,  2461,  2467,  2471,  2472,  2473,  2474,  2475,
-    2477,  2480,  2486,  2489,  2490,  2491,  2492,  2493,  2494,  2495,
-    2496,  2497,  2498,  2502,  2520,  2566,  2605,  2648,  2695,  2719,
-    2742,  2763,  2784,  2793,  2805,  2812,  2822,  2828,  2840,  2843,
-    2846,  2849,  2852,  2855,  2859,  2863,  2868,  2876,  2884,  2893,
-    2900,  2907,  2914,  2921,  2928,  2936,  2944,  2952,  2960,  2968,
-    2976,  2984,  2992,  3000,  3008,  3016,  3024,  3054,  3062,  3071,
-    3079,  3088,  3096,  3102,  3109,  3115,  3122,  3127,  3134,  3141,
-    3149,  3176,  3182,  3188,  3195,  3203,  3210,  3217,  3222,  3232,
-    3237,  3242,  3247,  3252,  3257,  3262,  3267,  3272,  3277,  3280,
-    3283,  3287,  3290,  3293,  3296,  3300,  3303,  3306,  3310,  3314,
-    3319,  3324,  3327,  3331,  3335,  3342,  3349,  3353,  3360,  3367,
-    3371,  3375,  3379,  3382,  3386,  3390,  3395,  3400,  3404,  3409,
-    3414,  3420,  3426,  3432,  3438,  3444,  3450,  3456,  3462,  3468,
-    3474,  3480,  3491,  3495,  3500,  3531,  3541,  3546,  3551,  3556,
-    3562,  3566,  3567,  3569,  3570,  3572,  3573,  3585,  3593,  3597,
-    3600,  3604,  3607,  3611,  3615,  3620,  3626,  3636,  3646,  3654,
-    3665,  3696
+       0,   497,   497,   501,   508,   516,   517,   518,   519,   520,
+     521,   522,   523,   524,   525,   526,   527,   528,   529,   530,
+     531,   532,   534,   535,   536,   537,   538,   539,   540,   541,
+     542,   543,   544,   545,   552,   569,   585,   614,   630,   648,
+     677,   681,   687,   690,   697,   748,   787,   788,   789,   790,
+     791,   792,   793,   794,   795,   796,   797,   798,   799,   800,
+     801,   802,   803,   804,   805,   806,   807,   810,   812,   813,
+     814,   815,   818,   819,   820,   821,   822,   823,   824,   825,
+     826,   827,   828,   829,   830,   831,   832,   833,   834,   835,
+     836,   837,   838,   839,   840,   841,   842,   843,   844,   845,
+     846,   847,   848,   849,   850,   851,   852,   853,   854,   855,
+     856,   857,   858,   859,   860,   861,   862,   863,   864,   865,
+     866,   867,   868,   869,   870,   871,   872,   873,   874,   875,
+     876,   877,   878,   879,   880,   881,   882,   883,   902,   906,
+     916,   919,   922,   925,   929,   932,   937,   942,   949,   955,
+     965,   981,  1015,  1028,  1031,  1038,  1044,  1047,  1050,  1053,
+    1056,  1059,  1062,  1065,  1072,  1084,  1090,  1101,  1114,  1118,
+    1123,  1136,  1149,  1164,  1179,  1194,  1217,  1274,  1333,  1384,
+    1387,  1390,  1399,  1409,  1412,  1416,  1421,  1448,  1451,  1456,
+    1472,  1475,  1479,  1483,  1488,  1494,  1497,  1500,  1504,  1508,
+    1510,  1514,  1516,  1519,  1523,  1526,  1530,  1535,  1539,  1542,
+    1546,  1549,  1553,  1556,  1560,  1563,  1567,  1570,  1573,  1576,
+    1584,  1587,  1602,  1602,  1604,  1618,  1627,  1632,  1641,  1646,
+    1651,  1657,  1664,  1667,  1671,  1674,  1679,  1691,  1698,  1712,
+    1715,  1718,  1721,  1724,  1727,  1730,  1736,  1740,  1744,  1748,
+    1752,  1759,  1763,  1767,  1771,  1781,  1785,  1790,  1794,  1799,
+    1803,  1807,  1813,  1819,  1825,  1836,  1847,  1858,  1870,  1882,
+    1895,  1909,  1920,  1934,  1950,  1967,  1971,  1975,  1979,  1983,
+    1987,  1993,  1997,  2001,  2009,  2013,  2017,  2025,  2036,  2059,
+    2065,  2070,  2076,  2082,  2090,  2096,  2102,  2108,  2114,  2122,
+    2128,  2134,  2140,  2146,  2154,  2160,  2166,  2175,  2184,  2202,
+    2215,  2228,  2232,  2237,  2243,  2250,  2258,  2267,  2277,  2287,
+    2298,  2309,  2321,  2333,  2343,  2354,  2366,  2379,  2383,  2388,
+    2393,  2399,  2403,  2407,  2413,  2417,  2423,  2427,  2432,  2437,
+    2444,  2453,  2463,  2469,  2474,  2480,  2485,  2498,  2502,  2507,
+    2511,  2544,  2550,  2554,  2555,  2556,  2557,  2558,  2560,  2563,
+    2569,  2572,  2573,  2574,  2575,  2576,  2577,  2578,  2579,  2580,
+    2581,  2582,  2588,  2606,  2652,  2691,  2734,  2781,  2805,  2828,
+    2849,  2870,  2879,  2891,  2898,  2908,  2914,  2926,  2929,  2932,
+    2935,  2938,  2941,  2945,  2949,  2954,  2962,  2970,  2979,  2986,
+    2993,  3000,  3007,  3014,  3022,  3030,  3038,  3046,  3054,  3062,
+    3070,  3078,  3086,  3094,  3102,  3110,  3140,  3148,  3157,  3165,
+    3174,  3182,  3188,  3195,  3201,  3208,  3213,  3220,  3227,  3235,
+    3262,  3268,  3274,  3281,  3289,  3296,  3303,  3308,  3318,  3323,
+    3328,  3333,  3338,  3343,  3348,  3353,  3358,  3363,  3366,  3369,
+    3373,  3376,  3379,  3382,  3386,  3389,  3392,  3396,  3400,  3405,
+    3410,  3413,  3417,  3421,  3428,  3435,  3439,  3446,  3453,  3457,
+    3461,  3465,  3468,  3472,  3476,  3481,  3486,  3490,  3495,  3500,
+    3506,  3512,  3518,  3524,  3530,  3536,  3542,  3548,  3554,  3560,
+    3566,  3577,  3581,  3586,  3617,  3627,  3632,  3637,  3642,  3647,
+    3674,  3678,  3679,  3681,  3682,  3684,  3685,  3697,  3705,  3709,
+    3712,  3716,  3719,  3723,  3727,  3732,  3738,  3748,  3758,  3766,
+    3777,  3808
 };
 #endif
 
@@ -961,15 +965,16 @@ static const char *const yytname[] =
   "FOLLOWER", "LEARNER", "CONNECT", "STANDALONE", "NODES", "NODE",
   "PERSISTENCE", "OBJECT", "OBJECTS", "FILES", "MEMORY", "ALLOCATION",
   "NUMBER", "'='", "'<'", "'>'", "'+'", "'-'", "'*'", "'/'", "'%'", "'['",
-  "']'", "'('", "')'", "'.'", "';'", "','", "':'", "$accept",
+  "']'", "'('", "')'", "'.'", "';'", "','", "'?'", "':'", "$accept",
   "input_pattern", "statement_list", "statement", "explainable_statement",
   "create_statement", "table_element_array", "table_element",
   "table_column", "column_type", "column_constraints", "column_constraint",
   "default_expr", "table_constraint", "identifier_array",
   "delete_statement", "insert_statement", "optional_identifier_array",
-  "explain_statement", "explain_type", "update_statement",
-  "update_expr_array", "update_expr", "drop_statement", "copy_statement",
-  "select_statement", "select_with_paren", "select_without_paren",
+  "explain_statement", "explain_type", "prepare_statement",
+  "execute_statement", "update_statement", "update_expr_array",
+  "update_expr", "drop_statement", "copy_statement", "select_statement",
+  "select_with_paren", "select_without_paren",
   "select_clause_with_modifier", "select_clause_without_modifier_paren",
   "select_clause_without_modifier", "order_by_clause",
   "order_by_expr_list", "order_by_expr", "order_by_type", "limit_expr",
@@ -1007,12 +1012,12 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#define YYPACT_NINF (-698)
+#define YYPACT_NINF (-720)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-499)
+#define YYTABLE_NINF (-509)
 
 #define yytable_value_is_error(Yyn) \
   ((Yyn) == YYTABLE_NINF)
@@ -1021,120 +1026,122 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-      70,   243,    32,   429,   108,   121,   108,   111,   485,   575,
-     193,   202,   220,   232,   174,   247,   270,   288,   132,    28,
-     -13,   356,   101,  -698,  -698,  -698,  -698,  -698,  -698,  -698,
-    -698,   233,  -698,  -698,   315,  -698,  -698,  -698,  -698,  -698,
-    -698,  -698,   298,   298,   298,   298,    42,   108,   303,   303,
-     303,   303,   303,   170,   375,   108,   -20,   392,   396,   407,
-    -698,  -698,  -698,  -698,  -698,  -698,  -698,   698,   412,   108,
-    -698,  -698,  -698,  -698,  -698,   435,  -698,   172,   253,  -698,
-     462,  -698,   302,  -698,  -698,   320,  -698,   248,    95,   108,
-     108,   108,   108,  -698,  -698,  -698,  -698,   -23,  -698,   433,
-     285,  -698,   509,    56,   691,   526,   324,   340,  -698,    43,
-    -698,   523,  -698,  -698,     6,   513,  -698,   501,   507,   577,
-     108,   108,   108,   593,   542,   397,   554,   633,   108,   108,
-     108,   640,   641,   643,   583,   652,   652,   487,    29,   119,
-     125,  -698,  -698,  -698,  -698,  -698,  -698,  -698,   233,  -698,
-    -698,  -698,  -698,  -698,  -698,   382,  -698,  -698,   654,  -698,
-     655,  -698,  -698,   656,   660,  -698,  -698,  -698,  -698,   331,
-    -698,  -698,  -698,   108,   445,   288,   652,  -698,   499,  -698,
-     662,  -698,  -698,   666,  -698,  -698,   664,  -698,   669,   616,
-    -698,  -698,  -698,  -698,     6,  -698,  -698,  -698,   487,   619,
-     605,   600,  -698,   -24,  -698,   397,  -698,   108,   678,    37,
-    -698,  -698,  -698,  -698,  -698,   614,  -698,   481,   -31,  -698,
-     487,  -698,  -698,   603,   607,   474,  -698,  -698,   912,   586,
-     484,   486,   328,   699,   700,   709,   711,  -698,  -698,   710,
-     502,   277,   504,   505,   214,   214,  -698,    12,   475,    98,
-    -698,     0,   651,  -698,  -698,  -698,  -698,  -698,  -698,  -698,
-    -698,  -698,  -698,  -698,  -698,  -698,   514,  -698,  -698,  -698,
-    -123,  -698,  -698,    50,  -698,    68,  -698,  -698,  -698,    99,
-    -698,   141,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,
-    -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,   715,   727,
-    -698,  -698,  -698,  -698,  -698,  -698,  -698,   680,   681,   682,
-      49,   653,   315,  -698,  -698,   734,    73,  -698,   737,  -698,
-     359,   531,   532,   -56,   487,   487,   683,  -698,   -13,    33,
-     692,   544,  -698,   146,   545,  -698,   108,   487,   643,  -698,
-     362,   549,   550,   204,  -698,  -698,  -698,  -698,  -698,  -698,
-    -698,  -698,  -698,  -698,  -698,  -698,   214,   551,   684,   685,
-     487,   487,   142,   291,  -698,  -698,  -698,  -698,   912,  -698,
-     753,   552,   553,   556,   560,   772,   774,   395,   395,  -698,
-     559,  -698,  -698,  -698,  -698,   564,    81,   701,   487,   778,
-     487,   487,     7,   568,    11,   214,   214,   214,   214,   214,
-     214,   214,   214,   214,   214,   214,   214,   214,   214,    21,
-    -698,   572,  -698,   780,  -698,   782,  -698,   783,  -698,   785,
-     741,   482,   789,   790,   790,   794,   795,   585,  -698,   594,
-    -698,   796,  -698,    69,   635,   645,  -698,  -698,     8,   628,
-     595,  -698,    79,   362,   487,  -698,   233,   820,   686,   601,
-     147,  -698,  -698,  -698,   -13,   812,  -698,  -698,   814,   487,
-     599,  -698,   362,  -698,    63,    63,   487,  -698,   156,   685,
-     661,   608,     3,   109,   394,  -698,   487,   487,   739,   487,
-     819,    22,   487,   606,   177,   623,  -698,  -698,   652,  -698,
-    -698,  -698,   674,   618,   214,   475,   706,  -698,   694,   694,
-     442,   442,   673,   694,   694,   442,   442,   395,   395,  -698,
-    -698,  -698,  -698,  -698,  -698,   615,  -698,   622,  -698,  -698,
-    -698,   830,   837,  -698,  -698,  -698,  -698,   761,  -698,   843,
-    -698,  -698,   845,  -698,   848,   849,   -13,   647,   391,  -698,
-     136,  -698,   319,   583,   487,  -698,  -698,  -698,   362,  -698,
-    -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,
-     649,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,
-    -698,  -698,  -698,   659,   671,   693,   695,   696,   697,   195,
-     716,   678,   835,    33,   233,   722,  -698,   223,   724,   869,
-     870,   893,   874,  -698,   892,   323,  -698,   334,   342,  -698,
-     725,  -698,   820,   487,  -698,   487,    47,   149,   214,  -111,
-     688,  -698,   -53,    90,    61,   726,  -698,   905,  -698,  -698,
-     861,   475,   694,   730,   352,  -698,   214,   950,   952,   903,
-     908,   958,   758,   353,  -698,   967,  -698,  -698,    18,     8,
-     901,  -698,  -698,  -698,  -698,  -698,  -698,   911,  -698,   974,
-    -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,   759,   921,
-    -698,   984,   856,   873,   890,   907,   924,   941,   859,   847,
-    -698,  -698,   236,  -698,   854,   678,   354,   781,  -698,  -698,
-     827,  -698,   487,  -698,  -698,  -698,  -698,  -698,  -698,    63,
-    -698,  -698,  -698,   791,   362,    53,  -698,   487,   290,   784,
-    1004,   572,   798,   793,   487,  -698,   797,   799,   808,   360,
-    -698,  -698,   684,  1019,  1022,  -698,   466,  -698,   843,   528,
-     136,   391,     8,     8,   815,   319,   970,   971,   369,   822,
-     823,   826,   828,   829,   846,   850,   851,   852,   949,   853,
-     855,   857,   858,   860,   862,   863,   864,   865,   866,   976,
-     867,   868,   871,   872,   875,   876,   877,   878,   879,   880,
-     978,   881,   882,   883,   884,   885,   886,   887,   888,   889,
-     891,   981,   894,   895,   896,   897,   898,   899,   900,   902,
-     904,   906,   983,   909,   910,   913,   914,   915,   916,   917,
-     918,   919,   920,   991,   922,  -698,  -698,   239,  -698,  -698,
-    -698,   384,  -698,   843,  1064,   385,  -698,  -698,  -698,   362,
-    -698,   625,   923,   925,   926,    14,   927,  -698,  -698,  -698,
-     996,   931,   362,  -698,    63,  -698,  -698,  -698,  -698,  -698,
-    -698,  -698,  -698,  -698,  1083,  -698,  -698,  -698,  1024,   678,
-    -698,   487,   487,  -698,  -698,  1087,  1103,  1105,  1106,  1114,
-    1116,  1118,  1120,  1121,  1124,   929,  1125,  1134,  1137,  1143,
-    1144,  1145,  1146,  1147,  1148,  1149,   937,  1151,  1152,  1153,
-    1154,  1155,  1156,  1157,  1158,  1159,  1160,   948,  1162,  1163,
-    1164,  1165,  1166,  1167,  1168,  1169,  1170,  1171,   959,  1173,
-    1174,  1175,  1176,  1177,  1178,  1179,  1180,  1181,  1182,   972,
-    1183,  1184,  1186,  1187,  1188,  1189,  1190,  1191,  1192,  1193,
-     982,  1194,  -698,  -698,   400,   653,  -698,  -698,  1198,    85,
-     987,  1200,  1201,  -698,   401,  1202,   487,   402,   988,   362,
-     990,   993,   994,   995,   997,   998,   999,  1000,  1001,  1002,
-    1206,  1003,  1005,  1006,  1007,  1008,  1009,  1010,  1011,  1012,
-    1013,  1214,  1014,  1015,  1016,  1017,  1018,  1020,  1021,  1023,
-    1025,  1026,  1229,  1027,  1028,  1029,  1030,  1031,  1032,  1033,
-    1034,  1035,  1036,  1232,  1037,  1038,  1039,  1040,  1041,  1042,
-    1043,  1044,  1045,  1046,  1234,  1047,  1048,  1049,  1050,  1051,
-    1052,  1053,  1054,  1055,  1056,  1267,  1058,  -698,  -698,  1057,
-     793,  -698,  1059,  1060,  -698,   467,   362,  -698,  -698,  -698,
-    -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  1061,  -698,
-    -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  1065,
-    -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,
-    1066,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,
-    -698,  1067,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,
-    -698,  -698,  1068,  -698,  -698,  -698,  -698,  -698,  -698,  -698,
-    -698,  -698,  -698,  1069,  -698,  1271,  1070,  1276,   100,  1071,
-    1282,  1283,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,
-    -698,  1072,  -698,  1073,   793,   653,  1284,   580,   120,  1077,
-    1290,  1079,  -698,   587,  1291,  -698,   793,   653,   793,   -33,
-    1292,  -698,  1241,  1084,  -698,  1085,  1253,  1256,  -698,  -698,
-    -698,    -8,  -698,  -698,  1088,  1258,  1259,  -698,  1303,  -698,
-    1092,  1093,  1305,   653,  1094,  -698,   653,  -698
+     867,    55,   390,    54,   442,   130,    84,   130,   142,   398,
+     740,   122,   157,   176,   201,   216,   282,   446,   302,   332,
+     338,   -61,    25,   -39,   351,   149,  -720,  -720,  -720,  -720,
+    -720,  -720,  -720,  -720,  -720,  -720,   109,  -720,  -720,   370,
+    -720,  -720,  -720,  -720,  -720,  -720,  -720,   130,   355,   313,
+     313,   313,   313,    64,   130,   317,   317,   317,   317,   317,
+     191,   408,   130,    -6,   424,   443,   451,  -720,  -720,  -720,
+    -720,  -720,  -720,  -720,   271,   458,   130,  -720,   475,  -720,
+    -720,  -720,  -720,   476,  -720,    77,   289,  -720,   481,  -720,
+     311,  -720,  -720,   326,  -720,   417,   -73,   130,   309,   486,
+     130,   130,   130,  -720,  -720,  -720,  -720,   -48,  -720,   492,
+     356,  -720,   564,    98,   236,   577,   367,   382,  -720,    44,
+    -720,   582,  -720,  -720,     5,   534,  -720,   547,  -720,   621,
+     552,   632,   130,   130,   130,   641,   585,   440,   580,   660,
+     130,   130,   130,   661,   662,   663,   596,   670,   670,   507,
+      43,    80,    93,  -720,  -720,  -720,  -720,  -720,  -720,  -720,
+     109,  -720,  -720,  -720,  -720,  -720,  -720,   482,  -720,  -720,
+    -720,   672,  -720,   676,  -720,  -720,   680,   683,  -720,  -720,
+    -720,  -720,   366,   507,   -39,  -720,  -720,  -720,   130,   473,
+     338,   670,  -720,   521,  -720,   684,  -720,  -720,   689,  -720,
+    -720,   688,  -720,   693,   636,  -720,  -720,  -720,  -720,     5,
+    -720,  -720,  -720,   507,   639,   626,  -720,   625,  -720,    21,
+    -720,   440,  -720,   130,   698,    42,  -720,  -720,  -720,  -720,
+    -720,   638,  -720,   503,   -38,  -720,   507,  -720,  -720,   627,
+     629,   495,  -720,  -720,   841,   645,   504,   506,   341,   714,
+     719,   722,   724,  -720,  -720,   723,   515,   210,   516,   519,
+     653,   653,  -720,    24,   494,  -720,    46,  -720,   -19,   808,
+    -720,  -720,  -720,  -720,  -720,  -720,  -720,  -720,  -720,  -720,
+    -720,  -720,  -720,   520,  -720,  -720,  -720,  -119,  -720,  -720,
+     -37,  -720,    30,  -720,  -720,  -720,   100,  -720,   106,  -720,
+    -720,  -720,  -720,  -720,  -720,  -720,  -720,  -720,  -720,  -720,
+    -720,  -720,  -720,  -720,  -720,   733,   732,  -720,  -720,  -720,
+    -720,  -720,  -720,  -720,   685,   686,   690,    38,   124,   109,
+     658,   370,  -720,  -720,   741,   183,  -720,   742,  -720,    49,
+     530,   531,   -44,   507,   507,   674,  -720,   -39,    81,   694,
+     539,  -720,   137,   541,  -720,   130,   507,   663,  -720,   315,
+     543,   548,   242,  -720,  -720,  -720,  -720,  -720,  -720,  -720,
+    -720,  -720,  -720,  -720,  -720,   653,   549,   820,   678,   507,
+     507,   114,   286,  -720,  -720,  -720,  -720,   841,  -720,   762,
+     556,   557,   562,   563,   775,   776,   429,   429,  -720,   560,
+    -720,  -720,  -720,  -720,   566,    59,   704,   507,   787,   507,
+     507,   -16,   579,    36,   653,   653,   653,   653,   653,   653,
+     653,   653,   653,   653,   653,   653,   653,   653,    11,  -720,
+     583,  -720,   789,  -720,   791,  -720,   793,  -720,   801,   748,
+     455,   806,   807,   807,   809,   814,  -720,   603,  -720,   595,
+    -720,   821,  -720,    57,   664,   666,  -720,  -720,     8,   652,
+     609,  -720,    26,   315,   507,  -720,   109,   946,   703,   623,
+     196,  -720,  -720,  -720,   -39,   837,  -720,  -720,   839,   507,
+     624,  -720,   315,  -720,    78,    78,   507,  -720,   240,   678,
+     687,   628,     9,   110,   296,  -720,   507,   507,   763,   507,
+     842,    12,   507,   630,   273,   525,  -720,  -720,   670,  -720,
+    -720,  -720,   692,   637,   653,   494,   712,  -720,   614,   614,
+     308,   308,   792,   614,   614,   308,   308,   429,   429,  -720,
+    -720,  -720,  -720,  -720,  -720,   635,  -720,   643,  -720,  -720,
+    -720,   845,   851,  -720,  -720,  -720,  -720,   784,  -720,   856,
+    -720,  -720,   863,  -720,   868,   871,   -39,   669,   502,  -720,
+     101,  -720,   212,   596,   507,  -720,  -720,  -720,   315,  -720,
+    -720,  -720,  -720,  -720,  -720,  -720,  -720,  -720,  -720,  -720,
+     679,  -720,  -720,  -720,  -720,  -720,  -720,  -720,  -720,  -720,
+    -720,  -720,  -720,   696,   697,   702,   707,   708,   709,   239,
+     710,   698,   861,    81,   109,   713,  -720,   277,   715,   892,
+     894,   895,   898,   900,  -720,   902,   290,  -720,   307,   327,
+    -720,   716,  -720,   946,   507,  -720,   507,   -23,   140,   653,
+     -49,   699,  -720,    60,   133,    74,   717,  -720,   909,  -720,
+    -720,   847,   494,   614,   718,   336,  -720,   653,   929,   931,
+     880,   885,   937,   736,   343,  -720,   943,  -720,  -720,    15,
+       8,   889,  -720,  -720,  -720,  -720,  -720,  -720,   891,  -720,
+     940,  -720,  -720,  -720,  -720,  -720,  -720,  -720,  -720,   738,
+     897,  -720,   952,   527,   574,   705,   982,   999,  1016,   824,
+     827,  -720,  -720,   192,  -720,   829,   698,   360,   752,  -720,
+    -720,   800,  -720,   507,  -720,  -720,  -720,  -720,  -720,  -720,
+    -720,    78,  -720,  -720,  -720,   754,   315,    94,  -720,   507,
+     154,   758,   968,   583,   764,   759,   507,  -720,   778,   765,
+     779,   361,  -720,  -720,   820,   973,   990,  -720,   401,  -720,
+     856,   350,   101,   502,     8,     8,   790,   212,   947,   948,
+     369,   788,   802,   803,   804,   805,   815,   816,   817,   818,
+     912,   819,   846,   848,   849,   852,   853,   864,   869,   870,
+     881,   913,   884,   886,   887,   901,   903,   904,   910,   911,
+     914,   915,   936,   916,   917,   918,   919,   920,   921,   923,
+     924,   925,   926,   967,   927,   928,   930,   932,   933,   934,
+     935,   938,   939,   941,   989,   942,   944,   945,   949,   950,
+     951,   953,   954,   955,   956,   993,   957,  -720,  -720,   118,
+    -720,  -720,  -720,   373,  -720,   856,  1008,   374,  -720,  -720,
+    -720,   315,  -720,   536,   958,   959,   960,    13,   961,  -720,
+    -720,  -720,  1015,   796,   315,  -720,    78,  -720,  -720,  -720,
+    -720,  -720,  -720,  -720,  -720,  -720,  1093,  -720,  -720,  -720,
+    1036,   698,  -720,   507,   507,  -720,  -720,  1110,  1111,  1115,
+    1122,  1125,  1126,  1142,  1144,  1149,  1150,   962,  1153,  1156,
+    1159,  1160,  1161,  1165,  1176,  1177,  1178,  1179,   969,  1180,
+    1181,  1183,  1184,  1185,  1186,  1187,  1188,  1189,  1190,   978,
+    1192,  1193,  1194,  1195,  1196,  1197,  1198,  1199,  1200,  1201,
+     991,  1202,  1203,  1205,  1206,  1207,  1208,  1209,  1210,  1211,
+    1212,  1000,  1214,  1215,  1216,  1217,  1218,  1219,  1220,  1221,
+    1222,  1223,  1011,  1225,  -720,  -720,   375,   658,  -720,  -720,
+    1228,    83,  1017,  1230,  1231,  -720,   380,  1232,   507,   388,
+    1018,   315,  1020,  1023,  1024,  1025,  1026,  1027,  1028,  1029,
+    1030,  1031,  1242,  1033,  1034,  1035,  1037,  1038,  1039,  1040,
+    1041,  1042,  1043,  1246,  1044,  1045,  1046,  1047,  1048,  1049,
+    1050,  1051,  1052,  1053,  1264,  1055,  1056,  1057,  1058,  1059,
+    1060,  1061,  1062,  1063,  1064,  1275,  1066,  1067,  1068,  1069,
+    1070,  1071,  1072,  1073,  1074,  1075,  1286,  1077,  1078,  1079,
+    1080,  1081,  1082,  1083,  1084,  1085,  1086,  1297,  1088,  -720,
+    -720,  1087,   759,  -720,  1089,  1090,  -720,   489,   315,  -720,
+    -720,  -720,  -720,  -720,  -720,  -720,  -720,  -720,  -720,  -720,
+    1091,  -720,  -720,  -720,  -720,  -720,  -720,  -720,  -720,  -720,
+    -720,  1094,  -720,  -720,  -720,  -720,  -720,  -720,  -720,  -720,
+    -720,  -720,  1095,  -720,  -720,  -720,  -720,  -720,  -720,  -720,
+    -720,  -720,  -720,  1096,  -720,  -720,  -720,  -720,  -720,  -720,
+    -720,  -720,  -720,  -720,  1097,  -720,  -720,  -720,  -720,  -720,
+    -720,  -720,  -720,  -720,  -720,  1098,  -720,  1301,  1099,  1312,
+      66,  1101,  1313,  1314,  -720,  -720,  -720,  -720,  -720,  -720,
+    -720,  -720,  -720,  1102,  -720,  1103,   759,   658,  1317,   505,
+      82,  1108,  1321,  1112,  -720,   561,  1320,  -720,   759,   658,
+     759,   -34,  1323,  -720,  1263,  1114,  -720,  1116,  1281,  1285,
+    -720,  -720,  -720,    10,  -720,  -720,  1118,  1288,  1289,  -720,
+    1333,  -720,  1123,  1121,  1336,   658,  1124,  -720,   658,  -720
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -1142,154 +1149,156 @@ static const yytype_int16 yypact[] =
    means the default is an error.  */
 static const yytype_int16 yydefact[] =
 {
-     228,     0,     0,     0,     0,     0,     0,     0,   161,     0,
+     233,     0,     0,     0,     0,     0,     0,     0,     0,   163,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     228,     0,   496,     3,     5,    10,    12,    13,    11,     6,
-       7,     9,   175,   174,     0,     8,    14,    15,    16,    17,
-      18,    19,   494,   494,   494,   494,   494,     0,   492,   492,
-     492,   492,   492,   221,     0,     0,     0,     0,     0,     0,
-     155,   159,   156,   157,   158,   160,   154,   228,     0,     0,
-     242,   243,   241,   247,   251,     0,   248,     0,     0,   244,
-       0,   246,     0,   269,   271,     0,   249,     0,   275,     0,
-       0,     0,     0,   278,   279,   280,   283,   221,   281,     0,
-     227,   229,     0,     0,     0,     0,     0,     0,     1,   228,
-       2,   211,   213,   214,     0,   198,   180,   186,     0,     0,
-       0,     0,     0,     0,     0,   152,     0,     0,     0,     0,
-       0,     0,     0,     0,   206,     0,     0,     0,     0,     0,
-       0,   153,    20,    25,    27,    26,    21,    22,    24,    23,
-      28,    29,    30,    31,   257,   258,   252,   253,     0,   254,
-       0,   245,   270,     0,     0,   273,   272,   276,   277,     0,
-     302,   300,   301,     0,     0,     0,     0,   329,     0,   330,
-       0,   323,   324,     0,   319,   303,     0,   326,   328,     0,
-     179,   178,     4,   212,     0,   176,   177,   197,     0,     0,
-     194,     0,    32,     0,    33,   152,   497,     0,     0,   228,
-     491,   166,   168,   167,   169,     0,   222,     0,   206,   163,
-       0,   148,   490,     0,     0,   425,   429,   432,   433,     0,
-       0,     0,     0,     0,     0,     0,     0,   430,   431,     0,
-       0,     0,     0,     0,     0,     0,   427,     0,   228,     0,
-     339,   344,   345,   359,   357,   360,   358,   361,   362,   354,
-     349,   348,   347,   355,   356,   346,   353,   352,   440,   442,
-       0,   443,   451,     0,   452,     0,   444,   441,   462,     0,
-     463,     0,   439,   287,   289,   288,   285,   286,   292,   294,
-     293,   290,   291,   297,   299,   298,   295,   296,     0,     0,
-     260,   259,   265,   255,   256,   250,   274,     0,     0,     0,
-       0,   500,     0,   230,   284,     0,   320,   325,   304,   327,
-       0,     0,     0,   200,     0,     0,   196,   493,   228,     0,
-       0,     0,   146,     0,     0,   150,     0,     0,     0,   162,
-     205,     0,     0,     0,   471,   470,   473,   472,   475,   474,
-     477,   476,   479,   478,   481,   480,     0,     0,   391,   228,
-       0,     0,     0,     0,   434,   435,   436,   437,     0,   438,
-       0,     0,     0,     0,     0,     0,     0,   393,   392,   468,
-     465,   459,   449,   454,   457,     0,     0,     0,     0,     0,
+       0,     0,     0,   233,     0,   506,     3,     5,    10,    12,
+      13,    20,    21,    11,     6,     7,     9,   180,   179,     0,
+       8,    14,    15,    16,    17,    18,    19,     0,     0,   504,
+     504,   504,   504,   504,     0,   502,   502,   502,   502,   502,
+     226,     0,     0,     0,     0,     0,     0,   157,   161,   158,
+     159,   160,   162,   156,   233,     0,     0,   247,     0,   248,
+     246,   252,   257,     0,   253,     0,     0,   249,     0,   251,
+       0,   275,   277,     0,   255,     0,   281,     0,   165,     0,
+       0,     0,     0,   284,   285,   286,   289,   226,   287,     0,
+     232,   234,     0,     0,     0,     0,     0,     0,     1,   233,
+       2,   216,   218,   219,     0,   203,   185,   191,   308,     0,
+       0,     0,     0,     0,     0,     0,     0,   154,     0,     0,
+       0,     0,     0,     0,     0,     0,   211,     0,     0,     0,
+       0,     0,     0,   155,    22,    27,    29,    28,    23,    24,
+      26,    25,    30,    31,    32,    33,   263,   264,   254,   258,
+     259,     0,   260,     0,   250,   276,     0,     0,   279,   278,
+     282,   283,     0,     0,   233,   310,   306,   307,     0,     0,
+       0,     0,   337,     0,   338,     0,   331,   332,     0,   327,
+     311,     0,   334,   336,     0,   184,   183,     4,   217,     0,
+     181,   182,   202,     0,     0,   199,   309,     0,    34,     0,
+      35,   154,   507,     0,     0,   233,   501,   171,   173,   172,
+     174,     0,   227,     0,   211,   168,     0,   150,   500,     0,
+       0,   434,   438,   441,   442,     0,     0,     0,     0,     0,
+       0,     0,     0,   439,   440,     0,     0,     0,     0,     0,
+       0,     0,   436,     0,   233,   371,     0,   347,   352,   353,
+     367,   365,   368,   366,   369,   370,   362,   357,   356,   355,
+     363,   364,   354,   361,   360,   449,   451,     0,   452,   460,
+       0,   461,     0,   453,   450,   471,     0,   472,     0,   448,
+     293,   295,   294,   291,   292,   298,   300,   299,   296,   297,
+     303,   305,   304,   301,   302,     0,     0,   266,   265,   271,
+     261,   262,   256,   280,     0,     0,     0,     0,     0,   164,
+     510,     0,   235,   290,     0,   328,   333,   312,   335,     0,
+       0,     0,   205,     0,     0,   201,   503,   233,     0,     0,
+       0,   148,     0,     0,   152,     0,     0,     0,   167,   210,
+       0,     0,     0,   480,   479,   482,   481,   484,   483,   486,
+     485,   488,   487,   490,   489,     0,     0,   400,   233,     0,
+       0,     0,     0,   443,   444,   445,   446,     0,   447,     0,
+       0,     0,     0,     0,     0,     0,   402,   401,   477,   474,
+     468,   458,   463,   466,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   457,
+       0,   462,     0,   465,     0,   473,     0,   476,     0,   272,
+     267,     0,     0,     0,     0,     0,   166,     0,   288,     0,
+     339,     0,   329,     0,     0,     0,   188,   187,     0,   207,
+     190,   192,   197,   198,     0,   186,    37,     0,     0,     0,
+       0,    40,    42,    43,   233,     0,    39,   153,     0,     0,
+     151,   175,   170,   169,     0,     0,     0,   395,     0,   233,
+       0,     0,     0,     0,     0,   425,     0,     0,     0,     0,
+       0,     0,     0,   209,     0,     0,   359,   358,     0,   348,
+     351,   418,   419,     0,     0,   233,     0,   399,   409,   410,
+     413,   414,     0,   416,   408,   411,   412,   404,   403,   405,
+     406,   407,   435,   437,   459,     0,   464,     0,   467,   475,
+     478,     0,     0,   268,   344,   345,   343,     0,   342,     0,
+     236,   330,     0,   313,     0,     0,   233,   204,   220,   222,
+     231,   223,     0,   211,     0,   195,   196,   194,   200,    46,
+      49,    50,    47,    48,    51,    52,    68,    53,    55,    54,
+      71,    58,    59,    60,    56,    57,    61,    62,    63,    64,
+      65,    66,    67,     0,     0,     0,     0,     0,     0,   510,
+       0,     0,   512,     0,    38,     0,   149,     0,     0,     0,
+       0,     0,     0,     0,   495,     0,     0,   491,     0,     0,
+     396,     0,   430,     0,     0,   423,     0,     0,     0,     0,
+       0,     0,   434,     0,     0,     0,     0,   385,     0,   470,
+     469,     0,   233,   417,     0,     0,   398,     0,     0,     0,
+     273,   269,     0,   515,     0,   513,   314,   340,   341,     0,
+       0,     0,   240,   241,   242,   243,   239,   244,     0,   229,
+       0,   224,   389,   387,   390,   388,   391,   392,   393,   206,
+     215,   193,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   141,   142,   145,   138,   145,     0,     0,     0,    36,
+      41,   521,   349,     0,   499,   497,   496,   494,   493,   498,
+     178,     0,   176,   397,   431,     0,   427,     0,   426,     0,
+       0,     0,     0,     0,     0,   209,     0,   383,     0,     0,
+       0,     0,   432,   421,   420,     0,     0,   346,     0,   509,
+       0,     0,   231,   221,     0,     0,   228,     0,     0,   213,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     448,     0,   453,     0,   456,     0,   464,     0,   467,     0,
-     266,   261,     0,     0,     0,     0,     0,     0,   282,     0,
-     331,     0,   321,     0,     0,     0,   183,   182,     0,   202,
-     185,   187,   192,   193,     0,   181,    35,     0,     0,     0,
-       0,    38,    40,    41,   228,     0,    37,   151,     0,     0,
-     149,   170,   165,   164,     0,     0,     0,   386,     0,   228,
-       0,     0,     0,     0,     0,   416,     0,     0,     0,     0,
-       0,     0,     0,   204,     0,     0,   351,   350,     0,   340,
-     343,   409,   410,     0,     0,   228,     0,   390,   400,   401,
-     404,   405,     0,   407,   399,   402,   403,   395,   394,   396,
-     397,   398,   426,   428,   450,     0,   455,     0,   458,   466,
-     469,     0,     0,   262,   336,   337,   335,     0,   334,     0,
-     231,   322,     0,   305,     0,     0,   228,   199,   215,   217,
-     226,   218,     0,   206,     0,   190,   191,   189,   195,    44,
-      47,    48,    45,    46,    49,    50,    66,    51,    53,    52,
-      69,    56,    57,    58,    54,    55,    59,    60,    61,    62,
-      63,    64,    65,     0,     0,     0,     0,     0,     0,   500,
-       0,     0,   502,     0,    36,     0,   147,     0,     0,     0,
-       0,     0,     0,   486,     0,     0,   482,     0,     0,   387,
-       0,   421,     0,     0,   414,     0,     0,     0,     0,     0,
-       0,   425,     0,     0,     0,     0,   376,     0,   461,   460,
-       0,   228,   408,     0,     0,   389,     0,     0,     0,   267,
-     263,     0,   505,     0,   503,   306,   332,   333,     0,     0,
-       0,   235,   236,   237,   238,   234,   239,     0,   224,     0,
-     219,   380,   378,   381,   379,   382,   383,   384,   201,   210,
-     188,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     139,   140,   143,   136,   143,     0,     0,     0,    34,    39,
-     511,   341,     0,   488,   487,   485,   484,   489,   173,     0,
-     171,   388,   422,     0,   418,     0,   417,     0,     0,     0,
-       0,     0,     0,   204,     0,   374,     0,     0,     0,     0,
-     423,   412,   411,     0,     0,   338,     0,   499,     0,     0,
-     226,   216,     0,     0,   223,     0,     0,   208,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   143,   140,     0,
+     139,    45,    44,     0,   147,     0,     0,     0,   492,   429,
+     424,   428,   415,     0,     0,   209,     0,     0,     0,   454,
+     456,   455,     0,     0,   208,   386,     0,   433,   422,   274,
+     270,   516,   517,   519,   518,   514,     0,   315,   225,   237,
+       0,     0,   394,     0,     0,   189,    70,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   141,   138,     0,   137,    43,
-      42,     0,   145,     0,     0,     0,   483,   420,   415,   419,
-     406,     0,     0,   204,     0,     0,     0,   445,   447,   446,
-       0,     0,   203,   377,     0,   424,   413,   268,   264,   506,
-     507,   509,   508,   504,     0,   307,   220,   232,     0,     0,
-     385,     0,     0,   184,    68,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   144,   146,     0,   510,   350,   474,
+       0,     0,     0,     0,     0,   384,     0,   316,     0,     0,
+     214,   212,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   142,   144,     0,   500,   342,   465,     0,     0,
-       0,     0,     0,   375,     0,   308,     0,     0,   209,   207,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   501,   510,     0,
-     204,   372,     0,   204,   172,     0,   233,   225,    67,    73,
-      74,    71,    72,    75,    76,    77,    78,    79,     0,    70,
-     117,   118,   115,   116,   119,   120,   121,   122,   123,     0,
-     114,    84,    85,    82,    83,    86,    87,    88,    89,    90,
-       0,    81,    95,    96,    93,    94,    97,    98,    99,   100,
-     101,     0,    92,   128,   129,   126,   127,   130,   131,   132,
-     133,   134,     0,   125,   106,   107,   104,   105,   108,   109,
-     110,   111,   112,     0,   103,     0,     0,     0,     0,     0,
-       0,     0,   310,   309,   315,    80,   124,    91,   102,   135,
-     113,   204,   373,     0,   204,   500,   316,   311,     0,     0,
-       0,     0,   371,     0,     0,   312,   204,   500,   204,   500,
-       0,   317,   313,     0,   367,     0,     0,     0,   370,   318,
-     314,   500,   363,   369,     0,     0,     0,   366,     0,   365,
-       0,     0,     0,   500,     0,   368,   500,   364
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   511,
+     520,     0,   209,   381,     0,   209,   177,     0,   238,   230,
+      69,    75,    76,    73,    74,    77,    78,    79,    80,    81,
+       0,    72,   119,   120,   117,   118,   121,   122,   123,   124,
+     125,     0,   116,    86,    87,    84,    85,    88,    89,    90,
+      91,    92,     0,    83,    97,    98,    95,    96,    99,   100,
+     101,   102,   103,     0,    94,   130,   131,   128,   129,   132,
+     133,   134,   135,   136,     0,   127,   108,   109,   106,   107,
+     110,   111,   112,   113,   114,     0,   105,     0,     0,     0,
+       0,     0,     0,     0,   318,   317,   323,    82,   126,    93,
+     104,   137,   115,   209,   382,     0,   209,   510,   324,   319,
+       0,     0,     0,     0,   380,     0,     0,   320,   209,   510,
+     209,   510,     0,   325,   321,     0,   376,     0,     0,     0,
+     379,   326,   322,   510,   372,   378,     0,     0,     0,   375,
+       0,   374,     0,     0,     0,   510,     0,   377,   510,   373
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -698,  -698,  -698,  1203,  -698,  1244,  -698,   731,   216,   713,
-    -698,   644,   639,  -698,  -568,  1250,  1251,  1115,  -698,  -698,
-    1252,  -698,   985,  1254,  1255,   -63,  1304,   -19,  1062,  1131,
-      -5,  -698,  -698,   786,  -698,  -698,  -698,  -698,  -698,  -698,
-    -697,  -208,  -698,  -698,  -698,  -698,   687,   -81,    23,   609,
-    -698,  -698,  1161,  -698,  -698,  1260,  1261,  1264,  1265,  1266,
-    -698,  -698,  -196,  -698,   946,  -220,  -222,  -527,  -526,  -521,
-    -512,  -511,  -509,   610,  -698,  -698,  -698,  -698,  -698,  -698,
-     975,  -698,  -698,   928,   541,  -242,  -698,  -698,  -698,   637,
-    -698,  -698,  -698,  -698,   638,   930,   932,  -374,  -698,  -698,
-    -698,  -698,  1102,  -457,   657,  -127,   459,   503,  -698,  -698,
-    -576,  -698,   539,   626,  -698
+    -720,  -720,  -720,  1224,  -720,  1267,  -720,   739,   200,   721,
+    -720,   654,   650,  -720,  -591,  1272,  1274,  1128,  -720,  -720,
+    -720,  -720,  1276,  -720,   994,  1278,  1279,   -71,  1331,   -21,
+    1032,  1146,   -84,  -720,  -720,   794,  -720,  -720,  -720,  -720,
+    -720,  -720,  -719,  -226,  -720,  -720,  -720,  -720,   700,   -83,
+      17,   615,  -720,  -720,  1166,  -720,  -720,  1287,  1290,  1291,
+    1292,  1293,  -720,  -720,  -182,  -720,   963,  -236,  -228,  -546,
+    -541,  -539,  -537,  -536,  -535,   612,  -720,  -720,  -720,  -720,
+    -720,  -720,   981,  -720,  -720,   872,   550,  -258,  -720,  -720,
+    -720,   644,  -720,  -720,  -720,  -720,   647,   964,   965,  -521,
+    -720,  -720,  -720,  -720,  1117,  -478,   665,  -139,   413,   452,
+    -720,  -720,  -595,  -720,   553,   634,  -720
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-       0,    21,    22,    23,   141,    24,   450,   451,   452,   579,
-     672,   673,   799,   453,   333,    25,    26,   209,    27,    67,
-      28,   218,   219,    29,    30,    31,    32,    33,   116,   195,
-     117,   200,   440,   441,   547,   326,   445,   198,   439,   543,
-     615,   221,   843,   727,   114,   537,   538,   539,   540,   650,
-      34,   100,   101,   541,   647,    35,    36,    37,    38,    39,
-      40,    41,   249,   460,   250,   251,   252,   253,   254,   255,
-     256,   257,   258,   657,   658,   259,   260,   261,   262,   263,
-     363,   264,   265,   266,   267,   268,   816,   269,   270,   271,
-     272,   273,   274,   275,   276,   383,   384,   277,   278,   279,
-     280,   281,   282,   595,   596,   223,   127,   119,   110,   124,
-     428,   678,   633,   634,   456
+       0,    24,    25,    26,   153,    27,   470,   471,   472,   599,
+     693,   694,   821,   473,   352,    28,    29,   225,    30,    74,
+      31,    32,    33,   234,   235,    34,    35,    36,    37,    38,
+     126,   210,   127,   215,   460,   461,   567,   345,   465,   213,
+     459,   563,   636,   237,   865,   749,   124,   557,   558,   559,
+     560,   671,    39,   110,   111,   561,   668,    40,    41,    42,
+      43,    44,    45,    46,   266,   480,   267,   268,   269,   270,
+     271,   272,   273,   274,   275,   678,   679,   276,   277,   278,
+     279,   280,   382,   281,   282,   283,   284,   285,   838,   286,
+     287,   288,   289,   290,   291,   292,   293,   402,   403,   294,
+     295,   296,   297,   298,   299,   616,   617,   239,   139,   131,
+     120,   136,   448,   699,   654,   655,   476
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -1297,469 +1306,470 @@ static const yytype_int16 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     340,   107,   323,   674,   148,   382,   821,   358,   597,   224,
-     339,    53,   362,   676,   115,   651,   652,   379,   380,   379,
-     380,   653,   377,   378,   512,   611,   438,    54,   386,    56,
-     654,   655,   283,   656,   284,   285,   447,   328,   111,    98,
-     112,   220,   103,  -495,   104,   173,   113,   390,   391,   314,
-       1,   427,     2,     3,     4,     5,     6,     7,     8,     9,
-      10,   389,   135,   136,   602,   703,    11,    12,    13,    47,
-     125,    17,    14,    15,    16,   334,   427,     1,   134,     2,
-       3,     4,     5,     6,     7,     8,     9,    10,   493,  1000,
-     496,   410,   155,    11,    12,    13,   411,   286,  1116,    14,
-      15,    16,   532,   425,   442,   443,  1094,   801,   699,   196,
-    -498,    53,   169,   170,   171,   172,   920,   462,   533,   431,
-     118,    17,   288,  1125,   289,   290,  1106,    17,   293,   432,
-     294,   295,   426,   704,   358,  1117,   696,   589,   590,   648,
-     472,   473,   808,   203,   204,   205,   497,   468,   591,   592,
-     593,   212,   213,   214,    17,   545,   546,   704,   390,   391,
-    1126,   390,   391,   388,   409,   448,   701,   449,   494,   514,
-     491,   492,   704,   498,   499,   500,   501,   502,   503,   504,
-     505,   506,   507,   508,   509,   510,   511,   291,   338,   322,
-     335,   329,   704,   296,   132,   137,   311,   649,   651,   652,
-     287,   603,    20,    55,   653,   390,   391,   225,   226,   227,
-     228,   390,   391,   654,   655,    18,   656,   225,   226,   227,
-     228,   194,   105,   536,   548,   247,   381,    89,   381,   385,
-     331,   513,   246,    19,   720,   361,    90,   390,   391,   390,
-     391,   697,    18,   226,   227,   228,   177,   178,   390,   391,
-      96,   179,   594,   111,    91,   112,   606,   607,    20,   609,
-      19,   113,   613,   587,   412,   446,    92,   390,   391,   413,
-     598,   927,   622,    97,   668,   466,    42,    43,    44,   427,
-      57,    58,   414,   229,   230,    20,    59,   415,    45,    46,
-     292,    99,   231,   356,   232,   167,   297,   487,   168,   624,
-     390,   391,   231,  1076,   232,   102,  1079,   390,   391,   702,
-     233,   234,   235,   416,   387,   668,   236,   388,   417,   109,
-     233,   234,   235,   115,   442,   812,   236,   669,   819,   670,
-     671,   225,   226,   227,   228,   659,    93,    94,    95,   998,
-     471,   307,   237,   238,   239,   233,   234,   235,   308,   157,
-     158,   236,   237,   238,   239,   418,   108,   309,   310,   461,
-     419,   620,   457,   582,   240,   458,   583,   924,   669,   470,
-     670,   671,   599,   797,   240,   388,   118,   237,   238,   239,
-     475,   126,   476,   694,   477,   695,   698,   132,   241,   133,
-     242,   584,   243,   616,  1099,   138,   617,  1101,   241,   139,
-     242,   371,   243,   372,   712,   373,   374,   229,   230,  1113,
-     140,  1115,   244,   245,   246,   154,   231,   247,   232,   248,
-     467,   361,   244,   245,   246,   709,   394,   247,   298,   248,
-     159,   160,   299,   300,   233,   234,   235,   301,   302,   681,
-     236,   156,   388,   395,   396,   397,   398,   164,   165,   166,
-     600,   400,   247,   640,  -240,   641,   642,   643,   644,   814,
-     645,   646,    48,    49,    50,   161,   237,   238,   239,   829,
-     830,   831,   832,   638,    51,    52,   623,   809,   225,   226,
-     227,   228,   162,   604,   822,   605,   805,   477,   240,   163,
-     225,   226,   227,   228,   174,   401,   402,   403,   404,   405,
-     406,   407,   408,   241,   175,   242,   810,   243,   128,   129,
-     130,   131,   241,  1080,   242,   176,   243,  1081,  1082,  1102,
-     390,   391,  1083,  1084,    60,    61,    62,    63,    64,    65,
-     189,  1114,    66,  1118,   522,   523,   244,   245,   246,   688,
-     190,   247,   689,   248,   193,  1127,   120,   121,   122,   123,
-     690,   434,   435,   689,   229,   230,   191,  1135,   691,    17,
-    1137,   388,   834,   231,   835,   232,   229,   230,   711,   717,
-     802,   388,   718,   458,   199,   231,   826,   232,   394,   388,
-     202,   233,   234,   235,   197,   844,   201,   236,   845,   225,
-     226,   227,   228,   233,   234,   235,   206,  -499,  -499,   236,
-     913,   916,   708,   458,   388,   406,   407,   408,    68,    69,
-     207,    70,   208,   237,   238,   239,   997,  1004,  1007,   718,
-     689,   458,   929,    71,    72,   237,   238,   239,   618,   619,
-     379,   917,  1104,  1105,   210,   240,   211,  1110,  1111,   525,
-     526,   837,   838,   215,   216,   928,   217,   240,  -499,  -499,
-     404,   405,   406,   407,   408,   220,   222,   303,   304,   241,
-     312,   242,   305,   243,   306,   356,   357,   315,   316,   317,
-     318,   241,   319,   242,   231,   243,   232,   320,   324,   325,
-     327,   332,   336,   244,   245,   246,   337,   341,   247,   343,
-     248,   342,   233,   234,   235,   244,   245,   246,   236,   359,
-     247,   360,   248,   364,   365,     1,  1006,     2,     3,     4,
-       5,     6,     7,   366,     9,   367,   368,   370,   420,   375,
-     376,    11,    12,    13,   237,   238,   239,    14,    15,    16,
-     392,   409,   393,   421,   422,   423,   424,   427,   430,    73,
-      74,    75,    76,   433,    77,    78,   240,   436,   437,    79,
-      80,    81,   470,   454,    82,    83,    84,   478,   444,   455,
-     459,    85,    86,   470,   464,   465,   469,   479,   480,    17,
-     241,   481,   242,    87,   243,   482,   483,    88,   484,   485,
-     486,   490,    17,   495,   488,   247,   515,   394,   517,   519,
-     520,   521,   524,   447,   244,   245,   246,   527,   528,   247,
-     529,   248,   531,   534,   395,   396,   397,   398,   399,   394,
-     530,   542,   400,   535,   544,   585,   581,   586,   588,   580,
-     394,   608,   494,   610,   601,   614,   395,   396,   397,   398,
-     394,   626,   390,   621,   400,   627,   629,   395,   396,   397,
-     398,   625,   628,   630,   631,   400,   632,  -499,  -499,   397,
-     398,   635,   636,   637,   180,  -499,   401,   402,   403,   404,
-     405,   406,   407,   408,   661,   181,   639,   677,   182,   183,
-      18,   184,   185,   186,   662,   683,   684,   686,   401,   402,
-     403,   404,   405,   406,   407,   408,   663,   187,   188,   401,
-     402,   403,   404,   405,   406,   407,   408,   685,   687,  -499,
-     402,   403,   404,   405,   406,   407,   408,   700,   664,   706,
-     665,   666,   667,    20,   549,   550,   551,   552,   553,   554,
-     555,   556,   557,   558,   559,   560,   561,   562,   563,   564,
-     565,   675,   566,   567,   568,   569,   570,   571,   680,   682,
-     572,   692,   705,   573,   574,   707,   710,   575,   576,   577,
-     578,   729,   730,   731,   732,   733,   619,   618,   734,   735,
-     713,   715,   714,   716,   722,   736,   737,   738,   740,   741,
-     742,   743,   744,   719,   723,   745,   746,   724,   725,   726,
-     796,   739,   747,   748,   749,   751,   752,   753,   754,   755,
-     728,   797,   756,   757,   795,   804,   803,   811,   750,   758,
-     759,   760,   762,   763,   764,   765,   766,   807,   813,   767,
-     768,   815,   820,   823,   824,   761,   769,   770,   771,   773,
-     774,   775,   776,   777,   825,   827,   778,   779,   828,   841,
-     839,   842,   772,   780,   781,   782,   784,   785,   786,   787,
-     788,   846,   847,   789,   790,   848,   855,   849,   850,   783,
-     791,   792,   793,   344,   345,   346,   347,   348,   349,   350,
-     351,   352,   353,   354,   355,   851,   794,   915,   704,   852,
-     853,   854,   856,   866,   857,   877,   858,   859,   888,   860,
-     899,   861,   862,   863,   864,   865,   867,   868,   910,   925,
-     869,   870,   926,   930,   871,   872,   873,   874,   875,   876,
-     878,   879,   880,   881,   882,   883,   884,   885,   886,   931,
-     887,   932,   933,   889,   890,   891,   892,   893,   894,   895,
-     934,   896,   935,   897,   936,   898,   937,   938,   900,   901,
-     939,   941,   902,   903,   904,   905,   906,   907,   908,   909,
-     942,   911,   918,   943,   919,   921,   922,   923,   940,   944,
-     945,   946,   947,   948,   949,   950,   951,   952,   953,   954,
-     955,   956,   957,   958,   959,   960,   961,   962,   963,   964,
-     965,   966,   967,   968,   969,   970,   971,   972,   973,   974,
-     975,   976,   977,   978,   979,   980,   981,   982,   983,   985,
-     986,   984,   987,   988,   989,   990,   991,   992,   993,   994,
-     996,   995,   999,  1001,  1002,  1003,  1008,   388,  1005,  1009,
-    1010,  1011,  1018,  1012,  1013,  1014,  1015,  1016,  1017,  1019,
-    1029,  1020,  1021,  1022,  1023,  1024,  1025,  1026,  1027,  1028,
-    1030,  1031,  1032,  1033,  1034,  1040,  1035,  1036,  1051,  1037,
-    1062,  1038,  1039,  1041,  1042,  1043,  1044,  1045,  1046,  1047,
-    1048,  1049,  1050,  1052,  1053,  1054,  1055,  1056,  1057,  1058,
-    1059,  1060,  1061,  1063,  1064,  1065,  1066,  1067,  1068,  1069,
-    1070,  1071,  1072,  1073,  1074,  1091,  1075,  1085,  1077,  1078,
-    1093,  1086,  1087,  1088,  1089,  1090,  1092,  1095,  1096,  1097,
-    1103,  1098,  1100,  1107,  1108,  1109,  1120,  1112,  1119,  1123,
-    1121,  1122,  1124,  1128,  1129,  1130,  1131,  1132,  1134,  1133,
-    1136,   142,   192,   800,   679,   693,   798,   143,   144,   145,
-     330,   146,   147,   463,   106,   321,   721,   149,   150,   836,
-     660,   151,   152,   153,   489,   840,   313,   474,   912,   817,
-     818,   369,   914,   516,   833,     0,   806,   518,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   429,     0,     0,     0,     0,     0,
+     359,   328,   117,   160,   695,   401,   843,   618,   358,   240,
+     697,    60,   381,   125,   532,   632,   672,   377,   398,   399,
+     188,   673,    61,   674,    63,   675,   676,   677,   405,   398,
+     399,   342,   396,   397,   236,   121,   108,   122,   458,   113,
+     211,   114,   408,   123,  -505,    20,   300,     1,   301,   302,
+     447,     2,   333,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,   128,   513,   718,    14,    15,    16,
+     623,   137,  1116,    17,    18,    19,   147,   148,   725,   146,
+     353,   609,   347,   305,   467,   306,   307,  1022,  1128,    47,
+     552,    54,   444,   167,   447,   429,   310,  1138,   311,   312,
+     430,    48,   565,   566,   669,   823,   553,   462,   463,   409,
+     410,   303,   112,   329,   182,   516,   942,   185,   186,   187,
+     482,   445,   242,   243,   244,   341,    20,   180,    20,   121,
+     181,   122,  -508,    60,  1139,   409,   410,   123,   726,   409,
+     410,  1147,   130,   492,   493,   514,   726,   377,   308,   219,
+     220,   221,   610,   611,   726,   726,    97,   228,   229,   230,
+      98,   313,   670,   612,   613,   614,    62,   409,   410,   144,
+     721,   517,   534,   511,   512,   407,    23,   431,  1148,    99,
+     488,   357,   432,   830,   409,   410,   518,   519,   520,   521,
+     522,   523,   524,   525,   526,   527,   528,   529,   530,   531,
+     834,   672,   624,   841,   354,   330,   673,   380,   674,   149,
+     675,   676,   677,   468,   304,   469,    21,   409,   410,   115,
+     209,   533,   262,   556,   249,   250,   251,   400,   568,   451,
+     252,   742,   719,   490,    22,   100,   348,   263,   400,   452,
+     350,   454,   455,   404,   433,   241,   242,   243,   244,   434,
+     101,   309,   409,   410,   170,   171,   253,   254,   255,    23,
+     627,   628,   406,   630,   314,   407,   634,   615,   409,   410,
+     949,   689,   409,   410,     1,   507,   466,   428,     2,   723,
+       3,     4,     5,     6,     7,     8,   643,    10,   192,   193,
+     413,   409,   410,   194,    14,    15,    16,   607,   409,   410,
+      17,    18,    19,  1098,   619,   106,  1101,   414,   415,   416,
+     417,    64,    65,   486,   435,   419,   102,    66,   689,   436,
+     437,   245,   246,   447,   690,   438,   691,   692,   462,   819,
+     247,   263,   248,   645,   390,   107,   391,   680,   392,   393,
+     446,   109,  1020,   407,   241,   242,   243,   244,   249,   250,
+     251,   118,   724,   477,   252,    20,   478,   491,   129,   420,
+     421,   422,   423,   424,   425,   426,   427,   119,   946,   641,
+     832,   690,   481,   691,   692,   495,   324,   496,   125,   497,
+     253,   254,   255,   325,   856,   625,   857,   626,   716,   497,
+     717,   130,   326,   327,  1121,   138,   257,  1123,   258,   195,
+     259,   720,   256,   604,   851,   852,   853,   854,   144,  1135,
+     196,  1137,   602,   197,   198,   603,   199,   200,   201,   734,
+     245,   246,   145,    49,    50,    51,   257,   150,   258,   247,
+     259,   248,   202,   203,   380,    52,    53,    67,    68,    69,
+      70,    71,    72,    21,   413,    73,   151,   249,   250,   251,
+     260,   261,   262,   252,   152,   263,   620,   264,   487,   407,
+     731,   166,   265,  -509,  -509,   836,   172,   173,   621,   140,
+     141,   142,   143,   409,   410,    55,    56,    57,   168,   253,
+     254,   255,   169,   831,   174,   659,    23,    58,    59,   637,
+     844,   175,   638,   702,   644,   176,   407,   241,   242,   243,
+     244,   256,   132,   133,   134,   135,   710,   542,   543,   711,
+     241,   242,   243,   244,  -509,  -509,   423,   424,   425,   426,
+     427,   827,  1124,   712,   183,   257,   711,   258,   315,   259,
+     639,   640,   316,   317,  1136,  1102,  1140,   318,   319,  1103,
+    1104,   398,   939,   713,  1105,  1106,   407,   184,  1149,   260,
+     261,   262,   733,   189,   263,   407,   264,  1126,  1127,   739,
+    1157,   265,   740,  1159,   661,  -245,   662,   663,   664,   665,
+     191,   666,   667,   245,   246,   190,   824,   848,    20,   478,
+     407,   204,   247,   205,   248,   866,   245,   246,   867,   935,
+     938,  1019,   478,   407,   740,   247,  1026,   248,   206,   711,
+     249,   250,   251,   208,  1029,   212,   252,   478,   103,   104,
+     105,  1132,  1133,   249,   250,   251,   177,   178,   179,   252,
+     214,   730,   751,   752,   753,   754,   755,   216,   951,   756,
+     757,   217,   253,   254,   255,   218,   758,   759,   760,   425,
+     426,   427,   545,   546,   222,   253,   254,   255,   241,   242,
+     243,   244,   761,   223,   256,   224,   241,   242,   243,   244,
+     226,   859,   860,   227,   231,   232,   233,   256,   236,   762,
+     763,   764,   765,   766,   238,   320,   767,   768,   257,   321,
+     258,   950,   259,   769,   770,   771,   322,   323,   331,   334,
+     335,   257,   336,   258,   337,   259,   338,   339,   343,   772,
+     344,   351,   260,   261,   262,   346,   355,   263,   356,   264,
+     362,   360,  1028,   361,   265,   260,   261,   262,   383,   378,
+     263,   379,   264,   384,   375,   376,   385,   265,   386,   387,
+     389,   394,   375,   247,   395,   248,   439,   428,   440,   441,
+     442,   247,   447,   248,   443,   450,   456,   457,   453,   464,
+     413,   249,   250,   251,   475,   474,   479,   252,   484,   249,
+     250,   251,    20,   485,   489,   252,   498,  -509,  -509,   416,
+     417,   499,   500,    75,    76,  -509,    77,   501,   502,   503,
+     504,   505,   506,   253,   254,   255,    78,   508,    79,    80,
+     510,   253,   254,   255,   515,   535,   263,   537,   541,   539,
+     773,   774,   775,   776,   777,   256,   540,   778,   779,   544,
+     467,   550,   547,   256,   780,   781,   782,   548,   549,  -509,
+     421,   422,   423,   424,   425,   426,   427,   551,   564,   257,
+     783,   258,   554,   259,   555,   562,   600,   257,   601,   258,
+     605,   259,   606,   608,   622,   629,   631,   646,   514,   635,
+     409,   650,   642,   260,   261,   262,   648,   651,   263,   653,
+     264,   260,   261,   262,   649,   265,   263,   652,   264,   656,
+       1,   490,   657,   265,     2,   658,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,   411,   660,   412,
+      14,    15,    16,   698,   682,   704,    17,    18,    19,   490,
+     705,   706,   707,   708,    81,    82,    83,    84,   709,    85,
+      86,   683,   684,   728,    87,    88,    89,   685,   722,    90,
+      91,    92,   686,   687,   688,   696,    93,    94,   413,   701,
+     703,   729,   714,   727,   732,   640,   639,   735,    95,   736,
+     737,   738,    96,   746,   413,   414,   415,   416,   417,   741,
+     647,    20,   744,   419,   745,   748,   413,   747,   750,   817,
+     818,   414,   415,   416,   417,   418,   819,   825,   826,   419,
+     829,   833,   835,   414,   415,   416,   417,   837,   842,   849,
+     846,   419,   363,   364,   365,   366,   367,   368,   369,   370,
+     371,   372,   373,   374,   845,   847,   850,   420,   421,   422,
+     423,   424,   425,   426,   427,   861,   863,   868,   864,   877,
+     888,   937,   945,   420,   421,   422,   423,   424,   425,   426,
+     427,   869,   870,   871,   872,   420,   421,   422,   423,   424,
+     425,   426,   427,   899,   873,   874,   875,   876,   878,    21,
+     569,   570,   571,   572,   573,   574,   575,   576,   577,   578,
+     579,   580,   581,   582,   583,   584,   585,    22,   586,   587,
+     588,   589,   590,   591,   910,   879,   592,   880,   881,   593,
+     594,   882,   883,   595,   596,   597,   598,   784,   785,   786,
+     787,   788,    23,   884,   789,   790,   921,   726,   885,   886,
+     932,   791,   792,   793,   795,   796,   797,   798,   799,   947,
+     887,   800,   801,   889,   948,   890,   891,   794,   802,   803,
+     804,   806,   807,   808,   809,   810,   952,   953,   811,   812,
+     892,   954,   893,   894,   805,   813,   814,   815,   955,   895,
+     896,   956,   957,   897,   898,   900,   901,   902,   903,   904,
+     905,   816,   906,   907,   908,   909,   911,   912,   958,   913,
+     959,   914,   915,   916,   917,   960,   961,   918,   919,   963,
+     920,   922,   964,   923,   924,   965,   966,   967,   925,   926,
+     927,   968,   928,   929,   930,   931,   933,   940,   941,   943,
+     944,   962,   969,   970,   971,   972,   974,   975,   973,   976,
+     977,   978,   979,   980,   981,   982,   983,   984,   985,   986,
+     987,   988,   989,   990,   991,   992,   993,   994,   996,   997,
+     995,   998,   999,  1000,  1001,  1002,  1003,  1004,  1005,  1006,
+    1007,  1008,  1009,  1010,  1011,  1012,  1013,  1014,  1015,  1016,
+    1017,  1018,  1021,  1023,  1024,  1025,  1030,   407,  1027,  1031,
+    1032,  1033,  1034,  1035,  1036,  1037,  1038,  1039,  1040,  1041,
+    1042,  1043,  1051,  1044,  1045,  1046,  1047,  1048,  1049,  1050,
+    1052,  1053,  1054,  1055,  1056,  1057,  1058,  1059,  1060,  1061,
+    1062,  1063,  1064,  1065,  1066,  1067,  1068,  1069,  1070,  1071,
+    1072,  1073,  1074,  1075,  1076,  1077,  1078,  1079,  1080,  1081,
+    1082,  1083,  1084,  1085,  1086,  1087,  1088,  1089,  1090,  1091,
+    1092,  1093,  1094,  1095,  1096,  1113,  1097,  1107,  1099,  1100,
+    1108,  1109,  1110,  1111,  1112,  1114,  1115,  1117,  1142,  1118,
+    1119,  1120,  1122,  1125,  1129,  1130,  1134,  1145,  1131,  1141,
+    1143,  1146,  1144,  1150,  1151,  1152,  1153,  1155,  1154,  1156,
+    1158,   154,   700,   207,   715,   822,   155,   820,   156,   349,
+     157,   483,   158,   159,   116,   340,   332,   858,   681,   862,
+     743,   161,   494,   449,   162,   163,   164,   165,   839,   934,
+     509,   840,   388,   633,   855,     0,   828,     0,   936,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   612
+       0,     0,     0,     0,     0,     0,   536,     0,     0,   538
 };
 
 static const yytype_int16 yycheck[] =
 {
-     220,    20,   198,   579,    67,   247,   703,   229,   465,   136,
-     218,     3,   232,   581,     8,   542,   542,     5,     6,     5,
-       6,   542,   244,   245,     3,     3,    82,     4,   248,     6,
-     542,   542,     3,   542,     5,     6,     3,    61,    20,    16,
-      22,    72,    14,     0,    16,    68,    28,   158,   159,   176,
-       7,    84,     9,    10,    11,    12,    13,    14,    15,    16,
-      17,    61,    82,    83,    61,     4,    23,    24,    25,    37,
-      47,    84,    29,    30,    31,    38,    84,     7,    55,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    81,     4,
-      79,   214,    69,    23,    24,    25,   219,    68,   131,    29,
-      30,    31,    33,    54,   324,   325,     6,   675,   219,   114,
-      68,     3,    89,    90,    91,    92,   813,   337,    49,    46,
-      78,    84,     3,   131,     5,     6,     6,    84,     3,    56,
-       5,     6,    83,    72,   356,   168,    89,    74,    75,     3,
-     360,   361,    89,   120,   121,   122,   135,   343,    85,    86,
-      87,   128,   129,   130,    84,    76,    77,    72,   158,   159,
-     168,   158,   159,   219,   217,   132,   219,   134,   161,   411,
-     390,   391,    72,   395,   396,   397,   398,   399,   400,   401,
-     402,   403,   404,   405,   406,   407,   408,    68,   219,   194,
-     209,   215,    72,    68,   217,   215,   173,    61,   725,   725,
-     171,    92,   215,    82,   725,   158,   159,     3,     4,     5,
-       6,   158,   159,   725,   725,   172,   725,     3,     4,     5,
-       6,   215,   194,   215,   444,   213,   214,    34,   214,   248,
-     207,   210,   210,   190,   216,    93,    34,   158,   159,   158,
-     159,    92,   172,     4,     5,     6,   190,   191,   158,   159,
-       3,   195,   189,    20,    34,    22,   476,   477,   215,   479,
-     190,    28,   482,   459,   214,   328,    34,   158,   159,   219,
-     466,   839,   494,     3,    79,    71,    33,    34,    35,    84,
-     169,   170,   214,    79,    80,   215,   175,   219,    45,    46,
-     171,     3,    88,    79,    90,   200,   171,   216,   203,   495,
-     158,   159,    88,  1000,    90,   173,  1003,   158,   159,   219,
-     106,   107,   108,   214,   216,    79,   112,   219,   219,   218,
-     106,   107,   108,     8,   544,   699,   112,   132,   702,   134,
-     135,     3,     4,     5,     6,   543,   162,   163,   164,   915,
-     359,    10,   138,   139,   140,   106,   107,   108,    17,   177,
-     178,   112,   138,   139,   140,   214,     0,    26,    27,   336,
-     219,   488,   216,   216,   160,   219,   219,   824,   132,    79,
-     134,   135,   216,   137,   160,   219,    78,   138,   139,   140,
-      89,    78,    91,   603,    93,   605,   608,   217,   184,    14,
-     186,   454,   188,   216,  1091,     3,   219,  1094,   184,     3,
-     186,   124,   188,   126,   626,   128,   129,    79,    80,  1106,
-       3,  1108,   208,   209,   210,     3,    88,   213,    90,   215,
-     216,    93,   208,   209,   210,   621,   136,   213,    46,   215,
-     177,   178,    50,    51,   106,   107,   108,    55,    56,   216,
-     112,     6,   219,   153,   154,   155,   156,   199,   200,   201,
-     469,   161,   213,    62,    63,    64,    65,    66,    67,   701,
-      69,    70,    33,    34,    35,     3,   138,   139,   140,     3,
-       4,     5,     6,   536,    45,    46,   495,   697,     3,     4,
-       5,     6,   180,    89,   704,    91,   682,    93,   160,   169,
-       3,     4,     5,     6,    61,   205,   206,   207,   208,   209,
-     210,   211,   212,   184,   219,   186,   216,   188,    49,    50,
-      51,    52,   184,    46,   186,     6,   188,    50,    51,  1095,
-     158,   159,    55,    56,    39,    40,    41,    42,    43,    44,
-       4,  1107,    47,  1109,    52,    53,   208,   209,   210,   216,
-     216,   213,   219,   215,    21,  1121,    43,    44,    45,    46,
-     216,   192,   193,   219,    79,    80,   216,  1133,   216,    84,
-    1136,   219,    34,    88,    36,    90,    79,    80,   216,   216,
-     216,   219,   219,   219,    73,    88,   216,    90,   136,   219,
-       3,   106,   107,   108,    71,   216,    79,   112,   219,     3,
-       4,     5,     6,   106,   107,   108,     3,   155,   156,   112,
-     216,   216,   621,   219,   219,   210,   211,   212,    33,    34,
-      68,    36,   215,   138,   139,   140,   216,   216,   216,   219,
-     219,   219,   842,    48,    49,   138,   139,   140,     5,     6,
-       5,     6,    52,    53,    80,   160,     3,    50,    51,   423,
-     424,   722,   723,     3,     3,   841,     3,   160,   206,   207,
-     208,   209,   210,   211,   212,    72,     4,     3,     3,   184,
-     215,   186,     6,   188,     4,    79,    80,   168,     6,     3,
-       6,   184,     3,   186,    88,   188,    90,    61,    59,    74,
-      80,     3,    68,   208,   209,   210,   205,    84,   213,   215,
-     215,    84,   106,   107,   108,   208,   209,   210,   112,   215,
-     213,   215,   215,     4,     4,     7,   926,     9,    10,    11,
-      12,    13,    14,     4,    16,     4,     6,   215,     3,   215,
-     215,    23,    24,    25,   138,   139,   140,    29,    30,    31,
-      79,   217,    81,     6,    54,    54,    54,    84,     4,   164,
-     165,   166,   167,     6,   169,   170,   160,   216,   216,   174,
-     175,   176,    79,    61,   179,   180,   181,     4,    75,   215,
-     215,   186,   187,    79,   215,   215,   215,   215,   215,    84,
-     184,   215,   186,   198,   188,   215,     4,   202,     4,   220,
-     216,     3,    84,   215,    83,   213,     6,   136,     6,     6,
-       5,    50,     3,     3,   208,   209,   210,     3,     3,   213,
-     215,   215,     6,   168,   153,   154,   155,   156,   157,   136,
-     216,   183,   161,   168,   219,     3,   215,     3,   219,   133,
-     136,    82,   161,     4,   216,   219,   153,   154,   155,   156,
-     136,   158,   158,   215,   161,   220,     6,   153,   154,   155,
-     156,   135,   220,     6,    83,   161,     3,   153,   154,   155,
-     156,     6,     4,     4,   163,   161,   205,   206,   207,   208,
-     209,   210,   211,   212,   215,   174,   219,    32,   177,   178,
-     172,   180,   181,   182,   215,     6,     6,     3,   205,   206,
-     207,   208,   209,   210,   211,   212,   215,   196,   197,   205,
-     206,   207,   208,   209,   210,   211,   212,     4,     6,   205,
-     206,   207,   208,   209,   210,   211,   212,   219,   215,     4,
-     215,   215,   215,   215,    94,    95,    96,    97,    98,    99,
-     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
-     110,   215,   112,   113,   114,   115,   116,   117,   216,   215,
-     120,   216,   216,   123,   124,    84,   216,   127,   128,   129,
-     130,    95,    96,    97,    98,    99,     6,     5,   102,   103,
-      57,     3,    54,   205,    63,   109,   110,   111,    95,    96,
-      97,    98,    99,     6,    63,   102,   103,     3,   219,    58,
-     133,   125,   109,   110,   111,    95,    96,    97,    98,    99,
-       6,   137,   102,   103,   135,   168,   215,   213,   125,   109,
-     110,   111,    95,    96,    97,    98,    99,   216,     4,   102,
-     103,   213,   219,   216,   215,   125,   109,   110,   111,    95,
-      96,    97,    98,    99,   216,     6,   102,   103,     6,    59,
-     215,    60,   125,   109,   110,   111,    95,    96,    97,    98,
-      99,   219,   219,   102,   103,   219,    97,   219,   219,   125,
-     109,   110,   111,   141,   142,   143,   144,   145,   146,   147,
-     148,   149,   150,   151,   152,   219,   125,     3,    72,   219,
-     219,   219,   219,    97,   219,    97,   219,   219,    97,   219,
-      97,   219,   219,   219,   219,   219,   219,   219,    97,     6,
-     219,   219,    68,     6,   219,   219,   219,   219,   219,   219,
-     219,   219,   219,   219,   219,   219,   219,   219,   219,     6,
+     236,   183,    23,    74,   599,   263,   725,   485,   234,   148,
+     601,     3,   248,     8,     3,     3,   562,   245,     5,     6,
+      68,   562,     5,   562,     7,   562,   562,   562,   264,     5,
+       6,   213,   260,   261,    72,    20,    19,    22,    82,    14,
+     124,    16,    61,    28,     0,    84,     3,     3,     5,     6,
+      84,     7,   191,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    47,    81,    89,    23,    24,    25,
+      61,    54,     6,    29,    30,    31,    82,    83,     4,    62,
+      38,     3,    61,     3,     3,     5,     6,     4,     6,    34,
+      33,    37,    54,    76,    84,   214,     3,   131,     5,     6,
+     219,    46,    76,    77,     3,   696,    49,   343,   344,   158,
+     159,    68,   173,   184,    97,    79,   835,   100,   101,   102,
+     356,    83,     4,     5,     6,   209,    84,   200,    84,    20,
+     203,    22,    68,     3,   168,   158,   159,    28,    72,   158,
+     159,   131,    78,   379,   380,   161,    72,   375,    68,   132,
+     133,   134,    74,    75,    72,    72,    34,   140,   141,   142,
+       3,    68,    61,    85,    86,    87,    82,   158,   159,   217,
+     219,   135,   430,   409,   410,   219,   215,   214,   168,     3,
+     362,   219,   219,    89,   158,   159,   414,   415,   416,   417,
+     418,   419,   420,   421,   422,   423,   424,   425,   426,   427,
+     721,   747,    92,   724,   225,   188,   747,    93,   747,   215,
+     747,   747,   747,   132,   171,   134,   172,   158,   159,   194,
+     215,   210,   210,   215,   106,   107,   108,   214,   464,    46,
+     112,   216,    92,    79,   190,    34,   215,   213,   214,    56,
+     223,   192,   193,   264,   214,     3,     4,     5,     6,   219,
+      34,   171,   158,   159,   177,   178,   138,   139,   140,   215,
+     496,   497,   216,   499,   171,   219,   502,   189,   158,   159,
+     861,    79,   158,   159,     3,   216,   347,   217,     7,   219,
+       9,    10,    11,    12,    13,    14,   514,    16,   190,   191,
+     136,   158,   159,   195,    23,    24,    25,   479,   158,   159,
+      29,    30,    31,  1022,   486,     3,  1025,   153,   154,   155,
+     156,   169,   170,    71,   214,   161,    34,   175,    79,   219,
+     214,    79,    80,    84,   132,   219,   134,   135,   564,   137,
+      88,   213,    90,   515,   124,     3,   126,   563,   128,   129,
+     216,     3,   937,   219,     3,     4,     5,     6,   106,   107,
+     108,     0,   219,   216,   112,    84,   219,   378,     3,   205,
+     206,   207,   208,   209,   210,   211,   212,   218,   846,   508,
+     216,   132,   355,   134,   135,    89,    10,    91,     8,    93,
+     138,   139,   140,    17,    34,    89,    36,    91,   624,    93,
+     626,    78,    26,    27,  1113,    78,   184,  1116,   186,   163,
+     188,   629,   160,   474,     3,     4,     5,     6,   217,  1128,
+     174,  1130,   216,   177,   178,   219,   180,   181,   182,   647,
+      79,    80,    14,    33,    34,    35,   184,     3,   186,    88,
+     188,    90,   196,   197,    93,    45,    46,    39,    40,    41,
+      42,    43,    44,   172,   136,    47,     3,   106,   107,   108,
+     208,   209,   210,   112,     3,   213,   216,   215,   216,   219,
+     642,     3,   220,   155,   156,   723,   177,   178,   489,    56,
+      57,    58,    59,   158,   159,    33,    34,    35,     3,   138,
+     139,   140,     6,   719,     3,   556,   215,    45,    46,   216,
+     726,   180,   219,   216,   515,   169,   219,     3,     4,     5,
+       6,   160,    50,    51,    52,    53,   216,    52,    53,   219,
+       3,     4,     5,     6,   206,   207,   208,   209,   210,   211,
+     212,   703,  1117,   216,   215,   184,   219,   186,    46,   188,
+       5,     6,    50,    51,  1129,    46,  1131,    55,    56,    50,
+      51,     5,     6,   216,    55,    56,   219,    61,  1143,   208,
+     209,   210,   216,    61,   213,   219,   215,    52,    53,   216,
+    1155,   220,   219,  1158,    62,    63,    64,    65,    66,    67,
+       6,    69,    70,    79,    80,   219,   216,   216,    84,   219,
+     219,     4,    88,   216,    90,   216,    79,    80,   219,   216,
+     216,   216,   219,   219,   219,    88,   216,    90,   216,   219,
+     106,   107,   108,    21,   216,    71,   112,   219,   162,   163,
+     164,    50,    51,   106,   107,   108,   199,   200,   201,   112,
+      73,   642,    95,    96,    97,    98,    99,     6,   864,   102,
+     103,    79,   138,   139,   140,     3,   109,   110,   111,   210,
+     211,   212,   442,   443,     3,   138,   139,   140,     3,     4,
+       5,     6,   125,    68,   160,   215,     3,     4,     5,     6,
+      80,   744,   745,     3,     3,     3,     3,   160,    72,    95,
+      96,    97,    98,    99,     4,     3,   102,   103,   184,     3,
+     186,   863,   188,   109,   110,   111,     6,     4,   215,   168,
+       6,   184,     3,   186,     6,   188,     3,    61,    59,   125,
+      74,     3,   208,   209,   210,    80,    68,   213,   205,   215,
+     215,    84,   948,    84,   220,   208,   209,   210,     4,   215,
+     213,   215,   215,     4,    79,    80,     4,   220,     4,     6,
+     215,   215,    79,    88,   215,    90,     3,   217,     6,    54,
+      54,    88,    84,    90,    54,     4,   216,   216,     6,    75,
+     136,   106,   107,   108,   215,    61,   215,   112,   215,   106,
+     107,   108,    84,   215,   215,   112,     4,   153,   154,   155,
+     156,   215,   215,    33,    34,   161,    36,   215,   215,     4,
+       4,   221,   216,   138,   139,   140,    46,    83,    48,    49,
+       3,   138,   139,   140,   215,     6,   213,     6,    50,     6,
+      95,    96,    97,    98,    99,   160,     5,   102,   103,     3,
+       3,   216,     3,   160,   109,   110,   111,     3,   215,   205,
+     206,   207,   208,   209,   210,   211,   212,     6,   219,   184,
+     125,   186,   168,   188,   168,   183,   133,   184,   215,   186,
+       3,   188,     3,   219,   216,    82,     4,   135,   161,   219,
+     158,     6,   215,   208,   209,   210,   221,     6,   213,     3,
+     215,   208,   209,   210,   221,   220,   213,    83,   215,     6,
+       3,    79,     4,   220,     7,     4,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    19,    79,   219,    81,
+      23,    24,    25,    32,   215,     3,    29,    30,    31,    79,
+       6,     6,     4,     3,   164,   165,   166,   167,     6,   169,
+     170,   215,   215,     4,   174,   175,   176,   215,   219,   179,
+     180,   181,   215,   215,   215,   215,   186,   187,   136,   216,
+     215,    84,   216,   216,   216,     6,     5,    57,   198,    54,
+       3,   205,   202,     3,   136,   153,   154,   155,   156,     6,
+     158,    84,    63,   161,    63,    58,   136,   219,     6,   135,
+     133,   153,   154,   155,   156,   157,   137,   215,   168,   161,
+     216,   213,     4,   153,   154,   155,   156,   213,   219,     6,
+     215,   161,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,   151,   152,   216,   216,     6,   205,   206,   207,
+     208,   209,   210,   211,   212,   215,    59,   219,    60,    97,
+      97,     3,   216,   205,   206,   207,   208,   209,   210,   211,
+     212,   219,   219,   219,   219,   205,   206,   207,   208,   209,
+     210,   211,   212,    97,   219,   219,   219,   219,   219,   172,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   190,   112,   113,
+     114,   115,   116,   117,    97,   219,   120,   219,   219,   123,
+     124,   219,   219,   127,   128,   129,   130,    95,    96,    97,
+      98,    99,   215,   219,   102,   103,    97,    72,   219,   219,
+      97,   109,   110,   111,    95,    96,    97,    98,    99,     6,
+     219,   102,   103,   219,    68,   219,   219,   125,   109,   110,
+     111,    95,    96,    97,    98,    99,     6,     6,   102,   103,
+     219,     6,   219,   219,   125,   109,   110,   111,     6,   219,
      219,     6,     6,   219,   219,   219,   219,   219,   219,   219,
-       6,   219,     6,   219,     6,   219,     6,     6,   219,   219,
-       6,     6,   219,   219,   219,   219,   219,   219,   219,   219,
-       6,   219,   219,     6,   219,   219,   219,   216,   219,     6,
-       6,     6,     6,     6,     6,     6,   219,     6,     6,     6,
+     219,   125,   219,   219,   219,   219,   219,   219,     6,   219,
+       6,   219,   219,   219,   219,     6,     6,   219,   219,     6,
+     219,   219,     6,   219,   219,     6,     6,     6,   219,   219,
+     219,     6,   219,   219,   219,   219,   219,   219,   219,   219,
+     219,   219,     6,     6,     6,     6,     6,     6,   219,     6,
        6,     6,     6,     6,     6,     6,     6,   219,     6,     6,
-       6,     6,     6,     6,     6,     6,     6,     6,   219,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,   219,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,   219,     4,   216,     4,     4,   216,   219,     6,   216,
+     219,     6,     6,     6,     6,     6,     6,     6,     6,   219,
+       6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
+     219,     6,     4,   216,     4,     4,   216,   219,     6,   216,
+     216,   216,   216,   216,   216,   216,   216,   216,     6,   216,
      216,   216,     6,   216,   216,   216,   216,   216,   216,   216,
-       6,   216,   216,   216,   216,   216,   216,   216,   216,   216,
-     216,   216,   216,   216,   216,     6,   216,   216,     6,   216,
-       6,   216,   216,   216,   216,   216,   216,   216,   216,   216,
-     216,   216,   216,   216,   216,   216,   216,   216,   216,   216,
      216,   216,   216,   216,   216,   216,   216,   216,   216,   216,
+       6,   216,   216,   216,   216,   216,   216,   216,   216,   216,
+     216,     6,   216,   216,   216,   216,   216,   216,   216,   216,
+     216,   216,     6,   216,   216,   216,   216,   216,   216,   216,
      216,   216,   216,     6,   216,     4,   219,   216,   219,   219,
-       4,   216,   216,   216,   216,   216,   216,   216,     6,     6,
-       6,   219,   219,   216,     4,   216,    55,     6,     6,    46,
-     216,   216,    46,   215,    46,    46,     3,   215,     3,   216,
-     216,    67,   109,   674,   583,   602,   672,    67,    67,    67,
-     205,    67,    67,   338,    20,   194,   639,    67,    67,   720,
-     544,    67,    67,    67,   388,   725,   175,   362,   797,   702,
-     702,   239,   803,   413,   718,    -1,   689,   415,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   312,    -1,    -1,    -1,    -1,    -1,
+     216,   216,   216,   216,   216,   216,     4,   216,    55,     6,
+       6,   219,   219,     6,   216,     4,     6,    46,   216,     6,
+     216,    46,   216,   215,    46,    46,     3,   216,   215,     3,
+     216,    74,   603,   119,   623,   695,    74,   693,    74,   221,
+      74,   357,    74,    74,    23,   209,   190,   742,   564,   747,
+     660,    74,   381,   331,    74,    74,    74,    74,   724,   819,
+     407,   724,   255,   501,   740,    -1,   711,    -1,   825,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   481
+      -1,    -1,    -1,    -1,    -1,    -1,   432,    -1,    -1,   434
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
    state STATE-NUM.  */
 static const yytype_int16 yystos[] =
 {
-       0,     7,     9,    10,    11,    12,    13,    14,    15,    16,
-      17,    23,    24,    25,    29,    30,    31,    84,   172,   190,
-     215,   222,   223,   224,   226,   236,   237,   239,   241,   244,
-     245,   246,   247,   248,   271,   276,   277,   278,   279,   280,
-     281,   282,    33,    34,    35,    45,    46,    37,    33,    34,
-      35,    45,    46,     3,   269,    82,   269,   169,   170,   175,
-      39,    40,    41,    42,    43,    44,    47,   240,    33,    34,
-      36,    48,    49,   164,   165,   166,   167,   169,   170,   174,
-     175,   176,   179,   180,   181,   186,   187,   198,   202,    34,
-      34,    34,    34,   162,   163,   164,     3,     3,   269,     3,
-     272,   273,   173,    14,    16,   194,   247,   248,     0,   218,
-     329,    20,    22,    28,   265,     8,   249,   251,    78,   328,
-     328,   328,   328,   328,   330,   269,    78,   327,   327,   327,
-     327,   327,   217,    14,   269,    82,    83,   215,     3,     3,
-       3,   225,   226,   236,   237,   241,   244,   245,   246,   276,
-     277,   278,   279,   280,     3,   269,     6,   177,   178,   177,
-     178,     3,   180,   169,   199,   200,   201,   200,   203,   269,
-     269,   269,   269,    68,    61,   219,     6,   190,   191,   195,
-     163,   174,   177,   178,   180,   181,   182,   196,   197,     4,
-     216,   216,   224,    21,   215,   250,   251,    71,   258,    73,
-     252,    79,     3,   269,   269,   269,     3,    68,   215,   238,
-      80,     3,   269,   269,   269,     3,     3,     3,   242,   243,
-      72,   262,     4,   326,   326,     3,     4,     5,     6,    79,
-      80,    88,    90,   106,   107,   108,   112,   138,   139,   140,
-     160,   184,   186,   188,   208,   209,   210,   213,   215,   283,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   296,
-     297,   298,   299,   300,   302,   303,   304,   305,   306,   308,
-     309,   310,   311,   312,   313,   314,   315,   318,   319,   320,
-     321,   322,   323,     3,     5,     6,    68,   171,     3,     5,
-       6,    68,   171,     3,     5,     6,    68,   171,    46,    50,
-      51,    55,    56,     3,     3,     6,     4,    10,    17,    26,
-      27,   269,   215,   273,   326,   168,     6,     3,     6,     3,
-      61,   250,   251,   283,    59,    74,   256,    80,    61,   215,
-     238,   269,     3,   235,    38,   248,    68,   205,   219,   262,
-     286,    84,    84,   215,   141,   142,   143,   144,   145,   146,
-     147,   148,   149,   150,   151,   152,    79,    80,   287,   215,
-     215,    93,   286,   301,     4,     4,     4,     4,     6,   323,
-     215,   124,   126,   128,   129,   215,   215,   287,   287,     5,
-       6,   214,   306,   316,   317,   248,   286,   216,   219,    61,
-     158,   159,    79,    81,   136,   153,   154,   155,   156,   157,
-     161,   205,   206,   207,   208,   209,   210,   211,   212,   217,
-     214,   219,   214,   219,   214,   219,   214,   219,   214,   219,
-       3,     6,    54,    54,    54,    54,    83,    84,   331,   249,
-       4,    46,    56,     6,   192,   193,   216,   216,    82,   259,
-     253,   254,   286,   286,    75,   257,   246,     3,   132,   134,
-     227,   228,   229,   234,    61,   215,   335,   216,   219,   215,
-     284,   269,   286,   243,   215,   215,    71,   216,   283,   215,
-      79,   248,   286,   286,   301,    89,    91,    93,     4,   215,
-     215,   215,   215,     4,     4,   220,   216,   216,    83,   285,
-       3,   286,   286,    81,   161,   215,    79,   135,   287,   287,
-     287,   287,   287,   287,   287,   287,   287,   287,   287,   287,
-     287,   287,     3,   210,   306,     6,   316,     6,   317,     6,
-       5,    50,    52,    53,     3,   229,   229,     3,     3,   215,
-     216,     6,    33,    49,   168,   168,   215,   266,   267,   268,
-     269,   274,   183,   260,   219,    76,    77,   255,   286,    94,
+       0,     3,     7,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    23,    24,    25,    29,    30,    31,
+      84,   172,   190,   215,   223,   224,   225,   227,   237,   238,
+     240,   242,   243,   244,   247,   248,   249,   250,   251,   274,
+     279,   280,   281,   282,   283,   284,   285,    34,    46,    33,
+      34,    35,    45,    46,    37,    33,    34,    35,    45,    46,
+       3,   272,    82,   272,   169,   170,   175,    39,    40,    41,
+      42,    43,    44,    47,   241,    33,    34,    36,    46,    48,
+      49,   164,   165,   166,   167,   169,   170,   174,   175,   176,
+     179,   180,   181,   186,   187,   198,   202,    34,     3,     3,
+      34,    34,    34,   162,   163,   164,     3,     3,   272,     3,
+     275,   276,   173,    14,    16,   194,   250,   251,     0,   218,
+     332,    20,    22,    28,   268,     8,   252,   254,   272,     3,
+      78,   331,   331,   331,   331,   331,   333,   272,    78,   330,
+     330,   330,   330,   330,   217,    14,   272,    82,    83,   215,
+       3,     3,     3,   226,   227,   237,   238,   244,   247,   248,
+     249,   279,   280,   281,   282,   283,     3,   272,     3,     6,
+     177,   178,   177,   178,     3,   180,   169,   199,   200,   201,
+     200,   203,   272,   215,    61,   272,   272,   272,    68,    61,
+     219,     6,   190,   191,   195,   163,   174,   177,   178,   180,
+     181,   182,   196,   197,     4,   216,   216,   225,    21,   215,
+     253,   254,    71,   261,    73,   255,     6,    79,     3,   272,
+     272,   272,     3,    68,   215,   239,    80,     3,   272,   272,
+     272,     3,     3,     3,   245,   246,    72,   265,     4,   329,
+     329,     3,     4,     5,     6,    79,    80,    88,    90,   106,
+     107,   108,   112,   138,   139,   140,   160,   184,   186,   188,
+     208,   209,   210,   213,   215,   220,   286,   288,   289,   290,
+     291,   292,   293,   294,   295,   296,   299,   300,   301,   302,
+     303,   305,   306,   307,   308,   309,   311,   312,   313,   314,
+     315,   316,   317,   318,   321,   322,   323,   324,   325,   326,
+       3,     5,     6,    68,   171,     3,     5,     6,    68,   171,
+       3,     5,     6,    68,   171,    46,    50,    51,    55,    56,
+       3,     3,     6,     4,    10,    17,    26,    27,   286,   249,
+     272,   215,   276,   329,   168,     6,     3,     6,     3,    61,
+     253,   254,   286,    59,    74,   259,    80,    61,   215,   239,
+     272,     3,   236,    38,   251,    68,   205,   219,   265,   289,
+      84,    84,   215,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,   151,   152,    79,    80,   290,   215,   215,
+      93,   289,   304,     4,     4,     4,     4,     6,   326,   215,
+     124,   126,   128,   129,   215,   215,   290,   290,     5,     6,
+     214,   309,   319,   320,   251,   289,   216,   219,    61,   158,
+     159,    79,    81,   136,   153,   154,   155,   156,   157,   161,
+     205,   206,   207,   208,   209,   210,   211,   212,   217,   214,
+     219,   214,   219,   214,   219,   214,   219,   214,   219,     3,
+       6,    54,    54,    54,    54,    83,   216,    84,   334,   252,
+       4,    46,    56,     6,   192,   193,   216,   216,    82,   262,
+     256,   257,   289,   289,    75,   260,   249,     3,   132,   134,
+     228,   229,   230,   235,    61,   215,   338,   216,   219,   215,
+     287,   272,   289,   246,   215,   215,    71,   216,   286,   215,
+      79,   251,   289,   289,   304,    89,    91,    93,     4,   215,
+     215,   215,   215,     4,     4,   221,   216,   216,    83,   288,
+       3,   289,   289,    81,   161,   215,    79,   135,   290,   290,
+     290,   290,   290,   290,   290,   290,   290,   290,   290,   290,
+     290,   290,     3,   210,   309,     6,   319,     6,   320,     6,
+       5,    50,    52,    53,     3,   230,   230,     3,     3,   215,
+     216,     6,    33,    49,   168,   168,   215,   269,   270,   271,
+     272,   277,   183,   263,   219,    76,    77,   258,   289,    94,
       95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
      105,   106,   107,   108,   109,   110,   112,   113,   114,   115,
-     116,   117,   120,   123,   124,   127,   128,   129,   130,   230,
-     133,   215,   216,   219,   246,     3,     3,   283,   219,    74,
-      75,    85,    86,    87,   189,   324,   325,   324,   283,   216,
-     248,   216,    61,    92,    89,    91,   286,   286,    82,   286,
-       4,     3,   304,   286,   219,   261,   216,   219,     5,     6,
-     326,   215,   287,   248,   283,   135,   158,   220,   220,     6,
-       6,    83,     3,   333,   334,     6,     4,     4,   246,   219,
-      62,    64,    65,    66,    67,    69,    70,   275,     3,    61,
-     270,   288,   289,   290,   291,   292,   293,   294,   295,   262,
-     254,   215,   215,   215,   215,   215,   215,   215,    79,   132,
-     134,   135,   231,   232,   331,   215,   235,    32,   332,   228,
-     216,   216,   215,     6,     6,     4,     3,     6,   216,   219,
-     216,   216,   216,   230,   286,   286,    89,    92,   287,   219,
-     219,   219,   219,     4,    72,   216,     4,    84,   248,   283,
-     216,   216,   287,    57,    54,     3,   205,   216,   219,     6,
-     216,   267,    63,    63,     3,   219,    58,   264,     6,    95,
-      96,    97,    98,    99,   102,   103,   109,   110,   111,   125,
-      95,    96,    97,    98,    99,   102,   103,   109,   110,   111,
-     125,    95,    96,    97,    98,    99,   102,   103,   109,   110,
+     116,   117,   120,   123,   124,   127,   128,   129,   130,   231,
+     133,   215,   216,   219,   249,     3,     3,   286,   219,     3,
+      74,    75,    85,    86,    87,   189,   327,   328,   327,   286,
+     216,   251,   216,    61,    92,    89,    91,   289,   289,    82,
+     289,     4,     3,   307,   289,   219,   264,   216,   219,     5,
+       6,   329,   215,   290,   251,   286,   135,   158,   221,   221,
+       6,     6,    83,     3,   336,   337,     6,     4,     4,   249,
+     219,    62,    64,    65,    66,    67,    69,    70,   278,     3,
+      61,   273,   291,   292,   293,   294,   295,   296,   297,   298,
+     265,   257,   215,   215,   215,   215,   215,   215,   215,    79,
+     132,   134,   135,   232,   233,   334,   215,   236,    32,   335,
+     229,   216,   216,   215,     3,     6,     6,     4,     3,     6,
+     216,   219,   216,   216,   216,   231,   289,   289,    89,    92,
+     290,   219,   219,   219,   219,     4,    72,   216,     4,    84,
+     251,   286,   216,   216,   290,    57,    54,     3,   205,   216,
+     219,     6,   216,   270,    63,    63,     3,   219,    58,   267,
+       6,    95,    96,    97,    98,    99,   102,   103,   109,   110,
      111,   125,    95,    96,    97,    98,    99,   102,   103,   109,
      110,   111,   125,    95,    96,    97,    98,    99,   102,   103,
      109,   110,   111,   125,    95,    96,    97,    98,    99,   102,
-     103,   109,   110,   111,   125,   135,   133,   137,   232,   233,
-     233,   235,   216,   215,   168,   283,   325,   216,    89,   286,
-     216,   213,   318,     4,   306,   213,   307,   310,   315,   318,
-     219,   261,   286,   216,   215,   216,   216,     6,     6,     3,
-       4,     5,     6,   334,    34,    36,   270,   268,   268,   215,
-     294,    59,    60,   263,   216,   219,   219,   219,   219,   219,
-     219,   219,   219,   219,   219,    97,   219,   219,   219,   219,
-     219,   219,   219,   219,   219,   219,    97,   219,   219,   219,
+     103,   109,   110,   111,   125,    95,    96,    97,    98,    99,
+     102,   103,   109,   110,   111,   125,    95,    96,    97,    98,
+      99,   102,   103,   109,   110,   111,   125,   135,   133,   137,
+     233,   234,   234,   236,   216,   215,   168,   286,   328,   216,
+      89,   289,   216,   213,   321,     4,   309,   213,   310,   313,
+     318,   321,   219,   264,   289,   216,   215,   216,   216,     6,
+       6,     3,     4,     5,     6,   337,    34,    36,   273,   271,
+     271,   215,   297,    59,    60,   266,   216,   219,   219,   219,
      219,   219,   219,   219,   219,   219,   219,    97,   219,   219,
      219,   219,   219,   219,   219,   219,   219,   219,    97,   219,
      219,   219,   219,   219,   219,   219,   219,   219,   219,    97,
      219,   219,   219,   219,   219,   219,   219,   219,   219,   219,
-      97,   219,   305,   216,   333,     3,   216,     6,   219,   219,
-     261,   219,   219,   216,   324,     6,    68,   235,   283,   286,
-       6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-     219,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,   219,     6,     6,     6,     6,     6,     6,     6,     6,
+      97,   219,   219,   219,   219,   219,   219,   219,   219,   219,
+     219,    97,   219,   219,   219,   219,   219,   219,   219,   219,
+     219,   219,    97,   219,   308,   216,   336,     3,   216,     6,
+     219,   219,   264,   219,   219,   216,   327,     6,    68,   236,
+     286,   289,     6,     6,     6,     6,     6,     6,     6,     6,
        6,     6,   219,     6,     6,     6,     6,     6,     6,     6,
        6,     6,     6,   219,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     6,   219,     6,     6,     6,     6,     6,
-       6,     6,     6,     6,     6,   219,     6,   216,   331,     4,
-       4,   216,     4,     4,   216,     6,   286,   216,   216,   216,
-     216,   216,   216,   216,   216,   216,   216,   216,     6,   216,
-     216,   216,   216,   216,   216,   216,   216,   216,   216,     6,
+       6,     6,     6,     6,     6,   219,     6,     6,     6,     6,
+       6,     6,     6,     6,     6,     6,   219,     6,     6,     6,
+       6,     6,     6,     6,     6,     6,     6,   219,     6,   216,
+     334,     4,     4,   216,     4,     4,   216,     6,   289,   216,
      216,   216,   216,   216,   216,   216,   216,   216,   216,   216,
        6,   216,   216,   216,   216,   216,   216,   216,   216,   216,
      216,     6,   216,   216,   216,   216,   216,   216,   216,   216,
      216,   216,     6,   216,   216,   216,   216,   216,   216,   216,
-     216,   216,   216,     6,   216,   219,   261,   219,   219,   261,
-      46,    50,    51,    55,    56,   216,   216,   216,   216,   216,
-     216,     4,   216,     4,     6,   216,     6,     6,   219,   261,
-     219,   261,   331,     6,    52,    53,     6,   216,     4,   216,
-      50,    51,     6,   261,   331,   261,   131,   168,   331,     6,
-      55,   216,   216,    46,    46,   131,   168,   331,   215,    46,
-      46,     3,   215,   216,     3,   331,   216,   331
+     216,   216,   216,     6,   216,   216,   216,   216,   216,   216,
+     216,   216,   216,   216,     6,   216,   216,   216,   216,   216,
+     216,   216,   216,   216,   216,     6,   216,   219,   264,   219,
+     219,   264,    46,    50,    51,    55,    56,   216,   216,   216,
+     216,   216,   216,     4,   216,     4,     6,   216,     6,     6,
+     219,   264,   219,   264,   334,     6,    52,    53,     6,   216,
+       4,   216,    50,    51,     6,   264,   334,   264,   131,   168,
+     334,     6,    55,   216,   216,    46,    46,   131,   168,   334,
+     215,    46,    46,     3,   215,   216,     3,   334,   216,   334
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int16 yyr1[] =
 {
-       0,   221,   222,   223,   223,   224,   224,   224,   224,   224,
-     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
+       0,   222,   223,   224,   224,   225,   225,   225,   225,   225,
      225,   225,   225,   225,   225,   225,   225,   225,   225,   225,
-     225,   225,   226,   226,   226,   226,   226,   226,   227,   227,
-     228,   228,   229,   229,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,   230,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,   230,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,   230,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,   230,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,   230,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,   230,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,   230,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,   230,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,   230,   230,   230,   231,   231,   232,   232,
-     232,   232,   233,   233,   234,   234,   235,   235,   236,   237,
-     237,   238,   238,   239,   240,   240,   240,   240,   240,   240,
-     240,   240,   241,   242,   242,   243,   244,   244,   244,   244,
-     244,   245,   245,   245,   246,   246,   246,   246,   247,   247,
-     248,   249,   250,   250,   251,   252,   252,   253,   253,   254,
-     255,   255,   255,   256,   256,   257,   257,   258,   258,   259,
-     259,   260,   260,   261,   261,   262,   262,   263,   263,   264,
-     264,   265,   265,   265,   265,   266,   266,   267,   267,   268,
-     268,   269,   269,   270,   270,   270,   270,   271,   271,   272,
-     272,   273,   274,   274,   275,   275,   275,   275,   275,   275,
-     275,   276,   276,   276,   276,   276,   276,   276,   276,   276,
-     276,   276,   276,   276,   276,   276,   276,   276,   276,   276,
-     276,   276,   276,   276,   276,   276,   276,   276,   276,   276,
-     276,   276,   276,   276,   276,   276,   276,   276,   277,   277,
-     277,   278,   278,   279,   279,   279,   279,   279,   279,   279,
+     225,   225,   226,   226,   226,   226,   226,   226,   226,   226,
+     226,   226,   226,   226,   227,   227,   227,   227,   227,   227,
+     228,   228,   229,   229,   230,   230,   231,   231,   231,   231,
+     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
+     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
+     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
+     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
+     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
+     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
+     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
+     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
+     231,   231,   231,   231,   231,   231,   231,   231,   232,   232,
+     233,   233,   233,   233,   234,   234,   235,   235,   236,   236,
+     237,   238,   238,   239,   239,   240,   241,   241,   241,   241,
+     241,   241,   241,   241,   242,   243,   243,   244,   245,   245,
+     246,   247,   247,   247,   247,   247,   248,   248,   248,   249,
+     249,   249,   249,   250,   250,   251,   252,   253,   253,   254,
+     255,   255,   256,   256,   257,   258,   258,   258,   259,   259,
+     260,   260,   261,   261,   262,   262,   263,   263,   264,   264,
+     265,   265,   266,   266,   267,   267,   268,   268,   268,   268,
+     269,   269,   270,   270,   271,   271,   272,   272,   273,   273,
+     273,   273,   274,   274,   275,   275,   276,   277,   277,   278,
+     278,   278,   278,   278,   278,   278,   279,   279,   279,   279,
      279,   279,   279,   279,   279,   279,   279,   279,   279,   279,
-     279,   279,   280,   281,   281,   281,   281,   281,   281,   281,
-     281,   281,   281,   281,   281,   281,   281,   281,   281,   281,
-     281,   281,   281,   281,   281,   281,   281,   281,   281,   281,
-     281,   281,   281,   281,   282,   282,   282,   282,   282,   283,
-     283,   284,   284,   285,   285,   286,   286,   286,   286,   286,
-     287,   287,   287,   287,   287,   287,   287,   287,   287,   287,
-     287,   287,   287,   288,   289,   289,   289,   289,   290,   290,
-     290,   290,   291,   291,   292,   292,   293,   293,   294,   294,
-     294,   294,   294,   294,   295,   295,   296,   296,   296,   296,
-     296,   296,   296,   296,   296,   296,   296,   296,   296,   296,
-     296,   296,   296,   296,   296,   296,   296,   296,   296,   297,
-     297,   298,   299,   299,   300,   300,   300,   300,   301,   301,
-     302,   303,   303,   303,   303,   304,   304,   304,   304,   305,
-     305,   305,   305,   305,   305,   305,   305,   305,   305,   305,
-     305,   306,   306,   306,   306,   307,   307,   307,   308,   309,
-     309,   310,   310,   311,   312,   312,   313,   314,   314,   315,
-     316,   317,   318,   318,   319,   320,   320,   321,   322,   322,
-     323,   323,   323,   323,   323,   323,   323,   323,   323,   323,
-     323,   323,   324,   324,   325,   325,   325,   325,   325,   325,
-     326,   327,   327,   328,   328,   329,   329,   330,   330,   331,
-     331,   332,   332,   333,   333,   334,   334,   334,   334,   334,
-     335,   335
+     279,   279,   279,   279,   279,   279,   279,   279,   279,   279,
+     279,   279,   279,   279,   279,   279,   279,   279,   279,   279,
+     279,   279,   279,   279,   280,   280,   280,   281,   281,   282,
+     282,   282,   282,   282,   282,   282,   282,   282,   282,   282,
+     282,   282,   282,   282,   282,   282,   282,   282,   282,   282,
+     283,   284,   284,   284,   284,   284,   284,   284,   284,   284,
+     284,   284,   284,   284,   284,   284,   284,   284,   284,   284,
+     284,   284,   284,   284,   284,   284,   284,   284,   284,   284,
+     284,   284,   285,   285,   285,   285,   285,   286,   286,   287,
+     287,   288,   288,   289,   289,   289,   289,   289,   290,   290,
+     290,   290,   290,   290,   290,   290,   290,   290,   290,   290,
+     290,   290,   291,   292,   292,   292,   292,   293,   293,   293,
+     293,   294,   294,   295,   295,   296,   296,   297,   297,   297,
+     297,   297,   297,   298,   298,   299,   299,   299,   299,   299,
+     299,   299,   299,   299,   299,   299,   299,   299,   299,   299,
+     299,   299,   299,   299,   299,   299,   299,   299,   300,   300,
+     301,   302,   302,   303,   303,   303,   303,   304,   304,   305,
+     306,   306,   306,   306,   307,   307,   307,   307,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     309,   309,   309,   309,   310,   310,   310,   311,   312,   312,
+     313,   313,   314,   315,   315,   316,   317,   317,   318,   319,
+     320,   321,   321,   322,   323,   323,   324,   325,   325,   326,
+     326,   326,   326,   326,   326,   326,   326,   326,   326,   326,
+     326,   327,   327,   328,   328,   328,   328,   328,   328,   328,
+     329,   330,   330,   331,   331,   332,   332,   333,   333,   334,
+     334,   335,   335,   336,   336,   337,   337,   337,   337,   337,
+     338,   338
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
@@ -1768,52 +1778,53 @@ static const yytype_int8 yyr2[] =
        0,     2,     2,     1,     3,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     4,     4,     8,     6,     7,     6,     1,     3,
-       1,     1,     4,     4,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     4,     4,     8,     6,     7,     6,
+       1,     3,     1,     1,     4,     4,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     6,     4,     1,
-       6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       7,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,     7,     6,     6,     6,     6,     6,     6,     6,     6,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     6,
+       4,     1,     6,     6,     6,     6,     6,     6,     6,     6,
        6,     6,     7,     6,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     7,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     7,     6,     6,     6,     6,     6,
-       6,     6,     6,     6,     6,     7,     1,     2,     2,     1,
-       1,     2,     2,     0,     5,     4,     1,     3,     4,     6,
-       5,     3,     0,     3,     1,     1,     1,     1,     1,     1,
-       1,     0,     5,     1,     3,     3,     4,     4,     4,     4,
-       6,     8,    11,     8,     1,     1,     3,     3,     3,     3,
-       2,     4,     3,     3,     8,     3,     0,     1,     3,     2,
-       1,     1,     0,     2,     0,     2,     0,     1,     0,     2,
-       0,     2,     0,     3,     0,     2,     0,     2,     0,     3,
-       0,     1,     2,     1,     1,     1,     3,     1,     1,     2,
-       4,     1,     3,     2,     1,     5,     0,     2,     0,     1,
-       3,     5,     4,     6,     1,     1,     1,     1,     1,     1,
-       0,     2,     2,     2,     2,     3,     2,     2,     2,     2,
-       4,     2,     3,     3,     3,     4,     4,     3,     3,     4,
-       4,     5,     6,     7,     9,     4,     5,     7,     9,     2,
-       3,     2,     3,     3,     4,     2,     3,     3,     2,     2,
-       2,     2,     5,     2,     4,     4,     4,     4,     4,     4,
+       6,     6,     6,     6,     6,     7,     6,     6,     6,     6,
+       6,     6,     6,     6,     6,     6,     7,     6,     6,     6,
+       6,     6,     6,     6,     6,     6,     6,     7,     1,     2,
+       2,     1,     1,     2,     2,     0,     5,     4,     1,     3,
+       4,     6,     5,     3,     0,     3,     1,     1,     1,     1,
+       1,     1,     1,     0,     4,     2,     5,     5,     1,     3,
+       3,     4,     4,     4,     4,     6,     8,    11,     8,     1,
+       1,     3,     3,     3,     3,     2,     4,     3,     3,     8,
+       3,     0,     1,     3,     2,     1,     1,     0,     2,     0,
+       2,     0,     1,     0,     2,     0,     2,     0,     3,     0,
+       2,     0,     2,     0,     3,     0,     1,     2,     1,     1,
+       1,     3,     1,     1,     2,     4,     1,     3,     2,     1,
+       5,     0,     2,     0,     1,     3,     5,     4,     6,     1,
+       1,     1,     1,     1,     1,     0,     2,     2,     2,     2,
+       3,     2,     2,     2,     3,     2,     4,     2,     3,     3,
+       3,     4,     4,     3,     3,     4,     4,     5,     6,     7,
+       9,     4,     5,     7,     9,     2,     3,     2,     3,     3,
+       4,     2,     3,     3,     2,     2,     2,     2,     5,     2,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       3,     3,     3,     3,     4,     6,     7,     9,    10,    12,
-      12,    13,    14,    15,    16,    12,    13,    15,    16,     3,
-       4,     5,     6,     3,     3,     4,     3,     4,     3,     3,
-       3,     5,     7,     7,     6,     6,     6,     6,     8,     1,
-       3,     3,     5,     3,     1,     1,     1,     1,     1,     1,
-       3,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,    14,    20,    16,    15,    13,    18,    14,
-      13,    11,     8,    10,     5,     7,     4,     6,     1,     1,
-       1,     1,     1,     1,     1,     3,     3,     4,     5,     4,
-       3,     2,     2,     2,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     6,     3,     4,     3,
-       3,     5,     5,     6,     4,     6,     3,     5,     4,     5,
-       6,     4,     5,     5,     6,     1,     3,     1,     3,     1,
-       1,     1,     1,     1,     2,     2,     2,     2,     2,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     2,     2,
+       4,     4,     4,     4,     4,     4,     3,     3,     3,     4,
+       3,     3,     4,     6,     7,     9,    10,    12,    12,    13,
+      14,    15,    16,    12,    13,    15,    16,     3,     4,     5,
+       6,     3,     3,     4,     3,     4,     3,     3,     3,     5,
+       7,     7,     6,     6,     6,     6,     8,     1,     3,     3,
+       5,     3,     1,     1,     1,     1,     1,     1,     3,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,    14,    20,    16,    15,    13,    18,    14,    13,
+      11,     8,    10,     5,     7,     4,     6,     1,     1,     1,
+       1,     1,     1,     1,     3,     3,     4,     5,     4,     3,
+       2,     2,     2,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     6,     3,     4,     3,     3,
+       5,     5,     6,     4,     6,     3,     5,     4,     5,     6,
+       4,     5,     5,     6,     1,     3,     1,     3,     1,     1,
+       1,     1,     1,     2,     2,     2,     2,     2,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     2,     2,     3,
+       1,     1,     2,     2,     3,     2,     2,     3,     2,     3,
        3,     1,     1,     2,     2,     3,     2,     2,     3,     2,
-       3,     3,     1,     1,     2,     2,     3,     2,     2,     3,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     1,     3,     2,     2,     1,     2,     2,     2,
+       2,     1,     3,     2,     2,     1,     2,     2,     2,     2,
        1,     2,     0,     3,     0,     1,     0,     2,     0,     4,
        0,     4,     0,     1,     3,     1,     3,     3,     3,     3,
        6,     3
@@ -2384,7 +2395,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2388 "parser.cpp"
+#line 2399 "parser.cpp"
         break;
 
     case YYSYMBOL_STRING: /* STRING  */
@@ -2392,7 +2403,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2396 "parser.cpp"
+#line 2407 "parser.cpp"
         break;
 
     case YYSYMBOL_statement_list: /* statement_list  */
@@ -2406,7 +2417,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).stmt_array));
     }
 }
-#line 2410 "parser.cpp"
+#line 2421 "parser.cpp"
         break;
 
     case YYSYMBOL_table_element_array: /* table_element_array  */
@@ -2420,7 +2431,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_element_array_t));
     }
 }
-#line 2424 "parser.cpp"
+#line 2435 "parser.cpp"
         break;
 
     case YYSYMBOL_column_constraints: /* column_constraints  */
@@ -2431,7 +2442,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).column_constraints_t));
     }
 }
-#line 2435 "parser.cpp"
+#line 2446 "parser.cpp"
         break;
 
     case YYSYMBOL_default_expr: /* default_expr  */
@@ -2439,7 +2450,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2443 "parser.cpp"
+#line 2454 "parser.cpp"
         break;
 
     case YYSYMBOL_identifier_array: /* identifier_array  */
@@ -2448,7 +2459,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2452 "parser.cpp"
+#line 2463 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_identifier_array: /* optional_identifier_array  */
@@ -2457,7 +2468,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2461 "parser.cpp"
+#line 2472 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr_array: /* update_expr_array  */
@@ -2471,7 +2482,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).update_expr_array_t));
     }
 }
-#line 2475 "parser.cpp"
+#line 2486 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr: /* update_expr  */
@@ -2482,7 +2493,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).update_expr_t);
     }
 }
-#line 2486 "parser.cpp"
+#line 2497 "parser.cpp"
         break;
 
     case YYSYMBOL_select_statement: /* select_statement  */
@@ -2492,7 +2503,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2496 "parser.cpp"
+#line 2507 "parser.cpp"
         break;
 
     case YYSYMBOL_select_with_paren: /* select_with_paren  */
@@ -2502,7 +2513,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2506 "parser.cpp"
+#line 2517 "parser.cpp"
         break;
 
     case YYSYMBOL_select_without_paren: /* select_without_paren  */
@@ -2512,7 +2523,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2516 "parser.cpp"
+#line 2527 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_with_modifier: /* select_clause_with_modifier  */
@@ -2522,7 +2533,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2526 "parser.cpp"
+#line 2537 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier_paren: /* select_clause_without_modifier_paren  */
@@ -2532,7 +2543,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2536 "parser.cpp"
+#line 2547 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier: /* select_clause_without_modifier  */
@@ -2542,7 +2553,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2546 "parser.cpp"
+#line 2557 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_clause: /* order_by_clause  */
@@ -2556,7 +2567,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2560 "parser.cpp"
+#line 2571 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr_list: /* order_by_expr_list  */
@@ -2570,7 +2581,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2574 "parser.cpp"
+#line 2585 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr: /* order_by_expr  */
@@ -2580,7 +2591,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).order_by_expr_t)->expr_;
     delete ((*yyvaluep).order_by_expr_t);
 }
-#line 2584 "parser.cpp"
+#line 2595 "parser.cpp"
         break;
 
     case YYSYMBOL_limit_expr: /* limit_expr  */
@@ -2588,7 +2599,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2592 "parser.cpp"
+#line 2603 "parser.cpp"
         break;
 
     case YYSYMBOL_offset_expr: /* offset_expr  */
@@ -2596,7 +2607,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2600 "parser.cpp"
+#line 2611 "parser.cpp"
         break;
 
     case YYSYMBOL_from_clause: /* from_clause  */
@@ -2605,7 +2616,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2609 "parser.cpp"
+#line 2620 "parser.cpp"
         break;
 
     case YYSYMBOL_search_clause: /* search_clause  */
@@ -2613,7 +2624,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2617 "parser.cpp"
+#line 2628 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_search_filter_expr: /* optional_search_filter_expr  */
@@ -2621,7 +2632,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2625 "parser.cpp"
+#line 2636 "parser.cpp"
         break;
 
     case YYSYMBOL_where_clause: /* where_clause  */
@@ -2629,7 +2640,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2633 "parser.cpp"
+#line 2644 "parser.cpp"
         break;
 
     case YYSYMBOL_having_clause: /* having_clause  */
@@ -2637,7 +2648,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2641 "parser.cpp"
+#line 2652 "parser.cpp"
         break;
 
     case YYSYMBOL_group_by_clause: /* group_by_clause  */
@@ -2651,7 +2662,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2655 "parser.cpp"
+#line 2666 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference: /* table_reference  */
@@ -2660,7 +2671,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2664 "parser.cpp"
+#line 2675 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_unit: /* table_reference_unit  */
@@ -2669,7 +2680,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2673 "parser.cpp"
+#line 2684 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_name: /* table_reference_name  */
@@ -2678,7 +2689,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2682 "parser.cpp"
+#line 2693 "parser.cpp"
         break;
 
     case YYSYMBOL_table_name: /* table_name  */
@@ -2691,7 +2702,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_name_t));
     }
 }
-#line 2695 "parser.cpp"
+#line 2706 "parser.cpp"
         break;
 
     case YYSYMBOL_table_alias: /* table_alias  */
@@ -2700,7 +2711,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table alias\n");
     delete (((*yyvaluep).table_alias_t));
 }
-#line 2704 "parser.cpp"
+#line 2715 "parser.cpp"
         break;
 
     case YYSYMBOL_with_clause: /* with_clause  */
@@ -2714,7 +2725,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2718 "parser.cpp"
+#line 2729 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr_list: /* with_expr_list  */
@@ -2728,7 +2739,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2732 "parser.cpp"
+#line 2743 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr: /* with_expr  */
@@ -2738,7 +2749,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).with_expr_t)->select_;
     delete ((*yyvaluep).with_expr_t);
 }
-#line 2742 "parser.cpp"
+#line 2753 "parser.cpp"
         break;
 
     case YYSYMBOL_join_clause: /* join_clause  */
@@ -2747,7 +2758,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2751 "parser.cpp"
+#line 2762 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_array: /* expr_array  */
@@ -2761,7 +2772,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2765 "parser.cpp"
+#line 2776 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_array_list: /* expr_array_list  */
@@ -2778,7 +2789,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_list_t));
     }
 }
-#line 2782 "parser.cpp"
+#line 2793 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_alias: /* expr_alias  */
@@ -2786,7 +2797,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2790 "parser.cpp"
+#line 2801 "parser.cpp"
         break;
 
     case YYSYMBOL_expr: /* expr  */
@@ -2794,7 +2805,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2798 "parser.cpp"
+#line 2809 "parser.cpp"
         break;
 
     case YYSYMBOL_operand: /* operand  */
@@ -2802,7 +2813,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2806 "parser.cpp"
+#line 2817 "parser.cpp"
         break;
 
     case YYSYMBOL_match_tensor_expr: /* match_tensor_expr  */
@@ -2810,7 +2821,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2814 "parser.cpp"
+#line 2825 "parser.cpp"
         break;
 
     case YYSYMBOL_match_vector_expr: /* match_vector_expr  */
@@ -2818,7 +2829,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2822 "parser.cpp"
+#line 2833 "parser.cpp"
         break;
 
     case YYSYMBOL_match_sparse_expr: /* match_sparse_expr  */
@@ -2826,7 +2837,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2830 "parser.cpp"
+#line 2841 "parser.cpp"
         break;
 
     case YYSYMBOL_match_text_expr: /* match_text_expr  */
@@ -2834,7 +2845,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2838 "parser.cpp"
+#line 2849 "parser.cpp"
         break;
 
     case YYSYMBOL_query_expr: /* query_expr  */
@@ -2842,7 +2853,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2846 "parser.cpp"
+#line 2857 "parser.cpp"
         break;
 
     case YYSYMBOL_fusion_expr: /* fusion_expr  */
@@ -2850,7 +2861,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2854 "parser.cpp"
+#line 2865 "parser.cpp"
         break;
 
     case YYSYMBOL_sub_search: /* sub_search  */
@@ -2858,7 +2869,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2862 "parser.cpp"
+#line 2873 "parser.cpp"
         break;
 
     case YYSYMBOL_sub_search_array: /* sub_search_array  */
@@ -2872,7 +2883,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2876 "parser.cpp"
+#line 2887 "parser.cpp"
         break;
 
     case YYSYMBOL_function_expr: /* function_expr  */
@@ -2880,7 +2891,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2884 "parser.cpp"
+#line 2895 "parser.cpp"
         break;
 
     case YYSYMBOL_conjunction_expr: /* conjunction_expr  */
@@ -2888,7 +2899,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2892 "parser.cpp"
+#line 2903 "parser.cpp"
         break;
 
     case YYSYMBOL_between_expr: /* between_expr  */
@@ -2896,7 +2907,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2900 "parser.cpp"
+#line 2911 "parser.cpp"
         break;
 
     case YYSYMBOL_in_expr: /* in_expr  */
@@ -2904,7 +2915,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2908 "parser.cpp"
+#line 2919 "parser.cpp"
         break;
 
     case YYSYMBOL_case_expr: /* case_expr  */
@@ -2912,7 +2923,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2916 "parser.cpp"
+#line 2927 "parser.cpp"
         break;
 
     case YYSYMBOL_case_check_array: /* case_check_array  */
@@ -2925,7 +2936,7 @@ yydestruct (const char *yymsg,
         }
     }
 }
-#line 2929 "parser.cpp"
+#line 2940 "parser.cpp"
         break;
 
     case YYSYMBOL_cast_expr: /* cast_expr  */
@@ -2933,7 +2944,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2937 "parser.cpp"
+#line 2948 "parser.cpp"
         break;
 
     case YYSYMBOL_subquery_expr: /* subquery_expr  */
@@ -2941,7 +2952,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2945 "parser.cpp"
+#line 2956 "parser.cpp"
         break;
 
     case YYSYMBOL_column_expr: /* column_expr  */
@@ -2949,7 +2960,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2953 "parser.cpp"
+#line 2964 "parser.cpp"
         break;
 
     case YYSYMBOL_constant_expr: /* constant_expr  */
@@ -2957,7 +2968,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2961 "parser.cpp"
+#line 2972 "parser.cpp"
         break;
 
     case YYSYMBOL_common_array_expr: /* common_array_expr  */
@@ -2965,7 +2976,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2969 "parser.cpp"
+#line 2980 "parser.cpp"
         break;
 
     case YYSYMBOL_common_sparse_array_expr: /* common_sparse_array_expr  */
@@ -2973,7 +2984,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2977 "parser.cpp"
+#line 2988 "parser.cpp"
         break;
 
     case YYSYMBOL_subarray_array_expr: /* subarray_array_expr  */
@@ -2981,7 +2992,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2985 "parser.cpp"
+#line 2996 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_subarray_array_expr: /* unclosed_subarray_array_expr  */
@@ -2989,7 +3000,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2993 "parser.cpp"
+#line 3004 "parser.cpp"
         break;
 
     case YYSYMBOL_sparse_array_expr: /* sparse_array_expr  */
@@ -2997,7 +3008,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3001 "parser.cpp"
+#line 3012 "parser.cpp"
         break;
 
     case YYSYMBOL_long_sparse_array_expr: /* long_sparse_array_expr  */
@@ -3005,7 +3016,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3009 "parser.cpp"
+#line 3020 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_long_sparse_array_expr: /* unclosed_long_sparse_array_expr  */
@@ -3013,7 +3024,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3017 "parser.cpp"
+#line 3028 "parser.cpp"
         break;
 
     case YYSYMBOL_double_sparse_array_expr: /* double_sparse_array_expr  */
@@ -3021,7 +3032,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3025 "parser.cpp"
+#line 3036 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_double_sparse_array_expr: /* unclosed_double_sparse_array_expr  */
@@ -3029,7 +3040,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3033 "parser.cpp"
+#line 3044 "parser.cpp"
         break;
 
     case YYSYMBOL_empty_array_expr: /* empty_array_expr  */
@@ -3037,7 +3048,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3041 "parser.cpp"
+#line 3052 "parser.cpp"
         break;
 
     case YYSYMBOL_int_sparse_ele: /* int_sparse_ele  */
@@ -3045,7 +3056,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).int_sparse_ele_t));
 }
-#line 3049 "parser.cpp"
+#line 3060 "parser.cpp"
         break;
 
     case YYSYMBOL_float_sparse_ele: /* float_sparse_ele  */
@@ -3053,7 +3064,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).float_sparse_ele_t));
 }
-#line 3057 "parser.cpp"
+#line 3068 "parser.cpp"
         break;
 
     case YYSYMBOL_array_expr: /* array_expr  */
@@ -3061,7 +3072,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3065 "parser.cpp"
+#line 3076 "parser.cpp"
         break;
 
     case YYSYMBOL_long_array_expr: /* long_array_expr  */
@@ -3069,7 +3080,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3073 "parser.cpp"
+#line 3084 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_long_array_expr: /* unclosed_long_array_expr  */
@@ -3077,7 +3088,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3081 "parser.cpp"
+#line 3092 "parser.cpp"
         break;
 
     case YYSYMBOL_double_array_expr: /* double_array_expr  */
@@ -3085,7 +3096,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3089 "parser.cpp"
+#line 3100 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_double_array_expr: /* unclosed_double_array_expr  */
@@ -3093,7 +3104,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3097 "parser.cpp"
+#line 3108 "parser.cpp"
         break;
 
     case YYSYMBOL_interval_expr: /* interval_expr  */
@@ -3101,7 +3112,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3105 "parser.cpp"
+#line 3116 "parser.cpp"
         break;
 
     case YYSYMBOL_file_path: /* file_path  */
@@ -3109,7 +3120,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 3113 "parser.cpp"
+#line 3124 "parser.cpp"
         break;
 
     case YYSYMBOL_if_not_exists_info: /* if_not_exists_info  */
@@ -3120,7 +3131,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).if_not_exists_info_t));
     }
 }
-#line 3124 "parser.cpp"
+#line 3135 "parser.cpp"
         break;
 
     case YYSYMBOL_with_index_param_list: /* with_index_param_list  */
@@ -3134,7 +3145,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_index_param_list_t));
     }
 }
-#line 3138 "parser.cpp"
+#line 3149 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_table_properties_list: /* optional_table_properties_list  */
@@ -3148,7 +3159,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_index_param_list_t));
     }
 }
-#line 3152 "parser.cpp"
+#line 3163 "parser.cpp"
         break;
 
     case YYSYMBOL_index_info: /* index_info  */
@@ -3159,7 +3170,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).index_info_t));
     }
 }
-#line 3163 "parser.cpp"
+#line 3174 "parser.cpp"
         break;
 
       default:
@@ -3267,7 +3278,7 @@ YYLTYPE yylloc = yyloc_default;
   yylloc.string_length = 0;
 }
 
-#line 3271 "parser.cpp"
+#line 3282 "parser.cpp"
 
   yylsp[0] = yylloc;
   goto yysetstate;
@@ -3478,199 +3489,213 @@ yyreduce:
   switch (yyn)
     {
   case 2: /* input_pattern: statement_list semicolon  */
-#line 495 "parser.y"
+#line 497 "parser.y"
                                          {
     result->statements_ptr_ = (yyvsp[-1].stmt_array);
 }
-#line 3486 "parser.cpp"
+#line 3497 "parser.cpp"
     break;
 
   case 3: /* statement_list: statement  */
-#line 499 "parser.y"
+#line 501 "parser.y"
                            {
     (yyvsp[0].base_stmt)->stmt_length_ = yylloc.string_length;
     yylloc.string_length = 0;
+    result->parameter_count_ = 0;
     (yyval.stmt_array) = new std::vector<infinity::BaseStatement*>();
     (yyval.stmt_array)->push_back((yyvsp[0].base_stmt));
 }
-#line 3497 "parser.cpp"
+#line 3509 "parser.cpp"
     break;
 
   case 4: /* statement_list: statement_list ';' statement  */
-#line 505 "parser.y"
+#line 508 "parser.y"
                                {
     (yyvsp[0].base_stmt)->stmt_length_ = yylloc.string_length;
     yylloc.string_length = 0;
+    result->parameter_count_ = 0;
     (yyvsp[-2].stmt_array)->push_back((yyvsp[0].base_stmt));
     (yyval.stmt_array) = (yyvsp[-2].stmt_array);
 }
-#line 3508 "parser.cpp"
+#line 3521 "parser.cpp"
     break;
 
   case 5: /* statement: create_statement  */
-#line 512 "parser.y"
+#line 516 "parser.y"
                              { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 3514 "parser.cpp"
+#line 3527 "parser.cpp"
     break;
 
   case 6: /* statement: drop_statement  */
-#line 513 "parser.y"
+#line 517 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 3520 "parser.cpp"
+#line 3533 "parser.cpp"
     break;
 
   case 7: /* statement: copy_statement  */
-#line 514 "parser.y"
+#line 518 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 3526 "parser.cpp"
+#line 3539 "parser.cpp"
     break;
 
   case 8: /* statement: show_statement  */
-#line 515 "parser.y"
+#line 519 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 3532 "parser.cpp"
+#line 3545 "parser.cpp"
     break;
 
   case 9: /* statement: select_statement  */
-#line 516 "parser.y"
+#line 520 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 3538 "parser.cpp"
+#line 3551 "parser.cpp"
     break;
 
   case 10: /* statement: delete_statement  */
-#line 517 "parser.y"
+#line 521 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 3544 "parser.cpp"
+#line 3557 "parser.cpp"
     break;
 
   case 11: /* statement: update_statement  */
-#line 518 "parser.y"
+#line 522 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 3550 "parser.cpp"
+#line 3563 "parser.cpp"
     break;
 
   case 12: /* statement: insert_statement  */
-#line 519 "parser.y"
+#line 523 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3556 "parser.cpp"
+#line 3569 "parser.cpp"
     break;
 
   case 13: /* statement: explain_statement  */
-#line 520 "parser.y"
+#line 524 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].explain_stmt); }
-#line 3562 "parser.cpp"
+#line 3575 "parser.cpp"
     break;
 
   case 14: /* statement: flush_statement  */
-#line 521 "parser.y"
+#line 525 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3568 "parser.cpp"
+#line 3581 "parser.cpp"
     break;
 
   case 15: /* statement: optimize_statement  */
-#line 522 "parser.y"
+#line 526 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3574 "parser.cpp"
+#line 3587 "parser.cpp"
     break;
 
   case 16: /* statement: command_statement  */
-#line 523 "parser.y"
+#line 527 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3580 "parser.cpp"
+#line 3593 "parser.cpp"
     break;
 
   case 17: /* statement: compact_statement  */
-#line 524 "parser.y"
+#line 528 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].compact_stmt); }
-#line 3586 "parser.cpp"
+#line 3599 "parser.cpp"
     break;
 
   case 18: /* statement: admin_statement  */
-#line 525 "parser.y"
+#line 529 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].admin_stmt); }
-#line 3592 "parser.cpp"
+#line 3605 "parser.cpp"
     break;
 
   case 19: /* statement: alter_statement  */
-#line 526 "parser.y"
+#line 530 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].alter_stmt); }
-#line 3598 "parser.cpp"
+#line 3611 "parser.cpp"
     break;
 
-  case 20: /* explainable_statement: create_statement  */
-#line 528 "parser.y"
+  case 20: /* statement: prepare_statement  */
+#line 531 "parser.y"
+                    { (yyval.base_stmt) = (yyvsp[0].prepare_stmt); }
+#line 3617 "parser.cpp"
+    break;
+
+  case 21: /* statement: execute_statement  */
+#line 532 "parser.y"
+                    { (yyval.base_stmt) = (yyvsp[0].execute_stmt); }
+#line 3623 "parser.cpp"
+    break;
+
+  case 22: /* explainable_statement: create_statement  */
+#line 534 "parser.y"
                                          { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 3604 "parser.cpp"
+#line 3629 "parser.cpp"
     break;
 
-  case 21: /* explainable_statement: drop_statement  */
-#line 529 "parser.y"
+  case 23: /* explainable_statement: drop_statement  */
+#line 535 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 3610 "parser.cpp"
+#line 3635 "parser.cpp"
     break;
 
-  case 22: /* explainable_statement: copy_statement  */
-#line 530 "parser.y"
+  case 24: /* explainable_statement: copy_statement  */
+#line 536 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 3616 "parser.cpp"
+#line 3641 "parser.cpp"
     break;
 
-  case 23: /* explainable_statement: show_statement  */
-#line 531 "parser.y"
+  case 25: /* explainable_statement: show_statement  */
+#line 537 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 3622 "parser.cpp"
+#line 3647 "parser.cpp"
     break;
 
-  case 24: /* explainable_statement: select_statement  */
-#line 532 "parser.y"
+  case 26: /* explainable_statement: select_statement  */
+#line 538 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 3628 "parser.cpp"
+#line 3653 "parser.cpp"
     break;
 
-  case 25: /* explainable_statement: delete_statement  */
-#line 533 "parser.y"
+  case 27: /* explainable_statement: delete_statement  */
+#line 539 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 3634 "parser.cpp"
+#line 3659 "parser.cpp"
     break;
 
-  case 26: /* explainable_statement: update_statement  */
-#line 534 "parser.y"
+  case 28: /* explainable_statement: update_statement  */
+#line 540 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 3640 "parser.cpp"
+#line 3665 "parser.cpp"
     break;
 
-  case 27: /* explainable_statement: insert_statement  */
-#line 535 "parser.y"
+  case 29: /* explainable_statement: insert_statement  */
+#line 541 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3646 "parser.cpp"
+#line 3671 "parser.cpp"
     break;
 
-  case 28: /* explainable_statement: flush_statement  */
-#line 536 "parser.y"
+  case 30: /* explainable_statement: flush_statement  */
+#line 542 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3652 "parser.cpp"
+#line 3677 "parser.cpp"
     break;
 
-  case 29: /* explainable_statement: optimize_statement  */
-#line 537 "parser.y"
+  case 31: /* explainable_statement: optimize_statement  */
+#line 543 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3658 "parser.cpp"
+#line 3683 "parser.cpp"
     break;
 
-  case 30: /* explainable_statement: command_statement  */
-#line 538 "parser.y"
+  case 32: /* explainable_statement: command_statement  */
+#line 544 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3664 "parser.cpp"
+#line 3689 "parser.cpp"
     break;
 
-  case 31: /* explainable_statement: compact_statement  */
-#line 539 "parser.y"
+  case 33: /* explainable_statement: compact_statement  */
+#line 545 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].compact_stmt); }
-#line 3670 "parser.cpp"
+#line 3695 "parser.cpp"
     break;
 
-  case 32: /* create_statement: CREATE DATABASE if_not_exists IDENTIFIER  */
-#line 546 "parser.y"
+  case 34: /* create_statement: CREATE DATABASE if_not_exists IDENTIFIER  */
+#line 552 "parser.y"
                                                             {
     (yyval.create_stmt) = new infinity::CreateStatement();
     std::shared_ptr<infinity::CreateSchemaInfo> create_schema_info = std::make_shared<infinity::CreateSchemaInfo>();
@@ -3686,11 +3711,11 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_schema_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3690 "parser.cpp"
+#line 3715 "parser.cpp"
     break;
 
-  case 33: /* create_statement: CREATE COLLECTION if_not_exists table_name  */
-#line 563 "parser.y"
+  case 35: /* create_statement: CREATE COLLECTION if_not_exists table_name  */
+#line 569 "parser.y"
                                              {
     (yyval.create_stmt) = new infinity::CreateStatement();
     std::shared_ptr<infinity::CreateCollectionInfo> create_collection_info = std::make_shared<infinity::CreateCollectionInfo>();
@@ -3704,11 +3729,11 @@ yyreduce:
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 3708 "parser.cpp"
+#line 3733 "parser.cpp"
     break;
 
-  case 34: /* create_statement: CREATE TABLE if_not_exists table_name '(' table_element_array ')' optional_table_properties_list  */
-#line 579 "parser.y"
+  case 36: /* create_statement: CREATE TABLE if_not_exists table_name '(' table_element_array ')' optional_table_properties_list  */
+#line 585 "parser.y"
                                                                                                    {
     (yyval.create_stmt) = new infinity::CreateStatement();
     std::shared_ptr<infinity::CreateTableInfo> create_table_info = std::make_shared<infinity::CreateTableInfo>();
@@ -3737,11 +3762,11 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_table_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-5].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3741 "parser.cpp"
+#line 3766 "parser.cpp"
     break;
 
-  case 35: /* create_statement: CREATE TABLE if_not_exists table_name AS select_statement  */
-#line 608 "parser.y"
+  case 37: /* create_statement: CREATE TABLE if_not_exists table_name AS select_statement  */
+#line 614 "parser.y"
                                                             {
     (yyval.create_stmt) = new infinity::CreateStatement();
     std::shared_ptr<infinity::CreateTableInfo> create_table_info = std::make_shared<infinity::CreateTableInfo>();
@@ -3757,11 +3782,11 @@ yyreduce:
     create_table_info->select_ = (yyvsp[0].select_stmt);
     (yyval.create_stmt)->create_info_ = create_table_info;
 }
-#line 3761 "parser.cpp"
+#line 3786 "parser.cpp"
     break;
 
-  case 36: /* create_statement: CREATE VIEW if_not_exists table_name optional_identifier_array AS select_statement  */
-#line 624 "parser.y"
+  case 38: /* create_statement: CREATE VIEW if_not_exists table_name optional_identifier_array AS select_statement  */
+#line 630 "parser.y"
                                                                                      {
     (yyval.create_stmt) = new infinity::CreateStatement();
     std::shared_ptr<infinity::CreateViewInfo> create_view_info = std::make_shared<infinity::CreateViewInfo>();
@@ -3778,11 +3803,11 @@ yyreduce:
     create_view_info->conflict_type_ = (yyvsp[-4].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     (yyval.create_stmt)->create_info_ = create_view_info;
 }
-#line 3782 "parser.cpp"
+#line 3807 "parser.cpp"
     break;
 
-  case 37: /* create_statement: CREATE INDEX if_not_exists_info ON table_name index_info  */
-#line 642 "parser.y"
+  case 39: /* create_statement: CREATE INDEX if_not_exists_info ON table_name index_info  */
+#line 648 "parser.y"
                                                            {
     std::shared_ptr<infinity::CreateIndexInfo> create_index_info = std::make_shared<infinity::CreateIndexInfo>();
     if((yyvsp[-1].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -3811,45 +3836,45 @@ yyreduce:
     (yyval.create_stmt) = new infinity::CreateStatement();
     (yyval.create_stmt)->create_info_ = create_index_info;
 }
-#line 3815 "parser.cpp"
+#line 3840 "parser.cpp"
     break;
 
-  case 38: /* table_element_array: table_element  */
-#line 671 "parser.y"
+  case 40: /* table_element_array: table_element  */
+#line 677 "parser.y"
                                     {
     (yyval.table_element_array_t) = new std::vector<infinity::TableElement*>();
     (yyval.table_element_array_t)->push_back((yyvsp[0].table_element_t));
 }
-#line 3824 "parser.cpp"
+#line 3849 "parser.cpp"
     break;
 
-  case 39: /* table_element_array: table_element_array ',' table_element  */
-#line 675 "parser.y"
+  case 41: /* table_element_array: table_element_array ',' table_element  */
+#line 681 "parser.y"
                                         {
     (yyvsp[-2].table_element_array_t)->push_back((yyvsp[0].table_element_t));
     (yyval.table_element_array_t) = (yyvsp[-2].table_element_array_t);
 }
-#line 3833 "parser.cpp"
+#line 3858 "parser.cpp"
     break;
 
-  case 40: /* table_element: table_column  */
-#line 681 "parser.y"
+  case 42: /* table_element: table_column  */
+#line 687 "parser.y"
                              {
     (yyval.table_element_t) = (yyvsp[0].table_column_t);
 }
-#line 3841 "parser.cpp"
+#line 3866 "parser.cpp"
     break;
 
-  case 41: /* table_element: table_constraint  */
-#line 684 "parser.y"
+  case 43: /* table_element: table_constraint  */
+#line 690 "parser.y"
                    {
     (yyval.table_element_t) = (yyvsp[0].table_constraint_t);
 }
-#line 3849 "parser.cpp"
+#line 3874 "parser.cpp"
     break;
 
-  case 42: /* table_column: IDENTIFIER column_type with_index_param_list default_expr  */
-#line 691 "parser.y"
+  case 44: /* table_column: IDENTIFIER column_type with_index_param_list default_expr  */
+#line 697 "parser.y"
                                                           {
     std::shared_ptr<infinity::TypeInfo> type_info_ptr{nullptr};
     std::vector<std::unique_ptr<infinity::InitParameter>> index_param_list = infinity::InitParameter::MakeInitParameterList((yyvsp[-1].with_index_param_list_t));
@@ -3901,11 +3926,11 @@ yyreduce:
     }
     */
 }
-#line 3905 "parser.cpp"
+#line 3930 "parser.cpp"
     break;
 
-  case 43: /* table_column: IDENTIFIER column_type column_constraints default_expr  */
-#line 742 "parser.y"
+  case 45: /* table_column: IDENTIFIER column_type column_constraints default_expr  */
+#line 748 "parser.y"
                                                          {
     std::shared_ptr<infinity::TypeInfo> type_info_ptr{nullptr};
     switch((yyvsp[-2].column_type_t).logical_type_) {
@@ -3943,572 +3968,572 @@ yyreduce:
     }
     */
 }
-#line 3947 "parser.cpp"
+#line 3972 "parser.cpp"
     break;
 
-  case 44: /* column_type: BOOLEAN  */
-#line 781 "parser.y"
+  case 46: /* column_type: BOOLEAN  */
+#line 787 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3953 "parser.cpp"
+#line 3978 "parser.cpp"
     break;
 
-  case 45: /* column_type: TINYINT  */
-#line 782 "parser.y"
+  case 47: /* column_type: TINYINT  */
+#line 788 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTinyInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3959 "parser.cpp"
+#line 3984 "parser.cpp"
     break;
 
-  case 46: /* column_type: SMALLINT  */
-#line 783 "parser.y"
+  case 48: /* column_type: SMALLINT  */
+#line 789 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSmallInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3965 "parser.cpp"
+#line 3990 "parser.cpp"
     break;
 
-  case 47: /* column_type: INTEGER  */
-#line 784 "parser.y"
+  case 49: /* column_type: INTEGER  */
+#line 790 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3971 "parser.cpp"
+#line 3996 "parser.cpp"
     break;
 
-  case 48: /* column_type: INT  */
-#line 785 "parser.y"
+  case 50: /* column_type: INT  */
+#line 791 "parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3977 "parser.cpp"
+#line 4002 "parser.cpp"
     break;
 
-  case 49: /* column_type: BIGINT  */
-#line 786 "parser.y"
+  case 51: /* column_type: BIGINT  */
+#line 792 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBigInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3983 "parser.cpp"
+#line 4008 "parser.cpp"
     break;
 
-  case 50: /* column_type: HUGEINT  */
-#line 787 "parser.y"
+  case 52: /* column_type: HUGEINT  */
+#line 793 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kHugeInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3989 "parser.cpp"
+#line 4014 "parser.cpp"
     break;
 
-  case 51: /* column_type: FLOAT  */
-#line 788 "parser.y"
+  case 53: /* column_type: FLOAT  */
+#line 794 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3995 "parser.cpp"
+#line 4020 "parser.cpp"
     break;
 
-  case 52: /* column_type: REAL  */
-#line 789 "parser.y"
+  case 54: /* column_type: REAL  */
+#line 795 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4001 "parser.cpp"
+#line 4026 "parser.cpp"
     break;
 
-  case 53: /* column_type: DOUBLE  */
-#line 790 "parser.y"
+  case 55: /* column_type: DOUBLE  */
+#line 796 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDouble, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4007 "parser.cpp"
+#line 4032 "parser.cpp"
     break;
 
-  case 54: /* column_type: FLOAT16  */
-#line 791 "parser.y"
+  case 56: /* column_type: FLOAT16  */
+#line 797 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat16, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4013 "parser.cpp"
+#line 4038 "parser.cpp"
     break;
 
-  case 55: /* column_type: BFLOAT16  */
-#line 792 "parser.y"
+  case 57: /* column_type: BFLOAT16  */
+#line 798 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBFloat16, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4019 "parser.cpp"
+#line 4044 "parser.cpp"
     break;
 
-  case 56: /* column_type: DATE  */
-#line 793 "parser.y"
+  case 58: /* column_type: DATE  */
+#line 799 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDate, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4025 "parser.cpp"
+#line 4050 "parser.cpp"
     break;
 
-  case 57: /* column_type: TIME  */
-#line 794 "parser.y"
+  case 59: /* column_type: TIME  */
+#line 800 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4031 "parser.cpp"
+#line 4056 "parser.cpp"
     break;
 
-  case 58: /* column_type: DATETIME  */
-#line 795 "parser.y"
+  case 60: /* column_type: DATETIME  */
+#line 801 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDateTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4037 "parser.cpp"
+#line 4062 "parser.cpp"
     break;
 
-  case 59: /* column_type: TIMESTAMP  */
-#line 796 "parser.y"
+  case 61: /* column_type: TIMESTAMP  */
+#line 802 "parser.y"
             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTimestamp, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4043 "parser.cpp"
+#line 4068 "parser.cpp"
     break;
 
-  case 60: /* column_type: UUID  */
-#line 797 "parser.y"
+  case 62: /* column_type: UUID  */
+#line 803 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kUuid, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4049 "parser.cpp"
+#line 4074 "parser.cpp"
     break;
 
-  case 61: /* column_type: POINT  */
-#line 798 "parser.y"
+  case 63: /* column_type: POINT  */
+#line 804 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kPoint, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4055 "parser.cpp"
+#line 4080 "parser.cpp"
     break;
 
-  case 62: /* column_type: LINE  */
-#line 799 "parser.y"
+  case 64: /* column_type: LINE  */
+#line 805 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLine, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4061 "parser.cpp"
+#line 4086 "parser.cpp"
     break;
 
-  case 63: /* column_type: LSEG  */
-#line 800 "parser.y"
+  case 65: /* column_type: LSEG  */
+#line 806 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLineSeg, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4067 "parser.cpp"
+#line 4092 "parser.cpp"
     break;
 
-  case 64: /* column_type: BOX  */
-#line 801 "parser.y"
+  case 66: /* column_type: BOX  */
+#line 807 "parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBox, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4073 "parser.cpp"
+#line 4098 "parser.cpp"
     break;
 
-  case 65: /* column_type: CIRCLE  */
-#line 804 "parser.y"
+  case 67: /* column_type: CIRCLE  */
+#line 810 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kCircle, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4079 "parser.cpp"
+#line 4104 "parser.cpp"
     break;
 
-  case 66: /* column_type: VARCHAR  */
-#line 806 "parser.y"
+  case 68: /* column_type: VARCHAR  */
+#line 812 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kVarchar, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4085 "parser.cpp"
+#line 4110 "parser.cpp"
     break;
 
-  case 67: /* column_type: DECIMAL '(' LONG_VALUE ',' LONG_VALUE ')'  */
-#line 807 "parser.y"
+  case 69: /* column_type: DECIMAL '(' LONG_VALUE ',' LONG_VALUE ')'  */
+#line 813 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-3].long_value), (yyvsp[-1].long_value), infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4091 "parser.cpp"
+#line 4116 "parser.cpp"
     break;
 
-  case 68: /* column_type: DECIMAL '(' LONG_VALUE ')'  */
-#line 808 "parser.y"
+  case 70: /* column_type: DECIMAL '(' LONG_VALUE ')'  */
+#line 814 "parser.y"
                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-1].long_value), 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4097 "parser.cpp"
+#line 4122 "parser.cpp"
     break;
 
-  case 69: /* column_type: DECIMAL  */
-#line 809 "parser.y"
+  case 71: /* column_type: DECIMAL  */
+#line 815 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4103 "parser.cpp"
+#line 4128 "parser.cpp"
     break;
 
-  case 70: /* column_type: EMBEDDING '(' BIT ',' LONG_VALUE ')'  */
-#line 812 "parser.y"
+  case 72: /* column_type: EMBEDDING '(' BIT ',' LONG_VALUE ')'  */
+#line 818 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBit}; }
-#line 4109 "parser.cpp"
+#line 4134 "parser.cpp"
     break;
 
-  case 71: /* column_type: EMBEDDING '(' TINYINT ',' LONG_VALUE ')'  */
-#line 813 "parser.y"
+  case 73: /* column_type: EMBEDDING '(' TINYINT ',' LONG_VALUE ')'  */
+#line 819 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt8}; }
-#line 4115 "parser.cpp"
+#line 4140 "parser.cpp"
     break;
 
-  case 72: /* column_type: EMBEDDING '(' SMALLINT ',' LONG_VALUE ')'  */
-#line 814 "parser.y"
+  case 74: /* column_type: EMBEDDING '(' SMALLINT ',' LONG_VALUE ')'  */
+#line 820 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt16}; }
-#line 4121 "parser.cpp"
+#line 4146 "parser.cpp"
     break;
 
-  case 73: /* column_type: EMBEDDING '(' INTEGER ',' LONG_VALUE ')'  */
-#line 815 "parser.y"
+  case 75: /* column_type: EMBEDDING '(' INTEGER ',' LONG_VALUE ')'  */
+#line 821 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4127 "parser.cpp"
+#line 4152 "parser.cpp"
     break;
 
-  case 74: /* column_type: EMBEDDING '(' INT ',' LONG_VALUE ')'  */
-#line 816 "parser.y"
+  case 76: /* column_type: EMBEDDING '(' INT ',' LONG_VALUE ')'  */
+#line 822 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4133 "parser.cpp"
+#line 4158 "parser.cpp"
     break;
 
-  case 75: /* column_type: EMBEDDING '(' BIGINT ',' LONG_VALUE ')'  */
-#line 817 "parser.y"
+  case 77: /* column_type: EMBEDDING '(' BIGINT ',' LONG_VALUE ')'  */
+#line 823 "parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt64}; }
-#line 4139 "parser.cpp"
+#line 4164 "parser.cpp"
     break;
 
-  case 76: /* column_type: EMBEDDING '(' FLOAT ',' LONG_VALUE ')'  */
-#line 818 "parser.y"
+  case 78: /* column_type: EMBEDDING '(' FLOAT ',' LONG_VALUE ')'  */
+#line 824 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat}; }
-#line 4145 "parser.cpp"
+#line 4170 "parser.cpp"
     break;
 
-  case 77: /* column_type: EMBEDDING '(' DOUBLE ',' LONG_VALUE ')'  */
-#line 819 "parser.y"
+  case 79: /* column_type: EMBEDDING '(' DOUBLE ',' LONG_VALUE ')'  */
+#line 825 "parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemDouble}; }
-#line 4151 "parser.cpp"
+#line 4176 "parser.cpp"
     break;
 
-  case 78: /* column_type: EMBEDDING '(' FLOAT16 ',' LONG_VALUE ')'  */
-#line 820 "parser.y"
+  case 80: /* column_type: EMBEDDING '(' FLOAT16 ',' LONG_VALUE ')'  */
+#line 826 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat16}; }
-#line 4157 "parser.cpp"
+#line 4182 "parser.cpp"
     break;
 
-  case 79: /* column_type: EMBEDDING '(' BFLOAT16 ',' LONG_VALUE ')'  */
-#line 821 "parser.y"
+  case 81: /* column_type: EMBEDDING '(' BFLOAT16 ',' LONG_VALUE ')'  */
+#line 827 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBFloat16}; }
-#line 4163 "parser.cpp"
+#line 4188 "parser.cpp"
     break;
 
-  case 80: /* column_type: EMBEDDING '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
-#line 822 "parser.y"
+  case 82: /* column_type: EMBEDDING '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
+#line 828 "parser.y"
                                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemUInt8}; }
-#line 4169 "parser.cpp"
+#line 4194 "parser.cpp"
     break;
 
-  case 81: /* column_type: MULTIVECTOR '(' BIT ',' LONG_VALUE ')'  */
-#line 823 "parser.y"
+  case 83: /* column_type: MULTIVECTOR '(' BIT ',' LONG_VALUE ')'  */
+#line 829 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBit}; }
-#line 4175 "parser.cpp"
+#line 4200 "parser.cpp"
     break;
 
-  case 82: /* column_type: MULTIVECTOR '(' TINYINT ',' LONG_VALUE ')'  */
-#line 824 "parser.y"
+  case 84: /* column_type: MULTIVECTOR '(' TINYINT ',' LONG_VALUE ')'  */
+#line 830 "parser.y"
                                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt8}; }
-#line 4181 "parser.cpp"
+#line 4206 "parser.cpp"
     break;
 
-  case 83: /* column_type: MULTIVECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
-#line 825 "parser.y"
+  case 85: /* column_type: MULTIVECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
+#line 831 "parser.y"
                                               { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt16}; }
-#line 4187 "parser.cpp"
+#line 4212 "parser.cpp"
     break;
 
-  case 84: /* column_type: MULTIVECTOR '(' INTEGER ',' LONG_VALUE ')'  */
-#line 826 "parser.y"
+  case 86: /* column_type: MULTIVECTOR '(' INTEGER ',' LONG_VALUE ')'  */
+#line 832 "parser.y"
                                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4193 "parser.cpp"
+#line 4218 "parser.cpp"
     break;
 
-  case 85: /* column_type: MULTIVECTOR '(' INT ',' LONG_VALUE ')'  */
-#line 827 "parser.y"
+  case 87: /* column_type: MULTIVECTOR '(' INT ',' LONG_VALUE ')'  */
+#line 833 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4199 "parser.cpp"
+#line 4224 "parser.cpp"
     break;
 
-  case 86: /* column_type: MULTIVECTOR '(' BIGINT ',' LONG_VALUE ')'  */
-#line 828 "parser.y"
+  case 88: /* column_type: MULTIVECTOR '(' BIGINT ',' LONG_VALUE ')'  */
+#line 834 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt64}; }
-#line 4205 "parser.cpp"
+#line 4230 "parser.cpp"
     break;
 
-  case 87: /* column_type: MULTIVECTOR '(' FLOAT ',' LONG_VALUE ')'  */
-#line 829 "parser.y"
+  case 89: /* column_type: MULTIVECTOR '(' FLOAT ',' LONG_VALUE ')'  */
+#line 835 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat}; }
-#line 4211 "parser.cpp"
+#line 4236 "parser.cpp"
     break;
 
-  case 88: /* column_type: MULTIVECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
-#line 830 "parser.y"
+  case 90: /* column_type: MULTIVECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
+#line 836 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemDouble}; }
-#line 4217 "parser.cpp"
+#line 4242 "parser.cpp"
     break;
 
-  case 89: /* column_type: MULTIVECTOR '(' FLOAT16 ',' LONG_VALUE ')'  */
-#line 831 "parser.y"
+  case 91: /* column_type: MULTIVECTOR '(' FLOAT16 ',' LONG_VALUE ')'  */
+#line 837 "parser.y"
                                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat16}; }
-#line 4223 "parser.cpp"
+#line 4248 "parser.cpp"
     break;
 
-  case 90: /* column_type: MULTIVECTOR '(' BFLOAT16 ',' LONG_VALUE ')'  */
-#line 832 "parser.y"
+  case 92: /* column_type: MULTIVECTOR '(' BFLOAT16 ',' LONG_VALUE ')'  */
+#line 838 "parser.y"
                                               { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBFloat16}; }
-#line 4229 "parser.cpp"
+#line 4254 "parser.cpp"
     break;
 
-  case 91: /* column_type: MULTIVECTOR '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
-#line 833 "parser.y"
+  case 93: /* column_type: MULTIVECTOR '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
+#line 839 "parser.y"
                                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kMultiVector, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemUInt8}; }
-#line 4235 "parser.cpp"
+#line 4260 "parser.cpp"
     break;
 
-  case 92: /* column_type: TENSOR '(' BIT ',' LONG_VALUE ')'  */
-#line 834 "parser.y"
+  case 94: /* column_type: TENSOR '(' BIT ',' LONG_VALUE ')'  */
+#line 840 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBit}; }
-#line 4241 "parser.cpp"
+#line 4266 "parser.cpp"
     break;
 
-  case 93: /* column_type: TENSOR '(' TINYINT ',' LONG_VALUE ')'  */
-#line 835 "parser.y"
+  case 95: /* column_type: TENSOR '(' TINYINT ',' LONG_VALUE ')'  */
+#line 841 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt8}; }
-#line 4247 "parser.cpp"
+#line 4272 "parser.cpp"
     break;
 
-  case 94: /* column_type: TENSOR '(' SMALLINT ',' LONG_VALUE ')'  */
-#line 836 "parser.y"
+  case 96: /* column_type: TENSOR '(' SMALLINT ',' LONG_VALUE ')'  */
+#line 842 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt16}; }
-#line 4253 "parser.cpp"
+#line 4278 "parser.cpp"
     break;
 
-  case 95: /* column_type: TENSOR '(' INTEGER ',' LONG_VALUE ')'  */
-#line 837 "parser.y"
+  case 97: /* column_type: TENSOR '(' INTEGER ',' LONG_VALUE ')'  */
+#line 843 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4259 "parser.cpp"
+#line 4284 "parser.cpp"
     break;
 
-  case 96: /* column_type: TENSOR '(' INT ',' LONG_VALUE ')'  */
-#line 838 "parser.y"
+  case 98: /* column_type: TENSOR '(' INT ',' LONG_VALUE ')'  */
+#line 844 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4265 "parser.cpp"
+#line 4290 "parser.cpp"
     break;
 
-  case 97: /* column_type: TENSOR '(' BIGINT ',' LONG_VALUE ')'  */
-#line 839 "parser.y"
+  case 99: /* column_type: TENSOR '(' BIGINT ',' LONG_VALUE ')'  */
+#line 845 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt64}; }
-#line 4271 "parser.cpp"
+#line 4296 "parser.cpp"
     break;
 
-  case 98: /* column_type: TENSOR '(' FLOAT ',' LONG_VALUE ')'  */
-#line 840 "parser.y"
+  case 100: /* column_type: TENSOR '(' FLOAT ',' LONG_VALUE ')'  */
+#line 846 "parser.y"
                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat}; }
-#line 4277 "parser.cpp"
+#line 4302 "parser.cpp"
     break;
 
-  case 99: /* column_type: TENSOR '(' DOUBLE ',' LONG_VALUE ')'  */
-#line 841 "parser.y"
+  case 101: /* column_type: TENSOR '(' DOUBLE ',' LONG_VALUE ')'  */
+#line 847 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemDouble}; }
-#line 4283 "parser.cpp"
+#line 4308 "parser.cpp"
     break;
 
-  case 100: /* column_type: TENSOR '(' FLOAT16 ',' LONG_VALUE ')'  */
-#line 842 "parser.y"
+  case 102: /* column_type: TENSOR '(' FLOAT16 ',' LONG_VALUE ')'  */
+#line 848 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat16}; }
-#line 4289 "parser.cpp"
+#line 4314 "parser.cpp"
     break;
 
-  case 101: /* column_type: TENSOR '(' BFLOAT16 ',' LONG_VALUE ')'  */
-#line 843 "parser.y"
+  case 103: /* column_type: TENSOR '(' BFLOAT16 ',' LONG_VALUE ')'  */
+#line 849 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBFloat16}; }
-#line 4295 "parser.cpp"
+#line 4320 "parser.cpp"
     break;
 
-  case 102: /* column_type: TENSOR '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
-#line 844 "parser.y"
+  case 104: /* column_type: TENSOR '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
+#line 850 "parser.y"
                                                  { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemUInt8}; }
-#line 4301 "parser.cpp"
+#line 4326 "parser.cpp"
     break;
 
-  case 103: /* column_type: TENSORARRAY '(' BIT ',' LONG_VALUE ')'  */
-#line 845 "parser.y"
+  case 105: /* column_type: TENSORARRAY '(' BIT ',' LONG_VALUE ')'  */
+#line 851 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBit}; }
-#line 4307 "parser.cpp"
+#line 4332 "parser.cpp"
     break;
 
-  case 104: /* column_type: TENSORARRAY '(' TINYINT ',' LONG_VALUE ')'  */
-#line 846 "parser.y"
+  case 106: /* column_type: TENSORARRAY '(' TINYINT ',' LONG_VALUE ')'  */
+#line 852 "parser.y"
                                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt8}; }
-#line 4313 "parser.cpp"
+#line 4338 "parser.cpp"
     break;
 
-  case 105: /* column_type: TENSORARRAY '(' SMALLINT ',' LONG_VALUE ')'  */
-#line 847 "parser.y"
+  case 107: /* column_type: TENSORARRAY '(' SMALLINT ',' LONG_VALUE ')'  */
+#line 853 "parser.y"
                                               { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt16}; }
-#line 4319 "parser.cpp"
+#line 4344 "parser.cpp"
     break;
 
-  case 106: /* column_type: TENSORARRAY '(' INTEGER ',' LONG_VALUE ')'  */
-#line 848 "parser.y"
+  case 108: /* column_type: TENSORARRAY '(' INTEGER ',' LONG_VALUE ')'  */
+#line 854 "parser.y"
                                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4325 "parser.cpp"
+#line 4350 "parser.cpp"
     break;
 
-  case 107: /* column_type: TENSORARRAY '(' INT ',' LONG_VALUE ')'  */
-#line 849 "parser.y"
+  case 109: /* column_type: TENSORARRAY '(' INT ',' LONG_VALUE ')'  */
+#line 855 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4331 "parser.cpp"
+#line 4356 "parser.cpp"
     break;
 
-  case 108: /* column_type: TENSORARRAY '(' BIGINT ',' LONG_VALUE ')'  */
-#line 850 "parser.y"
+  case 110: /* column_type: TENSORARRAY '(' BIGINT ',' LONG_VALUE ')'  */
+#line 856 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt64}; }
-#line 4337 "parser.cpp"
+#line 4362 "parser.cpp"
     break;
 
-  case 109: /* column_type: TENSORARRAY '(' FLOAT ',' LONG_VALUE ')'  */
-#line 851 "parser.y"
+  case 111: /* column_type: TENSORARRAY '(' FLOAT ',' LONG_VALUE ')'  */
+#line 857 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat}; }
-#line 4343 "parser.cpp"
+#line 4368 "parser.cpp"
     break;
 
-  case 110: /* column_type: TENSORARRAY '(' DOUBLE ',' LONG_VALUE ')'  */
-#line 852 "parser.y"
+  case 112: /* column_type: TENSORARRAY '(' DOUBLE ',' LONG_VALUE ')'  */
+#line 858 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemDouble}; }
-#line 4349 "parser.cpp"
+#line 4374 "parser.cpp"
     break;
 
-  case 111: /* column_type: TENSORARRAY '(' FLOAT16 ',' LONG_VALUE ')'  */
-#line 853 "parser.y"
+  case 113: /* column_type: TENSORARRAY '(' FLOAT16 ',' LONG_VALUE ')'  */
+#line 859 "parser.y"
                                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat16}; }
-#line 4355 "parser.cpp"
+#line 4380 "parser.cpp"
     break;
 
-  case 112: /* column_type: TENSORARRAY '(' BFLOAT16 ',' LONG_VALUE ')'  */
-#line 854 "parser.y"
+  case 114: /* column_type: TENSORARRAY '(' BFLOAT16 ',' LONG_VALUE ')'  */
+#line 860 "parser.y"
                                               { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBFloat16}; }
-#line 4361 "parser.cpp"
+#line 4386 "parser.cpp"
     break;
 
-  case 113: /* column_type: TENSORARRAY '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
-#line 855 "parser.y"
+  case 115: /* column_type: TENSORARRAY '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
+#line 861 "parser.y"
                                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemUInt8}; }
-#line 4367 "parser.cpp"
+#line 4392 "parser.cpp"
     break;
 
-  case 114: /* column_type: VECTOR '(' BIT ',' LONG_VALUE ')'  */
-#line 856 "parser.y"
+  case 116: /* column_type: VECTOR '(' BIT ',' LONG_VALUE ')'  */
+#line 862 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBit}; }
-#line 4373 "parser.cpp"
+#line 4398 "parser.cpp"
     break;
 
-  case 115: /* column_type: VECTOR '(' TINYINT ',' LONG_VALUE ')'  */
-#line 857 "parser.y"
+  case 117: /* column_type: VECTOR '(' TINYINT ',' LONG_VALUE ')'  */
+#line 863 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt8}; }
-#line 4379 "parser.cpp"
+#line 4404 "parser.cpp"
     break;
 
-  case 116: /* column_type: VECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
-#line 858 "parser.y"
+  case 118: /* column_type: VECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
+#line 864 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt16}; }
-#line 4385 "parser.cpp"
+#line 4410 "parser.cpp"
     break;
 
-  case 117: /* column_type: VECTOR '(' INTEGER ',' LONG_VALUE ')'  */
-#line 859 "parser.y"
+  case 119: /* column_type: VECTOR '(' INTEGER ',' LONG_VALUE ')'  */
+#line 865 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4391 "parser.cpp"
+#line 4416 "parser.cpp"
     break;
 
-  case 118: /* column_type: VECTOR '(' INT ',' LONG_VALUE ')'  */
-#line 860 "parser.y"
+  case 120: /* column_type: VECTOR '(' INT ',' LONG_VALUE ')'  */
+#line 866 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4397 "parser.cpp"
+#line 4422 "parser.cpp"
     break;
 
-  case 119: /* column_type: VECTOR '(' BIGINT ',' LONG_VALUE ')'  */
-#line 861 "parser.y"
+  case 121: /* column_type: VECTOR '(' BIGINT ',' LONG_VALUE ')'  */
+#line 867 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt64}; }
-#line 4403 "parser.cpp"
+#line 4428 "parser.cpp"
     break;
 
-  case 120: /* column_type: VECTOR '(' FLOAT ',' LONG_VALUE ')'  */
-#line 862 "parser.y"
+  case 122: /* column_type: VECTOR '(' FLOAT ',' LONG_VALUE ')'  */
+#line 868 "parser.y"
                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat}; }
-#line 4409 "parser.cpp"
+#line 4434 "parser.cpp"
     break;
 
-  case 121: /* column_type: VECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
-#line 863 "parser.y"
+  case 123: /* column_type: VECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
+#line 869 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemDouble}; }
-#line 4415 "parser.cpp"
+#line 4440 "parser.cpp"
     break;
 
-  case 122: /* column_type: VECTOR '(' FLOAT16 ',' LONG_VALUE ')'  */
-#line 864 "parser.y"
+  case 124: /* column_type: VECTOR '(' FLOAT16 ',' LONG_VALUE ')'  */
+#line 870 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat16}; }
-#line 4421 "parser.cpp"
+#line 4446 "parser.cpp"
     break;
 
-  case 123: /* column_type: VECTOR '(' BFLOAT16 ',' LONG_VALUE ')'  */
-#line 865 "parser.y"
+  case 125: /* column_type: VECTOR '(' BFLOAT16 ',' LONG_VALUE ')'  */
+#line 871 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBFloat16}; }
-#line 4427 "parser.cpp"
+#line 4452 "parser.cpp"
     break;
 
-  case 124: /* column_type: VECTOR '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
-#line 866 "parser.y"
+  case 126: /* column_type: VECTOR '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
+#line 872 "parser.y"
                                                  { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemUInt8}; }
-#line 4433 "parser.cpp"
+#line 4458 "parser.cpp"
     break;
 
-  case 125: /* column_type: SPARSE '(' BIT ',' LONG_VALUE ')'  */
-#line 867 "parser.y"
+  case 127: /* column_type: SPARSE '(' BIT ',' LONG_VALUE ')'  */
+#line 873 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBit}; }
-#line 4439 "parser.cpp"
+#line 4464 "parser.cpp"
     break;
 
-  case 126: /* column_type: SPARSE '(' TINYINT ',' LONG_VALUE ')'  */
-#line 868 "parser.y"
+  case 128: /* column_type: SPARSE '(' TINYINT ',' LONG_VALUE ')'  */
+#line 874 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt8}; }
-#line 4445 "parser.cpp"
+#line 4470 "parser.cpp"
     break;
 
-  case 127: /* column_type: SPARSE '(' SMALLINT ',' LONG_VALUE ')'  */
-#line 869 "parser.y"
+  case 129: /* column_type: SPARSE '(' SMALLINT ',' LONG_VALUE ')'  */
+#line 875 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt16}; }
-#line 4451 "parser.cpp"
+#line 4476 "parser.cpp"
     break;
 
-  case 128: /* column_type: SPARSE '(' INTEGER ',' LONG_VALUE ')'  */
-#line 870 "parser.y"
+  case 130: /* column_type: SPARSE '(' INTEGER ',' LONG_VALUE ')'  */
+#line 876 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4457 "parser.cpp"
+#line 4482 "parser.cpp"
     break;
 
-  case 129: /* column_type: SPARSE '(' INT ',' LONG_VALUE ')'  */
-#line 871 "parser.y"
+  case 131: /* column_type: SPARSE '(' INT ',' LONG_VALUE ')'  */
+#line 877 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt32}; }
-#line 4463 "parser.cpp"
+#line 4488 "parser.cpp"
     break;
 
-  case 130: /* column_type: SPARSE '(' BIGINT ',' LONG_VALUE ')'  */
-#line 872 "parser.y"
+  case 132: /* column_type: SPARSE '(' BIGINT ',' LONG_VALUE ')'  */
+#line 878 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemInt64}; }
-#line 4469 "parser.cpp"
+#line 4494 "parser.cpp"
     break;
 
-  case 131: /* column_type: SPARSE '(' FLOAT ',' LONG_VALUE ')'  */
-#line 873 "parser.y"
+  case 133: /* column_type: SPARSE '(' FLOAT ',' LONG_VALUE ')'  */
+#line 879 "parser.y"
                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat}; }
-#line 4475 "parser.cpp"
+#line 4500 "parser.cpp"
     break;
 
-  case 132: /* column_type: SPARSE '(' DOUBLE ',' LONG_VALUE ')'  */
-#line 874 "parser.y"
+  case 134: /* column_type: SPARSE '(' DOUBLE ',' LONG_VALUE ')'  */
+#line 880 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemDouble}; }
-#line 4481 "parser.cpp"
+#line 4506 "parser.cpp"
     break;
 
-  case 133: /* column_type: SPARSE '(' FLOAT16 ',' LONG_VALUE ')'  */
-#line 875 "parser.y"
+  case 135: /* column_type: SPARSE '(' FLOAT16 ',' LONG_VALUE ')'  */
+#line 881 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemFloat16}; }
-#line 4487 "parser.cpp"
+#line 4512 "parser.cpp"
     break;
 
-  case 134: /* column_type: SPARSE '(' BFLOAT16 ',' LONG_VALUE ')'  */
-#line 876 "parser.y"
+  case 136: /* column_type: SPARSE '(' BFLOAT16 ',' LONG_VALUE ')'  */
+#line 882 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemBFloat16}; }
-#line 4493 "parser.cpp"
+#line 4518 "parser.cpp"
     break;
 
-  case 135: /* column_type: SPARSE '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
-#line 877 "parser.y"
+  case 137: /* column_type: SPARSE '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
+#line 883 "parser.y"
                                                  { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::EmbeddingDataType::kElemUInt8}; }
-#line 4499 "parser.cpp"
+#line 4524 "parser.cpp"
     break;
 
-  case 136: /* column_constraints: column_constraint  */
-#line 896 "parser.y"
+  case 138: /* column_constraints: column_constraint  */
+#line 902 "parser.y"
                                        {
     (yyval.column_constraints_t) = new std::set<infinity::ConstraintType>();
     (yyval.column_constraints_t)->insert((yyvsp[0].column_constraint_t));
 }
-#line 4508 "parser.cpp"
+#line 4533 "parser.cpp"
     break;
 
-  case 137: /* column_constraints: column_constraints column_constraint  */
-#line 900 "parser.y"
+  case 139: /* column_constraints: column_constraints column_constraint  */
+#line 906 "parser.y"
                                        {
     if((yyvsp[-1].column_constraints_t)->contains((yyvsp[0].column_constraint_t))) {
         yyerror(&yyloc, scanner, result, "Duplicate column constraint.");
@@ -4518,101 +4543,101 @@ yyreduce:
     (yyvsp[-1].column_constraints_t)->insert((yyvsp[0].column_constraint_t));
     (yyval.column_constraints_t) = (yyvsp[-1].column_constraints_t);
 }
-#line 4522 "parser.cpp"
+#line 4547 "parser.cpp"
     break;
 
-  case 138: /* column_constraint: PRIMARY KEY  */
-#line 910 "parser.y"
+  case 140: /* column_constraint: PRIMARY KEY  */
+#line 916 "parser.y"
                                 {
     (yyval.column_constraint_t) = infinity::ConstraintType::kPrimaryKey;
 }
-#line 4530 "parser.cpp"
+#line 4555 "parser.cpp"
     break;
 
-  case 139: /* column_constraint: UNIQUE  */
-#line 913 "parser.y"
+  case 141: /* column_constraint: UNIQUE  */
+#line 919 "parser.y"
          {
     (yyval.column_constraint_t) = infinity::ConstraintType::kUnique;
 }
-#line 4538 "parser.cpp"
+#line 4563 "parser.cpp"
     break;
 
-  case 140: /* column_constraint: NULLABLE  */
-#line 916 "parser.y"
+  case 142: /* column_constraint: NULLABLE  */
+#line 922 "parser.y"
            {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNull;
 }
-#line 4546 "parser.cpp"
+#line 4571 "parser.cpp"
     break;
 
-  case 141: /* column_constraint: NOT NULLABLE  */
-#line 919 "parser.y"
+  case 143: /* column_constraint: NOT NULLABLE  */
+#line 925 "parser.y"
                {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNotNull;
 }
-#line 4554 "parser.cpp"
+#line 4579 "parser.cpp"
     break;
 
-  case 142: /* default_expr: DEFAULT constant_expr  */
-#line 923 "parser.y"
+  case 144: /* default_expr: DEFAULT constant_expr  */
+#line 929 "parser.y"
                                      {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 4562 "parser.cpp"
+#line 4587 "parser.cpp"
     break;
 
-  case 143: /* default_expr: %empty  */
-#line 926 "parser.y"
+  case 145: /* default_expr: %empty  */
+#line 932 "parser.y"
                             {
     (yyval.const_expr_t) = nullptr;
 }
-#line 4570 "parser.cpp"
+#line 4595 "parser.cpp"
     break;
 
-  case 144: /* table_constraint: PRIMARY KEY '(' identifier_array ')'  */
-#line 931 "parser.y"
+  case 146: /* table_constraint: PRIMARY KEY '(' identifier_array ')'  */
+#line 937 "parser.y"
                                                         {
     (yyval.table_constraint_t) = new infinity::TableConstraint();
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kPrimaryKey;
 }
-#line 4580 "parser.cpp"
+#line 4605 "parser.cpp"
     break;
 
-  case 145: /* table_constraint: UNIQUE '(' identifier_array ')'  */
-#line 936 "parser.y"
+  case 147: /* table_constraint: UNIQUE '(' identifier_array ')'  */
+#line 942 "parser.y"
                                   {
     (yyval.table_constraint_t) = new infinity::TableConstraint();
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kUnique;
 }
-#line 4590 "parser.cpp"
+#line 4615 "parser.cpp"
     break;
 
-  case 146: /* identifier_array: IDENTIFIER  */
-#line 943 "parser.y"
+  case 148: /* identifier_array: IDENTIFIER  */
+#line 949 "parser.y"
                               {
     (yyval.identifier_array_t) = new std::vector<std::string>();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.identifier_array_t)->emplace_back((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 4601 "parser.cpp"
+#line 4626 "parser.cpp"
     break;
 
-  case 147: /* identifier_array: identifier_array ',' IDENTIFIER  */
-#line 949 "parser.y"
+  case 149: /* identifier_array: identifier_array ',' IDENTIFIER  */
+#line 955 "parser.y"
                                   {
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyvsp[-2].identifier_array_t)->emplace_back((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
     (yyval.identifier_array_t) = (yyvsp[-2].identifier_array_t);
 }
-#line 4612 "parser.cpp"
+#line 4637 "parser.cpp"
     break;
 
-  case 148: /* delete_statement: DELETE FROM table_name where_clause  */
-#line 959 "parser.y"
+  case 150: /* delete_statement: DELETE FROM table_name where_clause  */
+#line 965 "parser.y"
                                                        {
     (yyval.delete_stmt) = new infinity::DeleteStatement();
 
@@ -4625,11 +4650,11 @@ yyreduce:
     delete (yyvsp[-1].table_name_t);
     (yyval.delete_stmt)->where_expr_ = (yyvsp[0].expr_t);
 }
-#line 4629 "parser.cpp"
+#line 4654 "parser.cpp"
     break;
 
-  case 149: /* insert_statement: INSERT INTO table_name optional_identifier_array VALUES expr_array_list  */
-#line 975 "parser.y"
+  case 151: /* insert_statement: INSERT INTO table_name optional_identifier_array VALUES expr_array_list  */
+#line 981 "parser.y"
                                                                                           {
     bool is_error{false};
     for (auto expr_array : *(yyvsp[0].expr_array_list_t)) {
@@ -4664,11 +4689,11 @@ yyreduce:
     (yyval.insert_stmt)->columns_ = (yyvsp[-2].identifier_array_t);
     (yyval.insert_stmt)->values_ = (yyvsp[0].expr_array_list_t);
 }
-#line 4668 "parser.cpp"
+#line 4693 "parser.cpp"
     break;
 
-  case 150: /* insert_statement: INSERT INTO table_name optional_identifier_array select_without_paren  */
-#line 1009 "parser.y"
+  case 152: /* insert_statement: INSERT INTO table_name optional_identifier_array select_without_paren  */
+#line 1015 "parser.y"
                                                                         {
     (yyval.insert_stmt) = new infinity::InsertStatement();
     if((yyvsp[-2].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -4681,101 +4706,137 @@ yyreduce:
     (yyval.insert_stmt)->columns_ = (yyvsp[-1].identifier_array_t);
     (yyval.insert_stmt)->select_ = (yyvsp[0].select_stmt);
 }
-#line 4685 "parser.cpp"
+#line 4710 "parser.cpp"
     break;
 
-  case 151: /* optional_identifier_array: '(' identifier_array ')'  */
-#line 1022 "parser.y"
+  case 153: /* optional_identifier_array: '(' identifier_array ')'  */
+#line 1028 "parser.y"
                                                     {
     (yyval.identifier_array_t) = (yyvsp[-1].identifier_array_t);
 }
-#line 4693 "parser.cpp"
+#line 4718 "parser.cpp"
     break;
 
-  case 152: /* optional_identifier_array: %empty  */
-#line 1025 "parser.y"
+  case 154: /* optional_identifier_array: %empty  */
+#line 1031 "parser.y"
   {
     (yyval.identifier_array_t) = nullptr;
 }
-#line 4701 "parser.cpp"
+#line 4726 "parser.cpp"
     break;
 
-  case 153: /* explain_statement: EXPLAIN explain_type explainable_statement  */
-#line 1032 "parser.y"
+  case 155: /* explain_statement: EXPLAIN explain_type explainable_statement  */
+#line 1038 "parser.y"
                                                                {
     (yyval.explain_stmt) = new infinity::ExplainStatement();
     (yyval.explain_stmt)->type_ = (yyvsp[-1].explain_type_t);
     (yyval.explain_stmt)->statement_ = (yyvsp[0].base_stmt);
 }
-#line 4711 "parser.cpp"
+#line 4736 "parser.cpp"
     break;
 
-  case 154: /* explain_type: ANALYZE  */
-#line 1038 "parser.y"
+  case 156: /* explain_type: ANALYZE  */
+#line 1044 "parser.y"
                       {
     (yyval.explain_type_t) = infinity::ExplainType::kAnalyze;
 }
-#line 4719 "parser.cpp"
+#line 4744 "parser.cpp"
     break;
 
-  case 155: /* explain_type: AST  */
-#line 1041 "parser.y"
+  case 157: /* explain_type: AST  */
+#line 1047 "parser.y"
       {
     (yyval.explain_type_t) = infinity::ExplainType::kAst;
 }
-#line 4727 "parser.cpp"
+#line 4752 "parser.cpp"
     break;
 
-  case 156: /* explain_type: RAW  */
-#line 1044 "parser.y"
+  case 158: /* explain_type: RAW  */
+#line 1050 "parser.y"
       {
     (yyval.explain_type_t) = infinity::ExplainType::kUnOpt;
 }
-#line 4735 "parser.cpp"
+#line 4760 "parser.cpp"
     break;
 
-  case 157: /* explain_type: LOGICAL  */
-#line 1047 "parser.y"
+  case 159: /* explain_type: LOGICAL  */
+#line 1053 "parser.y"
           {
     (yyval.explain_type_t) = infinity::ExplainType::kOpt;
 }
-#line 4743 "parser.cpp"
+#line 4768 "parser.cpp"
     break;
 
-  case 158: /* explain_type: PHYSICAL  */
-#line 1050 "parser.y"
+  case 160: /* explain_type: PHYSICAL  */
+#line 1056 "parser.y"
            {
     (yyval.explain_type_t) = infinity::ExplainType::kPhysical;
 }
-#line 4751 "parser.cpp"
+#line 4776 "parser.cpp"
     break;
 
-  case 159: /* explain_type: PIPELINE  */
-#line 1053 "parser.y"
+  case 161: /* explain_type: PIPELINE  */
+#line 1059 "parser.y"
            {
     (yyval.explain_type_t) = infinity::ExplainType::kPipeline;
 }
-#line 4759 "parser.cpp"
+#line 4784 "parser.cpp"
     break;
 
-  case 160: /* explain_type: FRAGMENT  */
-#line 1056 "parser.y"
+  case 162: /* explain_type: FRAGMENT  */
+#line 1062 "parser.y"
            {
     (yyval.explain_type_t) = infinity::ExplainType::kFragment;
 }
-#line 4767 "parser.cpp"
+#line 4792 "parser.cpp"
     break;
 
-  case 161: /* explain_type: %empty  */
-#line 1059 "parser.y"
+  case 163: /* explain_type: %empty  */
+#line 1065 "parser.y"
   {
     (yyval.explain_type_t) = infinity::ExplainType::kPhysical;
 }
-#line 4775 "parser.cpp"
+#line 4800 "parser.cpp"
     break;
 
-  case 162: /* update_statement: UPDATE table_name SET update_expr_array where_clause  */
-#line 1066 "parser.y"
+  case 164: /* prepare_statement: PREPARE IDENTIFIER AS select_statement  */
+#line 1072 "parser.y"
+                                                           {
+    (yyval.prepare_stmt) = new infinity::PrepareStatement();
+    ParserHelper::ToLower((yyvsp[-2].str_value));
+    (yyval.prepare_stmt)->name_ = (yyvsp[-2].str_value);
+    free((yyvsp[-2].str_value));
+    (yyval.prepare_stmt)->statement_ = (yyvsp[0].select_stmt);
+    (yyval.prepare_stmt)->parameter_count_ = result->parameter_count_;
+}
+#line 4813 "parser.cpp"
+    break;
+
+  case 165: /* execute_statement: EXECUTE IDENTIFIER  */
+#line 1084 "parser.y"
+                                       {
+    (yyval.execute_stmt) = new infinity::ExecuteStatement();
+    ParserHelper::ToLower((yyvsp[0].str_value));
+    (yyval.execute_stmt)->name_ = (yyvsp[0].str_value);
+    free((yyvsp[0].str_value));
+}
+#line 4824 "parser.cpp"
+    break;
+
+  case 166: /* execute_statement: EXECUTE IDENTIFIER '(' expr_array ')'  */
+#line 1090 "parser.y"
+                                        {
+    (yyval.execute_stmt) = new infinity::ExecuteStatement();
+    ParserHelper::ToLower((yyvsp[-3].str_value));
+    (yyval.execute_stmt)->name_ = (yyvsp[-3].str_value);
+    free((yyvsp[-3].str_value));
+    (yyval.execute_stmt)->parameters_ = (yyvsp[-1].expr_array_t);
+}
+#line 4836 "parser.cpp"
+    break;
+
+  case 167: /* update_statement: UPDATE table_name SET update_expr_array where_clause  */
+#line 1101 "parser.y"
                                                                        {
     (yyval.update_stmt) = new infinity::UpdateStatement();
     if((yyvsp[-3].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -4788,29 +4849,29 @@ yyreduce:
     (yyval.update_stmt)->where_expr_ = (yyvsp[0].expr_t);
     (yyval.update_stmt)->update_expr_array_ = (yyvsp[-1].update_expr_array_t);
 }
-#line 4792 "parser.cpp"
+#line 4853 "parser.cpp"
     break;
 
-  case 163: /* update_expr_array: update_expr  */
-#line 1079 "parser.y"
+  case 168: /* update_expr_array: update_expr  */
+#line 1114 "parser.y"
                                {
     (yyval.update_expr_array_t) = new std::vector<infinity::UpdateExpr*>();
     (yyval.update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
 }
-#line 4801 "parser.cpp"
+#line 4862 "parser.cpp"
     break;
 
-  case 164: /* update_expr_array: update_expr_array ',' update_expr  */
-#line 1083 "parser.y"
+  case 169: /* update_expr_array: update_expr_array ',' update_expr  */
+#line 1118 "parser.y"
                                     {
     (yyvsp[-2].update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
     (yyval.update_expr_array_t) = (yyvsp[-2].update_expr_array_t);
 }
-#line 4810 "parser.cpp"
+#line 4871 "parser.cpp"
     break;
 
-  case 165: /* update_expr: IDENTIFIER '=' expr  */
-#line 1088 "parser.y"
+  case 170: /* update_expr: IDENTIFIER '=' expr  */
+#line 1123 "parser.y"
                                   {
     (yyval.update_expr_t) = new infinity::UpdateExpr();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -4818,11 +4879,11 @@ yyreduce:
     free((yyvsp[-2].str_value));
     (yyval.update_expr_t)->value = (yyvsp[0].expr_t);
 }
-#line 4822 "parser.cpp"
+#line 4883 "parser.cpp"
     break;
 
-  case 166: /* drop_statement: DROP DATABASE if_exists IDENTIFIER  */
-#line 1101 "parser.y"
+  case 171: /* drop_statement: DROP DATABASE if_exists IDENTIFIER  */
+#line 1136 "parser.y"
                                                    {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropSchemaInfo> drop_schema_info = std::make_shared<infinity::DropSchemaInfo>();
@@ -4834,11 +4895,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_ = drop_schema_info;
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 4838 "parser.cpp"
+#line 4899 "parser.cpp"
     break;
 
-  case 167: /* drop_statement: DROP COLLECTION if_exists table_name  */
-#line 1114 "parser.y"
+  case 172: /* drop_statement: DROP COLLECTION if_exists table_name  */
+#line 1149 "parser.y"
                                        {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropCollectionInfo> drop_collection_info = std::make_unique<infinity::DropCollectionInfo>();
@@ -4852,11 +4913,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 4856 "parser.cpp"
+#line 4917 "parser.cpp"
     break;
 
-  case 168: /* drop_statement: DROP TABLE if_exists table_name  */
-#line 1129 "parser.y"
+  case 173: /* drop_statement: DROP TABLE if_exists table_name  */
+#line 1164 "parser.y"
                                   {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropTableInfo> drop_table_info = std::make_unique<infinity::DropTableInfo>();
@@ -4870,11 +4931,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 4874 "parser.cpp"
+#line 4935 "parser.cpp"
     break;
 
-  case 169: /* drop_statement: DROP VIEW if_exists table_name  */
-#line 1144 "parser.y"
+  case 174: /* drop_statement: DROP VIEW if_exists table_name  */
+#line 1179 "parser.y"
                                  {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropViewInfo> drop_view_info = std::make_unique<infinity::DropViewInfo>();
@@ -4888,11 +4949,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 4892 "parser.cpp"
+#line 4953 "parser.cpp"
     break;
 
-  case 170: /* drop_statement: DROP INDEX if_exists IDENTIFIER ON table_name  */
-#line 1159 "parser.y"
+  case 175: /* drop_statement: DROP INDEX if_exists IDENTIFIER ON table_name  */
+#line 1194 "parser.y"
                                                 {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropIndexInfo> drop_index_info = std::make_shared<infinity::DropIndexInfo>();
@@ -4911,11 +4972,11 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 4915 "parser.cpp"
+#line 4976 "parser.cpp"
     break;
 
-  case 171: /* copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')'  */
-#line 1182 "parser.y"
+  case 176: /* copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')'  */
+#line 1217 "parser.y"
                                                                            {
     (yyval.copy_stmt) = new infinity::CopyStatement();
 
@@ -4964,16 +5025,20 @@ yyreduce:
                 (yyval.copy_stmt)->row_limit_ = option_ptr->row_limit_;
                 break;
             }
+            case infinity::CopyOptionType::kCompression: {
+                (yyval.copy_stmt)->compression_type_ = option_ptr->compression_type_;
+                break;
+            }
         }
         delete option_ptr;
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 4973 "parser.cpp"
+#line 5038 "parser.cpp"
     break;
 
-  case 172: /* copy_statement: COPY table_name '(' expr_array ')' TO file_path WITH '(' copy_option_list ')'  */
-#line 1235 "parser.y"
+  case 177: /* copy_statement: COPY table_name '(' expr_array ')' TO file_path WITH '(' copy_option_list ')'  */
+#line 1274 "parser.y"
                                                                                 {
     (yyval.copy_stmt) = new infinity::CopyStatement();
 
@@ -5024,16 +5089,20 @@ yyreduce:
                 (yyval.copy_stmt)->row_limit_ = option_ptr->row_limit_;
                 break;
             }
+            case infinity::CopyOptionType::kCompression: {
+                (yyval.copy_stmt)->compression_type_ = option_ptr->compression_type_;
+                break;
+            }
         }
         delete option_ptr;
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 5033 "parser.cpp"
+#line 5102 "parser.cpp"
     break;
 
-  case 173: /* copy_statement: COPY table_name FROM file_path WITH '(' copy_option_list ')'  */
-#line 1290 "parser.y"
+  case 178: /* copy_statement: COPY table_name FROM file_path WITH '(' copy_option_list ')'  */
+#line 1333 "parser.y"
                                                                {
     (yyval.copy_stmt) = new infinity::CopyStatement();
 
@@ -5081,27 +5150,27 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 5085 "parser.cpp"
+#line 5154 "parser.cpp"
     break;
 
-  case 174: /* select_statement: select_without_paren  */
-#line 1341 "parser.y"
+  case 179: /* select_statement: select_without_paren  */
+#line 1384 "parser.y"
                                         {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 5093 "parser.cpp"
+#line 5162 "parser.cpp"
     break;
 
-  case 175: /* select_statement: select_with_paren  */
-#line 1344 "parser.y"
+  case 180: /* select_statement: select_with_paren  */
+#line 1387 "parser.y"
                     {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 5101 "parser.cpp"
+#line 5170 "parser.cpp"
     break;
 
-  case 176: /* select_statement: select_statement set_operator select_clause_without_modifier_paren  */
-#line 1347 "parser.y"
+  case 181: /* select_statement: select_statement set_operator select_clause_without_modifier_paren  */
+#line 1390 "parser.y"
                                                                      {
     infinity::SelectStatement* node = (yyvsp[-2].select_stmt);
     while(node->nested_select_ != nullptr) {
@@ -5111,11 +5180,11 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 5115 "parser.cpp"
+#line 5184 "parser.cpp"
     break;
 
-  case 177: /* select_statement: select_statement set_operator select_clause_without_modifier  */
-#line 1356 "parser.y"
+  case 182: /* select_statement: select_statement set_operator select_clause_without_modifier  */
+#line 1399 "parser.y"
                                                                {
     infinity::SelectStatement* node = (yyvsp[-2].select_stmt);
     while(node->nested_select_ != nullptr) {
@@ -5125,36 +5194,36 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 5129 "parser.cpp"
+#line 5198 "parser.cpp"
     break;
 
-  case 178: /* select_with_paren: '(' select_without_paren ')'  */
-#line 1366 "parser.y"
+  case 183: /* select_with_paren: '(' select_without_paren ')'  */
+#line 1409 "parser.y"
                                                  {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 5137 "parser.cpp"
+#line 5206 "parser.cpp"
     break;
 
-  case 179: /* select_with_paren: '(' select_with_paren ')'  */
-#line 1369 "parser.y"
+  case 184: /* select_with_paren: '(' select_with_paren ')'  */
+#line 1412 "parser.y"
                             {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 5145 "parser.cpp"
+#line 5214 "parser.cpp"
     break;
 
-  case 180: /* select_without_paren: with_clause select_clause_with_modifier  */
-#line 1373 "parser.y"
+  case 185: /* select_without_paren: with_clause select_clause_with_modifier  */
+#line 1416 "parser.y"
                                                               {
     (yyvsp[0].select_stmt)->with_exprs_ = (yyvsp[-1].with_expr_list_t);
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 5154 "parser.cpp"
+#line 5223 "parser.cpp"
     break;
 
-  case 181: /* select_clause_with_modifier: select_clause_without_modifier order_by_clause limit_expr offset_expr  */
-#line 1378 "parser.y"
+  case 186: /* select_clause_with_modifier: select_clause_without_modifier order_by_clause limit_expr offset_expr  */
+#line 1421 "parser.y"
                                                                                                    {
     if((yyvsp[-1].expr_t) == nullptr and (yyvsp[0].expr_t) != nullptr) {
         delete (yyvsp[-3].select_stmt);
@@ -5181,27 +5250,27 @@ yyreduce:
     (yyvsp[-3].select_stmt)->offset_expr_ = (yyvsp[0].expr_t);
     (yyval.select_stmt) = (yyvsp[-3].select_stmt);
 }
-#line 5185 "parser.cpp"
+#line 5254 "parser.cpp"
     break;
 
-  case 182: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier ')'  */
-#line 1405 "parser.y"
+  case 187: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier ')'  */
+#line 1448 "parser.y"
                                                                              {
   (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 5193 "parser.cpp"
+#line 5262 "parser.cpp"
     break;
 
-  case 183: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier_paren ')'  */
-#line 1408 "parser.y"
+  case 188: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier_paren ')'  */
+#line 1451 "parser.y"
                                                {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 5201 "parser.cpp"
+#line 5270 "parser.cpp"
     break;
 
-  case 184: /* select_clause_without_modifier: SELECT distinct expr_array from_clause search_clause where_clause group_by_clause having_clause  */
-#line 1413 "parser.y"
+  case 189: /* select_clause_without_modifier: SELECT distinct expr_array from_clause search_clause where_clause group_by_clause having_clause  */
+#line 1456 "parser.y"
                                                                                                 {
     (yyval.select_stmt) = new infinity::SelectStatement();
     (yyval.select_stmt)->select_list_ = (yyvsp[-5].expr_array_t);
@@ -5217,261 +5286,261 @@ yyreduce:
         YYERROR;
     }
 }
-#line 5221 "parser.cpp"
+#line 5290 "parser.cpp"
     break;
 
-  case 185: /* order_by_clause: ORDER BY order_by_expr_list  */
-#line 1429 "parser.y"
+  case 190: /* order_by_clause: ORDER BY order_by_expr_list  */
+#line 1472 "parser.y"
                                               {
     (yyval.order_by_expr_list_t) = (yyvsp[0].order_by_expr_list_t);
 }
-#line 5229 "parser.cpp"
+#line 5298 "parser.cpp"
     break;
 
-  case 186: /* order_by_clause: %empty  */
-#line 1432 "parser.y"
+  case 191: /* order_by_clause: %empty  */
+#line 1475 "parser.y"
                        {
     (yyval.order_by_expr_list_t) = nullptr;
 }
-#line 5237 "parser.cpp"
+#line 5306 "parser.cpp"
     break;
 
-  case 187: /* order_by_expr_list: order_by_expr  */
-#line 1436 "parser.y"
+  case 192: /* order_by_expr_list: order_by_expr  */
+#line 1479 "parser.y"
                                   {
     (yyval.order_by_expr_list_t) = new std::vector<infinity::OrderByExpr*>();
     (yyval.order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
 }
-#line 5246 "parser.cpp"
+#line 5315 "parser.cpp"
     break;
 
-  case 188: /* order_by_expr_list: order_by_expr_list ',' order_by_expr  */
-#line 1440 "parser.y"
+  case 193: /* order_by_expr_list: order_by_expr_list ',' order_by_expr  */
+#line 1483 "parser.y"
                                        {
     (yyvsp[-2].order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
     (yyval.order_by_expr_list_t) = (yyvsp[-2].order_by_expr_list_t);
 }
-#line 5255 "parser.cpp"
+#line 5324 "parser.cpp"
     break;
 
-  case 189: /* order_by_expr: expr order_by_type  */
-#line 1445 "parser.y"
+  case 194: /* order_by_expr: expr order_by_type  */
+#line 1488 "parser.y"
                                    {
     (yyval.order_by_expr_t) = new infinity::OrderByExpr();
     (yyval.order_by_expr_t)->expr_ = (yyvsp[-1].expr_t);
     (yyval.order_by_expr_t)->type_ = (yyvsp[0].order_by_type_t);
 }
-#line 5265 "parser.cpp"
+#line 5334 "parser.cpp"
     break;
 
-  case 190: /* order_by_type: ASC  */
-#line 1451 "parser.y"
+  case 195: /* order_by_type: ASC  */
+#line 1494 "parser.y"
                    {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 5273 "parser.cpp"
+#line 5342 "parser.cpp"
     break;
 
-  case 191: /* order_by_type: DESC  */
-#line 1454 "parser.y"
+  case 196: /* order_by_type: DESC  */
+#line 1497 "parser.y"
        {
     (yyval.order_by_type_t) = infinity::kDesc;
 }
-#line 5281 "parser.cpp"
+#line 5350 "parser.cpp"
     break;
 
-  case 192: /* order_by_type: %empty  */
-#line 1457 "parser.y"
+  case 197: /* order_by_type: %empty  */
+#line 1500 "parser.y"
   {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 5289 "parser.cpp"
+#line 5358 "parser.cpp"
     break;
 
-  case 193: /* limit_expr: LIMIT expr  */
-#line 1461 "parser.y"
+  case 198: /* limit_expr: LIMIT expr  */
+#line 1504 "parser.y"
                        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5297 "parser.cpp"
+#line 5366 "parser.cpp"
     break;
 
-  case 194: /* limit_expr: %empty  */
-#line 1465 "parser.y"
+  case 199: /* limit_expr: %empty  */
+#line 1508 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 5303 "parser.cpp"
+#line 5372 "parser.cpp"
     break;
 
-  case 195: /* offset_expr: OFFSET expr  */
-#line 1467 "parser.y"
+  case 200: /* offset_expr: OFFSET expr  */
+#line 1510 "parser.y"
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5311 "parser.cpp"
+#line 5380 "parser.cpp"
     break;
 
-  case 196: /* offset_expr: %empty  */
-#line 1471 "parser.y"
+  case 201: /* offset_expr: %empty  */
+#line 1514 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 5317 "parser.cpp"
+#line 5386 "parser.cpp"
     break;
 
-  case 197: /* distinct: DISTINCT  */
-#line 1473 "parser.y"
+  case 202: /* distinct: DISTINCT  */
+#line 1516 "parser.y"
                     {
     (yyval.bool_value) = true;
 }
-#line 5325 "parser.cpp"
+#line 5394 "parser.cpp"
     break;
 
-  case 198: /* distinct: %empty  */
-#line 1476 "parser.y"
+  case 203: /* distinct: %empty  */
+#line 1519 "parser.y"
   {
     (yyval.bool_value) = false;
 }
-#line 5333 "parser.cpp"
+#line 5402 "parser.cpp"
     break;
 
-  case 199: /* from_clause: FROM table_reference  */
-#line 1480 "parser.y"
+  case 204: /* from_clause: FROM table_reference  */
+#line 1523 "parser.y"
                                   {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 5341 "parser.cpp"
+#line 5410 "parser.cpp"
     break;
 
-  case 200: /* from_clause: %empty  */
-#line 1483 "parser.y"
+  case 205: /* from_clause: %empty  */
+#line 1526 "parser.y"
                        {
     (yyval.table_reference_t) = nullptr;
 }
-#line 5349 "parser.cpp"
+#line 5418 "parser.cpp"
     break;
 
-  case 201: /* search_clause: SEARCH sub_search_array  */
-#line 1487 "parser.y"
+  case 206: /* search_clause: SEARCH sub_search_array  */
+#line 1530 "parser.y"
                                        {
     infinity::SearchExpr* search_expr = new infinity::SearchExpr();
     search_expr->SetExprs((yyvsp[0].expr_array_t));
     (yyval.expr_t) = search_expr;
 }
-#line 5359 "parser.cpp"
+#line 5428 "parser.cpp"
     break;
 
-  case 202: /* search_clause: %empty  */
-#line 1492 "parser.y"
+  case 207: /* search_clause: %empty  */
+#line 1535 "parser.y"
                          {
     (yyval.expr_t) = nullptr;
 }
-#line 5367 "parser.cpp"
+#line 5436 "parser.cpp"
     break;
 
-  case 203: /* optional_search_filter_expr: ',' WHERE expr  */
-#line 1496 "parser.y"
+  case 208: /* optional_search_filter_expr: ',' WHERE expr  */
+#line 1539 "parser.y"
                                             {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5375 "parser.cpp"
+#line 5444 "parser.cpp"
     break;
 
-  case 204: /* optional_search_filter_expr: %empty  */
-#line 1499 "parser.y"
+  case 209: /* optional_search_filter_expr: %empty  */
+#line 1542 "parser.y"
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 5383 "parser.cpp"
+#line 5452 "parser.cpp"
     break;
 
-  case 205: /* where_clause: WHERE expr  */
-#line 1503 "parser.y"
+  case 210: /* where_clause: WHERE expr  */
+#line 1546 "parser.y"
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5391 "parser.cpp"
+#line 5460 "parser.cpp"
     break;
 
-  case 206: /* where_clause: %empty  */
-#line 1506 "parser.y"
+  case 211: /* where_clause: %empty  */
+#line 1549 "parser.y"
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 5399 "parser.cpp"
+#line 5468 "parser.cpp"
     break;
 
-  case 207: /* having_clause: HAVING expr  */
-#line 1510 "parser.y"
+  case 212: /* having_clause: HAVING expr  */
+#line 1553 "parser.y"
                            {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5407 "parser.cpp"
+#line 5476 "parser.cpp"
     break;
 
-  case 208: /* having_clause: %empty  */
-#line 1513 "parser.y"
+  case 213: /* having_clause: %empty  */
+#line 1556 "parser.y"
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 5415 "parser.cpp"
+#line 5484 "parser.cpp"
     break;
 
-  case 209: /* group_by_clause: GROUP BY expr_array  */
-#line 1517 "parser.y"
+  case 214: /* group_by_clause: GROUP BY expr_array  */
+#line 1560 "parser.y"
                                      {
     (yyval.expr_array_t) = (yyvsp[0].expr_array_t);
 }
-#line 5423 "parser.cpp"
+#line 5492 "parser.cpp"
     break;
 
-  case 210: /* group_by_clause: %empty  */
-#line 1520 "parser.y"
+  case 215: /* group_by_clause: %empty  */
+#line 1563 "parser.y"
   {
     (yyval.expr_array_t) = nullptr;
 }
-#line 5431 "parser.cpp"
+#line 5500 "parser.cpp"
     break;
 
-  case 211: /* set_operator: UNION  */
-#line 1524 "parser.y"
+  case 216: /* set_operator: UNION  */
+#line 1567 "parser.y"
                      {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnion;
 }
-#line 5439 "parser.cpp"
+#line 5508 "parser.cpp"
     break;
 
-  case 212: /* set_operator: UNION ALL  */
-#line 1527 "parser.y"
+  case 217: /* set_operator: UNION ALL  */
+#line 1570 "parser.y"
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnionAll;
 }
-#line 5447 "parser.cpp"
+#line 5516 "parser.cpp"
     break;
 
-  case 213: /* set_operator: INTERSECT  */
-#line 1530 "parser.y"
+  case 218: /* set_operator: INTERSECT  */
+#line 1573 "parser.y"
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kIntersect;
 }
-#line 5455 "parser.cpp"
+#line 5524 "parser.cpp"
     break;
 
-  case 214: /* set_operator: EXCEPT  */
-#line 1533 "parser.y"
+  case 219: /* set_operator: EXCEPT  */
+#line 1576 "parser.y"
          {
     (yyval.set_operator_t) = infinity::SetOperatorType::kExcept;
 }
-#line 5463 "parser.cpp"
+#line 5532 "parser.cpp"
     break;
 
-  case 215: /* table_reference: table_reference_unit  */
-#line 1541 "parser.y"
+  case 220: /* table_reference: table_reference_unit  */
+#line 1584 "parser.y"
                                        {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 5471 "parser.cpp"
+#line 5540 "parser.cpp"
     break;
 
-  case 216: /* table_reference: table_reference ',' table_reference_unit  */
-#line 1544 "parser.y"
+  case 221: /* table_reference: table_reference ',' table_reference_unit  */
+#line 1587 "parser.y"
                                            {
     infinity::CrossProductReference* cross_product_ref = nullptr;
     if((yyvsp[-2].table_reference_t)->type_ == infinity::TableRefType::kCrossProduct) {
@@ -5485,11 +5554,11 @@ yyreduce:
 
     (yyval.table_reference_t) = cross_product_ref;
 }
-#line 5489 "parser.cpp"
+#line 5558 "parser.cpp"
     break;
 
-  case 219: /* table_reference_name: table_name table_alias  */
-#line 1561 "parser.y"
+  case 224: /* table_reference_name: table_name table_alias  */
+#line 1604 "parser.y"
                                               {
     infinity::TableReference* table_ref = new infinity::TableReference();
     if((yyvsp[-1].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -5503,32 +5572,32 @@ yyreduce:
     table_ref->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = table_ref;
 }
-#line 5507 "parser.cpp"
+#line 5576 "parser.cpp"
     break;
 
-  case 220: /* table_reference_name: '(' select_statement ')' table_alias  */
-#line 1575 "parser.y"
+  case 225: /* table_reference_name: '(' select_statement ')' table_alias  */
+#line 1618 "parser.y"
                                        {
     infinity::SubqueryReference* subquery_reference = new infinity::SubqueryReference();
     subquery_reference->select_statement_ = (yyvsp[-2].select_stmt);
     subquery_reference->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = subquery_reference;
 }
-#line 5518 "parser.cpp"
+#line 5587 "parser.cpp"
     break;
 
-  case 221: /* table_name: IDENTIFIER  */
-#line 1584 "parser.y"
+  case 226: /* table_name: IDENTIFIER  */
+#line 1627 "parser.y"
                         {
     (yyval.table_name_t) = new infinity::TableName();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 5528 "parser.cpp"
+#line 5597 "parser.cpp"
     break;
 
-  case 222: /* table_name: IDENTIFIER '.' IDENTIFIER  */
-#line 1589 "parser.y"
+  case 227: /* table_name: IDENTIFIER '.' IDENTIFIER  */
+#line 1632 "parser.y"
                             {
     (yyval.table_name_t) = new infinity::TableName();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -5536,84 +5605,84 @@ yyreduce:
     (yyval.table_name_t)->schema_name_ptr_ = (yyvsp[-2].str_value);
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 5540 "parser.cpp"
+#line 5609 "parser.cpp"
     break;
 
-  case 223: /* table_alias: AS IDENTIFIER  */
-#line 1598 "parser.y"
+  case 228: /* table_alias: AS IDENTIFIER  */
+#line 1641 "parser.y"
                             {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 5550 "parser.cpp"
+#line 5619 "parser.cpp"
     break;
 
-  case 224: /* table_alias: IDENTIFIER  */
-#line 1603 "parser.y"
+  case 229: /* table_alias: IDENTIFIER  */
+#line 1646 "parser.y"
              {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 5560 "parser.cpp"
+#line 5629 "parser.cpp"
     break;
 
-  case 225: /* table_alias: AS IDENTIFIER '(' identifier_array ')'  */
-#line 1608 "parser.y"
+  case 230: /* table_alias: AS IDENTIFIER '(' identifier_array ')'  */
+#line 1651 "parser.y"
                                          {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[-3].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[-3].str_value);
     (yyval.table_alias_t)->column_alias_array_ = (yyvsp[-1].identifier_array_t);
 }
-#line 5571 "parser.cpp"
+#line 5640 "parser.cpp"
     break;
 
-  case 226: /* table_alias: %empty  */
-#line 1614 "parser.y"
+  case 231: /* table_alias: %empty  */
+#line 1657 "parser.y"
   {
     (yyval.table_alias_t) = nullptr;
 }
-#line 5579 "parser.cpp"
+#line 5648 "parser.cpp"
     break;
 
-  case 227: /* with_clause: WITH with_expr_list  */
-#line 1621 "parser.y"
+  case 232: /* with_clause: WITH with_expr_list  */
+#line 1664 "parser.y"
                                   {
     (yyval.with_expr_list_t) = (yyvsp[0].with_expr_list_t);
 }
-#line 5587 "parser.cpp"
+#line 5656 "parser.cpp"
     break;
 
-  case 228: /* with_clause: %empty  */
-#line 1624 "parser.y"
+  case 233: /* with_clause: %empty  */
+#line 1667 "parser.y"
                           {
     (yyval.with_expr_list_t) = nullptr;
 }
-#line 5595 "parser.cpp"
+#line 5664 "parser.cpp"
     break;
 
-  case 229: /* with_expr_list: with_expr  */
-#line 1628 "parser.y"
+  case 234: /* with_expr_list: with_expr  */
+#line 1671 "parser.y"
                           {
     (yyval.with_expr_list_t) = new std::vector<infinity::WithExpr*>();
     (yyval.with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
 }
-#line 5604 "parser.cpp"
+#line 5673 "parser.cpp"
     break;
 
-  case 230: /* with_expr_list: with_expr_list ',' with_expr  */
-#line 1631 "parser.y"
+  case 235: /* with_expr_list: with_expr_list ',' with_expr  */
+#line 1674 "parser.y"
                                  {
     (yyvsp[-2].with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
     (yyval.with_expr_list_t) = (yyvsp[-2].with_expr_list_t);
 }
-#line 5613 "parser.cpp"
+#line 5682 "parser.cpp"
     break;
 
-  case 231: /* with_expr: IDENTIFIER AS '(' select_clause_with_modifier ')'  */
-#line 1636 "parser.y"
+  case 236: /* with_expr: IDENTIFIER AS '(' select_clause_with_modifier ')'  */
+#line 1679 "parser.y"
                                                              {
     (yyval.with_expr_t) = new infinity::WithExpr();
     ParserHelper::ToLower((yyvsp[-4].str_value));
@@ -5621,11 +5690,11 @@ yyreduce:
     free((yyvsp[-4].str_value));
     (yyval.with_expr_t)->select_ = (yyvsp[-1].select_stmt);
 }
-#line 5625 "parser.cpp"
+#line 5694 "parser.cpp"
     break;
 
-  case 232: /* join_clause: table_reference_unit NATURAL JOIN table_reference_name  */
-#line 1648 "parser.y"
+  case 237: /* join_clause: table_reference_unit NATURAL JOIN table_reference_name  */
+#line 1691 "parser.y"
                                                                     {
     infinity::JoinReference* join_reference = new infinity::JoinReference();
     join_reference->left_ = (yyvsp[-3].table_reference_t);
@@ -5633,11 +5702,11 @@ yyreduce:
     join_reference->join_type_ = infinity::JoinType::kNatural;
     (yyval.table_reference_t) = join_reference;
 }
-#line 5637 "parser.cpp"
+#line 5706 "parser.cpp"
     break;
 
-  case 233: /* join_clause: table_reference_unit join_type JOIN table_reference_name ON expr  */
-#line 1655 "parser.y"
+  case 238: /* join_clause: table_reference_unit join_type JOIN table_reference_name ON expr  */
+#line 1698 "parser.y"
                                                                    {
     infinity::JoinReference* join_reference = new infinity::JoinReference();
     join_reference->left_ = (yyvsp[-5].table_reference_t);
@@ -5646,102 +5715,102 @@ yyreduce:
     join_reference->condition_ = (yyvsp[0].expr_t);
     (yyval.table_reference_t) = join_reference;
 }
-#line 5650 "parser.cpp"
+#line 5719 "parser.cpp"
     break;
 
-  case 234: /* join_type: INNER  */
-#line 1669 "parser.y"
+  case 239: /* join_type: INNER  */
+#line 1712 "parser.y"
                   {
     (yyval.join_type_t) = infinity::JoinType::kInner;
 }
-#line 5658 "parser.cpp"
+#line 5727 "parser.cpp"
     break;
 
-  case 235: /* join_type: LEFT  */
-#line 1672 "parser.y"
+  case 240: /* join_type: LEFT  */
+#line 1715 "parser.y"
        {
     (yyval.join_type_t) = infinity::JoinType::kLeft;
 }
-#line 5666 "parser.cpp"
+#line 5735 "parser.cpp"
     break;
 
-  case 236: /* join_type: RIGHT  */
-#line 1675 "parser.y"
+  case 241: /* join_type: RIGHT  */
+#line 1718 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kRight;
 }
-#line 5674 "parser.cpp"
+#line 5743 "parser.cpp"
     break;
 
-  case 237: /* join_type: OUTER  */
-#line 1678 "parser.y"
+  case 242: /* join_type: OUTER  */
+#line 1721 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 5682 "parser.cpp"
+#line 5751 "parser.cpp"
     break;
 
-  case 238: /* join_type: FULL  */
-#line 1681 "parser.y"
+  case 243: /* join_type: FULL  */
+#line 1724 "parser.y"
        {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 5690 "parser.cpp"
+#line 5759 "parser.cpp"
     break;
 
-  case 239: /* join_type: CROSS  */
-#line 1684 "parser.y"
+  case 244: /* join_type: CROSS  */
+#line 1727 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kCross;
 }
-#line 5698 "parser.cpp"
+#line 5767 "parser.cpp"
     break;
 
-  case 240: /* join_type: %empty  */
-#line 1687 "parser.y"
+  case 245: /* join_type: %empty  */
+#line 1730 "parser.y"
                 {
 }
-#line 5705 "parser.cpp"
+#line 5774 "parser.cpp"
     break;
 
-  case 241: /* show_statement: SHOW DATABASES  */
-#line 1693 "parser.y"
+  case 246: /* show_statement: SHOW DATABASES  */
+#line 1736 "parser.y"
                                {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kDatabases;
 }
-#line 5714 "parser.cpp"
+#line 5783 "parser.cpp"
     break;
 
-  case 242: /* show_statement: SHOW TABLES  */
-#line 1697 "parser.y"
+  case 247: /* show_statement: SHOW TABLES  */
+#line 1740 "parser.y"
               {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTables;
 }
-#line 5723 "parser.cpp"
+#line 5792 "parser.cpp"
     break;
 
-  case 243: /* show_statement: SHOW VIEWS  */
-#line 1701 "parser.y"
+  case 248: /* show_statement: SHOW VIEWS  */
+#line 1744 "parser.y"
              {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kViews;
 }
-#line 5732 "parser.cpp"
+#line 5801 "parser.cpp"
     break;
 
-  case 244: /* show_statement: SHOW CONFIGS  */
-#line 1705 "parser.y"
+  case 249: /* show_statement: SHOW CONFIGS  */
+#line 1748 "parser.y"
                {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kConfigs;
 }
-#line 5741 "parser.cpp"
+#line 5810 "parser.cpp"
     break;
 
-  case 245: /* show_statement: SHOW CONFIG IDENTIFIER  */
-#line 1709 "parser.y"
+  case 250: /* show_statement: SHOW CONFIG IDENTIFIER  */
+#line 1752 "parser.y"
                          {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kConfig;
@@ -5749,127 +5818,142 @@ yyreduce:
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5753 "parser.cpp"
+#line 5822 "parser.cpp"
     break;
 
-  case 246: /* show_statement: SHOW PROFILES  */
-#line 1716 "parser.y"
+  case 251: /* show_statement: SHOW PROFILES  */
+#line 1759 "parser.y"
                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kProfiles;
 }
-#line 5762 "parser.cpp"
+#line 5831 "parser.cpp"
     break;
 
-  case 247: /* show_statement: SHOW BUFFER  */
-#line 1720 "parser.y"
+  case 252: /* show_statement: SHOW BUFFER  */
+#line 1763 "parser.y"
               {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBuffer;
 }
-#line 5771 "parser.cpp"
+#line 5840 "parser.cpp"
     break;
 
-  case 248: /* show_statement: SHOW MEMINDEX  */
-#line 1724 "parser.y"
+  case 253: /* show_statement: SHOW MEMINDEX  */
+#line 1767 "parser.y"
                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kMemIndex;
 }
-#line 5780 "parser.cpp"
+#line 5849 "parser.cpp"
     break;
 
-  case 249: /* show_statement: SHOW QUERIES  */
-#line 1728 "parser.y"
+  case 254: /* show_statement: SHOW INDEX IDENTIFIER  */
+#line 1771 "parser.y"
+                        {
+    if (strcasecmp((yyvsp[0].str_value), "builds") != 0) {
+        free((yyvsp[0].str_value));
+        yyerror(&yyloc, scanner, result, "Unknown show statement");
+        YYERROR;
+    }
+    free((yyvsp[0].str_value));
+    (yyval.show_stmt) = new infinity::ShowStatement();
+    (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndexBuilds;
+}
+#line 5864 "parser.cpp"
+    break;
+
+  case 255: /* show_statement: SHOW QUERIES  */
+#line 1781 "parser.y"
                {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kQueries;
 }
-#line 5789 "parser.cpp"
+#line 5873 "parser.cpp"
     break;
 
-  case 250: /* show_statement: SHOW QUERY SESSION LONG_VALUE  */
-#line 1732 "parser.y"
+  case 256: /* show_statement: SHOW QUERY SESSION LONG_VALUE  */
+#line 1785 "parser.y"
                                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kQuery;
     (yyval.show_stmt)->session_id_ = (yyvsp[0].long_value);
 }
-#line 5799 "parser.cpp"
+#line 5883 "parser.cpp"
     break;
 
-  case 251: /* show_statement: SHOW TRANSACTIONS  */
-#line 1737 "parser.y"
+  case 257: /* show_statement: SHOW TRANSACTIONS  */
+#line 1790 "parser.y"
                     {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTransactions;
 }
-#line 5808 "parser.cpp"
+#line 5892 "parser.cpp"
     break;
 
-  case 252: /* show_statement: SHOW TRANSACTION LONG_VALUE  */
-#line 1741 "parser.y"
+  case 258: /* show_statement: SHOW TRANSACTION LONG_VALUE  */
+#line 1794 "parser.y"
                               {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTransaction;
     (yyval.show_stmt)->txn_id_ = (yyvsp[0].long_value);
 }
-#line 5818 "parser.cpp"
+#line 5902 "parser.cpp"
     break;
 
-  case 253: /* show_statement: SHOW SESSION VARIABLES  */
-#line 1746 "parser.y"
+  case 259: /* show_statement: SHOW SESSION VARIABLES  */
+#line 1799 "parser.y"
                          {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSessionVariables;
 }
-#line 5827 "parser.cpp"
+#line 5911 "parser.cpp"
     break;
 
-  case 254: /* show_statement: SHOW GLOBAL VARIABLES  */
-#line 1750 "parser.y"
+  case 260: /* show_statement: SHOW GLOBAL VARIABLES  */
+#line 1803 "parser.y"
                         {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kGlobalVariables;
 }
-#line 5836 "parser.cpp"
+#line 5920 "parser.cpp"
     break;
 
-  case 255: /* show_statement: SHOW SESSION VARIABLE IDENTIFIER  */
-#line 1754 "parser.y"
+  case 261: /* show_statement: SHOW SESSION VARIABLE IDENTIFIER  */
+#line 1807 "parser.y"
                                    {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSessionVariable;
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5847 "parser.cpp"
+#line 5931 "parser.cpp"
     break;
 
-  case 256: /* show_statement: SHOW GLOBAL VARIABLE IDENTIFIER  */
-#line 1760 "parser.y"
+  case 262: /* show_statement: SHOW GLOBAL VARIABLE IDENTIFIER  */
+#line 1813 "parser.y"
                                   {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kGlobalVariable;
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5858 "parser.cpp"
+#line 5942 "parser.cpp"
     break;
 
-  case 257: /* show_statement: SHOW DATABASE IDENTIFIER  */
-#line 1766 "parser.y"
+  case 263: /* show_statement: SHOW DATABASE IDENTIFIER  */
+#line 1819 "parser.y"
                            {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kDatabase;
     (yyval.show_stmt)->schema_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 5869 "parser.cpp"
+#line 5953 "parser.cpp"
     break;
 
-  case 258: /* show_statement: SHOW TABLE table_name  */
-#line 1772 "parser.y"
+  case 264: /* show_statement: SHOW TABLE table_name  */
+#line 1825 "parser.y"
                         {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTable;
@@ -5881,11 +5965,11 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 5885 "parser.cpp"
+#line 5969 "parser.cpp"
     break;
 
-  case 259: /* show_statement: SHOW TABLE table_name COLUMNS  */
-#line 1783 "parser.y"
+  case 265: /* show_statement: SHOW TABLE table_name COLUMNS  */
+#line 1836 "parser.y"
                                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kColumns;
@@ -5897,11 +5981,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 5901 "parser.cpp"
+#line 5985 "parser.cpp"
     break;
 
-  case 260: /* show_statement: SHOW TABLE table_name SEGMENTS  */
-#line 1794 "parser.y"
+  case 266: /* show_statement: SHOW TABLE table_name SEGMENTS  */
+#line 1847 "parser.y"
                                  {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegments;
@@ -5913,11 +5997,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 5917 "parser.cpp"
+#line 6001 "parser.cpp"
     break;
 
-  case 261: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE  */
-#line 1805 "parser.y"
+  case 267: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE  */
+#line 1858 "parser.y"
                                            {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegment;
@@ -5930,11 +6014,11 @@ yyreduce:
     (yyval.show_stmt)->segment_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-2].table_name_t);
 }
-#line 5934 "parser.cpp"
+#line 6018 "parser.cpp"
     break;
 
-  case 262: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCKS  */
-#line 1817 "parser.y"
+  case 268: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCKS  */
+#line 1870 "parser.y"
                                                   {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlocks;
@@ -5947,11 +6031,11 @@ yyreduce:
     (yyval.show_stmt)->segment_id_ = (yyvsp[-1].long_value);
     delete (yyvsp[-3].table_name_t);
 }
-#line 5951 "parser.cpp"
+#line 6035 "parser.cpp"
     break;
 
-  case 263: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
-#line 1829 "parser.y"
+  case 269: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
+#line 1882 "parser.y"
                                                             {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlock;
@@ -5965,11 +6049,11 @@ yyreduce:
     (yyval.show_stmt)->block_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-4].table_name_t);
 }
-#line 5969 "parser.cpp"
+#line 6053 "parser.cpp"
     break;
 
-  case 264: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE COLUMN LONG_VALUE  */
-#line 1842 "parser.y"
+  case 270: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE COLUMN LONG_VALUE  */
+#line 1895 "parser.y"
                                                                               {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlockColumn;
@@ -5984,11 +6068,11 @@ yyreduce:
     (yyval.show_stmt)->column_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-6].table_name_t);
 }
-#line 5988 "parser.cpp"
+#line 6072 "parser.cpp"
     break;
 
-  case 265: /* show_statement: SHOW TABLE table_name INDEXES  */
-#line 1856 "parser.y"
+  case 271: /* show_statement: SHOW TABLE table_name INDEXES  */
+#line 1909 "parser.y"
                                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndexes;
@@ -6000,11 +6084,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 6004 "parser.cpp"
+#line 6088 "parser.cpp"
     break;
 
-  case 266: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER  */
-#line 1867 "parser.y"
+  case 272: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER  */
+#line 1920 "parser.y"
                                          {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndex;
@@ -6019,11 +6103,11 @@ yyreduce:
     (yyval.show_stmt)->index_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6023 "parser.cpp"
+#line 6107 "parser.cpp"
     break;
 
-  case 267: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER SEGMENT LONG_VALUE  */
-#line 1881 "parser.y"
+  case 273: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER SEGMENT LONG_VALUE  */
+#line 1934 "parser.y"
                                                             {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndexSegment;
@@ -6040,11 +6124,11 @@ yyreduce:
 
     (yyval.show_stmt)->segment_id_ = (yyvsp[0].long_value);
 }
-#line 6044 "parser.cpp"
+#line 6128 "parser.cpp"
     break;
 
-  case 268: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER SEGMENT LONG_VALUE CHUNK LONG_VALUE  */
-#line 1897 "parser.y"
+  case 274: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER SEGMENT LONG_VALUE CHUNK LONG_VALUE  */
+#line 1950 "parser.y"
                                                                              {
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndexChunk;
@@ -6062,121 +6146,121 @@ yyreduce:
       (yyval.show_stmt)->segment_id_ = (yyvsp[-2].long_value);
       (yyval.show_stmt)->chunk_id_ = (yyvsp[0].long_value);
 }
-#line 6066 "parser.cpp"
+#line 6150 "parser.cpp"
     break;
 
-  case 269: /* show_statement: SHOW LOGS  */
-#line 1914 "parser.y"
+  case 275: /* show_statement: SHOW LOGS  */
+#line 1967 "parser.y"
             {
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kLogs;
 }
-#line 6075 "parser.cpp"
+#line 6159 "parser.cpp"
     break;
 
-  case 270: /* show_statement: SHOW DELTA LOGS  */
-#line 1918 "parser.y"
+  case 276: /* show_statement: SHOW DELTA LOGS  */
+#line 1971 "parser.y"
                   {
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kDeltaLogs;
 }
-#line 6084 "parser.cpp"
+#line 6168 "parser.cpp"
     break;
 
-  case 271: /* show_statement: SHOW CATALOGS  */
-#line 1922 "parser.y"
+  case 277: /* show_statement: SHOW CATALOGS  */
+#line 1975 "parser.y"
                 {
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kCatalogs;
 }
-#line 6093 "parser.cpp"
+#line 6177 "parser.cpp"
     break;
 
-  case 272: /* show_statement: SHOW PERSISTENCE FILES  */
-#line 1926 "parser.y"
+  case 278: /* show_statement: SHOW PERSISTENCE FILES  */
+#line 1979 "parser.y"
                          {
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kPersistenceFiles;
 }
-#line 6102 "parser.cpp"
+#line 6186 "parser.cpp"
     break;
 
-  case 273: /* show_statement: SHOW PERSISTENCE OBJECTS  */
-#line 1930 "parser.y"
+  case 279: /* show_statement: SHOW PERSISTENCE OBJECTS  */
+#line 1983 "parser.y"
                            {
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kPersistenceObjects;
 }
-#line 6111 "parser.cpp"
+#line 6195 "parser.cpp"
     break;
 
-  case 274: /* show_statement: SHOW PERSISTENCE OBJECT STRING  */
-#line 1934 "parser.y"
+  case 280: /* show_statement: SHOW PERSISTENCE OBJECT STRING  */
+#line 1987 "parser.y"
                                  {
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kPersistenceObject;
       (yyval.show_stmt)->file_name_ = (yyvsp[0].str_value);
       free((yyvsp[0].str_value));
 }
-#line 6122 "parser.cpp"
+#line 6206 "parser.cpp"
     break;
 
-  case 275: /* show_statement: SHOW MEMORY  */
-#line 1940 "parser.y"
+  case 281: /* show_statement: SHOW MEMORY  */
+#line 1993 "parser.y"
               {
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kMemory;
 }
-#line 6131 "parser.cpp"
+#line 6215 "parser.cpp"
     break;
 
-  case 276: /* show_statement: SHOW MEMORY OBJECTS  */
-#line 1944 "parser.y"
+  case 282: /* show_statement: SHOW MEMORY OBJECTS  */
+#line 1997 "parser.y"
                       {
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kMemoryObjects;
 }
-#line 6140 "parser.cpp"
+#line 6224 "parser.cpp"
     break;
 
-  case 277: /* show_statement: SHOW MEMORY ALLOCATION  */
-#line 1948 "parser.y"
+  case 283: /* show_statement: SHOW MEMORY ALLOCATION  */
+#line 2001 "parser.y"
                          {
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kMemoryAllocation;
 }
-#line 6149 "parser.cpp"
+#line 6233 "parser.cpp"
     break;
 
-  case 278: /* flush_statement: FLUSH DATA  */
-#line 1956 "parser.y"
+  case 284: /* flush_statement: FLUSH DATA  */
+#line 2009 "parser.y"
                             {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kData;
 }
-#line 6158 "parser.cpp"
+#line 6242 "parser.cpp"
     break;
 
-  case 279: /* flush_statement: FLUSH LOG  */
-#line 1960 "parser.y"
+  case 285: /* flush_statement: FLUSH LOG  */
+#line 2013 "parser.y"
             {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kLog;
 }
-#line 6167 "parser.cpp"
+#line 6251 "parser.cpp"
     break;
 
-  case 280: /* flush_statement: FLUSH BUFFER  */
-#line 1964 "parser.y"
+  case 286: /* flush_statement: FLUSH BUFFER  */
+#line 2017 "parser.y"
                {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kBuffer;
 }
-#line 6176 "parser.cpp"
+#line 6260 "parser.cpp"
     break;
 
-  case 281: /* optimize_statement: OPTIMIZE table_name  */
-#line 1972 "parser.y"
+  case 287: /* optimize_statement: OPTIMIZE table_name  */
+#line 2025 "parser.y"
                                         {
     (yyval.optimize_stmt) = new infinity::OptimizeStatement();
     if((yyvsp[0].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -6187,11 +6271,11 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 6191 "parser.cpp"
+#line 6275 "parser.cpp"
     break;
 
-  case 282: /* optimize_statement: OPTIMIZE IDENTIFIER ON table_name with_index_param_list  */
-#line 1983 "parser.y"
+  case 288: /* optimize_statement: OPTIMIZE IDENTIFIER ON table_name with_index_param_list  */
+#line 2036 "parser.y"
                                                          {
     (yyval.optimize_stmt) = new infinity::OptimizeStatement();
     if((yyvsp[-1].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -6211,54 +6295,54 @@ yyreduce:
     }
     delete (yyvsp[0].with_index_param_list_t);
 }
-#line 6215 "parser.cpp"
+#line 6299 "parser.cpp"
     break;
 
-  case 283: /* command_statement: USE IDENTIFIER  */
-#line 2006 "parser.y"
+  case 289: /* command_statement: USE IDENTIFIER  */
+#line 2059 "parser.y"
                                   {
     (yyval.command_stmt) = new infinity::CommandStatement();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::UseCmd>((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 6226 "parser.cpp"
+#line 6310 "parser.cpp"
     break;
 
-  case 284: /* command_statement: EXPORT PROFILE LONG_VALUE file_path  */
-#line 2012 "parser.y"
+  case 290: /* command_statement: EXPORT PROFILE LONG_VALUE file_path  */
+#line 2065 "parser.y"
                                       {
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::ExportCmd>((yyvsp[0].str_value), infinity::ExportType::kProfileRecord, (yyvsp[-1].long_value));
     free((yyvsp[0].str_value));
 }
-#line 6236 "parser.cpp"
+#line 6320 "parser.cpp"
     break;
 
-  case 285: /* command_statement: SET SESSION IDENTIFIER ON  */
-#line 2017 "parser.y"
+  case 291: /* command_statement: SET SESSION IDENTIFIER ON  */
+#line 2070 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 6247 "parser.cpp"
+#line 6331 "parser.cpp"
     break;
 
-  case 286: /* command_statement: SET SESSION IDENTIFIER OFF  */
-#line 2023 "parser.y"
+  case 292: /* command_statement: SET SESSION IDENTIFIER OFF  */
+#line 2076 "parser.y"
                              {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 6258 "parser.cpp"
+#line 6342 "parser.cpp"
     break;
 
-  case 287: /* command_statement: SET SESSION IDENTIFIER IDENTIFIER  */
-#line 2029 "parser.y"
+  case 293: /* command_statement: SET SESSION IDENTIFIER IDENTIFIER  */
+#line 2082 "parser.y"
                                     {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -6267,55 +6351,55 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 6271 "parser.cpp"
+#line 6355 "parser.cpp"
     break;
 
-  case 288: /* command_statement: SET SESSION IDENTIFIER LONG_VALUE  */
-#line 2037 "parser.y"
+  case 294: /* command_statement: SET SESSION IDENTIFIER LONG_VALUE  */
+#line 2090 "parser.y"
                                     {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 6282 "parser.cpp"
+#line 6366 "parser.cpp"
     break;
 
-  case 289: /* command_statement: SET SESSION IDENTIFIER DOUBLE_VALUE  */
-#line 2043 "parser.y"
+  case 295: /* command_statement: SET SESSION IDENTIFIER DOUBLE_VALUE  */
+#line 2096 "parser.y"
                                       {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 6293 "parser.cpp"
+#line 6377 "parser.cpp"
     break;
 
-  case 290: /* command_statement: SET GLOBAL IDENTIFIER ON  */
-#line 2049 "parser.y"
+  case 296: /* command_statement: SET GLOBAL IDENTIFIER ON  */
+#line 2102 "parser.y"
                            {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 6304 "parser.cpp"
+#line 6388 "parser.cpp"
     break;
 
-  case 291: /* command_statement: SET GLOBAL IDENTIFIER OFF  */
-#line 2055 "parser.y"
+  case 297: /* command_statement: SET GLOBAL IDENTIFIER OFF  */
+#line 2108 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 6315 "parser.cpp"
+#line 6399 "parser.cpp"
     break;
 
-  case 292: /* command_statement: SET GLOBAL IDENTIFIER IDENTIFIER  */
-#line 2061 "parser.y"
+  case 298: /* command_statement: SET GLOBAL IDENTIFIER IDENTIFIER  */
+#line 2114 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -6324,55 +6408,55 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 6328 "parser.cpp"
+#line 6412 "parser.cpp"
     break;
 
-  case 293: /* command_statement: SET GLOBAL IDENTIFIER LONG_VALUE  */
-#line 2069 "parser.y"
+  case 299: /* command_statement: SET GLOBAL IDENTIFIER LONG_VALUE  */
+#line 2122 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 6339 "parser.cpp"
+#line 6423 "parser.cpp"
     break;
 
-  case 294: /* command_statement: SET GLOBAL IDENTIFIER DOUBLE_VALUE  */
-#line 2075 "parser.y"
+  case 300: /* command_statement: SET GLOBAL IDENTIFIER DOUBLE_VALUE  */
+#line 2128 "parser.y"
                                      {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 6350 "parser.cpp"
+#line 6434 "parser.cpp"
     break;
 
-  case 295: /* command_statement: SET CONFIG IDENTIFIER ON  */
-#line 2081 "parser.y"
+  case 301: /* command_statement: SET CONFIG IDENTIFIER ON  */
+#line 2134 "parser.y"
                            {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 6361 "parser.cpp"
+#line 6445 "parser.cpp"
     break;
 
-  case 296: /* command_statement: SET CONFIG IDENTIFIER OFF  */
-#line 2087 "parser.y"
+  case 302: /* command_statement: SET CONFIG IDENTIFIER OFF  */
+#line 2140 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 6372 "parser.cpp"
+#line 6456 "parser.cpp"
     break;
 
-  case 297: /* command_statement: SET CONFIG IDENTIFIER IDENTIFIER  */
-#line 2093 "parser.y"
+  case 303: /* command_statement: SET CONFIG IDENTIFIER IDENTIFIER  */
+#line 2146 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -6381,33 +6465,33 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 6385 "parser.cpp"
+#line 6469 "parser.cpp"
     break;
 
-  case 298: /* command_statement: SET CONFIG IDENTIFIER LONG_VALUE  */
-#line 2101 "parser.y"
+  case 304: /* command_statement: SET CONFIG IDENTIFIER LONG_VALUE  */
+#line 2154 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 6396 "parser.cpp"
+#line 6480 "parser.cpp"
     break;
 
-  case 299: /* command_statement: SET CONFIG IDENTIFIER DOUBLE_VALUE  */
-#line 2107 "parser.y"
+  case 305: /* command_statement: SET CONFIG IDENTIFIER DOUBLE_VALUE  */
+#line 2160 "parser.y"
                                      {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 6407 "parser.cpp"
+#line 6491 "parser.cpp"
     break;
 
-  case 300: /* command_statement: LOCK TABLE table_name  */
-#line 2113 "parser.y"
+  case 306: /* command_statement: LOCK TABLE table_name  */
+#line 2166 "parser.y"
                         {
     (yyval.command_stmt) = new infinity::CommandStatement();
     ParserHelper::ToLower((yyvsp[0].table_name_t)->schema_name_ptr_);
@@ -6417,11 +6501,11 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 6421 "parser.cpp"
+#line 6505 "parser.cpp"
     break;
 
-  case 301: /* command_statement: UNLOCK TABLE table_name  */
-#line 2122 "parser.y"
+  case 307: /* command_statement: UNLOCK TABLE table_name  */
+#line 2175 "parser.y"
                           {
     (yyval.command_stmt) = new infinity::CommandStatement();
     ParserHelper::ToLower((yyvsp[0].table_name_t)->schema_name_ptr_);
@@ -6431,11 +6515,51 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 6435 "parser.cpp"
+#line 6519 "parser.cpp"
+    break;
+
+  case 308: /* command_statement: IDENTIFIER TABLE table_name  */
+#line 2184 "parser.y"
+                              {
+    if (strcasecmp((yyvsp[-2].str_value), "scrub") != 0) {
+        free((yyvsp[-2].str_value));
+        free((yyvsp[0].table_name_t)->schema_name_ptr_);
+        free((yyvsp[0].table_name_t)->table_name_ptr_);
+        delete (yyvsp[0].table_name_t);
+        yyerror(&yyloc, scanner, result, "Unknown command");
+        YYERROR;
+    }
+    free((yyvsp[-2].str_value));
+    (yyval.command_stmt) = new infinity::CommandStatement();
+    ParserHelper::ToLower((yyvsp[0].table_name_t)->schema_name_ptr_);
+    ParserHelper::ToLower((yyvsp[0].table_name_t)->table_name_ptr_);
+    (yyval.command_stmt)->command_info_ = std::make_shared<infinity::ScrubCmd>((yyvsp[0].table_name_t)->schema_name_ptr_, (yyvsp[0].table_name_t)->table_name_ptr_);
+    free((yyvsp[0].table_name_t)->schema_name_ptr_);
+    free((yyvsp[0].table_name_t)->table_name_ptr_);
+    delete (yyvsp[0].table_name_t);
+}
+#line 6542 "parser.cpp"
+    break;
+
+  case 309: /* command_statement: IDENTIFIER INDEX IDENTIFIER LONG_VALUE  */
+#line 2202 "parser.y"
+                                         {
+    if (strcasecmp((yyvsp[-3].str_value), "cancel") != 0 || strcasecmp((yyvsp[-1].str_value), "build") != 0) {
+        free((yyvsp[-3].str_value));
+        free((yyvsp[-1].str_value));
+        yyerror(&yyloc, scanner, result, "Unknown command");
+        YYERROR;
+    }
+    free((yyvsp[-3].str_value));
+    free((yyvsp[-1].str_value));
+    (yyval.command_stmt) = new infinity::CommandStatement();
+    (yyval.command_stmt)->command_info_ = std::make_shared<infinity::CancelIndexBuildCmd>((yyvsp[0].long_value));
+}
+#line 6559 "parser.cpp"
     break;
 
-  case 302: /* compact_statement: COMPACT TABLE table_name  */
-#line 2132 "parser.y"
+  case 310: /* compact_statement: COMPACT TABLE table_name  */
+#line 2215 "parser.y"
                                             {
     std::string schema_name;
     if ((yyvsp[0].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -6448,41 +6572,41 @@ yyreduce:
     (yyval.compact_stmt) = new infinity::ManualCompactStatement(std::move(schema_name), std::move(table_name));
     delete (yyvsp[0].table_name_t);
 }
-#line 6452 "parser.cpp"
+#line 6576 "parser.cpp"
     break;
 
-  case 303: /* admin_statement: ADMIN SHOW CATALOGS  */
-#line 2145 "parser.y"
+  case 311: /* admin_statement: ADMIN SHOW CATALOGS  */
+#line 2228 "parser.y"
                                      {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListCatalogs;
 }
-#line 6461 "parser.cpp"
+#line 6585 "parser.cpp"
     break;
 
-  case 304: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE  */
-#line 2149 "parser.y"
+  case 312: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE  */
+#line 2232 "parser.y"
                                 {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowCatalog;
      (yyval.admin_stmt)->catalog_file_index_ = (yyvsp[0].long_value);
 }
-#line 6471 "parser.cpp"
+#line 6595 "parser.cpp"
     break;
 
-  case 305: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASES  */
-#line 2154 "parser.y"
+  case 313: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASES  */
+#line 2237 "parser.y"
                                                      {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListDatabases;
      (yyval.admin_stmt)->catalog_file_start_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->catalog_file_end_index_ = (yyvsp[-1].long_value);
 }
-#line 6482 "parser.cpp"
+#line 6606 "parser.cpp"
     break;
 
-  case 306: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE  */
-#line 2160 "parser.y"
+  case 314: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE  */
+#line 2243 "parser.y"
                                                                {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowDatabase;
@@ -6490,11 +6614,11 @@ yyreduce:
      (yyval.admin_stmt)->catalog_file_end_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->database_meta_index_ = (yyvsp[0].long_value);
 }
-#line 6494 "parser.cpp"
+#line 6618 "parser.cpp"
     break;
 
-  case 307: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLES  */
-#line 2167 "parser.y"
+  case 315: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLES  */
+#line 2250 "parser.y"
                                                                                  {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListTables;
@@ -6503,11 +6627,11 @@ yyreduce:
      (yyval.admin_stmt)->database_meta_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->database_entry_index_ = (yyvsp[-1].long_value);
 }
-#line 6507 "parser.cpp"
+#line 6631 "parser.cpp"
     break;
 
-  case 308: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE  */
-#line 2175 "parser.y"
+  case 316: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE  */
+#line 2258 "parser.y"
                                                                                            {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowTable;
@@ -6517,11 +6641,11 @@ yyreduce:
      (yyval.admin_stmt)->database_entry_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->table_meta_index_ = (yyvsp[0].long_value);
 }
-#line 6521 "parser.cpp"
+#line 6645 "parser.cpp"
     break;
 
-  case 309: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE COLUMNS  */
-#line 2184 "parser.y"
+  case 317: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE COLUMNS  */
+#line 2267 "parser.y"
                                                                                                               {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowColumn;
@@ -6532,11 +6656,11 @@ yyreduce:
      (yyval.admin_stmt)->table_meta_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->table_entry_index_ = (yyvsp[-1].long_value);
 }
-#line 6536 "parser.cpp"
+#line 6660 "parser.cpp"
     break;
 
-  case 310: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENTS  */
-#line 2194 "parser.y"
+  case 318: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENTS  */
+#line 2277 "parser.y"
                                                                                                                {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListSegments;
@@ -6547,11 +6671,11 @@ yyreduce:
      (yyval.admin_stmt)->table_meta_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->table_entry_index_ = (yyvsp[-1].long_value);
 }
-#line 6551 "parser.cpp"
+#line 6675 "parser.cpp"
     break;
 
-  case 311: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE  */
-#line 2204 "parser.y"
+  case 319: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE  */
+#line 2287 "parser.y"
                                                                                                                          {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowSegment;
@@ -6563,11 +6687,11 @@ yyreduce:
      (yyval.admin_stmt)->table_entry_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->segment_index_ = (yyvsp[0].long_value);
 }
-#line 6567 "parser.cpp"
+#line 6691 "parser.cpp"
     break;
 
-  case 312: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE BLOCKS  */
-#line 2215 "parser.y"
+  case 320: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE BLOCKS  */
+#line 2298 "parser.y"
                                                                                                                                 {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListBlocks;
@@ -6579,11 +6703,11 @@ yyreduce:
      (yyval.admin_stmt)->table_entry_index_ = (yyvsp[-3].long_value);
      (yyval.admin_stmt)->segment_index_ = (yyvsp[-1].long_value);
 }
-#line 6583 "parser.cpp"
+#line 6707 "parser.cpp"
     break;
 
-  case 313: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
-#line 2226 "parser.y"
+  case 321: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
+#line 2309 "parser.y"
                                                                                                                                           {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowBlock;
@@ -6596,11 +6720,11 @@ yyreduce:
      (yyval.admin_stmt)->segment_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->block_index_ = (yyvsp[0].long_value);
 }
-#line 6600 "parser.cpp"
+#line 6724 "parser.cpp"
     break;
 
-  case 314: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE BLOCK LONG_VALUE COLUMNS  */
-#line 2238 "parser.y"
+  case 322: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE BLOCK LONG_VALUE COLUMNS  */
+#line 2321 "parser.y"
                                                                                                                                                   {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListColumns;
@@ -6613,11 +6737,11 @@ yyreduce:
      (yyval.admin_stmt)->segment_index_ = (yyvsp[-3].long_value);
      (yyval.admin_stmt)->block_index_ = (yyvsp[-1].long_value);
 }
-#line 6617 "parser.cpp"
+#line 6741 "parser.cpp"
     break;
 
-  case 315: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE INDEXES  */
-#line 2250 "parser.y"
+  case 323: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE INDEXES  */
+#line 2333 "parser.y"
                                                                                                               {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListIndexes;
@@ -6628,11 +6752,11 @@ yyreduce:
      (yyval.admin_stmt)->table_meta_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->table_entry_index_ = (yyvsp[-1].long_value);
 }
-#line 6632 "parser.cpp"
+#line 6756 "parser.cpp"
     break;
 
-  case 316: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE INDEX LONG_VALUE  */
-#line 2260 "parser.y"
+  case 324: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE INDEX LONG_VALUE  */
+#line 2343 "parser.y"
                                                                                                                        {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowIndex;
@@ -6644,11 +6768,11 @@ yyreduce:
      (yyval.admin_stmt)->table_entry_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->index_meta_index_ = (yyvsp[0].long_value);
 }
-#line 6648 "parser.cpp"
+#line 6772 "parser.cpp"
     break;
 
-  case 317: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE INDEX LONG_VALUE LONG_VALUE SEGMENTS  */
-#line 2271 "parser.y"
+  case 325: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE INDEX LONG_VALUE LONG_VALUE SEGMENTS  */
+#line 2354 "parser.y"
                                                                                                                                            {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListIndexSegments;
@@ -6661,11 +6785,11 @@ yyreduce:
      (yyval.admin_stmt)->index_meta_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->index_entry_index_ = (yyvsp[-1].long_value);
 }
-#line 6665 "parser.cpp"
+#line 6789 "parser.cpp"
     break;
 
-  case 318: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE INDEX LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE  */
-#line 2283 "parser.y"
+  case 326: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE INDEX LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE  */
+#line 2366 "parser.y"
                                                                                                                                                      {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowIndexSegment;
@@ -6679,129 +6803,129 @@ yyreduce:
      (yyval.admin_stmt)->index_entry_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->segment_index_ = (yyvsp[0].long_value);
 }
-#line 6683 "parser.cpp"
+#line 6807 "parser.cpp"
     break;
 
-  case 319: /* admin_statement: ADMIN SHOW LOGS  */
-#line 2296 "parser.y"
+  case 327: /* admin_statement: ADMIN SHOW LOGS  */
+#line 2379 "parser.y"
                   {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListLogFiles;
 }
-#line 6692 "parser.cpp"
+#line 6816 "parser.cpp"
     break;
 
-  case 320: /* admin_statement: ADMIN SHOW LOG LONG_VALUE  */
-#line 2300 "parser.y"
+  case 328: /* admin_statement: ADMIN SHOW LOG LONG_VALUE  */
+#line 2383 "parser.y"
                             {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowLogFile;
      (yyval.admin_stmt)->log_file_index_ = (yyvsp[0].long_value);
 }
-#line 6702 "parser.cpp"
+#line 6826 "parser.cpp"
     break;
 
-  case 321: /* admin_statement: ADMIN SHOW LOG LONG_VALUE INDEXES  */
-#line 2305 "parser.y"
+  case 329: /* admin_statement: ADMIN SHOW LOG LONG_VALUE INDEXES  */
+#line 2388 "parser.y"
                                     {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListLogIndexes;
      (yyval.admin_stmt)->log_file_index_ = (yyvsp[-1].long_value);
 }
-#line 6712 "parser.cpp"
+#line 6836 "parser.cpp"
     break;
 
-  case 322: /* admin_statement: ADMIN SHOW LOG LONG_VALUE INDEX LONG_VALUE  */
-#line 2310 "parser.y"
+  case 330: /* admin_statement: ADMIN SHOW LOG LONG_VALUE INDEX LONG_VALUE  */
+#line 2393 "parser.y"
                                              {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowLogIndex;
      (yyval.admin_stmt)->log_file_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->log_index_in_file_ = (yyvsp[0].long_value);
 }
-#line 6723 "parser.cpp"
+#line 6847 "parser.cpp"
     break;
 
-  case 323: /* admin_statement: ADMIN SHOW CONFIGS  */
-#line 2316 "parser.y"
+  case 331: /* admin_statement: ADMIN SHOW CONFIGS  */
+#line 2399 "parser.y"
                      {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListConfigs;
 }
-#line 6732 "parser.cpp"
+#line 6856 "parser.cpp"
     break;
 
-  case 324: /* admin_statement: ADMIN SHOW VARIABLES  */
-#line 2320 "parser.y"
+  case 332: /* admin_statement: ADMIN SHOW VARIABLES  */
+#line 2403 "parser.y"
                        {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListVariables;
 }
-#line 6741 "parser.cpp"
+#line 6865 "parser.cpp"
     break;
 
-  case 325: /* admin_statement: ADMIN SHOW VARIABLE IDENTIFIER  */
-#line 2324 "parser.y"
+  case 333: /* admin_statement: ADMIN SHOW VARIABLE IDENTIFIER  */
+#line 2407 "parser.y"
                                  {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowVariable;
      (yyval.admin_stmt)->variable_name_ = (yyvsp[0].str_value);
      free((yyvsp[0].str_value));
 }
-#line 6752 "parser.cpp"
+#line 6876 "parser.cpp"
     break;
 
-  case 326: /* admin_statement: ADMIN SHOW NODES  */
-#line 2330 "parser.y"
+  case 334: /* admin_statement: ADMIN SHOW NODES  */
+#line 2413 "parser.y"
                    {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListNodes;
 }
-#line 6761 "parser.cpp"
+#line 6885 "parser.cpp"
     break;
 
-  case 327: /* admin_statement: ADMIN SHOW NODE IDENTIFIER  */
-#line 2334 "parser.y"
+  case 335: /* admin_statement: ADMIN SHOW NODE IDENTIFIER  */
+#line 2417 "parser.y"
                              {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowNode;
      (yyval.admin_stmt)->node_name_ = (yyvsp[0].str_value);
      free((yyvsp[0].str_value));
 }
-#line 6772 "parser.cpp"
+#line 6896 "parser.cpp"
     break;
 
-  case 328: /* admin_statement: ADMIN SHOW NODE  */
-#line 2340 "parser.y"
+  case 336: /* admin_statement: ADMIN SHOW NODE  */
+#line 2423 "parser.y"
                   {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowCurrentNode;
 }
-#line 6781 "parser.cpp"
+#line 6905 "parser.cpp"
     break;
 
-  case 329: /* admin_statement: ADMIN SET ADMIN  */
-#line 2344 "parser.y"
+  case 337: /* admin_statement: ADMIN SET ADMIN  */
+#line 2427 "parser.y"
                   {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kSetRole;
      (yyval.admin_stmt)->admin_node_role_ = infinity::AdminNodeRole::kAdmin;
 }
-#line 6791 "parser.cpp"
+#line 6915 "parser.cpp"
     break;
 
-  case 330: /* admin_statement: ADMIN SET STANDALONE  */
-#line 2349 "parser.y"
+  case 338: /* admin_statement: ADMIN SET STANDALONE  */
+#line 2432 "parser.y"
                        {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kSetRole;
      (yyval.admin_stmt)->admin_node_role_ = infinity::AdminNodeRole::kStandalone;
 }
-#line 6801 "parser.cpp"
+#line 6925 "parser.cpp"
     break;
 
-  case 331: /* admin_statement: ADMIN SET LEADER USING STRING  */
-#line 2354 "parser.y"
+  case 339: /* admin_statement: ADMIN SET LEADER USING STRING  */
+#line 2437 "parser.y"
                                 {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kSetRole;
@@ -6809,11 +6933,11 @@ yyreduce:
      (yyval.admin_stmt)->node_name_ = (yyvsp[0].str_value);
      free((yyvsp[0].str_value));
 }
-#line 6813 "parser.cpp"
+#line 6937 "parser.cpp"
     break;
 
-  case 332: /* admin_statement: ADMIN CONNECT STRING AS FOLLOWER USING STRING  */
-#line 2361 "parser.y"
+  case 340: /* admin_statement: ADMIN CONNECT STRING AS FOLLOWER USING STRING  */
+#line 2444 "parser.y"
                                                 {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kSetRole;
@@ -6823,11 +6947,11 @@ yyreduce:
      free((yyvsp[-4].str_value));
      free((yyvsp[0].str_value));
 }
-#line 6827 "parser.cpp"
+#line 6951 "parser.cpp"
     break;
 
-  case 333: /* admin_statement: ADMIN CONNECT STRING AS LEARNER USING STRING  */
-#line 2370 "parser.y"
+  case 341: /* admin_statement: ADMIN CONNECT STRING AS LEARNER USING STRING  */
+#line 2453 "parser.y"
                                                {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kSetRole;
@@ -6837,53 +6961,53 @@ yyreduce:
      free((yyvsp[-4].str_value));
      free((yyvsp[0].str_value));
 }
-#line 6841 "parser.cpp"
+#line 6965 "parser.cpp"
     break;
 
-  case 334: /* alter_statement: ALTER TABLE table_name RENAME TO IDENTIFIER  */
-#line 2380 "parser.y"
+  case 342: /* alter_statement: ALTER TABLE table_name RENAME TO IDENTIFIER  */
+#line 2463 "parser.y"
                                                               {
     auto *ret = new infinity::RenameTableStatement((yyvsp[-3].table_name_t));
     (yyval.alter_stmt) = ret;
     ret->new_table_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6852 "parser.cpp"
+#line 6976 "parser.cpp"
     break;
 
-  case 335: /* alter_statement: ALTER TABLE table_name ADD COLUMN table_column  */
-#line 2386 "parser.y"
+  case 343: /* alter_statement: ALTER TABLE table_name ADD COLUMN table_column  */
+#line 2469 "parser.y"
                                                  {
     auto *ret = new infinity::AddColumnStatement((yyvsp[-3].table_name_t));
     (yyval.alter_stmt) = ret;
     ret->column_def_ = (yyvsp[0].table_column_t);
 }
-#line 6862 "parser.cpp"
+#line 6986 "parser.cpp"
     break;
 
-  case 336: /* alter_statement: ALTER TABLE table_name DROP COLUMN IDENTIFIER  */
-#line 2391 "parser.y"
+  case 344: /* alter_statement: ALTER TABLE table_name DROP COLUMN IDENTIFIER  */
+#line 2474 "parser.y"
                                                 {
     auto *ret = new infinity::DropColumnStatement((yyvsp[-3].table_name_t));
     (yyval.alter_stmt) = ret;
     ret->column_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6873 "parser.cpp"
+#line 6997 "parser.cpp"
     break;
 
-  case 337: /* alter_statement: ALTER TABLE table_name ALTER COLUMN table_column  */
-#line 2397 "parser.y"
+  case 345: /* alter_statement: ALTER TABLE table_name ALTER COLUMN table_column  */
+#line 2480 "parser.y"
                                                    {
     auto *ret = new infinity::AlterColumnStatement((yyvsp[-3].table_name_t));
     (yyval.alter_stmt) = ret;
     ret->column_def_ = (yyvsp[0].table_column_t);
 }
-#line 6883 "parser.cpp"
+#line 7007 "parser.cpp"
     break;
 
-  case 338: /* alter_statement: ALTER TABLE table_name RENAME COLUMN IDENTIFIER TO IDENTIFIER  */
-#line 2402 "parser.y"
+  case 346: /* alter_statement: ALTER TABLE table_name RENAME COLUMN IDENTIFIER TO IDENTIFIER  */
+#line 2485 "parser.y"
                                                                 {
     auto *ret = new infinity::RenameColumnStatement((yyvsp[-5].table_name_t));
     (yyval.alter_stmt) = ret;
@@ -6892,38 +7016,38 @@ yyreduce:
     ret->new_column_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6896 "parser.cpp"
+#line 7020 "parser.cpp"
     break;
 
-  case 339: /* expr_array: expr_alias  */
-#line 2415 "parser.y"
+  case 347: /* expr_array: expr_alias  */
+#line 2498 "parser.y"
                         {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 6905 "parser.cpp"
+#line 7029 "parser.cpp"
     break;
 
-  case 340: /* expr_array: expr_array ',' expr_alias  */
-#line 2419 "parser.y"
+  case 348: /* expr_array: expr_array ',' expr_alias  */
+#line 2502 "parser.y"
                             {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 6914 "parser.cpp"
+#line 7038 "parser.cpp"
     break;
 
-  case 341: /* expr_array_list: '(' expr_array ')'  */
-#line 2424 "parser.y"
+  case 349: /* expr_array_list: '(' expr_array ')'  */
+#line 2507 "parser.y"
                                      {
     (yyval.expr_array_list_t) = new std::vector<std::vector<infinity::ParsedExpr*>*>();
     (yyval.expr_array_list_t)->push_back((yyvsp[-1].expr_array_t));
 }
-#line 6923 "parser.cpp"
+#line 7047 "parser.cpp"
     break;
 
-  case 342: /* expr_array_list: expr_array_list ',' '(' expr_array ')'  */
-#line 2428 "parser.y"
+  case 350: /* expr_array_list: expr_array_list ',' '(' expr_array ')'  */
+#line 2511 "parser.y"
                                          {
     if(!(yyvsp[-4].expr_array_list_t)->empty() && (yyvsp[-4].expr_array_list_t)->back()->size() != (yyvsp[-1].expr_array_t)->size()) {
         yyerror(&yyloc, scanner, result, "The expr_array in list shall have the same size.");
@@ -6945,57 +7069,65 @@ yyreduce:
     (yyvsp[-4].expr_array_list_t)->push_back((yyvsp[-1].expr_array_t));
     (yyval.expr_array_list_t) = (yyvsp[-4].expr_array_list_t);
 }
-#line 6949 "parser.cpp"
+#line 7073 "parser.cpp"
     break;
 
-  case 343: /* expr_alias: expr AS IDENTIFIER  */
-#line 2461 "parser.y"
+  case 351: /* expr_alias: expr AS IDENTIFIER  */
+#line 2544 "parser.y"
                                 {
     (yyval.expr_t) = (yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.expr_t)->alias_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6960 "parser.cpp"
+#line 7084 "parser.cpp"
     break;
 
-  case 344: /* expr_alias: expr  */
-#line 2467 "parser.y"
+  case 352: /* expr_alias: expr  */
+#line 2550 "parser.y"
        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 6968 "parser.cpp"
+#line 7092 "parser.cpp"
     break;
 
-  case 350: /* operand: '(' expr ')'  */
-#line 2477 "parser.y"
+  case 358: /* operand: '(' expr ')'  */
+#line 2560 "parser.y"
                       {
     (yyval.expr_t) = (yyvsp[-1].expr_t);
 }
-#line 6976 "parser.cpp"
+#line 7100 "parser.cpp"
     break;
 
-  case 351: /* operand: '(' select_without_paren ')'  */
-#line 2480 "parser.y"
+  case 359: /* operand: '(' select_without_paren ')'  */
+#line 2563 "parser.y"
                                {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kScalar;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6987 "parser.cpp"
+#line 7111 "parser.cpp"
     break;
 
-  case 352: /* operand: constant_expr  */
-#line 2486 "parser.y"
+  case 360: /* operand: constant_expr  */
+#line 2569 "parser.y"
                 {
     (yyval.expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6995 "parser.cpp"
+#line 7119 "parser.cpp"
     break;
 
-  case 363: /* match_tensor_expr: MATCH TENSOR '(' column_expr ',' common_array_expr ',' STRING ',' STRING ',' STRING optional_search_filter_expr ')'  */
-#line 2502 "parser.y"
+  case 371: /* operand: '?'  */
+#line 2582 "parser.y"
+      {
+    (yyval.expr_t) = new infinity::ParameterExpr(result->parameter_count_++);
+}
+#line 7127 "parser.cpp"
+    break;
+
+  case 372: /* match_tensor_expr: MATCH TENSOR '(' column_expr ',' common_array_expr ',' STRING ',' STRING ',' STRING optional_search_filter_expr ')'  */
+#line 2588 "parser.y"
                                                                                                                                         {
     auto match_tensor_expr = std::make_unique<infinity::MatchTensorExpr>();
     // search column
@@ -7011,11 +7143,11 @@ yyreduce:
     match_tensor_expr->SetOptionalFilter((yyvsp[-1].expr_t));
     (yyval.expr_t) = match_tensor_expr.release();
 }
-#line 7015 "parser.cpp"
+#line 7147 "parser.cpp"
     break;
 
-  case 364: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' USING INDEX '(' IDENTIFIER ')' with_index_param_list  */
-#line 2520 "parser.y"
+  case 373: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' USING INDEX '(' IDENTIFIER ')' with_index_param_list  */
+#line 2606 "parser.y"
                                                                                                                                                                                    {
     infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
     (yyval.expr_t) = match_vector_expr;
@@ -7061,11 +7193,11 @@ Error1:
 Return1:
     ;
 }
-#line 7065 "parser.cpp"
+#line 7197 "parser.cpp"
     break;
 
-  case 365: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' IGNORE INDEX  */
-#line 2566 "parser.y"
+  case 374: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' IGNORE INDEX  */
+#line 2652 "parser.y"
                                                                                                                        {
     infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
     (yyval.expr_t) = match_vector_expr;
@@ -7104,11 +7236,11 @@ Error2:
 Return2:
     ;
 }
-#line 7108 "parser.cpp"
+#line 7240 "parser.cpp"
     break;
 
-  case 366: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' with_index_param_list  */
-#line 2605 "parser.y"
+  case 375: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' with_index_param_list  */
+#line 2691 "parser.y"
                                                                                                                                 {
     infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
     (yyval.expr_t) = match_vector_expr;
@@ -7151,11 +7283,11 @@ Error3:
 Return3:
     ;
 }
-#line 7155 "parser.cpp"
+#line 7287 "parser.cpp"
     break;
 
-  case 367: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING optional_search_filter_expr ')' with_index_param_list  */
-#line 2648 "parser.y"
+  case 376: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING optional_search_filter_expr ')' with_index_param_list  */
+#line 2734 "parser.y"
                                                                                                                  {
     infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
     (yyval.expr_t) = match_vector_expr;
@@ -7199,11 +7331,11 @@ Error4:
 Return4:
     ;
 }
-#line 7203 "parser.cpp"
+#line 7335 "parser.cpp"
     break;
 
-  case 368: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' USING INDEX '(' IDENTIFIER ')' with_index_param_list  */
-#line 2695 "parser.y"
+  case 377: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' USING INDEX '(' IDENTIFIER ')' with_index_param_list  */
+#line 2781 "parser.y"
                                                                                                                                                                                      {
     auto match_sparse_expr = new infinity::MatchSparseExpr();
     (yyval.expr_t) = match_sparse_expr;
@@ -7227,11 +7359,11 @@ Return4:
     match_sparse_expr->index_name_ = (yyvsp[-2].str_value);
     free((yyvsp[-2].str_value));
 }
-#line 7231 "parser.cpp"
+#line 7363 "parser.cpp"
     break;
 
-  case 369: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' IGNORE INDEX  */
-#line 2719 "parser.y"
+  case 378: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' IGNORE INDEX  */
+#line 2805 "parser.y"
                                                                                                                           {
     auto match_sparse_expr = new infinity::MatchSparseExpr();
     (yyval.expr_t) = match_sparse_expr;
@@ -7254,11 +7386,11 @@ Return4:
 
     match_sparse_expr->ignore_index_ = true;
 }
-#line 7258 "parser.cpp"
+#line 7390 "parser.cpp"
     break;
 
-  case 370: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' with_index_param_list  */
-#line 2742 "parser.y"
+  case 379: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ',' LONG_VALUE optional_search_filter_expr ')' with_index_param_list  */
+#line 2828 "parser.y"
                                                                                                                                    {
     auto match_sparse_expr = new infinity::MatchSparseExpr();
     (yyval.expr_t) = match_sparse_expr;
@@ -7279,11 +7411,11 @@ Return4:
     // topn and options
     match_sparse_expr->SetOptParams((yyvsp[-3].long_value), (yyvsp[0].with_index_param_list_t));
 }
-#line 7283 "parser.cpp"
+#line 7415 "parser.cpp"
     break;
 
-  case 371: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING optional_search_filter_expr ')' with_index_param_list  */
-#line 2763 "parser.y"
+  case 380: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING optional_search_filter_expr ')' with_index_param_list  */
+#line 2849 "parser.y"
                                                                                                                     {
     auto match_sparse_expr = new infinity::MatchSparseExpr();
     (yyval.expr_t) = match_sparse_expr;
@@ -7304,11 +7436,11 @@ Return4:
     // topn and options
     match_sparse_expr->SetOptParams(infinity::DEFAULT_MATCH_SPARSE_TOP_N, (yyvsp[0].with_index_param_list_t));
 }
-#line 7308 "parser.cpp"
+#line 7440 "parser.cpp"
     break;
 
-  case 372: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING optional_search_filter_expr ')'  */
-#line 2784 "parser.y"
+  case 381: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING optional_search_filter_expr ')'  */
+#line 2870 "parser.y"
                                                                                    {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->fields_ = std::string((yyvsp[-4].str_value));
@@ -7318,11 +7450,11 @@ Return4:
     free((yyvsp[-2].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 7322 "parser.cpp"
+#line 7454 "parser.cpp"
     break;
 
-  case 373: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ',' STRING optional_search_filter_expr ')'  */
-#line 2793 "parser.y"
+  case 382: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ',' STRING optional_search_filter_expr ')'  */
+#line 2879 "parser.y"
                                                                               {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->fields_ = std::string((yyvsp[-6].str_value));
@@ -7334,11 +7466,11 @@ Return4:
     free((yyvsp[-2].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 7338 "parser.cpp"
+#line 7470 "parser.cpp"
     break;
 
-  case 374: /* query_expr: QUERY '(' STRING optional_search_filter_expr ')'  */
-#line 2805 "parser.y"
+  case 383: /* query_expr: QUERY '(' STRING optional_search_filter_expr ')'  */
+#line 2891 "parser.y"
                                                               {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->matching_text_ = std::string((yyvsp[-2].str_value));
@@ -7346,11 +7478,11 @@ Return4:
     free((yyvsp[-2].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 7350 "parser.cpp"
+#line 7482 "parser.cpp"
     break;
 
-  case 375: /* query_expr: QUERY '(' STRING ',' STRING optional_search_filter_expr ')'  */
-#line 2812 "parser.y"
+  case 384: /* query_expr: QUERY '(' STRING ',' STRING optional_search_filter_expr ')'  */
+#line 2898 "parser.y"
                                                               {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->matching_text_ = std::string((yyvsp[-4].str_value));
@@ -7360,22 +7492,22 @@ Return4:
     free((yyvsp[-2].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 7364 "parser.cpp"
+#line 7496 "parser.cpp"
     break;
 
-  case 376: /* fusion_expr: FUSION '(' STRING ')'  */
-#line 2822 "parser.y"
+  case 385: /* fusion_expr: FUSION '(' STRING ')'  */
+#line 2908 "parser.y"
                                     {
     infinity::FusionExpr* fusion_expr = new infinity::FusionExpr();
     fusion_expr->method_ = std::string((yyvsp[-1].str_value));
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = fusion_expr;
 }
-#line 7375 "parser.cpp"
+#line 7507 "parser.cpp"
     break;
 
-  case 377: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
-#line 2828 "parser.y"
+  case 386: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
+#line 2914 "parser.y"
                                    {
     auto fusion_expr = std::make_unique<infinity::FusionExpr>();
     fusion_expr->method_ = std::string((yyvsp[-3].str_value));
@@ -7387,77 +7519,77 @@ Return4:
     fusion_expr->JobAfterParser();
     (yyval.expr_t) = fusion_expr.release();
 }
-#line 7391 "parser.cpp"
+#line 7523 "parser.cpp"
     break;
 
-  case 378: /* sub_search: match_vector_expr  */
-#line 2840 "parser.y"
+  case 387: /* sub_search: match_vector_expr  */
+#line 2926 "parser.y"
                                {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 7399 "parser.cpp"
+#line 7531 "parser.cpp"
     break;
 
-  case 379: /* sub_search: match_text_expr  */
-#line 2843 "parser.y"
+  case 388: /* sub_search: match_text_expr  */
+#line 2929 "parser.y"
                   {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 7407 "parser.cpp"
+#line 7539 "parser.cpp"
     break;
 
-  case 380: /* sub_search: match_tensor_expr  */
-#line 2846 "parser.y"
+  case 389: /* sub_search: match_tensor_expr  */
+#line 2932 "parser.y"
                     {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 7415 "parser.cpp"
+#line 7547 "parser.cpp"
     break;
 
-  case 381: /* sub_search: match_sparse_expr  */
-#line 2849 "parser.y"
+  case 390: /* sub_search: match_sparse_expr  */
+#line 2935 "parser.y"
                     {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 7423 "parser.cpp"
+#line 7555 "parser.cpp"
     break;
 
-  case 382: /* sub_search: query_expr  */
-#line 2852 "parser.y"
+  case 391: /* sub_search: query_expr  */
+#line 2938 "parser.y"
              {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 7431 "parser.cpp"
+#line 7563 "parser.cpp"
     break;
 
-  case 383: /* sub_search: fusion_expr  */
-#line 2855 "parser.y"
+  case 392: /* sub_search: fusion_expr  */
+#line 2941 "parser.y"
               {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 7439 "parser.cpp"
+#line 7571 "parser.cpp"
     break;
 
-  case 384: /* sub_search_array: sub_search  */
-#line 2859 "parser.y"
+  case 393: /* sub_search_array: sub_search  */
+#line 2945 "parser.y"
                               {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 7448 "parser.cpp"
+#line 7580 "parser.cpp"
     break;
 
-  case 385: /* sub_search_array: sub_search_array ',' sub_search  */
-#line 2863 "parser.y"
+  case 394: /* sub_search_array: sub_search_array ',' sub_search  */
+#line 2949 "parser.y"
                                   {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 7457 "parser.cpp"
+#line 7589 "parser.cpp"
     break;
 
-  case 386: /* function_expr: IDENTIFIER '(' ')'  */
-#line 2868 "parser.y"
+  case 395: /* function_expr: IDENTIFIER '(' ')'  */
+#line 2954 "parser.y"
                                    {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -7466,11 +7598,11 @@ Return4:
     func_expr->arguments_ = nullptr;
     (yyval.expr_t) = func_expr;
 }
-#line 7470 "parser.cpp"
+#line 7602 "parser.cpp"
     break;
 
-  case 387: /* function_expr: IDENTIFIER '(' expr_array ')'  */
-#line 2876 "parser.y"
+  case 396: /* function_expr: IDENTIFIER '(' expr_array ')'  */
+#line 2962 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -7479,11 +7611,11 @@ Return4:
     func_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = func_expr;
 }
-#line 7483 "parser.cpp"
+#line 7615 "parser.cpp"
     break;
 
-  case 388: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
-#line 2884 "parser.y"
+  case 397: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
+#line 2970 "parser.y"
                                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-4].str_value));
@@ -7493,11 +7625,11 @@ Return4:
     func_expr->distinct_ = true;
     (yyval.expr_t) = func_expr;
 }
-#line 7497 "parser.cpp"
+#line 7629 "parser.cpp"
     break;
 
-  case 389: /* function_expr: operand IS NOT NULLABLE  */
-#line 2893 "parser.y"
+  case 398: /* function_expr: operand IS NOT NULLABLE  */
+#line 2979 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_not_null";
@@ -7505,11 +7637,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[-3].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7509 "parser.cpp"
+#line 7641 "parser.cpp"
     break;
 
-  case 390: /* function_expr: operand IS NULLABLE  */
-#line 2900 "parser.y"
+  case 399: /* function_expr: operand IS NULLABLE  */
+#line 2986 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_null";
@@ -7517,11 +7649,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[-2].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7521 "parser.cpp"
+#line 7653 "parser.cpp"
     break;
 
-  case 391: /* function_expr: NOT operand  */
-#line 2907 "parser.y"
+  case 400: /* function_expr: NOT operand  */
+#line 2993 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not";
@@ -7529,11 +7661,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7533 "parser.cpp"
+#line 7665 "parser.cpp"
     break;
 
-  case 392: /* function_expr: '-' operand  */
-#line 2914 "parser.y"
+  case 401: /* function_expr: '-' operand  */
+#line 3000 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -7541,11 +7673,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7545 "parser.cpp"
+#line 7677 "parser.cpp"
     break;
 
-  case 393: /* function_expr: '+' operand  */
-#line 2921 "parser.y"
+  case 402: /* function_expr: '+' operand  */
+#line 3007 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -7553,11 +7685,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7557 "parser.cpp"
+#line 7689 "parser.cpp"
     break;
 
-  case 394: /* function_expr: operand '-' operand  */
-#line 2928 "parser.y"
+  case 403: /* function_expr: operand '-' operand  */
+#line 3014 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -7566,11 +7698,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7570 "parser.cpp"
+#line 7702 "parser.cpp"
     break;
 
-  case 395: /* function_expr: operand '+' operand  */
-#line 2936 "parser.y"
+  case 404: /* function_expr: operand '+' operand  */
+#line 3022 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -7579,11 +7711,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7583 "parser.cpp"
+#line 7715 "parser.cpp"
     break;
 
-  case 396: /* function_expr: operand '*' operand  */
-#line 2944 "parser.y"
+  case 405: /* function_expr: operand '*' operand  */
+#line 3030 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "*";
@@ -7592,11 +7724,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7596 "parser.cpp"
+#line 7728 "parser.cpp"
     break;
 
-  case 397: /* function_expr: operand '/' operand  */
-#line 2952 "parser.y"
+  case 406: /* function_expr: operand '/' operand  */
+#line 3038 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "/";
@@ -7605,11 +7737,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7609 "parser.cpp"
+#line 7741 "parser.cpp"
     break;
 
-  case 398: /* function_expr: operand '%' operand  */
-#line 2960 "parser.y"
+  case 407: /* function_expr: operand '%' operand  */
+#line 3046 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "%";
@@ -7618,11 +7750,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7622 "parser.cpp"
+#line 7754 "parser.cpp"
     break;
 
-  case 399: /* function_expr: operand '=' operand  */
-#line 2968 "parser.y"
+  case 408: /* function_expr: operand '=' operand  */
+#line 3054 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -7631,11 +7763,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7635 "parser.cpp"
+#line 7767 "parser.cpp"
     break;
 
-  case 400: /* function_expr: operand EQUAL operand  */
-#line 2976 "parser.y"
+  case 409: /* function_expr: operand EQUAL operand  */
+#line 3062 "parser.y"
                         {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -7644,11 +7776,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7648 "parser.cpp"
+#line 7780 "parser.cpp"
     break;
 
-  case 401: /* function_expr: operand NOT_EQ operand  */
-#line 2984 "parser.y"
+  case 410: /* function_expr: operand NOT_EQ operand  */
+#line 3070 "parser.y"
                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<>";
@@ -7657,11 +7789,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7661 "parser.cpp"
+#line 7793 "parser.cpp"
     break;
 
-  case 402: /* function_expr: operand '<' operand  */
-#line 2992 "parser.y"
+  case 411: /* function_expr: operand '<' operand  */
+#line 3078 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<";
@@ -7670,11 +7802,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7674 "parser.cpp"
+#line 7806 "parser.cpp"
     break;
 
-  case 403: /* function_expr: operand '>' operand  */
-#line 3000 "parser.y"
+  case 412: /* function_expr: operand '>' operand  */
+#line 3086 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">";
@@ -7683,11 +7815,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7687 "parser.cpp"
+#line 7819 "parser.cpp"
     break;
 
-  case 404: /* function_expr: operand LESS_EQ operand  */
-#line 3008 "parser.y"
+  case 413: /* function_expr: operand LESS_EQ operand  */
+#line 3094 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<=";
@@ -7696,11 +7828,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7700 "parser.cpp"
+#line 7832 "parser.cpp"
     break;
 
-  case 405: /* function_expr: operand GREATER_EQ operand  */
-#line 3016 "parser.y"
+  case 414: /* function_expr: operand GREATER_EQ operand  */
+#line 3102 "parser.y"
                              {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">=";
@@ -7709,11 +7841,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7713 "parser.cpp"
+#line 7845 "parser.cpp"
     break;
 
-  case 406: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
-#line 3024 "parser.y"
+  case 415: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
+#line 3110 "parser.y"
                                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -7744,11 +7876,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[-1].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7748 "parser.cpp"
+#line 7880 "parser.cpp"
     break;
 
-  case 407: /* function_expr: operand LIKE operand  */
-#line 3054 "parser.y"
+  case 416: /* function_expr: operand LIKE operand  */
+#line 3140 "parser.y"
                        {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "like";
@@ -7757,11 +7889,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7761 "parser.cpp"
+#line 7893 "parser.cpp"
     break;
 
-  case 408: /* function_expr: operand NOT LIKE operand  */
-#line 3062 "parser.y"
+  case 417: /* function_expr: operand NOT LIKE operand  */
+#line 3148 "parser.y"
                            {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not_like";
@@ -7770,11 +7902,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7774 "parser.cpp"
+#line 7906 "parser.cpp"
     break;
 
-  case 409: /* conjunction_expr: expr AND expr  */
-#line 3071 "parser.y"
+  case 418: /* conjunction_expr: expr AND expr  */
+#line 3157 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "and";
@@ -7783,11 +7915,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7787 "parser.cpp"
+#line 7919 "parser.cpp"
     break;
 
-  case 410: /* conjunction_expr: expr OR expr  */
-#line 3079 "parser.y"
+  case 419: /* conjunction_expr: expr OR expr  */
+#line 3165 "parser.y"
                {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "or";
@@ -7796,11 +7928,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7800 "parser.cpp"
+#line 7932 "parser.cpp"
     break;
 
-  case 411: /* between_expr: operand BETWEEN operand AND operand  */
-#line 3088 "parser.y"
+  case 420: /* between_expr: operand BETWEEN operand AND operand  */
+#line 3174 "parser.y"
                                                   {
     infinity::BetweenExpr* between_expr = new infinity::BetweenExpr();
     between_expr->value_ = (yyvsp[-4].expr_t);
@@ -7808,44 +7940,44 @@ Return4:
     between_expr->upper_bound_ = (yyvsp[0].expr_t);
     (yyval.expr_t) = between_expr;
 }
-#line 7812 "parser.cpp"
+#line 7944 "parser.cpp"
     break;
 
-  case 412: /* in_expr: operand IN '(' expr_array ')'  */
-#line 3096 "parser.y"
+  case 421: /* in_expr: operand IN '(' expr_array ')'  */
+#line 3182 "parser.y"
                                        {
     infinity::InExpr* in_expr = new infinity::InExpr(true);
     in_expr->left_ = (yyvsp[-4].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 7823 "parser.cpp"
+#line 7955 "parser.cpp"
     break;
 
-  case 413: /* in_expr: operand NOT IN '(' expr_array ')'  */
-#line 3102 "parser.y"
+  case 422: /* in_expr: operand NOT IN '(' expr_array ')'  */
+#line 3188 "parser.y"
                                     {
     infinity::InExpr* in_expr = new infinity::InExpr(false);
     in_expr->left_ = (yyvsp[-5].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 7834 "parser.cpp"
+#line 7966 "parser.cpp"
     break;
 
-  case 414: /* case_expr: CASE expr case_check_array END  */
-#line 3109 "parser.y"
+  case 423: /* case_expr: CASE expr case_check_array END  */
+#line 3195 "parser.y"
                                           {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-2].expr_t);
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 7845 "parser.cpp"
+#line 7977 "parser.cpp"
     break;
 
-  case 415: /* case_expr: CASE expr case_check_array ELSE expr END  */
-#line 3115 "parser.y"
+  case 424: /* case_expr: CASE expr case_check_array ELSE expr END  */
+#line 3201 "parser.y"
                                            {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-4].expr_t);
@@ -7853,32 +7985,32 @@ Return4:
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 7857 "parser.cpp"
+#line 7989 "parser.cpp"
     break;
 
-  case 416: /* case_expr: CASE case_check_array END  */
-#line 3122 "parser.y"
+  case 425: /* case_expr: CASE case_check_array END  */
+#line 3208 "parser.y"
                             {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 7867 "parser.cpp"
+#line 7999 "parser.cpp"
     break;
 
-  case 417: /* case_expr: CASE case_check_array ELSE expr END  */
-#line 3127 "parser.y"
+  case 426: /* case_expr: CASE case_check_array ELSE expr END  */
+#line 3213 "parser.y"
                                       {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-3].case_check_array_t);
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 7878 "parser.cpp"
+#line 8010 "parser.cpp"
     break;
 
-  case 418: /* case_check_array: WHEN expr THEN expr  */
-#line 3134 "parser.y"
+  case 427: /* case_check_array: WHEN expr THEN expr  */
+#line 3220 "parser.y"
                                       {
     (yyval.case_check_array_t) = new std::vector<infinity::WhenThen*>();
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
@@ -7886,11 +8018,11 @@ Return4:
     when_then_ptr->then_ = (yyvsp[0].expr_t);
     (yyval.case_check_array_t)->emplace_back(when_then_ptr);
 }
-#line 7890 "parser.cpp"
+#line 8022 "parser.cpp"
     break;
 
-  case 419: /* case_check_array: case_check_array WHEN expr THEN expr  */
-#line 3141 "parser.y"
+  case 428: /* case_check_array: case_check_array WHEN expr THEN expr  */
+#line 3227 "parser.y"
                                        {
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
     when_then_ptr->when_ = (yyvsp[-2].expr_t);
@@ -7898,11 +8030,11 @@ Return4:
     (yyvsp[-4].case_check_array_t)->emplace_back(when_then_ptr);
     (yyval.case_check_array_t) = (yyvsp[-4].case_check_array_t);
 }
-#line 7902 "parser.cpp"
+#line 8034 "parser.cpp"
     break;
 
-  case 420: /* cast_expr: CAST '(' expr AS column_type ')'  */
-#line 3149 "parser.y"
+  case 429: /* cast_expr: CAST '(' expr AS column_type ')'  */
+#line 3235 "parser.y"
                                             {
     std::shared_ptr<infinity::TypeInfo> type_info_ptr{nullptr};
     switch((yyvsp[-1].column_type_t).logical_type_) {
@@ -7929,33 +8061,33 @@ Return4:
     cast_expr->expr_ = (yyvsp[-3].expr_t);
     (yyval.expr_t) = cast_expr;
 }
-#line 7933 "parser.cpp"
+#line 8065 "parser.cpp"
     break;
 
-  case 421: /* subquery_expr: EXISTS '(' select_without_paren ')'  */
-#line 3176 "parser.y"
+  case 430: /* subquery_expr: EXISTS '(' select_without_paren ')'  */
+#line 3262 "parser.y"
                                                    {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 7944 "parser.cpp"
+#line 8076 "parser.cpp"
     break;
 
-  case 422: /* subquery_expr: NOT EXISTS '(' select_without_paren ')'  */
-#line 3182 "parser.y"
+  case 431: /* subquery_expr: NOT EXISTS '(' select_without_paren ')'  */
+#line 3268 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 7955 "parser.cpp"
+#line 8087 "parser.cpp"
     break;
 
-  case 423: /* subquery_expr: operand IN '(' select_without_paren ')'  */
-#line 3188 "parser.y"
+  case 432: /* subquery_expr: operand IN '(' select_without_paren ')'  */
+#line 3274 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kIn;
@@ -7963,11 +8095,11 @@ Return4:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 7967 "parser.cpp"
+#line 8099 "parser.cpp"
     break;
 
-  case 424: /* subquery_expr: operand NOT IN '(' select_without_paren ')'  */
-#line 3195 "parser.y"
+  case 433: /* subquery_expr: operand NOT IN '(' select_without_paren ')'  */
+#line 3281 "parser.y"
                                               {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotIn;
@@ -7975,11 +8107,11 @@ Return4:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 7979 "parser.cpp"
+#line 8111 "parser.cpp"
     break;
 
-  case 425: /* column_expr: IDENTIFIER  */
-#line 3203 "parser.y"
+  case 434: /* column_expr: IDENTIFIER  */
+#line 3289 "parser.y"
                          {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -7987,11 +8119,11 @@ Return4:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 7991 "parser.cpp"
+#line 8123 "parser.cpp"
     break;
 
-  case 426: /* column_expr: column_expr '.' IDENTIFIER  */
-#line 3210 "parser.y"
+  case 435: /* column_expr: column_expr '.' IDENTIFIER  */
+#line 3296 "parser.y"
                              {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -7999,21 +8131,21 @@ Return4:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 8003 "parser.cpp"
+#line 8135 "parser.cpp"
     break;
 
-  case 427: /* column_expr: '*'  */
-#line 3217 "parser.y"
+  case 436: /* column_expr: '*'  */
+#line 3303 "parser.y"
       {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 8013 "parser.cpp"
+#line 8145 "parser.cpp"
     break;
 
-  case 428: /* column_expr: column_expr '.' '*'  */
-#line 3222 "parser.y"
+  case 437: /* column_expr: column_expr '.' '*'  */
+#line 3308 "parser.y"
                       {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     if(column_expr->star_) {
@@ -8023,232 +8155,232 @@ Return4:
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 8027 "parser.cpp"
+#line 8159 "parser.cpp"
     break;
 
-  case 429: /* constant_expr: STRING  */
-#line 3232 "parser.y"
+  case 438: /* constant_expr: STRING  */
+#line 3318 "parser.y"
                       {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kString);
     const_expr->str_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8037 "parser.cpp"
+#line 8169 "parser.cpp"
     break;
 
-  case 430: /* constant_expr: TRUE  */
-#line 3237 "parser.y"
+  case 439: /* constant_expr: TRUE  */
+#line 3323 "parser.y"
        {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = true;
     (yyval.const_expr_t) = const_expr;
 }
-#line 8047 "parser.cpp"
+#line 8179 "parser.cpp"
     break;
 
-  case 431: /* constant_expr: FALSE  */
-#line 3242 "parser.y"
+  case 440: /* constant_expr: FALSE  */
+#line 3328 "parser.y"
         {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = false;
     (yyval.const_expr_t) = const_expr;
 }
-#line 8057 "parser.cpp"
+#line 8189 "parser.cpp"
     break;
 
-  case 432: /* constant_expr: DOUBLE_VALUE  */
-#line 3247 "parser.y"
+  case 441: /* constant_expr: DOUBLE_VALUE  */
+#line 3333 "parser.y"
                {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDouble);
     const_expr->double_value_ = (yyvsp[0].double_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8067 "parser.cpp"
+#line 8199 "parser.cpp"
     break;
 
-  case 433: /* constant_expr: LONG_VALUE  */
-#line 3252 "parser.y"
+  case 442: /* constant_expr: LONG_VALUE  */
+#line 3338 "parser.y"
              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInteger);
     const_expr->integer_value_ = (yyvsp[0].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8077 "parser.cpp"
+#line 8209 "parser.cpp"
     break;
 
-  case 434: /* constant_expr: DATE STRING  */
-#line 3257 "parser.y"
+  case 443: /* constant_expr: DATE STRING  */
+#line 3343 "parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDate);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8087 "parser.cpp"
+#line 8219 "parser.cpp"
     break;
 
-  case 435: /* constant_expr: TIME STRING  */
-#line 3262 "parser.y"
+  case 444: /* constant_expr: TIME STRING  */
+#line 3348 "parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8097 "parser.cpp"
+#line 8229 "parser.cpp"
     break;
 
-  case 436: /* constant_expr: DATETIME STRING  */
-#line 3267 "parser.y"
+  case 445: /* constant_expr: DATETIME STRING  */
+#line 3353 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDateTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8107 "parser.cpp"
+#line 8239 "parser.cpp"
     break;
 
-  case 437: /* constant_expr: TIMESTAMP STRING  */
-#line 3272 "parser.y"
+  case 446: /* constant_expr: TIMESTAMP STRING  */
+#line 3358 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTimestamp);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8117 "parser.cpp"
+#line 8249 "parser.cpp"
     break;
 
-  case 438: /* constant_expr: INTERVAL interval_expr  */
-#line 3277 "parser.y"
+  case 447: /* constant_expr: INTERVAL interval_expr  */
+#line 3363 "parser.y"
                          {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8125 "parser.cpp"
+#line 8257 "parser.cpp"
     break;
 
-  case 439: /* constant_expr: interval_expr  */
-#line 3280 "parser.y"
+  case 448: /* constant_expr: interval_expr  */
+#line 3366 "parser.y"
                 {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8133 "parser.cpp"
+#line 8265 "parser.cpp"
     break;
 
-  case 440: /* constant_expr: common_array_expr  */
-#line 3283 "parser.y"
+  case 449: /* constant_expr: common_array_expr  */
+#line 3369 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8141 "parser.cpp"
+#line 8273 "parser.cpp"
     break;
 
-  case 441: /* common_array_expr: array_expr  */
-#line 3287 "parser.y"
+  case 450: /* common_array_expr: array_expr  */
+#line 3373 "parser.y"
                               {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8149 "parser.cpp"
+#line 8281 "parser.cpp"
     break;
 
-  case 442: /* common_array_expr: subarray_array_expr  */
-#line 3290 "parser.y"
+  case 451: /* common_array_expr: subarray_array_expr  */
+#line 3376 "parser.y"
                       {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8157 "parser.cpp"
+#line 8289 "parser.cpp"
     break;
 
-  case 443: /* common_array_expr: sparse_array_expr  */
-#line 3293 "parser.y"
+  case 452: /* common_array_expr: sparse_array_expr  */
+#line 3379 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8165 "parser.cpp"
+#line 8297 "parser.cpp"
     break;
 
-  case 444: /* common_array_expr: empty_array_expr  */
-#line 3296 "parser.y"
+  case 453: /* common_array_expr: empty_array_expr  */
+#line 3382 "parser.y"
                    {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8173 "parser.cpp"
+#line 8305 "parser.cpp"
     break;
 
-  case 445: /* common_sparse_array_expr: sparse_array_expr  */
-#line 3300 "parser.y"
+  case 454: /* common_sparse_array_expr: sparse_array_expr  */
+#line 3386 "parser.y"
                                             {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8181 "parser.cpp"
+#line 8313 "parser.cpp"
     break;
 
-  case 446: /* common_sparse_array_expr: array_expr  */
-#line 3303 "parser.y"
+  case 455: /* common_sparse_array_expr: array_expr  */
+#line 3389 "parser.y"
              {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8189 "parser.cpp"
+#line 8321 "parser.cpp"
     break;
 
-  case 447: /* common_sparse_array_expr: empty_array_expr  */
-#line 3306 "parser.y"
+  case 456: /* common_sparse_array_expr: empty_array_expr  */
+#line 3392 "parser.y"
                    {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8197 "parser.cpp"
+#line 8329 "parser.cpp"
     break;
 
-  case 448: /* subarray_array_expr: unclosed_subarray_array_expr ']'  */
-#line 3310 "parser.y"
+  case 457: /* subarray_array_expr: unclosed_subarray_array_expr ']'  */
+#line 3396 "parser.y"
                                                       {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 8205 "parser.cpp"
+#line 8337 "parser.cpp"
     break;
 
-  case 449: /* unclosed_subarray_array_expr: '[' common_array_expr  */
-#line 3314 "parser.y"
+  case 458: /* unclosed_subarray_array_expr: '[' common_array_expr  */
+#line 3400 "parser.y"
                                                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kSubArrayArray);
     const_expr->sub_array_array_.emplace_back((yyvsp[0].const_expr_t));
     (yyval.const_expr_t) = const_expr;
 }
-#line 8215 "parser.cpp"
+#line 8347 "parser.cpp"
     break;
 
-  case 450: /* unclosed_subarray_array_expr: unclosed_subarray_array_expr ',' common_array_expr  */
-#line 3319 "parser.y"
+  case 459: /* unclosed_subarray_array_expr: unclosed_subarray_array_expr ',' common_array_expr  */
+#line 3405 "parser.y"
                                                      {
     (yyvsp[-2].const_expr_t)->sub_array_array_.emplace_back((yyvsp[0].const_expr_t));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 8224 "parser.cpp"
+#line 8356 "parser.cpp"
     break;
 
-  case 451: /* sparse_array_expr: long_sparse_array_expr  */
-#line 3324 "parser.y"
+  case 460: /* sparse_array_expr: long_sparse_array_expr  */
+#line 3410 "parser.y"
                                           {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8232 "parser.cpp"
+#line 8364 "parser.cpp"
     break;
 
-  case 452: /* sparse_array_expr: double_sparse_array_expr  */
-#line 3327 "parser.y"
+  case 461: /* sparse_array_expr: double_sparse_array_expr  */
+#line 3413 "parser.y"
                            {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8240 "parser.cpp"
+#line 8372 "parser.cpp"
     break;
 
-  case 453: /* long_sparse_array_expr: unclosed_long_sparse_array_expr ']'  */
-#line 3331 "parser.y"
+  case 462: /* long_sparse_array_expr: unclosed_long_sparse_array_expr ']'  */
+#line 3417 "parser.y"
                                                             {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 8248 "parser.cpp"
+#line 8380 "parser.cpp"
     break;
 
-  case 454: /* unclosed_long_sparse_array_expr: '[' int_sparse_ele  */
-#line 3335 "parser.y"
+  case 463: /* unclosed_long_sparse_array_expr: '[' int_sparse_ele  */
+#line 3421 "parser.y"
                                                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kLongSparseArray);
     const_expr->long_sparse_array_.first.emplace_back((yyvsp[0].int_sparse_ele_t)->first);
@@ -8256,30 +8388,30 @@ Return4:
     delete (yyvsp[0].int_sparse_ele_t);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8260 "parser.cpp"
+#line 8392 "parser.cpp"
     break;
 
-  case 455: /* unclosed_long_sparse_array_expr: unclosed_long_sparse_array_expr ',' int_sparse_ele  */
-#line 3342 "parser.y"
+  case 464: /* unclosed_long_sparse_array_expr: unclosed_long_sparse_array_expr ',' int_sparse_ele  */
+#line 3428 "parser.y"
                                                      {
     (yyvsp[-2].const_expr_t)->long_sparse_array_.first.emplace_back((yyvsp[0].int_sparse_ele_t)->first);
     (yyvsp[-2].const_expr_t)->long_sparse_array_.second.emplace_back((yyvsp[0].int_sparse_ele_t)->second);
     delete (yyvsp[0].int_sparse_ele_t);
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 8271 "parser.cpp"
+#line 8403 "parser.cpp"
     break;
 
-  case 456: /* double_sparse_array_expr: unclosed_double_sparse_array_expr ']'  */
-#line 3349 "parser.y"
+  case 465: /* double_sparse_array_expr: unclosed_double_sparse_array_expr ']'  */
+#line 3435 "parser.y"
                                                                 {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 8279 "parser.cpp"
+#line 8411 "parser.cpp"
     break;
 
-  case 457: /* unclosed_double_sparse_array_expr: '[' float_sparse_ele  */
-#line 3353 "parser.y"
+  case 466: /* unclosed_double_sparse_array_expr: '[' float_sparse_ele  */
+#line 3439 "parser.y"
                                                         {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDoubleSparseArray);
     const_expr->double_sparse_array_.first.emplace_back((yyvsp[0].float_sparse_ele_t)->first);
@@ -8287,266 +8419,266 @@ Return4:
     delete (yyvsp[0].float_sparse_ele_t);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8291 "parser.cpp"
+#line 8423 "parser.cpp"
     break;
 
-  case 458: /* unclosed_double_sparse_array_expr: unclosed_double_sparse_array_expr ',' float_sparse_ele  */
-#line 3360 "parser.y"
+  case 467: /* unclosed_double_sparse_array_expr: unclosed_double_sparse_array_expr ',' float_sparse_ele  */
+#line 3446 "parser.y"
                                                          {
     (yyvsp[-2].const_expr_t)->double_sparse_array_.first.emplace_back((yyvsp[0].float_sparse_ele_t)->first);
     (yyvsp[-2].const_expr_t)->double_sparse_array_.second.emplace_back((yyvsp[0].float_sparse_ele_t)->second);
     delete (yyvsp[0].float_sparse_ele_t);
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 8302 "parser.cpp"
+#line 8434 "parser.cpp"
     break;
 
-  case 459: /* empty_array_expr: '[' ']'  */
-#line 3367 "parser.y"
+  case 468: /* empty_array_expr: '[' ']'  */
+#line 3453 "parser.y"
                           {
     (yyval.const_expr_t) = new infinity::ConstantExpr(infinity::LiteralType::kEmptyArray);
 }
-#line 8310 "parser.cpp"
+#line 8442 "parser.cpp"
     break;
 
-  case 460: /* int_sparse_ele: LONG_VALUE ':' LONG_VALUE  */
-#line 3371 "parser.y"
+  case 469: /* int_sparse_ele: LONG_VALUE ':' LONG_VALUE  */
+#line 3457 "parser.y"
                                           {
     (yyval.int_sparse_ele_t) = new std::pair<int64_t, int64_t>{(yyvsp[-2].long_value), (yyvsp[0].long_value)};
 }
-#line 8318 "parser.cpp"
+#line 8450 "parser.cpp"
     break;
 
-  case 461: /* float_sparse_ele: LONG_VALUE ':' DOUBLE_VALUE  */
-#line 3375 "parser.y"
+  case 470: /* float_sparse_ele: LONG_VALUE ':' DOUBLE_VALUE  */
+#line 3461 "parser.y"
                                               {
     (yyval.float_sparse_ele_t) = new std::pair<int64_t, double>{(yyvsp[-2].long_value), (yyvsp[0].double_value)};
 }
-#line 8326 "parser.cpp"
+#line 8458 "parser.cpp"
     break;
 
-  case 462: /* array_expr: long_array_expr  */
-#line 3379 "parser.y"
+  case 471: /* array_expr: long_array_expr  */
+#line 3465 "parser.y"
                             {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8334 "parser.cpp"
+#line 8466 "parser.cpp"
     break;
 
-  case 463: /* array_expr: double_array_expr  */
-#line 3382 "parser.y"
+  case 472: /* array_expr: double_array_expr  */
+#line 3468 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 8342 "parser.cpp"
+#line 8474 "parser.cpp"
     break;
 
-  case 464: /* long_array_expr: unclosed_long_array_expr ']'  */
-#line 3386 "parser.y"
+  case 473: /* long_array_expr: unclosed_long_array_expr ']'  */
+#line 3472 "parser.y"
                                               {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 8350 "parser.cpp"
+#line 8482 "parser.cpp"
     break;
 
-  case 465: /* unclosed_long_array_expr: '[' LONG_VALUE  */
-#line 3390 "parser.y"
+  case 474: /* unclosed_long_array_expr: '[' LONG_VALUE  */
+#line 3476 "parser.y"
                                          {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kIntegerArray);
     const_expr->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 8360 "parser.cpp"
+#line 8492 "parser.cpp"
     break;
 
-  case 466: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
-#line 3395 "parser.y"
+  case 475: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
+#line 3481 "parser.y"
                                           {
     (yyvsp[-2].const_expr_t)->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 8369 "parser.cpp"
+#line 8501 "parser.cpp"
     break;
 
-  case 467: /* double_array_expr: unclosed_double_array_expr ']'  */
-#line 3400 "parser.y"
+  case 476: /* double_array_expr: unclosed_double_array_expr ']'  */
+#line 3486 "parser.y"
                                                   {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 8377 "parser.cpp"
+#line 8509 "parser.cpp"
     break;
 
-  case 468: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
-#line 3404 "parser.y"
+  case 477: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
+#line 3490 "parser.y"
                                              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDoubleArray);
     const_expr->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 8387 "parser.cpp"
+#line 8519 "parser.cpp"
     break;
 
-  case 469: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
-#line 3409 "parser.y"
+  case 478: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
+#line 3495 "parser.y"
                                               {
     (yyvsp[-2].const_expr_t)->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 8396 "parser.cpp"
+#line 8528 "parser.cpp"
     break;
 
-  case 470: /* interval_expr: LONG_VALUE SECONDS  */
-#line 3414 "parser.y"
+  case 479: /* interval_expr: LONG_VALUE SECONDS  */
+#line 3500 "parser.y"
                                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8407 "parser.cpp"
+#line 8539 "parser.cpp"
     break;
 
-  case 471: /* interval_expr: LONG_VALUE SECOND  */
-#line 3420 "parser.y"
+  case 480: /* interval_expr: LONG_VALUE SECOND  */
+#line 3506 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8418 "parser.cpp"
+#line 8550 "parser.cpp"
     break;
 
-  case 472: /* interval_expr: LONG_VALUE MINUTES  */
-#line 3426 "parser.y"
+  case 481: /* interval_expr: LONG_VALUE MINUTES  */
+#line 3512 "parser.y"
                      {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8429 "parser.cpp"
+#line 8561 "parser.cpp"
     break;
 
-  case 473: /* interval_expr: LONG_VALUE MINUTE  */
-#line 3432 "parser.y"
+  case 482: /* interval_expr: LONG_VALUE MINUTE  */
+#line 3518 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8440 "parser.cpp"
+#line 8572 "parser.cpp"
     break;
 
-  case 474: /* interval_expr: LONG_VALUE HOURS  */
-#line 3438 "parser.y"
+  case 483: /* interval_expr: LONG_VALUE HOURS  */
+#line 3524 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8451 "parser.cpp"
+#line 8583 "parser.cpp"
     break;
 
-  case 475: /* interval_expr: LONG_VALUE HOUR  */
-#line 3444 "parser.y"
+  case 484: /* interval_expr: LONG_VALUE HOUR  */
+#line 3530 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8462 "parser.cpp"
+#line 8594 "parser.cpp"
     break;
 
-  case 476: /* interval_expr: LONG_VALUE DAYS  */
-#line 3450 "parser.y"
+  case 485: /* interval_expr: LONG_VALUE DAYS  */
+#line 3536 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8473 "parser.cpp"
+#line 8605 "parser.cpp"
     break;
 
-  case 477: /* interval_expr: LONG_VALUE DAY  */
-#line 3456 "parser.y"
+  case 486: /* interval_expr: LONG_VALUE DAY  */
+#line 3542 "parser.y"
                  {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8484 "parser.cpp"
+#line 8616 "parser.cpp"
     break;
 
-  case 478: /* interval_expr: LONG_VALUE MONTHS  */
-#line 3462 "parser.y"
+  case 487: /* interval_expr: LONG_VALUE MONTHS  */
+#line 3548 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8495 "parser.cpp"
+#line 8627 "parser.cpp"
     break;
 
-  case 479: /* interval_expr: LONG_VALUE MONTH  */
-#line 3468 "parser.y"
+  case 488: /* interval_expr: LONG_VALUE MONTH  */
+#line 3554 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8506 "parser.cpp"
+#line 8638 "parser.cpp"
     break;
 
-  case 480: /* interval_expr: LONG_VALUE YEARS  */
-#line 3474 "parser.y"
+  case 489: /* interval_expr: LONG_VALUE YEARS  */
+#line 3560 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8517 "parser.cpp"
+#line 8649 "parser.cpp"
     break;
 
-  case 481: /* interval_expr: LONG_VALUE YEAR  */
-#line 3480 "parser.y"
+  case 490: /* interval_expr: LONG_VALUE YEAR  */
+#line 3566 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8528 "parser.cpp"
+#line 8660 "parser.cpp"
     break;
 
-  case 482: /* copy_option_list: copy_option  */
-#line 3491 "parser.y"
+  case 491: /* copy_option_list: copy_option  */
+#line 3577 "parser.y"
                                {
     (yyval.copy_option_array) = new std::vector<infinity::CopyOption*>();
     (yyval.copy_option_array)->push_back((yyvsp[0].copy_option_t));
 }
-#line 8537 "parser.cpp"
+#line 8669 "parser.cpp"
     break;
 
-  case 483: /* copy_option_list: copy_option_list ',' copy_option  */
-#line 3495 "parser.y"
+  case 492: /* copy_option_list: copy_option_list ',' copy_option  */
+#line 3581 "parser.y"
                                    {
     (yyvsp[-2].copy_option_array)->push_back((yyvsp[0].copy_option_t));
     (yyval.copy_option_array) = (yyvsp[-2].copy_option_array);
 }
-#line 8546 "parser.cpp"
+#line 8678 "parser.cpp"
     break;
 
-  case 484: /* copy_option: FORMAT IDENTIFIER  */
-#line 3500 "parser.y"
+  case 493: /* copy_option: FORMAT IDENTIFIER  */
+#line 3586 "parser.y"
                                 {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kFormat;
@@ -8578,11 +8710,11 @@ Return4:
         YYERROR;
     }
 }
-#line 8582 "parser.cpp"
+#line 8714 "parser.cpp"
     break;
 
-  case 485: /* copy_option: DELIMITER STRING  */
-#line 3531 "parser.y"
+  case 494: /* copy_option: DELIMITER STRING  */
+#line 3617 "parser.y"
                    {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kDelimiter;
@@ -8593,83 +8725,114 @@ Return4:
     }
     free((yyvsp[0].str_value));
 }
-#line 8597 "parser.cpp"
+#line 8729 "parser.cpp"
     break;
 
-  case 486: /* copy_option: HEADER  */
-#line 3541 "parser.y"
+  case 495: /* copy_option: HEADER  */
+#line 3627 "parser.y"
          {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kHeader;
     (yyval.copy_option_t)->header_ = true;
 }
-#line 8607 "parser.cpp"
+#line 8739 "parser.cpp"
     break;
 
-  case 487: /* copy_option: OFFSET LONG_VALUE  */
-#line 3546 "parser.y"
+  case 496: /* copy_option: OFFSET LONG_VALUE  */
+#line 3632 "parser.y"
                     {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kOffset;
     (yyval.copy_option_t)->offset_ = (yyvsp[0].long_value);
 }
-#line 8617 "parser.cpp"
+#line 8749 "parser.cpp"
     break;
 
-  case 488: /* copy_option: LIMIT LONG_VALUE  */
-#line 3551 "parser.y"
+  case 497: /* copy_option: LIMIT LONG_VALUE  */
+#line 3637 "parser.y"
                    {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kLimit;
     (yyval.copy_option_t)->limit_ = (yyvsp[0].long_value);
 }
-#line 8627 "parser.cpp"
+#line 8759 "parser.cpp"
     break;
 
-  case 489: /* copy_option: ROWLIMIT LONG_VALUE  */
-#line 3556 "parser.y"
+  case 498: /* copy_option: ROWLIMIT LONG_VALUE  */
+#line 3642 "parser.y"
                       {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kRowLimit;
     (yyval.copy_option_t)->row_limit_ = (yyvsp[0].long_value);
 }
-#line 8637 "parser.cpp"
+#line 8769 "parser.cpp"
+    break;
+
+  case 499: /* copy_option: IDENTIFIER IDENTIFIER  */
+#line 3647 "parser.y"
+                        {
+    if (strcasecmp((yyvsp[-1].str_value), "compression") != 0) {
+        free((yyvsp[-1].str_value));
+        free((yyvsp[0].str_value));
+        yyerror(&yyloc, scanner, result, "Unknown copy option");
+        YYERROR;
+    }
+    free((yyvsp[-1].str_value));
+    (yyval.copy_option_t) = new infinity::CopyOption();
+    (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kCompression;
+    if (strcasecmp((yyvsp[0].str_value), "zstd") == 0) {
+        (yyval.copy_option_t)->compression_type_ = infinity::CopyCompressionType::kZstd;
+        free((yyvsp[0].str_value));
+    } else if (strcasecmp((yyvsp[0].str_value), "lz4") == 0) {
+        (yyval.copy_option_t)->compression_type_ = infinity::CopyCompressionType::kLz4;
+        free((yyvsp[0].str_value));
+    } else if (strcasecmp((yyvsp[0].str_value), "none") == 0) {
+        (yyval.copy_option_t)->compression_type_ = infinity::CopyCompressionType::kNone;
+        free((yyvsp[0].str_value));
+    } else {
+        free((yyvsp[0].str_value));
+        delete (yyval.copy_option_t);
+        yyerror(&yyloc, scanner, result, "Unknown compression type");
+        YYERROR;
+    }
+}
+#line 8800 "parser.cpp"
     break;
 
-  case 490: /* file_path: STRING  */
-#line 3562 "parser.y"
+  case 500: /* file_path: STRING  */
+#line 3674 "parser.y"
                    {
     (yyval.str_value) = (yyvsp[0].str_value);
 }
-#line 8645 "parser.cpp"
+#line 8808 "parser.cpp"
     break;
 
-  case 491: /* if_exists: IF EXISTS  */
-#line 3566 "parser.y"
+  case 501: /* if_exists: IF EXISTS  */
+#line 3678 "parser.y"
                      { (yyval.bool_value) = true; }
-#line 8651 "parser.cpp"
+#line 8814 "parser.cpp"
     break;
 
-  case 492: /* if_exists: %empty  */
-#line 3567 "parser.y"
+  case 502: /* if_exists: %empty  */
+#line 3679 "parser.y"
   { (yyval.bool_value) = false; }
-#line 8657 "parser.cpp"
+#line 8820 "parser.cpp"
     break;
 
-  case 493: /* if_not_exists: IF NOT EXISTS  */
-#line 3569 "parser.y"
+  case 503: /* if_not_exists: IF NOT EXISTS  */
+#line 3681 "parser.y"
                               { (yyval.bool_value) = true; }
-#line 8663 "parser.cpp"
+#line 8826 "parser.cpp"
     break;
 
-  case 494: /* if_not_exists: %empty  */
-#line 3570 "parser.y"
+  case 504: /* if_not_exists: %empty  */
+#line 3682 "parser.y"
   { (yyval.bool_value) = false; }
-#line 8669 "parser.cpp"
+#line 8832 "parser.cpp"
     break;
 
-  case 497: /* if_not_exists_info: if_not_exists IDENTIFIER  */
-#line 3585 "parser.y"
+  case 507: /* if_not_exists_info: if_not_exists IDENTIFIER  */
+#line 3697 "parser.y"
                                               {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
     (yyval.if_not_exists_info_t)->exists_ = true;
@@ -8678,80 +8841,80 @@ Return4:
     (yyval.if_not_exists_info_t)->info_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 8682 "parser.cpp"
+#line 8845 "parser.cpp"
     break;
 
-  case 498: /* if_not_exists_info: %empty  */
-#line 3593 "parser.y"
+  case 508: /* if_not_exists_info: %empty  */
+#line 3705 "parser.y"
   {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
 }
-#line 8690 "parser.cpp"
+#line 8853 "parser.cpp"
     break;
 
-  case 499: /* with_index_param_list: WITH '(' index_param_list ')'  */
-#line 3597 "parser.y"
+  case 509: /* with_index_param_list: WITH '(' index_param_list ')'  */
+#line 3709 "parser.y"
                                                       {
     (yyval.with_index_param_list_t) = (yyvsp[-1].index_param_list_t);
 }
-#line 8698 "parser.cpp"
+#line 8861 "parser.cpp"
     break;
 
-  case 500: /* with_index_param_list: %empty  */
-#line 3600 "parser.y"
+  case 510: /* with_index_param_list: %empty  */
+#line 3712 "parser.y"
   {
     (yyval.with_index_param_list_t) = new std::vector<infinity::InitParameter*>();
 }
-#line 8706 "parser.cpp"
+#line 8869 "parser.cpp"
     break;
 
-  case 501: /* optional_table_properties_list: PROPERTIES '(' index_param_list ')'  */
-#line 3604 "parser.y"
+  case 511: /* optional_table_properties_list: PROPERTIES '(' index_param_list ')'  */
+#line 3716 "parser.y"
                                                                      {
     (yyval.with_index_param_list_t) = (yyvsp[-1].index_param_list_t);
 }
-#line 8714 "parser.cpp"
+#line 8877 "parser.cpp"
     break;
 
-  case 502: /* optional_table_properties_list: %empty  */
-#line 3607 "parser.y"
+  case 512: /* optional_table_properties_list: %empty  */
+#line 3719 "parser.y"
   {
     (yyval.with_index_param_list_t) = nullptr;
 }
-#line 8722 "parser.cpp"
+#line 8885 "parser.cpp"
     break;
 
-  case 503: /* index_param_list: index_param  */
-#line 3611 "parser.y"
+  case 513: /* index_param_list: index_param  */
+#line 3723 "parser.y"
                                {
     (yyval.index_param_list_t) = new std::vector<infinity::InitParameter*>();
     (yyval.index_param_list_t)->push_back((yyvsp[0].index_param_t));
 }
-#line 8731 "parser.cpp"
+#line 8894 "parser.cpp"
     break;
 
-  case 504: /* index_param_list: index_param_list ',' index_param  */
-#line 3615 "parser.y"
+  case 514: /* index_param_list: index_param_list ',' index_param  */
+#line 3727 "parser.y"
                                    {
     (yyvsp[-2].index_param_list_t)->push_back((yyvsp[0].index_param_t));
     (yyval.index_param_list_t) = (yyvsp[-2].index_param_list_t);
 }
-#line 8740 "parser.cpp"
+#line 8903 "parser.cpp"
     break;
 
-  case 505: /* index_param: IDENTIFIER  */
-#line 3620 "parser.y"
+  case 515: /* index_param: IDENTIFIER  */
+#line 3732 "parser.y"
                          {
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 8751 "parser.cpp"
+#line 8914 "parser.cpp"
     break;
 
-  case 506: /* index_param: IDENTIFIER '=' IDENTIFIER  */
-#line 3626 "parser.y"
+  case 516: /* index_param: IDENTIFIER '=' IDENTIFIER  */
+#line 3738 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-2].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -8762,11 +8925,11 @@ Return4:
     (yyval.index_param_t)->param_value_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 8766 "parser.cpp"
+#line 8929 "parser.cpp"
     break;
 
-  case 507: /* index_param: IDENTIFIER '=' STRING  */
-#line 3636 "parser.y"
+  case 517: /* index_param: IDENTIFIER '=' STRING  */
+#line 3748 "parser.y"
                         {
     ParserHelper::ToLower((yyvsp[-2].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -8777,11 +8940,11 @@ Return4:
     (yyval.index_param_t)->param_value_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 8781 "parser.cpp"
+#line 8944 "parser.cpp"
     break;
 
-  case 508: /* index_param: IDENTIFIER '=' LONG_VALUE  */
-#line 3646 "parser.y"
+  case 518: /* index_param: IDENTIFIER '=' LONG_VALUE  */
+#line 3758 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-2].str_value));
     (yyval.index_param_t) = new infinity::InitParameter();
@@ -8790,11 +8953,11 @@ Return4:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].long_value));
 }
-#line 8794 "parser.cpp"
+#line 8957 "parser.cpp"
     break;
 
-  case 509: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
-#line 3654 "parser.y"
+  case 519: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
+#line 3766 "parser.y"
                               {
     ParserHelper::ToLower((yyvsp[-2].str_value));
     (yyval.index_param_t) = new infinity::InitParameter();
@@ -8803,11 +8966,11 @@ Return4:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].double_value));
 }
-#line 8807 "parser.cpp"
+#line 8970 "parser.cpp"
     break;
 
-  case 510: /* index_info: '(' IDENTIFIER ')' USING IDENTIFIER with_index_param_list  */
-#line 3665 "parser.y"
+  case 520: /* index_info: '(' IDENTIFIER ')' USING IDENTIFIER with_index_param_list  */
+#line 3777 "parser.y"
                                                                        {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     infinity::IndexType index_type = infinity::IndexType::kInvalid;
@@ -8839,22 +9002,22 @@ Return4:
     (yyval.index_info_t)->index_param_list_ = (yyvsp[0].with_index_param_list_t);
     free((yyvsp[-4].str_value));
 }
-#line 8843 "parser.cpp"
+#line 9006 "parser.cpp"
     break;
 
-  case 511: /* index_info: '(' IDENTIFIER ')'  */
-#line 3696 "parser.y"
+  case 521: /* index_info: '(' IDENTIFIER ')'  */
+#line 3808 "parser.y"
                      {
     (yyval.index_info_t) = new infinity::IndexInfo();
     (yyval.index_info_t)->index_type_ = infinity::IndexType::kSecondary;
     (yyval.index_info_t)->column_name_ = (yyvsp[-1].str_value);
     free((yyvsp[-1].str_value));
 }
-#line 8854 "parser.cpp"
+#line 9017 "parser.cpp"
     break;
 
 
-#line 8858 "parser.cpp"
+#line 9021 "parser.cpp"
 
       default: break;
     }
@@ -9083,7 +9246,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 3703 "parser.y"
+#line 3815 "parser.y"
 
 
 void
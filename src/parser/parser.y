@@ -411,6 +411,8 @@ struct SQL_LTYPE {
 %type <compact_stmt>      compact_statement
 %type <admin_stmt>        admin_statement
 %type <alter_stmt>        alter_statement
+%type <prepare_stmt>      prepare_statement
+%type <execute_stmt>      execute_statement
 
 %type <stmt_array>        statement_list
 
@@ -499,12 +501,14 @@ input_pattern : statement_list semicolon {
 statement_list : statement {
     $1->stmt_length_ = yylloc.string_length;
     yylloc.string_length = 0;
+    result->parameter_count_ = 0;
     $$ = new std::vector<infinity::BaseStatement*>();
     $$->push_back($1);
 }
 | statement_list ';' statement {
     $3->stmt_length_ = yylloc.string_length;
     yylloc.string_length = 0;
+    result->parameter_count_ = 0;
     $1->push_back($3);
     $$ = $1;
 };
@@ -524,6 +528,8 @@ statement : create_statement { $$ = $1; }
 | compact_statement { $$ = $1; }
 | admin_statement { $$ = $1; }
 | alter_statement { $$ = $1; }
+| prepare_statement { $$ = $1; }
+| execute_statement { $$ = $1; }
 
 explainable_statement : create_statement { $$ = $1; }
 | drop_statement { $$ = $1; }
@@ -1060,6 +1066,35 @@ explain_type: ANALYZE {
     $$ = infinity::ExplainType::kPhysical;
 }
 
+/*
+ * PREPARE STATEMENT
+ */
+prepare_statement : PREPARE IDENTIFIER AS select_statement {
+    $$ = new infinity::PrepareStatement();
+    ParserHelper::ToLower($2);
+    $$->name_ = $2;
+    free($2);
+    $$->statement_ = $4;
+    $$->parameter_count_ = result->parameter_count_;
+}
+
+/*
+ * EXECUTE STATEMENT
+ */
+execute_statement : EXECUTE IDENTIFIER {
+    $$ = new infinity::ExecuteStatement();
+    ParserHelper::ToLower($2);
+    $$->name_ = $2;
+    free($2);
+}
+| EXECUTE IDENTIFIER '(' expr_array ')' {
+    $$ = new infinity::ExecuteStatement();
+    ParserHelper::ToLower($2);
+    $$->name_ = $2;
+    free($2);
+    $$->parameters_ = $4;
+}
+
 /*
  * UPDATE STATEMENT
  */
@@ -1227,6 +1262,10 @@ copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')' {
                 $$->row_limit_ = option_ptr->row_limit_;
                 break;
             }
+            case infinity::CopyOptionType::kCompression: {
+                $$->compression_type_ = option_ptr->compression_type_;
+                break;
+            }
         }
         delete option_ptr;
     }
@@ -1282,6 +1321,10 @@ copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')' {
                 $$->row_limit_ = option_ptr->row_limit_;
                 break;
             }
+            case infinity::CopyOptionType::kCompression: {
+                $$->compression_type_ = option_ptr->compression_type_;
+                break;
+            }
         }
         delete option_ptr;
     }
@@ -1725,6 +1768,16 @@ show_statement: SHOW DATABASES {
     $$ = new infinity::ShowStatement();
     $$->show_type_ = infinity::ShowStmtType::kMemIndex;
 }
+| SHOW INDEX IDENTIFIER {
+    if (strcasecmp($3, "builds") != 0) {
+        free($3);
+        yyerror(&yyloc, scanner, result, "Unknown show statement");
+        YYERROR;
+    }
+    free($3);
+    $$ = new infinity::ShowStatement();
+    $$->show_type_ = infinity::ShowStmtType::kIndexBuilds;
+}
 | SHOW QUERIES {
     $$ = new infinity::ShowStatement();
     $$->show_type_ = infinity::ShowStmtType::kQueries;
@@ -2128,6 +2181,36 @@ command_statement: USE IDENTIFIER {
     free($3->table_name_ptr_);
     delete $3;
 }
+| IDENTIFIER TABLE table_name {
+    if (strcasecmp($1, "scrub") != 0) {
+        free($1);
+        free($3->schema_name_ptr_);
+        free($3->table_name_ptr_);
+        delete $3;
+        yyerror(&yyloc, scanner, result, "Unknown command");
+        YYERROR;
+    }
+    free($1);
+    $$ = new infinity::CommandStatement();
+    ParserHelper::ToLower($3->schema_name_ptr_);
+    ParserHelper::ToLower($3->table_name_ptr_);
+    $$->command_info_ = std::make_shared<infinity::ScrubCmd>($3->schema_name_ptr_, $3->table_name_ptr_);
+    free($3->schema_name_ptr_);
+    free($3->table_name_ptr_);
+    delete $3;
+}
+| IDENTIFIER INDEX IDENTIFIER LONG_VALUE {
+    if (strcasecmp($1, "cancel") != 0 || strcasecmp($3, "build") != 0) {
+        free($1);
+        free($3);
+        yyerror(&yyloc, scanner, result, "Unknown command");
+        YYERROR;
+    }
+    free($1);
+    free($3);
+    $$ = new infinity::CommandStatement();
+    $$->command_info_ = std::make_shared<infinity::CancelIndexBuildCmd>($4);
+}
 
 compact_statement: COMPACT TABLE table_name {
     std::string schema_name;
@@ -2496,6 +2579,9 @@ operand: '(' expr ')' {
 | match_sparse_expr
 | query_expr
 | fusion_expr
+| '?' {
+    $$ = new infinity::ParameterExpr(result->parameter_count_++);
+}
 
 //                                       4                 6                 8          10         12                                          13
 //                  MATCH TENSOR  (  column_name, search_tensor, tensor_data_type, search_method, extra_match_tensor_option(including topn) optional_filter)
@@ -3558,6 +3644,32 @@ copy_option : FORMAT IDENTIFIER {
     $$->option_type_ = infinity::CopyOptionType::kRowLimit;
     $$->row_limit_ = $2;
 }
+| IDENTIFIER IDENTIFIER {
+    if (strcasecmp($1, "compression") != 0) {
+        free($1);
+        free($2);
+        yyerror(&yyloc, scanner, result, "Unknown copy option");
+        YYERROR;
+    }
+    free($1);
+    $$ = new infinity::CopyOption();
+    $$->option_type_ = infinity::CopyOptionType::kCompression;
+    if (strcasecmp($2, "zstd") == 0) {
+        $$->compression_type_ = infinity::CopyCompressionType::kZstd;
+        free($2);
+    } else if (strcasecmp($2, "lz4") == 0) {
+        $$->compression_type_ = infinity::CopyCompressionType::kLz4;
+        free($2);
+    } else if (strcasecmp($2, "none") == 0) {
+        $$->compression_type_ = infinity::CopyCompressionType::kNone;
+        free($2);
+    } else {
+        free($2);
+        delete $$;
+        yyerror(&yyloc, scanner, result, "Unknown compression type");
+        YYERROR;
+    }
+}
 
 file_path : STRING {
     $$ = $1;
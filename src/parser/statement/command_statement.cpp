@@ -23,5 +23,7 @@ std::string CheckTable::ToString() const { return "Check Table Command"; }
 std::string CommandStatement::ToString() const { return command_info_->ToString(); }
 std::string LockCmd::ToString() const { return "Lock Command"; }
 std::string UnlockCmd::ToString() const { return "Unlock Command"; }
+std::string ScrubCmd::ToString() const { return "Scrub Command"; }
+std::string CancelIndexBuildCmd::ToString() const { return "Cancel Index Build Command"; }
 
 } // namespace infinity
\ No newline at end of file
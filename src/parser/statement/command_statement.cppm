@@ -32,4 +32,6 @@ export using infinity::CheckTable;
 export using infinity::ExportCmd;
 export using infinity::LockCmd;
 export using infinity::UnlockCmd;
+export using infinity::ScrubCmd;
+export using infinity::CancelIndexBuildCmd;
 }
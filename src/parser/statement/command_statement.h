@@ -30,6 +30,8 @@ enum class CommandType {
     kCheckTable,
     kLockTable,
     kUnlockTable,
+    kScrubTable,
+    kCancelIndexBuild,
 };
 
 class CommandInfo {
@@ -216,6 +218,41 @@ private:
     std::string table_name_;
 };
 
+class ScrubCmd final : public CommandInfo {
+public:
+    explicit ScrubCmd(const char *db_name, const char *table_name)
+        : CommandInfo(CommandType::kScrubTable), db_name_(db_name == nullptr ? "" : db_name), table_name_(table_name) {}
+
+    ~ScrubCmd() final = default;
+
+    [[nodiscard]] std::string ToString() const final;
+
+    const std::string &db_name() const { return db_name_; }
+    const std::string &table_name() const { return table_name_; }
+
+    void SetDBName(const std::string &db_name) {
+        db_name_ = db_name;
+    }
+
+private:
+    std::string db_name_;
+    std::string table_name_;
+};
+
+class CancelIndexBuildCmd final : public CommandInfo {
+public:
+    explicit CancelIndexBuildCmd(int64_t job_id) : CommandInfo(CommandType::kCancelIndexBuild), job_id_(job_id) {}
+
+    ~CancelIndexBuildCmd() final = default;
+
+    [[nodiscard]] std::string ToString() const final;
+
+    int64_t job_id() const { return job_id_; }
+
+private:
+    int64_t job_id_{};
+};
+
 class CommandStatement final : public BaseStatement {
 public:
     CommandStatement() : BaseStatement(StatementType::kCommand) {}
@@ -73,6 +73,9 @@ std::string CopyStatement::ToString() const {
     }
 
     ss << "COPY: " << schema_name_ << "." << table_name_ << copy_direction << file_path_ << " WITH " << file_format << " delimiter: " << delimiter_;
+    if (compression_type_ != CopyCompressionType::kNone) {
+        ss << " compression: " << *CopyCompressionTypeToStr(compression_type_);
+    }
     return ss.str();
 }
 
@@ -27,6 +27,7 @@ enum class CopyOptionType {
     kOffset,
     kLimit,
     kRowLimit,
+    kCompression,
 };
 
 struct CopyOption {
@@ -37,6 +38,7 @@ struct CopyOption {
     size_t offset_{0};
     size_t limit_{0};
     size_t row_limit_{0};
+    CopyCompressionType compression_type_{CopyCompressionType::kNone};
 };
 
 class CopyStatement final : public BaseStatement {
@@ -57,6 +59,7 @@ public:
     size_t offset_{0};
     size_t limit_{0};
     size_t row_limit_{0};
+    CopyCompressionType compression_type_{CopyCompressionType::kNone};
 
     // EXPORT columns
     std::vector<ParsedExpr *> *expr_array_{nullptr};
@@ -13,3 +13,19 @@
 // limitations under the License.
 
 #include "execute_statement.h"
+
+namespace infinity {
+
+ExecuteStatement::~ExecuteStatement() {
+    if (parameters_ != nullptr) {
+        for (auto &parameter : *parameters_) {
+            delete parameter;
+        }
+        delete parameters_;
+        parameters_ = nullptr;
+    }
+}
+
+std::string ExecuteStatement::ToString() const { return "execute statement"; }
+
+} // namespace infinity
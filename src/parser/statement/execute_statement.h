@@ -15,9 +15,24 @@
 #pragma once
 
 #include "base_statement.h"
+#include "expr/parsed_expr.h"
+
+#include <string>
+#include <vector>
 
 namespace infinity {
 
-class ExecuteStatement : public BaseStatement {};
+class ExecuteStatement final : public BaseStatement {
+public:
+    ExecuteStatement() : BaseStatement(StatementType::kExecute) {}
+
+    ~ExecuteStatement() final;
+
+    [[nodiscard]] std::string ToString() const final;
+
+    std::string name_{};
+
+    std::vector<ParsedExpr *> *parameters_{nullptr};
+};
 
 } // namespace infinity
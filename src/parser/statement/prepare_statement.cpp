@@ -13,3 +13,16 @@
 // limitations under the License.
 
 #include "prepare_statement.h"
+
+namespace infinity {
+
+PrepareStatement::~PrepareStatement() {
+    if (statement_ != nullptr) {
+        delete statement_;
+        statement_ = nullptr;
+    }
+}
+
+std::string PrepareStatement::ToString() const { return "prepare statement"; }
+
+} // namespace infinity
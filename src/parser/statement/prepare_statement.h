@@ -16,8 +16,24 @@
 
 #include "base_statement.h"
 
+#include <string>
+
 namespace infinity {
 
-class PrepareStatement : public BaseStatement {};
+class PrepareStatement final : public BaseStatement {
+public:
+    PrepareStatement() : BaseStatement(StatementType::kPrepare) {}
+
+    ~PrepareStatement() final;
+
+    [[nodiscard]] std::string ToString() const final;
+
+    std::string name_{};
+
+    BaseStatement *statement_{nullptr};
+
+    // Count of '?' placeholders in statement_
+    size_t parameter_count_{0};
+};
 
 } // namespace infinity
@@ -40,6 +40,10 @@ std::string ShowStatement::ToString() const {
             ss << "Show mem index";
             break;
         }
+        case ShowStmtType::kIndexBuilds: {
+            ss << "Show index builds";
+            break;
+        }
         case ShowStmtType::kIndexSegment: {
             ss << "Show index segment, database: " << schema_name_ << ", table_name: " << table_name_;
             break;
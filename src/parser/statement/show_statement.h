@@ -43,6 +43,7 @@ enum class ShowStmtType {
     kConfig,
     kBuffer,
     kMemIndex,
+    kIndexBuilds,
     kQueries,
     kQuery,
     kTransactions,
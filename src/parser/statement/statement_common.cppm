@@ -23,5 +23,7 @@ namespace infinity {
 export using infinity::InitParameter;
 export using infinity::CopyFileType;
 export using infinity::CopyFileTypeToStr;
+export using infinity::CopyCompressionType;
+export using infinity::CopyCompressionTypeToStr;
 
 }
@@ -56,6 +56,23 @@ inline std::shared_ptr<std::string> CopyFileTypeToStr(CopyFileType copy_file_typ
     }
 }
 
+enum class CopyCompressionType {
+    kNone,
+    kZstd,
+    kLz4,
+};
+
+inline std::shared_ptr<std::string> CopyCompressionTypeToStr(CopyCompressionType compression_type) {
+    switch (compression_type) {
+        case CopyCompressionType::kNone:
+            return std::make_shared<std::string>("NONE");
+        case CopyCompressionType::kZstd:
+            return std::make_shared<std::string>("ZSTD");
+        case CopyCompressionType::kLz4:
+            return std::make_shared<std::string>("LZ4");
+    }
+}
+
 struct TableName {
     char *schema_name_ptr_{nullptr};
     char *table_name_ptr_{nullptr};
@@ -553,6 +553,10 @@ void ExplainAST::BuildShow(const ShowStatement *show_statement, SharedPtr<Vector
             result->emplace_back(MakeShared<String>("SHOW MEMINDEX"));
             break;
         }
+        case ShowStmtType::kIndexBuilds: {
+            result->emplace_back(MakeShared<String>("SHOW INDEX BUILDS"));
+            break;
+        }
         case ShowStmtType::kTables: {
             result->emplace_back(MakeShared<String>("SHOW TABLES: "));
             intent_size += 2;
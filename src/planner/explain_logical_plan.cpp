@@ -1467,6 +1467,25 @@ void ExplainLogicalPlan::Explain(const LogicalShow *show_node, SharedPtr<Vector<
             result->emplace_back(MakeShared<String>(output_columns_str));
             break;
         }
+        case ShowType::kShowIndexBuilds: {
+            String show_str;
+            if (intent_size != 0) {
+                show_str = String(intent_size - 2, ' ');
+                show_str += "-> SHOW INDEX BUILDS ";
+            } else {
+                show_str = "SHOW INDEX BUILDS ";
+            }
+            show_str += "(";
+            show_str += std::to_string(show_node->node_id());
+            show_str += ")";
+            result->emplace_back(MakeShared<String>(show_str));
+
+            String output_columns_str = String(intent_size, ' ');
+            output_columns_str += " - output columns: [job_id, db_name, table_name, index_name, segments, built_segments, rows, processed_rows, "
+                                  "elapsed_ms, remaining_ms]";
+            result->emplace_back(MakeShared<String>(output_columns_str));
+            break;
+        }
         case ShowType::kShowProfiles: {
             String show_str;
             if (intent_size != 0) {
@@ -2038,13 +2057,18 @@ void ExplainLogicalPlan::Explain(const BaseExpression *base_expression, String &
         }
         case ExpressionType::kIn: {
             InExpression *in_expression = (InExpression *)base_expression;
-            expr_str += "IN[";
+            Explain(in_expression->left_operand().get(), expr_str);
+            expr_str += in_expression->in_type() == InType::kNotIn ? " NOT IN[" : " IN[";
             SizeT argument_count = in_expression->arguments().size();
-            for (SizeT idx = 0; idx < argument_count - 1; ++idx) {
+            for (SizeT idx = 0; idx < argument_count; ++idx) {
+                if (idx > 0) {
+                    expr_str += ", ";
+                }
                 Explain(in_expression->arguments()[idx].get(), expr_str);
-                expr_str += ", ";
             }
-            Explain(in_expression->arguments().back().get(), expr_str);
+            if (in_expression->has_null_value()) {
+                expr_str += argument_count > 0 ? ", NULL" : "NULL";
+            }
             expr_str += "]";
             break;
         }
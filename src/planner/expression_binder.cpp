@@ -45,6 +45,7 @@ import match_sparse_expression;
 import function;
 import aggregate_function;
 import aggregate_function_set;
+import approx_percentile;
 
 import column_identifer;
 
@@ -76,9 +77,11 @@ import match_expr;
 import match_tensor_expr;
 import match_sparse_expr;
 import fusion_expr;
+import parameter_expr;
 import data_type;
 import expression_type;
 import catalog;
+import in_value_set;
 import table_entry;
 
 namespace infinity {
@@ -141,6 +144,9 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildExpression(const ParsedExpr &ex
         case ParsedExprType::kMatch: {
             return BuildMatchTextExpr(static_cast<const MatchExpr &>(expr), bind_context_ptr, depth, root);
         }
+        case ParsedExprType::kParameter: {
+            return BuildParameterExpr(static_cast<const ParameterExpr &>(expr), bind_context_ptr, depth, root);
+        }
         default: {
             UnrecoverableError(fmt::format("ExpressionBinder::BuildExpression: Unexpected ParsedExprType for ParsedExpr: {}.", expr.ToString()));
         }
@@ -196,6 +202,22 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildBetweenExpr(const BetweenExpr &
     return MakeShared<FunctionExpression>(scalar_function, arguments);
 }
 
+SharedPtr<BaseExpression> ExpressionBinder::BuildParameterExpr(const ParameterExpr &expr, BindContext *bind_context_ptr, i64 depth, bool root) {
+    const ParsedExpr *parameter = query_context_->GetParameter(expr.index_);
+    if (parameter == nullptr) {
+        Status status = Status::SyntaxError(fmt::format("Parameter {} isn't bound, placeholder is only allowed in prepared statement.", expr.ToString()));
+        RecoverableError(status);
+    }
+    SharedPtr<BaseExpression> expression = BuildExpression(*parameter, bind_context_ptr, depth, root);
+    // A later EXECUTE of the cached plan substitutes its argument into this value in place.
+    SharedPtr<ValueExpression> value_expression{};
+    if (expression->type() == ExpressionType::kValue) {
+        value_expression = std::static_pointer_cast<ValueExpression>(expression);
+    }
+    query_context_->AddParameterSlot(expr.index_, std::move(value_expression));
+    return expression;
+}
+
 SharedPtr<BaseExpression> ExpressionBinder::BuildValueExpr(const ConstantExpr &expr, BindContext *, i64, bool) {
     switch (expr.literal_type_) {
         case LiteralType::kInteger: {
@@ -385,6 +407,52 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildColExpr(const ColumnExpr &expr,
     return column_expr;
 }
 
+namespace {
+
+f64 GetPercentileArgument(const BaseExpression &argument) {
+    if (argument.type() == ExpressionType::kValue) {
+        const Value &value = static_cast<const ValueExpression &>(argument).GetValue();
+        f64 quantile = -1;
+        switch (value.type().type()) {
+            case LogicalType::kTinyInt: {
+                quantile = value.GetValue<TinyIntT>();
+                break;
+            }
+            case LogicalType::kSmallInt: {
+                quantile = value.GetValue<SmallIntT>();
+                break;
+            }
+            case LogicalType::kInteger: {
+                quantile = value.GetValue<IntegerT>();
+                break;
+            }
+            case LogicalType::kBigInt: {
+                quantile = value.GetValue<BigIntT>();
+                break;
+            }
+            case LogicalType::kFloat: {
+                quantile = value.GetValue<FloatT>();
+                break;
+            }
+            case LogicalType::kDouble: {
+                quantile = value.GetValue<DoubleT>();
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+        if (quantile >= 0 && quantile <= 1) {
+            return quantile;
+        }
+    }
+    Status status = Status::InvalidParameterValue("approx_percentile", argument.Name(), "a number in [0, 1]");
+    RecoverableError(status);
+    return 0;
+}
+
+} // namespace
+
 SharedPtr<BaseExpression> ExpressionBinder::BuildFuncExpr(const FunctionExpr &expr, BindContext *bind_context_ptr, i64 depth, bool) {
     auto special_function = TryBuildSpecialFuncExpr(expr, bind_context_ptr, depth);
 
@@ -445,6 +513,11 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildFuncExpr(const FunctionExpr &ex
             // SharedPtr<AggregateFunctionSet> aggregate_function_set_ptr
             auto aggregate_function_set_ptr = static_pointer_cast<AggregateFunctionSet>(function_set_ptr);
             AggregateFunction aggregate_function = aggregate_function_set_ptr->GetMostMatchFunction(arguments[0]);
+            if (function_set_ptr->name() == "APPROX_PERCENTILE" && arguments.size() == 2) {
+                // approx_percentile(column, quantile), the quantile is bound into the function
+                BindApproxPercentile(aggregate_function, GetPercentileArgument(*arguments[1]));
+                arguments.pop_back();
+            }
             auto aggregate_function_ptr = MakeShared<AggregateExpression>(aggregate_function, arguments);
             return aggregate_function_ptr;
         }
@@ -504,7 +577,9 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildCaseExpr(const CaseExpr &expr,
             // SharedPtr<BaseExpression> then_expr
             SharedPtr<BaseExpression> then_expr_ptr = BuildExpression(*(when_then_expr->then_), bind_context_ptr, depth, false);
             case_expression_ptr->AddCaseCheck(when_expr_ptr, then_expr_ptr);
-            return_type.MaxDataType(then_expr_ptr->Type());
+            if (then_expr_ptr->Type().type() != LogicalType::kNull) {
+                return_type.MaxDataType(then_expr_ptr->Type());
+            }
         }
     } else {
         // Searched case
@@ -517,32 +592,80 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildCaseExpr(const CaseExpr &expr,
             // SharedPtr<BaseExpression> then_expr
             SharedPtr<BaseExpression> then_expr_ptr = BuildExpression(*(when_then_expr->then_), bind_context_ptr, depth, false);
             case_expression_ptr->AddCaseCheck(when_expr_ptr, then_expr_ptr);
-            return_type.MaxDataType(then_expr_ptr->Type());
+            if (then_expr_ptr->Type().type() != LogicalType::kNull) {
+                return_type.MaxDataType(then_expr_ptr->Type());
+            }
         }
     }
     // Construct else expression
     SharedPtr<BaseExpression> else_expr_ptr;
     if (expr.else_expr_ != nullptr) {
         else_expr_ptr = BuildExpression(*expr.else_expr_, bind_context_ptr, depth, false);
-        return_type.MaxDataType(else_expr_ptr->Type());
+        if (else_expr_ptr->Type().type() != LogicalType::kNull) {
+            return_type.MaxDataType(else_expr_ptr->Type());
+        }
     } else {
         else_expr_ptr = MakeShared<ValueExpression>(Value::MakeNull());
     }
+    if (return_type.type() == LogicalType::kInvalid) {
+        Status status = Status::NotSupport("CASE expression with only NULL results");
+        RecoverableError(status);
+    }
+
+    // Each branch is evaluated on its own rows and written to the result column, so all results must have the type of the CASE.
+    // NULL results stay untyped and are written as nulls.
+    for (CaseCheck &case_check : case_expression_ptr->CaseExpr()) {
+        case_check.when_expr_ = CastExpression::AddCastToType(case_check.when_expr_, DataType(LogicalType::kBoolean));
+        if (case_check.then_expr_->Type().type() != LogicalType::kNull) {
+            case_check.then_expr_ = CastExpression::AddCastToType(case_check.then_expr_, return_type);
+        }
+    }
+    if (else_expr_ptr->Type().type() != LogicalType::kNull) {
+        else_expr_ptr = CastExpression::AddCastToType(else_expr_ptr, return_type);
+    }
     case_expression_ptr->AddElseExpr(else_expr_ptr);
 
     case_expression_ptr->SetReturnType(return_type);
     return case_expression_ptr;
 }
 
+// Expression which gives the same value for every row
+inline bool IsConstantExpression(const BaseExpression &expr) {
+    switch (expr.type()) {
+        case ExpressionType::kValue: {
+            return true;
+        }
+        case ExpressionType::kCast:
+        case ExpressionType::kFunction: {
+            for (const auto &argument : expr.arguments()) {
+                if (!IsConstantExpression(*argument)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
 SharedPtr<BaseExpression> ExpressionBinder::BuildInExpr(const InExpr &expr, BindContext *bind_context_ptr, i64 depth, bool) {
     auto bound_left_expr = BuildExpression(*expr.left_, bind_context_ptr, depth, false);
 
     SizeT argument_count = expr.arguments_->size();
     Vector<SharedPtr<BaseExpression>> arguments;
     arguments.reserve(argument_count);
+    bool has_null_value = false;
+    bool constant_values = true;
 
     for (SizeT idx = 0; idx < argument_count; ++idx) {
         auto bound_argument_expr = BuildExpression(*expr.arguments_->at(idx), bind_context_ptr, depth, false);
+        if (bound_argument_expr->type() == ExpressionType::kValue && bound_argument_expr->Type().type() == LogicalType::kNull) {
+            has_null_value = true;
+            continue;
+        }
+        constant_values = constant_values && IsConstantExpression(*bound_argument_expr);
         arguments.emplace_back(bound_argument_expr);
     }
 
@@ -552,8 +675,64 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildInExpr(const InExpr &expr, Bind
     } else {
         in_type = InType::kIn;
     }
-    SharedPtr<InExpression> in_expression_ptr = MakeShared<InExpression>(in_type, bound_left_expr, arguments);
-    return in_expression_ptr;
+
+    // The values are compared with the left operand in the type "=" would use. A value which needs a wider type widens the whole list.
+    Catalog *catalog = query_context_->storage()->catalog();
+    SharedPtr<FunctionSet> equals_function_set_ptr = Catalog::GetFunctionSetByName(catalog, "=");
+    CheckFuncType(equals_function_set_ptr->type_);
+    auto equals_scalar_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(equals_function_set_ptr);
+    DataType compare_type = bound_left_expr->Type();
+    for (const auto &argument : arguments) {
+        Vector<SharedPtr<BaseExpression>> compare_arguments{CastExpression::AddCastToType(bound_left_expr, compare_type), argument};
+        ScalarFunction equals_function = equals_scalar_function_set_ptr->GetMostMatchFunction(compare_arguments);
+        compare_type = equals_function.parameter_types_[0];
+    }
+
+    if (constant_values && InValueSet::SupportType(compare_type)) {
+        // Evaluated with a hash set of the values
+        for (auto &argument : arguments) {
+            argument = CastExpression::AddCastToType(argument, compare_type);
+        }
+        auto left_expr = CastExpression::AddCastToType(bound_left_expr, compare_type);
+        return MakeShared<InExpression>(in_type, std::move(left_expr), arguments, has_null_value);
+    }
+
+    // Otherwise "x IN (a, b)" is "x = a OR x = b"
+    if (has_null_value) {
+        Status status = Status::NotSupport(fmt::format("NULL in the IN list of {} with non-constant values", bound_left_expr->Name()));
+        RecoverableError(status);
+    }
+    Vector<SharedPtr<BaseExpression>> equals_exprs;
+    equals_exprs.reserve(arguments.size());
+    for (const auto &argument : arguments) {
+        Vector<SharedPtr<BaseExpression>> compare_arguments{CastExpression::AddCastToType(bound_left_expr, compare_type),
+                                                            CastExpression::AddCastToType(argument, compare_type)};
+        ScalarFunction equals_function = equals_scalar_function_set_ptr->GetMostMatchFunction(compare_arguments);
+        equals_exprs.emplace_back(MakeShared<FunctionExpression>(equals_function, std::move(compare_arguments)));
+    }
+    auto or_scalar_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(Catalog::GetFunctionSetByName(catalog, "OR"));
+    // Balanced, so that long lists don't make deep expression trees
+    while (equals_exprs.size() > 1) {
+        Vector<SharedPtr<BaseExpression>> next_exprs;
+        next_exprs.reserve((equals_exprs.size() + 1) / 2);
+        for (SizeT idx = 0; idx + 1 < equals_exprs.size(); idx += 2) {
+            Vector<SharedPtr<BaseExpression>> or_arguments{std::move(equals_exprs[idx]), std::move(equals_exprs[idx + 1])};
+            ScalarFunction or_function = or_scalar_function_set_ptr->GetMostMatchFunction(or_arguments);
+            next_exprs.emplace_back(MakeShared<FunctionExpression>(or_function, std::move(or_arguments)));
+        }
+        if (equals_exprs.size() % 2 == 1) {
+            next_exprs.emplace_back(std::move(equals_exprs.back()));
+        }
+        equals_exprs = std::move(next_exprs);
+    }
+    SharedPtr<BaseExpression> result = std::move(equals_exprs[0]);
+    if (in_type == InType::kNotIn) {
+        auto not_scalar_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(Catalog::GetFunctionSetByName(catalog, "NOT"));
+        Vector<SharedPtr<BaseExpression>> not_arguments{std::move(result)};
+        ScalarFunction not_function = not_scalar_function_set_ptr->GetMostMatchFunction(not_arguments);
+        result = MakeShared<FunctionExpression>(not_function, std::move(not_arguments));
+    }
+    return result;
 }
 
 inline bool EmbeddingEmbeddingQueryTypeValidated(const EmbeddingDataType column_embedding_type, const EmbeddingDataType query_embedding_type) {
@@ -36,6 +36,7 @@ import match_sparse_expr;
 import search_expr;
 import subquery_expr;
 import cast_expr;
+import parameter_expr;
 
 namespace infinity {
 
@@ -61,6 +62,9 @@ public:
 
     virtual SharedPtr<BaseExpression> BuildValueExpr(const ConstantExpr &expr, BindContext *bind_context_ptr, i64 depth, bool root);
 
+    // Bind the '?' placeholder of a prepared statement to the argument given by EXECUTE
+    virtual SharedPtr<BaseExpression> BuildParameterExpr(const ParameterExpr &expr, BindContext *bind_context_ptr, i64 depth, bool root);
+
     // Bind column reference expression also include correlated column reference.
     virtual SharedPtr<BaseExpression> BuildColExpr(const ColumnExpr &expr, BindContext *bind_context_ptr, i64 depth, bool root);
 
@@ -23,6 +23,7 @@ module;
 module logical_planner;
 
 import stl;
+import clustering_key;
 import bind_context;
 
 import infinity_exception;
@@ -48,6 +49,7 @@ import logical_create_collection;
 import logical_create_schema;
 import logical_create_view;
 import logical_create_index;
+import table_index_entry;
 import logical_delete;
 import logical_drop_table;
 import logical_drop_collection;
@@ -211,9 +213,6 @@ Status LogicalPlanner::BuildInsertValue(const InsertStatement *statement, Shared
     // Create value list
     Vector<Vector<SharedPtr<BaseExpression>>> value_list_array;
     SizeT value_count = statement->values_->size();
-    if (value_count > INSERT_BATCH_ROW_LIMIT) {
-        RecoverableError(Status::NotSupport("Insert batch row limit shouldn't more than 8192."));
-    }
 
     for (SizeT idx = 0; idx < value_count; ++idx) {
         const auto *parsed_expr_list = (*(statement->values_))[idx];
@@ -558,6 +557,43 @@ Status LogicalPlanner::BuildCreateTable(const CreateStatement *statement, Shared
                         fmt::format("Bloom filter can't be created for {} type column {}", def->type()->ToString(), def->name()));
                 }
             }
+        } else if (param_name == "clustering_key") {
+            // sort order: "c1, c2", Z-order: "zorder(c1, c2)"
+            String key_columns = param_value;
+            bool z_order = false;
+            if (key_columns.starts_with("zorder(") && key_columns.ends_with(")")) {
+                z_order = true;
+                key_columns = key_columns.substr(7, key_columns.size() - 8);
+            }
+            IStringStream column_name_stream(key_columns);
+            String column_name;
+            i32 key_idx = 0;
+            while (std::getline(column_name_stream, column_name, ',')) {
+                // remove leading and trailing spaces
+                if (SizeT start = column_name.find_first_not_of(' '); start != String::npos) {
+                    column_name = column_name.substr(start);
+                }
+                if (SizeT end = column_name.find_last_not_of(' '); end != String::npos) {
+                    column_name = column_name.substr(0, end + 1);
+                }
+                SizeT column_id = table_def_ptr->GetColIdByName(column_name);
+                if (column_id == static_cast<SizeT>(-1)) {
+                    return Status::SyntaxError(fmt::format("Column {} not found in table {}", column_name, *table_def_ptr->table_name()));
+                }
+                auto &def = table_def_ptr->columns()[column_id];
+                if (def->clustering_key_idx_ >= 0) {
+                    return Status::SyntaxError(fmt::format("Duplicate column {} in clustering key", column_name));
+                }
+                if (!ClusteringKey::SupportType(*def->type())) {
+                    return Status::SyntaxError(
+                        fmt::format("Clustering key can't contain {} type column {}", def->type()->ToString(), def->name()));
+                }
+                def->clustering_key_idx_ = key_idx++;
+                def->clustering_z_order_ = z_order;
+            }
+            if (key_idx == 0) {
+                return Status::SyntaxError("Empty clustering key");
+            }
         }
     }
 
@@ -912,6 +948,14 @@ Status LogicalPlanner::BuildExport(const CopyStatement *statement, SharedPtr<Bin
         }
     }
 
+    if (statement->compression_type_ != CopyCompressionType::kNone && statement->copy_file_type_ != CopyFileType::kCSV &&
+        statement->copy_file_type_ != CopyFileType::kJSONL) {
+        Status status = Status::NotSupport(fmt::format("Compression: {} isn't supported when exporting file type: {}",
+                                                       *CopyCompressionTypeToStr(statement->compression_type_),
+                                                       *CopyFileTypeToStr(statement->copy_file_type_)));
+        RecoverableError(status);
+    }
+
     // Check the file existence
     LocalFileSystem fs;
 
@@ -1055,6 +1099,7 @@ Status LogicalPlanner::BuildExport(const CopyStatement *statement, SharedPtr<Bin
                                                                       statement->offset_,
                                                                       statement->limit_,
                                                                       statement->row_limit_,
+                                                                      statement->compression_type_,
                                                                       column_idx_array,
                                                                       block_index);
 
@@ -1202,6 +1247,24 @@ Status LogicalPlanner::BuildCommand(const CommandStatement *command_statement, S
             this->logical_plan_ = logical_command;
             break;
         }
+        case CommandType::kScrubTable: {
+            auto *scrub_table = static_cast<ScrubCmd *>(command_statement->command_info_.get());
+            if (scrub_table->db_name().empty()) {
+                scrub_table->SetDBName(query_context_ptr_->schema_name());
+            }
+            auto [table_entry, status] = txn->GetTableByName(scrub_table->db_name(), scrub_table->table_name());
+            if (!status.ok()) {
+                return status;
+            }
+            auto logical_command = MakeShared<LogicalCommand>(bind_context_ptr->GetNewLogicalNodeId(), command_statement->command_info_);
+            this->logical_plan_ = logical_command;
+            break;
+        }
+        case CommandType::kCancelIndexBuild: {
+            auto logical_command = MakeShared<LogicalCommand>(bind_context_ptr->GetNewLogicalNodeId(), command_statement->command_info_);
+            this->logical_plan_ = logical_command;
+            break;
+        }
         default: {
             String error_message = "Invalid command type.";
             UnrecoverableError(error_message);
@@ -1305,6 +1368,9 @@ Status LogicalPlanner::BuildShow(ShowStatement *statement, SharedPtr<BindContext
         case ShowStmtType::kMemIndex: {
             return BuildShowMemIndex(statement, bind_context_ptr);
         }
+        case ShowStmtType::kIndexBuilds: {
+            return BuildShowIndexBuilds(statement, bind_context_ptr);
+        }
         case ShowStmtType::kLogs: {
             return BuildShowLogs(statement, bind_context_ptr);
         }
@@ -1675,6 +1741,16 @@ Status LogicalPlanner::BuildShowMemIndex(const ShowStatement *statement, SharedP
     return Status::OK();
 }
 
+Status LogicalPlanner::BuildShowIndexBuilds(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
+    SharedPtr<LogicalNode> logical_show = MakeShared<LogicalShow>(bind_context_ptr->GetNewLogicalNodeId(),
+                                                                  ShowType::kShowIndexBuilds,
+                                                                  statement->schema_name_,
+                                                                  statement->var_name_,
+                                                                  bind_context_ptr->GenerateTableIndex());
+    this->logical_plan_ = logical_show;
+    return Status::OK();
+}
+
 Status LogicalPlanner::BuildShowLogs(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
     SharedPtr<LogicalNode> logical_show = MakeShared<LogicalShow>(bind_context_ptr->GetNewLogicalNodeId(),
                                                                   ShowType::kShowLogs,
@@ -1806,6 +1882,16 @@ Status LogicalPlanner::BuildFlushBuffer(const FlushStatement *, SharedPtr<BindCo
 
 Status LogicalPlanner::BuildOptimize(OptimizeStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
     BindSchemaName(statement->schema_name_);
+    for (const auto &opt_param : statement->opt_params_) {
+        if (opt_param->param_name_ != "resume_build") {
+            continue;
+        }
+        if (statement->opt_params_.size() != 1) {
+            Status status = Status::NotSupport("resume_build can't be combined with other optimize options");
+            RecoverableError(status);
+        }
+        return BuildResumeIndex(statement, bind_context_ptr);
+    }
     SharedPtr<LogicalNode> logical_optimize = MakeShared<LogicalOptimize>(bind_context_ptr->GetNewLogicalNodeId(),
                                                                           statement->schema_name_,
                                                                           statement->table_name_,
@@ -1815,6 +1901,32 @@ Status LogicalPlanner::BuildOptimize(OptimizeStatement *statement, SharedPtr<Bin
     return Status::OK();
 }
 
+Status LogicalPlanner::BuildResumeIndex(const OptimizeStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
+    Txn *txn = query_context_ptr_->GetTxn();
+    UniquePtr<QueryBinder> query_binder_ptr = MakeUnique<QueryBinder>(this->query_context_ptr_, bind_context_ptr);
+    auto base_table_ref = query_binder_ptr->GetTableRef(statement->schema_name_, statement->table_name_);
+    auto [table_index_entry, status] = txn->GetIndexByName(statement->schema_name_, statement->table_name_, statement->index_name_);
+    if (!status.ok()) {
+        RecoverableError(status);
+    }
+    status = base_table_ref->table_entry_ptr_->AddWriteTxnNum(txn);
+    if (!status.ok()) {
+        RecoverableError(status);
+    }
+
+    // Run the tasks of CREATE INDEX on the segments that a cancelled build left without index
+    auto logical_create_index_operator = MakeShared<LogicalCreateIndex>(bind_context_ptr->GetNewLogicalNodeId(),
+                                                                        base_table_ref,
+                                                                        table_index_entry->table_index_def(),
+                                                                        ConflictType::kError,
+                                                                        true);
+
+    this->logical_plan_ = logical_create_index_operator;
+    this->names_ptr_->emplace_back("OK");
+    this->types_ptr_->emplace_back(LogicalType::kInteger);
+    return Status::OK();
+}
+
 Status LogicalPlanner::BuildExplain(const ExplainStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
     UniquePtr<QueryBinder> query_binder_ptr = MakeUnique<QueryBinder>(this->query_context_ptr_, bind_context_ptr);
 
@@ -159,6 +159,8 @@ public:
 
     Status BuildShowMemIndex(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
+    Status BuildShowIndexBuilds(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
+
     Status BuildShowProfiles(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
     Status BuildShowSessionVariable(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
@@ -201,6 +203,8 @@ public:
     // Optimize
     Status BuildOptimize(OptimizeStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
+    Status BuildResumeIndex(const OptimizeStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
+
     Status BuildCommand(const CommandStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
     Status BuildCompact(const CompactStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
@@ -114,6 +114,16 @@ String LogicalCommand::ToString(i64 &space) const {
             ss << String(space, ' ') << arrow_str << "Lock table: " << unlock_table_info->db_name() << "." << unlock_table_info->table_name();
             break;
         }
+        case CommandType::kScrubTable: {
+            auto *scrub_table_info = static_cast<ScrubCmd *>(command_info_.get());
+            ss << String(space, ' ') << arrow_str << "Scrub table: " << scrub_table_info->db_name() << "." << scrub_table_info->table_name();
+            break;
+        }
+        case CommandType::kCancelIndexBuild: {
+            auto *cancel_index_build_info = static_cast<CancelIndexBuildCmd *>(command_info_.get());
+            ss << String(space, ' ') << arrow_str << "Cancel index build: " << cancel_index_build_info->job_id();
+            break;
+        }
         case CommandType::kInvalid: {
             String error_message = "Invalid command type.";
             UnrecoverableError(error_message);
@@ -42,9 +42,13 @@ public:
     inline String name() override { return "LogicalCreateIndex"; }
 
 public:
-    inline LogicalCreateIndex(u64 node_id, SharedPtr<BaseTableRef> base_table_ref, SharedPtr<IndexBase> index_base, ConflictType conflict_type)
+    inline LogicalCreateIndex(u64 node_id,
+                              SharedPtr<BaseTableRef> base_table_ref,
+                              SharedPtr<IndexBase> index_base,
+                              ConflictType conflict_type,
+                              bool resume = false)
         : LogicalNode(node_id, LogicalNodeType::kCreateIndex), base_table_ref_(base_table_ref), index_definition_(index_base),
-          conflict_type_(conflict_type) {}
+          conflict_type_(conflict_type), resume_(resume) {}
 
 public:
     [[nodiscard]] inline SharedPtr<BaseTableRef> base_table_ref() const { return base_table_ref_; }
@@ -53,9 +57,13 @@ public:
 
     [[nodiscard]] inline ConflictType conflict_type() const { return conflict_type_; }
 
+    [[nodiscard]] inline bool resume() const { return resume_; }
+
 private:
     SharedPtr<BaseTableRef> base_table_ref_{};
     SharedPtr<IndexBase> index_definition_{};
     ConflictType conflict_type_{ConflictType::kInvalid};
+    // Build the segments that a cancelled CREATE INDEX left without index, instead of creating the index
+    bool resume_{false};
 };
 } // namespace infinity
\ No newline at end of file
@@ -39,7 +39,7 @@ LogicalIndexScan::LogicalIndexScan(u64 node_id,
                                    SharedPtr<BaseExpression> &&index_filter_qualified,
                                    HashMap<ColumnID, TableIndexEntry *> &&column_index_map,
                                    Vector<FilterExecuteElem> &&filter_execute_command,
-                                   UniquePtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
+                                   SharedPtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
                                    bool add_row_id)
     : LogicalNode(node_id, LogicalNodeType::kIndexScan), base_table_ref_(std::move(base_table_ref)),
       index_filter_qualified_(std::move(index_filter_qualified)), column_index_map_(std::move(column_index_map)),
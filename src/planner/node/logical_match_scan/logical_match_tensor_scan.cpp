@@ -36,8 +36,13 @@ import logger;
 namespace infinity {
 
 void LogicalMatchTensorScan::InitExtraOptions() {
-    static const std::set<String> valid_options =
-        {"topn", "emvb_centroid_nprobe", "emvb_threshold_first", "emvb_n_doc_to_score", "emvb_n_doc_out_second_stage", "emvb_threshold_final"};
+    static const std::set<String> valid_options = {"topn",
+                                                   "emvb_centroid_nprobe",
+                                                   "emvb_threshold_first",
+                                                   "emvb_n_doc_to_score",
+                                                   "emvb_n_doc_out_second_stage",
+                                                   "emvb_threshold_final",
+                                                   "centroid_n_doc_to_score"};
     auto match_tensor_expr = static_cast<MatchTensorExpression *>(query_expression_.get());
     SearchOptions options(match_tensor_expr->options_text_);
     for (const auto &[x, _] : options.options_) {
@@ -101,6 +106,18 @@ void LogicalMatchTensorScan::InitExtraOptions() {
     if (const auto emvb_threshold_final_it = options.options_.find("emvb_threshold_final"); emvb_threshold_final_it != options.options_.end()) {
         index_options_->emvb_threshold_final_ = std::stof(emvb_threshold_final_it->second);
     }
+    if (const auto centroid_n_doc_to_score_it = options.options_.find("centroid_n_doc_to_score"); centroid_n_doc_to_score_it != options.options_.end()) {
+        const auto centroid_n_doc_to_score_candidate = std::stoi(centroid_n_doc_to_score_it->second);
+        if (centroid_n_doc_to_score_candidate < 0) {
+            Status status = Status::SyntaxError("centroid_n_doc_to_score must be a non-negative integer");
+            RecoverableError(std::move(status));
+        }
+        if (centroid_n_doc_to_score_candidate > 0 && static_cast<u32>(centroid_n_doc_to_score_candidate) < topn_) {
+            Status status = Status::SyntaxError("centroid_n_doc_to_score must be at least topn");
+            RecoverableError(std::move(status));
+        }
+        index_options_->centroid_n_doc_to_score_ = centroid_n_doc_to_score_candidate;
+    }
 }
 
 } // namespace infinity
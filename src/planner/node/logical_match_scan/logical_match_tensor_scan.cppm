@@ -41,6 +41,8 @@ export struct MatchTensorScanIndexOptions {
     u32 emvb_n_doc_to_score_ = topn_ * EMVB_N_DOC_TO_SCORE_FACTOR;
     u32 emvb_n_doc_out_second_stage_ = topn_ * EMVB_N_DOC_OUT_SECOND_STAGE_FACTOR;
     f32 emvb_threshold_final_ = EMVB_THRESHOLD_FINAL;
+    // segments without index: number of documents ranked by the centroid codes to score with exact MaxSim, 0 scores all documents
+    u32 centroid_n_doc_to_score_ = 0;
     explicit MatchTensorScanIndexOptions(u32 topn) : topn_(topn) {}
 };
 
@@ -76,6 +76,8 @@ String ToString(ShowType type) {
             return "Show buffer";
         case ShowType::kShowMemIndex:
             return "Sow memindex";
+        case ShowType::kShowIndexBuilds:
+            return "Show index builds";
         case ShowType::kShowQueries:
             return "Show queries";
         case ShowType::kShowQuery:
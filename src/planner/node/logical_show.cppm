@@ -55,6 +55,7 @@ export enum class ShowType {
     kShowConfig,
     kShowBuffer,
     kShowMemIndex,
+    kShowIndexBuilds,
     kShowLogs,
     kShowDeltaLogs,
     kShowCatalogs,
@@ -136,14 +136,21 @@ Vector<SizeT> LoadedColumn(const Vector<LoadMeta> *load_metas, BaseTableRef *tab
 SharedPtr<BaseExpression> CleanScan::VisitReplace(const SharedPtr<ColumnExpression> &expression) { return expression; }
 
 template <typename LogicalNodeSubType>
-inline void CleanScanVisitBaseTableRefNode(LogicalNode &op, SharedPtr<Vector<LoadMeta>> &last_op_load_metas_, Vector<SizeT> &scan_table_indexes_) {
+inline void CleanScanVisitBaseTableRefNode(LogicalNode &op,
+                                           SharedPtr<Vector<LoadMeta>> &last_op_load_metas_,
+                                           Vector<SizeT> &scan_table_indexes_,
+                                           bool late_materialize) {
     auto &node = static_cast<LogicalNodeSubType &>(op);
     // node base table ref has two parts:
-    // 1. the columns used by next operator
+    // 1. the columns used by next operator, unless they are loaded later by row id
     // 2. the columns used by filter expression in node
     auto &node_load_metas = *node.load_metas();
     Vector<LoadMeta> node_columns = std::move(node_load_metas);
     node_load_metas.clear(); // need to set load_metas of node to empty vector
+    if (late_materialize) {
+        node.base_table_ref_->RetainColumnByIndices(LoadedColumn(&node_columns, node.base_table_ref_.get()));
+        return;
+    }
     auto &last_op_load_metas = *last_op_load_metas_;
     node_columns.insert(node_columns.end(), last_op_load_metas.begin(), last_op_load_metas.end());
     Vector<SizeT> project_idxs = LoadedColumn(&node_columns, node.base_table_ref_.get());
@@ -152,6 +159,9 @@ inline void CleanScanVisitBaseTableRefNode(LogicalNode &op, SharedPtr<Vector<Loa
 }
 
 void CleanScan::VisitNode(LogicalNode &op) {
+    // the children of `op` see it as their parent, restored for the siblings of `op` afterwards
+    const LogicalNodeType parent_op_type = parent_op_type_;
+    parent_op_type_ = op.operator_type();
     switch (op.operator_type()) {
         case LogicalNodeType::kTableScan: {
             auto &table_scan = static_cast<LogicalTableScan &>(op);
@@ -170,12 +180,21 @@ void CleanScan::VisitNode(LogicalNode &op) {
         }
         case LogicalNodeType::kKnnScan:
         case LogicalNodeType::kMatchSparseScan:
-        case LogicalNodeType::kMatchTensorScan: {
-            CleanScanVisitBaseTableRefNode<LogicalMatchScanBase>(op, last_op_load_metas_, scan_table_indexes_);
-            break;
-        }
+        case LogicalNodeType::kMatchTensorScan:
         case LogicalNodeType::kMatch: {
-            CleanScanVisitBaseTableRefNode<LogicalMatch>(op, last_op_load_metas_, scan_table_indexes_);
+            // A search only outputs its top n rows, which carry their row ids: the projection above loads the columns it needs
+            // after the search, and only for the rows which are returned. Any other parent (sort, top, limit) gets the columns
+            // from the search node.
+            const bool late_materialize = parent_op_type == LogicalNodeType::kProject;
+            if (op.operator_type() == LogicalNodeType::kMatch) {
+                CleanScanVisitBaseTableRefNode<LogicalMatch>(op, last_op_load_metas_, scan_table_indexes_, late_materialize);
+            } else {
+                CleanScanVisitBaseTableRefNode<LogicalMatchScanBase>(op, last_op_load_metas_, scan_table_indexes_, late_materialize);
+            }
+            if (late_materialize) {
+                // keep the load_metas of the projection
+                last_op_node_id_ = op.node_id();
+            }
             break;
         }
         case LogicalNodeType::kLimit: {
@@ -289,6 +308,7 @@ void CleanScan::VisitNode(LogicalNode &op) {
             break;
         }
     }
+    parent_op_type_ = parent_op_type;
 }
 
 } // namespace infinity
\ No newline at end of file
@@ -55,6 +55,7 @@ private:
 
     SharedPtr<Vector<LoadMeta>> last_op_load_metas_{};
     u64 last_op_node_id_{};
+    LogicalNodeType parent_op_type_{LogicalNodeType::kInvalid};
     Vector<SizeT> scan_table_indexes_{};
 };
 
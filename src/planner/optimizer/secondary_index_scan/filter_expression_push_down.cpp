@@ -36,6 +36,7 @@ import scalar_function_set;
 import cast_expression;
 import column_expression;
 import value_expression;
+import in_expression;
 import secondary_index_scan_execute_expression;
 import index_base;
 import table_index_entry;
@@ -333,6 +334,8 @@ private:
                 // case 1.
                 return CheckExprIndexStateAndRewrite(expression, 0);
             }
+        } else if (expression->type() == ExpressionType::kIn) {
+            return RewriteInForIndexScan(std::static_pointer_cast<InExpression>(expression));
         } else if (expression->type() == ExpressionType::kValue) {
             LOG_TRACE(fmt::format("Unsupported expression type: In CanApplyIndexScan(), the expression \"{}\" is a value expression. "
                                   "Need to apply the expression rewrite optimizer first.",
@@ -344,6 +347,75 @@ private:
         }
     }
 
+    inline bool IsColumnWithIndex(const SharedPtr<BaseExpression> &expr, u32 depth) const {
+        if (!(expr->Type().CanBuildSecondaryIndex())) {
+            // Unsupported type
+            LOG_TRACE(fmt::format("Expression depth: {}. In is_column_index(), unsupported column value type {}. Expression: {}.",
+                                  depth,
+                                  expr->Type().ToString(),
+                                  expr->Name()));
+            return false;
+        }
+        auto column_expression = std::static_pointer_cast<ColumnExpression>(expr);
+        auto column_id = column_expression->binding().column_idx;
+        if (candidate_column_index_map_.contains(column_id)) {
+            LOG_TRACE(fmt::format("Expression depth: {}. Column {} has index.", depth, expr->Name()));
+            return true;
+        } else {
+            LOG_TRACE(fmt::format("Expression depth: {}. Column {} does not have a secondary index. Cannot apply index scan.", depth, expr->Name()));
+            return false;
+        }
+    }
+
+    // "[cast] x IN (value_expr, ...)" with a secondary index on x becomes "x = value_1 OR x = value_2 OR ...",
+    // i.e. one point lookup in the index for each value, and the row bitmaps of the lookups are OR-ed.
+    // NULL values of the list never match, so they don't need a lookup.
+    inline SharedPtr<BaseExpression> RewriteInForIndexScan(const SharedPtr<InExpression> &in_expression) {
+        if (in_expression->in_type() != InType::kIn) {
+            LOG_TRACE(fmt::format("Unsupported expression type: In RewriteInForIndexScan(), the expression {} is a \"not in\" expression.",
+                                  in_expression->Name()));
+            return nullptr;
+        }
+        const auto &values = in_expression->arguments();
+        if (values.empty()) {
+            return nullptr;
+        }
+        auto is_column_index = [this](const SharedPtr<BaseExpression> &expr, u32 depth) -> bool { return IsColumnWithIndex(expr, depth); };
+        if (!IsValidColumnExpression(in_expression->left_operand(), 1, is_column_index)) {
+            return nullptr;
+        }
+        for (const auto &value : values) {
+            if (!IsValueResultExpression(value, 1)) {
+                return nullptr;
+            }
+        }
+        Catalog *catalog = query_context_->storage()->catalog();
+        auto equals_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(Catalog::GetFunctionSetByName(catalog, "="));
+        auto or_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(Catalog::GetFunctionSetByName(catalog, "OR"));
+        Vector<SharedPtr<BaseExpression>> exprs;
+        exprs.reserve(values.size());
+        for (const auto &value : values) {
+            Vector<SharedPtr<BaseExpression>> arguments{in_expression->left_operand(), value};
+            ScalarFunction equals_func = equals_function_set_ptr->GetMostMatchFunction(arguments);
+            exprs.emplace_back(MakeShared<FunctionExpression>(std::move(equals_func), std::move(arguments)));
+        }
+        // balanced "or" tree, long lists would otherwise make the recursion in the later steps too deep
+        while (exprs.size() > 1) {
+            Vector<SharedPtr<BaseExpression>> next_exprs;
+            next_exprs.reserve((exprs.size() + 1) / 2);
+            for (SizeT i = 0; i + 1 < exprs.size(); i += 2) {
+                Vector<SharedPtr<BaseExpression>> arguments{std::move(exprs[i]), std::move(exprs[i + 1])};
+                ScalarFunction or_func = or_function_set_ptr->GetMostMatchFunction(arguments);
+                next_exprs.emplace_back(MakeShared<FunctionExpression>(std::move(or_func), std::move(arguments)));
+            }
+            if (exprs.size() % 2 == 1) {
+                next_exprs.emplace_back(std::move(exprs.back()));
+            }
+            exprs = std::move(next_exprs);
+        }
+        return std::move(exprs[0]);
+    }
+
     // case 1. expression needs to be in the form of "[cast] x compare value_expression" and the column x should have a secondary index.
     inline SharedPtr<BaseExpression> CheckExprIndexStateAndRewrite(const SharedPtr<BaseExpression> &expression, u32 sub_expr_depth) {
         // TODO: now do not support "!=" in index scan
@@ -367,27 +439,7 @@ private:
                         UnrecoverableError(error_message);
                         return nullptr;
                     }
-                    auto is_column_index = [&m = candidate_column_index_map_](const SharedPtr<BaseExpression> &expr, u32 depth) -> bool {
-                        if (!(expr->Type().CanBuildSecondaryIndex())) {
-                            // Unsupported type
-                            LOG_TRACE(fmt::format("Expression depth: {}. In is_column_index(), unsupported column value type {}. Expression: {}.",
-                                                  depth,
-                                                  expr->Type().ToString(),
-                                                  expr->Name()));
-                            return false;
-                        }
-                        auto column_expression = std::static_pointer_cast<ColumnExpression>(expr);
-                        auto column_id = column_expression->binding().column_idx;
-                        if (m.contains(column_id)) {
-                            LOG_TRACE(fmt::format("Expression depth: {}. Column {} has index.", depth, expr->Name()));
-                            return true;
-                        } else {
-                            LOG_TRACE(fmt::format("Expression depth: {}. Column {} does not have a secondary index. Cannot apply index scan.",
-                                                  depth,
-                                                  expr->Name()));
-                            return false;
-                        }
-                    };
+                    auto is_column_index = [this](const SharedPtr<BaseExpression> &expr, u32 depth) -> bool { return IsColumnWithIndex(expr, depth); };
                     if (HaveLeftColumnAndRightValue(function_expression, sub_expr_depth + 1, is_column_index)) {
                         return expression;
                     } else if (HaveRightColumnAndLeftValue(function_expression, sub_expr_depth + 1, is_column_index)) {
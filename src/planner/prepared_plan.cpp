@@ -0,0 +1,541 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module prepared_plan;
+
+import stl;
+import parser_result;
+import base_statement;
+import logical_node;
+import logical_node_type;
+import logical_table_scan;
+import logical_index_scan;
+import logical_fusion;
+import logical_match_scan_base;
+import bind_context;
+import base_table_ref;
+import table_entry;
+import table_index_entry;
+import common_query_filter;
+import query_context;
+import txn;
+import status;
+import third_party;
+import logger;
+import base_expression;
+import expression_type;
+import value_expression;
+import value;
+import parsed_expr;
+import expression_binder;
+import logical_filter;
+import logical_project;
+import logical_sort;
+import logical_limit;
+import logical_top;
+import filter_expression_push_down;
+import secondary_index_scan_execute_expression;
+import column_expression;
+import reference_expression;
+import function_expression;
+import cast_expression;
+
+namespace infinity {
+
+PreparedPlan::PreparedPlan(String name, UniquePtr<ParserResult> parsed_result, const BaseStatement *statement, SizeT parameter_count)
+    : name_(std::move(name)), parsed_result_(std::move(parsed_result)), statement_(statement), parameter_count_(parameter_count) {}
+
+namespace {
+
+bool ContainsSlot(const BaseExpression *expression, const HashSet<const BaseExpression *> &slots) {
+    if (expression == nullptr) {
+        return false;
+    }
+    if (slots.contains(expression)) {
+        return true;
+    }
+    for (const auto &argument : expression->arguments()) {
+        if (ContainsSlot(argument.get(), slots)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CollectExpressionSlots(const BaseExpression *expression, const HashSet<const BaseExpression *> &slots, HashSet<const BaseExpression *> &reached) {
+    if (expression == nullptr) {
+        return;
+    }
+    if (slots.contains(expression)) {
+        reached.insert(expression);
+    }
+    for (const auto &argument : expression->arguments()) {
+        CollectExpressionSlots(argument.get(), slots, reached);
+    }
+}
+
+// Slots read by expressions which are evaluated at execution, or from which the derived parts are built again on reuse.
+// Slots elsewhere may have been consumed at bind time, e.g. the percentile of an aggregate.
+void CollectReachedSlots(const LogicalNode *logical_node, const HashSet<const BaseExpression *> &slots, HashSet<const BaseExpression *> &reached) {
+    if (logical_node == nullptr) {
+        return;
+    }
+    auto collect = [&](const SharedPtr<BaseExpression> &expression) { CollectExpressionSlots(expression.get(), slots, reached); };
+    switch (logical_node->operator_type()) {
+        case LogicalNodeType::kFilter: {
+            collect(static_cast<const LogicalFilter *>(logical_node)->expression());
+            break;
+        }
+        case LogicalNodeType::kProjection: {
+            for (const auto &expression : static_cast<const LogicalProject *>(logical_node)->expressions_) {
+                collect(expression);
+            }
+            break;
+        }
+        case LogicalNodeType::kSort: {
+            for (const auto &expression : static_cast<const LogicalSort *>(logical_node)->expressions_) {
+                collect(expression);
+            }
+            break;
+        }
+        case LogicalNodeType::kLimit: {
+            const auto *logical_limit = static_cast<const LogicalLimit *>(logical_node);
+            collect(logical_limit->limit_expression_);
+            collect(logical_limit->offset_expression_);
+            break;
+        }
+        case LogicalNodeType::kTop: {
+            const auto *logical_top = static_cast<const LogicalTop *>(logical_node);
+            collect(logical_top->limit_expression_);
+            collect(logical_top->offset_expression_);
+            for (const auto &expression : logical_top->sort_expressions_) {
+                collect(expression);
+            }
+            break;
+        }
+        case LogicalNodeType::kIndexScan: {
+            collect(static_cast<const LogicalIndexScan *>(logical_node)->index_filter_qualified_);
+            break;
+        }
+        case LogicalNodeType::kKnnScan:
+        case LogicalNodeType::kMatchTensorScan:
+        case LogicalNodeType::kMatchSparseScan: {
+            const auto &common_query_filter = static_cast<const LogicalMatchScanBase *>(logical_node)->common_query_filter_;
+            if (common_query_filter.get() != nullptr) {
+                collect(common_query_filter->original_filter_);
+            }
+            break;
+        }
+        case LogicalNodeType::kFusion: {
+            for (const auto &child : static_cast<const LogicalFusion *>(logical_node)->other_children_) {
+                CollectReachedSlots(child.get(), slots, reached);
+            }
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    CollectReachedSlots(logical_node->left_node().get(), slots, reached);
+    CollectReachedSlots(logical_node->right_node().get(), slots, reached);
+}
+
+// Copy of `expression`, a filter remapped to references to the output of the table scan below it, with the references turned
+// back into the table columns the fast rough filter is built on. Nodes other than functions and casts are shared, so the copy
+// sees the values substituted into the parameter slots.
+SharedPtr<BaseExpression> UnmapColumnReferences(const SharedPtr<BaseExpression> &expression, const BaseTableRef &table_ref) {
+    switch (expression->type()) {
+        case ExpressionType::kReference: {
+            const auto &reference = static_cast<const ReferenceExpression &>(*expression);
+            const SizeT column_idx = reference.column_index();
+            if (column_idx >= table_ref.column_ids_.size()) {
+                return expression;
+            }
+            return ColumnExpression::Make(reference.Type(),
+                                          *table_ref.table_name(),
+                                          table_ref.table_index_,
+                                          table_ref.column_names_->at(column_idx),
+                                          table_ref.column_ids_[column_idx],
+                                          0);
+        }
+        case ExpressionType::kFunction: {
+            const auto &function = static_cast<const FunctionExpression &>(*expression);
+            Vector<SharedPtr<BaseExpression>> arguments;
+            arguments.reserve(function.arguments().size());
+            for (const auto &argument : function.arguments()) {
+                arguments.push_back(UnmapColumnReferences(argument, table_ref));
+            }
+            return MakeShared<FunctionExpression>(function.func_, std::move(arguments));
+        }
+        case ExpressionType::kCast: {
+            const auto &cast = static_cast<const CastExpression &>(*expression);
+            return MakeShared<CastExpression>(cast.func_, UnmapColumnReferences(cast.arguments()[0], table_ref), cast.Type());
+        }
+        default: {
+            return expression;
+        }
+    }
+}
+
+// Value of a constant argument of EXECUTE, None otherwise
+Optional<Value> BindParameterValue(QueryContext *query_context, const ParsedExpr &parameter) {
+    if (parameter.type_ != ParsedExprType::kConstant) {
+        return None;
+    }
+    ExpressionBinder expression_binder(query_context);
+    SharedPtr<BaseExpression> expression = expression_binder.BuildExpression(parameter, nullptr, 0, true);
+    if (expression->type() != ExpressionType::kValue) {
+        return None;
+    }
+    return static_cast<const ValueExpression &>(*expression).GetValue();
+}
+
+} // namespace
+
+bool PreparedPlan::TryReuse(QueryContext *query_context,
+                            const Vector<ParsedExpr *> *parameters,
+                            const Vector<String> &parameter_keys,
+                            Vector<SharedPtr<LogicalNode>> &logical_plans,
+                            u64 &max_node_id) {
+    if (!cached_) {
+        ++miss_count_;
+        return false;
+    }
+
+    // Arguments which differ from the cached ones must be substituted into the slots, with the type the plan was bound to.
+    Vector<Pair<SizeT, Value>> substitutions;
+    for (SizeT i = 0; i < parameter_keys.size(); ++i) {
+        if (parameter_keys[i] == parameter_keys_[i]) {
+            continue;
+        }
+        if (parameter_slots_[i].empty()) {
+            ++miss_count_;
+            return false;
+        }
+        Optional<Value> value = BindParameterValue(query_context, *(*parameters)[i]);
+        if (!value.has_value() || value->type() != parameter_slots_[i].front()->Type()) {
+            ++miss_count_;
+            return false;
+        }
+        substitutions.emplace_back(i, std::move(*value));
+    }
+
+    Txn *txn = query_context->GetTxn();
+    for (auto &table_snapshot : table_snapshots_) {
+        TableEntry *table_entry = table_snapshot.base_table_ref_->table_entry_ptr_;
+        auto [current_table_entry, status] = txn->GetTableByName(*table_entry->GetDBName(), *table_entry->GetTableName());
+        if (!status.ok() || current_table_entry != table_entry) {
+            LOG_DEBUG(fmt::format("Prepared statement {}: table {} changed, invalidate cached plan.", name_, *table_entry->GetTableName()));
+            Invalidate();
+            ++miss_count_;
+            return false;
+        }
+        Vector<TableIndexEntry *> table_index_entries = table_entry->TableIndexes(txn->TxnID(), txn->BeginTS());
+        std::sort(table_index_entries.begin(), table_index_entries.end());
+        if (table_index_entries != table_snapshot.table_index_entries_) {
+            LOG_DEBUG(fmt::format("Prepared statement {}: indexes of table {} changed, invalidate cached plan.", name_, *table_entry->GetTableName()));
+            Invalidate();
+            ++miss_count_;
+            return false;
+        }
+    }
+
+    for (auto &[parameter_idx, value] : substitutions) {
+        for (auto &slot : parameter_slots_[parameter_idx]) {
+            slot->SetValue(value);
+        }
+        parameter_keys_[parameter_idx] = parameter_keys[parameter_idx];
+    }
+    if (!substitutions.empty()) {
+        RefreshSlotScans(slot_index_scans_, slot_table_scans_);
+    }
+
+    // Rebind the visible data of the tables to the new txn.
+    for (auto &table_snapshot : table_snapshots_) {
+        auto &base_table_ref = table_snapshot.base_table_ref_;
+        base_table_ref->block_index_ = base_table_ref->table_entry_ptr_->GetBlockIndex(txn);
+        base_table_ref->index_index_ = nullptr;
+    }
+    HashMap<CommonQueryFilter *, SharedPtr<CommonQueryFilter>> refreshed_filters;
+    for (auto &logical_plan : logical_plans_) {
+        RefreshQueryFilters(logical_plan.get(), query_context, refreshed_filters);
+    }
+
+    logical_plans = logical_plans_;
+    max_node_id = max_node_id_;
+    ++hit_count_;
+    return true;
+}
+
+void PreparedPlan::Cache(QueryContext *query_context,
+                         Vector<String> parameter_keys,
+                         Vector<Pair<SizeT, SharedPtr<ValueExpression>>> parameter_slots,
+                         SharedPtr<BindContext> bind_context,
+                         const Vector<SharedPtr<LogicalNode>> &logical_plans,
+                         u64 max_node_id) {
+    Invalidate();
+    for (const auto &logical_plan : logical_plans) {
+        if (!IsCacheable(logical_plan.get())) {
+            return;
+        }
+    }
+
+    Vector<SharedPtr<BaseTableRef>> table_refs;
+    for (const auto &logical_plan : logical_plans) {
+        CollectTableRefs(logical_plan.get(), table_refs);
+    }
+    Txn *txn = query_context->GetTxn();
+    for (auto &table_ref : table_refs) {
+        PreparedTableSnapshot table_snapshot;
+        table_snapshot.table_index_entries_ = table_ref->table_entry_ptr_->TableIndexes(txn->TxnID(), txn->BeginTS());
+        std::sort(table_snapshot.table_index_entries_.begin(), table_snapshot.table_index_entries_.end());
+        table_snapshot.base_table_ref_ = std::move(table_ref);
+        table_snapshots_.emplace_back(std::move(table_snapshot));
+    }
+
+    parameter_keys_ = std::move(parameter_keys);
+    bind_context_ = std::move(bind_context);
+    logical_plans_ = logical_plans;
+    max_node_id_ = max_node_id;
+    CollectParameterSlots(std::move(parameter_slots));
+    cached_ = true;
+}
+
+void PreparedPlan::CollectParameterSlots(Vector<Pair<SizeT, SharedPtr<ValueExpression>>> parameter_slots) {
+    HashSet<const BaseExpression *> slots;
+    for (const auto &[parameter_idx, slot] : parameter_slots) {
+        if (slot.get() != nullptr) {
+            slots.insert(slot.get());
+        }
+    }
+    HashSet<const BaseExpression *> reached;
+    for (const auto &logical_plan : logical_plans_) {
+        CollectReachedSlots(logical_plan.get(), slots, reached);
+    }
+
+    parameter_slots_.assign(parameter_count_, Vector<SharedPtr<ValueExpression>>{});
+    Vector<bool> substitutable(parameter_count_, true);
+    for (auto &[parameter_idx, slot] : parameter_slots) {
+        if (parameter_idx >= parameter_count_) {
+            continue;
+        }
+        if (slot.get() == nullptr || !reached.contains(slot.get())) {
+            substitutable[parameter_idx] = false;
+            continue;
+        }
+        parameter_slots_[parameter_idx].push_back(std::move(slot));
+    }
+    for (SizeT i = 0; i < parameter_count_; ++i) {
+        if (!substitutable[i]) {
+            parameter_slots_[i].clear();
+        }
+    }
+
+    for (auto &logical_plan : logical_plans_) {
+        CollectSlotScans(logical_plan.get(), slots, slot_index_scans_, slot_table_scans_);
+    }
+}
+
+void PreparedPlan::CollectSlotScans(LogicalNode *logical_node,
+                                    const HashSet<const BaseExpression *> &slots,
+                                    Vector<LogicalIndexScan *> &index_scans,
+                                    Vector<Pair<LogicalTableScan *, SharedPtr<BaseExpression>>> &table_scans) {
+    if (logical_node == nullptr || slots.empty()) {
+        return;
+    }
+    switch (logical_node->operator_type()) {
+        case LogicalNodeType::kFilter: {
+            // The fast rough filter of the scan below is built from this filter
+            const auto &filter_expression = static_cast<LogicalFilter *>(logical_node)->expression();
+            if (!ContainsSlot(filter_expression.get(), slots)) {
+                break;
+            }
+            LogicalNode *scan = logical_node->left_node().get();
+            if (scan->operator_type() == LogicalNodeType::kTableScan) {
+                auto *table_scan = static_cast<LogicalTableScan *>(scan);
+                table_scans.emplace_back(table_scan, UnmapColumnReferences(filter_expression, *table_scan->base_table_ref_));
+            } else if (scan->operator_type() == LogicalNodeType::kIndexScan) {
+                auto *index_scan = static_cast<LogicalIndexScan *>(scan);
+                if (std::find(index_scans.begin(), index_scans.end(), index_scan) == index_scans.end()) {
+                    index_scans.push_back(index_scan);
+                }
+            }
+            break;
+        }
+        case LogicalNodeType::kIndexScan: {
+            auto *index_scan = static_cast<LogicalIndexScan *>(logical_node);
+            if (ContainsSlot(index_scan->index_filter_qualified_.get(), slots) &&
+                std::find(index_scans.begin(), index_scans.end(), index_scan) == index_scans.end()) {
+                index_scans.push_back(index_scan);
+            }
+            break;
+        }
+        case LogicalNodeType::kFusion: {
+            for (auto &child : static_cast<LogicalFusion *>(logical_node)->other_children_) {
+                CollectSlotScans(child.get(), slots, index_scans, table_scans);
+            }
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    CollectSlotScans(logical_node->left_node().get(), slots, index_scans, table_scans);
+    CollectSlotScans(logical_node->right_node().get(), slots, index_scans, table_scans);
+}
+
+void PreparedPlan::RefreshSlotScans(const Vector<LogicalIndexScan *> &index_scans,
+                                    Vector<Pair<LogicalTableScan *, SharedPtr<BaseExpression>>> &table_scans) {
+    for (auto *index_scan : index_scans) {
+        // The qualified filter isn't remapped, the commands and the fast rough filter are built from it again.
+        index_scan->filter_execute_command_ = BuildSecondaryIndexScanCommand(index_scan->index_filter_qualified_);
+        index_scan->fast_rough_filter_evaluator_ = FilterExpressionPushDown::PushDownToFastRoughFilter(index_scan->index_filter_qualified_);
+    }
+    for (auto &[table_scan, filter_expression] : table_scans) {
+        table_scan->fast_rough_filter_evaluator_ = FilterExpressionPushDown::PushDownToFastRoughFilter(filter_expression);
+    }
+}
+
+void PreparedPlan::Invalidate() {
+    cached_ = false;
+    parameter_keys_.clear();
+    parameter_slots_.clear();
+    slot_index_scans_.clear();
+    slot_table_scans_.clear();
+    bind_context_.reset();
+    logical_plans_.clear();
+    table_snapshots_.clear();
+}
+
+bool PreparedPlan::IsCacheable(const LogicalNode *logical_node) {
+    if (logical_node == nullptr) {
+        return true;
+    }
+    switch (logical_node->operator_type()) {
+        case LogicalNodeType::kAggregate:
+        case LogicalNodeType::kLimit:
+        case LogicalNodeType::kFilter:
+        case LogicalNodeType::kProjection:
+        case LogicalNodeType::kSort:
+        case LogicalNodeType::kTop:
+        case LogicalNodeType::kTableScan:
+        case LogicalNodeType::kIndexScan:
+        case LogicalNodeType::kDummyScan:
+        case LogicalNodeType::kKnnScan:
+        case LogicalNodeType::kMatchTensorScan:
+        case LogicalNodeType::kMatchSparseScan: {
+            break;
+        }
+        case LogicalNodeType::kFusion: {
+            const auto *logical_fusion = static_cast<const LogicalFusion *>(logical_node);
+            for (const auto &child : logical_fusion->other_children_) {
+                if (!IsCacheable(child.get())) {
+                    return false;
+                }
+            }
+            break;
+        }
+        default: {
+            // e.g. full text match holds an index reader and a query tree bound to the txn.
+            return false;
+        }
+    }
+    return IsCacheable(logical_node->left_node().get()) && IsCacheable(logical_node->right_node().get());
+}
+
+void PreparedPlan::CollectTableRefs(const LogicalNode *logical_node, Vector<SharedPtr<BaseTableRef>> &table_refs) {
+    if (logical_node == nullptr) {
+        return;
+    }
+    auto add_table_ref = [&](const SharedPtr<BaseTableRef> &table_ref) {
+        if (table_ref.get() != nullptr && std::find(table_refs.begin(), table_refs.end(), table_ref) == table_refs.end()) {
+            table_refs.push_back(table_ref);
+        }
+    };
+    switch (logical_node->operator_type()) {
+        case LogicalNodeType::kTableScan: {
+            add_table_ref(static_cast<const LogicalTableScan *>(logical_node)->base_table_ref_);
+            break;
+        }
+        case LogicalNodeType::kIndexScan: {
+            add_table_ref(static_cast<const LogicalIndexScan *>(logical_node)->base_table_ref_);
+            break;
+        }
+        case LogicalNodeType::kKnnScan:
+        case LogicalNodeType::kMatchTensorScan:
+        case LogicalNodeType::kMatchSparseScan: {
+            add_table_ref(static_cast<const LogicalMatchScanBase *>(logical_node)->base_table_ref_);
+            break;
+        }
+        case LogicalNodeType::kFusion: {
+            const auto *logical_fusion = static_cast<const LogicalFusion *>(logical_node);
+            add_table_ref(logical_fusion->base_table_ref_);
+            for (const auto &child : logical_fusion->other_children_) {
+                CollectTableRefs(child.get(), table_refs);
+            }
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    CollectTableRefs(logical_node->left_node().get(), table_refs);
+    CollectTableRefs(logical_node->right_node().get(), table_refs);
+}
+
+void PreparedPlan::RefreshQueryFilters(LogicalNode *logical_node,
+                                       QueryContext *query_context,
+                                       HashMap<CommonQueryFilter *, SharedPtr<CommonQueryFilter>> &refreshed_filters) {
+    if (logical_node == nullptr) {
+        return;
+    }
+    switch (logical_node->operator_type()) {
+        case LogicalNodeType::kKnnScan:
+        case LogicalNodeType::kMatchTensorScan:
+        case LogicalNodeType::kMatchSparseScan: {
+            auto &common_query_filter = static_cast<LogicalMatchScanBase *>(logical_node)->common_query_filter_;
+            if (common_query_filter.get() == nullptr) {
+                break;
+            }
+            // Several search nodes may share one common query filter, keep them shared after refresh.
+            if (auto iter = refreshed_filters.find(common_query_filter.get()); iter != refreshed_filters.end()) {
+                common_query_filter = iter->second;
+                break;
+            }
+            auto new_filter = MakeShared<CommonQueryFilter>(common_query_filter->original_filter_,
+                                                            common_query_filter->base_table_ref_,
+                                                            query_context->GetTxn()->BeginTS());
+            new_filter->TryApplyFastRoughFilterOptimizer();
+            new_filter->TryApplySecondaryIndexFilterOptimizer(query_context);
+            refreshed_filters.emplace(common_query_filter.get(), new_filter);
+            common_query_filter = std::move(new_filter);
+            break;
+        }
+        case LogicalNodeType::kFusion: {
+            for (auto &child : static_cast<LogicalFusion *>(logical_node)->other_children_) {
+                RefreshQueryFilters(child.get(), query_context, refreshed_filters);
+            }
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    RefreshQueryFilters(logical_node->left_node().get(), query_context, refreshed_filters);
+    RefreshQueryFilters(logical_node->right_node().get(), query_context, refreshed_filters);
+}
+
+} // namespace infinity
@@ -0,0 +1,128 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module prepared_plan;
+
+import stl;
+import parser_result;
+import base_statement;
+import logical_node;
+import bind_context;
+import base_table_ref;
+import table_index_entry;
+import common_query_filter;
+import base_expression;
+import value_expression;
+import parsed_expr;
+import logical_table_scan;
+import logical_index_scan;
+
+namespace infinity {
+
+class QueryContext;
+
+// Tables the cached plan was bound to, and the indexes visible when it was optimized.
+export struct PreparedTableSnapshot {
+    SharedPtr<BaseTableRef> base_table_ref_{};
+    Vector<TableIndexEntry *> table_index_entries_{};
+};
+
+// A statement registered by PREPARE in a session.
+// The parsed statement is kept for the lifetime of the prepared statement, so EXECUTE never goes through the parser.
+// The optimized logical plan is cached as well and reused by later EXECUTE as long as:
+// 1. the plan only consists of operators which can be planned again, see IsCacheable()
+// 2. the bound tables haven't been dropped / recreated and their indexes are unchanged
+//
+// Placeholders are kept in the cached plan as parameter slots, the values bound to '?'. EXECUTE with other arguments of the
+// same types substitutes them into the slots in place. Parts which optimizer rules derive from constants are derived again:
+// the index scan commands, and the fast rough filters of table scans, index scans and search nodes. Since the filter above a
+// table scan has been remapped to references to the scan output, a copy of it on the table columns is kept to build the fast
+// rough filter of the scan from. An argument which isn't a constant, or whose '?' isn't bound to a plain value (e.g. percentile
+// argument of an aggregate), is only reused with the same argument.
+export class PreparedPlan {
+public:
+    PreparedPlan(String name, UniquePtr<ParserResult> parsed_result, const BaseStatement *statement, SizeT parameter_count);
+
+    [[nodiscard]] inline const String &name() const { return name_; }
+
+    [[nodiscard]] inline const BaseStatement *statement() const { return statement_; }
+
+    [[nodiscard]] inline SizeT parameter_count() const { return parameter_count_; }
+
+    [[nodiscard]] inline u64 hit_count() const { return hit_count_; }
+
+    [[nodiscard]] inline u64 miss_count() const { return miss_count_; }
+
+    // Try to reuse the cached plan within the txn of query_context. Block index, index snapshot and common query filters are refreshed
+    // for the new txn. Returns false if there is no valid cached plan.
+    bool TryReuse(QueryContext *query_context,
+                  const Vector<ParsedExpr *> *parameters,
+                  const Vector<String> &parameter_keys,
+                  Vector<SharedPtr<LogicalNode>> &logical_plans,
+                  u64 &max_node_id);
+
+    // Cache the optimized logical plans if they are reusable. parameter_slots are the values each '?' was bound to.
+    void Cache(QueryContext *query_context,
+               Vector<String> parameter_keys,
+               Vector<Pair<SizeT, SharedPtr<ValueExpression>>> parameter_slots,
+               SharedPtr<BindContext> bind_context,
+               const Vector<SharedPtr<LogicalNode>> &logical_plans,
+               u64 max_node_id);
+
+    void Invalidate();
+
+    static bool IsCacheable(const LogicalNode *logical_node);
+
+private:
+    static void CollectTableRefs(const LogicalNode *logical_node, Vector<SharedPtr<BaseTableRef>> &table_refs);
+
+    void CollectParameterSlots(Vector<Pair<SizeT, SharedPtr<ValueExpression>>> parameter_slots);
+
+    static void CollectSlotScans(LogicalNode *logical_node,
+                                 const HashSet<const BaseExpression *> &slots,
+                                 Vector<LogicalIndexScan *> &index_scans,
+                                 Vector<Pair<LogicalTableScan *, SharedPtr<BaseExpression>>> &table_scans);
+
+    static void RefreshSlotScans(const Vector<LogicalIndexScan *> &index_scans,
+                                 Vector<Pair<LogicalTableScan *, SharedPtr<BaseExpression>>> &table_scans);
+
+    static void RefreshQueryFilters(LogicalNode *logical_node,
+                                    QueryContext *query_context,
+                                    HashMap<CommonQueryFilter *, SharedPtr<CommonQueryFilter>> &refreshed_filters);
+
+    String name_{};
+    UniquePtr<ParserResult> parsed_result_{};
+    const BaseStatement *statement_{};
+    SizeT parameter_count_{};
+
+    // cached plan
+    bool cached_{false};
+    Vector<String> parameter_keys_{};
+    // Slots of every parameter, empty if the parameter can't be substituted
+    Vector<Vector<SharedPtr<ValueExpression>>> parameter_slots_{};
+    // Scans whose filter depends on a parameter slot, table scans with the filter above them on the table columns
+    Vector<LogicalIndexScan *> slot_index_scans_{};
+    Vector<Pair<LogicalTableScan *, SharedPtr<BaseExpression>>> slot_table_scans_{};
+    SharedPtr<BindContext> bind_context_{};
+    Vector<SharedPtr<LogicalNode>> logical_plans_{};
+    u64 max_node_id_{};
+    Vector<PreparedTableSnapshot> table_snapshots_{};
+
+    u64 hit_count_{};
+    u64 miss_count_{};
+};
+
+} // namespace infinity
@@ -61,6 +61,8 @@ import data_block;
 import physical_merge_knn;
 import merge_knn_data;
 import create_index_data;
+import index_build_tracer;
+import infinity_context;
 import compact_state_data;
 import logger;
 import task_scheduler;
@@ -71,6 +73,9 @@ import column_def;
 import explain_statement;
 import table_entry;
 import segment_entry;
+import txn;
+import table_index_entry;
+import segment_index_entry;
 
 namespace infinity {
 
@@ -686,6 +691,7 @@ SizeT InitKnnScanFragmentContext(PhysicalKnnScan *knn_scan_operator, FragmentCon
                 MakeUnique<KnnScanSharedData>(knn_scan_operator->base_table_ref_,
                                               std::move(knn_scan_operator->block_column_entries_),
                                               std::move(knn_scan_operator->index_entries_),
+                                              std::move(knn_scan_operator->index_chunk_slots_),
                                               std::move(knn_expr->opt_params_),
                                               knn_expr->topn_,
                                               knn_expr->dimension_,
@@ -701,6 +707,7 @@ SizeT InitKnnScanFragmentContext(PhysicalKnnScan *knn_scan_operator, FragmentCon
                 MakeUnique<KnnScanSharedData>(knn_scan_operator->base_table_ref_,
                                               std::move(knn_scan_operator->block_column_entries_),
                                               std::move(knn_scan_operator->index_entries_),
+                                              std::move(knn_scan_operator->index_chunk_slots_),
                                               std::move(knn_expr->opt_params_),
                                               knn_expr->topn_,
                                               knn_expr->dimension_,
@@ -721,11 +728,34 @@ SizeT InitKnnScanFragmentContext(PhysicalKnnScan *knn_scan_operator, FragmentCon
 
 SizeT InitCreateIndexDoFragmentContext(const PhysicalCreateIndexDo *create_index_do_operator, FragmentContext *fragment_ctx) {
     auto *table_ref = create_index_do_operator->base_table_ref_.get();
-    // FIXME: to create index on unsealed_segment
     SizeT segment_cnt = table_ref->block_index_->SegmentCount();
+    QueryContext *query_context = fragment_ctx->query_context();
+    Txn *txn = query_context->GetTxn();
+
+    // Resuming a cancelled build with OPTIMIZE ... WITH (resume_build), only the segments without index are built
+    Map<SegmentID, SharedPtr<SegmentIndexEntry>> built_segments;
+    if (auto [table_index_entry, status] = txn->GetIndexByName(*table_ref->schema_name(), *table_ref->table_name(), *create_index_do_operator->index_name_);
+        status.ok()) {
+        built_segments = table_index_entry->GetIndexBySegmentSnapshot(table_ref->table_entry_ptr_, txn);
+    }
+    SizeT build_segment_cnt = 0;
+    SizeT row_cnt = 0;
+    for (const auto &[segment_id, segment_info] : table_ref->block_index_->segment_block_index_) {
+        if (!built_segments.contains(segment_id)) {
+            ++build_segment_cnt;
+            row_cnt += segment_info.segment_offset_;
+        }
+    }
 
     auto *parallel_materialize_fragment_ctx = static_cast<ParallelMaterializedFragmentCtx *>(fragment_ctx);
-    parallel_materialize_fragment_ctx->create_index_shared_data_ = MakeUnique<CreateIndexSharedData>(table_ref->block_index_.get());
+    auto create_index_shared_data = MakeUnique<CreateIndexSharedData>(table_ref->block_index_.get());
+    create_index_shared_data->build_job_ = query_context->storage()->index_build_tracer()->AddJob(txn->TxnID(),
+                                                                                                  *table_ref->schema_name(),
+                                                                                                  *table_ref->table_name(),
+                                                                                                  *create_index_do_operator->index_name_,
+                                                                                                  row_cnt,
+                                                                                                  build_segment_cnt);
+    parallel_materialize_fragment_ctx->create_index_shared_data_ = std::move(create_index_shared_data);
     return segment_cnt;
 }
 
@@ -1333,7 +1363,10 @@ void FragmentContext::CreateTasks(i64 cpu_count, i64 operator_count, FragmentCon
         }
         case PhysicalOperatorType::kCreateIndexDo: {
             const auto *create_index_do_operator = static_cast<const PhysicalCreateIndexDo *>(first_operator);
-            InitCreateIndexDoFragmentContext(create_index_do_operator, this);
+            SizeT segment_cnt = InitCreateIndexDoFragmentContext(create_index_do_operator, this);
+            // Each task builds whole segments, at most `index_build_cpu_share` of the cpus are used
+            i64 build_thread_num = (i64)InfinityContext::instance().IndexBuildThreadNum();
+            parallel_count = std::min({parallel_count, build_thread_num, (i64)segment_cnt});
             parallel_count = std::max(parallel_count, (i64)1l);
             break;
         }
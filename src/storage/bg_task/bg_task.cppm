@@ -37,6 +37,8 @@ export enum class BGTaskType {
     kUpdateSegmentBloomFilterData, // Not used
     kDumpIndex,
     kDumpIndexByline,
+    kScrubTable,
+    kBuildCentroidCodes,
     kInvalid
 };
 
@@ -204,4 +206,43 @@ public:
     SharedPtr<ChunkIndexEntry> dumped_chunk_;
 };
 
+// Check the checksums of the data and index files of a table. The compaction processor runs it on its own scrub thread,
+// so that compaction and index dumps are not held back by the IO rate limit.
+export class ScrubTableTask final : public BGTask {
+public:
+    ScrubTableTask(String db_name, String table_name, Vector<String> file_paths)
+        : BGTask(BGTaskType::kScrubTable, true), db_name_(std::move(db_name)), table_name_(std::move(table_name)),
+          file_paths_(std::move(file_paths)) {}
+
+    ~ScrubTableTask() override = default;
+
+    String ToString() const override { return "ScrubTableTask"; }
+
+public:
+    String db_name_;
+    String table_name_;
+    Vector<String> file_paths_;
+
+    SizeT checked_file_count_{0};
+    SizeT corrupted_file_count_{0};
+    SizeT checked_bytes_{0};
+};
+
+// Builds the centroid codes of the tensor columns of a sealed segment, scheduled by its first pruned tensor search
+export class BuildCentroidCodesTask final : public BGTask {
+public:
+    BuildCentroidCodesTask(String db_name, String table_name, SegmentID segment_id)
+        : BGTask(BGTaskType::kBuildCentroidCodes, true), db_name_(std::move(db_name)), table_name_(std::move(table_name)),
+          segment_id_(segment_id) {}
+
+    ~BuildCentroidCodesTask() override = default;
+
+    String ToString() const override { return fmt::format("BuildCentroidCodesTask: {}.{} segment {}", db_name_, table_name_, segment_id_); }
+
+public:
+    String db_name_;
+    String table_name_;
+    SegmentID segment_id_;
+};
+
 } // namespace infinity
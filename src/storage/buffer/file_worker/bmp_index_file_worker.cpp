@@ -83,6 +83,7 @@ void BMPIndexFileWorker::FreeInMemory() {
         *p);
     delete p;
     data_ = nullptr;
+    FreeMmap();
 }
 
 bool BMPIndexFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success, const FileWorkerSaveCtx &ctx) {
@@ -123,4 +124,27 @@ void BMPIndexFileWorker::ReadFromFileImpl(SizeT file_size) {
         *bmp_index);
 }
 
+void BMPIndexFileWorker::ReadFromMmapImpl(const char *ptr, SizeT size) {
+    if (data_ != nullptr) {
+        UnrecoverableError("Data is already allocated.");
+    }
+    data_ = static_cast<void *>(new AbstractBMP(BMPIndexInMem::InitAbstractIndex(index_base_.get(), column_def_.get())));
+    auto *bmp_index = reinterpret_cast<AbstractBMP *>(data_);
+    std::visit(
+        [&](auto &&index) {
+            using T = std::decay_t<decltype(index)>;
+            if constexpr (std::is_same_v<T, std::nullptr_t>) {
+                UnrecoverableError("Invalid index type.");
+            } else {
+                using IndexT = std::decay_t<decltype(*index)>;
+                const char *p = ptr;
+                index = new IndexT(IndexT::LoadFromPtr(p));
+                if (SizeT(p - ptr) != size) {
+                    UnrecoverableError("BMP index file size mismatch.");
+                }
+            }
+        },
+        *bmp_index);
+}
+
 } // namespace infinity
@@ -22,15 +22,25 @@ import local_file_system;
 import third_party;
 import status;
 import logger;
+import column_encoding;
 
 namespace infinity {
 
+namespace {
+
+constexpr u64 DATA_FILE_MAGIC = 0x00dd3344;
+constexpr u64 ENCODED_DATA_FILE_MAGIC = 0x00dd3345;
+
+} // namespace
+
 DataFileWorker::DataFileWorker(SharedPtr<String> data_dir,
                                SharedPtr<String> temp_dir,
                                SharedPtr<String> file_dir,
                                SharedPtr<String> file_name,
-                               SizeT buffer_size)
-    : FileWorker(std::move(data_dir), std::move(temp_dir), std::move(file_dir), std::move(file_name)), buffer_size_(buffer_size) {}
+                               SizeT buffer_size,
+                               SizeT element_size)
+    : FileWorker(std::move(data_dir), std::move(temp_dir), std::move(file_dir), std::move(file_name)), buffer_size_(buffer_size),
+      element_size_(element_size) {}
 
 DataFileWorker::~DataFileWorker() {
     if (data_ != nullptr) {
@@ -61,15 +71,27 @@ void DataFileWorker::FreeInMemory() {
 }
 
 // FIXME: to_spill
-bool DataFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success, const FileWorkerSaveCtx &ctx) {
+bool DataFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success, const FileWorkerSaveCtx &base_ctx) {
     LocalFileSystem fs;
     // File structure:
     // - header: magic number
     // - header: buffer size
-    // - data buffer
+    // - header: encoding type, element size, encoded size (encoded file only)
+    // - data buffer, or its encoding
     // - footer: checksum
 
-    u64 magic_number = 0x00dd3344;
+    String encoded;
+    ColumnEncodingType encoding_type = ColumnEncodingType::kRaw;
+    if (element_size_ > 0 && !to_spill) {
+        // Spilled buffers are read back soon, and a block still being appended is written again at the next checkpoint.
+        // Only the buffers of the block columns are encoded, and only once they are sealed.
+        const auto &ctx = static_cast<const DataFileWorkerSaveCtx &>(base_ctx);
+        if (ctx.sealed_) {
+            encoding_type = ColumnEncoding::Encode(static_cast<const char *>(data_), buffer_size_, element_size_, encoded);
+        }
+    }
+
+    u64 magic_number = encoding_type == ColumnEncodingType::kRaw ? DATA_FILE_MAGIC : ENCODED_DATA_FILE_MAGIC;
     u64 nbytes = fs.Write(*file_handler_, &magic_number, sizeof(magic_number));
     if (nbytes != sizeof(magic_number)) {
         Status status = Status::DataIOError(fmt::format("Write magic number which length is {}.", nbytes));
@@ -82,10 +104,25 @@ bool DataFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success, const
         RecoverableError(status);
     }
 
-    nbytes = fs.Write(*file_handler_, data_, buffer_size_);
-    if (nbytes != buffer_size_) {
-        Status status = Status::DataIOError(fmt::format("Expect to write buffer with size: {}, but {} bytes is written", buffer_size_, nbytes));
-        RecoverableError(status);
+    if (encoding_type != ColumnEncodingType::kRaw) {
+        u64 encoding_header[3] = {static_cast<u64>(encoding_type), element_size_, encoded.size()};
+        nbytes = fs.Write(*file_handler_, encoding_header, sizeof(encoding_header));
+        if (nbytes != sizeof(encoding_header)) {
+            Status status = Status::DataIOError(fmt::format("Write encoding header which length is {}.", nbytes));
+            RecoverableError(status);
+        }
+        nbytes = fs.Write(*file_handler_, encoded.data(), encoded.size());
+        if (nbytes != encoded.size()) {
+            Status status =
+                Status::DataIOError(fmt::format("Expect to write encoded buffer with size: {}, but {} bytes is written", encoded.size(), nbytes));
+            RecoverableError(status);
+        }
+    } else {
+        nbytes = fs.Write(*file_handler_, data_, buffer_size_);
+        if (nbytes != buffer_size_) {
+            Status status = Status::DataIOError(fmt::format("Expect to write buffer with size: {}, but {} bytes is written", buffer_size_, nbytes));
+            RecoverableError(status);
+        }
     }
 
     u64 checksum{};
@@ -113,7 +150,11 @@ void DataFileWorker::ReadFromFileImpl(SizeT file_size) {
         Status status = Status::DataIOError(fmt::format("Read magic number which length isn't {}.", nbytes));
         RecoverableError(status);
     }
-    if (magic_number != 0x00dd3344) {
+    if (magic_number == ENCODED_DATA_FILE_MAGIC) {
+        ReadEncodedBody(file_size);
+        return;
+    }
+    if (magic_number != DATA_FILE_MAGIC) {
         Status status = Status::DataIOError(fmt::format("Read magic number which length isn't {}.", nbytes));
         RecoverableError(status);
     }
@@ -146,4 +187,47 @@ void DataFileWorker::ReadFromFileImpl(SizeT file_size) {
     }
 }
 
-} // namespace infinity
\ No newline at end of file
+void DataFileWorker::ReadEncodedBody(SizeT file_size) {
+    LocalFileSystem fs;
+
+    // file header: buffer size, encoding type, element size, encoded size
+    u64 header[4]{};
+    u64 nbytes = fs.Read(*file_handler_, header, sizeof(header));
+    if (nbytes != sizeof(header)) {
+        Status status = Status::DataIOError(fmt::format("Read encoded file header which length isn't {}.", nbytes));
+        RecoverableError(status);
+    }
+    const u64 buffer_size = header[0];
+    const auto encoding_type = static_cast<ColumnEncodingType>(header[1]);
+    const u64 element_size = header[2];
+    const u64 encoded_size = header[3];
+    if (file_size != encoded_size + 6 * sizeof(u64)) {
+        Status status = Status::DataIOError(fmt::format("File size: {} isn't matched with {}.", file_size, encoded_size + 6 * sizeof(u64)));
+        RecoverableError(status);
+    }
+
+    // file body
+    auto encoded = MakeUniqueForOverwrite<char[]>(encoded_size);
+    nbytes = fs.Read(*file_handler_, encoded.get(), encoded_size);
+    if (nbytes != encoded_size) {
+        Status status = Status::DataIOError(fmt::format("Expect to read encoded buffer with size: {}, but {} bytes is read", encoded_size, nbytes));
+        RecoverableError(status);
+    }
+    auto *data = new char[buffer_size];
+    if (!ColumnEncoding::Decode(encoding_type, encoded.get(), encoded_size, element_size, data, buffer_size)) {
+        delete[] data;
+        Status status = Status::DataIOError(fmt::format("Corrupted {} encoded data file: {}", ToString(encoding_type), *file_name_));
+        RecoverableError(status);
+    }
+    data_ = static_cast<void *>(data);
+
+    // file footer: checksum
+    u64 checksum{0};
+    nbytes = fs.Read(*file_handler_, &checksum, sizeof(checksum));
+    if (nbytes != sizeof(checksum)) {
+        Status status = Status::DataIOError(fmt::format("Incorrect file checksum length: {}.", nbytes));
+        RecoverableError(status);
+    }
+}
+
+} // namespace infinity
@@ -22,13 +22,21 @@ import file_worker_type;
 
 namespace infinity {
 
+export struct DataFileWorkerSaveCtx : public FileWorkerSaveCtx {
+    explicit DataFileWorkerSaveCtx(bool sealed) : sealed_(sealed) {}
+
+    // The buffer won't change any more, it is encoded once now instead of at every checkpoint
+    bool sealed_{};
+};
+
 export class DataFileWorker : public FileWorker {
 public:
     explicit DataFileWorker(SharedPtr<String> data_dir,
                             SharedPtr<String> temp_dir,
                             SharedPtr<String> file_dir,
                             SharedPtr<String> file_name,
-                            SizeT buffer_size);
+                            SizeT buffer_size,
+                            SizeT element_size = 0);
 
     virtual ~DataFileWorker() override;
 
@@ -46,7 +54,12 @@ protected:
 
     void ReadFromFileImpl(SizeT file_size) override;
 
+private:
+    void ReadEncodedBody(SizeT file_size);
+
 private:
     const SizeT buffer_size_;
+    // Width of the values in the buffer, sealed files get a lightweight column encoding if it is known
+    const SizeT element_size_;
 };
 } // namespace infinity
\ No newline at end of file
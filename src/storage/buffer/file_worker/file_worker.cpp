@@ -14,6 +14,9 @@
 
 module;
 
+#include <cstring>
+#include <sys/mman.h>
+
 module file_worker;
 
 import stl;
@@ -28,10 +31,74 @@ import local_file_system;
 import persistence_manager;
 import infinity_context;
 import logger;
+import config;
+import crc;
 
 namespace infinity {
 
-FileWorker::~FileWorker() = default;
+namespace {
+
+// Footer appended to every file written by a FileWorker: the CRC32C and the size of the file body.
+// Files written before the footer was introduced have none, their body is the whole file.
+struct FileFooter {
+    u64 body_size_{};
+    u32 checksum_{};
+    u32 magic_{};
+};
+
+constexpr u32 FILE_FOOTER_MAGIC = 0x43524346;
+
+constexpr SizeT CHECKSUM_CHUNK_SIZE = 1024 * 1024;
+
+bool ValidFooter(const FileFooter &footer, SizeT file_size) {
+    return footer.magic_ == FILE_FOOTER_MAGIC && footer.body_size_ == file_size - sizeof(FileFooter);
+}
+
+// The footer of the `file_size` bytes at `offset` of the file, if they end with one
+Optional<FileFooter> ReadFooter(LocalFileSystem &fs, FileHandler &file_handler, SizeT offset, SizeT file_size) {
+    if (file_size < sizeof(FileFooter)) {
+        return None;
+    }
+    FileFooter footer;
+    i64 nbytes = fs.ReadAt(file_handler, offset + file_size - sizeof(FileFooter), &footer, sizeof(footer));
+    if (nbytes != sizeof(footer) || !ValidFooter(footer, file_size)) {
+        return None;
+    }
+    return footer;
+}
+
+// Extend `checksum` with the `size` bytes at `offset` of the file
+u32 ChecksumFileRange(LocalFileSystem &fs,
+                      FileHandler &file_handler,
+                      SizeT offset,
+                      SizeT size,
+                      const std::function<void(SizeT)> &on_read,
+                      u32 checksum = 0) {
+    auto buffer = MakeUnique<char[]>(std::min(size, CHECKSUM_CHUNK_SIZE));
+    for (SizeT pos = 0; pos < size;) {
+        const SizeT chunk_size = std::min(CHECKSUM_CHUNK_SIZE, size - pos);
+        i64 nbytes = fs.ReadAt(file_handler, offset + pos, buffer.get(), chunk_size);
+        if (nbytes != (i64)chunk_size) {
+            Status status = Status::DataIOError(fmt::format("Expect to read {} bytes from {}, but {} bytes is read", chunk_size, file_handler.path_.string(), nbytes));
+            RecoverableError(status);
+        }
+        checksum = CRC32C::Extend(checksum, buffer.get(), chunk_size);
+        pos += chunk_size;
+        if (on_read) {
+            on_read(chunk_size);
+        }
+    }
+    return checksum;
+}
+
+bool VerifyOnLoad() {
+    Config *config = InfinityContext::instance().config();
+    return config != nullptr && config->VerifyFileChecksum();
+}
+
+} // namespace
+
+FileWorker::~FileWorker() { FreeMmap(); }
 
 bool FileWorker::WriteToFile(bool to_spill, const FileWorkerSaveCtx &ctx) {
     if (data_ == nullptr) {
@@ -45,6 +112,13 @@ bool FileWorker::WriteToFile(bool to_spill, const FileWorkerSaveCtx &ctx) {
         fs.CreateDirectory(write_dir);
     }
     String write_path = fmt::format("{}/{}", write_dir, *file_name_);
+    // data_ may still point into the mapped file, so the new content is written to a temporary file which then replaces it.
+    // The mapping keeps the old inode, and the file on disk is never missing or partially written.
+    const bool replace_mapped = mmap_addr_ != nullptr && !to_spill;
+    const String final_path = write_path;
+    if (replace_mapped) {
+        write_path = fmt::format("{}.tmp", final_path);
+    }
 
     u8 flags = FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG;
     auto [file_handler, status] = fs.OpenFile(write_path, flags, FileLockType::kWriteLock);
@@ -64,13 +138,23 @@ bool FileWorker::WriteToFile(bool to_spill, const FileWorkerSaveCtx &ctx) {
         file_handler_ = nullptr;
     });
 
+    file_handler_->write_checksum_ = true;
     bool all_save = WriteToFileImpl(to_spill, prepare_success, ctx);
     if (prepare_success) {
+        AppendFooter();
         if (to_spill) {
             LOG_TRACE(fmt::format("Write to spill file {} finished. success {}", write_path, prepare_success));
         }
         fs.SyncFile(*file_handler_);
     }
+    if (replace_mapped) {
+        if (prepare_success) {
+            fs.Rename(write_path, final_path);
+        } else {
+            fs.DeleteFile(write_path);
+        }
+        write_path = final_path;
+    }
 
     bool use_object_cache = !to_spill && InfinityContext::instance().persistence_manager() != nullptr;
     if (use_object_cache) {
@@ -95,6 +179,12 @@ void FileWorker::ReadFromFile(bool from_spill) {
         }
         read_path = pm->GetObjCache(read_path);
     }
+    if (!from_spill && !use_object_cache && SupportMmap()) {
+        Config *config = InfinityContext::instance().config();
+        if (config != nullptr && config->IndexMmapLoad() && ReadFromMmap(read_path)) {
+            return;
+        }
+    }
     SizeT file_size = 0;
     u8 flags = FileFlags::READ_FLAG;
     auto [file_handler, status] = fs.OpenFile(read_path, flags, FileLockType::kReadLock);
@@ -116,7 +206,140 @@ void FileWorker::ReadFromFile(bool from_spill) {
             pm->PutObjCache(read_path);
         }
     });
+    SizeT file_offset = use_object_cache ? obj_addr_.part_offset_ : 0;
+    auto footer = ReadFooter(fs, *file_handler_, file_offset, file_size);
+    const bool verify = footer.has_value() && VerifyOnLoad();
+    if (footer.has_value()) {
+        file_size = footer->body_size_;
+    }
+    if (verify) {
+        // The body is checksummed as ReadFromFileImpl reads it, ReadFooter uses pread and doesn't move the file offset
+        file_handler_->read_checksum_ = true;
+        file_handler_->read_crc_ = 0;
+        file_handler_->read_crc_size_ = 0;
+    }
     ReadFromFileImpl(file_size);
+    if (verify) {
+        const bool read_in_order = file_handler_->read_checksum_ && file_handler_->read_crc_size_ <= file_size;
+        file_handler_->read_checksum_ = false;
+        u32 checksum = 0;
+        if (read_in_order) {
+            // Only the part of the body the worker didn't read is read again
+            const SizeT read_size = file_handler_->read_crc_size_;
+            checksum = ChecksumFileRange(fs, *file_handler_, file_offset + read_size, file_size - read_size, nullptr, file_handler_->read_crc_);
+        } else {
+            checksum = ChecksumFileRange(fs, *file_handler_, file_offset, file_size, nullptr);
+        }
+        if (checksum != footer->checksum_) {
+            if (data_ != nullptr) {
+                FreeInMemory();
+            }
+            RecoverableError(Status::DataCorrupted(read_path));
+        }
+    }
+}
+
+void FileWorker::AppendFooter() {
+    LocalFileSystem fs;
+    const bool written_in_order = file_handler_->write_checksum_;
+    file_handler_->write_checksum_ = false;
+    if (!written_in_order) {
+        LOG_WARN(fmt::format("File {} isn't written sequentially, no checksum footer is appended", file_handler_->path_.string()));
+        return;
+    }
+    if (fs.GetFileSize(*file_handler_) > file_handler_->write_crc_size_) {
+        // The file is rewritten in place, drop what is left of the previous content
+        fs.Truncate(file_handler_->path_.string(), file_handler_->write_crc_size_);
+    }
+    FileFooter footer{.body_size_ = file_handler_->write_crc_size_, .checksum_ = file_handler_->write_crc_, .magic_ = FILE_FOOTER_MAGIC};
+    fs.Write(*file_handler_, &footer, sizeof(footer));
+}
+
+Status FileWorker::VerifyFile(const String &path, const std::function<void(SizeT)> &on_read) {
+    LocalFileSystem fs;
+    PersistenceManager *pm = InfinityContext::instance().persistence_manager();
+    String read_path = path;
+    ObjAddr obj_addr;
+    if (pm != nullptr) {
+        obj_addr = pm->GetObjFromLocalPath(path);
+        if (!obj_addr.Valid()) {
+            return Status::FileNotFound(path);
+        }
+        read_path = pm->GetObjCache(path);
+    } else if (!fs.Exists(path)) {
+        return Status::FileNotFound(path);
+    }
+    DeferFn defer_fn([&]() {
+        if (pm != nullptr) {
+            pm->PutObjCache(path);
+        }
+    });
+
+    auto [file_handler, status] = fs.OpenFile(read_path, FileFlags::READ_FLAG, FileLockType::kReadLock);
+    if (!status.ok()) {
+        return status;
+    }
+    DeferFn close_fn([&]() { file_handler->Close(); });
+    const SizeT file_offset = obj_addr.Valid() ? obj_addr.part_offset_ : 0;
+    const SizeT file_size = obj_addr.Valid() ? obj_addr.part_size_ : fs.GetFileSize(*file_handler);
+    auto footer = ReadFooter(fs, *file_handler, file_offset, file_size);
+    if (!footer.has_value()) {
+        return Status::OK();
+    }
+    if (ChecksumFileRange(fs, *file_handler, file_offset, footer->body_size_, on_read) != footer->checksum_) {
+        return Status::DataCorrupted(path);
+    }
+    return Status::OK();
+}
+
+bool FileWorker::ReadFromMmap(const String &read_path) {
+    LocalFileSystem fs;
+    auto [file_handler, status] = fs.OpenFile(read_path, FileFlags::READ_FLAG, FileLockType::kReadLock);
+    if (!status.ok()) {
+        UnrecoverableError(status.message());
+    }
+    DeferFn defer_fn([&]() { file_handler->Close(); });
+    SizeT file_size = fs.GetFileSize(*file_handler);
+    if (file_size == 0) {
+        return false;
+    }
+    i32 fd = static_cast<LocalFileHandler *>(file_handler.get())->fd_;
+    // private and writable: pages written by optimize are copied, the file itself is never modified through the mapping
+    void *addr = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) {
+        LOG_WARN(fmt::format("Failed to mmap {}, fallback to read", read_path));
+        return false;
+    }
+    madvise(addr, file_size, MADV_RANDOM);
+    mmap_addr_ = addr;
+    mmap_size_ = file_size;
+    SizeT body_size = file_size;
+    if (file_size >= sizeof(FileFooter)) {
+        FileFooter footer;
+        std::memcpy(&footer, static_cast<const char *>(addr) + file_size - sizeof(FileFooter), sizeof(footer));
+        if (ValidFooter(footer, file_size)) {
+            body_size = footer.body_size_;
+            if (VerifyOnLoad() && CRC32C::Value(addr, body_size) != footer.checksum_) {
+                FreeMmap();
+                RecoverableError(Status::DataCorrupted(read_path));
+            }
+        }
+    }
+    ReadFromMmapImpl(static_cast<const char *>(addr), body_size);
+    return true;
+}
+
+void FileWorker::ReadFromMmapImpl(const char *, SizeT) {
+    String error_message = "ReadFromMmapImpl: mmap load is not supported by this file worker.";
+    UnrecoverableError(error_message);
+}
+
+void FileWorker::FreeMmap() {
+    if (mmap_addr_ != nullptr) {
+        munmap(mmap_addr_, mmap_size_);
+        mmap_addr_ = nullptr;
+        mmap_size_ = 0;
+    }
 }
 
 void FileWorker::MoveFile() {
@@ -23,6 +23,7 @@ import file_system;
 import third_party;
 import file_worker_type;
 import persistence_manager;
+import status;
 
 namespace infinity {
 
@@ -56,6 +57,10 @@ public:
 
     void *GetData() { return data_; }
 
+    // Check the checksum footer of the file at `path`, the path ReadFromFile() would read for a non-spilled file.
+    // `on_read` is called with the size of each chunk read. Files written before the footer was introduced pass unchecked.
+    static Status VerifyFile(const String &path, const std::function<void(SizeT)> &on_read = nullptr);
+
     // Get absolute file path. As key of buffer handle.
     String GetFilePath() const;
 
@@ -68,9 +73,23 @@ protected:
 
     virtual void ReadFromFileImpl(SizeT file_size) = 0;
 
+    // Workers which can use the file content in place override these two. With `index_mmap_load` the file is mapped
+    // privately and ReadFromMmapImpl is called instead of ReadFromFileImpl, the mapping lives until FreeMmap().
+    virtual bool SupportMmap() const { return false; }
+
+    virtual void ReadFromMmapImpl(const char *ptr, SizeT size);
+
+    // Called by FreeInMemory after data_ is released.
+    void FreeMmap();
+
 private:
     String ChooseFileDir(bool spill) const;
 
+    bool ReadFromMmap(const String &read_path);
+
+    // Append the checksum footer of the bytes written by WriteToFileImpl()
+    void AppendFooter();
+
 public:
     const SharedPtr<String> data_dir_{};
     const SharedPtr<String> temp_dir_{};
@@ -81,5 +100,8 @@ public:
 protected:
     void *data_{nullptr};
     UniquePtr<FileHandler> file_handler_{nullptr};
+
+    void *mmap_addr_{nullptr};
+    SizeT mmap_size_{0};
 };
 } // namespace infinity
\ No newline at end of file
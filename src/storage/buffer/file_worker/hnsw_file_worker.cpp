@@ -95,6 +95,7 @@ void HnswFileWorker::FreeInMemory() {
         *p);
     delete p;
     data_ = nullptr;
+    FreeMmap();
 }
 
 bool HnswFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success, const FileWorkerSaveCtx &ctx) {
@@ -136,4 +137,27 @@ void HnswFileWorker::ReadFromFileImpl(SizeT file_size) {
         *hnsw_index);
 }
 
+void HnswFileWorker::ReadFromMmapImpl(const char *ptr, SizeT size) {
+    if (data_ != nullptr) {
+        UnrecoverableError("Data is already allocated.");
+    }
+    data_ = static_cast<void *>(new AbstractHnsw(HnswIndexInMem::InitAbstractIndex(index_base_.get(), column_def_.get())));
+    auto *hnsw_index = reinterpret_cast<AbstractHnsw *>(data_);
+    std::visit(
+        [&](auto &&index) {
+            using T = std::decay_t<decltype(index)>;
+            if constexpr (std::is_same_v<T, std::nullptr_t>) {
+                UnrecoverableError("Invalid index type.");
+            } else {
+                using IndexT = std::decay_t<decltype(*index)>;
+                const char *p = ptr;
+                index = IndexT::LoadFromPtr(p).release();
+                if (SizeT(p - ptr) != size) {
+                    UnrecoverableError("HNSW index file size mismatch.");
+                }
+            }
+        },
+        *hnsw_index);
+}
+
 } // namespace infinity
\ No newline at end of file
@@ -62,6 +62,10 @@ protected:
 
     void ReadFromFileImpl(SizeT file_size) override;
 
+    bool SupportMmap() const override { return true; }
+
+    void ReadFromMmapImpl(const char *ptr, SizeT size) override;
+
 private:
     SizeT index_size_{};
 };
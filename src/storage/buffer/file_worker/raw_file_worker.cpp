@@ -75,7 +75,7 @@ bool RawFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success, const
 
 void RawFileWorker::ReadFromFileImpl(SizeT file_size) {
     LocalFileSystem fs;
-    buffer_size_ = fs.GetFileSize(*file_handler_);
+    buffer_size_ = file_size;
     data_ = static_cast<void *>(new char[buffer_size_]);
     i64 nbytes = fs.Read(*file_handler_, data_, buffer_size_);
     if (nbytes != (i64)buffer_size_) {
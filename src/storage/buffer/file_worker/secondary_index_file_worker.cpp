@@ -131,8 +131,11 @@ void SecondaryIndexFileWorkerParts::AllocateInMemory() {
 
 void SecondaryIndexFileWorkerParts::FreeInMemory() {
     if (data_) [[likely]] {
-        delete[] static_cast<char *>(data_);
+        if (mmap_addr_ == nullptr) {
+            delete[] static_cast<char *>(data_);
+        }
         data_ = nullptr;
+        FreeMmap();
         LOG_TRACE("Finished FreeInMemory(), deleted data_ ptr.");
     } else {
         String error_message = "FreeInMemory: Data is not allocated.";
@@ -168,4 +171,19 @@ void SecondaryIndexFileWorkerParts::ReadFromFileImpl(SizeT file_size) {
     }
 }
 
+void SecondaryIndexFileWorkerParts::ReadFromMmapImpl(const char *ptr, SizeT size) {
+    if (data_) [[unlikely]] {
+        String error_message = "ReadFromMmapImpl: data_ is not nullptr";
+        UnrecoverableError(error_message);
+    }
+    const u32 read_bytes = part_row_count_ * data_pair_size_;
+    if (size < read_bytes) [[unlikely]] {
+        String error_message = fmt::format("ReadFromMmapImpl: file size {} < expected size {}", size, read_bytes);
+        UnrecoverableError(error_message);
+    }
+    // the (key, offset) pairs are used in place, the mapping is private so the buffer can still be written
+    data_ = static_cast<void *>(const_cast<char *>(ptr));
+    LOG_TRACE("Finished ReadFromMmapImpl().");
+}
+
 } // namespace infinity
\ No newline at end of file
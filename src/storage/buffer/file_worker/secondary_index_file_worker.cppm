@@ -93,6 +93,10 @@ protected:
 
     void ReadFromFileImpl(SizeT file_size) override;
 
+    bool SupportMmap() const override { return true; }
+
+    void ReadFromMmapImpl(const char *ptr, SizeT size) override;
+
     const u32 row_count_;
     const u32 part_id_;
     u32 part_row_count_ = std::min<u32>(8192, row_count_ - part_id_ * 8192);
@@ -14,6 +14,8 @@
 
 module;
 
+#include <lz4.h>
+
 module var_file_worker;
 
 import stl;
@@ -24,12 +26,29 @@ import local_file_system;
 
 namespace infinity {
 
+namespace {
+
+// File structure:
+// - header: magic number, encoding, raw size, stored size
+// - data, raw or LZ4 compressed
+// Var files written before the header was introduced are raw buffers without a header, they are created with `with_header` false.
+constexpr u64 VAR_FILE_MAGIC = 0x00dd4c5a34564152;
+constexpr u64 VAR_FILE_ENCODING_RAW = 0;
+constexpr u64 VAR_FILE_ENCODING_LZ4 = 1;
+constexpr SizeT VAR_FILE_HEADER_SIZE = 4 * sizeof(u64);
+// Small buffers are not worth compressing
+constexpr SizeT LZ4_VAR_FILE_MIN_SIZE = 4096;
+
+} // namespace
+
 VarFileWorker::VarFileWorker(SharedPtr<String> data_dir,
                              SharedPtr<String> temp_dir,
                              SharedPtr<String> file_dir,
                              SharedPtr<String> file_name,
-                             SizeT buffer_size)
-    : FileWorker(std::move(data_dir), std::move(temp_dir), std::move(file_dir), std::move(file_name)), buffer_size_(buffer_size) {}
+                             SizeT buffer_size,
+                             bool with_header)
+    : FileWorker(std::move(data_dir), std::move(temp_dir), std::move(file_dir), std::move(file_name)), buffer_size_(buffer_size),
+      with_header_(with_header) {}
 
 VarFileWorker::~VarFileWorker() {
     if (data_ != nullptr) {
@@ -78,9 +97,42 @@ bool VarFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success, const
     buffer->Write(ptr);
 
     LocalFileSystem fs;
-    u64 nbytes = fs.Write(*file_handler_, buffer_data.get(), data_size);
-    if (nbytes != data_size) {
-        String error_message = fmt::format("Write {} bytes to file failed, only {} bytes written.", data_size, nbytes);
+    if (!with_header_) {
+        // Keep the legacy format, the catalog still reads this file without a header
+        u64 nbytes = fs.Write(*file_handler_, buffer_data.get(), data_size);
+        if (nbytes != data_size) {
+            String error_message = fmt::format("Write {} bytes to file failed, only {} bytes written.", data_size, nbytes);
+            UnrecoverableError(error_message);
+        }
+        prepare_success = true;
+        buffer_size_ = data_size;
+        return true;
+    }
+
+    // The header is followed by the raw data, unless compression saves at least 1/8 of it
+    u64 encoding = VAR_FILE_ENCODING_RAW;
+    UniquePtr<char[]> compressed;
+    SizeT stored_size = data_size;
+    if (!to_spill && data_size >= LZ4_VAR_FILE_MIN_SIZE && data_size <= LZ4_MAX_INPUT_SIZE) {
+        const int bound = LZ4_compressBound(data_size);
+        compressed = MakeUniqueForOverwrite<char[]>(bound);
+        const int compressed_size = LZ4_compress_default(buffer_data.get(), compressed.get(), static_cast<int>(data_size), bound);
+        if (compressed_size > 0 && static_cast<SizeT>(compressed_size) < data_size - data_size / 8) {
+            encoding = VAR_FILE_ENCODING_LZ4;
+            stored_size = compressed_size;
+        }
+    }
+    const char *stored_data = encoding == VAR_FILE_ENCODING_LZ4 ? compressed.get() : buffer_data.get();
+
+    const u64 header[4] = {VAR_FILE_MAGIC, encoding, data_size, stored_size};
+    u64 nbytes = fs.Write(*file_handler_, header, sizeof(header));
+    if (nbytes != sizeof(header)) {
+        String error_message = fmt::format("Write {} bytes to file failed, only {} bytes written.", sizeof(header), nbytes);
+        UnrecoverableError(error_message);
+    }
+    nbytes = fs.Write(*file_handler_, stored_data, stored_size);
+    if (nbytes != stored_size) {
+        String error_message = fmt::format("Write {} bytes to file failed, only {} bytes written.", stored_size, nbytes);
         UnrecoverableError(error_message);
     }
     prepare_success = true;
@@ -93,11 +145,65 @@ void VarFileWorker::ReadFromFileImpl(SizeT file_size) {
         String error_message = "Data is not allocated.";
         UnrecoverableError(error_message);
     }
+
+    if (!with_header_) {
+        ReadLegacy(file_size);
+        return;
+    }
+
+    if (file_size < VAR_FILE_HEADER_SIZE) {
+        String error_message = fmt::format("Var file {} size {} is smaller than its header.", *file_name_, file_size);
+        UnrecoverableError(error_message);
+    }
+    LocalFileSystem fs;
+    u64 header[4]{};
+    u64 nbytes = fs.Read(*file_handler_, header, sizeof(header));
+    if (nbytes != sizeof(header)) {
+        String error_message = fmt::format("Read {} bytes from file failed, only {} bytes read.", sizeof(header), nbytes);
+        UnrecoverableError(error_message);
+    }
+    if (header[0] != VAR_FILE_MAGIC) {
+        String error_message = fmt::format("Var file {} has an invalid magic number {:#x}.", *file_name_, header[0]);
+        UnrecoverableError(error_message);
+    }
+    const u64 encoding = header[1];
+    const u64 raw_size = header[2];
+    const u64 stored_size = header[3];
+    if (file_size != VAR_FILE_HEADER_SIZE + stored_size) {
+        String error_message = fmt::format("Var file {} size {} isn't matched with {}.", *file_name_, file_size, VAR_FILE_HEADER_SIZE + stored_size);
+        UnrecoverableError(error_message);
+    }
+    // The catalog only knows the first buffer_size_ bytes, later appends may have been persisted
+    if (raw_size < buffer_size_) {
+        String error_message = fmt::format("Var file {} raw size {} is smaller than buffer size {}.", *file_name_, raw_size, buffer_size_);
+        UnrecoverableError(error_message);
+    }
+
+    switch (encoding) {
+        case VAR_FILE_ENCODING_RAW: {
+            ReadRaw();
+            break;
+        }
+        case VAR_FILE_ENCODING_LZ4: {
+            ReadCompressed(raw_size, stored_size);
+            break;
+        }
+        default: {
+            String error_message = fmt::format("Var file {} has an unknown encoding {}.", *file_name_, encoding);
+            UnrecoverableError(error_message);
+        }
+    }
+}
+
+void VarFileWorker::ReadLegacy(SizeT file_size) {
     if (file_size < buffer_size_) {
         String error_message = fmt::format("File size {} is smaller than buffer size {}.", file_size, buffer_size_);
         UnrecoverableError(error_message);
     }
+    ReadRaw();
+}
 
+void VarFileWorker::ReadRaw() {
     LocalFileSystem fs;
     auto buffer = MakeUnique<char[]>(buffer_size_);
     u64 nbytes = fs.Read(*file_handler_, buffer.get(), buffer_size_);
@@ -109,4 +215,23 @@ void VarFileWorker::ReadFromFileImpl(SizeT file_size) {
     data_ = static_cast<void *>(var_buffer);
 }
 
-} // namespace infinity
\ No newline at end of file
+void VarFileWorker::ReadCompressed(SizeT raw_size, SizeT compressed_size) {
+    LocalFileSystem fs;
+    auto compressed = MakeUniqueForOverwrite<char[]>(compressed_size);
+    u64 nbytes = fs.Read(*file_handler_, compressed.get(), compressed_size);
+    if (nbytes != compressed_size) {
+        String error_message = fmt::format("Read {} bytes from file failed, only {} bytes read.", compressed_size, nbytes);
+        UnrecoverableError(error_message);
+    }
+    auto buffer = MakeUniqueForOverwrite<char[]>(raw_size);
+    const int decompressed_size =
+        LZ4_decompress_safe(compressed.get(), buffer.get(), static_cast<int>(compressed_size), static_cast<int>(raw_size));
+    if (decompressed_size < 0 || static_cast<SizeT>(decompressed_size) != raw_size) {
+        String error_message = fmt::format("Corrupted compressed var file {}, decompressed {} of {} bytes.", *file_name_, decompressed_size, raw_size);
+        UnrecoverableError(error_message);
+    }
+    auto *var_buffer = new VarBuffer(buffer_obj_, std::move(buffer), buffer_size_);
+    data_ = static_cast<void *>(var_buffer);
+}
+
+} // namespace infinity
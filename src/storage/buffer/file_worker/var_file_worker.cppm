@@ -29,7 +29,8 @@ public:
                            SharedPtr<String> temp_dir,
                            SharedPtr<String> file_dir,
                            SharedPtr<String> file_name,
-                           SizeT buffer_size);
+                           SizeT buffer_size,
+                           bool with_header = true);
 
     virtual ~VarFileWorker() override;
 
@@ -49,8 +50,17 @@ protected:
 
     void ReadFromFileImpl(SizeT file_size) override;
 
+private:
+    void ReadLegacy(SizeT file_size);
+
+    void ReadRaw();
+
+    void ReadCompressed(SizeT raw_size, SizeT compressed_size);
+
 private:
     SizeT buffer_size_ = 0;
+    // False for the files written before the header was introduced, the catalog records which format a file has
+    bool with_header_ = true;
     BufferObj *buffer_obj_ = nullptr;
 };
 
@@ -75,10 +75,12 @@ bool VersionFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success, co
 
     if (to_spill) {
         data->SpillToFile(*file_handler_);
+        prepare_success = true;
         return true;
     } else {
         const auto &ctx = static_cast<const VersionFileWorkerSaveCtx &>(base_ctx);
         data->SaveToFile(ctx.checkpoint_ts_, *file_handler_);
+        prepare_success = true;
         return ctx.checkpoint_ts_ >= latest_change_ts;
     }
 }
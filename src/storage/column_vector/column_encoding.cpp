@@ -0,0 +1,321 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <bit>
+#include <cstring>
+
+module column_encoding;
+
+import stl;
+
+namespace infinity {
+
+String ToString(ColumnEncodingType type) {
+    switch (type) {
+        case ColumnEncodingType::kRaw:
+            return "raw";
+        case ColumnEncodingType::kRLE:
+            return "rle";
+        case ColumnEncodingType::kDictionary:
+            return "dictionary";
+        case ColumnEncodingType::kFrameOfReference:
+            return "frame_of_reference";
+    }
+    return "invalid";
+}
+
+namespace {
+
+inline u64 LoadValue(const char *ptr, SizeT width) {
+    u64 value = 0;
+    std::memcpy(&value, ptr, width);
+    return value;
+}
+
+inline i64 SignExtend(u64 value, SizeT width) {
+    if (width == sizeof(u64)) {
+        return static_cast<i64>(value);
+    }
+    const u32 shift = 64 - width * 8;
+    return static_cast<i64>(value << shift) >> shift;
+}
+
+inline u32 BitWidth(u64 max_code) { return static_cast<u32>(std::bit_width(max_code)); }
+
+inline SizeT PackedSize(SizeT count, u32 bits) { return (count * bits + 7) / 8; }
+
+// Append `count` codes of `bits` bits each, least significant bit first
+template <typename CodeFn>
+void PackBits(SizeT count, u32 bits, CodeFn &&code_fn, String &out) {
+    if (bits == 0) {
+        return;
+    }
+    SizeT pos = out.size();
+    out.resize(pos + PackedSize(count, bits));
+    u64 acc = 0;
+    u32 acc_bits = 0;
+    for (SizeT i = 0; i < count; ++i) {
+        const u64 code = code_fn(i);
+        acc |= code << acc_bits;
+        if (acc_bits + bits >= 64) {
+            std::memcpy(out.data() + pos, &acc, sizeof(acc));
+            pos += sizeof(acc);
+            acc = acc_bits == 0 ? 0 : code >> (64 - acc_bits);
+            acc_bits = acc_bits + bits - 64;
+        } else {
+            acc_bits += bits;
+        }
+    }
+    std::memcpy(out.data() + pos, &acc, (acc_bits + 7) / 8);
+}
+
+inline u64 UnpackBits(const u8 *src, SizeT src_size, SizeT bit_pos, u32 bits) {
+    const u64 mask = bits == 64 ? ~u64(0) : (u64(1) << bits) - 1;
+    const SizeT byte_pos = bit_pos / 8;
+    const u32 shift = bit_pos % 8;
+    if (byte_pos + sizeof(u64) + 1 <= src_size) {
+        u64 word = 0;
+        std::memcpy(&word, src + byte_pos, sizeof(word));
+        u64 value = word >> shift;
+        if (shift + bits > 64) {
+            value |= u64(src[byte_pos + sizeof(u64)]) << (64 - shift);
+        }
+        return value & mask;
+    }
+    u64 value = 0;
+    for (u32 got = 0; got < bits;) {
+        const SizeT cur_byte = bit_pos / 8;
+        const u32 cur_shift = bit_pos % 8;
+        const u32 n = std::min<u32>(8 - cur_shift, bits - got);
+        value |= u64((src[cur_byte] >> cur_shift) & ((1u << n) - 1)) << got;
+        got += n;
+        bit_pos += n;
+    }
+    return value;
+}
+
+void EncodeRLE(const char *data, SizeT count, SizeT width, String &encoded) {
+    for (SizeT i = 0; i < count;) {
+        const char *value = data + i * width;
+        SizeT run_end = i + 1;
+        while (run_end < count && run_end - i < std::numeric_limits<u32>::max() && std::memcmp(data + run_end * width, value, width) == 0) {
+            ++run_end;
+        }
+        const u32 run_length = run_end - i;
+        encoded.append(reinterpret_cast<const char *>(&run_length), sizeof(run_length));
+        encoded.append(value, width);
+        i = run_end;
+    }
+}
+
+bool DecodeRLE(const char *encoded, SizeT encoded_size, SizeT width, char *data, SizeT count) {
+    SizeT row = 0;
+    for (SizeT pos = 0; pos < encoded_size; pos += sizeof(u32) + width) {
+        if (pos + sizeof(u32) + width > encoded_size) {
+            return false;
+        }
+        u32 run_length = 0;
+        std::memcpy(&run_length, encoded + pos, sizeof(run_length));
+        if (row + run_length > count) {
+            return false;
+        }
+        const char *value = encoded + pos + sizeof(u32);
+        for (u32 i = 0; i < run_length; ++i, ++row) {
+            std::memcpy(data + row * width, value, width);
+        }
+    }
+    return row == count;
+}
+
+void EncodeDictionary(const char *data,
+                      SizeT count,
+                      SizeT width,
+                      const Vector<std::string_view> &dictionary,
+                      const HashMap<std::string_view, u32> &codes,
+                      String &encoded) {
+    const u32 dictionary_size = dictionary.size();
+    encoded.append(reinterpret_cast<const char *>(&dictionary_size), sizeof(dictionary_size));
+    for (const auto &value : dictionary) {
+        encoded.append(value.data(), value.size());
+    }
+    const u8 bits = BitWidth(dictionary_size - 1);
+    encoded.push_back(static_cast<char>(bits));
+    PackBits(count, bits, [&](SizeT i) { return u64(codes.at(std::string_view(data + i * width, width))); }, encoded);
+}
+
+bool DecodeDictionary(const char *encoded, SizeT encoded_size, SizeT width, char *data, SizeT count) {
+    u32 dictionary_size = 0;
+    if (encoded_size < sizeof(dictionary_size)) {
+        return false;
+    }
+    std::memcpy(&dictionary_size, encoded, sizeof(dictionary_size));
+    const char *dictionary = encoded + sizeof(dictionary_size);
+    const SizeT header_size = sizeof(dictionary_size) + SizeT(dictionary_size) * width + 1;
+    if (dictionary_size == 0 || encoded_size < header_size) {
+        return false;
+    }
+    const u32 bits = static_cast<u8>(encoded[header_size - 1]);
+    if (bits > 32 || encoded_size != header_size + PackedSize(count, bits)) {
+        return false;
+    }
+    const auto *packed = reinterpret_cast<const u8 *>(encoded + header_size);
+    const SizeT packed_size = encoded_size - header_size;
+    for (SizeT i = 0; i < count; ++i) {
+        const u64 code = bits == 0 ? 0 : UnpackBits(packed, packed_size, i * bits, bits);
+        if (code >= dictionary_size) {
+            return false;
+        }
+        std::memcpy(data + i * width, dictionary + code * width, width);
+    }
+    return true;
+}
+
+void EncodeFrameOfReference(const char *data, SizeT count, SizeT width, i64 min_value, u32 bits, String &encoded) {
+    const u64 base = static_cast<u64>(min_value);
+    encoded.append(reinterpret_cast<const char *>(&base), sizeof(base));
+    encoded.push_back(static_cast<char>(bits));
+    // Deltas are computed modulo 2^64, so they also hold for unsigned values and ranges wider than i64
+    PackBits(count, bits, [&](SizeT i) { return static_cast<u64>(SignExtend(LoadValue(data + i * width, width), width)) - base; }, encoded);
+}
+
+bool DecodeFrameOfReference(const char *encoded, SizeT encoded_size, SizeT width, char *data, SizeT count) {
+    constexpr SizeT header_size = sizeof(u64) + 1;
+    if (width > sizeof(u64) || encoded_size < header_size) {
+        return false;
+    }
+    u64 base = 0;
+    std::memcpy(&base, encoded, sizeof(base));
+    const u32 bits = static_cast<u8>(encoded[sizeof(u64)]);
+    if (bits > 64 || encoded_size != header_size + PackedSize(count, bits)) {
+        return false;
+    }
+    const auto *packed = reinterpret_cast<const u8 *>(encoded + header_size);
+    const SizeT packed_size = encoded_size - header_size;
+    for (SizeT i = 0; i < count; ++i) {
+        const u64 value = base + (bits == 0 ? 0 : UnpackBits(packed, packed_size, i * bits, bits));
+        std::memcpy(data + i * width, &value, width);
+    }
+    return true;
+}
+
+} // namespace
+
+ColumnEncodingType ColumnEncoding::Encode(const char *data, SizeT size, SizeT width, String &encoded) {
+    encoded.clear();
+    if (width == 0 || size == 0 || size % width != 0) {
+        return ColumnEncodingType::kRaw;
+    }
+    const SizeT count = size / width;
+    const bool integer_width = width == 1 || width == 2 || width == 4 || width == 8;
+
+    // One pass to size every encoding
+    SizeT run_count = 0;
+    i64 min_value = std::numeric_limits<i64>::max();
+    i64 max_value = std::numeric_limits<i64>::min();
+    Vector<std::string_view> dictionary;
+    HashMap<std::string_view, u32> codes;
+    bool dictionary_valid = true;
+    for (SizeT i = 0; i < count; ++i) {
+        const char *ptr = data + i * width;
+        if (i == 0 || std::memcmp(ptr, ptr - width, width) != 0) {
+            ++run_count;
+            if (dictionary_valid) {
+                auto [iter, inserted] = codes.emplace(std::string_view(ptr, width), dictionary.size());
+                if (inserted) {
+                    dictionary.push_back(iter->first);
+                    dictionary_valid = dictionary.size() <= MAX_DICTIONARY_SIZE;
+                }
+            }
+        }
+        if (integer_width) {
+            const i64 value = SignExtend(LoadValue(ptr, width), width);
+            min_value = std::min(min_value, value);
+            max_value = std::max(max_value, value);
+        }
+    }
+
+    ColumnEncodingType best_type = ColumnEncodingType::kRaw;
+    SizeT best_size = size;
+    const SizeT rle_size = run_count * (sizeof(u32) + width);
+    if (rle_size < best_size) {
+        best_type = ColumnEncodingType::kRLE;
+        best_size = rle_size;
+    }
+    if (dictionary_valid) {
+        const SizeT dictionary_size = sizeof(u32) + dictionary.size() * width + 1 + PackedSize(count, BitWidth(dictionary.size() - 1));
+        if (dictionary_size < best_size) {
+            best_type = ColumnEncodingType::kDictionary;
+            best_size = dictionary_size;
+        }
+    }
+    u32 delta_bits = 0;
+    if (integer_width) {
+        delta_bits = BitWidth(static_cast<u64>(max_value) - static_cast<u64>(min_value));
+        const SizeT for_size = sizeof(u64) + 1 + PackedSize(count, delta_bits);
+        if (for_size < best_size) {
+            best_type = ColumnEncodingType::kFrameOfReference;
+            best_size = for_size;
+        }
+    }
+
+    encoded.reserve(best_size);
+    switch (best_type) {
+        case ColumnEncodingType::kRaw: {
+            break;
+        }
+        case ColumnEncodingType::kRLE: {
+            EncodeRLE(data, count, width, encoded);
+            break;
+        }
+        case ColumnEncodingType::kDictionary: {
+            EncodeDictionary(data, count, width, dictionary, codes, encoded);
+            break;
+        }
+        case ColumnEncodingType::kFrameOfReference: {
+            EncodeFrameOfReference(data, count, width, min_value, delta_bits, encoded);
+            break;
+        }
+    }
+    return best_type;
+}
+
+bool ColumnEncoding::Decode(ColumnEncodingType type, const char *encoded, SizeT encoded_size, SizeT width, char *data, SizeT size) {
+    if (width == 0 || size % width != 0) {
+        return false;
+    }
+    const SizeT count = size / width;
+    switch (type) {
+        case ColumnEncodingType::kRaw: {
+            if (encoded_size != size) {
+                return false;
+            }
+            std::memcpy(data, encoded, size);
+            return true;
+        }
+        case ColumnEncodingType::kRLE: {
+            return DecodeRLE(encoded, encoded_size, width, data, count);
+        }
+        case ColumnEncodingType::kDictionary: {
+            return DecodeDictionary(encoded, encoded_size, width, data, count);
+        }
+        case ColumnEncodingType::kFrameOfReference: {
+            return DecodeFrameOfReference(encoded, encoded_size, width, data, count);
+        }
+    }
+    return false;
+}
+
+} // namespace infinity
@@ -0,0 +1,48 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module column_encoding;
+
+import stl;
+
+namespace infinity {
+
+export enum class ColumnEncodingType : u8 {
+    kRaw = 0,
+    kRLE = 1,              // (u32 run length, value) pairs
+    kDictionary = 2,       // distinct values followed by bit-packed codes
+    kFrameOfReference = 3, // minimum value followed by bit-packed deltas, values of at most 8 bytes only
+};
+
+export String ToString(ColumnEncodingType type);
+
+// Lightweight encodings of a fixed-width column buffer.
+// They compress the block column files on disk only, a buffer is decoded when it is loaded into the buffer pool.
+// The buffer is seen as a sequence of `width` bytes values and compared bytewise, so any fixed-width type can be encoded.
+// Frame-of-reference reads values as little-endian integers.
+export struct ColumnEncoding {
+    // Largest dictionary which is worth building
+    static constexpr SizeT MAX_DICTIONARY_SIZE = 1 << 16;
+
+    // Encode with the encoding yielding the smallest output.
+    // Returns kRaw and leaves `encoded` empty if no encoding is smaller than the buffer itself.
+    static ColumnEncodingType Encode(const char *data, SizeT size, SizeT width, String &encoded);
+
+    // Decode into `data` which holds `size` bytes. Returns false if the encoded data is corrupted.
+    static bool Decode(ColumnEncodingType type, const char *encoded, SizeT encoded_size, SizeT width, char *data, SizeT size);
+};
+
+} // namespace infinity
@@ -688,6 +688,48 @@ void ColumnVector::CopyRow(const ColumnVector &other, SizeT dst_idx, SizeT src_i
     }
 }
 
+void ColumnVector::ScatterWith(const ColumnVector &other, const Selection &dst_select) {
+    if (*data_type_ != *other.data_type_) {
+        String error_message =
+            fmt::format("Attempt to scatter column vector{} to column vector{}", other.data_type_->ToString(), data_type_->ToString());
+        UnrecoverableError(error_message);
+    }
+    const SizeT count = dst_select.Size();
+    const bool constant_source = other.vector_type_ == ColumnVectorType::kConstant;
+    switch (data_type_->type()) {
+        case LogicalType::kBoolean:
+        case LogicalType::kVarchar:
+        case LogicalType::kMultiVector:
+        case LogicalType::kTensor:
+        case LogicalType::kTensorArray:
+        case LogicalType::kSparse: {
+            // Bit packed or with data out of line
+            for (SizeT idx = 0; idx < count; ++idx) {
+                CopyRow(other, dst_select[idx], constant_source ? 0 : idx);
+            }
+            break;
+        }
+        default: {
+            for (SizeT idx = 0; idx < count; ++idx) {
+                const SizeT dst_idx = dst_select[idx];
+                if (dst_idx >= tail_index_) {
+                    String error_message = "Attempting to access invalid position of target column vector";
+                    UnrecoverableError(error_message);
+                }
+                std::memcpy(data_ptr_ + dst_idx * data_type_size_, other.data_ptr_ + (constant_source ? 0 : idx) * data_type_size_, data_type_size_);
+            }
+            break;
+        }
+    }
+    if (!other.nulls_ptr_->IsAllTrue()) {
+        for (SizeT idx = 0; idx < count; ++idx) {
+            if (!other.nulls_ptr_->IsTrue(constant_source ? 0 : idx)) {
+                nulls_ptr_->SetFalse(dst_select[idx]);
+            }
+        }
+    }
+}
+
 String ColumnVector::ToString(SizeT row_index) const {
     if (!initialized) {
         String error_message = "Column vector isn't initialized.";
@@ -2263,10 +2305,11 @@ SharedPtr<ColumnVector> ColumnVector::ReadAdv(const char *&ptr, i32 maxbytes) {
     const char *ptr_end = ptr + maxbytes;
     SharedPtr<DataType> data_type = DataType::ReadAdv(ptr, maxbytes);
     ColumnVectorType vector_type = ReadBufAdv<ColumnVectorType>(ptr);
-    SharedPtr<ColumnVector> column_vector = ColumnVector::Make(data_type);
-    column_vector->Initialize(vector_type, DEFAULT_VECTOR_SIZE);
     // read fixed part
     i32 tail_index = ReadBufAdv<i32>(ptr);
+    SharedPtr<ColumnVector> column_vector = ColumnVector::Make(data_type);
+    // An appended block of a large insert has more rows than a vector
+    column_vector->Initialize(vector_type, std::max<SizeT>(tail_index, DEFAULT_VECTOR_SIZE));
     column_vector->tail_index_ = tail_index;
     if (vector_type == ColumnVectorType::kCompactBit) {
         SizeT byte_size = (tail_index + 7) / 8;
@@ -234,6 +234,10 @@ public:
 
     void AppendWith(const ColumnVector &other, SizeT start_row, SizeT count);
 
+    // Copy row i of other, with its null flag, to row dst_select[i] of this vector, which must be below Size().
+    // A constant vector gives its value to every row.
+    void ScatterWith(const ColumnVector &other, const Selection &dst_select);
+
     // input parameter:
     // from - start RowID
     // count - total row count to be copied. These rows shall be in the same BlockEntry.
@@ -0,0 +1,230 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cstring>
+
+module clustering_key;
+
+import stl;
+import column_def;
+import data_type;
+import logical_type;
+import column_vector;
+import vector_buffer;
+import roaring_bitmap;
+import internal_types;
+import infinity_exception;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+// Big-endian bytes, so that memcmp order is the unsigned integer order
+void AppendBigEndian(u64 value, SizeT bytes, String &key) {
+    for (SizeT i = bytes; i > 0; --i) {
+        key.push_back(static_cast<char>((value >> ((i - 1) * 8)) & 0xFF));
+    }
+}
+
+template <typename T>
+void AppendSigned(const ColumnVector &column_vector, SizeT row, String &key) {
+    T value{};
+    std::memcpy(&value, column_vector.data() + row * sizeof(T), sizeof(T));
+    // Flipping the sign bit orders negative values before positive ones
+    const u64 bits = static_cast<u64>(static_cast<i64>(value)) ^ (u64(1) << (sizeof(T) * 8 - 1));
+    AppendBigEndian(bits, sizeof(T), key);
+}
+
+template <typename T, typename U>
+void AppendFloat(const ColumnVector &column_vector, SizeT row, String &key) {
+    T value{};
+    std::memcpy(&value, column_vector.data() + row * sizeof(T), sizeof(T));
+    if (value == 0) {
+        value = 0; // -0.0 and 0.0 are equal
+    }
+    U bits{};
+    std::memcpy(&bits, &value, sizeof(T));
+    constexpr U sign_bit = U(1) << (sizeof(T) * 8 - 1);
+    // Negative values have all bits flipped, positive values only the sign bit
+    bits = (bits & sign_bit) ? ~bits : (bits | sign_bit);
+    AppendBigEndian(bits, sizeof(T), key);
+}
+
+} // namespace
+
+ClusteringKey ClusteringKey::Make(const Vector<SharedPtr<ColumnDef>> &columns) {
+    ClusteringKey clustering_key;
+    Vector<Pair<i32, ColumnID>> key_columns;
+    for (SizeT column_id = 0; column_id < columns.size(); ++column_id) {
+        const ColumnDef &column_def = *columns[column_id];
+        if (column_def.clustering_key_idx_ >= 0) {
+            key_columns.emplace_back(column_def.clustering_key_idx_, column_id);
+            clustering_key.z_order_ = column_def.clustering_z_order_;
+        }
+    }
+    std::sort(key_columns.begin(), key_columns.end());
+    for (const auto &[key_idx, column_id] : key_columns) {
+        clustering_key.column_ids_.push_back(column_id);
+    }
+    return clustering_key;
+}
+
+bool ClusteringKey::SupportType(const DataType &data_type) {
+    switch (data_type.type()) {
+        case LogicalType::kBoolean:
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kDate:
+        case LogicalType::kTime:
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp:
+        case LogicalType::kVarchar: {
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+void ClusteringKey::AppendNormalizedKey(const ColumnVector &column_vector, SizeT row, String &key) {
+    if (column_vector.nulls_ptr_ != nullptr && !column_vector.nulls_ptr_->IsTrue(row)) {
+        key.push_back('\0');
+        return;
+    }
+    key.push_back('\1');
+    switch (column_vector.data_type()->type()) {
+        case LogicalType::kBoolean: {
+            key.push_back(column_vector.buffer_->GetCompactBit(row) ? '\1' : '\0');
+            break;
+        }
+        case LogicalType::kTinyInt: {
+            AppendSigned<TinyIntT>(column_vector, row, key);
+            break;
+        }
+        case LogicalType::kSmallInt: {
+            AppendSigned<SmallIntT>(column_vector, row, key);
+            break;
+        }
+        case LogicalType::kInteger:
+        case LogicalType::kDate:
+        case LogicalType::kTime: {
+            AppendSigned<IntegerT>(column_vector, row, key);
+            break;
+        }
+        case LogicalType::kBigInt: {
+            AppendSigned<BigIntT>(column_vector, row, key);
+            break;
+        }
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp: {
+            // date, then time
+            DateTimeT value{};
+            std::memcpy(&value, column_vector.data() + row * sizeof(DateTimeT), sizeof(DateTimeT));
+            AppendBigEndian(static_cast<u32>(value.date) ^ (u32(1) << 31), sizeof(u32), key);
+            AppendBigEndian(static_cast<u32>(value.time) ^ (u32(1) << 31), sizeof(u32), key);
+            break;
+        }
+        case LogicalType::kFloat: {
+            AppendFloat<FloatT, u32>(column_vector, row, key);
+            break;
+        }
+        case LogicalType::kDouble: {
+            AppendFloat<DoubleT, u64>(column_vector, row, key);
+            break;
+        }
+        case LogicalType::kVarchar: {
+            // Zero bytes are escaped, so that a string sorts before all of its extensions
+            Span<const char> value = column_vector.GetVarchar(row);
+            for (char c : value) {
+                key.push_back(c);
+                if (c == '\0') {
+                    key.push_back('\xFF');
+                }
+            }
+            key.push_back('\0');
+            key.push_back('\0');
+            break;
+        }
+        default: {
+            String error_message = fmt::format("Clustering key doesn't support {} column", column_vector.data_type()->ToString());
+            UnrecoverableError(error_message);
+        }
+    }
+}
+
+Vector<u32> ClusteringKey::SortRows(const Vector<Vector<String>> &column_keys) const {
+    if (column_keys.empty()) {
+        return {};
+    }
+    const SizeT row_count = column_keys[0].size();
+    Vector<u32> order(row_count);
+    std::iota(order.begin(), order.end(), 0);
+    if (!z_order_ || column_keys.size() == 1) {
+        std::stable_sort(order.begin(), order.end(), [&](u32 lhs, u32 rhs) {
+            for (const auto &keys : column_keys) {
+                if (int cmp = keys[lhs].compare(keys[rhs]); cmp != 0) {
+                    return cmp < 0;
+                }
+            }
+            return false;
+        });
+        return order;
+    }
+
+    // Z-order: each column contributes its value rank, scaled to the same number of bits, and the bits are interleaved.
+    // Ranks rather than raw values make the columns weigh the same whatever their value ranges are.
+    const SizeT dim = std::min<SizeT>(column_keys.size(), 64);
+    const u32 bits = 64 / dim;
+    Vector<Vector<u64>> scaled_ranks(dim, Vector<u64>(row_count));
+    Vector<u32> column_order(row_count);
+    for (SizeT d = 0; d < dim; ++d) {
+        const auto &keys = column_keys[d];
+        std::iota(column_order.begin(), column_order.end(), 0);
+        std::sort(column_order.begin(), column_order.end(), [&](u32 lhs, u32 rhs) { return keys[lhs] < keys[rhs]; });
+        Vector<u64> &ranks = scaled_ranks[d];
+        u64 rank = 0;
+        for (SizeT i = 0; i < row_count; ++i) {
+            if (i > 0 && keys[column_order[i]] != keys[column_order[i - 1]]) {
+                ++rank;
+            }
+            ranks[column_order[i]] = rank;
+        }
+        const u64 distinct_count = rank + 1;
+        for (u64 &r : ranks) {
+            r = static_cast<u64>((static_cast<unsigned __int128>(r) << bits) / distinct_count);
+        }
+    }
+    Vector<u64> z_values(row_count, 0);
+    for (SizeT row = 0; row < row_count; ++row) {
+        u64 z_value = 0;
+        for (u32 bit = bits; bit > 0; --bit) {
+            for (SizeT d = 0; d < dim; ++d) {
+                z_value = (z_value << 1) | ((scaled_ranks[d][row] >> (bit - 1)) & 1);
+            }
+        }
+        z_values[row] = z_value;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](u32 lhs, u32 rhs) { return z_values[lhs] < z_values[rhs]; });
+    return order;
+}
+
+} // namespace infinity
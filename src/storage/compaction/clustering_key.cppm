@@ -0,0 +1,54 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module clustering_key;
+
+import stl;
+import column_def;
+import data_type;
+import column_vector;
+import internal_types;
+
+namespace infinity {
+
+// Clustering key of a table, declared by the `clustering_key` table property.
+// Compaction writes the rows of the new segment in the order of the key, so that segments and blocks cover narrow min-max ranges of
+// the key columns. The key is either a sort order over its columns, or a Z-order which interleaves the ranks of the column values.
+export class ClusteringKey {
+public:
+    static ClusteringKey Make(const Vector<SharedPtr<ColumnDef>> &columns);
+
+    static bool SupportType(const DataType &data_type);
+
+    [[nodiscard]] bool Empty() const { return column_ids_.empty(); }
+
+    [[nodiscard]] const Vector<ColumnID> &column_ids() const { return column_ids_; }
+
+    [[nodiscard]] bool z_order() const { return z_order_; }
+
+    // Append a memcmp-comparable encoding of the value at `row` to `key`. Nulls come first.
+    static void AppendNormalizedKey(const ColumnVector &column_vector, SizeT row, String &key);
+
+    // Order of the rows, given the normalized keys of every key column: `column_keys[i][row]`.
+    // Rows with equal keys keep their original order.
+    [[nodiscard]] Vector<u32> SortRows(const Vector<Vector<String>> &column_keys) const;
+
+private:
+    Vector<ColumnID> column_ids_{};
+    bool z_order_{false};
+};
+
+} // namespace infinity
@@ -14,6 +14,7 @@
 
 module;
 
+#include <chrono>
 #include <thread>
 
 module compaction_process;
@@ -43,6 +44,9 @@ import base_memindex;
 import segment_index_entry;
 import status;
 import default_values;
+import config;
+import file_worker;
+import tensor_centroid_codes;
 
 namespace infinity {
 
@@ -51,6 +55,7 @@ CompactionProcessor::CompactionProcessor(Catalog *catalog, TxnManager *txn_mgr)
 void CompactionProcessor::Start() {
     LOG_INFO("Compaction processor is started.");
     processor_thread_ = Thread([this] { Process(); });
+    scrub_thread_ = Thread([this] { ScrubProcess(); });
 }
 
 void CompactionProcessor::Stop() {
@@ -59,12 +64,23 @@ void CompactionProcessor::Stop() {
     this->Submit(stop_task);
     stop_task->Wait();
     processor_thread_.join();
+    // A running scrub stops at the next file
+    scrub_stopped_ = true;
+    SharedPtr<StopProcessorTask> scrub_stop_task = MakeShared<StopProcessorTask>();
+    ++task_count_;
+    scrub_queue_.Enqueue(scrub_stop_task);
+    scrub_stop_task->Wait();
+    scrub_thread_.join();
     LOG_INFO("Compaction processor is stopped.");
 }
 
 void CompactionProcessor::Submit(SharedPtr<BGTask> bg_task) {
-    task_queue_.Enqueue(std::move(bg_task));
     ++task_count_;
+    if (bg_task->type_ == BGTaskType::kScrubTable) {
+        scrub_queue_.Enqueue(std::move(bg_task));
+        return;
+    }
+    task_queue_.Enqueue(std::move(bg_task));
 }
 
 void CompactionProcessor::DoCompact() {
@@ -214,6 +230,83 @@ void CompactionProcessor::DoDumpByline(DumpIndexBylineTask *dump_task) {
     }
 }
 
+void CompactionProcessor::DoScrub(ScrubTableTask *scrub_task) {
+    Config *config = InfinityContext::instance().config();
+    const i64 rate_limit = config != nullptr ? config->ScrubIORateLimit() : 0;
+    const auto scrub_begin = std::chrono::steady_clock::now();
+    // Sleep whenever the reads get ahead of the rate limit. Only the scrub thread sleeps, compaction and index dumps go on.
+    auto throttle = [&](SizeT read_bytes) {
+        scrub_task->checked_bytes_ += read_bytes;
+        if (rate_limit > 0 && !scrub_stopped_) {
+            auto due = scrub_begin + std::chrono::microseconds(scrub_task->checked_bytes_ * 1'000'000 / rate_limit);
+            std::this_thread::sleep_until(due);
+        }
+    };
+
+    for (const String &file_path : scrub_task->file_paths_) {
+        if (scrub_stopped_) {
+            LOG_INFO(fmt::format("Scrub table {}.{} is stopped: {} of {} files checked",
+                                 scrub_task->db_name_,
+                                 scrub_task->table_name_,
+                                 scrub_task->checked_file_count_,
+                                 scrub_task->file_paths_.size()));
+            return;
+        }
+        Status status;
+        try {
+            status = FileWorker::VerifyFile(file_path, throttle);
+            if (status.code() == ErrorCode::kDataCorrupted) {
+                // The file may have been rewritten while it was read
+                status = FileWorker::VerifyFile(file_path, throttle);
+            }
+        } catch (const RecoverableException &e) {
+            status = Status::DataIOError(e.what());
+        }
+        if (status.code() == ErrorCode::kFileNotFound) {
+            // Not flushed yet, or removed by compaction and cleanup
+            continue;
+        }
+        ++scrub_task->checked_file_count_;
+        if (!status.ok()) {
+            ++scrub_task->corrupted_file_count_;
+            LOG_ERROR(fmt::format("Scrub table {}.{}: {}", scrub_task->db_name_, scrub_task->table_name_, status.message()));
+        }
+    }
+    LOG_INFO(fmt::format("Scrub table {}.{} done: {} files, {} bytes checked, {} corrupted files",
+                         scrub_task->db_name_,
+                         scrub_task->table_name_,
+                         scrub_task->checked_file_count_,
+                         scrub_task->checked_bytes_,
+                         scrub_task->corrupted_file_count_));
+}
+
+void CompactionProcessor::DoBuildCentroidCodes(BuildCentroidCodesTask *build_task) {
+    // The txn keeps the segment from being cleaned up while it's read
+    Txn *txn = txn_mgr_->BeginTxn(MakeUnique<String>("BuildCentroidCodes"));
+    SharedPtr<SegmentEntry> segment_entry;
+    try {
+        auto [table_entry, status] = txn->GetTableByName(build_task->db_name_, build_task->table_name_);
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+        segment_entry = table_entry->GetSegmentByID(build_task->segment_id_, txn);
+        if (segment_entry.get() != nullptr) {
+            if (segment_entry->status() == SegmentStatus::kSealed) {
+                TensorCentroidCodes::BuildForSegment(segment_entry.get(), txn->buffer_mgr());
+            } else {
+                segment_entry->ResetBuildTensorCentroidCodes();
+            }
+        }
+        txn_mgr_->CommitTxn(txn);
+    } catch (const RecoverableException &e) {
+        if (segment_entry.get() != nullptr) {
+            segment_entry->ResetBuildTensorCentroidCodes();
+        }
+        txn_mgr_->RollBackTxn(txn);
+        LOG_WARN(fmt::format("{} failed: {}", build_task->ToString(), e.what()));
+    }
+}
+
 void CompactionProcessor::Process() {
     bool running = true;
     while (running) {
@@ -251,6 +344,12 @@ void CompactionProcessor::Process() {
                     LOG_DEBUG("Dump index byline done.");
                     break;
                 }
+                case BGTaskType::kBuildCentroidCodes: {
+                    auto build_task = static_cast<BuildCentroidCodesTask *>(bg_task.get());
+                    LOG_DEBUG(build_task->ToString());
+                    DoBuildCentroidCodes(build_task);
+                    break;
+                }
                 default: {
                     String error_message = fmt::format("Invalid background task: {}", (u8)bg_task->type_);
                     UnrecoverableError(error_message);
@@ -264,4 +363,34 @@ void CompactionProcessor::Process() {
     }
 }
 
+void CompactionProcessor::ScrubProcess() {
+    bool running = true;
+    while (running) {
+        Deque<SharedPtr<BGTask>> tasks;
+        scrub_queue_.DequeueBulk(tasks);
+        for (const auto &bg_task : tasks) {
+            switch (bg_task->type_) {
+                case BGTaskType::kStopProcessor: {
+                    running = false;
+                    break;
+                }
+                case BGTaskType::kScrubTable: {
+                    auto scrub_task = static_cast<ScrubTableTask *>(bg_task.get());
+                    LOG_DEBUG(scrub_task->ToString());
+                    DoScrub(scrub_task);
+                    break;
+                }
+                default: {
+                    String error_message = fmt::format("Invalid scrub task: {}", (u8)bg_task->type_);
+                    UnrecoverableError(error_message);
+                    break;
+                }
+            }
+            bg_task->Complete();
+        }
+        task_count_ -= tasks.size();
+        tasks.clear();
+    }
+}
+
 } // namespace infinity
\ No newline at end of file
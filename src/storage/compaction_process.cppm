@@ -56,13 +56,26 @@ private:
 
     void DoDumpByline(DumpIndexBylineTask *dump_task);
 
+    // Runs on the scrub thread, the IO rate limit sleeps don't hold back the other tasks
+    void DoScrub(ScrubTableTask *scrub_task);
+
+    void DoBuildCentroidCodes(BuildCentroidCodesTask *build_task);
+
     void Process();
 
+    void ScrubProcess();
+
 private:
     BlockingQueue<SharedPtr<BGTask>> task_queue_;
 
     Thread processor_thread_{};
 
+    BlockingQueue<SharedPtr<BGTask>> scrub_queue_;
+
+    Thread scrub_thread_{};
+
+    Atomic<bool> scrub_stopped_{false};
+
     Catalog *catalog_{};
     TxnManager *txn_mgr_{};
     SessionManager *session_mgr_{};
@@ -83,6 +83,58 @@ void DataBlock::Init(const SharedPtr<DataBlock> &input, SizeT start_idx, SizeT e
     this->Finalize();
 }
 
+void DataBlock::InitWithSelection(const DataBlock *input, SharedPtr<Selection> input_select) {
+    if (initialized) {
+        String error_message = "Data block was initialized before.";
+        UnrecoverableError(error_message);
+    }
+    if (input == nullptr || input_select.get() == nullptr || input->HasSelection()) {
+        String error_message = "Invalid input data block or select";
+        UnrecoverableError(error_message);
+    }
+    column_count_ = input->column_count();
+    column_vectors = input->column_vectors;
+    capacity_ = input->capacity();
+    row_count_ = input_select->Size();
+    selection_ = std::move(input_select);
+    initialized = true;
+    finalized = true;
+}
+
+void DataBlock::Compact() {
+    if (!HasSelection()) {
+        return;
+    }
+    for (SizeT idx = 0; idx < column_count_; ++idx) {
+        auto column_vector = MakeShared<ColumnVector>(column_vectors[idx]->data_type());
+        column_vector->Initialize(*column_vectors[idx], *selection_);
+        column_vectors[idx] = std::move(column_vector);
+    }
+    capacity_ = column_vectors[0]->capacity();
+    selection_.reset();
+}
+
+UniquePtr<DataBlock> DataBlock::CompactColumns(const Vector<SizeT> &column_ids) const {
+    if (!HasSelection()) {
+        String error_message = "Data block has no selection to compact.";
+        UnrecoverableError(error_message);
+    }
+    auto data_block = DataBlock::MakeUniquePtr();
+    data_block->column_count_ = column_count_;
+    data_block->column_vectors.reserve(column_count_);
+    for (SizeT idx = 0; idx < column_count_; ++idx) {
+        data_block->column_vectors.emplace_back(MakeShared<ColumnVector>(column_vectors[idx]->data_type()));
+    }
+    for (SizeT column_id : column_ids) {
+        data_block->column_vectors[column_id]->Initialize(*column_vectors[column_id], *selection_);
+    }
+    data_block->capacity_ = DEFAULT_VECTOR_SIZE;
+    data_block->row_count_ = row_count_;
+    data_block->initialized = true;
+    data_block->finalized = true;
+    return data_block;
+}
+
 SharedPtr<DataBlock> DataBlock::MoveFrom(SharedPtr<DataBlock> &input) {
     if (!input->Finalized()) {
         String error_message = "Input data block is not finalized.";
@@ -142,6 +194,7 @@ void DataBlock::UnInit() {
     }
 
     column_vectors.clear();
+    selection_.reset();
 
     row_count_ = 0;
     initialized = false;
@@ -157,6 +210,7 @@ void DataBlock::Reset() {
     // Reset behavior:
     // Reset each column into just initialized status.
     // No data is appended into any column.
+    selection_.reset();
 
     for (SizeT i = 0; i < column_count_; ++i) {
         ColumnVectorType old_vector_type = column_vectors[i]->vector_type();
@@ -188,7 +242,12 @@ void DataBlock::Reset(SizeT capacity) {
     finalized = false;
 }
 
-Value DataBlock::GetValue(SizeT column_index, SizeT row_index) const { return column_vectors[column_index]->GetValue(row_index); }
+Value DataBlock::GetValue(SizeT column_index, SizeT row_index) const {
+    if (HasSelection()) {
+        row_index = selection_->Get(row_index);
+    }
+    return column_vectors[column_index]->GetValue(row_index);
+}
 
 void DataBlock::SetValue(SizeT column_index, SizeT row_index, const Value &val) {
     if (column_index >= column_count_) {
@@ -314,6 +373,9 @@ void DataBlock::AppendWith(const DataBlock *other) {
     for (SizeT idx = 0; idx < column_count; ++idx) {
         this->column_vectors[idx]->AppendWith(*other->column_vectors[idx]);
     }
+    if (finalized) {
+        row_count_ += other->row_count_;
+    }
 }
 
 void DataBlock::AppendWith(const DataBlock *other, SizeT from, SizeT count) {
@@ -330,8 +392,35 @@ void DataBlock::AppendWith(const DataBlock *other, SizeT from, SizeT count) {
         UnrecoverableError(error_message);
     }
     SizeT column_count = this->column_count();
+    if (!other->HasSelection()) {
+        for (SizeT idx = 0; idx < column_count; ++idx) {
+            this->column_vectors[idx]->AppendWith(*other->column_vectors[idx], from, count);
+        }
+        if (finalized) {
+            row_count_ += count;
+        }
+        return;
+    }
+
+    // Copy the runs of consecutive selected rows
+    const Selection &selection = *other->selection_;
+    Vector<Pair<SizeT, SizeT>> row_ranges;
+    for (SizeT i = from; i < from + count;) {
+        SizeT begin = selection[i];
+        SizeT run = 1;
+        while (i + run < from + count && selection[i + run] == begin + run) {
+            ++run;
+        }
+        row_ranges.emplace_back(begin, run);
+        i += run;
+    }
     for (SizeT idx = 0; idx < column_count; ++idx) {
-        this->column_vectors[idx]->AppendWith(*other->column_vectors[idx], from, count);
+        for (const auto &[begin, run] : row_ranges) {
+            this->column_vectors[idx]->AppendWith(*other->column_vectors[idx], begin, run);
+        }
+    }
+    if (finalized) {
+        row_count_ += count;
     }
 }
 
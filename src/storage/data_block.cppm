@@ -44,6 +44,10 @@ public:
 
     void Init(const SharedPtr<DataBlock> &input, SizeT start_idx, SizeT end_idx);
 
+    // Share the column vectors of input, only the rows of input_select belong to this block.
+    // Such a block is only handed to the operators which read it through the selection (see PhysicalFilter).
+    void InitWithSelection(const DataBlock *input, SharedPtr<Selection> input_select);
+
     static SharedPtr<DataBlock> MoveFrom(SharedPtr<DataBlock> &input);
 
     void Init(const Vector<SharedPtr<DataType>> &types, SizeT capacity = DEFAULT_VECTOR_SIZE);
@@ -84,14 +88,22 @@ public:
 
     void AppendWith(const DataBlock *other);
 
+    // `from` and `count` refer to the selected rows if `other` has a selection
     void AppendWith(const DataBlock *other, SizeT from, SizeT count);
 
+    // Copy the selected rows into new column vectors, the block is dense afterwards.
+    void Compact();
+
+    // A dense block with the selected rows of the columns in `column_ids`, the other columns are left uninitialized.
+    // Used to evaluate the expressions reading a few columns of a block with selection.
+    UniquePtr<DataBlock> CompactColumns(const Vector<SizeT> &column_ids) const;
+
     void InsertVector(const SharedPtr<ColumnVector> &vector, SizeT index);
 
 public:
     [[nodiscard]] inline SizeT column_count() const { return column_count_; }
 
-    [[nodiscard]] inline u16 row_count() const {
+    [[nodiscard]] inline SizeT row_count() const {
         if (!finalized) {
             if (row_count_ == 0) {
                 return 0;
@@ -112,6 +124,10 @@ public:
         return types;
     }
 
+    [[nodiscard]] inline bool HasSelection() const { return selection_.get() != nullptr; }
+
+    [[nodiscard]] inline const SharedPtr<Selection> &selection() const { return selection_; }
+
     [[nodiscard]] inline SizeT capacity() const { return capacity_; }
     [[nodiscard]] inline SizeT available_capacity() const { return capacity_ - row_count_; }
 
@@ -128,7 +144,8 @@ public:
     Vector<SharedPtr<ColumnVector>> column_vectors;
 
 private:
-    u16 row_count_{0};
+    SharedPtr<Selection> selection_{}; // row_count_ rows of column_vectors, in order
+    SizeT row_count_{0};
     SizeT column_count_{0};
     SizeT capacity_{0};
     bool initialized = false;
@@ -38,7 +38,10 @@ ColumnIndexMerger::~ColumnIndexMerger() {}
 
 SharedPtr<PostingMerger> ColumnIndexMerger::CreatePostingMerger() { return MakeShared<PostingMerger>(flag_, column_lengths_); }
 
-void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<RowID> &base_rowids, const String &dst_base_name) {
+void ColumnIndexMerger::Merge(const Vector<String> &base_names,
+                              const Vector<RowID> &base_rowids,
+                              const String &dst_base_name,
+                              const Vector<Vector<docid_t>> *doc_id_maps) {
     assert(base_names.size() == base_rowids.size());
     if (base_rowids.empty()) {
         return;
@@ -78,7 +81,7 @@ void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<Row
     OstreamWriter wtr(ofs);
     FstBuilder fst_builder(wtr);
 
-    SegmentTermPostingQueue term_posting_queue(index_dir_, base_names, base_rowids, flag_);
+    SegmentTermPostingQueue term_posting_queue(index_dir_, base_names, base_rowids, flag_, doc_id_maps);
     String term;
     TermMeta term_meta;
     SizeT term_meta_offset = 0;
@@ -110,10 +113,27 @@ void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<Row
 
             const u32 file_size = fs_.GetFileSize(*file_handler);
             u32 file_read_array_len = file_size / sizeof(u32);
-            if (unsafe_column_lengths.size() < id_offset + file_read_array_len) {
-                unsafe_column_lengths.resize(id_offset + file_read_array_len);
+            i64 read_count = 0;
+            if (doc_id_maps == nullptr) {
+                if (unsafe_column_lengths.size() < id_offset + file_read_array_len) {
+                    unsafe_column_lengths.resize(id_offset + file_read_array_len);
+                }
+                read_count = fs_.Read(*file_handler, unsafe_column_lengths.data() + id_offset, file_size);
+            } else {
+                const Vector<docid_t> &doc_id_map = (*doc_id_maps)[i];
+                Vector<u32> column_lengths(file_read_array_len);
+                read_count = fs_.Read(*file_handler, column_lengths.data(), file_size);
+                for (u32 doc_id = 0; doc_id < std::min<SizeT>(file_read_array_len, doc_id_map.size()); ++doc_id) {
+                    docid_t new_doc_id = doc_id_map[doc_id];
+                    if (new_doc_id == INVALID_DOCID) {
+                        continue;
+                    }
+                    if (unsafe_column_lengths.size() <= new_doc_id) {
+                        unsafe_column_lengths.resize(new_doc_id + 1);
+                    }
+                    unsafe_column_lengths[new_doc_id] = column_lengths[doc_id];
+                }
             }
-            const i64 read_count = fs_.Read(*file_handler, unsafe_column_lengths.data() + id_offset, file_size);
             file_handler->Close();
             if (read_count != file_size) {
                 String error_message = "ColumnIndexMerger: when loading column length file, read_count != file_size";
@@ -137,12 +157,12 @@ void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<Row
     while (!term_posting_queue.Empty()) {
         const Vector<SegmentTermPosting *> &merging_term_postings = term_posting_queue.GetCurrentMerging(term);
 
-        MergeTerm(term, term_meta, merging_term_postings, merge_base_rowid);
+        if (MergeTerm(term, term_meta, merging_term_postings, merge_base_rowid)) {
+            term_meta_dumpler.Dump(dict_file_writer, term_meta);
 
-        term_meta_dumpler.Dump(dict_file_writer, term_meta);
-
-        fst_builder.Insert((u8 *)term.c_str(), term.length(), term_meta_offset);
-        term_meta_offset = dict_file_writer->TotalWrittenBytes();
+            fst_builder.Insert((u8 *)term.c_str(), term.length(), term_meta_offset);
+            term_meta_offset = dict_file_writer->TotalWrittenBytes();
+        }
         term_posting_queue.MoveToNextTerm();
     }
     dict_file_writer->Sync();
@@ -152,14 +172,26 @@ void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<Row
     fs_.DeleteFile(fst_file);
 }
 
-void ColumnIndexMerger::MergeTerm(const String &term,
+bool ColumnIndexMerger::MergeTerm(const String &term,
                                   TermMeta &term_meta,
                                   const Vector<SegmentTermPosting *> &merging_term_postings,
                                   const RowID &merge_base_rowid) {
     SharedPtr<PostingMerger> posting_merger = CreatePostingMerger();
     posting_merger->Merge(merging_term_postings, merge_base_rowid);
+    if (posting_merger->GetDF() == 0) {
+        return false;
+    }
 
     posting_merger->Dump(posting_file_writer_, term_meta);
+    return true;
+}
+
+u64 ColumnIndexMerger::ColumnLengthSum() {
+    u64 column_length_sum = 0;
+    for (u32 column_length : column_lengths_.UnsafeVec()) {
+        column_length_sum += column_length;
+    }
+    return column_length_sum;
 }
 
 } // namespace infinity
\ No newline at end of file
@@ -23,12 +23,22 @@ public:
     ColumnIndexMerger(const String &index_dir, optionflag_t flag);
     ~ColumnIndexMerger();
 
-    void Merge(const Vector<String> &base_names, const Vector<RowID> &base_rowids, const String &dst_base_name);
+    // Merge the chunks `base_names` into the chunk `dst_base_name`, whose base row id is the smallest of `base_rowids`.
+    // If `doc_id_maps` is given, `(*doc_id_maps)[i][doc_id]` is the doc id in the merged chunk of doc `doc_id` of chunk i, or INVALID_DOCID
+    // if the doc is dropped. The maps must keep the order of the chunks by `base_rowids`, and the order of the docs in each chunk.
+    void Merge(const Vector<String> &base_names,
+               const Vector<RowID> &base_rowids,
+               const String &dst_base_name,
+               const Vector<Vector<docid_t>> *doc_id_maps = nullptr);
+
+    // Sum of the column lengths of the merged chunk
+    u64 ColumnLengthSum();
 
 private:
     SharedPtr<PostingMerger> CreatePostingMerger();
 
-    void MergeTerm(const String &term, TermMeta &term_meta, const Vector<SegmentTermPosting *> &merging_term_postings, const RowID &merge_base_rowid);
+    // Return false if no doc of the term is left
+    bool MergeTerm(const String &term, TermMeta &term_meta, const Vector<SegmentTermPosting *> &merging_term_postings, const RowID &merge_base_rowid);
 
     String index_dir_;
     optionflag_t flag_;
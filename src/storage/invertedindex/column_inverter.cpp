@@ -82,10 +82,13 @@ SizeT ColumnInverter::InvertColumn(SharedPtr<ColumnVector> column_vector, u32 ro
 }
 
 SizeT ColumnInverter::InvertColumn(u32 doc_id, const String &val) {
-    auto terms_once_ = MakeUnique<TermList>();
-    analyzer_->Analyze(val, *terms_once_);
-    SizeT term_count = terms_once_->size();
-    terms_per_doc_.push_back(Pair<u32, UniquePtr<TermList>>(doc_id, std::move(terms_once_)));
+    // Terms are copied straight into terms_, without building a TermList per document
+    SizeT term_count = 0;
+    analyzer_->Analyze(val, [&](const char *text, u32 len, u32 offset) {
+        u32 term_ref = AddTerm(StringRef(text, len));
+        positions_.emplace_back(term_ref, doc_id, offset);
+        ++term_count;
+    });
     return term_count;
 }
 
@@ -105,41 +108,30 @@ u32 ColumnInverter::AddTerm(StringRef term) {
     return term_ref;
 }
 
-void ColumnInverter::MergePrepare() {
-    for (auto &doc_terms : terms_per_doc_) {
-        u32 doc_id = doc_terms.first;
-        auto &terms_once = doc_terms.second;
-        for (auto it = terms_once->begin(); it != terms_once->end(); ++it) {
-            StringRef term(it->text_);
-            u32 term_ref = AddTerm(term);
-            positions_.emplace_back(term_ref, doc_id, it->word_offset_);
-        }
-    }
-    terms_per_doc_.clear();
-}
-
 void ColumnInverter::Merge(ColumnInverter &rhs) {
     assert(begin_doc_id_ + doc_count_ <= rhs.begin_doc_id_);
-    MergePrepare();
-    for (auto &doc_terms : rhs.terms_per_doc_) {
-        u32 doc_id = doc_terms.first;
-        auto &terms_once = doc_terms.second;
-        for (auto it = terms_once->begin(); it != terms_once->end(); ++it) {
-            StringRef term(it->text_);
-            u32 term_ref = AddTerm(term);
-            positions_.emplace_back(term_ref, doc_id, it->word_offset_);
-        }
+    // terms_ is padded to 4 bytes, so the term refs of rhs are shifted by the size of terms_ in u32
+    const u32 term_ref_base = terms_.size() >> 2;
+    terms_.insert(terms_.end(), rhs.terms_.begin(), rhs.terms_.end());
+    term_refs_.reserve(term_refs_.size() + rhs.term_refs_.size());
+    for (u32 term_ref : rhs.term_refs_) {
+        term_refs_.push_back(term_ref + term_ref_base);
+    }
+    positions_.reserve(positions_.size() + rhs.positions_.size());
+    for (const PosInfo &pos_info : rhs.positions_) {
+        positions_.emplace_back(pos_info.term_num_ + term_ref_base, pos_info.doc_id_, pos_info.term_pos_);
     }
     doc_count_ += rhs.doc_count_;
     merged_++;
-    rhs.terms_per_doc_.clear();
+    rhs.terms_.clear();
+    rhs.term_refs_.clear();
+    rhs.positions_.clear();
     rhs.doc_count_ = 0;
     rhs.merged_ = 0;
 }
 
 void ColumnInverter::Merge(Vector<SharedPtr<ColumnInverter>> &inverters) {
     assert(!inverters.empty());
-    inverters[0]->MergePrepare();
     SizeT end = inverters.size();
     for (SizeT i = 1; i < end; i++) {
         SharedPtr<ColumnInverter> &rhs = inverters[i];
@@ -217,7 +209,7 @@ void ColumnInverter::GeneratePosting() {
                 // printf(" EndDocument1-%u\n", last_doc_id);
             }
             term = GetTermFromNum(i.term_num_);
-            posting = posting_writer_provider_(String(term.data()));
+            posting = posting_writer_provider_(std::string_view(term.data(), term.size()));
             // printf("\nswitched-term-%d-<%s>\n", i.term_num_, term.data());
             if (last_term_num != (u32)(-1)) {
                 assert(last_term_num < i.term_num_);
@@ -244,10 +236,7 @@ void ColumnInverter::GeneratePosting() {
     // printf("GeneratePosting() end begin_doc_id_ %u, doc_count_ %u, merged_ %u", begin_doc_id_, doc_count_, merged_);
 }
 
-void ColumnInverter::SortForOfflineDump() {
-    MergePrepare();
-    Sort();
-}
+void ColumnInverter::SortForOfflineDump() { Sort(); }
 
 /// Layout of the input of external sort file
 //    +-----------+  +----------------++--------------------++--------------------------++-------------------------------------------------------+
@@ -111,8 +111,6 @@ private:
 
     void SortTerms();
 
-    void MergePrepare();
-
     UniquePtr<Analyzer> analyzer_{nullptr};
     u32 begin_doc_id_{0};
     u32 doc_count_{0};
@@ -120,7 +118,6 @@ private:
     TermBuffer terms_;
     PosInfoVec positions_;
     U32Vec term_refs_;
-    Vector<Pair<u32, UniquePtr<TermList>>> terms_per_doc_;
     PostingWriterProvider posting_writer_provider_{};
     VectorWithLock<u32> &column_lengths_;
 };
@@ -0,0 +1,135 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module term_dictionary;
+import stl;
+
+namespace infinity {
+
+// Concurrent term -> value dictionary of a MemoryIndexer.
+// Terms are spread over independently locked hash shards, so writers and readers of different terms rarely contend.
+// Each shard interns its terms in an append-only arena, and keys are views into it: a new term costs one copy into the
+// arena instead of a heap String. Ordered iteration is only offered as a sorted snapshot for dumping.
+export template <typename ValueType>
+class TermDictionary {
+private:
+    static constexpr SizeT SHARD_COUNT = 64;
+    static constexpr SizeT ARENA_CHUNK_SIZE = 64 * 1024;
+
+    struct alignas(64) Shard {
+        std::shared_mutex mutex_;
+        HashMap<std::string_view, ValueType> map_;
+        Vector<UniquePtr<char[]>> arena_chunks_;
+        Vector<UniquePtr<char[]>> large_terms_;
+        SizeT arena_used_{ARENA_CHUNK_SIZE};
+
+        // Copy the term into the arena. Caller shall hold the unique lock.
+        std::string_view Intern(std::string_view term) {
+            if (term.size() > ARENA_CHUNK_SIZE / 4) {
+                // Long terms get their own allocation so that they don't waste the rest of the current chunk
+                auto &large_term = large_terms_.emplace_back(MakeUnique<char[]>(term.size()));
+                std::memcpy(large_term.get(), term.data(), term.size());
+                return std::string_view(large_term.get(), term.size());
+            }
+            if (arena_used_ + term.size() > ARENA_CHUNK_SIZE) {
+                arena_chunks_.emplace_back(MakeUnique<char[]>(ARENA_CHUNK_SIZE));
+                arena_used_ = 0;
+            }
+            char *dst = arena_chunks_.back().get() + arena_used_;
+            std::memcpy(dst, term.data(), term.size());
+            arena_used_ += term.size();
+            return std::string_view(dst, term.size());
+        }
+    };
+
+    Array<Shard, SHARD_COUNT> shards_;
+
+    static SizeT ShardIdx(std::string_view term) { return std::hash<std::string_view>{}(term) % SHARD_COUNT; }
+
+public:
+    TermDictionary() = default;
+
+    ~TermDictionary() = default;
+
+    bool Get(std::string_view term, ValueType &value) {
+        Shard &shard = shards_[ShardIdx(term)];
+        std::shared_lock<std::shared_mutex> lock(shard.mutex_);
+        auto it = shard.map_.find(term);
+        if (it == shard.map_.end()) {
+            return false;
+        }
+        value = it->second;
+        return true;
+    }
+
+    // Get or add a value to the dictionary.
+    // Returns true if found.
+    // Returns false if not found, and add the term with the value returned by `new_value_fn` into the dictionary.
+    template <typename Fn>
+    bool GetOrAdd(std::string_view term, ValueType &value, Fn &&new_value_fn) {
+        Shard &shard = shards_[ShardIdx(term)];
+        {
+            // Most terms of a batch already exist, look them up under the shared lock first
+            std::shared_lock<std::shared_mutex> lock(shard.mutex_);
+            auto it = shard.map_.find(term);
+            if (it != shard.map_.end()) {
+                value = it->second;
+                return true;
+            }
+        }
+        std::unique_lock<std::shared_mutex> lock(shard.mutex_);
+        auto it = shard.map_.find(term);
+        if (it != shard.map_.end()) {
+            value = it->second;
+            return true;
+        }
+        value = new_value_fn();
+        shard.map_.emplace(shard.Intern(term), value);
+        return false;
+    }
+
+    void Clear() {
+        for (Shard &shard : shards_) {
+            std::unique_lock<std::shared_mutex> lock(shard.mutex_);
+            shard.map_.clear();
+            shard.arena_chunks_.clear();
+            shard.large_terms_.clear();
+            shard.arena_used_ = ARENA_CHUNK_SIZE;
+        }
+    }
+
+    SizeT Size() {
+        SizeT size = 0;
+        for (Shard &shard : shards_) {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex_);
+            size += shard.map_.size();
+        }
+        return size;
+    }
+
+    // Snapshot of all terms in ascending order. The views stay valid until Clear().
+    Vector<Pair<std::string_view, ValueType>> SortedItems() {
+        Vector<Pair<std::string_view, ValueType>> items;
+        for (Shard &shard : shards_) {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex_);
+            items.insert(items.end(), shard.map_.begin(), shard.map_.end());
+        }
+        std::sort(items.begin(), items.end(), [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+        return items;
+    }
+};
+
+} // namespace infinity
@@ -81,7 +81,6 @@ MemoryIndexer::MemoryIndexer(const String &index_dir, const String &base_name, R
       commiting_thread_pool_(infinity::InfinityContext::instance().GetFulltextCommitingThreadPool()), ring_inverted_(15UL), ring_sorted_(13UL) {
     assert(std::filesystem::path(index_dir).is_absolute());
     posting_table_ = MakeShared<PostingTable>();
-    prepared_posting_ = MakeShared<PostingWriter>(posting_format_, column_lengths_);
     Path path = Path(index_dir) / (base_name + ".tmp.merge");
     spill_full_path_ = path.string();
 }
@@ -133,7 +132,7 @@ void MemoryIndexer::Insert(SharedPtr<ColumnVector> column_vector, u32 row_offset
         };
         inverting_thread_pool_.push(std::move(func));
     } else {
-        PostingWriterProvider provider = [this](const String &term) -> SharedPtr<PostingWriter> { return GetOrAddPosting(term); };
+        PostingWriterProvider provider = [this](std::string_view term) -> SharedPtr<PostingWriter> { return GetOrAddPosting(term); };
         auto inverter = MakeShared<ColumnInverter>(provider, column_lengths_);
         inverter->InitAnalyzer(this->analyzer_);
         auto func = [this, task, inverter](int id) {
@@ -288,14 +287,13 @@ void MemoryIndexer::Dump(bool offline, bool spill) {
     }
     if (posting_table_.get() != nullptr) {
         MemoryIndexer::PostingTableStore &posting_store = posting_table_->store_;
-        for (auto it = posting_store.UnsafeBegin(); it != posting_store.UnsafeEnd(); ++it) {
-            const MemoryIndexer::PostingPtr posting_writer = it->second;
+        // Terms shall be dumped in ascending order for the fst
+        for (const auto &[term, posting_writer] : posting_store.SortedItems()) {
             TermMeta term_meta(posting_writer->GetDF(), posting_writer->GetTotalTF());
             posting_writer->Dump(posting_file_writer, term_meta, spill);
             SizeT term_meta_offset = dict_file_writer->TotalWrittenBytes();
             term_meta_dumpler.Dump(dict_file_writer, term_meta);
-            const String &term = it->first;
-            fst_builder.Insert((u8 *)term.c_str(), term.length(), term_meta_offset);
+            fst_builder.Insert((u8 *)term.data(), term.length(), term_meta_offset);
         }
         posting_file_writer->Sync();
         dict_file_writer->Sync();
@@ -371,14 +369,11 @@ void MemoryIndexer::Load() {
     is_spilled_ = false;
 }
 
-SharedPtr<PostingWriter> MemoryIndexer::GetOrAddPosting(const String &term) {
+SharedPtr<PostingWriter> MemoryIndexer::GetOrAddPosting(std::string_view term) {
     assert(posting_table_.get() != nullptr);
     MemoryIndexer::PostingTableStore &posting_store = posting_table_->store_;
     PostingPtr posting;
-    bool found = posting_store.GetOrAdd(term, posting, prepared_posting_);
-    if (!found) {
-        prepared_posting_ = MakeShared<PostingWriter>(posting_format_, column_lengths_);
-    }
+    posting_store.GetOrAdd(term, posting, [this]() { return MakeShared<PostingWriter>(posting_format_, column_lengths_); });
     return posting;
 }
 
@@ -28,7 +28,7 @@ import internal_types;
 import ring;
 import skiplist;
 import internal_types;
-import map_with_lock;
+import term_dictionary;
 import vector_with_lock;
 import buf_writer;
 import posting_list_format;
@@ -45,7 +45,7 @@ public:
 
     using PostingPtr = SharedPtr<PostingWriter>;
     // using PostingTableStore = SkipList<String, PostingPtr, KeyComp>;
-    using PostingTableStore = MapWithLock<String, PostingPtr>;
+    using PostingTableStore = TermDictionary<PostingPtr>;
 
     struct PostingTable {
         PostingTable();
@@ -99,7 +99,7 @@ public:
 
     SharedPtr<PostingTable> GetPostingTable() { return posting_table_; }
 
-    SharedPtr<PostingWriter> GetOrAddPosting(const String &term);
+    SharedPtr<PostingWriter> GetOrAddPosting(std::string_view term);
 
     void Reset();
 
@@ -130,7 +130,6 @@ private:
     ThreadPool &commiting_thread_pool_;
     u32 doc_count_{0};
     SharedPtr<PostingTable> posting_table_;
-    PostingPtr prepared_posting_{nullptr};
     Ring<SharedPtr<ColumnInverter>> ring_inverted_;
     Ring<SharedPtr<ColumnInverter>> ring_sorted_;
     u64 seq_inserted_{0};
@@ -141,8 +141,11 @@ private:
 
 class SortedPosting {
 public:
-    SortedPosting(const PostingFormatOption &format_option, docid_t base_doc_id, PostingDecoder *posting_decoder)
-        : format_option_(format_option), base_doc_id_(base_doc_id), doc_merger_(format_option, posting_decoder) {}
+    SortedPosting(const PostingFormatOption &format_option,
+                  docid_t base_doc_id,
+                  PostingDecoder *posting_decoder,
+                  const Vector<docid_t> *doc_id_map = nullptr)
+        : format_option_(format_option), base_doc_id_(base_doc_id), doc_id_map_(doc_id_map), doc_merger_(format_option, posting_decoder) {}
     ~SortedPosting() {}
 
     bool Next() {
@@ -158,6 +161,16 @@ public:
             doc_merger_.Merge(INVALID_DOCID, nullptr);
             return;
         }
+        if (doc_id_map_ != nullptr) {
+            // Docs which are not mapped are dropped, their positions are skipped
+            docid_t doc_id = (*doc_id_map_)[current_doc_id_];
+            if (doc_id == INVALID_DOCID) {
+                doc_merger_.Merge(INVALID_DOCID, nullptr);
+                return;
+            }
+            doc_merger_.Merge(doc_id, pos_dumper->GetPostingWriter().get());
+            return;
+        }
         SharedPtr<PostingWriter> posting_writer = pos_dumper->GetPostingWriter();
         doc_merger_.Merge(base_doc_id_ + current_doc_id_, posting_writer.get());
     }
@@ -165,6 +178,7 @@ public:
 private:
     PostingFormatOption format_option_;
     docid_t base_doc_id_{0};
+    const Vector<docid_t> *doc_id_map_{nullptr};
     docid_t current_doc_id_{INVALID_DOCID};
     DocMerger doc_merger_;
 };
@@ -183,7 +197,7 @@ void PostingMerger::Merge(const Vector<SegmentTermPosting *>& segment_term_posti
         RowID base_row_id = term_posting->GetBaseRowId();
         u32 base_doc_id = base_row_id - merge_base_rowid;
         PostingDecoder *decoder = term_posting->GetPostingDecoder();
-        SortedPosting sorted_posting(posting_format_.GetOption(), base_doc_id, decoder);
+        SortedPosting sorted_posting(posting_format_.GetOption(), base_doc_id, decoder, term_posting->GetDocIdMap());
         while (sorted_posting.Next()) {
             sorted_posting.Merge(posting_dumper_);
         }
@@ -55,6 +55,6 @@ private:
     VectorWithLock<u32> &column_lengths_;
 };
 
-export using PostingWriterProvider = std::function<SharedPtr<PostingWriter>(const String &)>;
+export using PostingWriterProvider = std::function<SharedPtr<PostingWriter>(std::string_view)>;
 
 } // namespace infinity
\ No newline at end of file
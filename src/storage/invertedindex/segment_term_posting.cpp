@@ -11,8 +11,12 @@ import column_index_iterator;
 
 namespace infinity {
 
-SegmentTermPosting::SegmentTermPosting(const String &index_dir, const String &base_name, RowID base_row_id, optionflag_t flag)
-    : base_row_id_(base_row_id) {
+SegmentTermPosting::SegmentTermPosting(const String &index_dir,
+                                       const String &base_name,
+                                       RowID base_row_id,
+                                       optionflag_t flag,
+                                       const Vector<docid_t> *doc_id_map)
+    : base_row_id_(base_row_id), doc_id_map_(doc_id_map) {
     column_index_iterator_ = MakeShared<ColumnIndexIterator>(index_dir, base_name, flag);
 }
 
@@ -26,10 +30,12 @@ bool SegmentTermPosting::HasNext() {
 SegmentTermPostingQueue::SegmentTermPostingQueue(const String &index_dir,
                                                  const Vector<String> &base_names,
                                                  const Vector<RowID> &base_rowids,
-                                                 optionflag_t flag)
+                                                 optionflag_t flag,
+                                                 const Vector<Vector<docid_t>> *doc_id_maps)
     : index_dir_(index_dir), base_names_(base_names), base_rowids_(base_rowids) {
     for (u32 i = 0; i < base_names.size(); ++i) {
-        SegmentTermPosting *segment_term_posting = new SegmentTermPosting(index_dir, base_names[i], base_rowids[i], flag);
+        const Vector<docid_t> *doc_id_map = doc_id_maps != nullptr ? &(*doc_id_maps)[i] : nullptr;
+        SegmentTermPosting *segment_term_posting = new SegmentTermPosting(index_dir, base_names[i], base_rowids[i], flag, doc_id_map);
         if (segment_term_posting->HasNext()) {
             segment_term_postings_.push(segment_term_posting);
         } else
@@ -17,16 +17,23 @@ export class SegmentTermPosting {
 public:
     SegmentTermPosting();
 
-    SegmentTermPosting(const String &index_dir, const String &base_name, RowID base_row_id, optionflag_t flag);
+    SegmentTermPosting(const String &index_dir,
+                       const String &base_name,
+                       RowID base_row_id,
+                       optionflag_t flag,
+                       const Vector<docid_t> *doc_id_map = nullptr);
 
     RowID GetBaseRowId() const { return base_row_id_; }
 
+    const Vector<docid_t> *GetDocIdMap() const { return doc_id_map_; }
+
     bool HasNext();
 
     PostingDecoder *GetPostingDecoder() { return posting_decoder_; }
 
 public:
     RowID base_row_id_{};
+    const Vector<docid_t> *doc_id_map_{nullptr};
     String term_{};
     PostingDecoder *posting_decoder_{nullptr};
     SharedPtr<ColumnIndexIterator> column_index_iterator_{};
@@ -44,7 +51,11 @@ public:
 
 export class SegmentTermPostingQueue {
 public:
-    SegmentTermPostingQueue(const String &index_dir, const Vector<String> &base_names, const Vector<RowID> &base_rowids, optionflag_t flag);
+    SegmentTermPostingQueue(const String &index_dir,
+                            const Vector<String> &base_names,
+                            const Vector<RowID> &base_rowids,
+                            optionflag_t flag,
+                            const Vector<Vector<docid_t>> *doc_id_maps = nullptr);
 
     ~SegmentTermPostingQueue();
 
@@ -45,6 +45,18 @@ public:
 public:
     FileSystem &file_system_;
     Path path_;
+
+    // Running CRC32C of the bytes appended by Write() while `write_checksum_` is set. A seek or a positioned write clears
+    // the flag, as the bytes written are no longer the file content in order.
+    bool write_checksum_{false};
+    u32 write_crc_{0};
+    u64 write_crc_size_{0};
+
+    // Running CRC32C of the bytes returned by Read() while `read_checksum_` is set. A seek clears the flag, as the bytes
+    // read are no longer the file content in order.
+    bool read_checksum_{false};
+    u32 read_crc_{0};
+    u64 read_crc_size_{0};
 };
 
 class FileSystem {
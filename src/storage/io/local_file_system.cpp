@@ -31,6 +31,7 @@ import infinity_exception;
 import third_party;
 import logger;
 import status;
+import crc;
 
 module local_file_system;
 
@@ -156,6 +157,10 @@ i64 LocalFileSystem::Read(FileHandler &file_handler, void *data, u64 nbytes) {
         }
         readen += read_count;
     }
+    if (file_handler.read_checksum_) {
+        file_handler.read_crc_ = CRC32C::Extend(file_handler.read_crc_, data, readen);
+        file_handler.read_crc_size_ += readen;
+    }
     return readen;
 }
 
@@ -170,6 +175,10 @@ i64 LocalFileSystem::Write(FileHandler &file_handler, const void *data, u64 nbyt
         }
         written += write_count;
     }
+    if (file_handler.write_checksum_) {
+        file_handler.write_crc_ = CRC32C::Extend(file_handler.write_crc_, data, written);
+        file_handler.write_crc_size_ += written;
+    }
     return written;
 }
 
@@ -192,6 +201,7 @@ i64 LocalFileSystem::ReadAt(FileHandler &file_handler, i64 file_offset, void *da
 
 i64 LocalFileSystem::WriteAt(FileHandler &file_handler, i64 file_offset, const void *data, u64 nbytes) {
     i32 fd = ((LocalFileHandler &)file_handler).fd_;
+    file_handler.write_checksum_ = false;
     i64 written = 0;
     while (written < (i64)nbytes) {
         i64 write_count = pwrite(fd, (char *)data + written, nbytes - written, file_offset + written);
@@ -206,6 +216,8 @@ i64 LocalFileSystem::WriteAt(FileHandler &file_handler, i64 file_offset, const v
 
 void LocalFileSystem::Seek(FileHandler &file_handler, i64 pos) {
     i32 fd = ((LocalFileHandler &)file_handler).fd_;
+    file_handler.write_checksum_ = false;
+    file_handler.read_checksum_ = false;
     if ((off_t)-1 == lseek(fd, pos, SEEK_SET)) {
         String error_message = fmt::format("Can't seek file: {}: {}", file_handler.path_.string(), strerror(errno));
         UnrecoverableError(error_message);
@@ -0,0 +1,354 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <ranges>
+
+module tensor_centroid_codes;
+
+import stl;
+import internal_types;
+import logical_type;
+import data_type;
+import type_info;
+import embedding_info;
+import column_def;
+import column_vector;
+import segment_entry;
+import table_entry;
+import infinity_context;
+import storage;
+import compaction_process;
+import bg_task;
+import block_entry;
+import block_column_entry;
+import buffer_manager;
+import default_values;
+import kmeans_partition;
+import index_base;
+import mlas_matrix_multiply;
+import simd_functions;
+import infinity_exception;
+import third_party;
+import logger;
+
+namespace infinity {
+
+namespace {
+
+// Every tensor of the first `row_count` rows of the segment, in the order of the segment offsets
+template <typename Func>
+void ForEachTensor(const Vector<SharedPtr<BlockEntry>> &block_entries, ColumnID column_id, u32 row_count, BufferManager *buffer_mgr, Func &&func) {
+    for (u32 block_start = 0; block_start < row_count; block_start += DEFAULT_BLOCK_CAPACITY) {
+        const BlockID block_id = block_start / DEFAULT_BLOCK_CAPACITY;
+        const u32 block_row_count = std::min<u32>(row_count - block_start, DEFAULT_BLOCK_CAPACITY);
+        ColumnVector column_vector = block_entries[block_id]->GetColumnBlockEntry(column_id)->GetConstColumnVector(buffer_mgr);
+        for (u32 block_offset = 0; block_offset < block_row_count; ++block_offset) {
+            const auto [raw_data, embedding_num] = column_vector.GetTensorRaw(block_offset);
+            func(block_start + block_offset, raw_data.data(), static_cast<u32>(embedding_num));
+        }
+    }
+}
+
+template <typename ElemT>
+void CastToF32(const char *raw_data, SizeT elem_count, f32 *output) {
+    const auto *src = reinterpret_cast<const ElemT *>(raw_data);
+    for (SizeT i = 0; i < elem_count; ++i) {
+        output[i] = static_cast<f32>(src[i]);
+    }
+}
+
+// Embeddings of `embedding_num` x `dimension` elements of `type` to f32, bits are 0 or 1
+void EmbeddingsToF32(const char *raw_data, EmbeddingDataType type, u32 embedding_num, u32 dimension, f32 *output) {
+    const SizeT elem_count = SizeT(embedding_num) * dimension;
+    switch (type) {
+        case EmbeddingDataType::kElemBit: {
+            const auto *bits = reinterpret_cast<const u8 *>(raw_data);
+            for (SizeT i = 0; i < elem_count; ++i) {
+                output[i] = static_cast<f32>((bits[i / 8] >> (i % 8)) & 1u);
+            }
+            break;
+        }
+        case EmbeddingDataType::kElemFloat: {
+            std::memcpy(output, raw_data, elem_count * sizeof(f32));
+            break;
+        }
+        case EmbeddingDataType::kElemDouble: {
+            CastToF32<f64>(raw_data, elem_count, output);
+            break;
+        }
+        case EmbeddingDataType::kElemFloat16: {
+            CastToF32<Float16T>(raw_data, elem_count, output);
+            break;
+        }
+        case EmbeddingDataType::kElemBFloat16: {
+            CastToF32<BFloat16T>(raw_data, elem_count, output);
+            break;
+        }
+        case EmbeddingDataType::kElemInt32: {
+            CastToF32<i32>(raw_data, elem_count, output);
+            break;
+        }
+        case EmbeddingDataType::kElemInt64: {
+            CastToF32<i64>(raw_data, elem_count, output);
+            break;
+        }
+        default: {
+            String error_message = fmt::format("Centroid codes don't support {} embeddings", EmbeddingInfo::EmbeddingDataTypeToString(type));
+            UnrecoverableError(error_message);
+        }
+    }
+}
+
+} // namespace
+
+Atomic<SizeT> TensorCentroidCodes::total_memory_usage_{0};
+
+Atomic<SizeT> TensorCentroidCodes::memory_limit_{DEFAULT_TENSOR_CENTROID_CODES_MEMORY_LIMIT};
+
+TensorCentroidCodes::~TensorCentroidCodes() { total_memory_usage_.fetch_sub(reserved_memory_); }
+
+bool TensorCentroidCodes::ReserveMemory(SizeT memory_usage) {
+    SizeT total = total_memory_usage_.load();
+    do {
+        if (total + memory_usage > memory_limit_.load()) {
+            return false;
+        }
+    } while (!total_memory_usage_.compare_exchange_weak(total, total + memory_usage));
+    reserved_memory_ = memory_usage;
+    return true;
+}
+
+bool TensorCentroidCodes::SupportType(EmbeddingDataType column_type) {
+    switch (column_type) {
+        case EmbeddingDataType::kElemBit:
+        case EmbeddingDataType::kElemFloat:
+        case EmbeddingDataType::kElemDouble:
+        case EmbeddingDataType::kElemFloat16:
+        case EmbeddingDataType::kElemBFloat16: {
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+bool TensorCentroidCodes::SupportColumn(const ColumnDef *column_def) {
+    const auto &column_type = column_def->type();
+    return column_type->type() == LogicalType::kTensor &&
+           SupportType(static_cast<const EmbeddingInfo *>(column_type->type_info().get())->Type());
+}
+
+SharedPtr<TensorCentroidCodes> TensorCentroidCodes::Make(const SegmentEntry *segment_entry, const ColumnDef *column_def, BufferManager *buffer_mgr) {
+    if (!SupportColumn(column_def)) {
+        return nullptr;
+    }
+    const auto time_0 = std::chrono::high_resolution_clock::now();
+    const auto *embedding_info = static_cast<const EmbeddingInfo *>(column_def->type()->type_info().get());
+    const ColumnID column_id = column_def->id();
+    const u32 row_count = segment_entry->row_count();
+    Vector<SharedPtr<BlockEntry>> block_entries;
+    {
+        const BlocksGuard blocks_guard = segment_entry->GetBlocksGuard();
+        block_entries = blocks_guard.block_entries_;
+    }
+    auto for_each_tensor = [&](const std::function<void(SegmentOffset, const char *, u32)> &func) {
+        ForEachTensor(block_entries, column_id, row_count, buffer_mgr, func);
+    };
+    SharedPtr<TensorCentroidCodes> codes = Make(embedding_info->Dimension(), embedding_info->Type(), row_count, for_each_tensor, segment_entry->segment_id());
+    if (!codes) {
+        return nullptr;
+    }
+    const auto time_1 = std::chrono::high_resolution_clock::now();
+    LOG_INFO(fmt::format("Built centroid codes of segment {} column {}: {} rows, {} embeddings, {} centroids, {} bytes, {} ms",
+                         segment_entry->segment_id(),
+                         column_def->name(),
+                         row_count,
+                         codes->codes_.size(),
+                         codes->centroid_count_,
+                         codes->MemoryUsage(),
+                         std::chrono::duration_cast<std::chrono::milliseconds>(time_1 - time_0).count()));
+    return codes;
+}
+
+SharedPtr<TensorCentroidCodes>
+TensorCentroidCodes::Make(u32 dimension, EmbeddingDataType column_type, u32 row_count, const ForEachTensor &for_each_tensor, u32 seed) {
+    SharedPtr<TensorCentroidCodes> codes(new TensorCentroidCodes(dimension, column_type));
+
+    // 1. offsets of the codes of every tensor
+    Vector<u32> &code_offsets = codes->code_offsets_;
+    code_offsets.resize(row_count + 1);
+    code_offsets[0] = 0;
+    u64 embedding_count = 0;
+    for_each_tensor([&](SegmentOffset segment_offset, const char *, u32 embedding_num) {
+        embedding_count += embedding_num;
+        code_offsets[segment_offset + 1] = static_cast<u32>(embedding_count);
+    });
+    if (embedding_count > std::numeric_limits<u32>::max()) {
+        LOG_WARN(fmt::format("Too many embeddings for centroid codes: {}", embedding_count));
+        return nullptr;
+    }
+    const u32 centroid_count =
+        std::min<u64>({u64(kMaxCentroidCount), static_cast<u64>(std::sqrt(embedding_count)) & ~7ul, embedding_count / kMinEmbeddingPerCentroid});
+    if (centroid_count < 8) {
+        return nullptr;
+    }
+    if (const SizeT memory_usage = EstimateMemoryUsage(dimension, centroid_count, row_count, embedding_count); !codes->ReserveMemory(memory_usage)) {
+        LOG_WARN(fmt::format("Centroid codes of {} bytes are over the memory limit: {} of {} bytes used",
+                             memory_usage,
+                             TotalMemoryUsage(),
+                             MemoryLimit()));
+        return nullptr;
+    }
+
+    // 2. learn the centroids from a sample of the embeddings
+    {
+        constexpr u32 training_embedding_per_centroid = 64;
+        const u32 training_num = std::min<u64>(embedding_count, u64(centroid_count) * training_embedding_per_centroid);
+        Vector<u32> sample_ids;
+        sample_ids.reserve(training_num);
+        std::mt19937 gen(seed);
+        // selection sampling keeps the ids in order
+        std::ranges::sample(std::views::iota(u32(0), static_cast<u32>(embedding_count)), std::back_inserter(sample_ids), training_num, gen);
+
+        Vector<f32> training_data(SizeT(training_num) * dimension);
+        Vector<f32> tensor_buffer;
+        SizeT sample_idx = 0;
+        for_each_tensor([&](SegmentOffset segment_offset, const char *raw_data, u32 embedding_num) {
+            const u32 code_end = code_offsets[segment_offset + 1];
+            if (sample_idx == sample_ids.size() || sample_ids[sample_idx] >= code_end) {
+                return;
+            }
+            tensor_buffer.resize(SizeT(embedding_num) * dimension);
+            EmbeddingsToF32(raw_data, codes->column_type_, embedding_num, dimension, tensor_buffer.data());
+            const u32 code_begin = code_offsets[segment_offset];
+            for (; sample_idx < sample_ids.size() && sample_ids[sample_idx] < code_end; ++sample_idx) {
+                std::memcpy(training_data.data() + sample_idx * dimension,
+                            tensor_buffer.data() + SizeT(sample_ids[sample_idx] - code_begin) * dimension,
+                            dimension * sizeof(f32));
+            }
+        });
+        codes->centroid_count_ = GetKMeansCentroids<f32>(MetricType::kMetricL2,
+                                                         dimension,
+                                                         training_num,
+                                                         training_data.data(),
+                                                         codes->centroids_,
+                                                         centroid_count,
+                                                         0,
+                                                         kMinEmbeddingPerCentroid,
+                                                         training_embedding_per_centroid);
+    }
+
+    // 3. assign every embedding to its nearest centroid
+    {
+        const auto search_top_1_with_dis = GetSIMD_FUNCTIONS().SearchTop1WithDisF32U32_func_ptr_;
+        codes->codes_.resize(embedding_count);
+        Vector<f32> tensor_buffer;
+        Vector<u32> centroid_ids;
+        Vector<f32> centroid_distances;
+        for_each_tensor([&](SegmentOffset segment_offset, const char *raw_data, u32 embedding_num) {
+            if (embedding_num == 0) {
+                return;
+            }
+            tensor_buffer.resize(SizeT(embedding_num) * dimension);
+            centroid_ids.resize(embedding_num);
+            centroid_distances.resize(embedding_num);
+            EmbeddingsToF32(raw_data, codes->column_type_, embedding_num, dimension, tensor_buffer.data());
+            search_top_1_with_dis(dimension,
+                                  embedding_num,
+                                  tensor_buffer.data(),
+                                  codes->centroid_count_,
+                                  codes->centroids_.data(),
+                                  centroid_ids.data(),
+                                  centroid_distances.data());
+            std::copy(centroid_ids.begin(), centroid_ids.end(), codes->codes_.begin() + code_offsets[segment_offset]);
+        });
+    }
+    return codes;
+}
+
+void TensorCentroidCodes::BuildForSegment(SegmentEntry *segment_entry, BufferManager *buffer_mgr) {
+    const TableEntry *table_entry = segment_entry->GetTableEntry();
+    for (const auto &column_def : table_entry->column_defs()) {
+        if (!SupportColumn(column_def.get())) {
+            continue;
+        }
+        // nullptr is kept too, the segment won't have codes later
+        segment_entry->SetTensorCentroidCodes(column_def->id(), Make(segment_entry, column_def.get(), buffer_mgr));
+    }
+}
+
+void TensorCentroidCodes::ScheduleForSegment(SegmentEntry *segment_entry) {
+    const TableEntry *table_entry = segment_entry->GetTableEntry();
+    const auto &column_defs = table_entry->column_defs();
+    if (std::none_of(column_defs.begin(), column_defs.end(), [](const auto &column_def) { return SupportColumn(column_def.get()); })) {
+        return;
+    }
+    segment_entry->SetTensorCentroidCodesRequested();
+    CompactionProcessor *compaction_processor = InfinityContext::instance().storage()->compaction_processor();
+    if (compaction_processor == nullptr || !segment_entry->TryStartBuildTensorCentroidCodes()) {
+        return;
+    }
+    compaction_processor->Submit(
+        MakeShared<BuildCentroidCodesTask>(*table_entry->GetDBName(), *table_entry->GetTableName(), segment_entry->segment_id()));
+}
+
+Vector<f32> TensorCentroidCodes::QueryCentroidScores(const char *query_ptr, EmbeddingDataType query_type, u32 query_embedding_num) const {
+    Vector<f32> scores(SizeT(query_embedding_num) * centroid_count_);
+    if (query_type == EmbeddingDataType::kElemBit) {
+        // Expected hamming distance to the embeddings of a centroid, whose elements are the ratios of set bits
+        const auto *query_bits = reinterpret_cast<const u8 *>(query_ptr);
+        const u32 unit_embedding_bytes = dimension_ / 8;
+        Vector<f32> centroid_sums(centroid_count_);
+        for (u32 centroid_j = 0; centroid_j < centroid_count_; ++centroid_j) {
+            const f32 *centroid = centroids_.data() + SizeT(centroid_j) * dimension_;
+            centroid_sums[centroid_j] = std::reduce(centroid, centroid + dimension_);
+        }
+        for (u32 query_i = 0; query_i < query_embedding_num; ++query_i) {
+            const u8 *query = query_bits + SizeT(query_i) * unit_embedding_bytes;
+            u32 query_popcount = 0;
+            for (u32 k = 0; k < unit_embedding_bytes; ++k) {
+                query_popcount += std::popcount(query[k]);
+            }
+            for (u32 centroid_j = 0; centroid_j < centroid_count_; ++centroid_j) {
+                const f32 *centroid = centroids_.data() + SizeT(centroid_j) * dimension_;
+                f32 common = 0;
+                for (u32 k = 0; k < dimension_; ++k) {
+                    common += ((query[k / 8] >> (k % 8)) & 1u) ? centroid[k] : 0.0f;
+                }
+                scores[SizeT(query_i) * centroid_count_ + centroid_j] = -(query_popcount + centroid_sums[centroid_j] - 2 * common);
+            }
+        }
+        return scores;
+    }
+    const f32 *query_f32 = reinterpret_cast<const f32 *>(query_ptr);
+    Vector<f32> query_buffer;
+    if (query_type != EmbeddingDataType::kElemFloat) {
+        query_buffer.resize(SizeT(query_embedding_num) * dimension_);
+        EmbeddingsToF32(query_ptr, query_type, query_embedding_num, dimension_, query_buffer.data());
+        query_f32 = query_buffer.data();
+    }
+    matrixA_multiply_transpose_matrixB_output_to_C(query_f32, centroids_.data(), query_embedding_num, centroid_count_, dimension_, scores.data());
+    return scores;
+}
+
+} // namespace infinity
@@ -0,0 +1,123 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <functional>
+
+export module tensor_centroid_codes;
+
+import stl;
+import internal_types;
+
+namespace infinity {
+
+struct SegmentEntry;
+class ColumnDef;
+class BufferManager;
+
+// Every embedding of the tensors in one sealed segment is replaced by the id of its nearest centroid. MaxSim against the
+// centroids is then a lookup in the query-centroid score table, which ranks the tensors cheaply before the exact MaxSim
+// (the centroid interaction of PLAID). It doesn't need a trained index, the centroids are learned from the segment itself.
+// The codes are only built for the searches which ask for pruning: the first one of a sealed segment schedules them in the
+// background, and is scored by brute force meanwhile. Ingest never pays for them. The memory of all codes is bounded, the
+// segments over the limit are scored by brute force.
+export class TensorCentroidCodes {
+public:
+    static constexpr u32 kMaxCentroidCount = 1024;
+    static constexpr u32 kMinEmbeddingPerCentroid = 32;
+
+    // `func(segment_offset, raw_data, embedding_num)` for the tensors of the first `row_count` rows, in order
+    using ForEachTensor = std::function<void(const std::function<void(SegmentOffset, const char *, u32)> &func)>;
+
+    ~TensorCentroidCodes();
+
+    static bool SupportType(EmbeddingDataType column_type);
+
+    static bool SupportColumn(const ColumnDef *column_def);
+
+    // Returns nullptr if the segment has too few embeddings to learn centroids from, or the codes are over the memory limit
+    static SharedPtr<TensorCentroidCodes> Make(const SegmentEntry *segment_entry, const ColumnDef *column_def, BufferManager *buffer_mgr);
+
+    static SharedPtr<TensorCentroidCodes>
+    Make(u32 dimension, EmbeddingDataType column_type, u32 row_count, const ForEachTensor &for_each_tensor, u32 seed);
+
+    // Builds the codes of every supported tensor column of a sealed segment, by the winner of
+    // SegmentEntry::TryStartBuildTensorCentroidCodes()
+    static void BuildForSegment(SegmentEntry *segment_entry, BufferManager *buffer_mgr);
+
+    // Builds the codes of a sealed segment in the background, once unless the build finds the segment no longer sealed
+    static void ScheduleForSegment(SegmentEntry *segment_entry);
+
+    // Memory of all codes alive
+    static SizeT TotalMemoryUsage() { return total_memory_usage_.load(); }
+
+    static SizeT MemoryLimit() { return memory_limit_.load(); }
+
+    static void SetMemoryLimit(SizeT memory_limit) { memory_limit_.store(memory_limit); }
+
+    // The query is a tensor of `query_embedding_num` embeddings of the dimension of the column. It's bit for bit columns, whose score
+    // is the negative hamming distance, otherwise f32, i32 or i64 whose score is the inner product.
+    // Returns the query_embedding_num x centroid_count score table.
+    Vector<f32> QueryCentroidScores(const char *query_ptr, EmbeddingDataType query_type, u32 query_embedding_num) const;
+
+    // Approximate MaxSim score of the tensor at `segment_offset`
+    inline f32 ApproximateScore(const f32 *query_centroid_scores, u32 query_embedding_num, SegmentOffset segment_offset) const {
+        const u16 *codes = codes_.data() + code_offsets_[segment_offset];
+        const u32 code_count = code_offsets_[segment_offset + 1] - code_offsets_[segment_offset];
+        f32 score = 0;
+        for (u32 query_i = 0; query_i < query_embedding_num; ++query_i) {
+            const f32 *scores_i = query_centroid_scores + query_i * centroid_count_;
+            f32 max_score_i = std::numeric_limits<f32>::lowest();
+            for (u32 code_j = 0; code_j < code_count; ++code_j) {
+                max_score_i = std::max(max_score_i, scores_i[codes[code_j]]);
+            }
+            score += max_score_i;
+        }
+        return score;
+    }
+
+    [[nodiscard]] inline u32 row_count() const { return code_offsets_.size() - 1; }
+
+    [[nodiscard]] inline u32 centroid_count() const { return centroid_count_; }
+
+    // Reserved against MemoryLimit() before the codes are built
+    [[nodiscard]] inline SizeT MemoryUsage() const { return reserved_memory_; }
+
+private:
+    TensorCentroidCodes(u32 dimension, EmbeddingDataType column_type) : dimension_(dimension), column_type_(column_type) {}
+
+    static SizeT EstimateMemoryUsage(u32 dimension, u32 centroid_count, u32 row_count, u64 embedding_count) {
+        return sizeof(TensorCentroidCodes) + SizeT(centroid_count) * dimension * sizeof(f32) + (SizeT(row_count) + 1) * sizeof(u32) +
+               embedding_count * sizeof(u16);
+    }
+
+    bool ReserveMemory(SizeT memory_usage);
+
+    static Atomic<SizeT> total_memory_usage_;
+    static Atomic<SizeT> memory_limit_;
+
+    SizeT reserved_memory_ = 0;
+
+    u32 dimension_ = 0;
+    EmbeddingDataType column_type_ = EmbeddingDataType::kElemInvalid;
+    u32 centroid_count_ = 0;
+    // centroid_count x dimension
+    Vector<f32> centroids_;
+    // The codes of the tensor at segment offset i are codes_[code_offsets_[i] .. code_offsets_[i + 1])
+    Vector<u32> code_offsets_;
+    Vector<u16> codes_;
+};
+
+} // namespace infinity
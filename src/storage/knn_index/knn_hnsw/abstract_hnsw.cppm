@@ -42,6 +42,7 @@ import logger;
 import base_memindex;
 import memindex_tracer;
 import table_index_entry;
+import index_build_tracer;
 
 namespace infinity {
 
@@ -141,14 +142,28 @@ private:
                 SizeT i1 = start + i * bucket_size;
                 SizeT i2 = std::min(i1 + bucket_size, SizeT(end));
                 futs.emplace_back(thread_pool.push([&, i1, i2](int id) {
-                    for (SizeT j = i1; j < i2; ++j) {
-                        index->Build(j);
+                    IndexBuildJob *build_job = config.build_job_;
+                    for (SizeT j1 = i1; j1 < i2; j1 += kBuildBucketSize) {
+                        if (build_job != nullptr && build_job->cancelled()) {
+                            return;
+                        }
+                        SizeT j2 = std::min(j1 + kBuildBucketSize, i2);
+                        for (SizeT j = j1; j < j2; ++j) {
+                            index->Build(j);
+                        }
+                        if (build_job != nullptr) {
+                            build_job->AddProcessedRows(j2 - j1);
+                        }
                     }
                 }));
             }
             for (auto &fut : futs) {
                 fut.wait();
             }
+            // Not raised in the pool threads, the partial graph is dropped with the segment
+            if (config.build_job_ != nullptr) {
+                config.build_job_->CheckCancelled();
+            }
             SizeT mem2 = index->mem_usage();
             mem_usage = mem2 - mem1;
         }
@@ -26,6 +26,8 @@ import file_system;
 import vec_store_type;
 import graph_store;
 import infinity_exception;
+import serialize;
+import status;
 
 namespace infinity {
 
@@ -77,7 +79,8 @@ public:
         : chunk_size_(std::exchange(other.chunk_size_, 0)), max_chunk_n_(std::exchange(other.max_chunk_n_, 0)),
           chunk_shift_(std::exchange(other.chunk_shift_, 0)), cur_vec_num_(other.cur_vec_num_.exchange(0)),
           vec_store_meta_(std::move(other.vec_store_meta_)), graph_store_meta_(std::move(other.graph_store_meta_)),
-          inners_(std::exchange(other.inners_, nullptr)), mem_usage_(other.mem_usage_.exchange(0)) {}
+          inners_(std::exchange(other.inners_, nullptr)), mem_usage_(other.mem_usage_.exchange(0)),
+          mmap_loaded_(std::exchange(other.mmap_loaded_, false)) {}
     DataStore &operator=(This &&other) {
         if (this != &other) {
             chunk_size_ = std::exchange(other.chunk_size_, 0);
@@ -88,6 +91,7 @@ public:
             graph_store_meta_ = std::move(other.graph_store_meta_);
             inners_ = std::exchange(other.inners_, nullptr);
             mem_usage_ = other.mem_usage_.exchange(0);
+            mmap_loaded_ = std::exchange(other.mmap_loaded_, false);
         }
         return *this;
     }
@@ -187,8 +191,32 @@ public:
         return ret;
     }
 
+    // Load from a private mapping of the index file. The chunks are sized to the loaded vectors and the graph points into
+    // the mapping, so the data store is read only: adding vectors or vertices, optimize and compression raise an error.
+    static This LoadFromPtr(const char *&ptr) {
+        SizeT chunk_size = ReadBufAdv<SizeT>(ptr);
+        SizeT max_chunk_n = ReadBufAdv<SizeT>(ptr);
+        SizeT cur_vec_num = ReadBufAdv<SizeT>(ptr);
+        VecStoreMeta vec_store_meta = VecStoreMeta::LoadFromPtr(ptr);
+        GraphStoreMeta graph_store_meta = GraphStoreMeta::LoadFromPtr(ptr);
+
+        This ret = This(chunk_size, max_chunk_n, std::move(vec_store_meta), std::move(graph_store_meta));
+        ret.cur_vec_num_ = cur_vec_num;
+
+        SizeT mem_usage = 0;
+        auto [chunk_num, last_chunk_size] = ret.ChunkInfo(cur_vec_num);
+        for (SizeT i = 0; i < chunk_num; ++i) {
+            SizeT cur_chunk_size = (i < chunk_num - 1) ? chunk_size : last_chunk_size;
+            ret.inners_[i] = Inner::LoadFromPtr(ptr, cur_chunk_size, ret.vec_store_meta_, ret.graph_store_meta_, mem_usage);
+        }
+        ret.mem_usage_.store(mem_usage);
+        ret.mmap_loaded_ = true;
+        return ret;
+    }
+
     template <DataIteratorConcept<QueryVecType, LabelType> Iterator>
     Pair<SizeT, SizeT> AddVec(Iterator &&query_iter) {
+        CheckMutable();
         SizeT mem_usage = 0;
         SizeT cur_vec_num = this->cur_vec_num();
         SizeT start_idx = cur_vec_num;
@@ -216,6 +244,7 @@ public:
 
     template <DataIteratorConcept<QueryVecType, LabelType> Iterator>
     Pair<SizeT, SizeT> OptAddVec(Iterator &&query_iter) {
+        CheckMutable();
         if constexpr (VecStoreT::HasOptimize) {
             SizeT mem_usage = 0;
             SizeT cur_vec_num = this->cur_vec_num();
@@ -235,6 +264,7 @@ public:
     }
 
     void Optimize() {
+        CheckMutable();
         if constexpr (!VecStoreT::HasOptimize) {
             return;
         }
@@ -263,6 +293,7 @@ public:
 
     // Graph store
     void AddVertex(VertexType vec_i, i32 layer_n) {
+        CheckMutable();
         auto [inner, idx] = GetInner(vec_i);
         SizeT mem_usage = 0;
         inner.AddVertex(idx, layer_n, graph_store_meta_, mem_usage);
@@ -274,6 +305,7 @@ public:
         return inner.GetNeighbors(idx, layer_i, graph_store_meta_);
     }
     Pair<VertexType *, VertexListSize *> GetNeighborsMut(VertexType vertex_i, i32 layer_i) {
+        CheckMutable();
         auto [inner, idx] = GetInner(vertex_i);
         return inner.GetNeighborsMut(idx, layer_i, graph_store_meta_);
     }
@@ -305,7 +337,15 @@ public:
 
     SizeT mem_usage() const { return mem_usage_.load(); }
 
+    bool mmap_loaded() const { return mmap_loaded_; }
+
 private:
+    void CheckMutable() const {
+        if (mmap_loaded_) {
+            RecoverableError(Status::NotSupport("HNSW index loaded from a memory mapped file can't be modified"));
+        }
+    }
+
     Pair<Inner &, SizeT> GetInner(SizeT vec_i) { return {inners_[vec_i >> chunk_shift_], vec_i & (chunk_size_ - 1)}; }
 
     Pair<const Inner &, SizeT> GetInner(SizeT vec_i) const { return {inners_[vec_i >> chunk_shift_], vec_i & (chunk_size_ - 1)}; }
@@ -329,6 +369,7 @@ private:
 
     UniquePtr<Inner[]> inners_;
     Atomic<SizeT> mem_usage_ = 0;
+    bool mmap_loaded_ = false;
 
 public:
     void Check() const {
@@ -428,6 +469,17 @@ public:
         return ret;
     }
 
+    static This
+    LoadFromPtr(const char *&ptr, SizeT cur_vec_num, VecStoreMeta &vec_store_meta, GraphStoreMeta &graph_store_meta, SizeT &mem_usage) {
+        auto vec_store_inner = VecStoreInner::LoadFromPtr(ptr, cur_vec_num, vec_store_meta, mem_usage);
+        auto graph_store_inner = GraphStoreInner::LoadFromPtr(ptr, cur_vec_num, graph_store_meta, mem_usage);
+        This ret(cur_vec_num, std::move(vec_store_inner), std::move(graph_store_inner));
+        std::memcpy(ret.labels_.get(), ptr, sizeof(LabelType) * cur_vec_num);
+        ptr += sizeof(LabelType) * cur_vec_num;
+        mem_usage += (sizeof(LabelType) + sizeof(std::shared_mutex)) * cur_vec_num;
+        return ret;
+    }
+
     // vec store
     template <DataIteratorConcept<QueryVecType, LabelType> Iterator>
     Pair<SizeT, bool> AddVec(Iterator &&query_iter, VertexType start_idx, SizeT remain_num, const VecStoreMeta &meta, SizeT &mem_usage) {
@@ -590,6 +642,8 @@ DataStore<CompressVecStoreType, LabelType> DataStore<VecStoreT, LabelType>::Comp
     if constexpr (std::is_same_v<CompressVecStoreType, VecStoreT>) {
         return std::move(*this);
     } else {
+        // The graph is moved into the compressed store, it can't keep pointing into the mapping
+        CheckMutable();
         const auto [chunk_num, last_chunk_size] = ChunkInfo(cur_vec_num());
         Vector<GraphStoreInner> graph_inners;
         for (SizeT i = 0; i < chunk_num; ++i) {
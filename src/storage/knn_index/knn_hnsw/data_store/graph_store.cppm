@@ -22,6 +22,7 @@ export module graph_store;
 import stl;
 import hnsw_common;
 import file_system;
+import serialize;
 
 namespace infinity {
 
@@ -91,6 +92,15 @@ public:
         return meta;
     }
 
+    static GraphStoreMeta LoadFromPtr(const char *&ptr) {
+        SizeT Mmax0 = ReadBufAdv<SizeT>(ptr);
+        SizeT Mmax = ReadBufAdv<SizeT>(ptr);
+        GraphStoreMeta meta(Mmax0, Mmax);
+        meta.max_layer_ = ReadBufAdv<i32>(ptr);
+        meta.enterpoint_ = ReadBufAdv<VertexType>(ptr);
+        return meta;
+    }
+
     SizeT Mmax0() const { return Mmax0_; }
     SizeT Mmax() const { return Mmax_; }
     SizeT level0_size() const { return level0_size_; }
@@ -136,7 +146,7 @@ public:
 export class GraphStoreInner {
 private:
     GraphStoreInner(SizeT max_vertex, const GraphStoreMeta &meta, SizeT loaded_vertex_n)
-        : graph_(MakeUnique<char[]>(max_vertex * meta.level0_size())), loaded_vertex_n_(loaded_vertex_n) {}
+        : graph_holder_(MakeUnique<char[]>(max_vertex * meta.level0_size())), graph_(graph_holder_.get()), loaded_vertex_n_(loaded_vertex_n) {}
 
 public:
     GraphStoreInner() = default;
@@ -149,7 +159,7 @@ public:
 
     static GraphStoreInner Make(SizeT max_vertex, const GraphStoreMeta &meta, SizeT &mem_usage) {
         GraphStoreInner graph_store(max_vertex, meta, 0);
-        std::fill(graph_store.graph_.get(), graph_store.graph_.get() + max_vertex * meta.level0_size(), 0);
+        std::fill(graph_store.graph_, graph_store.graph_ + max_vertex * meta.level0_size(), 0);
         mem_usage += max_vertex * meta.level0_size();
         return graph_store;
     }
@@ -160,7 +170,7 @@ public:
             const VertexL0 *v = GetLevel0(vertex_i, meta);
             size += sizeof(v->layer_n_) + sizeof(v->neighbor_n_) + sizeof(VertexType) * v->neighbor_n_;
             for (i32 layer_i = 1; layer_i <= v->layer_n_; ++layer_i) {
-                const VertexLX *vx = GetLevelX(v->layers_p_, layer_i, meta);
+                const VertexLX *vx = GetLevelX(LayersP(vertex_i, v), layer_i, meta);
                 size += sizeof(vx->neighbor_n_) + sizeof(VertexType) * vx->neighbor_n_;
             }
         }
@@ -173,11 +183,11 @@ public:
             layer_sum += GetLevel0(vertex_i, meta)->layer_n_;
         }
         file_handler.Write(&layer_sum, sizeof(layer_sum));
-        file_handler.Write(graph_.get(), cur_vertex_n * meta.level0_size());
+        file_handler.Write(graph_, cur_vertex_n * meta.level0_size());
         for (VertexType vertex_i = 0; vertex_i < (VertexType)cur_vertex_n; ++vertex_i) {
             const VertexL0 *v = GetLevel0(vertex_i, meta);
             if (v->layer_n_) {
-                file_handler.Write(v->layers_p_, meta.levelx_size() * v->layer_n_);
+                file_handler.Write(LayersP(vertex_i, v), meta.levelx_size() * v->layer_n_);
             }
         }
     }
@@ -189,7 +199,7 @@ public:
         file_handler.Read(&layer_sum, sizeof(layer_sum));
 
         GraphStoreInner graph_store(max_vertex, meta, cur_vertex_n);
-        file_handler.Read(graph_store.graph_.get(), cur_vertex_n * meta.level0_size());
+        file_handler.Read(graph_store.graph_, cur_vertex_n * meta.level0_size());
 
         auto loaded_layers = MakeUnique<char[]>(meta.levelx_size() * layer_sum);
         char *loaded_layers_p = loaded_layers.get();
@@ -209,6 +219,50 @@ public:
         return graph_store;
     }
 
+    // `ptr` points into a private mapping of the index file. The layer pointers saved in the file are stale, so when the
+    // level 0 graph is used in place they are kept in a side table instead of patching (and copying) the mapped pages.
+    static GraphStoreInner LoadFromPtr(const char *&ptr, SizeT cur_vertex_n, const GraphStoreMeta &meta, SizeT &mem_usage) {
+        SizeT layer_sum = ReadBufAdv<SizeT>(ptr);
+        GraphStoreInner graph_store;
+        graph_store.loaded_vertex_n_ = cur_vertex_n;
+
+        SizeT level0_bytes = cur_vertex_n * meta.level0_size();
+        bool level0_in_place = reinterpret_cast<uintptr_t>(ptr) % alignof(VertexL0) == 0;
+        if (level0_in_place) {
+            graph_store.graph_ = const_cast<char *>(ptr);
+            graph_store.mmap_layers_p_ = MakeUnique<char *[]>(cur_vertex_n);
+            mem_usage += sizeof(char *) * cur_vertex_n;
+        } else {
+            graph_store.graph_holder_ = MakeUnique<char[]>(level0_bytes);
+            graph_store.graph_ = graph_store.graph_holder_.get();
+            std::memcpy(graph_store.graph_, ptr, level0_bytes);
+            mem_usage += level0_bytes;
+        }
+        ptr += level0_bytes;
+
+        SizeT layers_bytes = meta.levelx_size() * layer_sum;
+        char *layers_p = const_cast<char *>(ptr);
+        if (reinterpret_cast<uintptr_t>(ptr) % alignof(VertexLX) != 0) {
+            graph_store.loaded_layers_ = MakeUnique<char[]>(layers_bytes);
+            std::memcpy(graph_store.loaded_layers_.get(), ptr, layers_bytes);
+            layers_p = graph_store.loaded_layers_.get();
+            mem_usage += layers_bytes;
+        }
+        ptr += layers_bytes;
+
+        for (VertexType vertex_i = 0; vertex_i < (VertexType)cur_vertex_n; ++vertex_i) {
+            VertexL0 *v = graph_store.GetLevel0(vertex_i, meta);
+            char *vertex_layers_p = v->layer_n_ ? layers_p : nullptr;
+            layers_p += meta.levelx_size() * v->layer_n_;
+            if (level0_in_place) {
+                graph_store.mmap_layers_p_[vertex_i] = vertex_layers_p;
+            } else {
+                v->layers_p_ = vertex_layers_p;
+            }
+        }
+        return graph_store;
+    }
+
     void AddVertex(VertexType vertex_i, i32 layer_n, const GraphStoreMeta &meta, SizeT &mem_usage) {
         VertexL0 *v = GetLevel0(vertex_i, meta);
         v->neighbor_n_ = 0;
@@ -218,7 +272,7 @@ public:
             mem_usage += meta.levelx_size() * layer_n;
 
             for (i32 layer_i = 1; layer_i <= layer_n; ++layer_i) {
-                GetLevelX(v->layers_p_, layer_i, meta)->neighbor_n_ = 0;
+                GetLevelX(LayersP(vertex_i, v), layer_i, meta)->neighbor_n_ = 0;
             }
         } else {
             v->layers_p_ = nullptr;
@@ -230,7 +284,7 @@ public:
         if (layer_i == 0) {
             return {v->neighbors_, v->neighbor_n_};
         }
-        const VertexLX *vx = GetLevelX(v->layers_p_, layer_i, meta);
+        const VertexLX *vx = GetLevelX(LayersP(vertex_i, v), layer_i, meta);
         return {vx->neighbors_, vx->neighbor_n_};
     }
     Pair<VertexType *, VertexListSize *> GetNeighborsMut(VertexType vertex_i, i32 layer_i, const GraphStoreMeta &meta) {
@@ -238,16 +292,16 @@ public:
         if (layer_i == 0) {
             return {v->neighbors_, &v->neighbor_n_};
         }
-        VertexLX *vx = GetLevelX(v->layers_p_, layer_i, meta);
+        VertexLX *vx = GetLevelX(LayersP(vertex_i, v), layer_i, meta);
         return {vx->neighbors_, &vx->neighbor_n_};
     }
 
 private:
     const VertexL0 *GetLevel0(VertexType vertex_i, const GraphStoreMeta &meta) const {
-        return reinterpret_cast<const VertexL0 *>(graph_.get() + vertex_i * meta.level0_size());
+        return reinterpret_cast<const VertexL0 *>(graph_ + vertex_i * meta.level0_size());
     }
     VertexL0 *GetLevel0(VertexType vertex_i, const GraphStoreMeta &meta) {
-        return reinterpret_cast<VertexL0 *>(graph_.get() + vertex_i * meta.level0_size());
+        return reinterpret_cast<VertexL0 *>(graph_ + vertex_i * meta.level0_size());
     }
 
     const VertexLX *GetLevelX(const char *layer_p, i32 layer_i, const GraphStoreMeta &meta) const {
@@ -259,10 +313,14 @@ private:
         return reinterpret_cast<VertexLX *>(layer_p + (layer_i - 1) * meta.levelx_size());
     }
 
+    char *LayersP(VertexType vertex_i, const VertexL0 *v) const { return mmap_layers_p_ ? mmap_layers_p_[vertex_i] : v->layers_p_; }
+
 private:
-    UniquePtr<char[]> graph_;
+    UniquePtr<char[]> graph_holder_;
+    char *graph_ = nullptr; // graph_holder_ or the mapped file
     SizeT loaded_vertex_n_;
     UniquePtr<char[]> loaded_layers_;
+    UniquePtr<char *[]> mmap_layers_p_; // layer pointers of the mapped level 0 graph
 
     //---------------------------------------------- Following is the tmp debug function. ----------------------------------------------
 
@@ -283,7 +341,7 @@ public:
                 assert(neighbor_idx != out_vertex_i);
             }
             for (int layer_i = 1; layer_i <= v->layer_n_; ++layer_i) {
-                const VertexLX *vx = GetLevelX(v->layers_p_, layer_i, meta);
+                const VertexLX *vx = GetLevelX(LayersP(vertex_i, v), layer_i, meta);
                 for (int i = 0; i < vx->neighbor_n_; ++i) {
                     VertexType neighbor_idx = vx->neighbors_[i];
                     assert(neighbor_idx < (VertexType)cur_vec_num && neighbor_idx >= 0);
@@ -323,7 +381,7 @@ public:
                     neighbors = v->neighbors_;
                     neighbor_n = v->neighbor_n_;
                 } else {
-                    const VertexLX *vx = GetLevelX(v->layers_p_, layer, meta);
+                    const VertexLX *vx = GetLevelX(LayersP(vertex_i, v), layer, meta);
                     neighbors = vx->neighbors_;
                     neighbor_n = vx->neighbor_n_;
                 }
@@ -28,6 +28,7 @@ export module lvq_vec_store;
 import stl;
 import file_system;
 import hnsw_common;
+import serialize;
 
 namespace infinity {
 
@@ -113,6 +114,16 @@ public:
         return meta;
     }
 
+    static This LoadFromPtr(const char *&ptr) {
+        SizeT dim = ReadBufAdv<SizeT>(ptr);
+        This meta(dim);
+        std::memcpy(meta.mean_.get(), ptr, sizeof(MeanType) * dim);
+        ptr += sizeof(MeanType) * dim;
+        std::memcpy(&meta.global_cache_, ptr, sizeof(GlobalCacheType));
+        ptr += sizeof(GlobalCacheType);
+        return meta;
+    }
+
     LVQQuery MakeQuery(const DataType *vec) const {
         LVQQuery query(compress_data_size_);
         CompressTo(vec, query.inner_.get());
@@ -252,7 +263,8 @@ public:
     using LVQData = LVQData<DataType, LocalCacheType, CompressType>;
 
 private:
-    LVQVecStoreInner(SizeT max_vec_num, const Meta &meta) : ptr_(MakeUnique<char[]>(max_vec_num * meta.compress_data_size())) {}
+    LVQVecStoreInner(SizeT max_vec_num, const Meta &meta)
+        : holder_(MakeUnique<char[]>(max_vec_num * meta.compress_data_size())), ptr_(holder_.get()) {}
 
 public:
     LVQVecStoreInner() = default;
@@ -266,30 +278,46 @@ public:
     SizeT GetSizeInBytes(SizeT cur_vec_num, const Meta &meta) const { return cur_vec_num * meta.compress_data_size(); }
 
     void Save(FileHandler &file_handler, SizeT cur_vec_num, const Meta &meta) const {
-        file_handler.Write(ptr_.get(), cur_vec_num * meta.compress_data_size());
+        file_handler.Write(ptr_, cur_vec_num * meta.compress_data_size());
     }
 
     static This Load(FileHandler &file_handler, SizeT cur_vec_num, SizeT max_vec_num, const Meta &meta, SizeT &mem_usage) {
         assert(cur_vec_num <= max_vec_num);
         This ret(max_vec_num, meta);
-        file_handler.Read(ret.ptr_.get(), cur_vec_num * meta.compress_data_size());
+        file_handler.Read(ret.ptr_, cur_vec_num * meta.compress_data_size());
         mem_usage += max_vec_num * meta.compress_data_size();
         return ret;
     }
 
+    // `ptr` points into a private mapping of the index file, the compressed vectors are used in place when they are aligned.
+    static This LoadFromPtr(const char *&ptr, SizeT cur_vec_num, const Meta &meta, SizeT &mem_usage) {
+        SizeT size = cur_vec_num * meta.compress_data_size();
+        This ret;
+        if (reinterpret_cast<uintptr_t>(ptr) % alignof(LVQData) == 0) {
+            ret.ptr_ = const_cast<char *>(ptr);
+        } else {
+            ret = This(cur_vec_num, meta);
+            std::memcpy(ret.ptr_, ptr, size);
+            mem_usage += size;
+        }
+        ptr += size;
+        return ret;
+    }
+
     void SetVec(SizeT idx, const DataType *vec, const Meta &meta, SizeT &mem_usage) { meta.CompressTo(vec, GetVecMut(idx, meta)); }
 
     const LVQData *GetVec(SizeT idx, const Meta &meta) const {
-        return reinterpret_cast<const LVQData *>(ptr_.get() + idx * meta.compress_data_size());
+        return reinterpret_cast<const LVQData *>(ptr_ + idx * meta.compress_data_size());
     }
 
     void Prefetch(VertexType vec_i, const Meta &meta) const { _mm_prefetch(reinterpret_cast<const char *>(GetVec(vec_i, meta)), _MM_HINT_T0); }
 
 private:
-    LVQData *GetVecMut(SizeT idx, const Meta &meta) { return reinterpret_cast<LVQData *>(ptr_.get() + idx * meta.compress_data_size()); }
+    LVQData *GetVecMut(SizeT idx, const Meta &meta) { return reinterpret_cast<LVQData *>(ptr_ + idx * meta.compress_data_size()); }
 
 private:
-    UniquePtr<char[]> ptr_;
+    UniquePtr<char[]> holder_;
+    char *ptr_ = nullptr; // holder_ or the mapped file
 
 public:
     void Dump(std::ostream &os, SizeT offset, SizeT chunk_size, const Meta &meta) const {
@@ -27,6 +27,7 @@ export module plain_vec_store;
 import stl;
 import file_system;
 import hnsw_common;
+import serialize;
 
 namespace infinity {
 
@@ -64,6 +65,11 @@ public:
         return This(dim);
     }
 
+    static This LoadFromPtr(const char *&ptr) {
+        SizeT dim = ReadBufAdv<SizeT>(ptr);
+        return This(dim);
+    }
+
     QueryType MakeQuery(const DataType *vec) const { return vec; }
 
     SizeT dim() const { return dim_; }
@@ -82,7 +88,8 @@ public:
     using Meta = PlainVecStoreMeta<DataType>;
 
 private:
-    PlainVecStoreInner(SizeT max_vec_num, const Meta &meta) : ptr_(MakeUnique<DataType[]>(max_vec_num * meta.dim())) {}
+    PlainVecStoreInner(SizeT max_vec_num, const Meta &meta)
+        : holder_(MakeUnique<DataType[]>(max_vec_num * meta.dim())), ptr_(holder_.get()) {}
 
 public:
     PlainVecStoreInner() = default;
@@ -95,28 +102,44 @@ public:
     SizeT GetSizeInBytes(SizeT cur_vec_num, const Meta &meta) const { return sizeof(DataType) * cur_vec_num * meta.dim(); }
 
     void Save(FileHandler &file_handler, SizeT cur_vec_num, const Meta &meta) const {
-        file_handler.Write(ptr_.get(), sizeof(DataType) * cur_vec_num * meta.dim());
+        file_handler.Write(ptr_, sizeof(DataType) * cur_vec_num * meta.dim());
     }
 
     static This Load(FileHandler &file_handler, SizeT cur_vec_num, SizeT max_vec_num, const Meta &meta, SizeT &mem_usage) {
         assert(cur_vec_num <= max_vec_num);
         This ret(max_vec_num, meta);
-        file_handler.Read(ret.ptr_.get(), sizeof(DataType) * cur_vec_num * meta.dim());
+        file_handler.Read(ret.ptr_, sizeof(DataType) * cur_vec_num * meta.dim());
         mem_usage += sizeof(DataType) * max_vec_num * meta.dim();
         return ret;
     }
 
+    // `ptr` points into a private mapping of the index file, the vectors are used in place when they are aligned.
+    static This LoadFromPtr(const char *&ptr, SizeT cur_vec_num, const Meta &meta, SizeT &mem_usage) {
+        SizeT size = sizeof(DataType) * cur_vec_num * meta.dim();
+        This ret;
+        if (reinterpret_cast<uintptr_t>(ptr) % alignof(DataType) == 0) {
+            ret.ptr_ = reinterpret_cast<DataType *>(const_cast<char *>(ptr));
+        } else {
+            ret = This(cur_vec_num, meta);
+            std::memcpy(ret.ptr_, ptr, size);
+            mem_usage += size;
+        }
+        ptr += size;
+        return ret;
+    }
+
     void SetVec(SizeT idx, const DataType *vec, const Meta &meta, SizeT &mem_usage) { Copy(vec, vec + meta.dim(), GetVecMut(idx, meta)); }
 
-    const DataType *GetVec(SizeT idx, const Meta &meta) const { return ptr_.get() + idx * meta.dim(); }
+    const DataType *GetVec(SizeT idx, const Meta &meta) const { return ptr_ + idx * meta.dim(); }
 
     void Prefetch(VertexType vec_i, const Meta &meta) const { _mm_prefetch(reinterpret_cast<const char *>(GetVec(vec_i, meta)), _MM_HINT_T0); }
 
 private:
-    DataType *GetVecMut(SizeT idx, const Meta &meta) { return ptr_.get() + idx * meta.dim(); }
+    DataType *GetVecMut(SizeT idx, const Meta &meta) { return ptr_ + idx * meta.dim(); }
 
 private:
-    UniquePtr<DataType[]> ptr_;
+    UniquePtr<DataType[]> holder_;
+    DataType *ptr_ = nullptr; // holder_ or the mapped file
 
 public:
     void Dump(std::ostream &os, SizeT offset, SizeT chunk_size, const Meta &meta) const {
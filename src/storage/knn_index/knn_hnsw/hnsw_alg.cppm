@@ -29,6 +29,7 @@ import logical_type;
 import hnsw_common;
 import data_store;
 import third_party;
+import serialize;
 
 // Fixme: some variable has implicit type conversion.
 // Fixme: some variable has confusing name.
@@ -42,6 +43,9 @@ namespace infinity {
 export struct KnnSearchOption {
     SizeT ef_ = 0;
     LogicalType column_logical_type_ = LogicalType::kEmbedding;
+    // k-th best distance already found elsewhere (e.g. in other chunks of the segment), results farther than it are not returned.
+    // Once `ef` results are held, the search also stops when the nearest unexpanded candidate is farther than it.
+    f32 dist_bound_ = std::numeric_limits<f32>::max();
 };
 
 export template <typename VecStoreType, typename LabelType>
@@ -120,6 +124,17 @@ public:
         return MakeUnique<This>(M, ef_construction, std::move(data_store), std::move(distance), 0);
     }
 
+    // `ptr` points into a private mapping of the index file which must outlive the returned index.
+    static UniquePtr<This> LoadFromPtr(const char *&ptr) {
+        SizeT M = ReadBufAdv<SizeT>(ptr);
+        SizeT ef_construction = ReadBufAdv<SizeT>(ptr);
+
+        auto data_store = DataStore::LoadFromPtr(ptr);
+        Distance distance(data_store.dim());
+
+        return MakeUnique<This>(M, ef_construction, std::move(data_store), std::move(distance), 0);
+    }
+
 private:
     // >= 0
     i32 GenerateRandomLayer() {
@@ -138,7 +153,12 @@ private:
               LogicalType ColumnLogicalType = LogicalType::kEmbedding,
               typename MultiVectorInnerTopnIndexType = void>
     Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<SearchLayerReturnParam3T<ColumnLogicalType>[]>>
-    SearchLayer(VertexType enter_point, const StoreType &query, i32 layer_idx, SizeT result_n, const Filter &filter) const {
+    SearchLayer(VertexType enter_point,
+                const StoreType &query,
+                i32 layer_idx,
+                SizeT result_n,
+                const Filter &filter,
+                f64 dist_bound = std::numeric_limits<f64>::max()) const {
         static_assert(ColumnLogicalType == LogicalType::kEmbedding || ColumnLogicalType == LogicalType::kMultiVector);
         auto d_ptr = MakeUniqueForOverwrite<DistanceType[]>(result_n);
         auto i_ptr = MakeUniqueForOverwrite<SearchLayerReturnParam3T<ColumnLogicalType>[]>(result_n);
@@ -186,8 +206,13 @@ private:
         while (!candidate.empty()) {
             const auto [minus_c_dist, c_idx] = candidate.top();
             candidate.pop();
-            if (result_handler.GetSize(0) == result_n && -minus_c_dist > result_handler.GetDistance0(0)) {
-                break;
+            if (result_handler.GetSize(0) == result_n) {
+                // the candidates left are farther than the local worst result, or than the k-th best result found elsewhere.
+                // Only the termination uses the bound: the neighbors are admitted as without it, so the search visits the
+                // same vertices in the same order as the unbounded one until it stops.
+                if (-minus_c_dist > result_handler.GetDistance0(0) || static_cast<f64>(-minus_c_dist) > dist_bound) {
+                    break;
+                }
             }
 
             std::shared_lock<std::shared_mutex> lock;
@@ -313,18 +338,23 @@ private:
     LabelType GetLabel(VertexType vertex_i) const { return data_store_.GetLabel(vertex_i); }
 
     template <bool WithLock, FilterConcept<LabelType> Filter, LogicalType ColumnLogicalType>
-    auto SearchLayerHelper(VertexType enter_point, const StoreType &query, i32 layer_idx, SizeT result_n, const Filter &filter) const {
+    auto SearchLayerHelper(VertexType enter_point,
+                           const StoreType &query,
+                           i32 layer_idx,
+                           SizeT result_n,
+                           const Filter &filter,
+                           f64 dist_bound = std::numeric_limits<f64>::max()) const {
         if constexpr (ColumnLogicalType == LogicalType::kEmbedding) {
-            return SearchLayer<WithLock, Filter, ColumnLogicalType>(enter_point, query, layer_idx, result_n, filter);
+            return SearchLayer<WithLock, Filter, ColumnLogicalType>(enter_point, query, layer_idx, result_n, filter, dist_bound);
         } else if constexpr (ColumnLogicalType == LogicalType::kMultiVector) {
             if (result_n <= std::numeric_limits<u8>::max()) {
-                return SearchLayer<WithLock, Filter, ColumnLogicalType, u8>(enter_point, query, layer_idx, result_n, filter);
+                return SearchLayer<WithLock, Filter, ColumnLogicalType, u8>(enter_point, query, layer_idx, result_n, filter, dist_bound);
             }
             if (result_n <= std::numeric_limits<u16>::max()) {
-                return SearchLayer<WithLock, Filter, ColumnLogicalType, u16>(enter_point, query, layer_idx, result_n, filter);
+                return SearchLayer<WithLock, Filter, ColumnLogicalType, u16>(enter_point, query, layer_idx, result_n, filter, dist_bound);
             }
             if (result_n <= std::numeric_limits<u32>::max()) {
-                return SearchLayer<WithLock, Filter, ColumnLogicalType, u32>(enter_point, query, layer_idx, result_n, filter);
+                return SearchLayer<WithLock, Filter, ColumnLogicalType, u32>(enter_point, query, layer_idx, result_n, filter, dist_bound);
             }
             UnrecoverableError(fmt::format("Unsupported result_n : {}, which is larger than u32::max()", result_n));
             return Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<SearchLayerReturnParam3T<ColumnLogicalType>[]>>{};
@@ -348,7 +378,21 @@ private:
         for (i32 cur_layer = max_layer; cur_layer > 0; --cur_layer) {
             ep = SearchLayerNearest<WithLock>(ep, query, cur_layer);
         }
-        return SearchLayerHelper<WithLock, Filter, ColumnLogicalType>(ep, query, 0, ef, filter);
+        // compared in f64, which holds both the f32 bound and the integer distances of sparse and binary stores exactly
+        const f64 dist_bound = option.dist_bound_ < std::numeric_limits<f32>::max() ? option.dist_bound_ : std::numeric_limits<f64>::max();
+        auto [result_n, d_ptr, i_ptr] = SearchLayerHelper<WithLock, Filter, ColumnLogicalType>(ep, query, 0, ef, filter, dist_bound);
+        if (dist_bound < std::numeric_limits<f64>::max()) {
+            SizeT kept_n = 0;
+            for (SizeT i = 0; i < result_n; ++i) {
+                if (static_cast<f64>(d_ptr[i]) <= dist_bound) {
+                    d_ptr[kept_n] = d_ptr[i];
+                    i_ptr[kept_n] = i_ptr[i];
+                    ++kept_n;
+                }
+            }
+            result_n = kept_n;
+        }
+        return {result_n, std::move(d_ptr), std::move(i_ptr)};
     }
 
 public:
@@ -463,6 +507,8 @@ public:
 
     SizeT mem_usage() const { return data_store_.mem_usage(); }
 
+    bool mmap_loaded() const { return data_store_.mmap_loaded(); }
+
 private:
     SizeT M_;
     SizeT ef_construction_;
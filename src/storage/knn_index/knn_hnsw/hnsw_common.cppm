@@ -23,6 +23,7 @@ import stl;
 import file_system;
 import infinity_exception;
 import sparse_util;
+import index_build_tracer;
 
 namespace infinity {
 
@@ -98,6 +99,7 @@ concept FilterConcept = requires(LabelType label) { std::is_same_v<Filter, NoneT
 
 export struct HnswInsertConfig {
     bool optimize_;
+    IndexBuildJob *build_job_ = nullptr; // progress and cancellation of CREATE INDEX
 };
 
 export constexpr HnswInsertConfig kDefaultHnswInsertConfig = {
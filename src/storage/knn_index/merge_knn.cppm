@@ -53,6 +53,17 @@ public:
 
     void Search(const QueryElemType *query, const QueryElemType *data, u32 dim, DistFunc dist_f, u16 row_cnt, u32 segment_id, u16 block_id, const Bitmask &bitmask);
 
+    // Rows of another element type than the query, e.g. the raw bits of float16 rows, compared by `dist_f` as they are
+    template <typename DataElemType>
+    void Search(const QueryElemType *query,
+                const DataElemType *data,
+                u32 dim,
+                DistType (*dist_f)(const QueryElemType *, const DataElemType *, SizeT),
+                u16 row_cnt,
+                u32 segment_id,
+                u16 block_id,
+                const Bitmask &bitmask);
+
     void Search(const DistType *dist, const RowID *row_ids, u16 count);
 
     void Search(SizeT query_id, const DistType *dist, const RowID *row_ids, u16 count);
@@ -69,6 +80,9 @@ public:
 
     DistType *GetDistancesByIdx(u64 idx) const;
 
+    // The worst merged distance of query `idx` once `topk` results are merged, results farther than it can be skipped.
+    Optional<DistType> GetKthDistance(u64 idx) const;
+
     RowID *GetIDsByIdx(u64 idx) const;
 
     i64 total_count() const { return total_count_; }
@@ -138,6 +152,33 @@ void MergeKnn<QueryElemType, C, DistType>::Search(const QueryElemType *query,
     }
 }
 
+template <typename QueryElemType, template <typename, typename> typename C, typename DistType>
+template <typename DataElemType>
+void MergeKnn<QueryElemType, C, DistType>::Search(const QueryElemType *query,
+                                                  const DataElemType *data,
+                                                  u32 dim,
+                                                  DistType (*dist_f)(const QueryElemType *, const DataElemType *, SizeT),
+                                                  u16 row_cnt,
+                                                  u32 segment_id,
+                                                  u16 block_id,
+                                                  const Bitmask &bitmask) {
+    const bool all_true = bitmask.IsAllTrue();
+    u32 segment_offset_start = block_id * DEFAULT_BLOCK_CAPACITY;
+    for (u64 i = 0; i < this->query_count_; ++i) {
+        const QueryElemType *x_i = query + i * dim;
+        const DataElemType *y_j = data;
+        for (u16 j = 0; j < row_cnt; ++j, y_j += dim) {
+            if (all_true || bitmask.IsTrue(j)) {
+                if (i == 0) {
+                    ++this->total_count_;
+                }
+                auto dist = dist_f(x_i, y_j, dim);
+                result_handler_->AddResult(i, dist, RowID(segment_id, segment_offset_start + j));
+            }
+        }
+    }
+}
+
 template <typename QueryElemType, template <typename, typename> typename C, typename DistType>
 void MergeKnn<QueryElemType, C, DistType>::Search(const DistType *dist, const RowID *row_ids, u16 count) {
     this->total_count_ += count;
@@ -207,6 +248,14 @@ DistType *MergeKnn<QueryElemType, C, DistType>::GetDistancesByIdx(u64 idx) const
     return distance_array_.get() + idx * this->topk_;
 }
 
+template <typename QueryElemType, template <typename, typename> typename C, typename DistType>
+Optional<DistType> MergeKnn<QueryElemType, C, DistType>::GetKthDistance(u64 idx) const {
+    if (!this->begin_ || result_handler_->GetSize(idx) < u32(this->topk_)) {
+        return None;
+    }
+    return result_handler_->GetDistance0(idx);
+}
+
 template <typename QueryElemType, template <typename, typename> typename C, typename DistType>
 RowID *MergeKnn<QueryElemType, C, DistType>::GetIDsByIdx(u64 idx) const {
     if (idx >= this->query_count_) {
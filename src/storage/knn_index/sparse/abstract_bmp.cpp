@@ -24,6 +24,8 @@ import block_column_iter;
 import sparse_util;
 import segment_iter;
 import segment_entry;
+import infinity_exception;
+import default_values;
 
 namespace infinity {
 
@@ -128,6 +130,27 @@ void BMPIndexInMem::AddDocs(const SegmentEntry *segment_entry, BufferManager *bu
         bmp_);
 }
 
+void BMPIndexInMem::AddDocs(const AbstractBMP &compacted_bmp, const Vector<SegmentOffset> &row_map) {
+    std::visit(
+        [&](auto &&index, auto &&compacted_index) {
+            using T = std::decay_t<decltype(index)>;
+            using CompactedT = std::decay_t<decltype(compacted_index)>;
+            if constexpr (std::is_same_v<T, std::nullptr_t> || std::is_same_v<CompactedT, std::nullptr_t>) {
+                return;
+            } else if constexpr (!std::is_same_v<T, CompactedT>) {
+                UnrecoverableError("BMP index of the compacted segment has another type.");
+            } else {
+                compacted_index->ForEachDoc([&](const auto &doc, BMPDocID doc_id) {
+                    if (doc_id < row_map.size() && row_map[doc_id] != INVALID_SEGMENT_OFFSET) {
+                        index->AddDoc(doc, row_map[doc_id]);
+                    }
+                });
+            }
+        },
+        bmp_,
+        compacted_bmp);
+}
+
 SharedPtr<ChunkIndexEntry> BMPIndexInMem::Dump(SegmentIndexEntry *segment_index_entry, BufferManager *buffer_mgr) {
     SizeT row_count = 0;
     SizeT index_size = 0;
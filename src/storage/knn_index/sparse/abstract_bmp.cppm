@@ -107,6 +107,10 @@ public:
 
     void AddDocs(const SegmentEntry *segment_entry, BufferManager *buffer_mgr, SizeT column_id, TxnTimeStamp begin_ts, bool check_ts);
 
+    // Copy the docs of the index of a compacted segment, `row_map` maps their doc ids to offsets in the new segment.
+    // Docs mapped to INVALID_SEGMENT_OFFSET are dropped.
+    void AddDocs(const AbstractBMP &compacted_bmp, const Vector<SegmentOffset> &row_map);
+
     const AbstractBMP &get() const { return bmp_; }
 
     AbstractBMP &get_ref() { return bmp_; }
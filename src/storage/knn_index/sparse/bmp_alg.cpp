@@ -25,6 +25,7 @@ import third_party;
 import serialize;
 import segment_iter;
 import bp_reordering;
+import status;
 
 namespace infinity {
 
@@ -235,8 +236,16 @@ template class BlockFwd<f64, i32>;
 template class BlockFwd<f64, i16>;
 template class BlockFwd<f64, i8>;
 
+template <typename DataType, typename IdxType, BMPCompressType CompressType>
+void BMPAlg<DataType, IdxType, CompressType>::CheckMutable() const {
+    if (mmap_loaded_) {
+        RecoverableError(Status::NotSupport("BMP index loaded from a memory mapped file can't be modified"));
+    }
+}
+
 template <typename DataType, typename IdxType, BMPCompressType CompressType>
 void BMPAlg<DataType, IdxType, CompressType>::AddDoc(const SparseVecRef<DataType, IdxType> &doc, BMPDocID doc_id, bool lck) {
+    CheckMutable();
     std::unique_lock<std::shared_mutex> lock;
     if (lck) {
         lock = std::unique_lock(mtx_);
@@ -260,6 +269,7 @@ SizeT BMPAlg<DataType, IdxType, CompressType>::DocNum() const {
 
 template <typename DataType, typename IdxType, BMPCompressType CompressType>
 void BMPAlg<DataType, IdxType, CompressType>::Optimize(const BMPOptimizeOptions &options) {
+    CheckMutable();
     std::unique_lock lock(mtx_);
 
     if (options.bp_reorder_) {
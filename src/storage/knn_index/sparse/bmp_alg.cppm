@@ -92,6 +92,8 @@ public:
 
     TailFwd<DataType, IdxType> GetTailFwd() { return std::move(tail_fwd_); }
 
+    const TailFwd<DataType, IdxType> &tail_fwd() const { return tail_fwd_; }
+
     Vector<Vector<DataType>> GetIvtScores(SizeT term_num) const;
 
     Vector<DataType> GetScores(BMPBlockID block_id, const SparseVecRef<DataType, IdxType> &query) const;
@@ -106,7 +108,7 @@ public:
 
     SizeT GetSizeInBytes() const;
     void WriteAdv(char *&p) const;
-    static BlockFwd ReadAdv(const char *&p);
+    static BlockFwd ReadAdv(const char *&p, bool copy = true);
 
 private:
     static void Calculate(SizeT block_size, const BMPBlockOffset *block_offsets, const DataType *scores, Vector<DataType> &res, DataType query_score);
@@ -124,8 +126,8 @@ public:
     using IdxT = IdxType;
 
 private:
-    BMPAlg(BMPIvt<DataType, CompressType> bm_ivt, BlockFwd<DataType, IdxType> block_fwd, Vector<BMPDocID> doc_ids)
-        : bm_ivt_(std::move(bm_ivt)), block_fwd_(std::move(block_fwd)), doc_ids_(std::move(doc_ids)) {}
+    BMPAlg(BMPIvt<DataType, CompressType> bm_ivt, BlockFwd<DataType, IdxType> block_fwd, Vector<BMPDocID> doc_ids, bool mmap_loaded)
+        : bm_ivt_(std::move(bm_ivt)), block_fwd_(std::move(block_fwd)), doc_ids_(std::move(doc_ids)), mmap_loaded_(mmap_loaded) {}
 
 public:
     BMPAlg(SizeT term_num, SizeT block_size) : bm_ivt_(term_num), block_fwd_(block_size) {}
@@ -137,6 +139,10 @@ public:
 
     SizeT DocNum() const;
 
+    // Call `fn(doc, doc_id)` for every doc of the index
+    template <typename Fn>
+    void ForEachDoc(Fn &&fn) const;
+
     void Optimize(const BMPOptimizeOptions &options);
 
     Pair<Vector<BMPDocID>, Vector<DataType>> SearchKnn(const SparseVecRef<DataType, IdxType> &query, i32 topk, const BmpSearchOptions &options) const;
@@ -149,17 +155,26 @@ public:
 
     static BMPAlg<DataType, IdxType, CompressType> Load(FileHandler &file_handler);
 
+    // Load from a private mapping of the index file, the forward blocks stay in the mapping. The index is read only:
+    // adding docs and optimize raise an error.
+    static BMPAlg<DataType, IdxType, CompressType> LoadFromPtr(const char *&p);
+
+    bool mmap_loaded() const { return mmap_loaded_; }
+
     SizeT GetSizeInBytes() const;
 
 private:
     void WriteAdv(char *&p) const;
 
-    static BMPAlg<DataType, IdxType, CompressType> ReadAdv(const char *&p);
+    static BMPAlg<DataType, IdxType, CompressType> ReadAdv(const char *&p, bool copy = true);
+
+    void CheckMutable() const;
 
 private:
     BMPIvt<DataType, CompressType> bm_ivt_;
     BlockFwd<DataType, IdxType> block_fwd_;
     Vector<BMPDocID> doc_ids_;
+    bool mmap_loaded_ = false;
 
     mutable std::shared_mutex mtx_;
 };
@@ -180,6 +195,23 @@ SizeT BMPAlg<DataType, IdxType, CompressType>::AddDocs(Iterator iter) {
     return cnt;
 }
 
+template <typename DataType, typename IdxType, BMPCompressType CompressType>
+template <typename Fn>
+void BMPAlg<DataType, IdxType, CompressType>::ForEachDoc(Fn &&fn) const {
+    std::shared_lock lock(mtx_);
+    // The docs of the full blocks, then the docs of the tail
+    Vector<Pair<Vector<IdxType>, Vector<DataType>>> fwd = block_fwd_.GetFwd(doc_ids_.size(), bm_ivt_.term_num());
+    for (SizeT i = 0; i < fwd.size(); ++i) {
+        SparseVecRef<DataType, IdxType> doc((i32)fwd[i].first.size(), fwd[i].first.data(), fwd[i].second.data());
+        fn(doc, doc_ids_[i]);
+    }
+    const auto &tail_terms = block_fwd_.tail_fwd().GetTailTerms();
+    for (SizeT i = 0; i < tail_terms.size(); ++i) {
+        SparseVecRef<DataType, IdxType> doc((i32)tail_terms[i].first.size(), tail_terms[i].first.data(), tail_terms[i].second.data());
+        fn(doc, doc_ids_[fwd.size() + i]);
+    }
+}
+
 template <typename DataType, typename IdxType, BMPCompressType CompressType>
 template <FilterConcept<BMPDocID> Filter>
 Pair<Vector<BMPDocID>, Vector<DataType>> BMPAlg<DataType, IdxType, CompressType>::SearchKnn(const SparseVecRef<DataType, IdxType> &query,
@@ -135,13 +135,13 @@ void BlockFwd<DataType, IdxType>::WriteAdv(char *&p) const {
 }
 
 template <typename DataType, typename IdxType>
-BlockFwd<DataType, IdxType> BlockFwd<DataType, IdxType>::ReadAdv(const char *&p) {
+BlockFwd<DataType, IdxType> BlockFwd<DataType, IdxType>::ReadAdv(const char *&p, bool copy) {
     SizeT block_size = ReadBufAdv<SizeT>(p);
     SizeT block_num = ReadBufAdv<SizeT>(p);
     Vector<BlockTerms<DataType, IdxType>> block_terms_list;
     block_terms_list.reserve(block_num);
     for (SizeT i = 0; i < block_num; ++i) {
-        auto block_terms = BlockTerms<DataType, IdxType>::ReadAdv(p);
+        auto block_terms = BlockTerms<DataType, IdxType>::ReadAdv(p, copy);
         block_terms_list.push_back(std::move(block_terms));
     }
     auto tail_fwd = TailFwd<DataType, IdxType>::ReadAdv(p);
@@ -180,6 +180,13 @@ BMPAlg<DataType, IdxType, CompressType> BMPAlg<DataType, IdxType, CompressType>:
     return ReadAdv(p);
 }
 
+template <typename DataType, typename IdxType, BMPCompressType CompressType>
+BMPAlg<DataType, IdxType, CompressType> BMPAlg<DataType, IdxType, CompressType>::LoadFromPtr(const char *&p) {
+    // The index is not movable, the caller checks `p` against the size of the mapping
+    ReadBufAdv<SizeT>(p);
+    return ReadAdv(p, false);
+}
+
 template <typename DataType, typename IdxType, BMPCompressType CompressType>
 SizeT BMPAlg<DataType, IdxType, CompressType>::GetSizeInBytes() const {
     std::shared_lock lock(mtx_);
@@ -204,15 +211,15 @@ void BMPAlg<DataType, IdxType, CompressType>::WriteAdv(char *&p) const {
 }
 
 template <typename DataType, typename IdxType, BMPCompressType CompressType>
-BMPAlg<DataType, IdxType, CompressType> BMPAlg<DataType, IdxType, CompressType>::ReadAdv(const char *&p) {
+BMPAlg<DataType, IdxType, CompressType> BMPAlg<DataType, IdxType, CompressType>::ReadAdv(const char *&p, bool copy) {
     auto postings = BMPIvt<DataType, CompressType>::ReadAdv(p);
-    auto block_fwd = BlockFwd<DataType, IdxType>::ReadAdv(p);
+    auto block_fwd = BlockFwd<DataType, IdxType>::ReadAdv(p, copy);
     SizeT doc_num = ReadBufAdv<SizeT>(p);
     Vector<BMPDocID> doc_ids(doc_num);
     for (SizeT i = 0; i < doc_num; ++i) {
         doc_ids[i] = ReadBufAdv<BMPDocID>(p);
     }
-    return BMPAlg(std::move(postings), std::move(block_fwd), std::move(doc_ids));
+    return BMPAlg(std::move(postings), std::move(block_fwd), std::move(doc_ids), !copy);
 }
 
 template class BMPAlg<f32, i32, BMPCompressType::kCompressed>;
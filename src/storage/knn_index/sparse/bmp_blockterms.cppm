@@ -61,8 +61,8 @@ class BlockTerms {
 
 public:
     BlockTerms(const Vector<Tuple<IdxType, Vector<BMPBlockOffset>, Vector<DataType>>> &block_terms)
-        : data_len_(GetBufferSize(block_terms)), data_(MakeUniqueForOverwrite<char[]>(data_len_)) {
-        char *ptr = data_.get();
+        : data_len_(GetBufferSize(block_terms)), data_holder_(MakeUniqueForOverwrite<char[]>(data_len_)), data_(data_holder_.get()) {
+        char *ptr = data_holder_.get();
         for (const auto &[term_id, block_offsets, values] : block_terms) {
             SizeT block_size = block_offsets.size();
             WriteBufAdv(ptr, block_size);
@@ -88,20 +88,28 @@ private:
         return size;
     }
 
-    BlockTerms(SizeT data_len, UniquePtr<char[]> data) : data_len_(data_len), data_(std::move(data)) {}
+    BlockTerms(SizeT data_len, UniquePtr<char[]> data) : data_len_(data_len), data_holder_(std::move(data)), data_(data_holder_.get()) {}
+
+    BlockTerms(SizeT data_len, const char *data) : data_len_(data_len), data_(data) {}
 
 public:
-    IterT Iter() const { return IterT(data_.get(), data_.get() + data_len_); }
+    IterT Iter() const { return IterT(data_, data_ + data_len_); }
 
     SizeT GetSizeInBytes() const { return sizeof(data_len_) + data_len_; }
 
     void WriteAdv(char *&p) const {
         WriteBufAdv(p, data_len_);
-        WriteBufVecAdv(p, data_.get(), data_len_);
+        WriteBufVecAdv(p, data_, data_len_);
     }
 
-    static BlockTerms<DataType, IdxType> ReadAdv(const char *&p) {
+    // Without `copy` the block terms refer to `p` directly, which must outlive them.
+    static BlockTerms<DataType, IdxType> ReadAdv(const char *&p, bool copy = true) {
         SizeT data_len = ReadBufAdv<SizeT>(p);
+        if (!copy) {
+            const char *data = p;
+            p += data_len;
+            return BlockTerms<DataType, IdxType>(data_len, data);
+        }
         UniquePtr<char[]> data = MakeUniqueForOverwrite<char[]>(data_len);
         std::memcpy(data.get(), p, data_len);
         p += data_len;
@@ -109,13 +117,14 @@ public:
     }
 
     void Prefetch() const {
-        const char *ptr = data_.get();
+        const char *ptr = data_;
         _mm_prefetch(ptr, _MM_HINT_T0);
     }
 
 private:
     SizeT data_len_{};
-    UniquePtr<char[]> data_{};
+    UniquePtr<char[]> data_holder_{};
+    const char *data_{};
 };
 
 } // namespace infinity
\ No newline at end of file
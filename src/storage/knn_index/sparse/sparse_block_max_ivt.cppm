@@ -0,0 +1,332 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+export module sparse_block_max_ivt;
+
+import stl;
+import sparse_util;
+
+namespace infinity {
+
+export class SparseBlockMaxIvtBase {
+public:
+    explicit SparseBlockMaxIvtBase(SizeT row_count) : row_count_(row_count) {}
+
+    virtual ~SparseBlockMaxIvtBase() = default;
+
+    // The first `row_count()` rows of the block are indexed
+    SizeT row_count() const { return row_count_; }
+
+    virtual SizeT MemoryUsage() const = 0;
+
+private:
+    const SizeT row_count_;
+};
+
+// An in-memory inverted index of the rows of a block, for the inner product top-k of a sparse column without BMP index.
+// The rows are split into groups of kGroupSize. A term keeps the max and min value of every group it appears in, so a group
+// is skipped once its upper bound is below the k-th score. Postings store the u8 row offset in the group and the value
+// quantized to u8 between the min and max of the group. The quantized values only bound the score of a row, the rows which
+// may enter the top-k are scored on the block data.
+// The index is made of immutable chunks of kChunkRowCount rows, so that an index extended to the rows appended since only
+// builds the last chunk again.
+export template <typename DataType, typename IdxType>
+class SparseBlockMaxIvt final : public SparseBlockMaxIvtBase {
+public:
+    static constexpr SizeT kGroupSize = 64;
+
+    static constexpr SizeT kChunkRowCount = 1024;
+
+    // Smaller blocks are cheaper to scan than to index
+    static constexpr SizeT kMinRowCount = 1024;
+
+    // `get_row(row)` returns the SparseVecRef of a row
+    template <typename GetRow>
+    SparseBlockMaxIvt(SizeT row_count, GetRow &&get_row);
+
+    // The index of the first `row_count` rows, sharing the complete chunks of this one
+    template <typename GetRow>
+    SharedPtr<SparseBlockMaxIvt> Extend(SizeT row_count, GetRow &&get_row) const;
+
+    // Call `add_result(row, score)` for the rows below `row_count` which may enter the top-k, with `score_row(row)` the score
+    // of the row. Groups are visited in descending order of upper bound, and the search stops at the first one below
+    // `kth_score()`, an Optional of the k-th score so far.
+    template <typename ResultType, typename KthScore, typename ScoreRow, typename AddResult>
+    void Search(const SparseVecRef<DataType, IdxType> &query,
+                SizeT row_count,
+                KthScore &&kth_score,
+                ScoreRow &&score_row,
+                AddResult &&add_result) const;
+
+    SizeT MemoryUsage() const final;
+
+private:
+    struct Chunk {
+        template <typename GetRow>
+        Chunk(SizeT row_begin, SizeT row_end, GetRow &&get_row);
+
+        SizeT MemoryUsage() const;
+
+        SizeT row_begin_{};
+        // Sorted, the groups of terms_[i] are [term_groups_[i], term_groups_[i + 1])
+        Vector<IdxType> terms_;
+        Vector<u32> term_groups_;
+        // Group id in the chunk. The postings of group g are [group_postings_[g], group_postings_[g + 1])
+        Vector<u16> group_ids_;
+        Vector<DataType> group_max_;
+        Vector<DataType> group_min_;
+        Vector<u32> group_postings_;
+        // Row offsets in the group
+        Vector<u8> posting_offsets_;
+        Vector<u8> posting_values_;
+    };
+
+    static constexpr f64 kQuantizeLevels = 255.0;
+    // Relative slack of the bounds over the rounding of the scores
+    static constexpr f64 kBoundSlack = 1e-6;
+
+    // The value of a posting is in [lower, upper] of its code
+    static f64 QuantizeStep(DataType min, DataType max) { return (static_cast<f64>(max) - static_cast<f64>(min)) / kQuantizeLevels; }
+
+    static u8 Quantize(DataType value, DataType min, f64 step) {
+        if (step == 0) {
+            return 0;
+        }
+        f64 code = std::floor((static_cast<f64>(value) - static_cast<f64>(min)) / step);
+        return static_cast<u8>(std::clamp(code, 0.0, kQuantizeLevels - 1));
+    }
+
+    // The bounds of a code are widened by a step, which covers the rounding of Quantize()
+    static f64 LowerBound(u8 code, DataType min, f64 step) { return static_cast<f64>(min) + (static_cast<f64>(code) - 1) * step; }
+
+    static f64 UpperBound(u8 code, DataType min, f64 step) { return static_cast<f64>(min) + (static_cast<f64>(code) + 2) * step; }
+
+    static bool BelowKth(f64 bound, f64 kth) { return bound + kBoundSlack * (std::abs(bound) + std::abs(kth)) < kth; }
+
+    explicit SparseBlockMaxIvt(SizeT row_count, Vector<SharedPtr<const Chunk>> chunks)
+        : SparseBlockMaxIvtBase(row_count), chunks_(std::move(chunks)) {}
+
+    Vector<SharedPtr<const Chunk>> chunks_;
+};
+
+template <typename DataType, typename IdxType>
+template <typename GetRow>
+SparseBlockMaxIvt<DataType, IdxType>::Chunk::Chunk(SizeT row_begin, SizeT row_end, GetRow &&get_row) : row_begin_(row_begin) {
+    // The term of every posting in row order, then the postings of each term in row order
+    Vector<IdxType> posting_terms;
+    for (SizeT row = row_begin; row < row_end; ++row) {
+        const SparseVecRef<DataType, IdxType> vec = get_row(row);
+        for (i32 i = 0; i < vec.nnz_; ++i) {
+            if (vec.data_[i] != DataType{}) {
+                posting_terms.push_back(vec.indices_[i]);
+            }
+        }
+    }
+    terms_ = posting_terms;
+    std::sort(terms_.begin(), terms_.end());
+    terms_.erase(std::unique(terms_.begin(), terms_.end()), terms_.end());
+
+    const SizeT posting_num = posting_terms.size();
+    Vector<u32> term_postings(terms_.size() + 1, 0);
+    Vector<u32> posting_term_ids(posting_num);
+    for (SizeT i = 0; i < posting_num; ++i) {
+        posting_term_ids[i] = std::lower_bound(terms_.begin(), terms_.end(), posting_terms[i]) - terms_.begin();
+        ++term_postings[posting_term_ids[i] + 1];
+    }
+    std::partial_sum(term_postings.begin(), term_postings.end(), term_postings.begin());
+
+    Vector<u16> posting_rows(posting_num);
+    Vector<DataType> posting_values(posting_num);
+    {
+        Vector<u32> cursors(term_postings.begin(), term_postings.end() - 1);
+        SizeT posting_i = 0;
+        for (SizeT row = row_begin; row < row_end; ++row) {
+            const SparseVecRef<DataType, IdxType> vec = get_row(row);
+            for (i32 i = 0; i < vec.nnz_; ++i) {
+                if (vec.data_[i] != DataType{}) {
+                    u32 &cursor = cursors[posting_term_ids[posting_i++]];
+                    posting_rows[cursor] = row - row_begin;
+                    posting_values[cursor] = vec.data_[i];
+                    ++cursor;
+                }
+            }
+        }
+    }
+
+    posting_offsets_.resize(posting_num);
+    term_groups_.reserve(terms_.size() + 1);
+    for (SizeT term_i = 0; term_i < terms_.size(); ++term_i) {
+        term_groups_.push_back(group_ids_.size());
+        for (u32 posting_i = term_postings[term_i]; posting_i < term_postings[term_i + 1]; ++posting_i) {
+            const u16 group_id = posting_rows[posting_i] / kGroupSize;
+            const DataType value = posting_values[posting_i];
+            if (posting_i == term_postings[term_i] || group_id != group_ids_.back()) {
+                group_ids_.push_back(group_id);
+                group_max_.push_back(value);
+                group_min_.push_back(value);
+                group_postings_.push_back(posting_i);
+            } else {
+                group_max_.back() = std::max(group_max_.back(), value);
+                group_min_.back() = std::min(group_min_.back(), value);
+            }
+            posting_offsets_[posting_i] = posting_rows[posting_i] % kGroupSize;
+        }
+    }
+    term_groups_.push_back(group_ids_.size());
+    group_postings_.push_back(posting_num);
+
+    posting_values_.resize(posting_num);
+    for (SizeT g = 0; g + 1 < group_postings_.size(); ++g) {
+        const f64 step = QuantizeStep(group_min_[g], group_max_[g]);
+        for (u32 posting_i = group_postings_[g]; posting_i < group_postings_[g + 1]; ++posting_i) {
+            posting_values_[posting_i] = Quantize(posting_values[posting_i], group_min_[g], step);
+        }
+    }
+}
+
+template <typename DataType, typename IdxType>
+SizeT SparseBlockMaxIvt<DataType, IdxType>::Chunk::MemoryUsage() const {
+    return sizeof(Chunk) + terms_.capacity() * sizeof(IdxType) + term_groups_.capacity() * sizeof(u32) + group_ids_.capacity() * sizeof(u16) +
+           (group_max_.capacity() + group_min_.capacity()) * sizeof(DataType) + group_postings_.capacity() * sizeof(u32) +
+           posting_offsets_.capacity() + posting_values_.capacity();
+}
+
+template <typename DataType, typename IdxType>
+template <typename GetRow>
+SparseBlockMaxIvt<DataType, IdxType>::SparseBlockMaxIvt(SizeT row_count, GetRow &&get_row) : SparseBlockMaxIvtBase(row_count) {
+    for (SizeT row_begin = 0; row_begin < row_count; row_begin += kChunkRowCount) {
+        chunks_.push_back(MakeShared<const Chunk>(row_begin, std::min(row_begin + kChunkRowCount, row_count), get_row));
+    }
+}
+
+template <typename DataType, typename IdxType>
+template <typename GetRow>
+SharedPtr<SparseBlockMaxIvt<DataType, IdxType>> SparseBlockMaxIvt<DataType, IdxType>::Extend(SizeT row_count, GetRow &&get_row) const {
+    row_count = std::max(row_count, this->row_count());
+    // The complete chunks are shared, a partial last one is built again
+    Vector<SharedPtr<const Chunk>> chunks(chunks_.begin(), chunks_.begin() + this->row_count() / kChunkRowCount);
+    for (SizeT row_begin = chunks.size() * kChunkRowCount; row_begin < row_count; row_begin += kChunkRowCount) {
+        chunks.push_back(MakeShared<const Chunk>(row_begin, std::min(row_begin + kChunkRowCount, row_count), get_row));
+    }
+    return SharedPtr<SparseBlockMaxIvt>(new SparseBlockMaxIvt(row_count, std::move(chunks)));
+}
+
+template <typename DataType, typename IdxType>
+SizeT SparseBlockMaxIvt<DataType, IdxType>::MemoryUsage() const {
+    SizeT memory_usage = sizeof(*this) + chunks_.capacity() * sizeof(SharedPtr<const Chunk>);
+    for (const auto &chunk : chunks_) {
+        memory_usage += chunk->MemoryUsage();
+    }
+    return memory_usage;
+}
+
+template <typename DataType, typename IdxType>
+template <typename ResultType, typename KthScore, typename ScoreRow, typename AddResult>
+void SparseBlockMaxIvt<DataType, IdxType>::Search(const SparseVecRef<DataType, IdxType> &query,
+                                                  SizeT row_count,
+                                                  KthScore &&kth_score,
+                                                  ScoreRow &&score_row,
+                                                  AddResult &&add_result) const {
+    row_count = std::min(row_count, this->row_count());
+    const SizeT group_num = (row_count + kGroupSize - 1) / kGroupSize;
+    constexpr SizeT kChunkGroupNum = kChunkRowCount / kGroupSize;
+
+    // The (chunk, group in chunk, query term) of the query terms, then grouped by block group
+    struct Hit {
+        u32 chunk_i_;
+        u32 g_;
+        i32 query_i_;
+    };
+    Vector<f64> upper_bounds(group_num, 0);
+    Vector<Hit> query_hits;
+    Vector<u32> group_hits(group_num + 1, 0);
+    for (u32 chunk_i = 0; chunk_i < chunks_.size() && chunks_[chunk_i]->row_begin_ < row_count; ++chunk_i) {
+        const Chunk &chunk = *chunks_[chunk_i];
+        const SizeT group_begin = chunk_i * kChunkGroupNum;
+        for (i32 i = 0; i < query.nnz_; ++i) {
+            auto iter = std::lower_bound(chunk.terms_.begin(), chunk.terms_.end(), query.indices_[i]);
+            if (iter == chunk.terms_.end() || *iter != query.indices_[i]) {
+                continue;
+            }
+            const SizeT term_i = iter - chunk.terms_.begin();
+            const f64 query_value = query.data_[i];
+            for (u32 g = chunk.term_groups_[term_i]; g < chunk.term_groups_[term_i + 1] && group_begin + chunk.group_ids_[g] < group_num; ++g) {
+                // A row without the term gets 0 from it
+                const f64 max_score = query_value * static_cast<f64>(chunk.group_max_[g]);
+                const f64 min_score = query_value * static_cast<f64>(chunk.group_min_[g]);
+                const SizeT group_id = group_begin + chunk.group_ids_[g];
+                upper_bounds[group_id] += std::max(std::max(max_score, min_score), 0.0);
+                query_hits.push_back({chunk_i, g, i});
+                ++group_hits[group_id + 1];
+            }
+        }
+    }
+    std::partial_sum(group_hits.begin(), group_hits.end(), group_hits.begin());
+    Vector<Hit> hits(query_hits.size());
+    {
+        Vector<u32> cursors(group_hits.begin(), group_hits.end() - 1);
+        for (const auto &hit : query_hits) {
+            hits[cursors[hit.chunk_i_ * kChunkGroupNum + chunks_[hit.chunk_i_]->group_ids_[hit.g_]]++] = hit;
+        }
+    }
+
+    Vector<u32> group_order(group_num);
+    std::iota(group_order.begin(), group_order.end(), 0);
+    std::sort(group_order.begin(), group_order.end(), [&](u32 a, u32 b) {
+        return upper_bounds[a] > upper_bounds[b] || (upper_bounds[a] == upper_bounds[b] && a < b);
+    });
+
+    Array<f64, kGroupSize> row_bounds;
+    Array<bool, kGroupSize> row_hit;
+    for (u32 group_id : group_order) {
+        if (Optional<ResultType> kth = kth_score(); kth.has_value() && BelowKth(upper_bounds[group_id], static_cast<f64>(*kth))) {
+            break;
+        }
+        row_bounds.fill(0);
+        row_hit.fill(false);
+        for (u32 hit_i = group_hits[group_id]; hit_i < group_hits[group_id + 1]; ++hit_i) {
+            const auto &[chunk_i, g, query_i] = hits[hit_i];
+            const Chunk &chunk = *chunks_[chunk_i];
+            const f64 query_value = query.data_[query_i];
+            const DataType min = chunk.group_min_[g];
+            const f64 step = QuantizeStep(min, chunk.group_max_[g]);
+            for (u32 posting_i = chunk.group_postings_[g]; posting_i < chunk.group_postings_[g + 1]; ++posting_i) {
+                const u8 code = chunk.posting_values_[posting_i];
+                const f64 value = query_value >= 0 ? UpperBound(code, min, step) : LowerBound(code, min, step);
+                const u8 offset = chunk.posting_offsets_[posting_i];
+                row_bounds[offset] += query_value * value;
+                row_hit[offset] = true;
+            }
+        }
+        const SizeT row_begin = group_id * kGroupSize;
+        const SizeT row_end = std::min(row_begin + kGroupSize, row_count);
+        for (SizeT row = row_begin; row < row_end; ++row) {
+            const SizeT offset = row - row_begin;
+            if (Optional<ResultType> kth = kth_score(); kth.has_value() && BelowKth(row_bounds[offset], static_cast<f64>(*kth))) {
+                continue;
+            }
+            // A row without any query term scores 0
+            add_result(row, row_hit[offset] ? score_row(row) : ResultType{});
+        }
+    }
+}
+
+} // namespace infinity
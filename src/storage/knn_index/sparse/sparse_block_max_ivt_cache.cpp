@@ -0,0 +1,98 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <vector>
+
+module sparse_block_max_ivt_cache;
+
+import stl;
+import sparse_block_max_ivt;
+import default_values;
+
+namespace infinity {
+
+SharedPtr<SparseBlockMaxIvtBase> SparseBlockMaxIvtSlot::Get(SizeT row_count, const BuildFunc &build) {
+    auto &cache = SparseBlockMaxIvtCache::instance();
+    last_used_.store(cache.Tick());
+    SharedPtr<SparseBlockMaxIvtBase> ivt;
+    bool built = false;
+    {
+        // Building reads the whole block, concurrent searches wait for it instead of building again
+        std::lock_guard lock(mutex_);
+        if (ivt_.get() == nullptr || ivt_->row_count() < row_count) {
+            ivt_ = build(ivt_.get());
+            memory_usage_.store(ivt_->MemoryUsage());
+            built = true;
+        }
+        ivt = ivt_;
+    }
+    // The cache locks the slots it evicts, so it is not called with the slot locked
+    if (built) {
+        cache.Add(shared_from_this());
+    }
+    return ivt;
+}
+
+void SparseBlockMaxIvtSlot::Evict() {
+    std::lock_guard lock(mutex_);
+    ivt_.reset();
+    memory_usage_.store(0);
+}
+
+SparseBlockMaxIvtCache::SparseBlockMaxIvtCache() : memory_limit_(DEFAULT_SPARSE_BLOCK_MAX_IVT_MEMORY_LIMIT) {}
+
+void SparseBlockMaxIvtCache::Add(SharedPtr<SparseBlockMaxIvtSlot> slot) {
+    std::lock_guard lock(mutex_);
+    Vector<SharedPtr<SparseBlockMaxIvtSlot>> slots;
+    SizeT memory_usage = slot->memory_usage();
+    for (const auto &weak_slot : slots_) {
+        SharedPtr<SparseBlockMaxIvtSlot> other = weak_slot.lock();
+        if (other.get() != nullptr && other != slot && other->memory_usage() > 0) {
+            memory_usage += other->memory_usage();
+            slots.push_back(std::move(other));
+        }
+    }
+    if (memory_usage > memory_limit_.load()) {
+        std::sort(slots.begin(), slots.end(), [](const auto &a, const auto &b) { return a->last_used() < b->last_used(); });
+        SizeT evict_n = 0;
+        while (evict_n < slots.size() && memory_usage > memory_limit_.load()) {
+            memory_usage -= std::min(memory_usage, slots[evict_n]->memory_usage());
+            slots[evict_n]->Evict();
+            ++evict_n;
+        }
+        slots.erase(slots.begin(), slots.begin() + evict_n);
+    }
+    slots.push_back(std::move(slot));
+
+    slots_.clear();
+    for (const auto &kept_slot : slots) {
+        slots_.push_back(kept_slot);
+    }
+}
+
+SizeT SparseBlockMaxIvtCache::memory_usage() const {
+    std::lock_guard lock(mutex_);
+    SizeT memory_usage = 0;
+    for (const auto &weak_slot : slots_) {
+        if (SharedPtr<SparseBlockMaxIvtSlot> slot = weak_slot.lock(); slot.get() != nullptr) {
+            memory_usage += slot->memory_usage();
+        }
+    }
+    return memory_usage;
+}
+
+} // namespace infinity
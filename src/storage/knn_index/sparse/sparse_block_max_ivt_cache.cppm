@@ -0,0 +1,72 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <functional>
+
+export module sparse_block_max_ivt_cache;
+
+import stl;
+import singleton;
+import sparse_block_max_ivt;
+
+namespace infinity {
+
+// The block-max inverted index of one sparse column block. The index is rebuilt from the block data once evicted.
+export class SparseBlockMaxIvtSlot : public EnableSharedFromThis<SparseBlockMaxIvtSlot> {
+public:
+    // `build(old)` returns the index of `row_count` rows, with `old` the index of fewer rows or nullptr
+    using BuildFunc = std::function<SharedPtr<SparseBlockMaxIvtBase>(const SparseBlockMaxIvtBase *old)>;
+
+    SharedPtr<SparseBlockMaxIvtBase> Get(SizeT row_count, const BuildFunc &build);
+
+    void Evict();
+
+    SizeT memory_usage() const { return memory_usage_.load(); }
+
+    u64 last_used() const { return last_used_.load(); }
+
+private:
+    std::mutex mutex_{};
+    SharedPtr<SparseBlockMaxIvtBase> ivt_{};
+    Atomic<SizeT> memory_usage_{0};
+    Atomic<u64> last_used_{0};
+};
+
+// Bounds the memory of the block-max inverted indexes of all blocks. The least recently used indexes are evicted once a new
+// one goes over the limit. Searches holding an evicted index keep it until they finish.
+export class SparseBlockMaxIvtCache : public Singleton<SparseBlockMaxIvtCache> {
+public:
+    SparseBlockMaxIvtCache();
+
+    // Called with the index of `slot` built or extended, may evict the other slots
+    void Add(SharedPtr<SparseBlockMaxIvtSlot> slot);
+
+    u64 Tick() { return ++tick_; }
+
+    SizeT memory_usage() const;
+
+    SizeT memory_limit() const { return memory_limit_.load(); }
+
+    void SetMemoryLimit(SizeT memory_limit) { memory_limit_.store(memory_limit); }
+
+private:
+    mutable std::mutex mutex_{};
+    Vector<WeakPtr<SparseBlockMaxIvtSlot>> slots_{};
+    Atomic<u64> tick_{0};
+    Atomic<SizeT> memory_limit_;
+};
+
+} // namespace infinity
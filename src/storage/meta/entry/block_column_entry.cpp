@@ -37,9 +37,24 @@ import internal_types;
 import data_type;
 import logical_type;
 import infinity_context;
+import sparse_block_max_ivt;
+import sparse_block_max_ivt_cache;
 
 namespace infinity {
 
+namespace {
+
+// Width of the values held by a column file, the file is encoded with it when persisted
+SizeT EncodingElementSize(const DataType *column_type) {
+    if (column_type->type() == LogicalType::kBoolean) {
+        // Booleans are bit-packed, encode the bytes holding them
+        return 1;
+    }
+    return column_type->Size();
+}
+
+} // namespace
+
 Vector<std::string_view> BlockColumnEntry::DecodeIndex(std::string_view encode) {
     SizeT delimiter_i = encode.rfind('#');
     if (delimiter_i == String::npos) {
@@ -61,7 +76,7 @@ BlockColumnEntry::BlockColumnEntry(const BlockEntry *block_entry, ColumnID colum
 
 BlockColumnEntry::BlockColumnEntry(const BlockColumnEntry &other)
     : BaseEntry(other), block_entry_(other.block_entry_), column_id_(other.column_id_), column_type_(other.column_type_), buffer_(other.buffer_),
-      file_name_(other.file_name_) {
+      file_name_(other.file_name_), outline_with_header_(other.outline_with_header_) {
     std::shared_lock lock(other.mutex_);
     outline_buffers_ = other.outline_buffers_;
     last_chunk_offset_ = other.last_chunk_offset_;
@@ -94,7 +109,8 @@ UniquePtr<BlockColumnEntry> BlockColumnEntry::NewBlockColumnEntry(const BlockEnt
                                                   MakeShared<String>(InfinityContext::instance().config()->TempDir()),
                                                   block_entry->block_dir(),
                                                   block_column_entry->file_name_,
-                                                  total_data_size);
+                                                  total_data_size,
+                                                  EncodingElementSize(column_type));
 
     auto *buffer_mgr = txn->buffer_mgr();
     block_column_entry->buffer_ = buffer_mgr->AllocateBufferObject(std::move(file_worker));
@@ -122,17 +138,22 @@ UniquePtr<BlockColumnEntry> BlockColumnEntry::NewReplayBlockColumnEntry(const Bl
                                                   MakeShared<String>(InfinityContext::instance().config()->TempDir()),
                                                   block_entry->block_dir(),
                                                   column_entry->file_name_,
-                                                  total_data_size);
+                                                  total_data_size,
+                                                  EncodingElementSize(column_type));
 
     column_entry->buffer_ = buffer_manager->GetBufferObject(std::move(file_worker), true /*restart*/);
 
-    if (next_outline_idx > 0) {
+    const u32 outline_count = next_outline_idx & ~kOutlineHeaderFlag;
+    // An outline file created from now on has the header
+    column_entry->outline_with_header_ = outline_count == 0 || (next_outline_idx & kOutlineHeaderFlag) != 0;
+    if (outline_count > 0) {
         SizeT buffer_size = last_chunk_offset;
         auto outline_buffer_file_worker = MakeUnique<VarFileWorker>(MakeShared<String>(InfinityContext::instance().config()->DataDir()),
                                                                     MakeShared<String>(InfinityContext::instance().config()->TempDir()),
                                                                     block_entry->block_dir(),
                                                                     column_entry->OutlineFilename(0),
-                                                                    buffer_size);
+                                                                    buffer_size,
+                                                                    column_entry->outline_with_header_);
         auto *buffer_obj = buffer_manager->GetBufferObject(std::move(outline_buffer_file_worker), true /*restart*/);
         column_entry->outline_buffers_.push_back(buffer_obj);
     }
@@ -176,6 +197,10 @@ Vector<String> BlockColumnEntry::FilePaths() const {
     return res;
 }
 
+SharedPtr<SparseBlockMaxIvtBase> BlockColumnEntry::GetSparseBlockMaxIvt(SizeT row_count, const SparseBlockMaxIvtSlot::BuildFunc &build) {
+    return sparse_block_max_ivt_slot_->Get(row_count, build);
+}
+
 void BlockColumnEntry::Append(const ColumnVector *input_column_vector, u16 input_column_vector_offset, SizeT append_rows, BufferManager *buffer_mgr) {
     if (buffer_.get() == nullptr) {
         String error_message = "Not initialize buffer handle";
@@ -185,9 +210,10 @@ void BlockColumnEntry::Append(const ColumnVector *input_column_vector, u16 input
     column_vector.AppendWith(*input_column_vector, input_column_vector_offset, append_rows);
 }
 
-void BlockColumnEntry::Flush(BlockColumnEntry *block_column_entry, SizeT start_row_count, SizeT checkpoint_row_count) {
+void BlockColumnEntry::Flush(BlockColumnEntry *block_column_entry, SizeT start_row_count, SizeT checkpoint_row_count, bool sealed) {
     // TODO: Opt, Flush certain row_count content
     DataType *column_type = block_column_entry->column_type_.get();
+    const DataFileWorkerSaveCtx save_ctx(sealed);
     switch (column_type->type()) {
         case LogicalType::kBoolean:
         case LogicalType::kTinyInt:
@@ -216,7 +242,7 @@ void BlockColumnEntry::Flush(BlockColumnEntry *block_column_entry, SizeT start_r
         case LogicalType::kRowID: {
             //            SizeT buffer_size = row_count * column_type->Size();
             LOG_TRACE(fmt::format("Saving {}", block_column_entry->column_id()));
-            block_column_entry->buffer_.get()->Save();
+            block_column_entry->buffer_.get()->Save(save_ctx);
             LOG_TRACE(fmt::format("Saved {}", block_column_entry->column_id()));
 
             break;
@@ -228,7 +254,7 @@ void BlockColumnEntry::Flush(BlockColumnEntry *block_column_entry, SizeT start_r
         case LogicalType::kVarchar: {
             //            SizeT buffer_size = row_count * column_type->Size();
             LOG_TRACE(fmt::format("Saving column {}", block_column_entry->column_id()));
-            block_column_entry->buffer_.get()->Save();
+            block_column_entry->buffer_.get()->Save(save_ctx);
             LOG_TRACE(fmt::format("Saved column {}", block_column_entry->column_id()));
 
             std::shared_lock lock(block_column_entry->mutex_);
@@ -269,6 +295,7 @@ void BlockColumnEntry::Cleanup() {
             outline_buffer.get()->PickForCleanup();
         }
     }
+    sparse_block_max_ivt_slot_->Evict();
 }
 
 nlohmann::json BlockColumnEntry::Serialize() {
@@ -276,7 +303,7 @@ nlohmann::json BlockColumnEntry::Serialize() {
     json_res["column_id"] = this->column_id_;
     {
         std::shared_lock lock(mutex_);
-        json_res["next_outline_idx"] = outline_buffers_.size();
+        json_res["next_outline_idx"] = static_cast<u32>(outline_buffers_.size()) | (outline_with_header_ ? kOutlineHeaderFlag : 0);
         json_res["last_chunk_offset"] = this->LastChunkOff();
     }
 
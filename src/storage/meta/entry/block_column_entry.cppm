@@ -29,6 +29,8 @@ import internal_types;
 import base_entry;
 import column_def;
 import value;
+import sparse_block_max_ivt;
+import sparse_block_max_ivt_cache;
 
 namespace infinity {
 
@@ -110,6 +112,22 @@ public:
         return outline_buffers_.size();
     }
 
+    // Set on the `next_outline_idx` kept in the catalog and the wal when the outline files have the var file header.
+    // Files written before the header was introduced are recorded without it and stay in that format.
+    static constexpr u32 kOutlineHeaderFlag = u32(1) << 31;
+
+    // The outline buffer count with kOutlineHeaderFlag, as passed back to NewReplayBlockColumnEntry
+    u32 NextOutlineIdx() const {
+        std::shared_lock lock(mutex_);
+        return static_cast<u32>(outline_buffers_.size()) | (outline_with_header_ ? kOutlineHeaderFlag : 0);
+    }
+
+    bool OutlineWithHeader() const { return outline_with_header_; }
+
+    // The block-max inverted index of a sparse column, built with `build(old)` and kept in SparseBlockMaxIvtCache. An index
+    // of fewer rows than `row_count` is passed to `build` as `old` to be extended by the rows appended since.
+    SharedPtr<SparseBlockMaxIvtBase> GetSparseBlockMaxIvt(SizeT row_count, const SparseBlockMaxIvtSlot::BuildFunc &build);
+
     u64 LastChunkOff() const { return last_chunk_offset_; }
 
     void SetLastChunkOff(u64 offset) { last_chunk_offset_ = offset; }
@@ -117,7 +135,8 @@ public:
 public:
     void Append(const ColumnVector *input_column_vector, u16 input_offset, SizeT append_rows, BufferManager *buffer_mgr);
 
-    static void Flush(BlockColumnEntry *block_column_entry, SizeT start_row_count, SizeT checkpoint_row_count);
+    // `sealed` if the rows of the block won't change any more
+    static void Flush(BlockColumnEntry *block_column_entry, SizeT start_row_count, SizeT checkpoint_row_count, bool sealed);
 
     void Cleanup();
 
@@ -134,6 +153,9 @@ private:
     mutable std::shared_mutex mutex_{};
     Vector<BufferPtr> outline_buffers_;
     u64 last_chunk_offset_{};
+    bool outline_with_header_{true};
+
+    SharedPtr<SparseBlockMaxIvtSlot> sparse_block_max_ivt_slot_ = MakeShared<SparseBlockMaxIvtSlot>();
 };
 
 } // namespace infinity
@@ -414,12 +414,12 @@ void BlockEntry::DropColumns(const Vector<ColumnID> &column_ids, Txn *txn) {
     // columns_ = std::move(new_columns);
 }
 
-void BlockEntry::FlushDataNoLock(SizeT start_row_count, SizeT checkpoint_row_count) {
+void BlockEntry::FlushDataNoLock(SizeT start_row_count, SizeT checkpoint_row_count, bool sealed) {
     SizeT column_count = this->columns_.size();
     SizeT column_idx = 0;
     while (column_idx < column_count) {
         BlockColumnEntry *block_column_entry = this->columns_[column_idx].get();
-        BlockColumnEntry::Flush(block_column_entry, start_row_count, checkpoint_row_count);
+        BlockColumnEntry::Flush(block_column_entry, start_row_count, checkpoint_row_count, sealed);
         LOG_TRACE(fmt::format("ColumnData {} is flushed", block_column_entry->column_id()));
         ++column_idx;
     }
@@ -451,7 +451,9 @@ void BlockEntry::Flush(TxnTimeStamp checkpoint_ts) {
         SizeT checkpoint_row_count = block_version->GetRowCount(checkpoint_ts);
 
         LOG_TRACE("Block entry flush before flush data");
-        FlushDataNoLock(this->checkpoint_row_count_, checkpoint_row_count);
+        // A full block, or the last one of a sealed segment, is flushed for the last time
+        const bool sealed = checkpoint_row_count == row_capacity_ || segment_entry_->status() != SegmentStatus::kUnsealed;
+        FlushDataNoLock(this->checkpoint_row_count_, checkpoint_row_count, sealed);
 
         LOG_TRACE(fmt::format("BlockEntry::Flush: last_ckp_ts: {}, last_ckp_row_count: {} current ckp ts: {} current_ckp_row_count {}",
                               this->checkpoint_ts_,
@@ -469,7 +471,7 @@ void BlockEntry::Flush(TxnTimeStamp checkpoint_ts) {
     }
 }
 
-void BlockEntry::FlushForImport() { FlushDataNoLock(0, this->block_row_count_); }
+void BlockEntry::FlushForImport() { FlushDataNoLock(0, this->block_row_count_, true /*sealed*/); }
 
 void BlockEntry::LoadFilterBinaryData(const String &block_filter_data) { fast_rough_filter_->DeserializeFromString(block_filter_data); }
 
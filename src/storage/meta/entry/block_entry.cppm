@@ -185,7 +185,7 @@ public:
     inline void IncreaseRowCount(SizeT increased_row_count) { block_row_count_ += increased_row_count; }
 
 private:
-    void FlushDataNoLock(SizeT start_row_count, SizeT checkpoint_row_count);
+    void FlushDataNoLock(SizeT start_row_count, SizeT checkpoint_row_count, bool sealed);
 
     bool FlushVersionNoLock(TxnTimeStamp checkpoint_ts);
 
@@ -633,6 +633,11 @@ void SegmentEntry::Cleanup() {
     for (auto &block_entry : block_entries_) {
         block_entry->Cleanup();
     }
+    {
+        // Releases the memory of the codes against their limit
+        std::lock_guard lock(tensor_centroid_codes_mutex_);
+        tensor_centroid_codes_.clear();
+    }
 
     String full_segment_dir = Path(InfinityContext::instance().config()->DataDir()) / *segment_dir_;
     LOG_DEBUG(fmt::format("Cleaning up segment dir: {}", full_segment_dir));
@@ -681,6 +686,19 @@ void SegmentEntry::AddColumns(const Vector<Pair<ColumnID, const Value *>> &colum
     }
 }
 
+SharedPtr<TensorCentroidCodes> SegmentEntry::GetTensorCentroidCodes(ColumnID column_id) {
+    std::lock_guard lock(tensor_centroid_codes_mutex_);
+    if (auto iter = tensor_centroid_codes_.find(column_id); iter != tensor_centroid_codes_.end()) {
+        return iter->second;
+    }
+    return nullptr;
+}
+
+void SegmentEntry::SetTensorCentroidCodes(ColumnID column_id, SharedPtr<TensorCentroidCodes> codes) {
+    std::lock_guard lock(tensor_centroid_codes_mutex_);
+    tensor_centroid_codes_[column_id] = std::move(codes);
+}
+
 void SegmentEntry::DropColumns(const Vector<ColumnID> &column_ids, Txn *txn) {
     //
 }
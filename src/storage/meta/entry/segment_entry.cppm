@@ -43,6 +43,7 @@ struct TxnSegmentStore;
 struct TableEntry;
 class CompactStateData;
 class BlockEntryIter;
+class TensorCentroidCodes;
 
 export struct BlocksGuard {
     const Vector<SharedPtr<BlockEntry>> &block_entries_;
@@ -156,6 +157,23 @@ public:
 
     const FastRoughFilter *GetFastRoughFilter() const { return fast_rough_filter_.get(); }
 
+    // Centroid codes of a tensor column, nullptr until the first pruned search has them built by TensorCentroidCodes::ScheduleForSegment(),
+    // or built with the segment when it compacts segments searched with pruning. Only for segments whose rows no longer change.
+    SharedPtr<TensorCentroidCodes> GetTensorCentroidCodes(ColumnID column_id);
+
+    void SetTensorCentroidCodes(ColumnID column_id, SharedPtr<TensorCentroidCodes> codes);
+
+    // True for the first caller only, which builds the centroid codes
+    bool TryStartBuildTensorCentroidCodes() { return !tensor_centroid_codes_started_.exchange(true); }
+
+    // Called when the build skipped the segment, so that a later pruned search schedules it again
+    void ResetBuildTensorCentroidCodes() { tensor_centroid_codes_started_.store(false); }
+
+    // True once a pruned search has asked for the centroid codes, even if the build skipped the segment
+    bool TensorCentroidCodesRequested() const { return tensor_centroid_codes_requested_.load(); }
+
+    void SetTensorCentroidCodesRequested() { tensor_centroid_codes_requested_.store(true); }
+
     void LoadFilterBinaryData(const String &segment_filter_data);
     static String SegmentStatusToString(const SegmentStatus &type);
 
@@ -269,6 +287,11 @@ private:
     CompactStateData *compact_state_data_{};
     SegmentStatus status_;
 
+    Atomic<bool> tensor_centroid_codes_started_{false};
+    Atomic<bool> tensor_centroid_codes_requested_{false};
+    std::mutex tensor_centroid_codes_mutex_{};
+    HashMap<ColumnID, SharedPtr<TensorCentroidCodes>> tensor_centroid_codes_{};
+
     HashSet<TransactionID> delete_txns_; // current number of delete txn that write this segment
 
 public:
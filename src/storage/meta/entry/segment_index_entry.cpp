@@ -67,9 +67,33 @@ import bmp_util;
 import hnsw_util;
 import wal_entry;
 import infinity_context;
+import column_index_merger;
+import index_build_tracer;
+import segment_entry;
 
 namespace infinity {
 
+namespace {
+
+// Whether the index of the chunk is used in place from a memory mapped file, and so can't be modified
+template <typename AbstractIndex>
+bool ChunkIndexMmapLoaded(const SharedPtr<ChunkIndexEntry> &chunk_index_entry) {
+    BufferHandle buffer_handle = chunk_index_entry->GetIndex();
+    const auto *abstract_index = static_cast<const AbstractIndex *>(buffer_handle.GetData());
+    return std::visit(
+        [](auto &&index) {
+            using T = std::decay_t<decltype(index)>;
+            if constexpr (std::is_same_v<T, std::nullptr_t>) {
+                return false;
+            } else {
+                return index->mmap_loaded();
+            }
+        },
+        *abstract_index);
+}
+
+} // namespace
+
 Vector<std::string_view> SegmentIndexEntry::DecodeIndex(std::string_view encode) {
     SizeT delimiter_i = encode.rfind('#');
     if (delimiter_i == String::npos) {
@@ -525,6 +549,9 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
             u64 column_id = column_def->id();
             auto block_entry_iter = BlockEntryIter(segment_entry);
             for (const auto *block_entry = block_entry_iter.Next(); block_entry != nullptr; block_entry = block_entry_iter.Next()) {
+                if (config.build_job_ != nullptr) {
+                    config.build_job_->CheckCancelled();
+                }
                 BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(column_id);
                 RowID begin_row_id = block_entry->base_row_id();
                 RowID exp_begin_row_id = memory_indexer_->GetBaseRowId() + memory_indexer_->GetDocCount();
@@ -540,6 +567,9 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
                 SharedPtr<ColumnVector> column_vector = MakeShared<ColumnVector>(block_column_entry->GetConstColumnVector(buffer_mgr));
                 memory_indexer_->Insert(column_vector, 0, block_entry->row_count(), true);
                 memory_indexer_->Commit(true);
+                if (config.build_job_ != nullptr) {
+                    config.build_job_->AddProcessedRows(block_entry->row_count());
+                }
             }
             memory_indexer_->Dump(true);
             dumped_memindex_entry =
@@ -552,6 +582,7 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
             auto memory_hnsw_index = HnswIndexInMem::Make(base_row_id, index_base, column_def.get(), this);
             HnswInsertConfig insert_config;
             insert_config.optimize_ = true;
+            insert_config.build_job_ = config.build_job_;
             memory_hnsw_index->InsertVecs(segment_entry, buffer_mgr, column_def->id(), begin_ts, config.check_ts_, insert_config);
 
             dumped_memindex_entry = memory_hnsw_index->Dump(this, buffer_manager_);
@@ -567,9 +598,15 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
             u64 column_id = column_def->id();
             auto block_entry_iter = BlockEntryIter(segment_entry);
             for (const auto *block_entry = block_entry_iter.Next(); block_entry != nullptr; block_entry = block_entry_iter.Next()) {
+                if (config.build_job_ != nullptr) {
+                    config.build_job_->CheckCancelled();
+                }
                 const auto block_id = block_entry->block_id();
                 BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(column_id);
                 memory_secondary_index_->Insert(block_id, block_column_entry, buffer_mgr, 0, block_entry->row_count());
+                if (config.build_job_ != nullptr) {
+                    config.build_job_->AddProcessedRows(block_entry->row_count());
+                }
             }
             dumped_memindex_entry = MemIndexDump();
             break;
@@ -584,6 +621,9 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
 
             emvb_chunk_index_entry->SaveIndexFile();
             dumped_memindex_entry = emvb_chunk_index_entry;
+            if (config.build_job_ != nullptr) {
+                config.build_job_->AddProcessedRows(row_count);
+            }
             break;
         }
         case IndexType::kIVFFlat: { // TODO
@@ -597,6 +637,9 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
 
             memory_bmp_index_->AddDocs(segment_entry, buffer_mgr, column_def->id(), begin_ts, config.check_ts_);
             dumped_memindex_entry = MemIndexDump();
+            if (config.build_job_ != nullptr) {
+                config.build_job_->AddProcessedRows(segment_entry->row_count());
+            }
             break;
         }
         case IndexType::kDiskAnn: { // TODO
@@ -621,13 +664,142 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
     }
 }
 
-Status SegmentIndexEntry::CreateIndexPrepare(const SegmentEntry *segment_entry, Txn *txn, bool prepare, bool check_ts) {
+bool SegmentIndexEntry::CanPopulateByMerge(const IndexBase *index_base, bool keep_row_order) {
+    switch (index_base->index_type_) {
+        case IndexType::kSecondary:
+        case IndexType::kBMP: {
+            return true;
+        }
+        case IndexType::kFullText: {
+            // Postings are merged in doc order
+            return keep_row_order;
+        }
+        default: {
+            // Graph and multi-vector indexes are built again
+            return false;
+        }
+    }
+}
+
+bool SegmentIndexEntry::PopulateByMerge(const SegmentEntry *segment_entry,
+                                        const Vector<CompactedSegmentIndex> &compacted_indexes,
+                                        bool keep_row_order,
+                                        Txn *txn) {
+    const IndexBase *index_base = table_index_entry_->index_base();
+    if (!CanPopulateByMerge(index_base, keep_row_order)) {
+        return false;
+    }
+    // The chunks of each compacted segment must cover all of its rows
+    Vector<Vector<SharedPtr<ChunkIndexEntry>>> compacted_chunks(compacted_indexes.size());
+    for (SizeT i = 0; i < compacted_indexes.size(); ++i) {
+        compacted_indexes[i].segment_index_entry_->GetChunkIndexEntries(compacted_chunks[i], txn);
+        SegmentOffset next_offset = 0;
+        for (const auto &chunk_index_entry : compacted_chunks[i]) {
+            if (chunk_index_entry->base_rowid_.segment_offset_ != next_offset) {
+                return false;
+            }
+            next_offset += chunk_index_entry->row_count_;
+        }
+        if (next_offset < compacted_indexes[i].row_count_) {
+            return false;
+        }
+    }
+
+    auto *buffer_mgr = txn->buffer_mgr();
+    const u32 row_count = segment_entry->row_count();
+    RowID base_rowid(segment_id_, 0);
+    SharedPtr<ChunkIndexEntry> merged_chunk_index_entry = nullptr;
+    switch (index_base->index_type_) {
+        case IndexType::kSecondary: {
+            Vector<ChunkIndexEntry *> old_chunks;
+            Vector<const Vector<SegmentOffset> *> row_maps;
+            for (SizeT i = 0; i < compacted_indexes.size(); ++i) {
+                for (const auto &chunk_index_entry : compacted_chunks[i]) {
+                    old_chunks.push_back(chunk_index_entry.get());
+                    row_maps.push_back(&compacted_indexes[i].row_map_);
+                }
+            }
+            merged_chunk_index_entry = CreateSecondaryIndexChunkIndexEntry(base_rowid, row_count, buffer_mgr);
+            {
+                BufferHandle handle = merged_chunk_index_entry->GetIndex();
+                auto data_ptr = static_cast<SecondaryIndexData *>(handle.GetDataMut());
+                data_ptr->InsertCompactedData(old_chunks, row_maps, merged_chunk_index_entry);
+            }
+            merged_chunk_index_entry->SaveIndexFile();
+            AddChunkIndexEntry(merged_chunk_index_entry);
+            break;
+        }
+        case IndexType::kFullText: {
+            // Each chunk is placed at the new offset of its first row which is kept
+            Vector<String> base_names;
+            Vector<RowID> base_rowids;
+            Vector<Vector<docid_t>> doc_id_maps;
+            for (SizeT i = 0; i < compacted_indexes.size(); ++i) {
+                const Vector<SegmentOffset> &row_map = compacted_indexes[i].row_map_;
+                for (const auto &chunk_index_entry : compacted_chunks[i]) {
+                    const SegmentOffset chunk_offset = chunk_index_entry->base_rowid_.segment_offset_;
+                    Vector<docid_t> doc_id_map(chunk_index_entry->row_count_, INVALID_DOCID);
+                    docid_t first_doc_id = INVALID_DOCID;
+                    for (u32 doc_id = 0; doc_id < chunk_index_entry->row_count_ && chunk_offset + doc_id < row_map.size(); ++doc_id) {
+                        SegmentOffset new_offset = row_map[chunk_offset + doc_id];
+                        if (new_offset == INVALID_SEGMENT_OFFSET) {
+                            continue;
+                        }
+                        doc_id_map[doc_id] = new_offset;
+                        if (first_doc_id == INVALID_DOCID) {
+                            first_doc_id = new_offset;
+                        }
+                    }
+                    if (first_doc_id == INVALID_DOCID) {
+                        continue;
+                    }
+                    base_names.push_back(chunk_index_entry->base_name_);
+                    base_rowids.emplace_back(segment_id_, first_doc_id);
+                    doc_id_maps.push_back(std::move(doc_id_map));
+                }
+            }
+            const auto *index_fulltext = static_cast<const IndexFullText *>(index_base);
+            String base_name = fmt::format("ft_{:016x}_{:x}", base_rowid.ToUint64(), row_count);
+            LOG_INFO(fmt::format("Merging {} full-text chunks of compacted segments -> {}", base_names.size(), base_name));
+            ColumnIndexMerger column_index_merger(*table_index_entry_->index_dir(), index_fulltext->flag_);
+            column_index_merger.Merge(base_names, base_rowids, base_name, &doc_id_maps);
+            merged_chunk_index_entry = AddFtChunkIndexEntry(base_name, base_rowid, row_count);
+            this->UpdateFulltextColumnLenInfo(column_index_merger.ColumnLengthSum(), row_count);
+            break;
+        }
+        case IndexType::kBMP: {
+            SharedPtr<ColumnDef> column_def = table_index_entry_->column_def();
+            auto memory_bmp_index = MakeShared<BMPIndexInMem>(base_rowid, index_base, column_def.get());
+            for (SizeT i = 0; i < compacted_indexes.size(); ++i) {
+                for (const auto &chunk_index_entry : compacted_chunks[i]) {
+                    BufferHandle handle = chunk_index_entry->GetIndex();
+                    const auto *abstract_bmp = static_cast<const AbstractBMP *>(handle.GetData());
+                    memory_bmp_index->AddDocs(*abstract_bmp, compacted_indexes[i].row_map_);
+                }
+            }
+            merged_chunk_index_entry = memory_bmp_index->Dump(this, buffer_mgr);
+            merged_chunk_index_entry->SaveIndexFile();
+            AddChunkIndexEntry(merged_chunk_index_entry);
+            break;
+        }
+        default: {
+            UnrecoverableError("Unreachable");
+        }
+    }
+    // COMPACT invokes this func at which the txn hasn't been commited yet.
+    TxnTimeStamp ts = std::max(txn->BeginTS(), txn->CommitTS());
+    max_ts_ = ts;
+    AddWalIndexDump(merged_chunk_index_entry.get(), txn);
+    return true;
+}
+
+Status SegmentIndexEntry::CreateIndexPrepare(const SegmentEntry *segment_entry, Txn *txn, bool prepare, bool check_ts, IndexBuildJob *build_job) {
     TxnTimeStamp begin_ts = txn->BeginTS();
     auto *buffer_mgr = txn->buffer_mgr();
     const IndexBase *index_base = table_index_entry_->index_base();
     const ColumnDef *column_def = table_index_entry_->column_def().get();
 
-    PopulateEntireConfig populate_entire_config{.prepare_ = prepare, .check_ts_ = check_ts};
+    PopulateEntireConfig populate_entire_config{.prepare_ = prepare, .check_ts_ = check_ts, .build_job_ = build_job};
     switch (index_base->index_type_) {
         case IndexType::kIVFFlat: {
             if (column_def->type()->type() != LogicalType::kEmbedding) {
@@ -651,6 +823,9 @@ Status SegmentIndexEntry::CreateIndexPrepare(const SegmentEntry *segment_entry,
                         OneColumnIterator<float, false> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
                         annivfflat_index->BuildIndex(iter, dimension, full_row_count);
                     }
+                    if (build_job != nullptr) {
+                        build_job->AddProcessedRows(full_row_count);
+                    }
                     break;
                 }
                 default: {
@@ -681,43 +856,40 @@ Status SegmentIndexEntry::CreateIndexPrepare(const SegmentEntry *segment_entry,
     return Status::OK();
 }
 
-Status SegmentIndexEntry::CreateIndexDo(atomic_u64 &create_index_idx) {
-    // const IndexBase *index_base = table_index_entry_->index_base();
-    // switch (index_base->index_type_) {
-    //     case IndexType::kHnsw: {
-    //         Vector<SharedPtr<ChunkIndexEntry>> chunk_index_entries;
-    //         GetChunkIndexEntries(chunk_index_entries);
-    //         for (const auto &chunk_index_entry : chunk_index_entries) {
-    //             RowID base_rowid = chunk_index_entry->base_rowid_;
-    //             SegmentOffset offset = base_rowid.segment_offset_;
-    //             SegmentOffset row_count = chunk_index_entry->row_count_;
-    //             BufferHandle buffer_handle = chunk_index_entry->GetIndex();
-
-    //             auto *abstract_hnsw = reinterpret_cast<AbstractHnsw *>(buffer_handle.GetDataMut());
-    //             std::visit(
-    //                 [&](auto &&index) {
-    //                     using T = std::decay_t<decltype(index)>;
-    //                     if constexpr (std::is_same_v<T, std::nullptr_t>) {
-    //                         UnrecoverableError("Invalid index type.");
-    //                     } else {
-    //                         while (true) {
-    //                             SizeT idx = create_index_idx.fetch_add(1);
-    //                             if (idx >= row_count) {
-    //                                 break;
-    //                             }
-    //                             index->Build(offset + idx);
-    //                         }
-    //                     }
-    //                 },
-    //                 *abstract_hnsw);
-    //         }
-    //         break;
-    //     }
-    //     default: {
-    //         break;
-    //     }
-    // }
-    return Status::OK();
+bool SegmentIndexEntry::CreateIndexDo(const SegmentEntry *segment_entry, Txn *txn, atomic_u64 &create_index_idx, IndexBuildJob *build_job) {
+    if (!populate_deferred_ || create_index_idx.fetch_add(1) != 0) {
+        return false;
+    }
+    // The unsealed segment isn't cancellable and its rows are counted at the end
+    const bool unsealed = segment_entry->status() == SegmentStatus::kUnsealed;
+    // Full-text and secondary indexes have no per-segment fallback, a cancel rolls back the statement
+    const bool keep_partial = KeepsPartialBuild(table_index_entry_->index_base()->index_type_);
+    if (build_job != nullptr && !unsealed && build_job->cancelled()) {
+        if (!keep_partial) {
+            build_job->CheckCancelled();
+        }
+        return false;
+    }
+    try {
+        auto status = CreateIndexPrepare(segment_entry, txn, false, true, unsealed ? nullptr : build_job);
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+    } catch (const RecoverableException &e) {
+        if (e.ErrorCode() != ErrorCode::kQueryCancelled || !keep_partial) {
+            throw;
+        }
+        LOG_INFO(fmt::format("Index {} segment {} is left unbuilt by the cancelled build", *table_index_entry_->GetIndexName(), segment_id_));
+        return false;
+    }
+    populate_done_ = true;
+    if (build_job != nullptr) {
+        if (unsealed) {
+            build_job->AddProcessedRows(segment_entry->row_count());
+        }
+        build_job->FinishSegment();
+    }
+    return true;
 }
 
 void SegmentIndexEntry::CommitSegmentIndex(TransactionID txn_id, TxnTimeStamp commit_ts) {
@@ -851,6 +1023,22 @@ void SegmentIndexEntry::OptIndex(IndexBase *index_base,
     }
 }
 
+bool SegmentIndexEntry::HasMmapLoadedChunk() {
+    switch (table_index_entry_->index_base()->index_type_) {
+        case IndexType::kBMP: {
+            const auto [chunk_index_entries, memory_index_entry] = this->GetBMPIndexSnapshot();
+            return std::any_of(chunk_index_entries.begin(), chunk_index_entries.end(), ChunkIndexMmapLoaded<AbstractBMP>);
+        }
+        case IndexType::kHnsw: {
+            const auto [chunk_index_entries, memory_index_entry] = this->GetHnswIndexSnapshot();
+            return std::any_of(chunk_index_entries.begin(), chunk_index_entries.end(), ChunkIndexMmapLoaded<AbstractHnsw>);
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
 bool SegmentIndexEntry::Flush(TxnTimeStamp checkpoint_ts) {
     auto index_type = table_index_entry_->index_base()->index_type_;
     if (index_type == IndexType::kFullText || index_type == IndexType::kHnsw) {
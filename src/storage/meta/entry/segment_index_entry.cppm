@@ -35,6 +35,8 @@ import memory_indexer;
 import default_values;
 import statement_common;
 import txn;
+import index_build_tracer;
+import create_index_info;
 
 namespace infinity {
 
@@ -54,8 +56,11 @@ class BaseMemIndex;
 export struct PopulateEntireConfig {
     bool prepare_;
     bool check_ts_;
+    IndexBuildJob *build_job_ = nullptr; // progress and cancellation of CREATE INDEX
 };
 
+export struct CompactedSegmentIndex;
+
 export class SegmentIndexEntry : public BaseEntry, public EntryInterface {
 public:
     static Vector<std::string_view> DecodeIndex(std::string_view encode);
@@ -103,6 +108,9 @@ public:
 
     void OptIndex(IndexBase *index_base, TxnTableStore *txn_table_store, const Vector<UniquePtr<InitParameter>> &opt_params, bool replay);
 
+    // Whether some chunk of the HNSW or BMP index is used in place from a memory mapped file, and so can't be optimized
+    bool HasMmapLoadedChunk();
+
     bool Flush(TxnTimeStamp checkpoint_ts);
 
     void Cleanup() final;
@@ -139,11 +147,36 @@ public:
     // Populate index entirely for the segment
     void PopulateEntirely(const SegmentEntry *segment_entry, Txn *txn, const PopulateEntireConfig &config);
 
+    // Whether PopulateByMerge supports the index type
+    static bool CanPopulateByMerge(const IndexBase *index_base, bool keep_row_order);
+
+    // Populate the index of a segment written by compaction by merging the index chunks of the compacted segments, instead of reading
+    // the segment. Return false, before adding any chunk, if the index has to be populated from the segment.
+    bool PopulateByMerge(const SegmentEntry *segment_entry, const Vector<CompactedSegmentIndex> &compacted_indexes, bool keep_row_order, Txn *txn);
+
     u32 MemIndexRowCount();
 
-    Status CreateIndexPrepare(const SegmentEntry *segment_entry, Txn *txn, bool prepare, bool check_ts);
+    Status CreateIndexPrepare(const SegmentEntry *segment_entry, Txn *txn, bool prepare, bool check_ts, IndexBuildJob *build_job = nullptr);
+
+    // Leave the populate of the segment to CreateIndexDo of the txn
+    void DeferPopulate(TransactionID txn_id) {
+        populate_deferred_ = true;
+        txn_id_ = txn_id;
+    }
+
+    // Populate the segment if its populate is deferred and no other task has claimed it. Return whether it's populated by this call.
+    // A sealed segment is left unpopulated once the build job is cancelled, the unsealed one is always populated since appends keep
+    // inserting into its index. For an index that isn't kept partially built, the cancel raises an error instead.
+    bool CreateIndexDo(const SegmentEntry *segment_entry, Txn *txn, atomic_u64 &create_index_idx, IndexBuildJob *build_job);
+
+    bool populate_deferred() const { return populate_deferred_; }
+
+    // Whether the segments left unbuilt by a cancelled build are searched without index. Full-text and secondary indexes can't skip a
+    // segment, so their build is rolled back instead.
+    static bool KeepsPartialBuild(IndexType index_type) { return index_type != IndexType::kFullText && index_type != IndexType::kSecondary; }
 
-    Status CreateIndexDo(atomic_u64 &create_index_idx);
+    // Whether the populate is deferred and no CreateIndexDo has finished it, read after all the tasks of CreateIndexDo are done
+    bool PopulateAbandoned() const { return populate_deferred_ && !populate_done_; }
 
     static UniquePtr<CreateIndexParam> GetCreateIndexParam(SharedPtr<IndexBase> index_base, SizeT seg_row_count, SharedPtr<ColumnDef> column_def);
 
@@ -298,6 +331,16 @@ private:
 
     u64 ft_column_len_sum_{}; // increase only
     u32 ft_column_len_cnt_{}; // increase only
+
+    bool populate_deferred_{false};
+    bool populate_done_{false};
+};
+
+// Index of a segment compacted into a new segment
+export struct CompactedSegmentIndex {
+    SegmentIndexEntry *segment_index_entry_{};
+    SizeT row_count_{};               // rows of the compacted segment
+    Vector<SegmentOffset> row_map_{}; // offsets of its rows in the new segment, INVALID_SEGMENT_OFFSET for the rows which were dropped
 };
 
 } // namespace infinity
@@ -323,7 +323,10 @@ void TableEntry::AddSegmentReplayWal(SharedPtr<SegmentEntry> new_segment) {
     if (compaction_alg_.get() != nullptr) {
         compaction_alg_->AddSegment(new_segment.get());
     }
-    next_segment_id_++;
+    // Segment ids may have gaps (reserved by a parallel import or taken by an aborted txn)
+    if (next_segment_id_ <= segment_id) {
+        next_segment_id_ = segment_id + 1;
+    }
 }
 
 void TableEntry::AddSegmentReplay(SharedPtr<SegmentEntry> new_segment) {
@@ -1074,6 +1077,11 @@ nlohmann::json TableEntry::Serialize(TxnTimeStamp max_commit_ts) {
                     column_def_json["default"] = default_expr->Serialize();
                 }
 
+                if (column_def->clustering_key_idx_ >= 0) {
+                    column_def_json["clustering_key_idx"] = column_def->clustering_key_idx_;
+                    column_def_json["clustering_z_order"] = column_def->clustering_z_order_;
+                }
+
                 json_res["column_definition"].emplace_back(column_def_json);
             }
         }
@@ -1143,6 +1151,10 @@ UniquePtr<TableEntry> TableEntry::Deserialize(const nlohmann::json &table_entry_
             }
 
             SharedPtr<ColumnDef> column_def = MakeShared<ColumnDef>(column_id, data_type, column_name, constraints, default_expr);
+            if (column_def_json.contains("clustering_key_idx")) {
+                column_def->clustering_key_idx_ = column_def_json["clustering_key_idx"];
+                column_def->clustering_z_order_ = column_def_json["clustering_z_order"];
+            }
             columns.emplace_back(column_def);
         }
         row_count = table_entry_json["row_count"];
@@ -182,6 +182,12 @@ public:
 
     SegmentID GetNextSegmentID() { return next_segment_id_++; }
 
+    // Reserve `count` consecutive segment ids and return the first one. Ids left unused stay as gaps unless released.
+    SegmentID ReserveSegmentIDs(SizeT count) { return next_segment_id_.fetch_add(count); }
+
+    // Give back the unused tail [begin, end) of a reservation, unless ids after it were taken since
+    void ReleaseSegmentIDs(SegmentID begin, SegmentID end) { next_segment_id_.compare_exchange_strong(end, begin); }
+
     SegmentID next_segment_id() const { return next_segment_id_; }
 
     static SharedPtr<String> DetermineTableDir(const String &parent_dir, const String &table_name);
@@ -347,7 +347,9 @@ TableIndexEntry::CreateIndexPrepare(BaseTableRef *table_ref, Txn *txn, bool prep
     return {segment_index_entries, Status::OK()};
 }
 
-Status TableIndexEntry::CreateIndexDo(BaseTableRef *table_ref, HashMap<SegmentID, atomic_u64> &create_index_idxes, Txn *txn) {
+Pair<Vector<SegmentIndexEntry *>, Status>
+TableIndexEntry::CreateIndexDo(BaseTableRef *table_ref, HashMap<SegmentID, atomic_u64> &create_index_idxes, Txn *txn, IndexBuildJob *build_job) {
+    Vector<SegmentIndexEntry *> segment_index_entries;
     if (this->index_base_->column_names_.size() != 1) {
         // TODO
         Status status = Status::NotSupport("Not implemented");
@@ -356,17 +358,83 @@ Status TableIndexEntry::CreateIndexDo(BaseTableRef *table_ref, HashMap<SegmentID
     auto &index_index = table_ref->index_index_;
     auto iter = index_index->index_snapshots_.find(*index_base_->index_name_);
     if (iter == index_index->index_snapshots_.end()) {
-        return Status::OK();
+        return {segment_index_entries, Status::OK()};
     }
     auto &segment_index_snapshots = iter->second;
+    const auto &segment_block_index = table_ref->block_index_->segment_block_index_;
     for (auto &[segment_id, segment_index_entry] : segment_index_snapshots->segment_index_entries_) {
         atomic_u64 &create_index_idx = create_index_idxes.at(segment_id);
-        auto status = segment_index_entry->CreateIndexDo(create_index_idx);
-        if (!status.ok()) {
-            return status;
+        const SegmentEntry *segment_entry = segment_block_index.at(segment_id).segment_entry_;
+        if (segment_index_entry->CreateIndexDo(segment_entry, txn, create_index_idx, build_job)) {
+            segment_index_entries.push_back(segment_index_entry);
+        }
+    }
+    return {segment_index_entries, Status::OK()};
+}
+
+Vector<SegmentIndexEntry *> TableIndexEntry::CreateIndexResume(BaseTableRef *table_ref, Txn *txn) {
+    Vector<SegmentIndexEntry *> segment_index_entries;
+    std::unique_lock w_lock(rw_locker_);
+    for (const auto &[segment_id, segment_info] : table_ref->block_index_->segment_block_index_) {
+        if (index_by_segment_.contains(segment_id)) {
+            continue;
+        }
+        auto create_index_param = SegmentIndexEntry::GetCreateIndexParam(index_base_, segment_info.segment_offset_, column_def_);
+        SharedPtr<SegmentIndexEntry> segment_index_entry = SegmentIndexEntry::NewIndexEntry(this, segment_id, txn, create_index_param.get());
+        index_by_segment_.emplace(segment_id, segment_index_entry);
+        segment_index_entries.push_back(segment_index_entry.get());
+    }
+    return segment_index_entries;
+}
+
+void TableIndexEntry::DropDeferredSegments(TransactionID txn_id, bool rollback) {
+    std::unique_lock w_lock(rw_locker_);
+    for (auto iter = index_by_segment_.begin(); iter != index_by_segment_.end();) {
+        SegmentIndexEntry *segment_index_entry = iter->second.get();
+        if (segment_index_entry->txn_id_ != txn_id || !segment_index_entry->populate_deferred()) {
+            ++iter;
+            continue;
+        }
+        if (segment_index_entry->PopulateAbandoned() || (rollback && !segment_index_entry->Committed())) {
+            segment_index_entry->Cleanup();
+            iter = index_by_segment_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+bool TableIndexEntry::PartiallyBuilt(const BlockIndex *block_index) {
+    std::shared_lock r_lock(rw_locker_);
+    for (const auto &[segment_id, segment_info] : block_index->segment_block_index_) {
+        if (!index_by_segment_.contains(segment_id)) {
+            return true;
         }
     }
-    return Status::OK();
+    return false;
+}
+
+SegmentIndexEntry *TableIndexEntry::CreateIndexByMerge(SegmentEntry *segment_entry,
+                                                       const Vector<CompactedSegmentIndex> &compacted_indexes,
+                                                       bool keep_row_order,
+                                                       Txn *txn) {
+    SegmentID segment_id = segment_entry->segment_id();
+    auto create_index_param = SegmentIndexEntry::GetCreateIndexParam(index_base_, segment_entry->row_count(), column_def_);
+    SharedPtr<SegmentIndexEntry> segment_index_entry = SegmentIndexEntry::NewIndexEntry(this, segment_id, txn, create_index_param.get());
+    if (!segment_index_entry->PopulateByMerge(segment_entry, compacted_indexes, keep_row_order, txn)) {
+        return nullptr;
+    }
+    {
+        std::unique_lock w_lock(rw_locker_);
+        index_by_segment_.emplace(segment_id, segment_index_entry);
+    }
+    TxnTableStore *txn_table_store = txn->GetTxnTableStore(table_index_meta()->GetTableEntry());
+    Vector<SharedPtr<ChunkIndexEntry>> chunk_index_entries;
+    segment_index_entry->GetChunkIndexEntries(chunk_index_entries);
+    for (auto &chunk_index_entry : chunk_index_entries) {
+        txn_table_store->AddChunkIndexStore(this, chunk_index_entry.get());
+    }
+    return segment_index_entry.get();
 }
 
 void TableIndexEntry::Cleanup() {
@@ -419,6 +487,17 @@ void TableIndexEntry::UpdateEntryReplay(TransactionID txn_id, TxnTimeStamp begin
     txn_id_ = txn_id;
 }
 
+void TableIndexEntry::CheckOptimizable() const {
+    for (const auto &[segment_id, segment_index_entry] : index_by_segment_) {
+        if (segment_index_entry->HasMmapLoadedChunk()) {
+            RecoverableError(Status::NotSupport(
+                fmt::format("Index {} of segment {} is loaded from memory mapped files and can't be optimized, disable index_mmap_load",
+                            *index_base_->index_name_,
+                            segment_id)));
+        }
+    }
+}
+
 void TableIndexEntry::OptIndex(TxnTableStore *txn_table_store, const Vector<UniquePtr<InitParameter>> &opt_params, bool replay) {
     switch (index_base_->index_type_) {
         case IndexType::kBMP: {
@@ -426,6 +505,7 @@ void TableIndexEntry::OptIndex(TxnTableStore *txn_table_store, const Vector<Uniq
                 break;
             }
             std::unique_lock w_lock(rw_locker_);
+            CheckOptimizable();
             for (const auto &[segment_id, segment_index_entry] : index_by_segment_) {
                 segment_index_entry->OptIndex(index_base_.get(), txn_table_store, opt_params, false /*replay*/);
             }
@@ -438,6 +518,10 @@ void TableIndexEntry::OptIndex(TxnTableStore *txn_table_store, const Vector<Uniq
             if (!params) {
                 break;
             }
+            if (!replay) {
+                // before encode_type_ is changed, a rejected optimize leaves the catalog as it was
+                CheckOptimizable();
+            }
             auto *hnsw_index = static_cast<IndexHnsw *>(index_base_.get());
             if (params->compress_to_lvq) {
                 if (hnsw_index->encode_type_ != HnswEncodeType::kPlain) {
@@ -32,6 +32,7 @@ import cleanup_scanner;
 import meta_entry_interface;
 import index_file_worker;
 import column_def;
+import index_build_tracer;
 
 import block_entry;
 
@@ -132,7 +133,24 @@ public:
     Tuple<Vector<SegmentIndexEntry *>, Status>
     CreateIndexPrepare(BaseTableRef *table_ref, Txn *txn, bool prepare, bool is_replay, bool check_ts = true);
 
-    Status CreateIndexDo(BaseTableRef *table_ref, HashMap<SegmentID, atomic_u64> &create_index_idxes, Txn *txn);
+    // Populate the segments deferred by CreateIndexPrepare, each by one of the tasks. Return the segments populated by this call.
+    Pair<Vector<SegmentIndexEntry *>, Status>
+    CreateIndexDo(BaseTableRef *table_ref, HashMap<SegmentID, atomic_u64> &create_index_idxes, Txn *txn, IndexBuildJob *build_job = nullptr);
+
+    // Create the entries of the segments of `table_ref` without index, left by a cancelled CREATE INDEX, to be populated by CreateIndexDo
+    Vector<SegmentIndexEntry *> CreateIndexResume(BaseTableRef *table_ref, Txn *txn);
+
+    // Drop the segments deferred to CreateIndexDo by `txn_id` that are not populated or, on rollback, not committed. They are
+    // searched without index, and OPTIMIZE ... WITH (resume_build) populates them later.
+    void DropDeferredSegments(TransactionID txn_id, bool rollback);
+
+    // Whether a segment of `block_index` has no index, left by a cancelled CREATE INDEX
+    bool PartiallyBuilt(const BlockIndex *block_index);
+
+    // Create the index of a segment written by compaction from the indexes of the compacted segments.
+    // Return nullptr if the index has to be created from the segment by CreateIndexPrepare.
+    SegmentIndexEntry *
+    CreateIndexByMerge(SegmentEntry *segment_entry, const Vector<CompactedSegmentIndex> &compacted_indexes, bool keep_row_order, Txn *txn);
 
     TxnTimeStamp GetFulltexSegmentUpdateTs() {
         std::shared_lock lock(segment_update_ts_mutex_);
@@ -151,6 +169,9 @@ public:
     void OptIndex(TxnTableStore *txn_table_store, const Vector<UniquePtr<InitParameter>> &opt_params, bool replay);
 
 private:
+    // Checked on every segment before any of them is optimized, so that the index is never left half optimized
+    void CheckOptimizable() const;
+
     static SharedPtr<String> DetermineIndexDir(const String &parent_dir, const String &index_name);
 
 private:
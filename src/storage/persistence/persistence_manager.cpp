@@ -569,12 +569,30 @@ void PersistenceManager::CleanupNoLock(const ObjAddr &object_addr) {
             UnrecoverableError(error_message);
         }
         fp.append(object_addr.obj_key_);
-        fs::remove(fp);
+        if (!shared_workspace_) {
+            fs::remove(fp);
+        }
         objects_.erase(it);
         LOG_TRACE(fmt::format("Deleted object {}", object_addr.obj_key_));
     }
 }
 
+bool PersistenceManager::ObjExists(const ObjAddr &obj_addr) const {
+    if (!obj_addr.Valid()) {
+        return false;
+    }
+    fs::path fp = workspace_;
+    fp.append(obj_addr.obj_key_);
+    std::error_code ec;
+    SizeT file_size = fs::file_size(fp, ec);
+    return !ec && file_size >= obj_addr.part_offset_ + obj_addr.part_size_;
+}
+
+void PersistenceManager::SetSharedWorkspace(bool shared_workspace) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    shared_workspace_ = shared_workspace;
+}
+
 ObjStat PersistenceManager::GetObjStatByObjAddr(const ObjAddr &obj_addr) {
     std::lock_guard<std::mutex> lock(mtx_);
     auto it = objects_.find(obj_addr.obj_key_);
@@ -107,6 +107,13 @@ public:
 
     void Cleanup(const String &file_path);
 
+    // Whether the part of the object at `obj_addr` is in the workspace
+    bool ObjExists(const ObjAddr &obj_addr) const;
+
+    // A follower shares the workspace of its leader, which owns the objects. Cleanup on the follower forgets them without
+    // removing the files.
+    void SetSharedWorkspace(bool shared_workspace);
+
     /**
      * Utils
      */
@@ -154,6 +161,7 @@ private:
     String current_object_key_;
     SizeT current_object_size_;
     SizeT current_object_parts_;
+    bool shared_workspace_{false};
 
     friend struct AddrSerializer;
 };
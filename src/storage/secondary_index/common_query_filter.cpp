@@ -108,6 +108,7 @@ void CommonQueryFilter::BuildFilter(u32 task_id, Txn *txn) {
     const SegmentEntry *segment_entry = segment_index.at(segment_id).segment_entry_;
     if (!fast_rough_filter_evaluator_->Evaluate(begin_ts, *segment_entry->GetFastRoughFilter())) {
         // skip this segment
+        ++fast_rough_filter_pruned_segment_count_;
         return;
     }
     const SizeT segment_row_count = segment_index.at(segment_id).segment_offset_;
@@ -136,6 +137,13 @@ void CommonQueryFilter::BuildFilter(u32 task_id, Txn *txn) {
              block_entry = block_entry_iter.Next()) {
             const auto block_row_count = block_entry->row_count();
             const auto row_count = std::min<SizeT>(segment_row_count - segment_row_count_read, block_row_count);
+            if (row_count > 0 && !fast_rough_filter_evaluator_->Evaluate(begin_ts, *block_entry->GetFastRoughFilter())) {
+                // no row in this block can pass the filter, skip reading its columns
+                ++fast_rough_filter_pruned_block_count_;
+                result_elem.SetFalseRange(segment_row_count_read, segment_row_count_read + row_count);
+                segment_row_count_read += row_count;
+                continue;
+            }
             db_for_filter->Reset(row_count);
             ReadDataBlock(db_for_filter, buffer_mgr, row_count, block_entry, base_table_ref_->column_ids_);
             bool_column->Initialize(ColumnVectorType::kCompactBit, row_count);
@@ -192,6 +200,39 @@ void CommonQueryFilter::TryApplySecondaryIndexFilterOptimizer(QueryContext *quer
     filter_execute_command_ = std::move(filter_execute_command);
 }
 
+RowID CommonQueryFilter::NextCandidate(RowID doc_id) const {
+    if (always_true_) {
+        return doc_id;
+    }
+    const auto it = filter_result_.lower_bound(doc_id.segment_id_);
+    if (it == filter_result_.end()) {
+        return INVALID_ROWID;
+    }
+    if (it->first != doc_id.segment_id_) {
+        return RowID(it->first, 0);
+    }
+    return doc_id;
+}
+
+void CommonQueryFilter::EstimateFastRoughFilterPruning(SizeT &pruned_segment_count, SizeT &pruned_block_count) const {
+    pruned_segment_count = 0;
+    pruned_block_count = 0;
+    if (fast_rough_filter_evaluator_ == nullptr) {
+        return;
+    }
+    for (const auto &[segment_id, segment_snapshot] : base_table_ref_->block_index_->segment_block_index_) {
+        if (!fast_rough_filter_evaluator_->Evaluate(begin_ts_, *segment_snapshot.segment_entry_->GetFastRoughFilter())) {
+            ++pruned_segment_count;
+            continue;
+        }
+        for (const BlockEntry *block_entry : segment_snapshot.block_map_) {
+            if (!fast_rough_filter_evaluator_->Evaluate(begin_ts_, *block_entry->GetFastRoughFilter())) {
+                ++pruned_block_count;
+            }
+        }
+    }
+}
+
 bool CommonQueryFilter::PassFilter(RowID doc_id) {
     if (always_true_) [[unlikely]]
         return true;
@@ -51,6 +51,10 @@ export struct CommonQueryFilter {
     Map<SegmentID, Bitmask> filter_result_;
     SizeT filter_result_count_ = 0;
 
+    // segments and blocks skipped by the minmax and bloom filter while building the result
+    atomic_u32 fast_rough_filter_pruned_segment_count_ = 0;
+    atomic_u32 fast_rough_filter_pruned_block_count_ = 0;
+
     // task info
     Vector<SegmentID> tasks_;
     u32 total_task_num_ = 0;
@@ -97,6 +101,14 @@ export struct CommonQueryFilter {
     // Check if given doc pass filter. Requires doc_id be in ascending order.
     bool PassFilter(RowID doc_id);
 
+    // Return the first row id >= doc_id in a segment which has some result, or INVALID_ROWID if there is none.
+    // Used by search iterators to seek over pruned segments without decoding them.
+    RowID NextCandidate(RowID doc_id) const;
+
+    // Evaluate only the minmax and bloom filter over the snapshot, without reading any column or index data.
+    // Used by EXPLAIN, where the filter result is not built.
+    void EstimateFastRoughFilterPruning(SizeT &pruned_segment_count, SizeT &pruned_block_count) const;
+
 private:
     void BuildFilter(u32 task_id, Txn *txn);
 
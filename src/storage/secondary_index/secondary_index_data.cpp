@@ -72,8 +72,11 @@ template <typename RawValueType>
 struct SecondaryIndexChunkMerger {
     using OrderedKeyType = ConvertToOrderedType<RawValueType>;
     Vector<SecondaryIndexChunkDataReader<RawValueType>> readers_;
+    // offsets of the rows of each chunk in the merged chunk, empty if the offsets are kept
+    Vector<const Vector<SegmentOffset> *> row_maps_;
     std::priority_queue<Tuple<OrderedKeyType, u32, u32>, Vector<Tuple<OrderedKeyType, u32, u32>>, std::greater<Tuple<OrderedKeyType, u32, u32>>> pq_;
-    explicit SecondaryIndexChunkMerger(const Vector<ChunkIndexEntry *> &old_chunks) {
+    explicit SecondaryIndexChunkMerger(const Vector<ChunkIndexEntry *> &old_chunks, Vector<const Vector<SegmentOffset> *> row_maps = {})
+        : row_maps_(std::move(row_maps)) {
         readers_.reserve(old_chunks.size());
         for (ChunkIndexEntry *chunk : old_chunks) {
             readers_.emplace_back(chunk);
@@ -81,11 +84,25 @@ struct SecondaryIndexChunkMerger {
         OrderedKeyType key = {};
         u32 offset = 0;
         for (u32 i = 0; i < readers_.size(); ++i) {
-            if (readers_[i].GetNextDataPair(key, offset)) {
+            if (ReadNext(i, key, offset)) {
                 pq_.emplace(key, offset, i);
             }
         }
     }
+    // Rows which are not in the row map are skipped
+    bool ReadNext(u32 reader_id, OrderedKeyType &key, u32 &offset) {
+        while (readers_[reader_id].GetNextDataPair(key, offset)) {
+            if (row_maps_.empty()) {
+                return true;
+            }
+            const Vector<SegmentOffset> &row_map = *row_maps_[reader_id];
+            if (offset < row_map.size() && row_map[offset] != INVALID_SEGMENT_OFFSET) {
+                offset = row_map[offset];
+                return true;
+            }
+        }
+        return false;
+    }
     bool GetNextDataPair(OrderedKeyType &out_key, u32 &out_offset) {
         if (pq_.empty()) {
             return false;
@@ -96,7 +113,7 @@ struct SecondaryIndexChunkMerger {
         pq_.pop();
         OrderedKeyType next_key = {};
         u32 next_offset = 0;
-        if (readers_[reader_id].GetNextDataPair(next_key, next_offset)) {
+        if (ReadNext(reader_id, next_key, next_offset)) {
             pq_.emplace(next_key, next_offset, reader_id);
         }
         return true;
@@ -184,6 +201,33 @@ public:
         OutputAndBuild(merged_chunk_index_entry);
     }
 
+    void InsertCompactedData(const Vector<ChunkIndexEntry *> &old_chunks,
+                             const Vector<const Vector<SegmentOffset> *> &row_maps,
+                             SharedPtr<ChunkIndexEntry> &merged_chunk_index_entry) override {
+        if (!need_save_) {
+            String error_message = "InsertCompactedData(): error: SecondaryIndexDataT is not allocated.";
+            UnrecoverableError(error_message);
+        }
+        SecondaryIndexChunkMerger<RawValueType> merger(old_chunks, row_maps);
+        OrderedKeyType key = {};
+        u32 offset = 0;
+        u32 i = 0;
+        while (merger.GetNextDataPair(key, offset)) {
+            if (i == chunk_row_count_) {
+                String error_message = fmt::format("InsertCompactedData(): error: more than chunk_row_count_: {} rows", chunk_row_count_);
+                UnrecoverableError(error_message);
+            }
+            key_[i] = key;
+            offset_[i] = offset;
+            ++i;
+        }
+        if (i != chunk_row_count_) {
+            String error_message = fmt::format("InsertCompactedData(): error: i: {} != chunk_row_count_: {}", i, chunk_row_count_);
+            UnrecoverableError(error_message);
+        }
+        OutputAndBuild(merged_chunk_index_entry);
+    }
+
     void OutputAndBuild(SharedPtr<ChunkIndexEntry> &chunk_index) {
         const u32 part_num = chunk_index->GetPartNum();
         for (u32 part_id = 0; part_id < part_num; ++part_id) {
@@ -156,6 +156,12 @@ public:
     virtual void InsertData(void *ptr, SharedPtr<ChunkIndexEntry> &chunk_index) = 0;
 
     virtual void InsertMergeData(Vector<ChunkIndexEntry *> &old_chunks, SharedPtr<ChunkIndexEntry> &merged_chunk_index_entry) = 0;
+
+    // Merge the chunks of the segments compacted into a new segment. `row_maps[i]` maps the offsets of `old_chunks[i]` to the offsets
+    // in the new segment, rows mapped to INVALID_SEGMENT_OFFSET are dropped.
+    virtual void InsertCompactedData(const Vector<ChunkIndexEntry *> &old_chunks,
+                                     const Vector<const Vector<SegmentOffset> *> &row_maps,
+                                     SharedPtr<ChunkIndexEntry> &merged_chunk_index_entry) = 0;
 };
 
 export SecondaryIndexData *GetSecondaryIndexData(const SharedPtr<DataType> &data_type, u32 chunk_row_count, bool allocate);
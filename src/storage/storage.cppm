@@ -25,6 +25,7 @@ import compaction_process;
 import periodic_trigger_thread;
 import log_file;
 import memindex_tracer;
+import index_build_tracer;
 
 export module storage;
 
@@ -47,6 +48,8 @@ public:
 
     [[nodiscard]] inline BGMemIndexTracer *memindex_tracer() noexcept { return memory_index_tracer_.get(); }
 
+    [[nodiscard]] inline IndexBuildTracer *index_build_tracer() noexcept { return &index_build_tracer_; }
+
     [[nodiscard]] inline TxnManager *txn_manager() const noexcept { return txn_mgr_.get(); }
 
     [[nodiscard]] inline WalManager *wal_manager() const noexcept { return wal_mgr_.get(); }
@@ -72,6 +75,7 @@ private:
     UniquePtr<Catalog> new_catalog_{};
     UniquePtr<BufferManager> buffer_mgr_{};
     UniquePtr<BGMemIndexTracer> memory_index_tracer_{};
+    IndexBuildTracer index_build_tracer_{};
     UniquePtr<TxnManager> txn_mgr_{};
     UniquePtr<WalManager> wal_mgr_{};
     UniquePtr<BGTaskProcessor> bg_processor_{};
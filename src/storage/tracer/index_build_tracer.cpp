@@ -0,0 +1,102 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <chrono>
+#include <map>
+
+module index_build_tracer;
+
+import stl;
+import status;
+import infinity_exception;
+import third_party;
+
+namespace infinity {
+
+IndexBuildJob::IndexBuildJob(u64 job_id,
+                             TransactionID txn_id,
+                             String db_name,
+                             String table_name,
+                             String index_name,
+                             SizeT total_rows,
+                             SizeT segment_count)
+    : job_id_(job_id), txn_id_(txn_id), db_name_(std::move(db_name)), table_name_(std::move(table_name)), index_name_(std::move(index_name)),
+      total_rows_(total_rows), segment_count_(segment_count), begin_time_(std::chrono::steady_clock::now()) {}
+
+void IndexBuildJob::CheckCancelled() const {
+    if (cancelled()) {
+        Status status = Status::QueryCancelled(fmt::format("index build {} of {}.{}", job_id_, table_name_, index_name_));
+        RecoverableError(status);
+    }
+}
+
+i64 IndexBuildJob::ElapsedMs() const {
+    auto elapsed = std::chrono::steady_clock::now() - begin_time_;
+    return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+}
+
+i64 IndexBuildJob::RemainingMs() const {
+    const SizeT processed_rows = this->processed_rows();
+    if (processed_rows == 0) {
+        return -1;
+    }
+    if (processed_rows >= total_rows_) {
+        return 0;
+    }
+    return static_cast<i64>(static_cast<double>(ElapsedMs()) * (total_rows_ - processed_rows) / processed_rows);
+}
+
+SharedPtr<IndexBuildJob>
+IndexBuildTracer::AddJob(TransactionID txn_id, String db_name, String table_name, String index_name, SizeT total_rows, SizeT segment_count) {
+    std::lock_guard lock(mutex_);
+    std::erase_if(jobs_, [](const auto &item) { return item.second.expired(); });
+    u64 job_id = next_job_id_++;
+    auto job =
+        MakeShared<IndexBuildJob>(job_id, txn_id, std::move(db_name), std::move(table_name), std::move(index_name), total_rows, segment_count);
+    jobs_.emplace(job_id, job);
+    return job;
+}
+
+Vector<SharedPtr<IndexBuildJob>> IndexBuildTracer::GetJobs() {
+    Vector<SharedPtr<IndexBuildJob>> jobs;
+    std::lock_guard lock(mutex_);
+    for (auto iter = jobs_.begin(); iter != jobs_.end();) {
+        if (auto job = iter->second.lock(); job.get() != nullptr) {
+            jobs.push_back(std::move(job));
+            ++iter;
+        } else {
+            iter = jobs_.erase(iter);
+        }
+    }
+    return jobs;
+}
+
+bool IndexBuildTracer::CancelJob(u64 job_id) {
+    std::lock_guard lock(mutex_);
+    auto iter = jobs_.find(job_id);
+    if (iter == jobs_.end()) {
+        return false;
+    }
+    auto job = iter->second.lock();
+    if (job.get() == nullptr) {
+        jobs_.erase(iter);
+        return false;
+    }
+    job->Cancel();
+    return true;
+}
+
+} // namespace infinity
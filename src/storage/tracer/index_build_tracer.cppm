@@ -0,0 +1,86 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <chrono>
+
+export module index_build_tracer;
+
+import stl;
+
+namespace infinity {
+
+// The index build of a CREATE INDEX statement. The segments are built by the tasks of the statement,
+// which count the rows they have indexed and stop when the job is cancelled. The segments built before
+// the cancel are committed, and OPTIMIZE ... WITH (resume_build) builds the rest. Full-text and secondary
+// indexes have no per-segment fallback, so their build is rolled back instead.
+export class IndexBuildJob {
+public:
+    IndexBuildJob(u64 job_id, TransactionID txn_id, String db_name, String table_name, String index_name, SizeT total_rows, SizeT segment_count);
+
+    void AddProcessedRows(SizeT row_count) { processed_rows_.fetch_add(row_count, std::memory_order_relaxed); }
+
+    void FinishSegment() { finished_segments_.fetch_add(1, std::memory_order_relaxed); }
+
+    void Cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+
+    bool cancelled() const { return cancelled_.load(std::memory_order_relaxed); }
+
+    // Raise a QueryCancelled error to abandon the segment being built if the job is cancelled
+    void CheckCancelled() const;
+
+    SizeT processed_rows() const { return processed_rows_.load(std::memory_order_relaxed); }
+
+    SizeT finished_segments() const { return finished_segments_.load(std::memory_order_relaxed); }
+
+    i64 ElapsedMs() const;
+
+    // Extrapolated from the rows processed so far, -1 before any row is processed
+    i64 RemainingMs() const;
+
+public:
+    const u64 job_id_;
+    const TransactionID txn_id_;
+    const String db_name_;
+    const String table_name_;
+    const String index_name_;
+    const SizeT total_rows_;
+    const SizeT segment_count_;
+
+private:
+    const std::chrono::steady_clock::time_point begin_time_;
+    Atomic<SizeT> processed_rows_{0};
+    Atomic<SizeT> finished_segments_{0};
+    Atomic<bool> cancelled_{false};
+};
+
+// Running index builds, listed by SHOW INDEX BUILDS. A job is dropped when its statement releases it.
+export class IndexBuildTracer {
+public:
+    SharedPtr<IndexBuildJob>
+    AddJob(TransactionID txn_id, String db_name, String table_name, String index_name, SizeT total_rows, SizeT segment_count);
+
+    Vector<SharedPtr<IndexBuildJob>> GetJobs();
+
+    // Return false if no such job is running
+    bool CancelJob(u64 job_id);
+
+private:
+    std::mutex mutex_{};
+    u64 next_job_id_{1};
+    Map<u64, WeakPtr<IndexBuildJob>> jobs_{};
+};
+
+} // namespace infinity
@@ -348,8 +348,32 @@ Txn::CreateIndexPrepare(TableIndexEntry *table_index_entry, BaseTableRef *table_
     return {segment_index_entries, Status::OK()};
 }
 
+Pair<Vector<SegmentIndexEntry *>, Status> Txn::CreateIndexPrepareDeferred(TableIndexEntry *table_index_entry, BaseTableRef *table_ref) {
+    // Only the entries are created, the segments are populated by `CreateIndexDo` and so no chunk is added here
+    auto [segment_index_entries, status] = table_index_entry->CreateIndexPrepare(table_ref, this, true, true);
+    if (!status.ok()) {
+        return {segment_index_entries, status};
+    }
+    for (auto *segment_index_entry : segment_index_entries) {
+        segment_index_entry->DeferPopulate(txn_id_);
+    }
+    return {segment_index_entries, Status::OK()};
+}
+
+Vector<SegmentIndexEntry *> Txn::CreateIndexResume(TableIndexEntry *table_index_entry, BaseTableRef *table_ref) {
+    Vector<SegmentIndexEntry *> segment_index_entries = table_index_entry->CreateIndexResume(table_ref, this);
+    for (auto *segment_index_entry : segment_index_entries) {
+        segment_index_entry->DeferPopulate(txn_id_);
+    }
+    // So that the entries are dropped on rollback
+    auto *txn_table_store = txn_store_.GetTxnTableStore(table_ref->table_entry_ptr_);
+    txn_table_store->GetIndexStore(table_index_entry);
+    return segment_index_entries;
+}
+
 // TODO: use table ref instead of table entry
-Status Txn::CreateIndexDo(BaseTableRef *table_ref, const String &index_name, HashMap<SegmentID, atomic_u64> &create_index_idxes) {
+Status
+Txn::CreateIndexDo(BaseTableRef *table_ref, const String &index_name, HashMap<SegmentID, atomic_u64> &create_index_idxes, IndexBuildJob *build_job) {
     auto *table_entry = table_ref->table_entry_ptr_;
     const auto &db_name = *table_entry->GetDBName();
     const auto &table_name = *table_entry->GetTableName();
@@ -359,7 +383,22 @@ Status Txn::CreateIndexDo(BaseTableRef *table_ref, const String &index_name, Has
         return status;
     }
 
-    return table_index_entry->CreateIndexDo(table_ref, create_index_idxes, this);
+    auto [segment_index_entries, do_status] = table_index_entry->CreateIndexDo(table_ref, create_index_idxes, this, build_job);
+    if (!do_status.ok()) {
+        return do_status;
+    }
+
+    // The tasks of the operator populate different segments at the same time
+    std::lock_guard guard(txn_store_.mtx_);
+    auto *txn_table_store = txn_store_.GetTxnTableStore(table_entry);
+    for (auto *segment_index_entry : segment_index_entries) {
+        Vector<SharedPtr<ChunkIndexEntry>> chunk_index_entries;
+        segment_index_entry->GetChunkIndexEntries(chunk_index_entries);
+        for (auto &chunk_index_entry : chunk_index_entries) {
+            txn_table_store->AddChunkIndexStore(table_index_entry, chunk_index_entry.get());
+        }
+    }
+    return Status::OK();
 }
 
 Status Txn::CreateIndexFinish(const TableEntry *table_entry, const TableIndexEntry *table_index_entry) {
@@ -371,14 +410,12 @@ Status Txn::CreateIndexFinish(const TableEntry *table_entry, const TableIndexEnt
 }
 
 Status Txn::CreateIndexFinish(const String &db_name, const String &table_name, const SharedPtr<IndexBase> &index_base) {
-    // this->CheckTxn(db_name);
-
-    // auto [table_index_entry, status] = this->GetIndexByName(db_name, table_name, *index_base->index_name_);
-    // if (!status.ok()) {
-    //     return status;
-    // }
-    // String index_dir_tail = table_index_entry->GetPathNameTail();
-    // this->AddWalCmd(MakeShared<WalCmdCreateIndex>(db_name, table_name, std::move(index_dir_tail), index_base));
+    auto [table_index_entry, status] = this->GetIndexByName(db_name, table_name, *index_base->index_name_);
+    if (!status.ok()) {
+        return status;
+    }
+    // The segments of a cancelled build are committed without index
+    table_index_entry->DropDeferredSegments(txn_id_, false);
     return Status::OK();
 }
 
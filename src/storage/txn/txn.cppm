@@ -33,6 +33,7 @@ import extra_ddl_info;
 import internal_types;
 import column_def;
 import value;
+import index_build_tracer;
 
 namespace infinity {
 
@@ -150,7 +151,16 @@ public:
     Pair<Vector<SegmentIndexEntry *>, Status>
     CreateIndexPrepare(TableIndexEntry *table_index_entry, BaseTableRef *table_ref, bool prepare, bool check_ts = true);
 
-    Status CreateIndexDo(BaseTableRef *table_ref, const String &index_name, HashMap<SegmentID, atomic_u64> &create_index_idxes);
+    // Create the segment index entries of `table_index_entry` and leave their populate to `CreateIndexDo`
+    Pair<Vector<SegmentIndexEntry *>, Status> CreateIndexPrepareDeferred(TableIndexEntry *table_index_entry, BaseTableRef *table_ref);
+
+    // Create the entries of the segments that a cancelled build left without index, and leave their populate to `CreateIndexDo`
+    Vector<SegmentIndexEntry *> CreateIndexResume(TableIndexEntry *table_index_entry, BaseTableRef *table_ref);
+
+    Status CreateIndexDo(BaseTableRef *table_ref,
+                         const String &index_name,
+                         HashMap<SegmentID, atomic_u64> &create_index_idxes,
+                         IndexBuildJob *build_job = nullptr);
 
     Status CreateIndexFinish(const String &db_name, const String &table_name, const SharedPtr<IndexBase> &indef);
 
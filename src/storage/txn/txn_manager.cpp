@@ -118,7 +118,8 @@ TxnTimeStamp TxnManager::GetCommitTimeStampR(Txn *txn) {
 
 // Prepare to commit WriteTxn
 TxnTimeStamp TxnManager::GetCommitTimeStampW(Txn *txn) {
-    std::lock_guard guard(locker_);
+    std::unique_lock guard(locker_);
+    replay_cv_.wait(guard, [this] { return !replaying_; });
     start_ts_ += 2;
     TxnTimeStamp commit_ts = start_ts_;
     wait_conflict_ck_.emplace(commit_ts, nullptr);
@@ -279,6 +280,36 @@ TxnTimeStamp TxnManager::CurrentTS() const { return start_ts_; }
 
 TxnTimeStamp TxnManager::GetNewTimeStamp() { return start_ts_ + 1; }
 
+Status TxnManager::ReplayCommitted(TxnTimeStamp commit_ts, const std::function<void()> &replay) {
+    {
+        std::lock_guard guard(locker_);
+        // A reader begins at start_ts_ + 1 and sees the changes committed before it
+        if (commit_ts <= start_ts_ + 1) {
+            return Status::TxnConflict(0, fmt::format("change of leader at {} is not after the timestamp {} of this node", commit_ts, start_ts_));
+        }
+        if (!wait_conflict_ck_.empty()) {
+            return Status::TxnConflict(0, "a write transaction of this node is committing");
+        }
+        replaying_ = true;
+    }
+    auto finish_replay = [&](bool replayed) {
+        std::lock_guard guard(locker_);
+        if (replayed) {
+            start_ts_ = commit_ts;
+        }
+        replaying_ = false;
+        replay_cv_.notify_all();
+    };
+    try {
+        replay();
+    } catch (...) {
+        finish_replay(false);
+        throw;
+    }
+    finish_replay(true);
+    return Status::OK();
+}
+
 TxnTimeStamp TxnManager::GetCleanupScanTS() {
     std::lock_guard guard(locker_);
     TxnTimeStamp first_uncommitted_begin_ts = start_ts_;
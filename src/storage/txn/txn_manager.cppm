@@ -22,6 +22,7 @@ import buffer_manager;
 import txn_state;
 import wal_entry;
 import default_values;
+import status;
 
 namespace infinity {
 
@@ -94,6 +95,11 @@ public:
 
     TxnTimeStamp GetNewTimeStamp();
 
+    // Used by follower and learner, `replay` applies the changes committed on leader at `commit_ts` and makes them visible to
+    // new transactions once it returns. The transactions begun before don't see them and the write transactions of this node
+    // wait to commit until it returns.
+    Status ReplayCommitted(TxnTimeStamp commit_ts, const std::function<void()> &replay);
+
     TxnTimeStamp GetCleanupScanTS();
 
     void IncreaseCommittedTxnCount() { ++total_committed_txn_count_; }
@@ -126,6 +132,9 @@ private:
 
     Map<TxnTimeStamp, WalEntry *> wait_conflict_ck_{}; // sorted by commit ts
 
+    bool replaying_{false}; // Used by follower and learner, a change of leader is being replayed
+    std::condition_variable replay_cv_{};
+
     Atomic<TxnTimeStamp> start_ts_{}; // The next txn ts
     TxnTimeStamp ckp_begin_ts_ = UNCOMMIT_TS;     // cur ckp begin ts, 0 if no ckp is happening
 
@@ -39,6 +39,7 @@ import bg_task;
 import compact_statement;
 import build_fast_rough_filter_task;
 import create_index_info;
+import tensor_centroid_codes;
 
 namespace infinity {
 
@@ -116,12 +117,16 @@ void TxnIndexStore::Commit(TransactionID txn_id, TxnTimeStamp commit_ts) {
     }
 }
 
-void TxnIndexStore::Rollback() {
+void TxnIndexStore::Rollback(TransactionID txn_id, bool index_in_txn) {
     for (auto [segment_index_entry, new_chunk, old_chunks] : optimize_data_) {
         for (auto *old_chunk : old_chunks) {
             old_chunk->ResetOptimizing();
         }
     }
+    if (!index_in_txn) {
+        // The segments of an OPTIMIZE resuming a cancelled build
+        table_index_entry_->DropDeferredSegments(txn_id, true);
+    }
 }
 
 ///-----------------------------------------------------------------------------
@@ -169,21 +174,21 @@ Tuple<UniquePtr<String>, Status> TxnTableStore::Append(const SharedPtr<DataBlock
     }
     current_block = blocks_[current_block_id_].get();
 
-    if (current_block->row_count() + input_block->row_count() > current_block->capacity()) {
-        SizeT to_append = current_block->capacity() - current_block->row_count();
-        current_block->AppendWith(input_block.get(), 0, to_append);
+    // A large input block fills as many blocks as it needs
+    SizeT input_offset = 0;
+    const SizeT input_row_count = input_block->row_count();
+    while (input_offset < input_row_count) {
+        if (current_block->row_count() == current_block->capacity()) {
+            blocks_.emplace_back(DataBlock::Make());
+            blocks_.back()->Init(column_types);
+            ++current_block_id_;
+            current_block = blocks_[current_block_id_].get();
+        }
+        SizeT to_append = std::min(current_block->capacity() - current_block->row_count(), input_row_count - input_offset);
+        current_block->AppendWith(input_block.get(), input_offset, to_append);
         current_block->Finalize();
-
-        blocks_.emplace_back(DataBlock::Make());
-        blocks_.back()->Init(column_types);
-        ++current_block_id_;
-        current_block = blocks_[current_block_id_].get();
-        current_block->AppendWith(input_block.get(), to_append, input_block->row_count() - to_append);
-    } else {
-        SizeT to_append = input_block->row_count();
-        current_block->AppendWith(input_block.get(), 0, to_append);
+        input_offset += to_append;
     }
-    current_block->Finalize();
 
     has_update_ = true;
     return {nullptr, Status::OK()};
@@ -267,6 +272,14 @@ Tuple<UniquePtr<String>, Status> TxnTableStore::Compact(Vector<Pair<SharedPtr<Se
     }
     compact_state_ = TxnCompactStore(type);
     for (auto &[new_segment, old_segments] : segment_data) {
+        // The compacted segments were searched with pruning, so is the new one. Its codes are built while its rows are in the buffer.
+        const bool codes_requested = std::any_of(old_segments.begin(), old_segments.end(), [](const SegmentEntry *old_segment) {
+            return old_segment->TensorCentroidCodesRequested();
+        });
+        if (codes_requested && new_segment->TryStartBuildTensorCentroidCodes()) {
+            new_segment->SetTensorCentroidCodesRequested();
+            TensorCentroidCodes::BuildForSegment(new_segment.get(), txn_->buffer_mgr());
+        }
         auto txn_segment_store = TxnSegmentStore::AddSegmentStore(new_segment.get());
         compact_state_.compact_data_.emplace_back(std::move(txn_segment_store), old_segments);
         for (auto *old_segment : old_segments) {
@@ -305,7 +318,7 @@ void TxnTableStore::Rollback(TransactionID txn_id, TxnTimeStamp abort_ts) {
         Catalog::RemoveIndexEntry(table_index_entry, txn_id); // fix me
     }
     for (const auto &[index_name, txn_index_store] : txn_indexes_store_) {
-        txn_index_store->Rollback();
+        txn_index_store->Rollback(txn_id, txn_indexes_.contains(txn_index_store->table_index_entry_));
     }
 }
 
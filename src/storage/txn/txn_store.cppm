@@ -69,7 +69,8 @@ public:
 
     void Commit(TransactionID txn_id, TxnTimeStamp commit_ts);
 
-    void Rollback();
+    // `index_in_txn`: the index is created or dropped by the txn
+    void Rollback(TransactionID txn_id, bool index_in_txn);
 
 public:
     TableIndexEntry *const table_index_entry_{};
@@ -385,7 +385,7 @@ AddBlockEntryOp::AddBlockEntryOp(BlockEntry *block_entry, TxnTimeStamp commit_ts
 
 AddColumnEntryOp::AddColumnEntryOp(BlockColumnEntry *column_entry, TxnTimeStamp commit_ts)
     : CatalogDeltaOperation(CatalogDeltaOpType::ADD_COLUMN_ENTRY, column_entry, commit_ts) {
-    outline_info_ = {column_entry->OutlineBufferCount(), column_entry->LastChunkOff()};
+    outline_info_ = {column_entry->NextOutlineIdx(), column_entry->LastChunkOff()};
     Vector<String> paths = column_entry->FilePaths();
     local_paths_.insert(local_paths_.end(), paths.begin(), paths.end());
 }
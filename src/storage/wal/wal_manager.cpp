@@ -28,6 +28,8 @@ import third_party;
 import catalog;
 import table_entry_type;
 import infinity_context;
+import cluster_manager;
+import peer_task;
 import txn_store;
 import data_access_state;
 import status;
@@ -167,6 +169,14 @@ void WalManager::Flush() {
             continue;
         }
 
+        // Leader ships the entries to followers and learners after they are committed locally
+        ClusterManager *cluster_manager = InfinityContext::instance().cluster_manager();
+        SharedPtr<Vector<String>> log_strings{};
+        TxnTimeStamp last_log_ts = 0;
+        if (cluster_manager != nullptr && InfinityContext::instance().GetServerRole() == NodeRole::kLeader) {
+            log_strings = MakeShared<Vector<String>>();
+        }
+
         for (const auto &entry : log_batch) {
             // Empty WalEntry (read-only transactions) shouldn't go into WalManager.
             if (entry == nullptr) {
@@ -197,6 +207,10 @@ void WalManager::Flush() {
                 UnrecoverableError(error_message);
             }
             ofs_.write(buf.data(), ptr - buf.data());
+            if (log_strings.get() != nullptr) {
+                log_strings->emplace_back(buf.data(), act_size);
+                last_log_ts = entry->commit_ts_;
+            }
             LOG_TRACE(fmt::format("WalManager::Flush done writing wal for txn_id {}, commit_ts {}", entry->txn_id_, entry->commit_ts_));
 
             UpdateCommitState(entry->commit_ts_, wal_size_ + act_size);
@@ -229,6 +243,10 @@ void WalManager::Flush() {
         }
         log_batch.clear();
 
+        if (log_strings.get() != nullptr && !log_strings->empty()) {
+            cluster_manager->SyncLogs(log_strings, last_log_ts);
+        }
+
         // Check if the wal file is too large, swap to a new one.
         try {
             LocalFileSystem fs;
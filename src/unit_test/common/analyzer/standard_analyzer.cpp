@@ -125,6 +125,33 @@ TEST_F(StandardAnalyzerTest, test5) {
     //    ASSERT_EQ(term_list[3].word_offset_, 3U);
 }
 
+TEST_F(StandardAnalyzerTest, test_long_and_mixed_tokens) {
+    StandardAnalyzer analyzer;
+    analyzer.InitStemmer(STEM_LANG_ENGLISH);
+    analyzer.SetExtractEngStem(false);
+    String input("  AVeryLongTokenWhichSpansMoreThanOneSimdRegister, and/or caf\xc3\xa9\tNa\xc3\xafveTail");
+
+    TermList term_list;
+    analyzer.Analyze(input, term_list);
+    ASSERT_EQ(term_list.size(), 4U);
+    ASSERT_EQ(term_list[0].text_, String("averylongtokenwhichspansmorethanonesimdregister"));
+    ASSERT_EQ(term_list[0].word_offset_, 0U);
+    ASSERT_EQ(term_list[1].text_, String("andor"));
+    ASSERT_EQ(term_list[1].word_offset_, 1U);
+    ASSERT_EQ(term_list[2].text_, String("caf\xc3\xa9"));
+    ASSERT_EQ(term_list[2].word_offset_, 2U);
+    ASSERT_EQ(term_list[3].text_, String("na\xc3\xafvetail"));
+    ASSERT_EQ(term_list[3].word_offset_, 3U);
+
+    Vector<Pair<String, u32>> term_views;
+    analyzer.Analyze(input, [&](const char *text, u32 len, u32 offset) { term_views.emplace_back(String(text, len), offset); });
+    ASSERT_EQ(term_views.size(), term_list.size());
+    for (SizeT i = 0; i < term_views.size(); ++i) {
+        ASSERT_EQ(term_views[i].first, term_list[i].text_);
+        ASSERT_EQ(term_views[i].second, term_list[i].word_offset_);
+    }
+}
+
 TEST_F(StandardAnalyzerTest, test6) {
     StandardAnalyzer analyzer;
     analyzer.InitStemmer(STEM_LANG_ENGLISH);
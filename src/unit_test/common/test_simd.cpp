@@ -1,7 +1,12 @@
 #include "gtest/gtest.h"
+#include <cmath>
 import base_test;
 import stl;
 import simd_init;
+import simd_functions;
+import distance_simd_functions;
+import hnsw_simd_func;
+import internal_types;
 
 using namespace infinity;
 
@@ -17,3 +22,48 @@ TEST_F(SimdInitTest, GetSupportedSimdTypesList) {
     alignas(alignof(u16)) u8 v[2] = {1, 0};
     EXPECT_EQ(*reinterpret_cast<const u16 *>(v), 1u);
 }
+
+TEST_F(SimdInitTest, HalfDistanceFunctions) {
+    // not a multiple of the vector widths, so the tails are covered
+    const SizeT dim = 133;
+    Vector<f32> query(dim);
+    Vector<u16> f16_data(dim);
+    Vector<u16> bf16_data(dim);
+    Vector<f32> f16_widened(dim);
+    Vector<f32> bf16_widened(dim);
+    for (SizeT i = 0; i < dim; ++i) {
+        query[i] = std::sin(0.1f * i);
+        const f32 value = std::cos(0.3f * i) * 2.0f;
+        f16_data[i] = Float16T(value).raw;
+        bf16_data[i] = BFloat16T(value).raw;
+        f16_widened[i] = static_cast<f32>(Float16T(f16_data[i]));
+        bf16_widened[i] = static_cast<f32>(BFloat16T(bf16_data[i]));
+    }
+    const auto &simd_functions = GetSIMD_FUNCTIONS();
+    const f32 *x = query.data();
+    EXPECT_NEAR(simd_functions.F32F16L2Distance_func_ptr_(x, f16_data.data(), dim), L2Distance_common(x, f16_widened.data(), dim), 1e-3);
+    EXPECT_NEAR(simd_functions.F32F16IPDistance_func_ptr_(x, f16_data.data(), dim), IPDistance_common(x, f16_widened.data(), dim), 1e-3);
+    EXPECT_NEAR(simd_functions.F32F16CosineDistance_func_ptr_(x, f16_data.data(), dim), CosineDistance_common(x, f16_widened.data(), dim), 1e-5);
+    EXPECT_NEAR(simd_functions.F32BF16L2Distance_func_ptr_(x, bf16_data.data(), dim), L2Distance_common(x, bf16_widened.data(), dim), 1e-3);
+    EXPECT_NEAR(simd_functions.F32BF16IPDistance_func_ptr_(x, bf16_data.data(), dim), IPDistance_common(x, bf16_widened.data(), dim), 1e-3);
+    EXPECT_NEAR(simd_functions.F32BF16CosineDistance_func_ptr_(x, bf16_data.data(), dim),
+                CosineDistance_common(x, bf16_widened.data(), dim),
+                1e-5);
+    // the scalar float16 widening agrees with the type's, subnormals included
+    for (u16 raw : {u16(0x0000), u16(0x0001), u16(0x03ff), u16(0x3c00), u16(0xc000), u16(0x7bff), u16(0x8400)}) {
+        EXPECT_EQ(F32F16IPDistance_common(&query[1], &raw, 1), query[1] * static_cast<f32>(Float16T(raw)));
+    }
+}
+
+TEST_F(SimdInitTest, I8IPFunctions) {
+    const SizeT dim = 200;
+    Vector<i8> v1(dim);
+    Vector<i8> v2(dim);
+    for (SizeT i = 0; i < dim; ++i) {
+        v1[i] = static_cast<i8>((i * 37) % 256 - 128);
+        v2[i] = static_cast<i8>((i * 91 + 5) % 256 - 128);
+    }
+    const auto &simd_functions = GetSIMD_FUNCTIONS();
+    EXPECT_EQ(simd_functions.HNSW_I8IP_ptr_(v1.data(), v2.data(), dim), I8IPBF(v1.data(), v2.data(), dim));
+    EXPECT_EQ(simd_functions.HNSW_I8IP_64_ptr_(v1.data(), v2.data(), 192), I8IPBF(v1.data(), v2.data(), 192));
+}
@@ -0,0 +1,119 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import third_party;
+import column_vector;
+import value;
+import data_type;
+import logical_type;
+import internal_types;
+import in_value_set;
+
+using namespace infinity;
+
+class InValueSetTest : public BaseTest {
+protected:
+    static Vector<SharedPtr<ColumnVector>> ValueColumns(const Vector<Value> &values) {
+        Vector<SharedPtr<ColumnVector>> value_columns;
+        for (const Value &value : values) {
+            auto value_column = MakeShared<ColumnVector>(MakeShared<DataType>(value.type()));
+            value_column->Initialize(ColumnVectorType::kConstant, 1);
+            value_column->AppendValue(value);
+            value_columns.push_back(std::move(value_column));
+        }
+        return value_columns;
+    }
+
+    static SharedPtr<ColumnVector> BooleanOutput(SizeT capacity) {
+        auto output = MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kBoolean));
+        output->Initialize(ColumnVectorType::kCompactBit, capacity);
+        return output;
+    }
+};
+
+TEST_F(InValueSetTest, BigInt) {
+    const SizeT row_count = 100;
+    auto input = MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kBigInt));
+    input->Initialize(ColumnVectorType::kFlat, row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        input->AppendValue(Value::MakeBigInt(i));
+    }
+
+    // A short list is scanned, a long one is hashed
+    for (SizeT value_count : {SizeT(3), InValueSet::kScanLimit + 10}) {
+        Vector<Value> values;
+        for (SizeT i = 0; i < value_count; ++i) {
+            values.push_back(Value::MakeBigInt(i * 7));
+        }
+        auto in_value_set = InValueSet::Make(DataType(LogicalType::kBigInt), ValueColumns(values), false);
+        ASSERT_NE(in_value_set, nullptr);
+        for (bool negate : {false, true}) {
+            auto output = BooleanOutput(row_count);
+            in_value_set->Probe(*input, row_count, negate, *output);
+            ASSERT_EQ(output->Size(), row_count);
+            for (SizeT i = 0; i < row_count; ++i) {
+                const bool expected = (i % 7 == 0 && i / 7 < value_count) != negate;
+                EXPECT_EQ(output->buffer_->GetCompactBit(i), expected);
+                EXPECT_TRUE(output->nulls_ptr_->IsTrue(i));
+            }
+        }
+    }
+}
+
+TEST_F(InValueSetTest, Varchar) {
+    Vector<String> strings = {"tenant_a", "tenant_b", "a string which is too long to be inlined", ""};
+    auto input = MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kVarchar));
+    input->Initialize(ColumnVectorType::kFlat, strings.size());
+    for (const String &str : strings) {
+        input->AppendValue(Value::MakeVarchar(str));
+    }
+    auto in_value_set =
+        InValueSet::Make(DataType(LogicalType::kVarchar),
+                         ValueColumns({Value::MakeVarchar("a string which is too long to be inlined"), Value::MakeVarchar("tenant_b")}),
+                         false);
+    auto output = BooleanOutput(strings.size());
+    in_value_set->Probe(*input, strings.size(), false, *output);
+    EXPECT_FALSE(output->buffer_->GetCompactBit(0));
+    EXPECT_TRUE(output->buffer_->GetCompactBit(1));
+    EXPECT_TRUE(output->buffer_->GetCompactBit(2));
+    EXPECT_FALSE(output->buffer_->GetCompactBit(3));
+}
+
+TEST_F(InValueSetTest, Null) {
+    const SizeT row_count = 4;
+    auto input = MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kInteger));
+    input->Initialize(ColumnVectorType::kFlat, row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        input->AppendValue(Value::MakeInt(i));
+    }
+    input->nulls_ptr_->SetFalse(3);
+
+    // 1 IN (1, NULL) is true, 0 IN (1, NULL) is null
+    auto in_value_set = InValueSet::Make(DataType(LogicalType::kInteger), ValueColumns({Value::MakeInt(1)}), true);
+    for (bool negate : {false, true}) {
+        auto output = BooleanOutput(row_count);
+        in_value_set->Probe(*input, row_count, negate, *output);
+        EXPECT_FALSE(output->nulls_ptr_->IsTrue(0));
+        EXPECT_TRUE(output->nulls_ptr_->IsTrue(1));
+        EXPECT_EQ(output->buffer_->GetCompactBit(1), !negate);
+        EXPECT_FALSE(output->nulls_ptr_->IsTrue(2));
+        EXPECT_FALSE(output->nulls_ptr_->IsTrue(3));
+    }
+
+    EXPECT_EQ(InValueSet::Make(DataType(LogicalType::kBoolean), {}, false), nullptr);
+}
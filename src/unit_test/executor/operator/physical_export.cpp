@@ -0,0 +1,216 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <filesystem>
+#include <fstream>
+#include <lz4frame.h>
+#include <sstream>
+#include <zstd.h>
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import third_party;
+import infinity;
+import query_result;
+import data_block;
+import value;
+
+using namespace infinity;
+
+class PhysicalExportTest : public BaseTest {
+protected:
+    static constexpr i32 kRowCount = 20000; // three blocks
+
+    void SetUp() override {
+        RemoveDbDirs();
+        Infinity::LocalInit(GetHomeDir());
+        infinity_ = Infinity::LocalConnect();
+
+        const String file_path = String(GetFullTmpDir()) + "/export_source.csv";
+        {
+            std::ofstream file(file_path);
+            for (i32 i = 0; i < kRowCount; ++i) {
+                file << i << ",row " << i << "\n";
+            }
+        }
+        EXPECT_TRUE(infinity_->Query("CREATE TABLE t1 (c1 INTEGER, c2 VARCHAR);").IsOk());
+        EXPECT_TRUE(infinity_->Query(fmt::format("COPY t1 FROM '{}' WITH (DELIMITER ',', FORMAT CSV);", file_path)).IsOk());
+        // a few rows in the unsealed segment after the imported one
+        EXPECT_TRUE(infinity_->Query(fmt::format("INSERT INTO t1 VALUES ({}, 'row {}'), ({}, 'row {}');", kRowCount, kRowCount, kRowCount + 1, kRowCount + 1))
+                        .IsOk());
+
+        // the snapshot order of the rows
+        QueryResult result = infinity_->Query("SELECT c1, c2 FROM t1 ORDER BY ROW_ID();");
+        for (SizeT i = 0; i < result.result_table_->DataBlockCount(); ++i) {
+            const auto &data_block = result.result_table_->GetDataBlockById(i);
+            for (SizeT row = 0; row < data_block->row_count(); ++row) {
+                rows_.emplace_back(data_block->GetValue(0, row).value_.integer, data_block->GetValue(1, row).GetVarchar());
+            }
+        }
+        ASSERT_EQ(rows_.size(), SizeT(kRowCount + 2));
+    }
+
+    void TearDown() override {
+        EXPECT_TRUE(infinity_->Query("DROP TABLE t1;").IsOk());
+        infinity_->LocalDisconnect();
+        infinity_.reset();
+        Infinity::LocalUnInit();
+    }
+
+    static String ReadFile(const String &path) {
+        std::ifstream file(path, std::ios::binary);
+        EXPECT_TRUE(file.is_open()) << path;
+        std::stringstream ss;
+        ss << file.rdbuf();
+        return ss.str();
+    }
+
+    // Decompress a file of concatenated zstd frames
+    static String DecompressZstd(const String &data) {
+        String output;
+        Vector<char> buffer(ZSTD_DStreamOutSize());
+        ZSTD_DCtx *dctx = ZSTD_createDCtx();
+        ZSTD_inBuffer input{data.data(), data.size(), 0};
+        while (true) {
+            ZSTD_outBuffer out{buffer.data(), buffer.size(), 0};
+            SizeT ret = ZSTD_decompressStream(dctx, &out, &input);
+            if (ZSTD_isError(ret)) {
+                ADD_FAILURE() << ZSTD_getErrorName(ret);
+                break;
+            }
+            output.append(buffer.data(), out.pos);
+            if (input.pos == input.size && out.pos < out.size) {
+                break;
+            }
+        }
+        ZSTD_freeDCtx(dctx);
+        return output;
+    }
+
+    // Decompress a file of concatenated lz4 frames
+    static String DecompressLz4(const String &data) {
+        String output;
+        Vector<char> buffer(64 * 1024);
+        LZ4F_dctx *dctx = nullptr;
+        EXPECT_FALSE(LZ4F_isError(LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION)));
+        SizeT src_pos = 0;
+        while (true) {
+            SizeT dst_size = buffer.size();
+            SizeT src_size = data.size() - src_pos;
+            SizeT ret = LZ4F_decompress(dctx, buffer.data(), &dst_size, data.data() + src_pos, &src_size, nullptr);
+            if (LZ4F_isError(ret)) {
+                ADD_FAILURE() << LZ4F_getErrorName(ret);
+                break;
+            }
+            output.append(buffer.data(), dst_size);
+            src_pos += src_size;
+            if (src_pos == data.size() && dst_size < buffer.size()) {
+                break;
+            }
+        }
+        LZ4F_freeDecompressionContext(dctx);
+        return output;
+    }
+
+    static Vector<String> SplitLines(const String &text) {
+        Vector<String> lines;
+        std::stringstream ss(text);
+        String line;
+        while (std::getline(ss, line)) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    // The CSV lines of the rows [row_begin, row_end) of the snapshot
+    String CSVLines(SizeT row_begin, SizeT row_end) const {
+        String lines;
+        for (SizeT i = row_begin; i < row_end; ++i) {
+            lines += fmt::format("{},{}\n", rows_[i].first, rows_[i].second);
+        }
+        return lines;
+    }
+
+    SharedPtr<Infinity> infinity_{};
+    Vector<Pair<i32, String>> rows_{};
+};
+
+TEST_F(PhysicalExportTest, csv_zstd_round_trip) {
+    const String file_path = String(GetFullTmpDir()) + "/export.csv.zst";
+    QueryResult result = infinity_->Query(fmt::format("COPY t1 TO '{}' WITH (FORMAT CSV, DELIMITER ',', COMPRESSION zstd);", file_path));
+    EXPECT_TRUE(result.IsOk()) << result.ErrorMsg();
+
+    // one frame per block range, appended in snapshot order
+    EXPECT_EQ(DecompressZstd(ReadFile(file_path)), CSVLines(0, rows_.size()));
+}
+
+TEST_F(PhysicalExportTest, jsonl_lz4_round_trip) {
+    const String file_path = String(GetFullTmpDir()) + "/export.jsonl.lz4";
+    QueryResult result = infinity_->Query(fmt::format("COPY t1 TO '{}' WITH (FORMAT JSONL, COMPRESSION lz4);", file_path));
+    EXPECT_TRUE(result.IsOk()) << result.ErrorMsg();
+
+    Vector<String> lines = SplitLines(DecompressLz4(ReadFile(file_path)));
+    ASSERT_EQ(lines.size(), rows_.size());
+    for (SizeT i = 0; i < lines.size(); ++i) {
+        nlohmann::json line_json = nlohmann::json::parse(lines[i]);
+        EXPECT_EQ(line_json["c1"].get<i32>(), rows_[i].first);
+        EXPECT_EQ(line_json["c2"].get<String>(), rows_[i].second);
+    }
+}
+
+TEST_F(PhysicalExportTest, csv_row_limit_parts) {
+    // the parts don't line up with the blocks of 8192 rows
+    constexpr SizeT offset = 100;
+    constexpr SizeT limit = 19000;
+    constexpr SizeT row_limit = 6000;
+    const String file_path = String(GetFullTmpDir()) + "/export_parts.csv.zst";
+    QueryResult result = infinity_->Query(fmt::format("COPY t1 TO '{}' WITH (FORMAT CSV, DELIMITER ',', COMPRESSION zstd, OFFSET {}, LIMIT {}, ROWLIMIT {});",
+                                                      file_path,
+                                                      offset,
+                                                      limit,
+                                                      row_limit));
+    EXPECT_TRUE(result.IsOk()) << result.ErrorMsg();
+
+    constexpr SizeT part_count = (limit + row_limit - 1) / row_limit;
+    for (SizeT part_no = 0; part_no < part_count; ++part_no) {
+        String part_path = part_no == 0 ? file_path : fmt::format("{}.part{}", file_path, part_no);
+        SizeT row_begin = offset + part_no * row_limit;
+        SizeT row_end = std::min(offset + limit, row_begin + row_limit);
+        EXPECT_EQ(DecompressZstd(ReadFile(part_path)), CSVLines(row_begin, row_end)) << part_path;
+    }
+    EXPECT_FALSE(std::filesystem::exists(fmt::format("{}.part{}", file_path, part_count)));
+}
+
+TEST_F(PhysicalExportTest, jsonl_row_limit_parts) {
+    constexpr SizeT row_limit = 8000;
+    const String file_path = String(GetFullTmpDir()) + "/export_parts.jsonl";
+    QueryResult result = infinity_->Query(fmt::format("COPY t1 TO '{}' WITH (FORMAT JSONL, COMPRESSION none, ROWLIMIT {});", file_path, row_limit));
+    EXPECT_TRUE(result.IsOk()) << result.ErrorMsg();
+
+    const SizeT part_count = (rows_.size() + row_limit - 1) / row_limit;
+    for (SizeT part_no = 0; part_no < part_count; ++part_no) {
+        String part_path = part_no == 0 ? file_path : fmt::format("{}.part{}", file_path, part_no);
+        Vector<String> lines = SplitLines(ReadFile(part_path));
+        SizeT row_begin = part_no * row_limit;
+        SizeT row_end = std::min(rows_.size(), row_begin + row_limit);
+        ASSERT_EQ(lines.size(), row_end - row_begin) << part_path;
+        for (SizeT i = 0; i < lines.size(); ++i) {
+            nlohmann::json line_json = nlohmann::json::parse(lines[i]);
+            EXPECT_EQ(line_json["c1"].get<i32>(), rows_[row_begin + i].first);
+        }
+    }
+    EXPECT_FALSE(std::filesystem::exists(fmt::format("{}.part{}", file_path, part_count)));
+}
@@ -0,0 +1,152 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <fstream>
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import third_party;
+import infinity;
+import query_result;
+import data_block;
+import value;
+import physical_import;
+import status;
+
+using namespace infinity;
+
+class PhysicalImportTest : public BaseTest {
+protected:
+    void SetUp() override {
+        RemoveDbDirs();
+        Infinity::LocalInit(GetHomeDir());
+        infinity_ = Infinity::LocalConnect();
+        old_import_range_min_size_ = PhysicalImport::ImportRangeMinSize();
+    }
+
+    void TearDown() override {
+        PhysicalImport::SetImportRangeMinSize(old_import_range_min_size_);
+        infinity_->LocalDisconnect();
+        infinity_.reset();
+        Infinity::LocalUnInit();
+    }
+
+    // Values of the first column of all result rows
+    static Vector<Value> FirstColumn(const QueryResult &result) {
+        Vector<Value> values;
+        for (SizeT i = 0; i < result.result_table_->DataBlockCount(); ++i) {
+            const auto &data_block = result.result_table_->GetDataBlockById(i);
+            for (SizeT row = 0; row < data_block->row_count(); ++row) {
+                values.push_back(data_block->GetValue(0, row));
+            }
+        }
+        return values;
+    }
+
+    SharedPtr<Infinity> infinity_{};
+    SizeT old_import_range_min_size_{};
+};
+
+TEST_F(PhysicalImportTest, parallel_csv_import) {
+    constexpr i32 row_count = 20000;
+    const String file_path = String(GetFullTmpDir()) + "/parallel_import.csv";
+    {
+        std::ofstream file(file_path);
+        for (i32 i = 0; i < row_count; ++i) {
+            file << i << ",\"row " << i << "\"\n";
+        }
+    }
+    // about 300KB, split into as many ranges as there are import threads
+    PhysicalImport::SetImportRangeMinSize(16 * 1024);
+
+    EXPECT_TRUE(infinity_->Query("CREATE TABLE t1 (c1 INTEGER, c2 VARCHAR);").IsOk());
+    const String copy_sql = fmt::format("COPY t1 FROM '{}' WITH (DELIMITER ',', FORMAT CSV);", file_path);
+    EXPECT_TRUE(infinity_->Query(copy_sql).IsOk());
+    EXPECT_TRUE(infinity_->Query(copy_sql).IsOk());
+
+    // rows keep the file order, the second import after the first one
+    Vector<Value> c1_values = FirstColumn(infinity_->Query("SELECT c1 FROM t1 ORDER BY ROW_ID();"));
+    ASSERT_EQ(c1_values.size(), SizeT(2 * row_count));
+    for (SizeT i = 0; i < c1_values.size(); ++i) {
+        EXPECT_EQ(c1_values[i].value_.integer, i32(i % row_count));
+    }
+    Vector<Value> c2_values = FirstColumn(infinity_->Query("SELECT c2 FROM t1 WHERE c1 = 12345;"));
+    ASSERT_EQ(c2_values.size(), 2u);
+    EXPECT_EQ(c2_values[0].GetVarchar(), "row 12345");
+
+    // one segment per range, and no segment id is left unused between the two imports
+    Vector<Value> segment_ids = FirstColumn(infinity_->ShowSegments("default_db", "t1"));
+    EXPECT_GE(segment_ids.size(), 4u);
+    Vector<i64> ids;
+    for (const auto &segment_id : segment_ids) {
+        ids.push_back(segment_id.value_.big_int);
+    }
+    std::sort(ids.begin(), ids.end());
+    for (SizeT i = 0; i < ids.size(); ++i) {
+        EXPECT_EQ(ids[i], i64(i));
+    }
+
+    EXPECT_TRUE(infinity_->Query("DROP TABLE t1;").IsOk());
+}
+
+TEST_F(PhysicalImportTest, parallel_jsonl_import_malformed_line) {
+    constexpr i32 row_count = 20000;
+    constexpr i32 malformed_line = 15000;
+    const String file_path = String(GetFullTmpDir()) + "/parallel_import_malformed.jsonl";
+    auto write_file = [&](bool malformed) {
+        std::ofstream file(file_path);
+        for (i32 i = 0; i < row_count; ++i) {
+            file << "{\"c1\": " << i << ", \"c2\": \"row " << i << "\"";
+            // the closing brace of one line is missing
+            file << (malformed && i + 1 == malformed_line ? "\n" : "}\n");
+        }
+    };
+    write_file(true);
+    // about 600KB, split into as many ranges as there are import threads
+    PhysicalImport::SetImportRangeMinSize(16 * 1024);
+
+    EXPECT_TRUE(infinity_->Query("CREATE TABLE t1 (c1 INTEGER, c2 VARCHAR);").IsOk());
+    const String copy_sql = fmt::format("COPY t1 FROM '{}' WITH (FORMAT JSONL);", file_path);
+    {
+        QueryResult result = infinity_->Query(copy_sql);
+        EXPECT_FALSE(result.IsOk());
+        EXPECT_EQ(result.ErrorCode(), ErrorCode::kInvalidJsonFormat);
+        EXPECT_NE(String(result.ErrorMsg()).find(fmt::format("line {}:", malformed_line)), String::npos);
+    }
+    EXPECT_TRUE(FirstColumn(infinity_->ShowSegments("default_db", "t1")).empty());
+
+    // the segment ids reserved by the failed import are given back
+    write_file(false);
+    EXPECT_TRUE(infinity_->Query(copy_sql).IsOk());
+    Vector<Value> c1_values = FirstColumn(infinity_->Query("SELECT c1 FROM t1 ORDER BY ROW_ID();"));
+    ASSERT_EQ(c1_values.size(), SizeT(row_count));
+    for (SizeT i = 0; i < c1_values.size(); ++i) {
+        EXPECT_EQ(c1_values[i].value_.integer, i32(i));
+    }
+    Vector<Value> segment_ids = FirstColumn(infinity_->ShowSegments("default_db", "t1"));
+    EXPECT_GE(segment_ids.size(), 2u);
+    Vector<i64> ids;
+    for (const auto &segment_id : segment_ids) {
+        ids.push_back(segment_id.value_.big_int);
+    }
+    std::sort(ids.begin(), ids.end());
+    for (SizeT i = 0; i < ids.size(); ++i) {
+        EXPECT_EQ(ids[i], i64(i));
+    }
+
+    EXPECT_TRUE(infinity_->Query("DROP TABLE t1;").IsOk());
+}
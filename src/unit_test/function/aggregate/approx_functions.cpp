@@ -0,0 +1,164 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import infinity_exception;
+
+import global_resource_usage;
+import third_party;
+
+import logger;
+import stl;
+import infinity_context;
+import catalog;
+import approx_count_distinct;
+import approx_percentile;
+import function_set;
+import aggregate_function_set;
+import aggregate_function;
+import function;
+import column_expression;
+import value;
+import default_values;
+import data_block;
+import internal_types;
+import logical_type;
+import data_type;
+using namespace infinity;
+
+class ApproxFunctionTest : public BaseTestParamStr {
+protected:
+    static AggregateFunction GetFunction(const UniquePtr<Catalog> &catalog_ptr, const String &name, LogicalType logical_type) {
+        SharedPtr<FunctionSet> function_set = Catalog::GetFunctionSetByName(catalog_ptr.get(), name);
+        EXPECT_EQ(function_set->type_, FunctionType::kAggregate);
+        SharedPtr<AggregateFunctionSet> aggregate_function_set = std::static_pointer_cast<AggregateFunctionSet>(function_set);
+        SharedPtr<ColumnExpression> col_expr_ptr = MakeShared<ColumnExpression>(DataType(logical_type), "t1", 1, "c1", 0, 0);
+        return aggregate_function_set->GetMostMatchFunction(col_expr_ptr);
+    }
+
+    // Update a new state of `func` with the values, one block at a time
+    static UniquePtr<char[]> Aggregate(const AggregateFunction &func, const Vector<Value> &values) {
+        auto data_state = func.InitState();
+        func.init_func_(data_state.get());
+        Vector<SharedPtr<DataType>> column_types{MakeShared<DataType>(func.argument_type_)};
+        for (SizeT offset = 0; offset < values.size(); offset += DEFAULT_VECTOR_SIZE) {
+            DataBlock data_block;
+            data_block.Init(column_types);
+            for (SizeT i = offset; i < std::min(offset + DEFAULT_VECTOR_SIZE, values.size()); ++i) {
+                data_block.AppendValue(0, values[i]);
+            }
+            data_block.Finalize();
+            func.update_func_(data_state.get(), data_block.column_vectors[0]);
+        }
+        return data_state;
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(TestWithDifferentParams, ApproxFunctionTest, ::testing::Values(BaseTestParamStr::NULL_CONFIG_PATH));
+
+TEST_P(ApproxFunctionTest, approx_count_distinct_func) {
+    using namespace infinity;
+
+    UniquePtr<Catalog> catalog_ptr = MakeUnique<Catalog>();
+
+    RegisterApproxCountDistinctFunction(catalog_ptr);
+
+    {
+        AggregateFunction func = GetFunction(catalog_ptr, "approx_count_distinct", LogicalType::kBigInt);
+        EXPECT_STREQ("APPROX_COUNT_DISTINCT(BigInt)->BigInt", func.ToString().c_str());
+        EXPECT_TRUE(func.merge_func_);
+
+        // 3 * DEFAULT_VECTOR_SIZE rows with 10000 distinct values
+        Vector<Value> values;
+        for (SizeT i = 0; i < 3 * DEFAULT_VECTOR_SIZE; ++i) {
+            values.push_back(Value::MakeBigInt(i % 10000));
+        }
+        auto data_state = Aggregate(func, values);
+        BigIntT result = *(BigIntT *)func.finalize_func_(data_state.get());
+        EXPECT_NEAR(result, 10000, 300);
+
+        // Two overlapping halves merged together
+        Vector<Value> left_values(values.begin(), values.begin() + 12000);
+        Vector<Value> right_values(values.begin() + 8000, values.end());
+        auto left_state = Aggregate(func, left_values);
+        auto right_state = Aggregate(func, right_values);
+        func.merge_func_(left_state.get(), right_state.get());
+        BigIntT merged_result = *(BigIntT *)func.finalize_func_(left_state.get());
+        EXPECT_EQ(merged_result, result);
+    }
+
+    {
+        AggregateFunction func = GetFunction(catalog_ptr, "approx_count_distinct", LogicalType::kVarchar);
+        EXPECT_STREQ("APPROX_COUNT_DISTINCT(Varchar)->BigInt", func.ToString().c_str());
+
+        Vector<Value> values;
+        for (SizeT i = 0; i < 1000; ++i) {
+            values.push_back(Value::MakeVarchar(fmt::format("a string which is too long to be inlined {}", i % 100)));
+        }
+        auto data_state = Aggregate(func, values);
+        BigIntT result = *(BigIntT *)func.finalize_func_(data_state.get());
+        EXPECT_NEAR(result, 100, 3);
+    }
+
+    {
+        // No input
+        AggregateFunction func = GetFunction(catalog_ptr, "approx_count_distinct", LogicalType::kDouble);
+        auto data_state = Aggregate(func, {});
+        EXPECT_EQ(*(BigIntT *)func.finalize_func_(data_state.get()), 0);
+    }
+}
+
+TEST_P(ApproxFunctionTest, approx_percentile_func) {
+    using namespace infinity;
+
+    UniquePtr<Catalog> catalog_ptr = MakeUnique<Catalog>();
+
+    RegisterApproxPercentileFunction(catalog_ptr);
+
+    Vector<Value> values;
+    for (SizeT i = 0; i < 100000; ++i) {
+        // A permutation of 0 .. 99999, so the values aren't sorted
+        values.push_back(Value::MakeInt((i * 7919) % 100000));
+    }
+
+    {
+        AggregateFunction func = GetFunction(catalog_ptr, "approx_percentile", LogicalType::kInteger);
+        EXPECT_STREQ("APPROX_PERCENTILE(Integer)->Double", func.ToString().c_str());
+
+        // The median by default
+        auto data_state = Aggregate(func, values);
+        DoubleT result = *(DoubleT *)func.finalize_func_(data_state.get());
+        EXPECT_NEAR(result, 50000, 500);
+    }
+
+    for (f64 quantile : {0.0, 0.01, 0.25, 0.99, 1.0}) {
+        AggregateFunction func = GetFunction(catalog_ptr, "approx_percentile", LogicalType::kInteger);
+        BindApproxPercentile(func, quantile);
+
+        auto data_state = Aggregate(func, values);
+        DoubleT result = *(DoubleT *)func.finalize_func_(data_state.get());
+        EXPECT_NEAR(result, quantile * 99999, 500);
+
+        // Partial states of two tasks
+        Vector<Value> left_values(values.begin(), values.begin() + 30000);
+        Vector<Value> right_values(values.begin() + 30000, values.end());
+        auto left_state = Aggregate(func, left_values);
+        auto right_state = Aggregate(func, right_values);
+        func.merge_func_(left_state.get(), right_state.get());
+        DoubleT merged_result = *(DoubleT *)func.finalize_func_(left_state.get());
+        EXPECT_NEAR(merged_result, quantile * 99999, 500);
+    }
+}
@@ -0,0 +1,269 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import connection;
+
+using namespace infinity;
+
+// A PG client speaking the extended query protocol to a connection served on another thread
+class PGExtendedQueryTest : public BaseTestParamStr {
+protected:
+    static constexpr u32 PG_INT4_OID = 23;
+
+    struct Message {
+        char type_{};
+        String body_{};
+    };
+
+    void SetUp() override {
+        BaseTestParamStr::SetUp();
+        boost::asio::ip::tcp::acceptor acceptor(io_service_, boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address("127.0.0.1"), 0));
+        connection_ = MakeShared<Connection>(io_service_);
+        client_.connect(acceptor.local_endpoint());
+        acceptor.accept(*connection_->socket());
+        server_thread_ = Thread([this] { connection_->Run(); });
+
+        // Startup message: length, protocol version 3.0, parameters
+        String startup;
+        AppendU32(startup, 196608);
+        startup += String("user\0infinity\0\0", 15);
+        String message;
+        AppendU32(message, startup.size() + 4);
+        boost::asio::write(client_, boost::asio::buffer(message + startup));
+        Vector<Message> replies = ReceiveUntilReady();
+        ASSERT_FALSE(replies.empty());
+        EXPECT_EQ(replies.front().type_, 'R');
+    }
+
+    void TearDown() override {
+        Send('X', "");
+        server_thread_.join();
+        client_.close();
+        connection_.reset();
+        BaseTestParamStr::TearDown();
+    }
+
+    static void AppendU16(String &buffer, u16 value) {
+        buffer.push_back(static_cast<char>(value >> 8));
+        buffer.push_back(static_cast<char>(value));
+    }
+
+    static void AppendU32(String &buffer, u32 value) {
+        for (int shift = 24; shift >= 0; shift -= 8) {
+            buffer.push_back(static_cast<char>(value >> shift));
+        }
+    }
+
+    static u32 ReadU32(const char *data) {
+        u32 value = 0;
+        for (int i = 0; i < 4; ++i) {
+            value = (value << 8) | static_cast<u8>(data[i]);
+        }
+        return value;
+    }
+
+    void Send(char type, const String &body) {
+        String message(1, type);
+        AppendU32(message, body.size() + 4);
+        message += body;
+        boost::asio::write(client_, boost::asio::buffer(message));
+    }
+
+    Message Receive() {
+        char header[5];
+        boost::asio::read(client_, boost::asio::buffer(header, sizeof(header)));
+        Message message{header[0], String(ReadU32(header + 1) - 4, '\0')};
+        boost::asio::read(client_, boost::asio::buffer(message.body_.data(), message.body_.size()));
+        return message;
+    }
+
+    Vector<Message> ReceiveUntilReady() {
+        Vector<Message> messages;
+        do {
+            messages.push_back(Receive());
+        } while (messages.back().type_ != 'Z');
+        return messages;
+    }
+
+    // Message types of the replies, 'Z' excluded
+    static String Types(const Vector<Message> &messages) {
+        String types;
+        for (const auto &message : messages) {
+            if (message.type_ != 'Z') {
+                types.push_back(message.type_);
+            }
+        }
+        return types;
+    }
+
+    // Text values of the DataRow replies
+    static Vector<Vector<String>> Rows(const Vector<Message> &messages) {
+        Vector<Vector<String>> rows;
+        for (const auto &message : messages) {
+            if (message.type_ != 'D') {
+                continue;
+            }
+            const char *ptr = message.body_.data();
+            u16 column_count = (static_cast<u8>(ptr[0]) << 8) | static_cast<u8>(ptr[1]);
+            ptr += 2;
+            auto &row = rows.emplace_back();
+            for (u16 i = 0; i < column_count; ++i) {
+                u32 length = ReadU32(ptr);
+                ptr += 4;
+                row.emplace_back(ptr, length);
+                ptr += length;
+            }
+        }
+        return rows;
+    }
+
+    void SimpleQuery(const String &query) {
+        Send('Q', query + String(1, '\0'));
+        Vector<Message> replies = ReceiveUntilReady();
+        EXPECT_EQ(Types(replies).find('E'), String::npos) << query;
+    }
+
+    void Parse(const String &statement_name, const String &query, const Vector<u32> &parameter_types) {
+        String body = statement_name + String(1, '\0') + query + String(1, '\0');
+        AppendU16(body, parameter_types.size());
+        for (u32 type_oid : parameter_types) {
+            AppendU32(body, type_oid);
+        }
+        Send('P', body);
+    }
+
+    // Parameters are all in `format`, results in text format
+    void Bind(const String &portal_name, const String &statement_name, i16 format, const Vector<String> &parameters) {
+        String body = portal_name + String(1, '\0') + statement_name + String(1, '\0');
+        AppendU16(body, 1);
+        AppendU16(body, format);
+        AppendU16(body, parameters.size());
+        for (const auto &parameter : parameters) {
+            AppendU32(body, parameter.size());
+            body += parameter;
+        }
+        AppendU16(body, 0);
+        Send('B', body);
+    }
+
+    void Execute(const String &portal_name, u32 max_rows) {
+        String body = portal_name + String(1, '\0');
+        AppendU32(body, max_rows);
+        Send('E', body);
+    }
+
+    void Sync() { Send('S', ""); }
+
+    boost::asio::io_service io_service_{};
+    boost::asio::ip::tcp::socket client_{io_service_};
+    SharedPtr<Connection> connection_{};
+    Thread server_thread_{};
+};
+
+INSTANTIATE_TEST_SUITE_P(TestWithDifferentParams, PGExtendedQueryTest, ::testing::Values(BaseTestParamStr::NULL_CONFIG_PATH));
+
+TEST_P(PGExtendedQueryTest, parse_bind_execute) {
+    SimpleQuery("CREATE TABLE t1 (c1 INTEGER, c2 VARCHAR);");
+    SimpleQuery("INSERT INTO t1 VALUES (1, 'a'), (2, 'b'), (3, 'c');");
+
+    Parse("s1", "SELECT c2 FROM t1 WHERE c1 = $1", {PG_INT4_OID});
+    Bind("", "s1", 0, {"2"});
+    Execute("", 0);
+    Sync();
+    Vector<Message> replies = ReceiveUntilReady();
+    EXPECT_EQ(Types(replies), "12DC");
+    EXPECT_EQ(Rows(replies), (Vector<Vector<String>>{{"b"}}));
+
+    // The statement is bound again, with a binary parameter
+    String binary_value;
+    AppendU32(binary_value, 3);
+    Bind("", "s1", 1, {binary_value});
+    Execute("", 0);
+    Sync();
+    replies = ReceiveUntilReady();
+    EXPECT_EQ(Types(replies), "2DC");
+    EXPECT_EQ(Rows(replies), (Vector<Vector<String>>{{"c"}}));
+
+    // Statements other than SELECT get their parameters substituted
+    Parse("", "INSERT INTO t1 VALUES ($1, $2)", {PG_INT4_OID, 0});
+    Bind("", "", 0, {"4", "it's"});
+    Execute("", 0);
+    Sync();
+    String types = Types(ReceiveUntilReady());
+    EXPECT_EQ(types.find('E'), String::npos);
+    EXPECT_EQ(types.substr(0, 2), "12");
+    EXPECT_EQ(types.back(), 'C');
+
+    Bind("", "s1", 0, {"4"});
+    Execute("", 0);
+    Sync();
+    EXPECT_EQ(Rows(ReceiveUntilReady()), (Vector<Vector<String>>{{"it's"}}));
+
+    SimpleQuery("DROP TABLE t1;");
+}
+
+TEST_P(PGExtendedQueryTest, execute_max_rows) {
+    SimpleQuery("CREATE TABLE t1 (c1 INTEGER);");
+    SimpleQuery("INSERT INTO t1 VALUES (1), (2), (3);");
+
+    Parse("", "SELECT c1 FROM t1", {});
+    Bind("p1", "", 0, {});
+    Execute("p1", 2);
+    Execute("p1", 2);
+    Sync();
+    Vector<Message> replies = ReceiveUntilReady();
+    EXPECT_EQ(Types(replies), "12DDsDC");
+    EXPECT_EQ(Rows(replies), (Vector<Vector<String>>{{"1"}, {"2"}, {"3"}}));
+
+    SimpleQuery("DROP TABLE t1;");
+}
+
+TEST_P(PGExtendedQueryTest, error_until_sync) {
+    SimpleQuery("CREATE TABLE t1 (c1 INTEGER);");
+    SimpleQuery("INSERT INTO t1 VALUES (1), (2);");
+
+    Parse("s1", "SELECT c1 FROM t1 WHERE c1 = $1", {PG_INT4_OID});
+    Sync();
+    EXPECT_EQ(Types(ReceiveUntilReady()), "1");
+
+    // A binary int4 of 2 bytes is rejected, the commands until Sync are discarded
+    Bind("", "s1", 1, {String("\0\1", 2)});
+    Execute("", 0);
+    Sync();
+    EXPECT_EQ(Types(ReceiveUntilReady()), "E");
+
+    // Wrong parameter count
+    Bind("", "s1", 0, {"1", "2"});
+    Execute("", 0);
+    Sync();
+    EXPECT_EQ(Types(ReceiveUntilReady()), "E");
+
+    // The connection goes on after Sync
+    Bind("", "s1", 0, {"1"});
+    Execute("", 0);
+    Sync();
+    Vector<Message> replies = ReceiveUntilReady();
+    EXPECT_EQ(Types(replies), "2DC");
+    EXPECT_EQ(Rows(replies), (Vector<Vector<String>>{{"1"}}));
+
+    SimpleQuery("DROP TABLE t1;");
+}
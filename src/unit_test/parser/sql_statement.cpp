@@ -44,6 +44,10 @@ import drop_index_info;
 import table_reference;
 import parser_result;
 import statement_common;
+import prepare_statement;
+import execute_statement;
+import parameter_expr;
+import parsed_expr;
 
 using namespace infinity;
 class StatementParsingTest : public BaseTest {};
@@ -523,3 +527,91 @@ TEST_F(StatementParsingTest, good_test1) {
         result->Reset();
     }
 }
+
+TEST_F(StatementParsingTest, prepare_execute_test) {
+    using namespace infinity;
+    SharedPtr<SQLParser> parser = MakeShared<SQLParser>();
+    SharedPtr<ParserResult> result = MakeShared<ParserResult>();
+
+    {
+        String input_sql = "PREPARE q1 AS SELECT a FROM t1 WHERE a > ? AND b < ?;";
+        parser->Parse(input_sql, result.get());
+
+        EXPECT_TRUE(result->error_message_.empty());
+        EXPECT_FALSE(result->statements_ptr_ == nullptr);
+
+        BaseStatement *statement = (*result->statements_ptr_)[0];
+        EXPECT_EQ(statement->type_, StatementType::kPrepare);
+        auto *prepare_statement = (PrepareStatement *)(statement);
+        EXPECT_EQ(prepare_statement->name_, "q1");
+        EXPECT_EQ(prepare_statement->parameter_count_, 2u);
+        EXPECT_FALSE(prepare_statement->statement_ == nullptr);
+        EXPECT_EQ(prepare_statement->statement_->type_, StatementType::kSelect);
+
+        result->Reset();
+    }
+
+    {
+        // the parameters are counted per statement
+        String input_sql = "PREPARE q1 AS SELECT a FROM t1 WHERE a > ? AND b < ?; PREPARE q2 AS SELECT a FROM t1 WHERE a = ?;";
+        parser->Parse(input_sql, result.get());
+
+        EXPECT_TRUE(result->error_message_.empty());
+        EXPECT_FALSE(result->statements_ptr_ == nullptr);
+        ASSERT_EQ(result->statements_ptr_->size(), 2u);
+
+        auto *prepare_statement1 = (PrepareStatement *)(*result->statements_ptr_)[0];
+        EXPECT_EQ(prepare_statement1->name_, "q1");
+        EXPECT_EQ(prepare_statement1->parameter_count_, 2u);
+
+        auto *prepare_statement2 = (PrepareStatement *)(*result->statements_ptr_)[1];
+        EXPECT_EQ(prepare_statement2->name_, "q2");
+        EXPECT_EQ(prepare_statement2->parameter_count_, 1u);
+        auto *select_statement = (SelectStatement *)(prepare_statement2->statement_);
+        auto *where_expr = (FunctionExpr *)(select_statement->where_expr_);
+        EXPECT_EQ(where_expr->type_, ParsedExprType::kFunction);
+        ParsedExpr *parameter = (*where_expr->arguments_)[1];
+        EXPECT_EQ(parameter->type_, ParsedExprType::kParameter);
+        EXPECT_EQ(((ParameterExpr *)parameter)->index_, 0u);
+
+        result->Reset();
+    }
+
+    {
+        String input_sql = "EXECUTE q1 (1, 'abc');";
+        parser->Parse(input_sql, result.get());
+
+        EXPECT_TRUE(result->error_message_.empty());
+        EXPECT_FALSE(result->statements_ptr_ == nullptr);
+
+        BaseStatement *statement = (*result->statements_ptr_)[0];
+        EXPECT_EQ(statement->type_, StatementType::kExecute);
+        auto *execute_statement = (ExecuteStatement *)(statement);
+        EXPECT_EQ(execute_statement->name_, "q1");
+        EXPECT_FALSE(execute_statement->parameters_ == nullptr);
+        EXPECT_EQ(execute_statement->parameters_->size(), 2u);
+        EXPECT_EQ((*execute_statement->parameters_)[0]->type_, ParsedExprType::kConstant);
+
+        result->Reset();
+    }
+
+    {
+        String input_sql = "EXECUTE q1;";
+        parser->Parse(input_sql, result.get());
+
+        EXPECT_TRUE(result->error_message_.empty());
+        auto *execute_statement = (ExecuteStatement *)(*result->statements_ptr_)[0];
+        EXPECT_EQ(execute_statement->name_, "q1");
+        EXPECT_TRUE(execute_statement->parameters_ == nullptr);
+
+        result->Reset();
+    }
+
+    {
+        String input_sql = "PREPARE q2 AS DELETE FROM t1;";
+        parser->Parse(input_sql, result.get());
+
+        EXPECT_FALSE(result->error_message_.empty());
+        result->Reset();
+    }
+}
@@ -0,0 +1,181 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <filesystem>
+#include <fstream>
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import infinity_context;
+import session;
+import session_manager;
+import query_context;
+import query_result;
+import data_table;
+import data_block;
+import value;
+import internal_types;
+import logical_type;
+import prepared_plan;
+import third_party;
+
+using namespace infinity;
+
+class PreparedPlanTest : public BaseTestParamStr {
+protected:
+    void SetUp() override {
+        BaseTestParamStr::SetUp();
+        session_ = InfinityContext::instance().session_manager()->CreateRemoteSession();
+    }
+
+    void TearDown() override {
+        InfinityContext::instance().session_manager()->RemoveSessionByID(session_->session_id());
+        session_.reset();
+        BaseTestParamStr::TearDown();
+    }
+
+    QueryResult Query(const String &query_text) {
+        UniquePtr<QueryContext> query_context = MakeUnique<QueryContext>(session_.get());
+        query_context->Init(InfinityContext::instance().config(),
+                            InfinityContext::instance().task_scheduler(),
+                            InfinityContext::instance().storage(),
+                            InfinityContext::instance().resource_manager(),
+                            InfinityContext::instance().session_manager(),
+                            InfinityContext::instance().persistence_manager());
+        return query_context->Query(query_text);
+    }
+
+    // Row count and sum of the first column
+    Pair<SizeT, i64> QuerySum(const String &query_text) {
+        QueryResult result = Query(query_text);
+        EXPECT_TRUE(result.IsOk()) << result.ErrorMsg();
+        SizeT row_count = 0;
+        i64 sum = 0;
+        for (SizeT block_id = 0; block_id < result.result_table_->DataBlockCount(); ++block_id) {
+            auto data_block = result.result_table_->GetDataBlockById(block_id);
+            for (SizeT row = 0; row < data_block->row_count(); ++row) {
+                Value value = data_block->GetValue(0, row);
+                sum += value.type().type() == LogicalType::kBigInt ? value.GetValue<BigIntT>() : value.GetValue<IntegerT>();
+                ++row_count;
+            }
+        }
+        return {row_count, sum};
+    }
+
+    SharedPtr<RemoteSession> session_{};
+};
+
+INSTANTIATE_TEST_SUITE_P(TestWithDifferentParams,
+                         PreparedPlanTest,
+                         ::testing::Values(BaseTestParamStr::NULL_CONFIG_PATH, BaseTestParamStr::VFS_OFF_CONFIG_PATH));
+
+TEST_P(PreparedPlanTest, execute_with_different_values) {
+    EXPECT_TRUE(Query("CREATE TABLE t1 (c1 INTEGER, c2 INTEGER);").IsOk());
+    EXPECT_TRUE(Query("INSERT INTO t1 VALUES (0, 0), (1, 10), (2, 20), (3, 30), (4, 40), (5, 50), (6, 60), (7, 70), (8, 80), (9, 90);").IsOk());
+    EXPECT_TRUE(Query("CREATE INDEX idx1 ON t1 (c1);").IsOk());
+
+    // index scan
+    {
+        EXPECT_TRUE(Query("PREPARE q_eq AS SELECT c2 FROM t1 WHERE c1 = ?;").IsOk());
+        SharedPtr<PreparedPlan> prepared_plan = session_->GetPreparedPlan("q_eq");
+        ASSERT_NE(prepared_plan, nullptr);
+
+        EXPECT_EQ(QuerySum("EXECUTE q_eq (3);"), (Pair<SizeT, i64>(1, 30)));
+        EXPECT_EQ(prepared_plan->miss_count(), 1u);
+        EXPECT_EQ(prepared_plan->hit_count(), 0u);
+
+        // values are substituted into the cached plan
+        EXPECT_EQ(QuerySum("EXECUTE q_eq (7);"), (Pair<SizeT, i64>(1, 70)));
+        EXPECT_EQ(QuerySum("EXECUTE q_eq (11);"), (Pair<SizeT, i64>(0, 0)));
+        EXPECT_EQ(QuerySum("EXECUTE q_eq (3);"), (Pair<SizeT, i64>(1, 30)));
+        EXPECT_EQ(prepared_plan->miss_count(), 1u);
+        EXPECT_EQ(prepared_plan->hit_count(), 3u);
+
+        // an argument of another type binds the plan again
+        EXPECT_EQ(QuerySum("EXECUTE q_eq (5.0);"), (Pair<SizeT, i64>(1, 50)));
+        EXPECT_EQ(prepared_plan->miss_count(), 2u);
+        EXPECT_EQ(QuerySum("EXECUTE q_eq (6.0);"), (Pair<SizeT, i64>(1, 60)));
+        EXPECT_EQ(prepared_plan->hit_count(), 4u);
+    }
+
+    // table scan with filter and projection
+    {
+        EXPECT_TRUE(Query("PREPARE q_range AS SELECT c2 + ? FROM t1 WHERE c2 > ? AND c2 < ?;").IsOk());
+        SharedPtr<PreparedPlan> prepared_plan = session_->GetPreparedPlan("q_range");
+        ASSERT_NE(prepared_plan, nullptr);
+
+        EXPECT_EQ(QuerySum("EXECUTE q_range (0, 10, 60);"), (Pair<SizeT, i64>(4, 140)));
+        EXPECT_EQ(QuerySum("EXECUTE q_range (1, 40, 100);"), (Pair<SizeT, i64>(5, 355)));
+        EXPECT_EQ(QuerySum("EXECUTE q_range (0, 100, 200);"), (Pair<SizeT, i64>(0, 0)));
+        EXPECT_EQ(prepared_plan->miss_count(), 1u);
+        EXPECT_EQ(prepared_plan->hit_count(), 2u);
+    }
+
+    // the cached plan is dropped once the indexes change
+    {
+        SharedPtr<PreparedPlan> prepared_plan = session_->GetPreparedPlan("q_eq");
+        EXPECT_TRUE(Query("DROP INDEX idx1 ON t1;").IsOk());
+        EXPECT_EQ(QuerySum("EXECUTE q_eq (4.0);"), (Pair<SizeT, i64>(1, 40)));
+        EXPECT_EQ(prepared_plan->miss_count(), 3u);
+        EXPECT_EQ(QuerySum("EXECUTE q_eq (8.0);"), (Pair<SizeT, i64>(1, 80)));
+        EXPECT_EQ(prepared_plan->hit_count(), 5u);
+    }
+
+    EXPECT_TRUE(Query("DROP TABLE t1;").IsOk());
+}
+
+TEST_P(PreparedPlanTest, fast_rough_filter_after_substitution) {
+    // two imported segments with disjoint c1 ranges, the fast rough filter of each is built at import
+    EXPECT_TRUE(Query("CREATE TABLE t1 (c1 INTEGER, c2 INTEGER);").IsOk());
+    std::filesystem::create_directories(GetFullTmpDir());
+    for (i32 segment = 0; segment < 2; ++segment) {
+        const String file_path = fmt::format("{}/prepared_plan_{}.csv", GetFullTmpDir(), segment);
+        {
+            std::ofstream file(file_path);
+            for (i32 i = 0; i < 10; ++i) {
+                file << segment * 100 + i << "," << i << "\n";
+            }
+        }
+        EXPECT_TRUE(Query(fmt::format("COPY t1 FROM '{}' WITH (DELIMITER ',', FORMAT CSV);", file_path)).IsOk());
+    }
+
+    // the fast rough filter of the table scan is built again from the substituted values, each segment is found
+    {
+        EXPECT_TRUE(Query("PREPARE q_point AS SELECT c2 FROM t1 WHERE c1 = ?;").IsOk());
+        SharedPtr<PreparedPlan> prepared_plan = session_->GetPreparedPlan("q_point");
+        ASSERT_NE(prepared_plan, nullptr);
+
+        EXPECT_EQ(QuerySum("EXECUTE q_point (3);"), (Pair<SizeT, i64>(1, 3)));
+        EXPECT_EQ(QuerySum("EXECUTE q_point (105);"), (Pair<SizeT, i64>(1, 5)));
+        EXPECT_EQ(QuerySum("EXECUTE q_point (50);"), (Pair<SizeT, i64>(0, 0)));
+        EXPECT_EQ(QuerySum("EXECUTE q_point (9);"), (Pair<SizeT, i64>(1, 9)));
+        EXPECT_EQ(prepared_plan->miss_count(), 1u);
+        EXPECT_EQ(prepared_plan->hit_count(), 3u);
+    }
+    {
+        EXPECT_TRUE(Query("PREPARE q_range AS SELECT c2 FROM t1 WHERE c1 >= ?;").IsOk());
+        SharedPtr<PreparedPlan> prepared_plan = session_->GetPreparedPlan("q_range");
+        ASSERT_NE(prepared_plan, nullptr);
+
+        EXPECT_EQ(QuerySum("EXECUTE q_range (100);"), (Pair<SizeT, i64>(10, 45)));
+        EXPECT_EQ(QuerySum("EXECUTE q_range (5);"), (Pair<SizeT, i64>(15, 80)));
+        EXPECT_EQ(QuerySum("EXECUTE q_range (200);"), (Pair<SizeT, i64>(0, 0)));
+        EXPECT_EQ(prepared_plan->miss_count(), 1u);
+        EXPECT_EQ(prepared_plan->hit_count(), 2u);
+    }
+
+    EXPECT_TRUE(Query("DROP TABLE t1;").IsOk());
+}
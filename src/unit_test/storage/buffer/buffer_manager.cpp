@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstring>
 #include <future>
 
 #include "gtest/gtest.h"
@@ -27,6 +28,8 @@ import third_party;
 import buffer_handle;
 import infinity_context;
 import local_file_system;
+import file_system_type;
+import status;
 import logger;
 import config;
 import infinity_exception;
@@ -255,6 +258,94 @@ TEST_F(BufferManagerTest, varfile_test) {
     }
 }
 
+TEST_F(BufferManagerTest, varfile_persist_test) {
+    // file header: magic number, encoding, raw size, stored size
+    constexpr SizeT header_size = 4 * sizeof(u64);
+    SizeT buffer_size = 1 << 20;
+
+    // a small buffer is kept raw, a large repetitive one is compressed
+    for (SizeT data_size : {SizeT(25), SizeT(64 << 10)}) {
+        auto data = MakeUnique<char[]>(data_size);
+        for (SizeT i = 0; i < data_size; ++i) {
+            data[i] = 'a' + i % 26;
+        }
+        auto file_name = MakeShared<String>(fmt::format("file_{}", data_size));
+        {
+            BufferManager buffer_mgr(buffer_size, data_dir_, temp_dir_);
+            auto file_worker = MakeUnique<VarFileWorker>(data_dir_, temp_dir_, MakeShared<String>(""), file_name, 0);
+            auto *buffer_obj = buffer_mgr.AllocateBufferObject(std::move(file_worker));
+            {
+                auto handle = buffer_obj->Load();
+                auto *buffer = reinterpret_cast<VarBuffer *>(handle.GetDataMut());
+                buffer->Append(data.get(), data_size);
+            }
+            buffer_obj->Save();
+        }
+        const SizeT file_size = LocalFileSystem::GetFileSizeByPath(fmt::format("{}/{}", *data_dir_, *file_name));
+        if (data_size < 4096) {
+            EXPECT_EQ(file_size, header_size + data_size);
+        } else {
+            EXPECT_LT(file_size, data_size / 2);
+        }
+        {
+            BufferManager buffer_mgr(buffer_size, data_dir_, temp_dir_);
+            auto file_worker = MakeUnique<VarFileWorker>(data_dir_, temp_dir_, MakeShared<String>(""), file_name, data_size);
+            auto *buffer_obj = buffer_mgr.GetBufferObject(std::move(file_worker));
+            auto handle = buffer_obj->Load();
+            const auto *buffer = reinterpret_cast<const VarBuffer *>(handle.GetData());
+            EXPECT_EQ(buffer->TotalSize(), data_size);
+            EXPECT_EQ(std::string_view(buffer->Get(0, data_size), data_size), std::string_view(data.get(), data_size));
+        }
+    }
+}
+
+TEST_F(BufferManagerTest, varfile_legacy_test) {
+    SizeT buffer_size = 1 << 20;
+
+    // var files written before the header was introduced are raw buffers without header and footer
+    for (SizeT data_size : {SizeT(25), SizeT(64 << 10)}) {
+        auto data = MakeUnique<char[]>(data_size);
+        for (SizeT i = 0; i < data_size; ++i) {
+            data[i] = 'a' + i % 26;
+        }
+        // a legacy payload may begin with the bytes of the header magic number, the catalog tells the format
+        const u64 magic = 0x00dd4c5a34564152;
+        std::memcpy(data.get(), &magic, sizeof(magic));
+        auto file_name = MakeShared<String>(fmt::format("legacy_{}", data_size));
+        {
+            LocalFileSystem fs;
+            auto [file_handler, status] =
+                fs.OpenFile(fmt::format("{}/{}", *data_dir_, *file_name), FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG, FileLockType::kWriteLock);
+            ASSERT_TRUE(status.ok());
+            EXPECT_EQ(fs.Write(*file_handler, data.get(), data_size), (i64)data_size);
+            fs.Close(*file_handler);
+        }
+        {
+            BufferManager buffer_mgr(buffer_size, data_dir_, temp_dir_);
+            auto file_worker = MakeUnique<VarFileWorker>(data_dir_, temp_dir_, MakeShared<String>(""), file_name, data_size, false /*with_header*/);
+            auto *buffer_obj = buffer_mgr.GetBufferObject(std::move(file_worker));
+            auto handle = buffer_obj->Load();
+            const auto *buffer = reinterpret_cast<const VarBuffer *>(handle.GetData());
+            EXPECT_EQ(buffer->TotalSize(), data_size);
+            EXPECT_EQ(std::string_view(buffer->Get(0, data_size), data_size), std::string_view(data.get(), data_size));
+        }
+        // a legacy file keeps its format when it is written again
+        auto rewrite_name = MakeShared<String>(fmt::format("legacy_rewrite_{}", data_size));
+        {
+            BufferManager buffer_mgr(buffer_size, data_dir_, temp_dir_);
+            auto file_worker = MakeUnique<VarFileWorker>(data_dir_, temp_dir_, MakeShared<String>(""), rewrite_name, 0, false /*with_header*/);
+            auto *buffer_obj = buffer_mgr.AllocateBufferObject(std::move(file_worker));
+            {
+                auto handle = buffer_obj->Load();
+                auto *buffer = reinterpret_cast<VarBuffer *>(handle.GetDataMut());
+                buffer->Append(data.get(), data_size);
+            }
+            buffer_obj->Save();
+        }
+        EXPECT_EQ(LocalFileSystem::GetFileSizeByPath(fmt::format("{}/{}", *data_dir_, *rewrite_name)), data_size);
+    }
+}
+
 struct FileInfo {
     FileInfo(int file_id) : file_id_(file_id) {}
 
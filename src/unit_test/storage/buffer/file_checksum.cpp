@@ -0,0 +1,124 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+import stl;
+import crc;
+import file_worker;
+import data_file_worker;
+import local_file_system;
+import file_system_type;
+import status;
+import third_party;
+
+using namespace infinity;
+
+class FileChecksumTest : public BaseTest {
+protected:
+    void SetUp() override {
+        data_dir_ = MakeShared<String>(String(tmp_data_path()) + "/checksum/data");
+        temp_dir_ = MakeShared<String>(String(tmp_data_path()) + "/checksum/temp");
+        fs_.DeleteDirectory(*data_dir_);
+        fs_.DeleteDirectory(*temp_dir_);
+        fs_.CreateDirectory(*data_dir_);
+        fs_.CreateDirectory(*temp_dir_);
+    }
+
+    void TearDown() override {
+        fs_.DeleteDirectory(*data_dir_);
+        fs_.DeleteDirectory(*temp_dir_);
+    }
+
+    // Write a data file of `size` bytes and return its path
+    String WriteDataFile(SizeT size) {
+        DataFileWorker file_worker(data_dir_, temp_dir_, MakeShared<String>(""), MakeShared<String>("file"), size);
+        file_worker.AllocateInMemory();
+        auto *data = static_cast<char *>(file_worker.GetData());
+        for (SizeT i = 0; i < size; ++i) {
+            data[i] = static_cast<char>(i * 7);
+        }
+        EXPECT_TRUE(file_worker.WriteToFile(false));
+        file_worker.FreeInMemory();
+        return file_worker.GetFilePath();
+    }
+
+    void OverwriteByte(const String &path, SizeT offset, char value) {
+        auto [file_handler, status] = fs_.OpenFile(path, FileFlags::WRITE_FLAG, FileLockType::kNoLock);
+        ASSERT_TRUE(status.ok());
+        fs_.WriteAt(*file_handler, offset, &value, 1);
+        fs_.Close(*file_handler);
+    }
+
+    LocalFileSystem fs_;
+    SharedPtr<String> data_dir_;
+    SharedPtr<String> temp_dir_;
+};
+
+TEST_F(FileChecksumTest, CRC32C) {
+    EXPECT_EQ(CRC32C::Value("123456789", 9), 0xE3069283u);
+    EXPECT_EQ(CRC32C::Value("", 0), 0u);
+
+    String data(10000, '\0');
+    for (SizeT i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<char>(i * 31 + i / 7);
+    }
+    u32 crc = 0;
+    for (SizeT pos = 0; pos < data.size();) {
+        SizeT len = std::min<SizeT>(pos % 13 + 1, data.size() - pos);
+        crc = CRC32C::Extend(crc, data.data() + pos, len);
+        pos += len;
+    }
+    EXPECT_EQ(crc, CRC32C::Value(data.data(), data.size()));
+}
+
+TEST_F(FileChecksumTest, Footer) {
+    const SizeT size = 4096;
+    String path = WriteDataFile(size);
+    EXPECT_TRUE(FileWorker::VerifyFile(path).ok());
+
+    // The body is read back without the footer
+    {
+        DataFileWorker file_worker(data_dir_, temp_dir_, MakeShared<String>(""), MakeShared<String>("file"), size);
+        file_worker.ReadFromFile(false);
+        const auto *data = static_cast<const char *>(file_worker.GetData());
+        for (SizeT i = 0; i < size; ++i) {
+            ASSERT_EQ(data[i], static_cast<char>(i * 7));
+        }
+        file_worker.FreeInMemory();
+    }
+
+    SizeT read_bytes = 0;
+    EXPECT_TRUE(FileWorker::VerifyFile(path, [&](SizeT n) { read_bytes += n; }).ok());
+    EXPECT_EQ(read_bytes + 16, fs_.GetFileSizeByPath(path));
+
+    OverwriteByte(path, 100, 'x');
+    EXPECT_EQ(FileWorker::VerifyFile(path).code(), ErrorCode::kDataCorrupted);
+
+    EXPECT_EQ(FileWorker::VerifyFile(path + ".missing").code(), ErrorCode::kFileNotFound);
+}
+
+TEST_F(FileChecksumTest, NoFooter) {
+    // Files written before the footer have nothing to verify
+    const SizeT size = 1024;
+    String path = WriteDataFile(size);
+    fs_.Truncate(path, fs_.GetFileSizeByPath(path) - 16);
+    EXPECT_TRUE(FileWorker::VerifyFile(path).ok());
+
+    DataFileWorker file_worker(data_dir_, temp_dir_, MakeShared<String>(""), MakeShared<String>("file"), size);
+    file_worker.ReadFromFile(false);
+    const auto *data = static_cast<const char *>(file_worker.GetData());
+    EXPECT_EQ(data[size - 1], static_cast<char>((size - 1) * 7));
+    file_worker.FreeInMemory();
+}
@@ -0,0 +1,120 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+import stl;
+import third_party;
+
+import column_encoding;
+
+using namespace infinity;
+
+class ColumnEncodingTest : public BaseTest {
+protected:
+    template <typename T>
+    ColumnEncodingType RoundTrip(const Vector<T> &values) {
+        const SizeT size = values.size() * sizeof(T);
+        String encoded;
+        ColumnEncodingType type = ColumnEncoding::Encode(reinterpret_cast<const char *>(values.data()), size, sizeof(T), encoded);
+        if (type == ColumnEncodingType::kRaw) {
+            EXPECT_TRUE(encoded.empty());
+            return type;
+        }
+        EXPECT_LT(encoded.size(), size);
+        Vector<T> decoded(values.size());
+        EXPECT_TRUE(ColumnEncoding::Decode(type, encoded.data(), encoded.size(), sizeof(T), reinterpret_cast<char *>(decoded.data()), size));
+        EXPECT_EQ(std::memcmp(decoded.data(), values.data(), size), 0);
+        return type;
+    }
+};
+
+TEST_F(ColumnEncodingTest, RLE) {
+    Vector<i64> values(8192);
+    for (SizeT i = 0; i < values.size(); ++i) {
+        values[i] = i / 1000;
+    }
+    EXPECT_EQ(RoundTrip(values), ColumnEncodingType::kRLE);
+
+    Vector<i32> zeros(8192, 0);
+    EXPECT_EQ(RoundTrip(zeros), ColumnEncodingType::kRLE);
+}
+
+TEST_F(ColumnEncodingTest, Dictionary) {
+    // Low cardinality values wider than 8 bytes, such as inline varchars
+    struct Value {
+        char data[16];
+    };
+    std::mt19937 rng(0);
+    Vector<Value> values(8192);
+    for (auto &value : values) {
+        std::memset(value.data, 0, sizeof(value.data));
+        auto city = fmt::format("city{}", rng() % 50);
+        std::memcpy(value.data, city.data(), city.size());
+    }
+    EXPECT_EQ(RoundTrip(values), ColumnEncodingType::kDictionary);
+
+    Vector<i64> extremes(8192);
+    for (auto &value : extremes) {
+        value = rng() % 2 ? std::numeric_limits<i64>::min() : std::numeric_limits<i64>::max();
+    }
+    EXPECT_EQ(RoundTrip(extremes), ColumnEncodingType::kDictionary);
+}
+
+TEST_F(ColumnEncodingTest, FrameOfReference) {
+    std::mt19937 rng(0);
+    Vector<i32> values(8192);
+    for (auto &value : values) {
+        value = static_cast<i32>(rng() % 1000) - 500;
+    }
+    EXPECT_EQ(RoundTrip(values), ColumnEncodingType::kFrameOfReference);
+
+    Vector<i64> timestamps(8191);
+    for (SizeT i = 0; i < timestamps.size(); ++i) {
+        timestamps[i] = 1700000000000 + i * 37 + rng() % 5;
+    }
+    EXPECT_EQ(RoundTrip(timestamps), ColumnEncodingType::kFrameOfReference);
+
+    Vector<u64> unsigned_values(5000);
+    for (auto &value : unsigned_values) {
+        value = (u64(1) << 63) + rng() % 100000;
+    }
+    EXPECT_EQ(RoundTrip(unsigned_values), ColumnEncodingType::kFrameOfReference);
+}
+
+TEST_F(ColumnEncodingTest, Raw) {
+    std::mt19937 rng(0);
+    Vector<u64> values(8192);
+    for (auto &value : values) {
+        value = (u64(rng()) << 32) | rng();
+    }
+    EXPECT_EQ(RoundTrip(values), ColumnEncodingType::kRaw);
+
+    String encoded;
+    EXPECT_EQ(ColumnEncoding::Encode(reinterpret_cast<const char *>(values.data()), 7, 2, encoded), ColumnEncodingType::kRaw);
+}
+
+TEST_F(ColumnEncodingTest, Corrupted) {
+    Vector<i32> values(8192);
+    for (SizeT i = 0; i < values.size(); ++i) {
+        values[i] = i % 100;
+    }
+    const SizeT size = values.size() * sizeof(i32);
+    String encoded;
+    ColumnEncodingType type = ColumnEncoding::Encode(reinterpret_cast<const char *>(values.data()), size, sizeof(i32), encoded);
+    ASSERT_NE(type, ColumnEncodingType::kRaw);
+    encoded.pop_back();
+    Vector<i32> decoded(values.size());
+    EXPECT_FALSE(ColumnEncoding::Decode(type, encoded.data(), encoded.size(), sizeof(i32), reinterpret_cast<char *>(decoded.data()), size));
+}
@@ -0,0 +1,131 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import third_party;
+import column_def;
+import data_type;
+import logical_type;
+import column_vector;
+import value;
+import internal_types;
+import clustering_key;
+
+using namespace infinity;
+
+class ClusteringKeyTest : public BaseTest {
+protected:
+    static Vector<String> NormalizedKeys(const ColumnVector &column_vector, SizeT row_count) {
+        Vector<String> keys(row_count);
+        for (SizeT row = 0; row < row_count; ++row) {
+            ClusteringKey::AppendNormalizedKey(column_vector, row, keys[row]);
+        }
+        return keys;
+    }
+
+    // Row order given by the normalized keys of a single column
+    static Vector<u32> SortColumn(const ColumnVector &column_vector, SizeT row_count) {
+        ClusteringKey clustering_key;
+        return clustering_key.SortRows({NormalizedKeys(column_vector, row_count)});
+    }
+};
+
+TEST_F(ClusteringKeyTest, Make) {
+    Vector<SharedPtr<ColumnDef>> columns;
+    for (i64 i = 0; i < 3; ++i) {
+        columns.push_back(MakeShared<ColumnDef>(i, MakeShared<DataType>(LogicalType::kInteger), fmt::format("c{}", i), std::set<ConstraintType>()));
+    }
+    EXPECT_TRUE(ClusteringKey::Make(columns).Empty());
+
+    columns[2]->clustering_key_idx_ = 0;
+    columns[0]->clustering_key_idx_ = 1;
+    ClusteringKey clustering_key = ClusteringKey::Make(columns);
+    EXPECT_EQ(clustering_key.column_ids(), Vector<ColumnID>({2, 0}));
+    EXPECT_FALSE(clustering_key.z_order());
+
+    EXPECT_TRUE(ClusteringKey::SupportType(DataType(LogicalType::kVarchar)));
+    EXPECT_FALSE(ClusteringKey::SupportType(DataType(LogicalType::kEmbedding)));
+}
+
+TEST_F(ClusteringKeyTest, NormalizedKeyOrder) {
+    {
+        Vector<BigIntT> values = {5, -3, 0, std::numeric_limits<BigIntT>::min(), 42, -1, std::numeric_limits<BigIntT>::max()};
+        ColumnVector column_vector(MakeShared<DataType>(LogicalType::kBigInt));
+        column_vector.Initialize();
+        for (BigIntT value : values) {
+            column_vector.AppendValue(Value::MakeBigInt(value));
+        }
+        Vector<u32> order = SortColumn(column_vector, values.size());
+        for (SizeT i = 1; i < order.size(); ++i) {
+            EXPECT_LE(values[order[i - 1]], values[order[i]]);
+        }
+    }
+    {
+        Vector<DoubleT> values = {1.5, -2.25, 0.0, -0.0, 1e300, -1e-300, 3.0};
+        ColumnVector column_vector(MakeShared<DataType>(LogicalType::kDouble));
+        column_vector.Initialize();
+        for (DoubleT value : values) {
+            column_vector.AppendValue(Value::MakeDouble(value));
+        }
+        Vector<String> keys = NormalizedKeys(column_vector, values.size());
+        EXPECT_EQ(keys[2], keys[3]);
+        Vector<u32> order = SortColumn(column_vector, values.size());
+        for (SizeT i = 1; i < order.size(); ++i) {
+            EXPECT_LE(values[order[i - 1]], values[order[i]]);
+        }
+    }
+    {
+        Vector<String> values = {"b", "abc", "", "ab", "a very long string which is not inlined", "a"};
+        ColumnVector column_vector(MakeShared<DataType>(LogicalType::kVarchar));
+        column_vector.Initialize();
+        for (const String &value : values) {
+            column_vector.AppendValue(Value::MakeVarchar(value));
+        }
+        Vector<u32> order = SortColumn(column_vector, values.size());
+        for (SizeT i = 1; i < order.size(); ++i) {
+            EXPECT_LE(values[order[i - 1]], values[order[i]]);
+        }
+    }
+}
+
+TEST_F(ClusteringKeyTest, ZOrder) {
+    // A 4 x 4 grid: the Z-order visits each 2 x 2 quadrant before the next one
+    const SizeT side = 4;
+    Vector<Vector<String>> column_keys(2);
+    for (SizeT x = 0; x < side; ++x) {
+        for (SizeT y = 0; y < side; ++y) {
+            column_keys[0].push_back(String(1, static_cast<char>('a' + x)));
+            column_keys[1].push_back(String(1, static_cast<char>('a' + y)));
+        }
+    }
+    Vector<SharedPtr<ColumnDef>> columns;
+    for (i64 i = 0; i < 2; ++i) {
+        auto column_def = MakeShared<ColumnDef>(i, MakeShared<DataType>(LogicalType::kInteger), fmt::format("c{}", i), std::set<ConstraintType>());
+        column_def->clustering_key_idx_ = i;
+        column_def->clustering_z_order_ = true;
+        columns.push_back(std::move(column_def));
+    }
+    ClusteringKey clustering_key = ClusteringKey::Make(columns);
+    EXPECT_TRUE(clustering_key.z_order());
+    Vector<u32> order = clustering_key.SortRows(column_keys);
+    ASSERT_EQ(order.size(), side * side);
+    for (SizeT i = 0; i < order.size(); ++i) {
+        const SizeT x = order[i] / side;
+        const SizeT y = order[i] % side;
+        EXPECT_EQ(i / 4, (x / 2) * 2 + y / 2);
+    }
+}
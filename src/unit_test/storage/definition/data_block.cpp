@@ -35,6 +35,7 @@ import embedding_info;
 import array_info;
 import knn_expr;
 import data_type;
+import selection;
 
 using namespace infinity;
 
@@ -300,3 +301,62 @@ TEST_P(DataBlockTest, ReadWrite) {
     EXPECT_NE(data_block2, nullptr);
     EXPECT_EQ(data_block == *data_block2, true);
 }
+
+TEST_P(DataBlockTest, selection) {
+    using namespace infinity;
+
+    SizeT row_count = 100;
+    DataBlock input_block;
+    Vector<SharedPtr<DataType>> column_types{MakeShared<DataType>(LogicalType::kBigInt), MakeShared<DataType>(LogicalType::kVarchar)};
+    input_block.Init(column_types);
+    for (SizeT i = 0; i < row_count; ++i) {
+        input_block.AppendValue(0, Value::MakeBigInt(i));
+        input_block.AppendValue(1, Value::MakeVarchar(fmt::format("row_{}", i)));
+    }
+    input_block.Finalize();
+
+    // Even rows, then a run of consecutive rows
+    Vector<SizeT> selected_rows;
+    auto selection = MakeShared<Selection>();
+    selection->Initialize(row_count);
+    for (SizeT i = 0; i < 50; i += 2) {
+        selected_rows.push_back(i);
+    }
+    for (SizeT i = 51; i < 60; ++i) {
+        selected_rows.push_back(i);
+    }
+    for (SizeT row : selected_rows) {
+        selection->Append(row);
+    }
+
+    DataBlock selected_block;
+    selected_block.InitWithSelection(&input_block, selection);
+    EXPECT_TRUE(selected_block.HasSelection());
+    EXPECT_EQ(selected_block.row_count(), selected_rows.size());
+    for (SizeT i = 0; i < selected_rows.size(); ++i) {
+        EXPECT_EQ(selected_block.GetValue(0, i), Value::MakeBigInt(selected_rows[i]));
+    }
+
+    DataBlock appended_block;
+    appended_block.Init(column_types);
+    appended_block.AppendWith(&selected_block, 20, 10);
+    appended_block.Finalize();
+    ASSERT_EQ(appended_block.row_count(), 10u);
+    for (SizeT i = 0; i < 10; ++i) {
+        EXPECT_EQ(appended_block.GetValue(0, i), Value::MakeBigInt(selected_rows[20 + i]));
+        EXPECT_EQ(appended_block.GetValue(1, i), Value::MakeVarchar(fmt::format("row_{}", selected_rows[20 + i])));
+    }
+
+    UniquePtr<DataBlock> compacted_columns = selected_block.CompactColumns({1});
+    EXPECT_FALSE(compacted_columns->HasSelection());
+    EXPECT_EQ(compacted_columns->row_count(), selected_rows.size());
+    EXPECT_EQ(compacted_columns->column_vectors[1]->Size(), selected_rows.size());
+    EXPECT_EQ(compacted_columns->GetValue(1, 3), Value::MakeVarchar(fmt::format("row_{}", selected_rows[3])));
+
+    selected_block.Compact();
+    EXPECT_FALSE(selected_block.HasSelection());
+    EXPECT_EQ(selected_block.row_count(), selected_rows.size());
+    for (SizeT i = 0; i < selected_rows.size(); ++i) {
+        EXPECT_EQ(selected_block.GetValue(0, i), Value::MakeBigInt(selected_rows[i]));
+    }
+}
@@ -97,3 +97,44 @@ TEST_F(TableDefTest, ReadWrite) {
     EXPECT_NE(table_def2, nullptr);
     EXPECT_EQ(*table_def2, table_def);
 }
+
+TEST_F(TableDefTest, ReadWriteClusteringKey) {
+    using namespace infinity;
+
+    Vector<SharedPtr<ColumnDef>> columns;
+    {
+        auto column_def_ptr = MakeShared<ColumnDef>(0, MakeShared<DataType>(LogicalType::kInteger), "c1", std::set<ConstraintType>());
+        column_def_ptr->build_bloom_filter_ = true;
+        column_def_ptr->clustering_key_idx_ = 1;
+        column_def_ptr->clustering_z_order_ = true;
+        columns.emplace_back(column_def_ptr);
+    }
+    {
+        auto column_def_ptr = MakeShared<ColumnDef>(1, MakeShared<DataType>(LogicalType::kBigInt), "c2", std::set<ConstraintType>());
+        column_def_ptr->build_bloom_filter_ = true;
+        columns.emplace_back(column_def_ptr);
+    }
+    // Columns out of the clustering key keep the layout written before it was added: the bloom filter byte is the last field.
+    EXPECT_EQ(columns[0]->GetSizeInBytes(), columns[1]->GetSizeInBytes() + i32(sizeof(i32) + sizeof(u8)));
+
+    TableDef table_def(MakeShared<String>("default_db"), MakeShared<String>("t1"), columns);
+    int32_t exp_size = table_def.GetSizeInBytes();
+    Vector<char> buf(exp_size, char(0));
+    char *ptr = buf.data();
+    table_def.WriteAdv(ptr);
+    EXPECT_EQ(ptr - buf.data(), exp_size);
+
+    const char *ptr_r = buf.data();
+    SharedPtr<TableDef> table_def2 = table_def.ReadAdv(ptr_r, exp_size);
+    EXPECT_EQ(ptr_r - buf.data(), exp_size);
+    ASSERT_NE(table_def2, nullptr);
+    EXPECT_EQ(*table_def2, table_def);
+    const auto &column1 = table_def2->columns()[0];
+    EXPECT_TRUE(column1->build_bloom_filter_);
+    EXPECT_EQ(column1->clustering_key_idx_, 1);
+    EXPECT_TRUE(column1->clustering_z_order_);
+    const auto &column2 = table_def2->columns()[1];
+    EXPECT_TRUE(column2->build_bloom_filter_);
+    EXPECT_EQ(column2->clustering_key_idx_, -1);
+    EXPECT_FALSE(column2->clustering_z_order_);
+}
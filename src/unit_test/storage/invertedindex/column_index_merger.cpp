@@ -60,7 +60,8 @@ protected:
                             const Vector<String>& base_names,
                             const Vector<RowID>& base_row_ids,
                             const String &dst_base_name,
-                            const Vector<ExpectedPosting> &expected_postings);
+                            const Vector<ExpectedPosting> &expected_postings,
+                            const Vector<Vector<docid_t>> *doc_id_maps = nullptr);
 
     void GenerateParagraphs(u32 term_num, u32 row_num, u32 word_num, Vector<String>& paragraphs, Vector<ExpectedPosting>& expected_postings);
     void GenerateTerms(Vector<String>& terms, u32 term_num);
@@ -117,9 +118,10 @@ void ColumnIndexMergerTest::MergeAndCheckIndex(const String& index_dir,
                                                const Vector<String>& base_names,
                                                const Vector<RowID>& base_row_ids,
                                                const String &dst_base_name,
-                                               const Vector<ExpectedPosting> &expected_postings) {
+                                               const Vector<ExpectedPosting> &expected_postings,
+                                               const Vector<Vector<docid_t>> *doc_id_maps) {
     auto column_index_merger = MakeShared<ColumnIndexMerger>(index_dir, flag_);
-    column_index_merger->Merge(base_names, base_row_ids, dst_base_name);
+    column_index_merger->Merge(base_names, base_row_ids, dst_base_name, doc_id_maps);
 
     auto fake_segment_index_entry_1 = SegmentIndexEntry::CreateFakeEntry(index_dir);
     fake_segment_index_entry_1->AddFtChunkIndexEntry(dst_base_name, RowID(0U, 0U), 0U);
@@ -374,6 +376,30 @@ TEST_P(ColumnIndexMergerTest, BasicParagraphTest5) {
     MergeAndCheckIndex(index_dir, base_names, base_row_ids, dst_base_name, expected_postings);
 }
 
+TEST_P(ColumnIndexMergerTest, DocIdMapTest) {
+    using namespace infinity;
+    // Chunks of two compacted segments, the first row of the first segment is dropped
+    const char *paragraphs[] = {
+        R"#(B A)#",
+        R"#(A B A)#",
+        R"#(C)#",
+        R"#(A C)#",
+    };
+    const SizeT num_paragraph = sizeof(paragraphs) / sizeof(char *);
+    const String index_dir = GetFullDataDir();
+    const String dst_base_name = "merged_index";
+
+    Vector<String> base_names = {"chunk1", "chunk2"};
+    Vector<RowID> base_row_ids = {RowID{1U, 0U}, RowID{2U, 0U}};
+    Vector<u32> row_offsets = {0, 2};
+    Vector<u32> row_counts = {2, 2};
+    CreateIndex(paragraphs, num_paragraph, index_dir, base_names, base_row_ids, row_offsets, row_counts);
+
+    Vector<RowID> merge_base_row_ids = {RowID{0U, 0U}, RowID{0U, 1U}};
+    Vector<Vector<docid_t>> doc_id_maps = {{INVALID_DOCID, 0}, {1, 2}};
+    Vector<ExpectedPosting> expected_postings = {{"a", {0, 2}, {2, 1}}, {"b", {0}, {1}}, {"c", {1, 2}, {1, 1}}};
+    MergeAndCheckIndex(index_dir, base_names, merge_base_row_ids, dst_base_name, expected_postings, &doc_id_maps);
+}
 
 TEST_P(ColumnIndexMergerTest, GeneratePargraphsMergeTest) {
     using namespace infinity;
@@ -51,13 +51,13 @@ public:
     };
 
 public:
-    SharedPtr<PostingWriter> GetOrAddPosting(const String &term) {
-        auto it = postings_.find(term);
+    SharedPtr<PostingWriter> GetOrAddPosting(std::string_view term) {
+        auto it = postings_.find(String(term));
         if (it != postings_.end()) {
             return it->second;
         }
         SharedPtr<PostingWriter> posting = MakeShared<PostingWriter>(posting_format_, column_lengths_);
-        postings_[term] = posting;
+        postings_[String(term)] = posting;
         return posting;
     }
 };
@@ -80,7 +80,7 @@ TEST_F(ColumnInverterTest, Invert) {
     }
     Vector<ExpectedPosting> expected_postings = {{"fst", {0, 1, 2}, {4, 2, 2}}, {"automaton", {0, 3}, {2, 5}}, {"transducer", {0, 4}, {1, 4}}};
 
-    PostingWriterProvider provider = [this](const String &term) -> SharedPtr<PostingWriter> { return GetOrAddPosting(term); };
+    PostingWriterProvider provider = [this](std::string_view term) -> SharedPtr<PostingWriter> { return GetOrAddPosting(term); };
     ColumnInverter inverter1(provider, column_lengths_);
     inverter1.InitAnalyzer("standard");
     ColumnInverter inverter2(provider, column_lengths_);
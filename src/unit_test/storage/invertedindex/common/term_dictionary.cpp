@@ -0,0 +1,86 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+import stl;
+import third_party;
+
+import term_dictionary;
+
+using namespace infinity;
+
+class TermDictionaryTest : public BaseTest {};
+
+TEST_F(TermDictionaryTest, GetOrAdd) {
+    TermDictionary<u32> dict;
+    u32 value = 0;
+    EXPECT_FALSE(dict.Get("apple", value));
+    EXPECT_FALSE(dict.GetOrAdd("apple", value, []() { return 1u; }));
+    EXPECT_EQ(value, 1u);
+    EXPECT_TRUE(dict.GetOrAdd("apple", value, []() { return 2u; }));
+    EXPECT_EQ(value, 1u);
+
+    // The dictionary keeps its own copy of the term
+    {
+        String term = "banana";
+        EXPECT_FALSE(dict.GetOrAdd(term, value, []() { return 3u; }));
+        term = "cherry";
+    }
+    EXPECT_TRUE(dict.Get("banana", value));
+    EXPECT_EQ(value, 3u);
+
+    String long_term(40000, 'z');
+    EXPECT_FALSE(dict.GetOrAdd(long_term, value, []() { return 4u; }));
+    EXPECT_EQ(dict.Size(), 3u);
+
+    dict.Clear();
+    EXPECT_EQ(dict.Size(), 0u);
+    EXPECT_FALSE(dict.Get("apple", value));
+}
+
+TEST_F(TermDictionaryTest, ConcurrentSorted) {
+    constexpr u32 thread_num = 8;
+    constexpr u32 term_num = 10000;
+    TermDictionary<u32> dict;
+    Atomic<u32> added_num{0};
+
+    Vector<Thread> threads;
+    for (u32 t = 0; t < thread_num; ++t) {
+        // Every thread adds the same terms, each of them shall be added exactly once
+        threads.emplace_back([&]() {
+            for (u32 i = 0; i < term_num; ++i) {
+                String term = fmt::format("term{}", i);
+                u32 value = 0;
+                if (!dict.GetOrAdd(term, value, [i]() { return i; })) {
+                    ++added_num;
+                }
+                EXPECT_EQ(value, i);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(added_num.load(), term_num);
+
+    auto items = dict.SortedItems();
+    ASSERT_EQ(items.size(), term_num);
+    for (SizeT i = 1; i < items.size(); ++i) {
+        EXPECT_LT(items[i - 1].first, items[i].first);
+    }
+    for (const auto &[term, value] : items) {
+        EXPECT_EQ(term, fmt::format("term{}", value));
+    }
+}
@@ -0,0 +1,156 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import internal_types;
+import tensor_centroid_codes;
+
+using namespace infinity;
+
+class TensorCentroidCodesTest : public BaseTest {
+protected:
+    static constexpr u32 kDimension = 8;
+
+    // Tensors of the rows, each a list of embeddings
+    using Tensors = Vector<Vector<Vector<f32>>>;
+
+    static TensorCentroidCodes::ForEachTensor ForEach(const Tensors &tensors, Vector<Vector<f32>> &flat_tensors) {
+        flat_tensors.clear();
+        for (const auto &tensor : tensors) {
+            auto &flat = flat_tensors.emplace_back();
+            for (const auto &embedding : tensor) {
+                flat.insert(flat.end(), embedding.begin(), embedding.end());
+            }
+        }
+        return [&flat_tensors](const std::function<void(SegmentOffset, const char *, u32)> &func) {
+            for (SizeT row = 0; row < flat_tensors.size(); ++row) {
+                func(row, reinterpret_cast<const char *>(flat_tensors[row].data()), flat_tensors[row].size() / kDimension);
+            }
+        };
+    }
+
+    // Every embedding is one of two points, the rows with the first point first
+    static Tensors TwoPointTensors(u32 row_count, u32 embedding_per_row) {
+        Vector<f32> point_a(kDimension, 0);
+        Vector<f32> point_b(kDimension, 0);
+        point_a[0] = 10;
+        point_b[1] = 10;
+        Tensors tensors(row_count);
+        for (u32 row = 0; row < row_count; ++row) {
+            for (u32 i = 0; i < embedding_per_row; ++i) {
+                // rows of the first half mostly hold point_a
+                const bool use_a = (row < row_count / 2) ? (i != 0) : (i == 0 && row % 2 == 0);
+                tensors[row].push_back(use_a ? point_a : point_b);
+            }
+        }
+        return tensors;
+    }
+
+    static f32 ExactMaxSim(const Vector<f32> &query, u32 query_embedding_num, const Vector<Vector<f32>> &tensor) {
+        f32 score = 0;
+        for (u32 query_i = 0; query_i < query_embedding_num; ++query_i) {
+            f32 max_score_i = std::numeric_limits<f32>::lowest();
+            for (const auto &embedding : tensor) {
+                f32 ip = 0;
+                for (u32 k = 0; k < kDimension; ++k) {
+                    ip += query[query_i * kDimension + k] * embedding[k];
+                }
+                max_score_i = std::max(max_score_i, ip);
+            }
+            score += max_score_i;
+        }
+        return score;
+    }
+};
+
+TEST_F(TensorCentroidCodesTest, approximate_score) {
+    constexpr u32 row_count = 64;
+    const Tensors tensors = TwoPointTensors(row_count, 8);
+    Vector<Vector<f32>> flat_tensors;
+    const SizeT memory_before = TensorCentroidCodes::TotalMemoryUsage();
+    {
+        auto codes = TensorCentroidCodes::Make(kDimension, EmbeddingDataType::kElemFloat, row_count, ForEach(tensors, flat_tensors), 0);
+        ASSERT_NE(codes, nullptr);
+        EXPECT_EQ(codes->row_count(), row_count);
+        // 512 embeddings
+        EXPECT_EQ(codes->centroid_count(), 16u);
+        EXPECT_GT(codes->MemoryUsage(), 0u);
+        EXPECT_EQ(TensorCentroidCodes::TotalMemoryUsage(), memory_before + codes->MemoryUsage());
+
+        // The centroids are the two points, up to the split of empty clusters
+        Vector<f32> query(2 * kDimension, 0);
+        query[0] = 1;
+        query[kDimension + 0] = 0.5;
+        query[kDimension + 1] = 0.5;
+        for (u32 query_embedding_num : {1u, 2u}) {
+            const Vector<f32> scores =
+                codes->QueryCentroidScores(reinterpret_cast<const char *>(query.data()), EmbeddingDataType::kElemFloat, query_embedding_num);
+            EXPECT_EQ(scores.size(), query_embedding_num * codes->centroid_count());
+            for (u32 row = 0; row < row_count; ++row) {
+                const f32 expected = ExactMaxSim(query, query_embedding_num, tensors[row]);
+                EXPECT_NEAR(codes->ApproximateScore(scores.data(), query_embedding_num, row), expected, 0.01 * std::abs(expected) + 1e-3);
+            }
+        }
+    }
+    // the memory is released with the codes
+    EXPECT_EQ(TensorCentroidCodes::TotalMemoryUsage(), memory_before);
+}
+
+TEST_F(TensorCentroidCodesTest, too_few_embeddings) {
+    // 8 x 8 embeddings can't make 8 centroids of 32 embeddings
+    const Tensors tensors = TwoPointTensors(8, 8);
+    Vector<Vector<f32>> flat_tensors;
+    EXPECT_EQ(TensorCentroidCodes::Make(kDimension, EmbeddingDataType::kElemFloat, 8, ForEach(tensors, flat_tensors), 0), nullptr);
+
+    // rows without embeddings
+    Tensors empty_tensors(100);
+    EXPECT_EQ(TensorCentroidCodes::Make(kDimension, EmbeddingDataType::kElemFloat, 100, ForEach(empty_tensors, flat_tensors), 0), nullptr);
+}
+
+TEST_F(TensorCentroidCodesTest, memory_limit) {
+    constexpr u32 row_count = 64;
+    const Tensors tensors = TwoPointTensors(row_count, 8);
+    Vector<Vector<f32>> flat_tensors;
+    const auto for_each_tensor = ForEach(tensors, flat_tensors);
+    const SizeT old_memory_limit = TensorCentroidCodes::MemoryLimit();
+
+    auto codes1 = TensorCentroidCodes::Make(kDimension, EmbeddingDataType::kElemFloat, row_count, for_each_tensor, 0);
+    ASSERT_NE(codes1, nullptr);
+    // no room for a second one
+    TensorCentroidCodes::SetMemoryLimit(TensorCentroidCodes::TotalMemoryUsage() + codes1->MemoryUsage() - 1);
+    EXPECT_EQ(TensorCentroidCodes::Make(kDimension, EmbeddingDataType::kElemFloat, row_count, for_each_tensor, 0), nullptr);
+    // the room of the released codes is reused
+    codes1.reset();
+    auto codes2 = TensorCentroidCodes::Make(kDimension, EmbeddingDataType::kElemFloat, row_count, for_each_tensor, 0);
+    EXPECT_NE(codes2, nullptr);
+    EXPECT_LE(TensorCentroidCodes::TotalMemoryUsage(), TensorCentroidCodes::MemoryLimit());
+
+    TensorCentroidCodes::SetMemoryLimit(old_memory_limit);
+}
+
+TEST_F(TensorCentroidCodesTest, support_type) {
+    EXPECT_TRUE(TensorCentroidCodes::SupportType(EmbeddingDataType::kElemFloat));
+    EXPECT_TRUE(TensorCentroidCodes::SupportType(EmbeddingDataType::kElemBit));
+    EXPECT_TRUE(TensorCentroidCodes::SupportType(EmbeddingDataType::kElemBFloat16));
+    EXPECT_FALSE(TensorCentroidCodes::SupportType(EmbeddingDataType::kElemInt8));
+    EXPECT_FALSE(TensorCentroidCodes::SupportType(EmbeddingDataType::kElemUInt8));
+}
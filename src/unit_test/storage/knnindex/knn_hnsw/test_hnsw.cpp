@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <thread>
 
 #include "gtest/gtest.h"
@@ -110,6 +111,83 @@ public:
 
             test_func(hnsw_index);
         }
+
+        {
+            // Loaded in place from the file content, as from a memory mapped index file
+            u8 file_flags = FileFlags::READ_FLAG;
+            auto [file_handler, status] = fs.OpenFile(save_dir_ + "/test_hnsw.bin", file_flags, FileLockType::kNoLock);
+            if (!status.ok()) {
+                UnrecoverableError(status.message());
+            }
+            SizeT file_size = fs.GetFileSize(*file_handler);
+            auto buffer = MakeUnique<char[]>(file_size);
+            fs.Read(*file_handler, buffer.get(), file_size);
+
+            const char *ptr = buffer.get();
+            auto hnsw_index = Hnsw::LoadFromPtr(ptr);
+            EXPECT_EQ(SizeT(ptr - buffer.get()), file_size);
+
+            test_func(hnsw_index);
+
+            // The index points into the file content, it can't be modified
+            auto iter = DenseVectorIter<float, LabelT>(data.get(), dim, 1);
+            EXPECT_THROW(hnsw_index->InsertVecs(std::move(iter)), RecoverableException);
+            EXPECT_THROW(hnsw_index->Optimize(), RecoverableException);
+            test_func(hnsw_index);
+        }
+    }
+
+    template <typename Hnsw>
+    void TestDistBound() {
+        int dim = 16;
+        int M = 8;
+        int ef_construction = 200;
+        int chunk_size = 128;
+        int max_chunk_n = 10;
+        int element_size = max_chunk_n * chunk_size;
+
+        std::mt19937 rng;
+        rng.seed(0);
+        std::uniform_real_distribution<float> distrib_real;
+
+        auto data = MakeUnique<float[]>(dim * element_size);
+        for (int i = 0; i < dim * element_size; ++i) {
+            data[i] = distrib_real(rng);
+        }
+
+        auto hnsw_index = Hnsw::Make(chunk_size, max_chunk_n, dim, M, ef_construction);
+        auto iter = DenseVectorIter<float, LabelT>(data.get(), dim, element_size);
+        hnsw_index->InsertVecs(std::move(iter));
+
+        // the bound found by another chunk stops the search early, the results within it are mostly those of the search without it
+        constexpr SizeT ef = 50;
+        SizeT hit = 0;
+        SizeT total = 0;
+        for (int i = 0; i < element_size; ++i) {
+            const float *query = data.get() + i * dim;
+            KnnSearchOption search_option{.ef_ = ef};
+            auto result = hnsw_index->KnnSearchSorted(query, ef, search_option);
+            ASSERT_EQ(result.size(), ef);
+            std::sort(result.begin(), result.end());
+
+            for (SizeT bound_i : {SizeT(9), SizeT(24)}) {
+                search_option.dist_bound_ = result[bound_i].first;
+                auto bounded_result = hnsw_index->KnnSearchSorted(query, ef, search_option);
+                std::sort(bounded_result.begin(), bounded_result.end());
+                for (const auto &res : bounded_result) {
+                    EXPECT_LE(res.first, search_option.dist_bound_);
+                }
+
+                for (const auto &res : result) {
+                    if (res.first > search_option.dist_bound_) {
+                        break;
+                    }
+                    ++total;
+                    hit += std::binary_search(bounded_result.begin(), bounded_result.end(), res);
+                }
+            }
+        }
+        EXPECT_GE(hit, total * 0.95);
     }
 
     template <typename Hnsw, typename CompressedHnsw>
@@ -327,3 +405,8 @@ TEST_F(HnswAlgTest, test6) {
     using CompressedHnsw = KnnHnsw<LVQL2VecStoreType<float, int8_t>, LabelT>;
     TestCompress<Hnsw, CompressedHnsw>();
 }
+
+TEST_F(HnswAlgTest, test7) {
+    using Hnsw = KnnHnsw<PlainL2VecStoreType<float>, LabelT>;
+    TestDistBound<Hnsw>();
+}
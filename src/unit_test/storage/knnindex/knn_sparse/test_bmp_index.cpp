@@ -114,6 +114,30 @@ protected:
 
             test_query(index);
         }
+        {
+            // Loaded in place from the file content, as from a memory mapped index file
+            auto [file_handler, status] = fs.OpenFile(save_path, FileFlags::READ_FLAG, FileLockType::kNoLock);
+            if (!status.ok()) {
+                UnrecoverableError(fmt::format("Failed to open file: {}", save_path));
+            }
+            SizeT file_size = fs.GetFileSize(*file_handler);
+            auto buffer = MakeUnique<char[]>(file_size);
+            fs.Read(*file_handler, buffer.get(), file_size);
+
+            const char *p = buffer.get();
+            auto index = BMPAlg::LoadFromPtr(p);
+            EXPECT_EQ(SizeT(p - buffer.get()), file_size);
+            EXPECT_TRUE(index.mmap_loaded());
+
+            test_query(index);
+
+            // The forward blocks point into the file content, the index can't be modified
+            SparseMatrixIter iter(dataset);
+            EXPECT_THROW(index.AddDoc(iter.val(), nrow), RecoverableException);
+            EXPECT_THROW(index.Optimize(BMPOptimizeOptions{.topk_ = static_cast<i32>(topk)}), RecoverableException);
+            EXPECT_EQ(index.DocNum(), nrow);
+            test_query(index);
+        }
     }
 };
 
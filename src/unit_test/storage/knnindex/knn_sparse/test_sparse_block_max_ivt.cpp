@@ -0,0 +1,213 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <functional>
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import sparse_block_max_ivt;
+import sparse_block_max_ivt_cache;
+import sparse_vector_distance;
+import sparse_util;
+import sparse_test_util;
+import knn_result_handler;
+
+using namespace infinity;
+
+class SparseBlockMaxIvtTest : public BaseTest {
+protected:
+    template <typename IdxType>
+    static f32 MergeIP(const SparseVecRef<f32, IdxType> &vec1, const SparseVecRef<f32, IdxType> &vec2) {
+        f32 distance = 0.0;
+        i32 i = 0, j = 0;
+        while (i < vec1.nnz_ && j < vec2.nnz_) {
+            if (vec1.indices_[i] == vec2.indices_[j]) {
+                distance += vec1.data_[i++] * vec2.data_[j++];
+            } else if (vec1.indices_[i] < vec2.indices_[j]) {
+                ++i;
+            } else {
+                ++j;
+            }
+        }
+        return distance;
+    }
+
+    template <typename IdxType>
+    void TestIntersect(u32 ncol, f32 data_sparsity, f32 query_sparsity) {
+        u32 nrow = 200;
+        u32 query_n = 20;
+
+        const auto dataset = SparseTestUtil<f32, IdxType>::GenerateDataset(nrow, ncol, data_sparsity);
+        const auto query_set = SparseTestUtil<f32, IdxType>::GenerateDataset(query_n, ncol, query_sparsity);
+        for (i64 query_id = 0; query_id < query_set.nrow_; ++query_id) {
+            const auto query = query_set.at(query_id);
+            for (i64 row_id = 0; row_id < dataset.nrow_; ++row_id) {
+                const auto vec = dataset.at(row_id);
+                const f32 expected = MergeIP(query, vec);
+                EXPECT_NEAR(SparseIPDistance(query.data_, query.indices_, query.nnz_, vec.data_, vec.indices_, vec.nnz_), expected, 1e-3);
+                EXPECT_NEAR(SparseIPDistance(vec.data_, vec.indices_, vec.nnz_, query.data_, query.indices_, query.nnz_), expected, 1e-3);
+
+                i32 common = 0;
+                for (i32 i = 0; i < query.nnz_; ++i) {
+                    common += std::binary_search(vec.indices_, vec.indices_ + vec.nnz_, query.indices_[i]);
+                }
+                EXPECT_EQ((SparseBitIPDistance<IdxType, i32>(query.indices_, query.nnz_, vec.indices_, vec.nnz_)), common);
+            }
+        }
+    }
+
+    template <typename IdxType>
+    void TestSearch(u32 nrow, u32 search_row_count, u32 topk) {
+        u32 ncol = 1000;
+        f32 sparsity = 0.02;
+
+        const auto dataset = SparseTestUtil<f32, IdxType>::GenerateDataset(nrow, ncol, sparsity);
+        SparseBlockMaxIvt<f32, IdxType> ivt(nrow, [&](SizeT row) { return dataset.at(row); });
+        EXPECT_EQ(ivt.row_count(), nrow);
+        CheckSearch(ivt, dataset, search_row_count, topk);
+    }
+
+    // The index of the first rows extended to the whole dataset searches as one built at once
+    template <typename IdxType>
+    void TestExtend(u32 nrow, u32 first_row_count, u32 topk) {
+        u32 ncol = 1000;
+        f32 sparsity = 0.02;
+
+        const auto dataset = SparseTestUtil<f32, IdxType>::GenerateDataset(nrow, ncol, sparsity);
+        auto get_row = [&](SizeT row) { return dataset.at(row); };
+        SparseBlockMaxIvt<f32, IdxType> first_ivt(first_row_count, get_row);
+        SharedPtr<SparseBlockMaxIvt<f32, IdxType>> ivt = first_ivt.Extend(nrow, get_row);
+        EXPECT_EQ(ivt->row_count(), nrow);
+        EXPECT_EQ(first_ivt.row_count(), first_row_count);
+        CheckSearch(*ivt, dataset, nrow, topk);
+        CheckSearch(first_ivt, dataset, first_row_count, topk);
+    }
+
+    template <typename IdxType>
+    void CheckSearch(const SparseBlockMaxIvt<f32, IdxType> &ivt, const SparseMatrix<f32, IdxType> &dataset, u32 search_row_count, u32 topk) {
+        u32 ncol = 1000;
+        f32 sparsity = 0.02;
+        u32 query_n = 20;
+
+        const auto query_set = SparseTestUtil<f32, IdxType>::GenerateDataset(query_n, ncol, sparsity);
+        for (i64 query_id = 0; query_id < query_set.nrow_; ++query_id) {
+            const auto query = query_set.at(query_id);
+
+            Vector<f32> expected_scores(search_row_count);
+            for (u32 row = 0; row < search_row_count; ++row) {
+                expected_scores[row] = SparseVecUtil::DistanceIP(query, dataset.at(row));
+            }
+            std::sort(expected_scores.begin(), expected_scores.end(), std::greater<f32>());
+            expected_scores.resize(std::min(topk, search_row_count));
+
+            Vector<u32> result(topk);
+            Vector<f32> result_score(topk);
+            HeapResultHandler<CompareMin<f32, u32>> result_handler(1 /*query_n*/, topk, result_score.data(), result.data());
+            SizeT scored_rows = 0;
+            auto kth_score = [&]() -> Optional<f32> {
+                if (result_handler.GetSize(0) < topk) {
+                    return None;
+                }
+                return result_handler.GetDistance0(0);
+            };
+            auto score_row = [&](SizeT row) { return SparseVecUtil::DistanceIP(query, dataset.at(row)); };
+            auto add_result = [&](SizeT row, f32 score) {
+                EXPECT_LT(row, search_row_count);
+                result_handler.AddResult(0 /*query_id*/, score, row);
+                ++scored_rows;
+            };
+            ivt.template Search<f32>(query, search_row_count, kth_score, score_row, add_result);
+            EXPECT_LE(scored_rows, search_row_count);
+
+            SizeT result_n = result_handler.GetSize(0);
+            result_handler.End(0);
+            ASSERT_EQ(result_n, expected_scores.size());
+            for (SizeT i = 0; i < result_n; ++i) {
+                // the rows are scored as by a scan
+                EXPECT_EQ(result_score[i], expected_scores[i]);
+                EXPECT_EQ(result_score[i], SparseVecUtil::DistanceIP(query, dataset.at(result[i])));
+            }
+        }
+    }
+};
+
+TEST_F(SparseBlockMaxIvtTest, intersect) {
+    // merged in blocks
+    TestIntersect<i16>(1000, 0.05, 0.05);
+    TestIntersect<i32>(1000, 0.05, 0.05);
+    TestIntersect<i64>(1000, 0.05, 0.05);
+    // galloping
+    TestIntersect<i16>(30000, 0.1, 0.0005);
+    TestIntersect<i32>(30000, 0.1, 0.0005);
+}
+
+TEST_F(SparseBlockMaxIvtTest, search) {
+    TestSearch<i16>(2000, 2000, 10);
+    TestSearch<i32>(2000, 2000, 10);
+    // rows appended after the search snapshot are not returned
+    TestSearch<i32>(2000, 1500, 10);
+    // fewer rows than topk
+    TestSearch<i32>(50, 50, 100);
+}
+
+TEST_F(SparseBlockMaxIvtTest, extend) {
+    // a partial chunk extended
+    TestExtend<i32>(3000, 1500, 10);
+    // complete chunks shared
+    TestExtend<i32>(3000, 2048, 10);
+    TestExtend<i16>(2000, 2000, 10);
+}
+
+TEST_F(SparseBlockMaxIvtTest, cache) {
+    const auto dataset = SparseTestUtil<f32, i32>::GenerateDataset(2000, 1000, 0.02);
+    auto build = [&](const SparseBlockMaxIvtBase *old) -> SharedPtr<SparseBlockMaxIvtBase> {
+        auto get_row = [&](SizeT row) { return dataset.at(row); };
+        if (old != nullptr) {
+            return static_cast<const SparseBlockMaxIvt<f32, i32> *>(old)->Extend(2000, get_row);
+        }
+        return MakeShared<SparseBlockMaxIvt<f32, i32>>(1000, get_row);
+    };
+
+    auto &cache = SparseBlockMaxIvtCache::instance();
+    const SizeT old_memory_limit = cache.memory_limit();
+    auto slot1 = MakeShared<SparseBlockMaxIvtSlot>();
+    auto slot2 = MakeShared<SparseBlockMaxIvtSlot>();
+
+    SharedPtr<SparseBlockMaxIvtBase> ivt1 = slot1->Get(1000, build);
+    EXPECT_EQ(ivt1->row_count(), 1000u);
+    EXPECT_EQ(slot1->Get(500, build), ivt1);
+    // extended on append
+    SharedPtr<SparseBlockMaxIvtBase> ivt2 = slot1->Get(2000, build);
+    EXPECT_EQ(ivt2->row_count(), 2000u);
+    EXPECT_EQ(slot1->memory_usage(), ivt2->MemoryUsage());
+
+    // the least recently used index is evicted over the limit
+    cache.SetMemoryLimit(slot1->memory_usage() + 1);
+    SharedPtr<SparseBlockMaxIvtBase> ivt3 = slot2->Get(1000, build);
+    EXPECT_EQ(slot1->memory_usage(), 0u);
+    EXPECT_EQ(slot2->memory_usage(), ivt3->MemoryUsage());
+    EXPECT_LE(cache.memory_usage(), cache.memory_limit());
+    // the search holding the evicted index keeps it
+    EXPECT_EQ(ivt2->row_count(), 2000u);
+
+    // an evicted index is built again
+    cache.SetMemoryLimit(ivt3->MemoryUsage() + 1);
+    EXPECT_EQ(slot1->Get(1000, build)->row_count(), 1000u);
+    EXPECT_EQ(slot2->memory_usage(), 0u);
+
+    cache.SetMemoryLimit(old_memory_limit);
+}
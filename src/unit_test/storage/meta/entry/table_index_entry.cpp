@@ -28,6 +28,8 @@ import sparse_info;
 import index_hnsw;
 import index_full_text;
 import index_bmp;
+import index_secondary;
+import index_base;
 import statement_common;
 import data_access_state;
 import txn_store;
@@ -36,12 +38,16 @@ import internal_types;
 import constant_expr;
 import parsed_expr;
 import base_table_ref;
+import block_index;
+import create_index_data;
+import index_build_tracer;
 
 import base_entry;
 import table_entry;
 import table_index_entry;
 import segment_entry;
 import block_entry;
+import segment_index_entry;
 
 using namespace infinity;
 
@@ -336,4 +342,227 @@ TEST_P(TableIndexEntryTest, opt_bmp_index_test){
     }
 
     DropTable();
-}
\ No newline at end of file
+}
+// Create tbl1 with a column of `column_type` and import `segment_count` sealed segments
+template <typename AppendRow>
+void CreateSegmentedTable(SharedPtr<DataType> column_type, SizeT segment_count, SizeT segment_row_count, AppendRow &&append_row) {
+    TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+    {
+        auto *txn1 = txn_mgr->BeginTxn(MakeUnique<String>("create table"));
+        Vector<SharedPtr<ColumnDef>> columns;
+        {
+            std::set<ConstraintType> constraints;
+            auto column_def_ptr = MakeShared<ColumnDef>(0, std::move(column_type), "col1", constraints);
+            columns.emplace_back(column_def_ptr);
+        }
+        auto tbl1_def = MakeUnique<TableDef>(MakeShared<String>("default_db"), MakeShared<String>("tbl1"), columns);
+        auto status = txn1->CreateTable("default_db", std::move(tbl1_def), ConflictType::kError);
+        EXPECT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn1);
+    }
+    // every import is a sealed segment
+    for (SizeT segment_i = 0; segment_i < segment_count; ++segment_i) {
+        auto *txn1 = txn_mgr->BeginTxn(MakeUnique<String>("import"));
+        auto [table_entry, status] = txn1->GetTableByName("default_db", "tbl1");
+        EXPECT_TRUE(status.ok());
+        SegmentID segment_id = Catalog::GetNextSegmentID(table_entry);
+        SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry, segment_id, txn1);
+        {
+            UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), 0, 0, table_entry->ColumnCount(), txn1);
+            ColumnVector column_vector = block_entry->GetColumnBlockEntry(0)->GetColumnVector(txn1->buffer_mgr());
+            for (SizeT row = 0; row < segment_row_count; ++row) {
+                append_row(column_vector, segment_i * segment_row_count + row);
+            }
+            block_entry->IncreaseRowCount(segment_row_count);
+            segment_entry->AppendBlockEntry(std::move(block_entry));
+        }
+        segment_entry->FlushNewData();
+        txn1->Import(table_entry, segment_entry);
+        txn_mgr->CommitTxn(txn1);
+    }
+}
+
+// Create the index and defer the populate of all the segments to CreateIndexDo, as PhysicalCreateIndexPrepare does
+Pair<SharedPtr<BaseTableRef>, Vector<SegmentIndexEntry *>> CreateIndexDeferred(Txn *txn, const SharedPtr<IndexBase> &index_base) {
+    auto [table_entry, table_status] = txn->GetTableByName("default_db", "tbl1");
+    EXPECT_TRUE(table_status.ok());
+    auto [table_index_entry, index_status] = txn->CreateIndexDef(table_entry, index_base, ConflictType::kError);
+    EXPECT_TRUE(index_status.ok());
+    auto table_ref = BaseTableRef::FakeTableRef(table_entry, txn);
+    table_ref->index_index_ = MakeShared<IndexIndex>();
+    auto [segment_index_entries, status] = txn->CreateIndexPrepareDeferred(table_index_entry, table_ref.get());
+    EXPECT_TRUE(status.ok());
+    for (auto *segment_index_entry : segment_index_entries) {
+        table_ref->index_index_->Insert(table_index_entry, segment_index_entry);
+    }
+    return {table_ref, segment_index_entries};
+}
+
+TEST_P(TableIndexEntryTest, cancel_create_index_test) {
+    TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+    const String db_name = "default_db";
+    const String table_name = "tbl1";
+    const String index_name = "idx1";
+    constexpr SizeT segment_count = 3;
+    constexpr SizeT segment_row_count = 100;
+    constexpr SizeT dimension = 4;
+
+    auto embedding_info = MakeShared<EmbeddingInfo>(EmbeddingDataType::kElemFloat, dimension);
+    CreateSegmentedTable(MakeShared<DataType>(LogicalType::kEmbedding, embedding_info),
+                         segment_count,
+                         segment_row_count,
+                         [&](ColumnVector &column_vector, SizeT row) {
+                             Array<f32, dimension> v{};
+                             for (SizeT i = 0; i < dimension; ++i) {
+                                 v[i] = row + i;
+                             }
+                             column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(v.data()));
+                         });
+
+    SharedPtr<IndexBase> index_base;
+    {
+        Vector<InitParameter *> parameters;
+        parameters.emplace_back(new InitParameter("metric", "l2"));
+        parameters.emplace_back(new InitParameter("m", "16"));
+        parameters.emplace_back(new InitParameter("ef_construction", "50"));
+        parameters.emplace_back(new InitParameter("encode", "plain"));
+        index_base = IndexHnsw::Make(MakeShared<String>(index_name), "tbl1_idx1", {"col1"}, parameters);
+        for (auto parameter : parameters) {
+            delete parameter;
+        }
+    }
+    // The populate of the segments in `table_ref->index_index_` as the tasks of CREATE INDEX run it
+    auto create_index_do = [&](Txn *txn, BaseTableRef *table_ref, CreateIndexSharedData &create_index_data, IndexBuildJob *build_job) {
+        auto status = txn->CreateIndexDo(table_ref, index_name, create_index_data.create_index_idxes_, build_job);
+        EXPECT_TRUE(status.ok());
+    };
+    auto get_index = [&](Txn *txn) {
+        auto [table_entry, table_status] = txn->GetTableByName(db_name, table_name);
+        EXPECT_TRUE(table_status.ok());
+        auto [table_index_entry, index_status] = txn->GetIndexByName(db_name, table_name, index_name);
+        EXPECT_TRUE(index_status.ok());
+        return MakePair(table_index_entry, BaseTableRef::FakeTableRef(table_entry, txn));
+    };
+
+    // cancel the build after its first segment
+    {
+        auto *txn1 = txn_mgr->BeginTxn(MakeUnique<String>("create index"));
+        auto [table_ref, segment_index_entries] = CreateIndexDeferred(txn1, index_base);
+        ASSERT_EQ(segment_index_entries.size(), segment_count);
+        auto [table_index_entry, index_status] = txn1->GetIndexByName(db_name, table_name, index_name);
+        EXPECT_TRUE(index_status.ok());
+
+        CreateIndexSharedData create_index_data(table_ref->block_index_.get());
+        IndexBuildJob build_job(1, txn1->TxnID(), db_name, table_name, index_name, segment_count * segment_row_count, segment_count);
+        EXPECT_EQ(build_job.RemainingMs(), -1);
+        {
+            auto first_table_ref = BaseTableRef::FakeTableRef(table_ref->table_entry_ptr_, txn1);
+            first_table_ref->index_index_ = MakeShared<IndexIndex>();
+            first_table_ref->index_index_->Insert(table_index_entry, segment_index_entries[0]);
+            create_index_do(txn1, first_table_ref.get(), create_index_data, &build_job);
+        }
+        EXPECT_EQ(build_job.processed_rows(), segment_row_count);
+        EXPECT_EQ(build_job.finished_segments(), 1u);
+        EXPECT_GE(build_job.RemainingMs(), 0);
+
+        build_job.Cancel();
+        EXPECT_THROW(build_job.CheckCancelled(), RecoverableException);
+        create_index_do(txn1, table_ref.get(), create_index_data, &build_job);
+        EXPECT_EQ(build_job.processed_rows(), segment_row_count);
+        EXPECT_EQ(build_job.finished_segments(), 1u);
+        for (SizeT i = 1; i < segment_count; ++i) {
+            EXPECT_TRUE(segment_index_entries[i]->PopulateAbandoned());
+        }
+
+        auto status = txn1->CreateIndexFinish(db_name, table_name, index_base);
+        EXPECT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn1);
+    }
+    // the built segment is committed and the index is partial
+    {
+        auto *txn1 = txn_mgr->BeginTxn(MakeUnique<String>("check"));
+        auto [table_index_entry, table_ref] = get_index(txn1);
+        EXPECT_EQ(table_index_entry->index_by_segment().size(), 1u);
+        EXPECT_TRUE(table_index_entry->PartiallyBuilt(table_ref->block_index_.get()));
+        txn_mgr->CommitTxn(txn1);
+    }
+    // a resume that rolls back leaves the index as it was
+    {
+        auto *txn1 = txn_mgr->BeginTxn(MakeUnique<String>("resume"));
+        auto [table_index_entry, table_ref] = get_index(txn1);
+        table_ref->index_index_ = MakeShared<IndexIndex>();
+        Vector<SegmentIndexEntry *> segment_index_entries = txn1->CreateIndexResume(table_index_entry, table_ref.get());
+        EXPECT_EQ(segment_index_entries.size(), segment_count - 1);
+        for (auto *segment_index_entry : segment_index_entries) {
+            table_ref->index_index_->Insert(table_index_entry, segment_index_entry);
+        }
+        CreateIndexSharedData create_index_data(table_ref->block_index_.get());
+        create_index_do(txn1, table_ref.get(), create_index_data, nullptr);
+        EXPECT_EQ(table_index_entry->index_by_segment().size(), segment_count);
+        txn_mgr->RollBackTxn(txn1);
+
+        EXPECT_EQ(table_index_entry->index_by_segment().size(), 1u);
+    }
+    // a resume that commits builds the rest
+    {
+        auto *txn1 = txn_mgr->BeginTxn(MakeUnique<String>("resume"));
+        auto [table_index_entry, table_ref] = get_index(txn1);
+        table_ref->index_index_ = MakeShared<IndexIndex>();
+        Vector<SegmentIndexEntry *> segment_index_entries = txn1->CreateIndexResume(table_index_entry, table_ref.get());
+        EXPECT_EQ(segment_index_entries.size(), segment_count - 1);
+        for (auto *segment_index_entry : segment_index_entries) {
+            table_ref->index_index_->Insert(table_index_entry, segment_index_entry);
+        }
+        CreateIndexSharedData create_index_data(table_ref->block_index_.get());
+        create_index_do(txn1, table_ref.get(), create_index_data, nullptr);
+        auto status = txn1->CreateIndexFinish(db_name, table_name, index_base);
+        EXPECT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn1);
+    }
+    {
+        auto *txn1 = txn_mgr->BeginTxn(MakeUnique<String>("check"));
+        auto [table_index_entry, table_ref] = get_index(txn1);
+        EXPECT_EQ(table_index_entry->index_by_segment().size(), segment_count);
+        EXPECT_FALSE(table_index_entry->PartiallyBuilt(table_ref->block_index_.get()));
+        EXPECT_TRUE(table_index_entry->CreateIndexResume(table_ref.get(), txn1).empty());
+        txn_mgr->CommitTxn(txn1);
+    }
+
+    DropTable();
+}
+
+TEST_P(TableIndexEntryTest, cancel_create_secondary_index_test) {
+    TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+    const String db_name = "default_db";
+    const String table_name = "tbl1";
+    const String index_name = "idx1";
+    constexpr SizeT segment_count = 3;
+    constexpr SizeT segment_row_count = 100;
+
+    CreateSegmentedTable(MakeShared<DataType>(LogicalType::kInteger), segment_count, segment_row_count, [](ColumnVector &column_vector, SizeT row) {
+        i32 v = row;
+        column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
+    });
+
+    // a secondary index has no per-segment fallback, so a cancel rolls back the build
+    auto index_base = IndexSecondary::Make(MakeShared<String>(index_name), "tbl1_idx1", {"col1"});
+    {
+        auto *txn1 = txn_mgr->BeginTxn(MakeUnique<String>("create index"));
+        auto [table_ref, segment_index_entries] = CreateIndexDeferred(txn1, index_base);
+        ASSERT_EQ(segment_index_entries.size(), segment_count);
+
+        CreateIndexSharedData create_index_data(table_ref->block_index_.get());
+        IndexBuildJob build_job(1, txn1->TxnID(), db_name, table_name, index_name, segment_count * segment_row_count, segment_count);
+        build_job.Cancel();
+        EXPECT_THROW(txn1->CreateIndexDo(table_ref.get(), index_name, create_index_data.create_index_idxes_, &build_job), RecoverableException);
+        txn_mgr->RollBackTxn(txn1);
+    }
+    {
+        auto *txn1 = txn_mgr->BeginTxn(MakeUnique<String>("check"));
+        auto [table_index_entry, index_status] = txn1->GetIndexByName(db_name, table_name, index_name);
+        EXPECT_FALSE(index_status.ok());
+        txn_mgr->CommitTxn(txn1);
+    }
+
+    DropTable();
+}
@@ -0,0 +1,122 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import third_party;
+import compilation_config;
+import buffer_manager;
+import buffer_obj;
+import buffer_handle;
+import secondary_index_file_worker;
+import index_secondary;
+import column_def;
+import data_type;
+import logical_type;
+import infinity_context;
+import config;
+import local_file_system;
+
+using namespace infinity;
+
+// The (key, offset) parts of a secondary index are used in place from the mapped file with `index_mmap_load`
+class SecondaryIndexMmapTest : public BaseTestParamStr {
+protected:
+    void SetUp() override {
+        BaseTestParamStr::SetUp();
+        data_dir_ = MakeShared<String>(String(tmp_data_path()) + "/secondary_index_mmap/data");
+        temp_dir_ = MakeShared<String>(String(tmp_data_path()) + "/secondary_index_mmap/temp");
+        fs_.DeleteDirectory(*data_dir_);
+        fs_.DeleteDirectory(*temp_dir_);
+        fs_.CreateDirectory(*data_dir_);
+        fs_.CreateDirectory(*temp_dir_);
+    }
+
+    void TearDown() override {
+        fs_.DeleteDirectory(*data_dir_);
+        fs_.DeleteDirectory(*temp_dir_);
+        BaseTestParamStr::TearDown();
+    }
+
+    UniquePtr<SecondaryIndexFileWorkerParts> MakeFileWorker(u32 row_count, u32 part_id) {
+        auto index_base = IndexSecondary::Make(MakeShared<String>("idx1"), "idx1", Vector<String>{"c1"});
+        auto column_def = MakeShared<ColumnDef>(0, MakeShared<DataType>(DataType(LogicalType::kInteger)), "c1", std::set<ConstraintType>());
+        return MakeUnique<SecondaryIndexFileWorkerParts>(data_dir_,
+                                                         temp_dir_,
+                                                         MakeShared<String>(""),
+                                                         MakeShared<String>(fmt::format("part_{}", part_id)),
+                                                         std::move(index_base),
+                                                         std::move(column_def),
+                                                         row_count,
+                                                         part_id);
+    }
+
+    LocalFileSystem fs_;
+    SharedPtr<String> data_dir_;
+    SharedPtr<String> temp_dir_;
+};
+
+INSTANTIATE_TEST_SUITE_P(TestWithDifferentParams,
+                         SecondaryIndexMmapTest,
+                         ::testing::Values("test/data/config/test_index_mmap_load_vfs_off.toml"));
+
+TEST_P(SecondaryIndexMmapTest, read_from_mmap) {
+    ASSERT_TRUE(InfinityContext::instance().config()->IndexMmapLoad());
+
+    constexpr SizeT buffer_size = 1 << 20;
+    // the second part holds the last 1000 rows
+    constexpr u32 row_count = 8192 + 1000;
+    constexpr u32 part_id = 1;
+    constexpr SizeT part_size = (row_count - 8192) * (sizeof(i32) + sizeof(u32));
+
+    Vector<char> data(part_size);
+    for (SizeT i = 0; i < part_size; ++i) {
+        data[i] = static_cast<char>(i % 251);
+    }
+    {
+        BufferManager buffer_mgr(buffer_size, data_dir_, temp_dir_);
+        auto *buffer_obj = buffer_mgr.AllocateBufferObject(MakeFileWorker(row_count, part_id));
+        {
+            auto handle = buffer_obj->Load();
+            std::memcpy(handle.GetDataMut(), data.data(), part_size);
+        }
+        buffer_obj->Save();
+    }
+    {
+        BufferManager buffer_mgr(buffer_size, data_dir_, temp_dir_);
+        auto *buffer_obj = buffer_mgr.GetBufferObject(MakeFileWorker(row_count, part_id));
+        {
+            auto handle = buffer_obj->Load();
+            EXPECT_EQ(std::memcmp(handle.GetData(), data.data(), part_size), 0);
+
+            // changed in the private mapping, the file is replaced when saved
+            for (SizeT i = 0; i < part_size; ++i) {
+                data[i] = static_cast<char>(i % 241);
+            }
+            std::memcpy(handle.GetDataMut(), data.data(), part_size);
+        }
+        buffer_obj->Save();
+        EXPECT_FALSE(fs_.Exists(buffer_obj->GetFilename() + ".tmp"));
+    }
+    {
+        BufferManager buffer_mgr(buffer_size, data_dir_, temp_dir_);
+        auto *buffer_obj = buffer_mgr.GetBufferObject(MakeFileWorker(row_count, part_id));
+        auto handle = buffer_obj->Load();
+        EXPECT_EQ(std::memcmp(handle.GetData(), data.data(), part_size), 0);
+    }
+}
@@ -59,6 +59,11 @@ import table_index_entry;
 import base_entry;
 import compilation_config;
 import compaction_process;
+import session;
+import session_manager;
+import query_context;
+import query_result;
+import third_party;
 
 using namespace infinity;
 
@@ -472,6 +477,92 @@ TEST_P(WalReplayTest, wal_replay_append) {
     }
 }
 
+TEST_P(WalReplayTest, wal_replay_multi_block_insert) {
+    // one INSERT spanning several blocks is logged as one append per block
+    constexpr SizeT row_count = 2 * DEFAULT_BLOCK_CAPACITY + 100;
+    auto query = [](const String &query_text) {
+        SharedPtr<RemoteSession> session = InfinityContext::instance().session_manager()->CreateRemoteSession();
+        UniquePtr<QueryContext> query_context = MakeUnique<QueryContext>(session.get());
+        query_context->Init(InfinityContext::instance().config(),
+                            InfinityContext::instance().task_scheduler(),
+                            InfinityContext::instance().storage(),
+                            InfinityContext::instance().resource_manager(),
+                            InfinityContext::instance().session_manager(),
+                            InfinityContext::instance().persistence_manager());
+        QueryResult result = query_context->Query(query_text);
+        query_context.reset();
+        InfinityContext::instance().session_manager()->RemoveSessionByID(session->session_id());
+        return result;
+    };
+    {
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        std::shared_ptr<std::string> config_path = WalReplayTest::config_path();
+        infinity::InfinityContext::instance().Init(config_path);
+
+        EXPECT_TRUE(query("CREATE TABLE tbl1 (c1 INTEGER, c2 VARCHAR);").IsOk());
+        String insert_sql = "INSERT INTO tbl1 VALUES ";
+        for (SizeT i = 0; i < row_count; ++i) {
+            insert_sql += fmt::format("{}({}, 'row {}')", i == 0 ? "" : ", ", i, i);
+        }
+        insert_sql += ";";
+        QueryResult result = query(insert_sql);
+        EXPECT_TRUE(result.IsOk()) << result.ErrorMsg();
+
+        // no checkpoint, the rows are replayed from the WAL
+        infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+        infinity::GlobalResourceUsage::UnInit();
+#endif
+    }
+    // Restart the db instance
+    {
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        std::shared_ptr<std::string> config_path = WalReplayTest::config_path();
+        infinity::InfinityContext::instance().Init(config_path);
+
+        Storage *storage = infinity::InfinityContext::instance().storage();
+        TxnManager *txn_mgr = storage->txn_manager();
+        {
+            auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("check table"));
+            TxnTimeStamp begin_ts = txn->BeginTS();
+            auto [table_entry, status] = txn->GetTableByName("default_db", "tbl1");
+            ASSERT_NE(table_entry, nullptr);
+
+            auto segment_entry = table_entry->GetSegmentByID(0, begin_ts);
+            ASSERT_NE(segment_entry, nullptr);
+            EXPECT_EQ(segment_entry->row_count(), row_count);
+
+            SizeT row_id = 0;
+            for (SizeT block_id = 0; row_id < row_count; ++block_id) {
+                auto *block_entry = segment_entry->GetBlockEntryByID(block_id).get();
+                ASSERT_NE(block_entry, nullptr);
+                const SizeT block_row_count = std::min<SizeT>(row_count - row_id, DEFAULT_BLOCK_CAPACITY);
+                EXPECT_EQ(block_entry->row_count(), block_row_count);
+
+                ColumnVector col0 = block_entry->GetColumnBlockEntry(0)->GetConstColumnVector(storage->buffer_manager());
+                ColumnVector col1 = block_entry->GetColumnBlockEntry(1)->GetConstColumnVector(storage->buffer_manager());
+                for (SizeT i = 0; i < block_row_count; ++i, ++row_id) {
+                    EXPECT_EQ(col0.GetValue(i).GetValue<IntegerT>(), static_cast<i32>(row_id));
+                    EXPECT_EQ(col1.GetValue(i).GetVarchar(), fmt::format("row {}", row_id));
+                }
+            }
+            txn_mgr->CommitTxn(txn);
+        }
+        infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+        infinity::GlobalResourceUsage::UnInit();
+#endif
+    }
+}
+
 TEST_P(WalReplayTest, wal_replay_import) {
     {
 #ifdef INFINITY_DEBUG
@@ -65,6 +65,7 @@ struct HeartBeatResponse {
 struct SyncLogRequest {
 1: string node_name,
 2: list<binary> log_entries,
+3: i64 prev_commit_ts,
 }
 
 struct SyncLogResponse {
@@ -1,8 +1,10 @@
 # generate 'test/sql/dml/import/test_import_big_sparse.slt' & 'test/sql/dml/import/test_insert_big_sparse.slt' & 'test/sql/dql/knn/sparse/test_knn_sparse_bmp_big.slt'
+# & 'test/sql/dql/knn/sparse/test_knn_sparse_big.slt'
 # genrate 'test/data/csv/test_sparse/big_sparse.csv'
 
 import argparse
 import os
+import numpy as np
 from generate_util.generate_sparse_data import *
 from generate_util.format_data import sparse_format_float
 
@@ -23,6 +25,7 @@ def generate(generate_if_exists: bool, copy_dir: str):
     import_slt_path = import_slt_dir + "/test_import_big_sparse.slt"
     insert_slt_path = insert_slt_dir + "/test_insert_big_sparse.slt"
     bmp_knn_slt_path = knn_slt_dir + "/test_knn_sparse_bmp_big.slt"
+    knn_slt_path = knn_slt_dir + "/test_knn_sparse_big.slt"
     copy_path = copy_dir + "/" + csv_filename
 
     os.makedirs(csv_dir, exist_ok=True)
@@ -33,11 +36,12 @@ def generate(generate_if_exists: bool, copy_dir: str):
         and os.path.exists(import_slt_path)
         and os.path.exists(insert_slt_path)
         and os.path.exists(bmp_knn_slt_path)
+        and os.path.exists(knn_slt_path)
         and not generate_if_exists
     ):
         print(
-            "File {} and {} and {} and {} already existed. Skip Generating.".format(
-                csv_path, import_slt_path, insert_slt_path, bmp_knn_slt_path
+            "File {} and {} and {} and {} and {} already existed. Skip Generating.".format(
+                csv_path, import_slt_path, insert_slt_path, bmp_knn_slt_path, knn_slt_path
             )
         )
         return
@@ -207,6 +211,76 @@ def generate(generate_if_exists: bool, copy_dir: str):
         bmp_knn_slt_file.write("DROP TABLE {};\n".format(table_name))
         bmp_knn_slt_file.write("\n")
 
+    # Without index, the blocks of at least 1024 rows are searched by the in-memory block-max index. The results must be
+    # the brute force ones, also after rows are appended to the indexed block.
+    knn_row_n = 1200
+    append_n = 20
+    knn_indptr = indptr[: knn_row_n + 1]
+    knn_indices = indices[: indptr[knn_row_n]]
+    knn_data = data[: indptr[knn_row_n]]
+    aindptr, aindices, adata = generate_sparse_data(append_n, max_dim, sparsity)
+    all_indptr = np.concatenate([knn_indptr, aindptr[1:] + knn_indptr[-1]])
+    all_indices = np.concatenate([knn_indices, aindices])
+    all_data = np.concatenate([knn_data, adata])
+
+    def format_sparse(vindices, vdata):
+        return ",".join(["{}:{}".format(i, d) for (i, d) in zip(vindices, vdata)])
+
+    def write_insert(slt_file, row_begin, row_end, row_id_offset, row_indptr, row_indices, row_data):
+        slt_file.write("statement ok\n")
+        slt_file.write("INSERT INTO {} VALUES\n".format(table_name))
+        for j in range(row_begin, row_end):
+            start, end = row_indptr[j], row_indptr[j + 1]
+            slt_file.write(
+                "({},[{}])".format(j + row_id_offset, format_sparse(row_indices[start:end], row_data[start:end]))
+            )
+            slt_file.write(",\n" if j != row_end - 1 else ";\n")
+        slt_file.write("\n")
+
+    def write_knn_queries(slt_file, q_indptr, q_indices, q_data, row_indptr, row_indices, row_data):
+        for i in range(0, query_n):
+            start, end = q_indptr[i], q_indptr[i + 1]
+            slt_file.write("query I\n")
+            slt_file.write(
+                "SELECT c1 FROM {} SEARCH MATCH SPARSE (c2, [{}], 'ip', {});\n".format(
+                    table_name, format_sparse(q_indices[start:end], q_data[start:end]), topk
+                )
+            )
+            res = find_topk(
+                row_indptr, row_indices, row_data, topk, q_indices[start:end], q_data[start:end]
+            )
+            slt_file.write("----\n")
+            for r in res:
+                slt_file.write("{}\n".format(r))
+            slt_file.write("\n")
+
+    with open(knn_slt_path, "w") as knn_slt_file:
+        knn_slt_file.write("statement ok\n")
+        knn_slt_file.write("DROP TABLE IF EXISTS {};\n".format(table_name))
+        knn_slt_file.write("\n")
+
+        knn_slt_file.write("statement ok\n")
+        knn_slt_file.write(
+            "CREATE TABLE {} ( c1 INT, c2 SPARSE(FLOAT, {}));\n".format(
+                table_name, max_dim
+            )
+        )
+        knn_slt_file.write("\n")
+
+        # one block of knn_row_n rows
+        for i in range(0, knn_row_n, insert_batch * 10):
+            write_insert(knn_slt_file, i, min(i + insert_batch * 10, knn_row_n), 0, knn_indptr, knn_indices, knn_data)
+
+        write_knn_queries(knn_slt_file, qindptr, qindices, qdata, knn_indptr, knn_indices, knn_data)
+
+        # the index of the block is extended by the appended rows, queried by themselves to enter the top-k
+        write_insert(knn_slt_file, 0, append_n, knn_row_n, aindptr, aindices, adata)
+        write_knn_queries(knn_slt_file, aindptr, aindices, adata, all_indptr, all_indices, all_data)
+        write_knn_queries(knn_slt_file, qindptr, qindices, qdata, all_indptr, all_indices, all_data)
+
+        knn_slt_file.write("statement ok\n")
+        knn_slt_file.write("DROP TABLE {};\n".format(table_name))
+        knn_slt_file.write("\n")
 
 if __name__ == "__main__":
     parser = argparse.ArgumentParser(description="Generate fvecs data for test")